@@ -93,6 +93,30 @@ void CreateContact(pybind11::module& module)
         .def(py::init())
         .def_readwrite("position", &Corner::position)
         .def_readwrite("force", &Corner::force);
+    py::class_<CornerArray>(module, "CornerArray")
+        .def(py::init())
+        .def("resize", &CornerArray::resize, py::arg("size"))
+        .def("push_back", &CornerArray::push_back, py::arg("corner"))
+        .def("positions", &CornerArray::positions)
+        .def("forces", &CornerArray::forces)
+        .def("__len__", &CornerArray::size)
+        .def(
+            "__getitem__",
+            [](CornerArray& corners, std::size_t index) -> Corner& {
+                if (index >= corners.size())
+                {
+                    throw py::index_error();
+                }
+                return corners[index];
+            },
+            py::return_value_policy::reference_internal)
+        .def("__setitem__", [](CornerArray& corners, std::size_t index, const Corner& corner) {
+            if (index >= corners.size())
+            {
+                throw py::index_error();
+            }
+            corners[index] = corner;
+        });
 }
 
 void CreateContactList(pybind11::module& module)
@@ -116,6 +140,97 @@ void CreateContactList(pybind11::module& module)
              py::arg("transform"),
              py::arg("activation_time"),
              py::arg("deactivation_time"))
+        .def(
+            "add_contacts_from_arrays",
+            [](ContactList& l,
+               const Eigen::MatrixXd& poses,
+               const Eigen::MatrixXd& timings,
+               const std::vector<std::string>& names) -> bool {
+                if (poses.cols() != 7)
+                {
+                    throw py::value_error("The poses must be a Nx7 array containing the position "
+                                          "and the quaternion (x, y, z, qx, qy, qz, qw).");
+                }
+                if (timings.cols() != 2)
+                {
+                    throw py::value_error("The timings must be a Nx2 array containing the "
+                                          "activation and the deactivation time in seconds.");
+                }
+                if (poses.rows() != timings.rows())
+                {
+                    throw py::value_error("The number of poses and timings must match.");
+                }
+                if (!names.empty() && static_cast<Eigen::Index>(names.size()) != poses.rows())
+                {
+                    throw py::value_error("The number of names must match the number of poses.");
+                }
+
+                for (Eigen::Index i = 0; i < poses.rows(); i++)
+                {
+                    PlannedContact contact;
+                    Eigen::Quaterniond quaternion(poses(i, 6),
+                                                  poses(i, 3),
+                                                  poses(i, 4),
+                                                  poses(i, 5));
+                    quaternion.normalize();
+                    contact.pose
+                        = manif::SE3d(Eigen::Vector3d(poses.row(i).head<3>().transpose()),
+                                      quaternion);
+                    contact.activationTime
+                        = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::duration<double>(timings(i, 0)));
+                    contact.deactivationTime
+                        = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::duration<double>(timings(i, 1)));
+                    contact.name = names.empty() ? l.defaultName() : names[i];
+                    contact.type = l.defaultContactType();
+
+                    if (!l.addContact(contact))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            },
+            py::arg("poses"),
+            py::arg("timings"),
+            py::arg("names") = std::vector<std::string>{},
+            "Build the list in a single C++ pass from a Nx7 array of poses (position and "
+            "quaternion as x, y, z, qx, qy, qz, qw), a Nx2 array of activation/deactivation "
+            "times in seconds and an optional list of names.")
+        .def("poses_as_array",
+             [](const ContactList& l) -> Eigen::MatrixXd {
+                 Eigen::MatrixXd poses(l.size(), 7);
+                 Eigen::Index i = 0;
+                 for (const auto& contact : l)
+                 {
+                     poses.row(i) = contact.pose.coeffs().transpose();
+                     i++;
+                 }
+                 return poses;
+             })
+        .def("timings_as_array",
+             [](const ContactList& l) -> Eigen::MatrixXd {
+                 Eigen::MatrixXd timings(l.size(), 2);
+                 Eigen::Index i = 0;
+                 for (const auto& contact : l)
+                 {
+                     timings(i, 0) = std::chrono::duration<double>(contact.activationTime).count();
+                     timings(i, 1) = std::chrono::duration<double>(contact.deactivationTime).count();
+                     i++;
+                 }
+                 return timings;
+             })
+        .def("names",
+             [](const ContactList& l) -> std::vector<std::string> {
+                 std::vector<std::string> names;
+                 names.reserve(l.size());
+                 for (const auto& contact : l)
+                 {
+                     names.push_back(contact.name);
+                 }
+                 return names;
+             })
         .def(
             "__iter__",
             [](const ContactList& l) { return py::make_iterator(l.cbegin(), l.cend()); },
@@ -180,3 +180,41 @@ def test_contact_phase_list():
             assert item == contact_phase_list.last_phase()
 
 
+
+
+def test_contact_list_batch_arrays():
+
+    contact_list = blf.contacts.ContactList()
+
+    poses = np.zeros(shape=(3, 7))
+    poses[:, 0] = [0.0, 0.1, 0.2]
+    poses[:, 6] = 1.0
+
+    timings = np.array([[0.0, 0.5], [1.0, 1.5], [2.0, 2.5]])
+    names = ["contact0", "contact1", "contact2"]
+
+    assert contact_list.add_contacts_from_arrays(poses=poses, timings=timings, names=names)
+    assert len(contact_list) == 3
+
+    for i, contact in enumerate(contact_list):
+        assert contact.pose.translation() == pytest.approx(poses[i, 0:3])
+        assert contact.activation_time == timedelta(seconds=timings[i, 0])
+        assert contact.deactivation_time == timedelta(seconds=timings[i, 1])
+        assert contact.name == names[i]
+
+    # the batch extractors must return the same data used to build the list
+    assert contact_list.poses_as_array() == pytest.approx(poses)
+    assert contact_list.timings_as_array() == pytest.approx(timings)
+    assert contact_list.names() == names
+
+    # overlapping contacts are rejected
+    overlapping_timings = np.array([[2.2, 2.7]])
+    assert not contact_list.add_contacts_from_arrays(
+        poses=poses[0:1, :], timings=overlapping_timings)
+
+    # shape mismatches are rejected
+    with pytest.raises(ValueError):
+        contact_list.add_contacts_from_arrays(poses=poses[:, 0:6], timings=timings)
+
+    with pytest.raises(ValueError):
+        contact_list.add_contacts_from_arrays(poses=poses, timings=timings[0:2, :])
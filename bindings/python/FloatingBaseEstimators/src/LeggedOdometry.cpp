@@ -70,7 +70,7 @@ void CreateLeggedOdometry(pybind11::module& module)
              &LeggedOdometry::setKinematics,
              py::arg("encoders"),
              py::arg("encoder_speeds"))
-        .def("advance", &LeggedOdometry::advance)
+        .def("advance", &LeggedOdometry::advance, py::call_guard<py::gil_scoped_release>())
         .def("reset_estimator",
              py::overload_cast<const InternalState&>(&FloatingBaseEstimator::resetEstimator),
              py::arg("new_state"))
@@ -5,9 +5,12 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <cstring>
+
 #include <iDynTree/Model/Model.h>
 #include <pybind11/chrono.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -35,13 +38,90 @@ void CreateMANNTrajectoryGenerator(pybind11::module& module)
         .def(py::init())
         .def_readwrite("merge_point_index", &ML::MANNTrajectoryGeneratorInput::mergePointIndex);
 
+    // zero-copy view over a std::vector of Eigen::Vector3d. The vector stores the samples back
+    // to back, so the trajectory is exposed as a (n, 3) numpy array pointing to the C++ storage;
+    // the base handle ties the lifetime of the view to the output object
+    auto makeVector3View = [](py::object& owner,
+                              std::vector<Eigen::Vector3d>& data) -> py::array_t<double> {
+        const py::ssize_t samples = static_cast<py::ssize_t>(data.size());
+        double* ptr = data.empty() ? nullptr : data.front().data();
+        return py::array_t<double>({samples, static_cast<py::ssize_t>(3)},
+                                   {static_cast<py::ssize_t>(sizeof(Eigen::Vector3d)),
+                                    static_cast<py::ssize_t>(sizeof(double))},
+                                   ptr,
+                                   owner);
+    };
+
     py::class_<ML::MANNTrajectoryGeneratorOutput>(module, "MANNTrajectoryGeneratorOutput")
         .def(py::init())
         .def_readwrite("joint_positions", &ML::MANNTrajectoryGeneratorOutput::jointPositions)
         .def_readwrite("base_pose", &ML::MANNTrajectoryGeneratorOutput::basePoses)
         .def_readwrite("phase_list", &ML::MANNTrajectoryGeneratorOutput::phaseList)
         .def_readwrite("com_trajectory" , &ML::MANNTrajectoryGeneratorOutput::comTrajectory)
-        .def_readwrite("angular_momentum_trajectory" , &ML::MANNTrajectoryGeneratorOutput::angularMomentumTrajectory);
+        .def_readwrite("angular_momentum_trajectory" , &ML::MANNTrajectoryGeneratorOutput::angularMomentumTrajectory)
+        .def_property_readonly(
+            "com_trajectory_view",
+            [makeVector3View](py::object& obj) -> py::array_t<double> {
+                auto& self = obj.cast<ML::MANNTrajectoryGeneratorOutput&>();
+                return makeVector3View(obj, self.comTrajectory);
+            },
+            "Zero-copy (n, 3) view over the CoM trajectory. The view is valid as long as the "
+            "output object is alive and the trajectory is not regenerated.")
+        .def_property_readonly(
+            "angular_momentum_trajectory_view",
+            [makeVector3View](py::object& obj) -> py::array_t<double> {
+                auto& self = obj.cast<ML::MANNTrajectoryGeneratorOutput&>();
+                return makeVector3View(obj, self.angularMomentumTrajectory);
+            },
+            "Zero-copy (n, 3) view over the angular momentum trajectory. The view is valid as "
+            "long as the output object is alive and the trajectory is not regenerated.")
+        .def(
+            "fill_joint_positions",
+            [](const ML::MANNTrajectoryGeneratorOutput& self,
+               py::array_t<double, py::array::c_style> out) {
+                auto buffer = out.mutable_unchecked<2>();
+                const py::ssize_t samples = static_cast<py::ssize_t>(self.jointPositions.size());
+                const py::ssize_t joints
+                    = self.jointPositions.empty() ? 0 : self.jointPositions.front().size();
+                if (buffer.shape(0) != samples || buffer.shape(1) != joints)
+                {
+                    throw py::value_error("The output array must have shape ("
+                                          + std::to_string(samples) + ", "
+                                          + std::to_string(joints) + ").");
+                }
+                for (py::ssize_t i = 0; i < samples; i++)
+                {
+                    std::memcpy(buffer.mutable_data(i, 0),
+                                self.jointPositions[i].data(),
+                                joints * sizeof(double));
+                }
+            },
+            py::arg("out"),
+            "Copy the joint positions trajectory in the caller-provided (n, dofs) array with a "
+            "bulk copy per sample, avoiding the per-frame list conversion.")
+        .def(
+            "fill_base_poses",
+            [](const ML::MANNTrajectoryGeneratorOutput& self,
+               py::array_t<double, py::array::c_style> out) {
+                auto buffer = out.mutable_unchecked<2>();
+                const py::ssize_t samples = static_cast<py::ssize_t>(self.basePoses.size());
+                constexpr py::ssize_t coeffs = ::manif::SE3d::RepSize; // x y z qx qy qz qw
+                if (buffer.shape(0) != samples || buffer.shape(1) != coeffs)
+                {
+                    throw py::value_error("The output array must have shape ("
+                                          + std::to_string(samples) + ", "
+                                          + std::to_string(coeffs) + ").");
+                }
+                for (py::ssize_t i = 0; i < samples; i++)
+                {
+                    std::memcpy(buffer.mutable_data(i, 0),
+                                self.basePoses[i].coeffs().data(),
+                                coeffs * sizeof(double));
+                }
+            },
+            py::arg("out"),
+            "Copy the base pose trajectory in the caller-provided (n, 7) array. Each row "
+            "contains the position and the quaternion coefficients (x, y, z, qx, qy, qz, qw).");
 
     BipedalLocomotion::bindings::System::CreateAdvanceable<ML::MANNTrajectoryGeneratorInput, //
                                                            ML::MANNTrajectoryGeneratorOutput> //
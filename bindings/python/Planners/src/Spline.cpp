@@ -59,7 +59,7 @@ void CreateSpline(pybind11::module& module)
              py::arg("acceleration"))
         .def("get_output", &Spline::getOutput)
         .def("is_output_valid", &Spline::isOutputValid)
-        .def("advance", &Spline::advance);
+        .def("advance", &Spline::advance, py::call_guard<py::gil_scoped_release>());
 }
 
 void CreateCubicSpline(pybind11::module& module)
@@ -28,7 +28,10 @@ void CreateTimeVaryingDCMPlanner(pybind11::module& module)
 
     py::class_<TimeVaryingDCMPlanner, DCMPlanner>(module, "TimeVaryingDCMPlanner")
         .def(py::init())
-        .def("compute_trajectory", &TimeVaryingDCMPlanner::computeTrajectory)
+        // the trajectory optimization is pure C++ compute: release the GIL while it runs
+        .def("compute_trajectory",
+             &TimeVaryingDCMPlanner::computeTrajectory,
+             py::call_guard<py::gil_scoped_release>())
         .def("set_contact_phase_list",
              &TimeVaryingDCMPlanner::setContactPhaseList,
              py::arg("contact_phase_list"))
@@ -76,13 +76,21 @@ void CreateAdvanceable(pybind11::module& module, const std::string& pythonClassN
                ::BipedalLocomotion::System::InputPort<Input>,
                ::BipedalLocomotion::System::OutputPort<Output>> //
         (module, advanceableName.c_str(), py::multiple_inheritance())
+            // initialize() and advance() are pure C++ compute and may take a long time (e.g. a
+            // network inference or an MPC iteration). The GIL is released while they run so that
+            // Python-side thread pools can overlap several advanceables; code that calls back
+            // into Python (e.g. a task implemented in Python) reacquires the GIL through the
+            // pybind11 trampoline.
             .def(
                 "initialize",
                 [](::BipedalLocomotion::System::Advanceable<Input, Output>& impl,
                    std::shared_ptr<const ::BipedalLocomotion::ParametersHandler::IParametersHandler>
                        handler) -> bool { return impl.initialize(handler); },
-                py::arg("handler"))
-            .def("advance", &::BipedalLocomotion::System::Advanceable<Input, Output>::advance)
+                py::arg("handler"),
+                py::call_guard<py::gil_scoped_release>())
+            .def("advance",
+                 &::BipedalLocomotion::System::Advanceable<Input, Output>::advance,
+                 py::call_guard<py::gil_scoped_release>())
             .def("close", &::BipedalLocomotion::System::Advanceable<Input, Output>::close);
 }
 
@@ -101,7 +101,11 @@ void CreateILinearTaskSolver(pybind11::module& module, const std::string& python
         .def("finalize",
              &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::finalize,
              py::arg("handler"))
-        .def("advance", &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::advance)
+        // the GIL is released while the solver runs: the tasks implemented in Python reacquire
+        // it through the pybind11 trampoline when the solver invokes them
+        .def("advance",
+             &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::advance,
+             py::call_guard<py::gil_scoped_release>())
         .def("get_output",
              &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::getOutput)
         .def("is_output_valid",
@@ -111,7 +115,8 @@ void CreateILinearTaskSolver(pybind11::module& module, const std::string& python
             [](::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>& impl,
                std::shared_ptr<const ::BipedalLocomotion::ParametersHandler::IParametersHandler>
                    handler) -> bool { return impl.initialize(handler); },
-            py::arg("handler"))
+            py::arg("handler"),
+            py::call_guard<py::gil_scoped_release>())
         .def("__str__", &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::toString)
         .def("get_raw_solution",
              &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::getRawSolution);
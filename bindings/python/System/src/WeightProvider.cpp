@@ -37,7 +37,7 @@ void CreateWeightProvider(pybind11::module& module)
                std::shared_ptr<const ::BipedalLocomotion::ParametersHandler::IParametersHandler>
                    handler) -> bool { return impl.initialize(handler); },
             py::arg("handler"))
-        .def("advance", &WeightProvider::advance)
+        .def("advance", &WeightProvider::advance, py::call_guard<py::gil_scoped_release>())
         .def("close", &WeightProvider::close)
         .def("get_output", &WeightProvider::getOutput)
         .def("is_output_valid", &WeightProvider::isOutputValid);
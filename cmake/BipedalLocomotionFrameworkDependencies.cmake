@@ -149,7 +149,7 @@ framework_dependent_option(FRAMEWORK_COMPILE_Contact
 
 framework_dependent_option(FRAMEWORK_COMPILE_Planners
   "Compile Planners libraries?" ON
-  "FRAMEWORK_USE_Qhull;FRAMEWORK_USE_casadi;FRAMEWORK_USE_manif;FRAMEWORK_COMPILE_Math;FRAMEWORK_COMPILE_Contact" OFF)
+  "FRAMEWORK_USE_Qhull;FRAMEWORK_USE_casadi;FRAMEWORK_USE_manif;FRAMEWORK_COMPILE_Math;FRAMEWORK_COMPILE_Contact;FRAMEWORK_COMPILE_CasadiConversions" OFF)
 
 framework_dependent_option(FRAMEWORK_COMPILE_ContactModels
   "Compile ContactModels library?" ON
@@ -159,6 +159,10 @@ framework_dependent_option(FRAMEWORK_COMPILE_System
   "Compile System library?" ON
   "" OFF)
 
+framework_dependent_option(FRAMEWORK_COMPILE_BenchmarkUtils
+  "Compile BenchmarkUtils library?" ON
+  "FRAMEWORK_COMPILE_System" OFF)
+
 framework_dependent_option(FRAMEWORK_COMPILE_Unicycle
     "Compile the Unicycle Planner library?" ON
     "FRAMEWORK_USE_UnicyclePlanner;FRAMEWORK_COMPILE_System;FRAMEWORK_COMPILE_Planners;FRAMEWORK_COMPILE_Contact" OFF)
@@ -203,6 +207,10 @@ framework_dependent_option(FRAMEWORK_COMPILE_IK
   "Compile IK library?" ON
   "FRAMEWORK_COMPILE_System;FRAMEWORK_USE_LieGroupControllers;FRAMEWORK_COMPILE_ManifConversions;FRAMEWORK_USE_manif;FRAMEWORK_USE_OsqpEigen" OFF)
 
+framework_dependent_option(FRAMEWORK_COMPILE_WholeBodyControllers
+  "Compile WholeBodyControllers library?" ON
+  "FRAMEWORK_COMPILE_IK;FRAMEWORK_COMPILE_TSID" OFF)
+
 framework_dependent_option(FRAMEWORK_COMPILE_ML
   "Compile machine learning libraries?" ON
   "FRAMEWORK_USE_onnxruntime;FRAMEWORK_USE_manif" OFF)
@@ -247,6 +255,10 @@ framework_dependent_option(FRAMEWORK_COMPILE_RealSenseTestApplication
   "Compile realsense-test application?" ON
   "FRAMEWORK_COMPILE_YarpImplementation;FRAMEWORK_COMPILE_Perception;FRAMEWORK_COMPILE_RealsenseCapture;FRAMEWORK_COMPILE_PerceptionInterface" OFF)
 
+framework_dependent_option(FRAMEWORK_COMPILE_MannQuantizerApplication
+  "Compile mann-quantizer application?" ON
+  "FRAMEWORK_COMPILE_ML" OFF)
+
 framework_dependent_option(FRAMEWORK_COMPILE_CalibrationDeltaUpdaterApplication
   "Compile calibration-delta-updater application?" ON
   "FRAMEWORK_COMPILE_YarpImplementation;FRAMEWORK_COMPILE_PYTHON_BINDINGS;FRAMEWORK_COMPILE_RobotInterface" OFF)
@@ -255,6 +267,10 @@ framework_dependent_option(FRAMEWORK_COMPILE_BalancingPositionControlApplication
   "Compile balancing-position-control application?" ON
   "FRAMEWORK_COMPILE_YarpImplementation;FRAMEWORK_COMPILE_PYTHON_BINDINGS;FRAMEWORK_COMPILE_RobotInterface;FRAMEWORK_COMPILE_IK" OFF)
 
+framework_dependent_option(FRAMEWORK_COMPILE_OsqpSettingsTunerApplication
+  "Compile osqp-settings-tuner application?" ON
+  "FRAMEWORK_USE_OsqpEigen" OFF)
+
 framework_dependent_option(FRAMEWORK_COMPILE_YarpRobotLoggerDevice
   "Do you want to generate and compile the YarpRobotLoggerDevice?" ON
   "FRAMEWORK_COMPILE_RobotInterface;FRAMEWORK_COMPILE_YarpImplementation;FRAMEWORK_COMPILE_Perception;FRAMEWORK_COMPILE_YarpUtilities;FRAMEWORK_USE_robometry" OFF)
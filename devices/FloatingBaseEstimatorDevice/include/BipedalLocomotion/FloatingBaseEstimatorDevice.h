@@ -11,6 +11,7 @@
 #include <BipedalLocomotion/ParametersHandler/YarpImplementation.h>
 #include <BipedalLocomotion/RobotInterface/YarpSensorBridge.h>
 #include <BipedalLocomotion/FloatingBaseEstimators/FloatingBaseEstimator.h>
+#include <BipedalLocomotion/System/LockFreeSharedResource.h>
 
 #include <iDynTree/Estimation/ContactStateMachine.h>
 #include <iDynTree/ModelIO/ModelLoader.h>
@@ -21,8 +22,11 @@
 #include <yarp/os/ResourceFinder.h>
 #include <yarp/dev/IFrameTransform.h>
 
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 #include <memory>
+#include <thread>
 
 namespace BipedalLocomotion
 {
@@ -47,21 +51,45 @@ public:
     virtual void run() final;
 
 private:
+    /** Raw measurements handed over from the acquisition thread to the estimator thread. */
+    struct Measurements
+    {
+        std::uint64_t counter{0}; /**< Incremented at every acquisition. */
+        Eigen::Matrix<double, 12, 1> imuMeasure;
+        Eigen::Matrix<double, 6, 1> lfWrench, rfWrench;
+        double lfTimeStamp{0.0}, rfTimeStamp{0.0};
+        Eigen::VectorXd encoders, encoderSpeeds;
+    };
+
+    /** Estimate handed over from the estimator thread to the publisher thread. */
+    struct EstimatorOutput
+    {
+        std::uint64_t counter{0}; /**< Counter of the measurements generating the estimate. */
+        bool isOutputValid{false};
+        BipedalLocomotion::Estimators::FloatingBaseEstimators::Output estimatorOut;
+        bool lFootState{false}, rFootState{false};
+        double lContactNormal{0.0}, rContactNormal{0.0};
+    };
+
     bool setupRobotModel(yarp::os::Searchable& config);
     bool setupRobotSensorBridge(yarp::os::Searchable& config);
     bool setupFeetContactStateMachines(yarp::os::Searchable& config);
     bool parseFootSchmittParams(yarp::os::Searchable& config, iDynTree::SchmittParams& params);
     bool setupBaseEstimator(yarp::os::Searchable& config);
     bool loadTransformBroadcaster();
-    bool updateMeasurements();
-    bool updateInertialBuffers();
-    bool updateContactStates();
-    bool updateKinematics();
-
-    void publish();
+    bool acquireMeasurements();
+    bool updateMeasurements(const Measurements& measurements);
+    bool updateInertialBuffers(const Measurements& measurements);
+    bool updateContactStates(const Measurements& measurements);
+    bool updateKinematics(const Measurements& measurements);
+    void estimatorLoop();
+    void publisherLoop();
+    void stopPipeline();
+
+    void publish(const EstimatorOutput& output);
     void publishBaseLinkState(const BipedalLocomotion::Estimators::FloatingBaseEstimators::Output& out);
     void publishInternalStateAndStdDev(const BipedalLocomotion::Estimators::FloatingBaseEstimators::Output& out);
-    void publishFootContactStatesAndNormalForces();
+    void publishFootContactStatesAndNormalForces(const EstimatorOutput& output);
     bool openCommunications();
     void closeCommunications();
     bool openBufferedSigPort(yarp::os::BufferedPort<yarp::sig::Vector>& port,
@@ -81,9 +109,23 @@ private:
     std::unique_ptr<BipedalLocomotion::RobotInterface::YarpSensorBridge> m_robotSensorBridge;
     std::unique_ptr<BipedalLocomotion::Estimators::FloatingBaseEstimator> m_estimator;
     std::unique_ptr<iDynTree::ContactStateMachine> m_lFootCSM, m_rFootCSM;
-    bool m_currentlFootState{false}, m_currentrFootState{false};
-    double m_currentlContactNormal{0.0}, m_currentrContactNormal{0.0};
     std::mutex m_deviceMutex;
+
+    Measurements m_measurements; /**< Working buffer owned by the acquisition thread. */
+    EstimatorOutput m_estimatorOutput; /**< Working buffer owned by the estimator thread. */
+
+    /** Lock-free wire between the acquisition and the estimator threads. */
+    BipedalLocomotion::System::SharedResource<Measurements>::Ptr m_measurementsSlot{
+        BipedalLocomotion::System::LockFreeSharedResource<Measurements>::create()};
+
+    /** Lock-free wire between the estimator and the publisher threads. */
+    BipedalLocomotion::System::SharedResource<EstimatorOutput>::Ptr m_outputSlot{
+        BipedalLocomotion::System::LockFreeSharedResource<EstimatorOutput>::create()};
+
+    std::thread m_estimatorThread; /**< Thread advancing the base estimator. */
+    std::thread m_publisherThread; /**< Thread publishing the estimate on the ports. */
+    std::atomic<bool> m_pipelineRunning{false}; /**< Keeps the two worker threads spinning. */
+
     std::string m_portPrefix{"/base-estimator"};
     std::string m_robot{"icubSim"};
     std::string m_estimatorType{"InvEKF"};
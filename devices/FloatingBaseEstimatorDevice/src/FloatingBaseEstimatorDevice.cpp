@@ -13,6 +13,8 @@
 #include <iDynTree/yarp/YARPConversions.h>
 #include <yarp/os/LogStream.h>
 
+#include <chrono>
+
 using namespace BipedalLocomotion;
 using namespace BipedalLocomotion::Estimators;
 using namespace BipedalLocomotion::RobotInterface;
@@ -229,6 +231,14 @@ bool FloatingBaseEstimatorDevice::attachAll(const yarp::dev::PolyDriverList & po
         return false;
     }
 
+    // the device is a two-stage pipeline: this periodic thread acquires the sensors and feeds the
+    // estimator thread through a lock-free slot, while the publisher thread streams the latest
+    // estimate on the ports. In this way the estimate rate is bounded by the cost of the filter
+    // alone and not by the sum of acquisition, filtering and publishing
+    m_pipelineRunning = true;
+    m_estimatorThread = std::thread(&FloatingBaseEstimatorDevice::estimatorLoop, this);
+    m_publisherThread = std::thread(&FloatingBaseEstimatorDevice::publisherLoop, this);
+
     start();
     return true;
 }
@@ -268,79 +278,116 @@ void FloatingBaseEstimatorDevice::run()
         return;
     }
 
-    // update estimator measurements
-    if (!updateMeasurements())
+    // hand the raw measurements over to the estimator thread
+    if (!acquireMeasurements())
     {
         yWarning() << "Measurement updates failed.";
         return;
     }
+}
 
-    // advance estimator
-    if (!m_estimator->advance())
+bool FloatingBaseEstimatorDevice::acquireMeasurements()
+{
+    if (m_measurements.encoders.size() == 0)
     {
-        yWarning()  << "Advance estimator failed.";
-        return;
+        m_measurements.encoders.resize(m_model.getNrOfDOFs());
+        m_measurements.encoderSpeeds.resize(m_model.getNrOfDOFs());
     }
 
-    publish();
-}
-
-bool FloatingBaseEstimatorDevice::updateMeasurements()
-{
     bool ok{true};
+    ok = ok && m_robotSensorBridge->getIMUMeasurement(m_baseLinkImuName, m_measurements.imuMeasure);
+    ok = ok && m_robotSensorBridge->getCartesianWrench(m_leftFootWrenchName,
+                                                       m_measurements.lfWrench,
+                                                       m_measurements.lfTimeStamp);
+    ok = ok && m_robotSensorBridge->getCartesianWrench(m_rightFootWrenchName,
+                                                       m_measurements.rfWrench,
+                                                       m_measurements.rfTimeStamp);
+    ok = ok && m_robotSensorBridge->getJointPositions(m_measurements.encoders);
+    ok = ok && m_robotSensorBridge->getJointVelocities(m_measurements.encoderSpeeds);
 
-    ok = ok && updateContactStates();
-    ok = ok && updateInertialBuffers();
-    ok = ok && updateKinematics();
+    if (!ok)
+    {
+        return false;
+    }
 
-    return ok;
+    m_measurements.counter++;
+    m_measurementsSlot->set(m_measurements);
+    return true;
 }
 
-bool FloatingBaseEstimatorDevice::updateInertialBuffers()
+void FloatingBaseEstimatorDevice::estimatorLoop()
 {
-    Eigen::Matrix<double, 12, 1> imuMeasure;
-    if (!m_robotSensorBridge->getIMUMeasurement(m_baseLinkImuName, imuMeasure))
+    std::uint64_t lastCounter{0};
+    while (m_pipelineRunning.load())
     {
-        return false;
+        const Measurements measurements = m_measurementsSlot->get();
+        if (measurements.counter == lastCounter)
+        {
+            // no fresh measurement has been acquired yet
+            std::this_thread::sleep_for(std::chrono::duration<double>(0.5 * getPeriod()));
+            continue;
+        }
+        lastCounter = measurements.counter;
+
+        // update estimator measurements
+        if (!updateMeasurements(measurements))
+        {
+            yWarning() << "Measurement updates failed.";
+            continue;
+        }
+
+        // advance estimator
+        if (!m_estimator->advance())
+        {
+            yWarning()  << "Advance estimator failed.";
+            continue;
+        }
+
+        m_estimatorOutput.counter = measurements.counter;
+        m_estimatorOutput.isOutputValid = m_estimator->isOutputValid();
+        if (m_estimatorOutput.isOutputValid)
+        {
+            m_estimatorOutput.estimatorOut = m_estimator->getOutput();
+        }
+        m_outputSlot->set(m_estimatorOutput);
     }
+}
 
-    const int accOffset{3};
-    const int gyroOffset{6};
-    if (!m_estimator->setIMUMeasurement(imuMeasure.segment<3>(accOffset), imuMeasure.segment<3>(gyroOffset)))
+void FloatingBaseEstimatorDevice::publisherLoop()
+{
+    std::uint64_t lastCounter{0};
+    while (m_pipelineRunning.load())
     {
-        return false;
-    }
+        const EstimatorOutput output = m_outputSlot->get();
+        if (output.counter == lastCounter)
+        {
+            // no fresh estimate has been computed yet
+            std::this_thread::sleep_for(std::chrono::duration<double>(0.5 * getPeriod()));
+            continue;
+        }
+        lastCounter = output.counter;
 
-    return true;
+        publish(output);
+    }
 }
 
-bool FloatingBaseEstimatorDevice::updateContactStates()
+bool FloatingBaseEstimatorDevice::updateMeasurements(const Measurements& measurements)
 {
-    Eigen::Matrix<double, 6, 1> lfWrench, rfWrench;
-    double lfTimeStamp, rfTimeStamp;
     bool ok{true};
-    ok = ok && m_robotSensorBridge->getCartesianWrench(m_leftFootWrenchName, lfWrench, lfTimeStamp);
-    if (ok)
-    {
-        m_currentlContactNormal = lfWrench(2);
-        m_lFootCSM->contactMeasurementUpdate(lfTimeStamp, lfWrench(2)); // fz
-    }
 
-    ok = ok && m_robotSensorBridge->getCartesianWrench(m_rightFootWrenchName, rfWrench, rfTimeStamp);
-    if (ok)
-    {
-        m_currentrContactNormal = rfWrench(2);
-        m_rFootCSM->contactMeasurementUpdate(rfTimeStamp, rfWrench(2)); // fz
-    }
+    ok = ok && updateContactStates(measurements);
+    ok = ok && updateInertialBuffers(measurements);
+    ok = ok && updateKinematics(measurements);
 
-    if (!ok)
-    {
-        return false;
-    }
+    return ok;
+}
 
-    m_currentlFootState = m_lFootCSM->contactState();
-    m_currentrFootState = m_rFootCSM->contactState();
-    if (!m_estimator->setContacts(m_currentlFootState, m_currentrFootState))
+bool FloatingBaseEstimatorDevice::updateInertialBuffers(const Measurements& measurements)
+{
+    const int accOffset{3};
+    const int gyroOffset{6};
+    if (!m_estimator->setIMUMeasurement(measurements.imuMeasure.segment<3>(accOffset),
+                                        measurements.imuMeasure.segment<3>(gyroOffset)))
     {
         return false;
     }
@@ -348,36 +395,41 @@ bool FloatingBaseEstimatorDevice::updateContactStates()
     return true;
 }
 
-bool FloatingBaseEstimatorDevice::updateKinematics()
+bool FloatingBaseEstimatorDevice::updateContactStates(const Measurements& measurements)
 {
-    Eigen::VectorXd encoders(m_model.getNrOfDOFs()), encoderSpeeds(m_model.getNrOfDOFs());
-    double timeStamp;
-    if (!m_robotSensorBridge->getJointPositions(encoders))
-    {
-        return false;
-    }
+    m_estimatorOutput.lContactNormal = measurements.lfWrench(2);
+    m_lFootCSM->contactMeasurementUpdate(measurements.lfTimeStamp, measurements.lfWrench(2)); // fz
 
-    if (!m_robotSensorBridge->getJointVelocities(encoderSpeeds))
+    m_estimatorOutput.rContactNormal = measurements.rfWrench(2);
+    m_rFootCSM->contactMeasurementUpdate(measurements.rfTimeStamp, measurements.rfWrench(2)); // fz
+
+    m_estimatorOutput.lFootState = m_lFootCSM->contactState();
+    m_estimatorOutput.rFootState = m_rFootCSM->contactState();
+    if (!m_estimator->setContacts(m_estimatorOutput.lFootState, m_estimatorOutput.rFootState))
     {
         return false;
     }
 
-    if (!m_estimator->setKinematics(encoders, encoderSpeeds))
+    return true;
+}
+
+bool FloatingBaseEstimatorDevice::updateKinematics(const Measurements& measurements)
+{
+    if (!m_estimator->setKinematics(measurements.encoders, measurements.encoderSpeeds))
     {
         return false;
     }
     return true;
 }
 
-void FloatingBaseEstimatorDevice::publish()
+void FloatingBaseEstimatorDevice::publish(const EstimatorOutput& output)
 {
-    if (m_estimator->isOutputValid())
+    if (output.isOutputValid)
     {
-        auto estimatorOut = m_estimator->getOutput();
-        publishBaseLinkState(estimatorOut);
-        publishInternalStateAndStdDev(estimatorOut);
+        publishBaseLinkState(output.estimatorOut);
+        publishInternalStateAndStdDev(output.estimatorOut);
     }
-    publishFootContactStatesAndNormalForces();
+    publishFootContactStatesAndNormalForces(output);
 }
 
 void FloatingBaseEstimatorDevice::publishBaseLinkState(const FloatingBaseEstimators::Output& estimatorOut)
@@ -450,23 +502,37 @@ void FloatingBaseEstimatorDevice::publishInternalStateAndStdDev(const FloatingBa
     m_comms.internalStateAndStdDevPort.write();
 }
 
-void FloatingBaseEstimatorDevice::publishFootContactStatesAndNormalForces()
+void FloatingBaseEstimatorDevice::publishFootContactStatesAndNormalForces(const EstimatorOutput& output)
 {
     yarp::sig::Vector& contactVec = m_comms.contactStatePort.prepare();
     contactVec.clear();
 
     contactVec.resize(4);
     const int scaling_const_for_visualization{300};
-    contactVec(0) = scaling_const_for_visualization*static_cast<int>(m_currentlFootState);
-    contactVec(1) = scaling_const_for_visualization*static_cast<int>(m_currentrFootState);
-    contactVec(2) = m_currentlContactNormal;
-    contactVec(3) = m_currentrContactNormal;
+    contactVec(0) = scaling_const_for_visualization*static_cast<int>(output.lFootState);
+    contactVec(1) = scaling_const_for_visualization*static_cast<int>(output.rFootState);
+    contactVec(2) = output.lContactNormal;
+    contactVec(3) = output.rContactNormal;
     m_comms.contactStatePort.write();
 }
 
+void FloatingBaseEstimatorDevice::stopPipeline()
+{
+    m_pipelineRunning = false;
+    if (m_estimatorThread.joinable())
+    {
+        m_estimatorThread.join();
+    }
+    if (m_publisherThread.joinable())
+    {
+        m_publisherThread.join();
+    }
+}
+
 bool FloatingBaseEstimatorDevice::detachAll()
 {
     std::lock_guard<std::mutex> guard(m_deviceMutex);
+    stopPipeline();
     if (isRunning())
     {
         stop();
@@ -498,6 +564,7 @@ void FloatingBaseEstimatorDevice::closeCommunications()
 bool FloatingBaseEstimatorDevice::close()
 {
     std::lock_guard<std::mutex> guard(m_deviceMutex);
+    stopPipeline();
     closeCommunications();
     return true;
 }
@@ -26,6 +26,10 @@ struct VectorPortData
     std::string varName;
     std::string inputPortName;
     yarp::os::BufferedPort<yarp::sig::Vector> port;
+    std::vector<double> latestValue; ///< last value received from the remote port
+    std::vector<double> lastPublished; ///< last value forwarded on the output port, used by
+                                       ///< the delta encoding
+    bool received{false}; ///< true once at least one value has been received
 };
 
 
@@ -41,6 +45,14 @@ struct VectorPortData
  * |remote_port_names     |   Yes     | vector of string   | List of vector ports to be wrapped (port names must start with '/').|
  * |remote_var_names      |   Yes     | vector of strings  | List  of identifiers for the wrapped ports in the same order and size as remote_var_names |
  * |output_port_name      |   Yes     |     string         | Name of the output port (port name must start with '/').            |
+ * |enable_delta_encoding |   No      |     boolean        | Stream only the vectors that changed since the last message, with periodic keyframes containing all of them (default false). |
+ * |keyframe_period       |   No      |     int            | Number of periods between two keyframes when the delta encoding is enabled (default 100). |
+ * |delta_threshold       |   No      |     double         | Maximum absolute per-element change below which a vector is considered unchanged (default 0.0). |
+ *
+ * When the delta encoding is enabled the output message still is a plain VectorsCollection:
+ * a reader only has to update the entries contained in each message, and the periodic
+ * keyframes guarantee that a late joiner receives every vector. Messages with no changed
+ * vector are not written at all.
  */
 class VectorsCollectionWrapper : public yarp::dev::DeviceDriver,
                                  public yarp::os::PeriodicThread
@@ -75,6 +87,11 @@ private:
     BufferedVectorsCollectionPort m_wrapperPort; ///< output port
     std::string m_portPrefix{"/vcWrapper"};
 
+    bool m_deltaEncodingEnabled{false}; ///< stream only the vectors that changed
+    int m_keyframePeriod{100}; ///< number of periods between two keyframes
+    double m_deltaThreshold{0.0}; ///< per-element threshold of the delta encoding
+    int m_framesSinceKeyframe{0}; ///< number of periods elapsed since the last keyframe
+
     bool setupPortManager(const std::vector<PortName>& portNames,
                           const std::vector<VarOutName>& varNames,
                           const std::string& portPrefix,
@@ -4,6 +4,8 @@
  */
 
 
+#include <cmath>
+
 #include <BipedalLocomotion/VectorsCollectionWrapper.h>
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 #include <BipedalLocomotion/ParametersHandler/YarpImplementation.h>
@@ -97,6 +99,24 @@ bool VectorsCollectionWrapper::open(yarp::os::Searchable& config)
         return false;
     }
 
+    params->getParameter("enable_delta_encoding", m_deltaEncodingEnabled);
+    if (m_deltaEncodingEnabled)
+    {
+        params->getParameter("keyframe_period", m_keyframePeriod);
+        if (m_keyframePeriod <= 0)
+        {
+            log()->error("{} \"keyframe_period\" should be strictly positive.", logPrefix);
+            return false;
+        }
+
+        params->getParameter("delta_threshold", m_deltaThreshold);
+        if (m_deltaThreshold < 0)
+        {
+            log()->error("{} \"delta_threshold\" should be non-negative.", logPrefix);
+            return false;
+        }
+    }
+
     m_wrapperPort.open(m_wrapperPortName);
 
     if (ok)
@@ -129,7 +149,7 @@ bool VectorsCollectionWrapper::setupPortManager(const std::vector<PortName>& por
         portManager[remote].inputPortName = inPort;
         portManager[remote].varName = varOutName;
         portManager[remote].port.open(inPort);
-        if (!yarp::os::Network::connect(remote, inPort))
+        if (!YarpUtilities::connectPortsPreferringLocal(remote, inPort))
         {
             log()->error("{} Unable to connect the ports {} and {}",
                          logPrefix, remote, inPort);
@@ -145,6 +165,25 @@ void VectorsCollectionWrapper::run()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
+    // a vector is considered unchanged when no element moved more than the threshold
+    auto hasChanged = [this](const std::vector<double>& value,
+                             const std::vector<double>& lastPublished) -> bool {
+        if (value.size() != lastPublished.size())
+        {
+            return true;
+        }
+        for (std::size_t i = 0; i < value.size(); i++)
+        {
+            if (std::abs(value[i] - lastPublished[i]) > m_deltaThreshold)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    const bool keyframeDue = m_framesSinceKeyframe >= m_keyframePeriod;
+
     auto& data = m_wrapperPort.prepare();
     data.vectors.clear();
     // get the data from the ports
@@ -155,8 +194,42 @@ void VectorsCollectionWrapper::run()
         vec = portData.port.read(/*shouldWait = */ false);
         if (vec)
         {
-            data.vectors[portData.varName].assign(vec->data(),
-                                                  vec->data() + vec->size());
+            portData.latestValue.assign(vec->data(), vec->data() + vec->size());
+            portData.received = true;
+        }
+
+        if (!m_deltaEncodingEnabled)
+        {
+            if (vec)
+            {
+                data.vectors[portData.varName] = portData.latestValue;
+            }
+            continue;
+        }
+
+        if (!portData.received)
+        {
+            continue;
+        }
+
+        // forward the vector only if a keyframe is due or its content changed since the
+        // last time it was published
+        if (keyframeDue || hasChanged(portData.latestValue, portData.lastPublished))
+        {
+            data.vectors[portData.varName] = portData.latestValue;
+            portData.lastPublished = portData.latestValue;
+        }
+    }
+
+    if (m_deltaEncodingEnabled)
+    {
+        m_framesSinceKeyframe = keyframeDue ? 0 : m_framesSinceKeyframe + 1;
+
+        // skip the write entirely when nothing changed
+        if (data.vectors.empty())
+        {
+            m_wrapperPort.unprepare();
+            return;
         }
     }
 
@@ -0,0 +1,113 @@
+/**
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_FRAMEWORK_YARP_ROBOT_LOGGER_DEVICE_CHUNKED_SIGNAL_LOGGER_H
+#define BIPEDAL_LOCOMOTION_FRAMEWORK_YARP_ROBOT_LOGGER_DEVICE_CHUNKED_SIGNAL_LOGGER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace BipedalLocomotion
+{
+
+/**
+ * ChunkedSignalLogger incrementally stores numeric signals in a compressed binary stream.
+ * Each signal owns a fixed-size in-memory chunk; when the chunk fills up it is handed over
+ * to a background thread that compresses it (zlib deflate) and appends it to the output
+ * file, so the signal producers are never blocked by the serialization. commitChunks()
+ * flushes the partially filled chunks and is cheap enough to be called periodically.
+ *
+ * The file layout is a sequence of chunks, each composed of
+ * - channel name length (uint32) followed by the channel name
+ * - number of elements per sample (uint32)
+ * - number of samples in the chunk (uint32)
+ * - uncompressed and compressed payload sizes in bytes (uint64, uint64)
+ * - the zlib compressed payload, i.e. samples stored as doubles in the form
+ *   [timestamp, element_0, ..., element_{n-1}]
+ * The file starts with the magic string "BLFC" followed by a format version (uint32).
+ */
+class ChunkedSignalLogger
+{
+public:
+    ~ChunkedSignalLogger();
+
+    /**
+     * Configure the logger and spawn the background flush thread.
+     * @param filePath path of the binary file that will store the chunks.
+     * @param samplesPerChunk number of samples stored in a chunk before it is flushed.
+     * @param compressionLevel zlib compression level in [0, 9].
+     * @return True in case of success, false otherwise.
+     */
+    bool configure(const std::string& filePath,
+                   const std::size_t samplesPerChunk,
+                   const int compressionLevel);
+
+    /**
+     * Append a sample to the chunk associated to the given signal. The channel is created
+     * the first time the signal name is seen. The call only copies the sample in the
+     * in-memory chunk and never touches the disk.
+     * @param data pointer to the sample elements.
+     * @param size number of elements of the sample.
+     * @param time timestamp associated to the sample.
+     * @param name name of the signal.
+     */
+    void pushBack(const double* data,
+                  const std::size_t size,
+                  const double time,
+                  const std::string& name);
+
+    /**
+     * Hand the partially filled chunks over to the background thread. This is the
+     * chunk-boundary commit run by the periodic save: it only moves the buffers in the
+     * flush queue and wakes the background thread up.
+     */
+    void commitChunks();
+
+    /**
+     * Commit the pending chunks, stop the background thread and close the file.
+     */
+    void close();
+
+private:
+    struct Chunk
+    {
+        std::string name;
+        std::size_t elementsPerSample{0};
+        std::size_t nrSamples{0};
+        std::vector<double> data; /**< samples stored as [time, element_0, ...] */
+    };
+
+    void flushLoop();
+    void enqueueChunk(Chunk& chunk);
+    std::vector<double> takeRecycledBuffer();
+
+    bool m_configured{false};
+    std::size_t m_samplesPerChunk{0};
+    int m_compressionLevel{6};
+    std::ofstream m_file;
+
+    std::mutex m_channelsMutex;
+    std::unordered_map<std::string, Chunk> m_channels;
+
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCondVar;
+    std::deque<Chunk> m_flushQueue;
+    std::vector<std::vector<double>> m_recycledBuffers; /**< buffers of the already flushed
+                                                             chunks, reused to avoid runtime
+                                                             allocations */
+    bool m_stopThread{false};
+    std::thread m_flushThread;
+};
+
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_FRAMEWORK_YARP_ROBOT_LOGGER_DEVICE_CHUNKED_SIGNAL_LOGGER_H
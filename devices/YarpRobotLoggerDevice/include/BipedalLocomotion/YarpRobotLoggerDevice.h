@@ -6,6 +6,8 @@
 #ifndef BIPEDAL_LOCOMOTION_FRAMEWORK_YARP_ROBOT_LOGGER_DEVICE_H
 #define BIPEDAL_LOCOMOTION_FRAMEWORK_YARP_ROBOT_LOGGER_DEVICE_H
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -14,6 +16,7 @@
 #include <unordered_set>
 #include <atomic>
 #include <fstream>
+#include <vector>
 
 #include <opencv2/opencv.hpp>
 #include <opencv2/videoio.hpp>
@@ -23,6 +26,9 @@
 #include <yarp/os/Bottle.h>
 #include <yarp/os/BufferedPort.h>
 #include <yarp/os/PeriodicThread.h>
+#include <yarp/os/Port.h>
+#include <yarp/os/PortReader.h>
+#include <yarp/os/TypedReaderCallback.h>
 #include <yarp/sig/Vector.h>
 
 #include <robometry/BufferManager.h>
@@ -30,6 +36,9 @@
 #include <BipedalLocomotion/RobotInterface/YarpSensorBridge.h>
 #include <BipedalLocomotion/RobotInterface/YarpCameraBridge.h>
 
+#include <BipedalLocomotion/ChunkedSignalLogger.h>
+#include <BipedalLocomotion/System/Clock.h>
+#include <BipedalLocomotion/YarpUtilities/Helper.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollection.h>
 
 namespace BipedalLocomotion
@@ -63,21 +72,83 @@ private:
     std::unique_ptr<BipedalLocomotion::RobotInterface::YarpSensorBridge> m_robotSensorBridge;
     std::unique_ptr<BipedalLocomotion::RobotInterface::YarpCameraBridge> m_cameraBridge;
 
+    /**
+     * Fixed-capacity single-producer single-consumer ring buffer. The producer (the YARP
+     * port callback) writes with push() and the consumer (the logging thread) reads in
+     * place with front()/popFront(); both operations are wait-free. When the buffer is
+     * full the newest sample is dropped.
+     */
     template <typename T>
-    struct ExogenousSignal
+    class SpscRingBuffer
+    {
+    public:
+        struct Sample
+        {
+            double time{0.0};
+            T data;
+        };
+
+        void resize(const std::size_t capacity)
+        {
+            // one slot is always kept empty to distinguish a full buffer from an empty one
+            m_slots.resize(capacity + 1);
+        }
+
+        bool push(const double time, const T& data)
+        {
+            const std::size_t head = m_head.load(std::memory_order_relaxed);
+            const std::size_t next = (head + 1) % m_slots.size();
+            if (next == m_tail.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            m_slots[head].time = time;
+            m_slots[head].data = data;
+            m_head.store(next, std::memory_order_release);
+            return true;
+        }
+
+        Sample* front()
+        {
+            const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail == m_head.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+            return &m_slots[tail];
+        }
+
+        void popFront()
+        {
+            const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+            m_tail.store((tail + 1) % m_slots.size(), std::memory_order_release);
+        }
+
+    private:
+        std::vector<Sample> m_slots{std::vector<Sample>(1)};
+        std::atomic<std::size_t> m_head{0};
+        std::atomic<std::size_t> m_tail{0};
+    };
+
+    template <typename T>
+    struct ExogenousSignal : public yarp::os::TypedReaderCallback<T>
     {
-        std::mutex mutex;
         std::string remote;
         std::string local;
         std::string carrier;
         std::string signalName;
         yarp::os::BufferedPort<T> port;
+        SpscRingBuffer<T> ringBuffer;
         bool dataArrived{false};
         bool connected{false};
 
         bool connect()
         {
-            return yarp::os::Network::connect(remote, local, carrier);
+            // a shared-memory carrier is preferred when the signal source runs on the same
+            // host of the logger
+            return BipedalLocomotion::YarpUtilities::connectPortsPreferringLocal(remote,
+                                                                                 local,
+                                                                                 carrier);
         }
 
         void disconnect()
@@ -87,6 +158,17 @@ private:
                 yarp::os::Network::disconnect(remote, local);
             }
         }
+
+        /**
+         * Callback run by the YARP port thread. The sample is copied in the ring buffer
+         * and the logging thread drains it, so the write never blocks on the logger.
+         */
+        void onRead(T& datum) override
+        {
+            const double time
+                = std::chrono::duration<double>(BipedalLocomotion::clock().now()).count();
+            ringBuffer.push(time, datum);
+        }
     };
 
     std::unordered_map<std::string,
@@ -121,6 +203,8 @@ private:
         std::shared_ptr<ImageSaver> rgb;
         std::shared_ptr<ImageSaver> depth;
         int depthScale{1};
+        std::string videoAcceleration; /**< per-camera hardware encoder selection. When empty
+                                            the device-wide 'video_acceleration' is used */
 
         std::thread videoThread;
         std::atomic<bool> recordVideoIsRunning{false};
@@ -128,8 +212,25 @@ private:
     };
 
     std::string m_videoCodecCode{"mp4v"};
+    std::string m_videoAcceleration{"none"};
     std::unordered_map<std::string, VideoWriter> m_videoWriters;
 
+    /**
+     * Reader attached to the flight recorder RPC port. A 'dump' command requests the dump
+     * of the in-memory ring buffers; the dump itself runs on the logging thread.
+     */
+    struct FlightRecorderTrigger : public yarp::os::PortReader
+    {
+        std::atomic<bool>* dumpRequested{nullptr};
+        bool read(yarp::os::ConnectionReader& connection) override;
+    };
+
+    bool m_flightRecorderEnabled{false};
+    std::atomic<bool> m_flightRecorderDumpRequested{false};
+    FlightRecorderTrigger m_flightRecorderTrigger;
+    yarp::os::Port m_flightRecorderPort;
+    const std::string m_flightRecorderPortName = "/YarpRobotLoggerDevice/FlightRecorder/rpc:i";
+
     const std::string m_textLoggingPortName = "/YarpRobotLoggerDevice/TextLogging:i";
     std::unordered_set<std::string> m_textLoggingPortNames;
     yarp::os::BufferedPort<yarp::os::Bottle> m_textLoggingPort;
@@ -137,6 +238,23 @@ private:
     std::unordered_set<std::string> m_textLogsStoredInManager;
     std::thread m_lookForNewLogsThread;
 
+    /**
+     * Callback attached to the text logging port. The YARP callback thread only copies the
+     * bottle in a fixed-capacity ring buffer; the message is deserialized and stored by the
+     * text log processing thread. When the buffer is full the message is dropped and the
+     * drop counted, so a log storm cannot starve the signal path.
+     */
+    struct TextLogReceiver : public yarp::os::TypedReaderCallback<yarp::os::Bottle>
+    {
+        SpscRingBuffer<yarp::os::Bottle> ringBuffer;
+        std::atomic<std::size_t> droppedMessages{0};
+        void onRead(yarp::os::Bottle& datum) override;
+    };
+
+    TextLogReceiver m_textLogReceiver;
+    std::atomic<bool> m_processTextLogsIsRunning{false};
+    std::thread m_processTextLogsThread;
+
     Eigen::VectorXd m_jointSensorBuffer;
     ft_t m_ftBuffer;
     gyro_t m_gyroBuffer;
@@ -160,7 +278,25 @@ private:
     std::mutex m_bufferManagerMutex;
     robometry::BufferManager m_bufferManager;
 
+    bool m_chunkedLoggingEnabled{false};
+    ChunkedSignalLogger m_chunkedLogger;
+
+    /**
+     * Store a numeric signal in the robometry buffer and, when the chunked logging is
+     * enabled, mirror it in the chunked logger.
+     */
+    template <typename Vector>
+    void logData(const Vector& data, const double time, const std::string& name)
+    {
+        m_bufferManager.push_back(data, time, name);
+        if (m_chunkedLoggingEnabled)
+        {
+            m_chunkedLogger.pushBack(data.data(), data.size(), time, name);
+        }
+    }
+
     void lookForNewLogs();
+    void processTextLogs();
     void lookForExogenousSignals();
     bool hasSubstring(const std::string& str, const std::vector<std::string>& substrings) const;
     void recordVideo(const std::string& cameraName, VideoWriter& writer);
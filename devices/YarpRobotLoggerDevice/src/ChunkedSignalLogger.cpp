@@ -0,0 +1,248 @@
+/**
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include <zlib.h>
+
+#include <BipedalLocomotion/ChunkedSignalLogger.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion;
+
+ChunkedSignalLogger::~ChunkedSignalLogger()
+{
+    this->close();
+}
+
+bool ChunkedSignalLogger::configure(const std::string& filePath,
+                                    const std::size_t samplesPerChunk,
+                                    const int compressionLevel)
+{
+    constexpr auto logPrefix = "[ChunkedSignalLogger::configure]";
+
+    if (m_configured)
+    {
+        log()->error("{} The logger has been already configured.", logPrefix);
+        return false;
+    }
+
+    if (samplesPerChunk == 0)
+    {
+        log()->error("{} The number of samples per chunk must be strictly positive.", logPrefix);
+        return false;
+    }
+
+    if (compressionLevel < 0 || compressionLevel > 9)
+    {
+        log()->error("{} The compression level must belong to [0, 9].", logPrefix);
+        return false;
+    }
+
+    m_file.open(filePath, std::ios::binary);
+    if (!m_file.is_open())
+    {
+        log()->error("{} Unable to open the file named {}.", logPrefix, filePath);
+        return false;
+    }
+
+    constexpr char magic[4] = {'B', 'L', 'F', 'C'};
+    constexpr std::uint32_t version = 1;
+    m_file.write(magic, sizeof(magic));
+    m_file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+
+    m_samplesPerChunk = samplesPerChunk;
+    m_compressionLevel = compressionLevel;
+    m_stopThread = false;
+    m_flushThread = std::thread([this] { this->flushLoop(); });
+    m_configured = true;
+
+    return true;
+}
+
+void ChunkedSignalLogger::pushBack(const double* data,
+                                   const std::size_t size,
+                                   const double time,
+                                   const std::string& name)
+{
+    if (!m_configured || data == nullptr || size == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_channelsMutex);
+
+    auto& chunk = m_channels[name];
+    if (chunk.data.capacity() == 0)
+    {
+        // first sample of the channel: allocate the chunk once for all
+        chunk.name = name;
+        chunk.elementsPerSample = size;
+        chunk.data.reserve(m_samplesPerChunk * (1 + size));
+    }
+
+    if (size != chunk.elementsPerSample)
+    {
+        log()->error("[ChunkedSignalLogger::pushBack] The signal named {} changed size from {} to "
+                     "{}. The sample is dropped.",
+                     name,
+                     chunk.elementsPerSample,
+                     size);
+        return;
+    }
+
+    chunk.data.push_back(time);
+    chunk.data.insert(chunk.data.end(), data, data + size);
+    chunk.nrSamples++;
+
+    if (chunk.nrSamples == m_samplesPerChunk)
+    {
+        this->enqueueChunk(chunk);
+    }
+}
+
+void ChunkedSignalLogger::enqueueChunk(Chunk& chunk)
+{
+    // move the full chunk in the flush queue and replace its buffer with a recycled one
+    Chunk fullChunk;
+    fullChunk.name = chunk.name;
+    fullChunk.elementsPerSample = chunk.elementsPerSample;
+    fullChunk.nrSamples = chunk.nrSamples;
+    fullChunk.data = std::move(chunk.data);
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        chunk.data = this->takeRecycledBuffer();
+        m_flushQueue.push_back(std::move(fullChunk));
+    }
+
+    chunk.data.reserve(m_samplesPerChunk * (1 + chunk.elementsPerSample));
+    chunk.nrSamples = 0;
+
+    m_queueCondVar.notify_one();
+}
+
+std::vector<double> ChunkedSignalLogger::takeRecycledBuffer()
+{
+    // the caller must hold m_queueMutex
+    if (m_recycledBuffers.empty())
+    {
+        return {};
+    }
+
+    std::vector<double> buffer = std::move(m_recycledBuffers.back());
+    m_recycledBuffers.pop_back();
+    buffer.clear();
+    return buffer;
+}
+
+void ChunkedSignalLogger::commitChunks()
+{
+    if (!m_configured)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_channelsMutex);
+    for (auto& [name, chunk] : m_channels)
+    {
+        if (chunk.nrSamples > 0)
+        {
+            this->enqueueChunk(chunk);
+        }
+    }
+}
+
+void ChunkedSignalLogger::flushLoop()
+{
+    std::vector<Bytef> compressed;
+
+    while (true)
+    {
+        Chunk chunk;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondVar.wait(lock, [this] { return m_stopThread || !m_flushQueue.empty(); });
+
+            if (m_flushQueue.empty())
+            {
+                // m_stopThread is true and there is nothing left to flush
+                return;
+            }
+
+            chunk = std::move(m_flushQueue.front());
+            m_flushQueue.pop_front();
+        }
+
+        const uLong uncompressedBytes = static_cast<uLong>(chunk.data.size() * sizeof(double));
+        uLongf compressedBytes = compressBound(uncompressedBytes);
+        if (compressed.size() < compressedBytes)
+        {
+            compressed.resize(compressedBytes);
+        }
+
+        const int ret = compress2(compressed.data(),
+                                  &compressedBytes,
+                                  reinterpret_cast<const Bytef*>(chunk.data.data()),
+                                  uncompressedBytes,
+                                  m_compressionLevel);
+        if (ret != Z_OK)
+        {
+            log()->error("[ChunkedSignalLogger::flushLoop] Unable to compress a chunk of the "
+                         "signal named {}. The chunk is dropped.",
+                         chunk.name);
+        } else
+        {
+            const std::uint32_t nameLength = static_cast<std::uint32_t>(chunk.name.size());
+            const std::uint32_t elementsPerSample
+                = static_cast<std::uint32_t>(chunk.elementsPerSample);
+            const std::uint32_t nrSamples = static_cast<std::uint32_t>(chunk.nrSamples);
+            const std::uint64_t uncompressedSize = uncompressedBytes;
+            const std::uint64_t compressedSize = compressedBytes;
+
+            m_file.write(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength));
+            m_file.write(chunk.name.data(), nameLength);
+            m_file.write(reinterpret_cast<const char*>(&elementsPerSample),
+                         sizeof(elementsPerSample));
+            m_file.write(reinterpret_cast<const char*>(&nrSamples), sizeof(nrSamples));
+            m_file.write(reinterpret_cast<const char*>(&uncompressedSize),
+                         sizeof(uncompressedSize));
+            m_file.write(reinterpret_cast<const char*>(&compressedSize), sizeof(compressedSize));
+            m_file.write(reinterpret_cast<const char*>(compressed.data()), compressedSize);
+            m_file.flush();
+        }
+
+        // recycle the buffer of the flushed chunk
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_recycledBuffers.push_back(std::move(chunk.data));
+    }
+}
+
+void ChunkedSignalLogger::close()
+{
+    if (!m_configured)
+    {
+        return;
+    }
+
+    this->commitChunks();
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stopThread = true;
+    }
+    m_queueCondVar.notify_one();
+
+    if (m_flushThread.joinable())
+    {
+        m_flushThread.join();
+    }
+
+    m_file.close();
+    m_channels.clear();
+    m_recycledBuffers.clear();
+    m_configured = false;
+}
@@ -3,10 +3,13 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <atomic>
 #include <cmath>
+#include <csignal>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
+#include <ctime>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
@@ -63,6 +66,55 @@ VISITABLE_STRUCT(TextLoggingEntry,
                  yarprun_timestamp,
                  local_timestamp);
 
+namespace
+{
+// set by the process signal handler to request a flight recorder dump. A signal handler
+// cannot touch the device instance, so the flag is polled by the logging thread
+std::atomic<bool> g_flightRecorderSignalReceived{false};
+
+void flightRecorderSignalHandler(int)
+{
+    g_flightRecorderSignalReceived = true;
+}
+} // namespace
+
+bool YarpRobotLoggerDevice::FlightRecorderTrigger::read(yarp::os::ConnectionReader& connection)
+{
+    yarp::os::Bottle command, reply;
+    if (!command.read(connection))
+    {
+        return false;
+    }
+
+    if (command.get(0).asString() == "dump" && dumpRequested != nullptr)
+    {
+        *dumpRequested = true;
+        reply.addString("ok");
+    } else
+    {
+        reply.addString("unknown command. Use 'dump' to save the flight recorder buffers.");
+    }
+
+    yarp::os::ConnectionWriter* returnToSender = connection.getWriter();
+    if (returnToSender != nullptr)
+    {
+        reply.write(*returnToSender);
+    }
+    return true;
+}
+
+void YarpRobotLoggerDevice::TextLogReceiver::onRead(yarp::os::Bottle& datum)
+{
+    const double time = std::chrono::duration<double>(BipedalLocomotion::clock().now()).count();
+
+    // the push is wait-free. If the ring buffer is full the message is dropped and the drop
+    // counted, the processing thread periodically reports the number of dropped messages
+    if (!ringBuffer.push(time, datum))
+    {
+        droppedMessages.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
 void findAndReplaceAll(std::string& data, std::string toSearch, std::string replaceStr)
 {
     // Get the first occurrence
@@ -215,6 +267,25 @@ bool YarpRobotLoggerDevice::open(yarp::os::Searchable& config)
                 return false;
             }
 
+            // the per-camera hardware encoder selection is optional. When the list is not
+            // provided the device-wide 'video_acceleration' parameter is used
+            std::vector<std::string> videoAcceleration;
+            const std::string accelerationParamName
+                = ((&cameraNames) == (&m_cameraBridge->getMetaData().sensorsList.rgbdCamerasList))
+                      ? "rgbd_cameras_video_acceleration"
+                      : "rgb_cameras_video_acceleration";
+            if (params->getParameter(accelerationParamName, videoAcceleration)
+                && videoAcceleration.size() != cameraNames.size())
+            {
+                log()->error("{} Mismatch between the number of cameras and the vector named "
+                             "'{}'. Number of cameras: {}. Size of the vector {}.",
+                             logPrefix,
+                             accelerationParamName,
+                             cameraNames.size(),
+                             videoAcceleration.size());
+                return false;
+            }
+
             if (fps.size() != cameraNames.size())
             {
                 log()->error("{} Mismatch between the number of cameras and the vector containing "
@@ -261,6 +332,11 @@ bool YarpRobotLoggerDevice::open(yarp::os::Searchable& config)
                 // get the desired fps for each camera
                 m_videoWriters[cameraNames[i]].fps = fps[i];
 
+                if (!videoAcceleration.empty())
+                {
+                    m_videoWriters[cameraNames[i]].videoAcceleration = videoAcceleration[i];
+                }
+
                 // this means that the list of cameras are rgb camera
                 if ((&cameraNames) == (&m_cameraBridge->getMetaData().sensorsList.rgbCamerasList))
                 {
@@ -333,6 +409,44 @@ bool YarpRobotLoggerDevice::open(yarp::os::Searchable& config)
                              fourccCodecUrl);
                 return false;
             }
+
+            if (!params->getParameter("video_acceleration", m_videoAcceleration))
+            {
+                log()->info("{} The parameter 'video_acceleration' is not provided. The default "
+                            "one will be used {}.",
+                            logPrefix,
+                            m_videoAcceleration);
+            }
+
+            // validate the device-wide selection and the per-camera overrides
+            auto isValidAcceleration = [](const std::string& acceleration) -> bool {
+                return acceleration == "none" || acceleration == "any" || acceleration == "vaapi"
+                       || acceleration == "mfx" || acceleration == "d3d11";
+            };
+
+            if (!isValidAcceleration(m_videoAcceleration))
+            {
+                log()->error("{} The parameter 'video_acceleration' must be one of 'none', 'any', "
+                             "'vaapi', 'mfx' or 'd3d11'. Provided: {}.",
+                             logPrefix,
+                             m_videoAcceleration);
+                return false;
+            }
+
+            for (const auto& [camera, writer] : m_videoWriters)
+            {
+                if (!writer.videoAcceleration.empty()
+                    && !isValidAcceleration(writer.videoAcceleration))
+                {
+                    log()->error("{} The hardware acceleration associated to the camera {} must "
+                                 "be one of 'none', 'any', 'vaapi', 'mfx' or 'd3d11'. Provided: "
+                                 "{}.",
+                                 logPrefix,
+                                 camera,
+                                 writer.videoAcceleration);
+                    return false;
+                }
+            }
         }
     } else
     {
@@ -344,6 +458,19 @@ bool YarpRobotLoggerDevice::open(yarp::os::Searchable& config)
         return false;
     }
 
+    if (m_flightRecorderEnabled)
+    {
+        m_flightRecorderTrigger.dumpRequested = &m_flightRecorderDumpRequested;
+        m_flightRecorderPort.setReader(m_flightRecorderTrigger);
+        if (!m_flightRecorderPort.open(m_flightRecorderPortName))
+        {
+            log()->error("{} Unable to open the port named: {}.",
+                         logPrefix,
+                         m_flightRecorderPortName);
+            return false;
+        }
+    }
+
     if (!this->setupExogenousInputs(params->getGroup("ExogenousSignals")))
     {
         return false;
@@ -357,6 +484,10 @@ bool YarpRobotLoggerDevice::setupExogenousInputs(
 {
     constexpr auto logPrefix = "[YarpRobotLoggerDevice::setupExogenousInputs]";
 
+    // capacity of the per-signal ring buffers filled by the port callbacks and drained by
+    // the logging thread
+    constexpr std::size_t ringBufferCapacity = 256;
+
     auto ptr = params.lock();
     if (ptr == nullptr)
     {
@@ -397,6 +528,10 @@ bool YarpRobotLoggerDevice::setupExogenousInputs(
                          m_vectorsCollectionSignals[remote].local);
             return false;
         }
+
+        // the samples are ingested by the port callback through a wait-free ring buffer
+        m_vectorsCollectionSignals[remote].ringBuffer.resize(ringBufferCapacity);
+        m_vectorsCollectionSignals[remote].port.useCallback(m_vectorsCollectionSignals[remote]);
     }
 
     if (!ptr->getParameter("vectors_exogenous_inputs", inputs))
@@ -431,6 +566,9 @@ bool YarpRobotLoggerDevice::setupExogenousInputs(
                          m_vectorSignals[remote].local);
             return false;
         }
+
+        m_vectorSignals[remote].ringBuffer.resize(ringBufferCapacity);
+        m_vectorSignals[remote].port.useCallback(m_vectorSignals[remote]);
     }
 
     return true;
@@ -461,19 +599,119 @@ bool YarpRobotLoggerDevice::setupTelemetry(
     config.file_indexing = "%Y_%m_%d_%H_%M_%S";
     config.mat_file_version = matioCpp::FileVersion::MAT7_3;
 
-    if (!ptr->getParameter("save_period", config.save_period))
+    // to be sure we are not going to lose data the in-memory buffer will be 10% longer
+    constexpr double percentage = 0.1;
+
+    if (!ptr->getParameter("enable_flight_recorder", m_flightRecorderEnabled))
+    {
+        log()->info("{} The parameter 'enable_flight_recorder' is not found. The default one will "
+                    "be used {}.",
+                    logPrefix,
+                    m_flightRecorderEnabled);
+    }
+
+    if (m_flightRecorderEnabled)
+    {
+        // flight recorder mode: the signals are stored only in the in-memory circular
+        // buffers and no file is written during normal operation. The buffers are dumped
+        // on the 'dump' RPC command, on SIGUSR1 or when the device is closed
+        double flightRecorderDuration = 30.0;
+        if (!ptr->getParameter("flight_recorder_duration", flightRecorderDuration))
+        {
+            log()->info("{} The parameter 'flight_recorder_duration' is not found. The default "
+                        "one will be used {}.",
+                        logPrefix,
+                        flightRecorderDuration);
+        }
+
+        if (flightRecorderDuration <= 0)
+        {
+            log()->error("{} The parameter 'flight_recorder_duration' must be strictly positive.",
+                         logPrefix);
+            return false;
+        }
+
+        config.save_periodically = false;
+        config.n_samples = static_cast<int>(std::ceil((1 + percentage) //
+                                                      * (flightRecorderDuration / devicePeriod)));
+
+#ifdef SIGUSR1
+        std::signal(SIGUSR1, ::flightRecorderSignalHandler);
+#endif
+    } else
+    {
+        if (!ptr->getParameter("save_period", config.save_period))
+        {
+            log()->error("{} Unable to get the 'save_period' parameter for the telemetry.",
+                         logPrefix);
+            return false;
+        }
+
+        // the telemetry will flush the content of its storage every config.save_period
+        // and this device runs every devicePeriod
+        // so the size of the telemetry buffer must be at least config.save_period /
+        // devicePeriod
+        config.n_samples = static_cast<int>(std::ceil((1 + percentage) //
+                                                      * (config.save_period / devicePeriod)));
+    }
+
+    if (!ptr->getParameter("enable_chunked_logging", m_chunkedLoggingEnabled))
     {
-        log()->error("{} Unable to get the 'save_period' parameter for the telemetry.", logPrefix);
+        log()->info("{} The parameter 'enable_chunked_logging' is not found. The default one will "
+                    "be used {}.",
+                    logPrefix,
+                    m_chunkedLoggingEnabled);
+    }
+
+    if (m_chunkedLoggingEnabled && m_flightRecorderEnabled)
+    {
+        log()->error("{} The chunked logging writes to the disk during the logging and cannot be "
+                     "combined with the flight recorder mode.",
+                     logPrefix);
         return false;
     }
 
-    // the telemetry will flush the content of its storage every config.save_period
-    // and this device runs every devicePeriod
-    // so the size of the telemetry buffer must be at least config.save_period / devicePeriod
-    // to be sure we are not going to lose data the buffer will be 10% longer
-    constexpr double percentage = 0.1;
-    config.n_samples = static_cast<int>(std::ceil((1 + percentage) //
-                                                  * (config.save_period / devicePeriod)));
+    if (m_chunkedLoggingEnabled)
+    {
+        int samplesPerChunk = 2048;
+        if (!ptr->getParameter("chunk_size", samplesPerChunk))
+        {
+            log()->info("{} The parameter 'chunk_size' is not found. The default one will be used "
+                        "{}.",
+                        logPrefix,
+                        samplesPerChunk);
+        }
+
+        int compressionLevel = 6;
+        if (!ptr->getParameter("chunk_compression_level", compressionLevel))
+        {
+            log()->info("{} The parameter 'chunk_compression_level' is not found. The default one "
+                        "will be used {}.",
+                        logPrefix,
+                        compressionLevel);
+        }
+
+        if (samplesPerChunk <= 0)
+        {
+            log()->error("{} The parameter 'chunk_size' must be strictly positive.", logPrefix);
+            return false;
+        }
+
+        // the name of the chunked stream follows the indexing of the mat files
+        const auto time = std::time(nullptr);
+        std::ostringstream timeStream;
+        timeStream << std::put_time(std::localtime(&time), config.file_indexing.c_str());
+        const std::string chunkedFileName
+            = config.filename + "_chunks_" + timeStream.str() + ".blf";
+
+        if (!m_chunkedLogger.configure(chunkedFileName,
+                                       static_cast<std::size_t>(samplesPerChunk),
+                                       compressionLevel))
+        {
+            log()->error("{} Unable to configure the chunked logger.", logPrefix);
+            return false;
+        }
+    }
 
     return m_bufferManager.configure(config);
 }
@@ -730,10 +968,16 @@ bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
     // resize the temporary vectors
     m_jointSensorBuffer.resize(dofs);
 
-    // open the TextLogging port
+    // open the TextLogging port. The incoming bottles are copied in a fixed-capacity ring
+    // buffer by the port callback and deserialized by a dedicated thread, so a burst of text
+    // log messages cannot starve the signal path
+    constexpr std::size_t textLoggingRingBufferCapacity = 2048;
+    m_textLogReceiver.ringBuffer.resize(textLoggingRingBufferCapacity);
     ok = ok && m_textLoggingPort.open(m_textLoggingPortName);
-    // run the thread
+    m_textLoggingPort.useCallback(m_textLogReceiver);
+    // run the threads
     m_lookForNewLogsThread = std::thread([this] { this->lookForNewLogs(); });
+    m_processTextLogsThread = std::thread([this] { this->processTextLogs(); });
 
     // run the thread for reading the exogenous signals
     m_lookForNewExogenousSignalThread = std::thread([this] { this->lookForExogenousSignals(); });
@@ -902,17 +1146,77 @@ bool YarpRobotLoggerDevice::openVideoWriter(
         return false;
     }
 
+    const std::string fileName = "output_" + camera + "_" + imageType + ".mp4";
+    const int fourcc = cv::VideoWriter::fourcc(m_videoCodecCode.at(0),
+                                               m_videoCodecCode.at(1),
+                                               m_videoCodecCode.at(2),
+                                               m_videoCodecCode.at(3));
+    const cv::Size frameSize(imgDimension->second.first, imgDimension->second.second);
+    const bool isColor = "rgb" == imageType;
+
+    const std::string& acceleration = videoWriter->second.videoAcceleration.empty()
+                                          ? m_videoAcceleration
+                                          : videoWriter->second.videoAcceleration;
+
     std::lock_guard guard(imageSaver->mutex);
-    imageSaver->writer
-        = std::make_shared<cv::VideoWriter>("output_" + camera + "_" + imageType + ".mp4",
-                                            cv::VideoWriter::fourcc(m_videoCodecCode.at(0),
-                                                                    m_videoCodecCode.at(1),
-                                                                    m_videoCodecCode.at(2),
-                                                                    m_videoCodecCode.at(3)),
-                                            videoWriter->second.fps,
-                                            cv::Size(imgDimension->second.first,
-                                                     imgDimension->second.second),
-                                            "rgb" == imageType);
+
+#if CV_VERSION_MAJOR > 4 \
+    || (CV_VERSION_MAJOR == 4 \
+        && (CV_VERSION_MINOR > 5 || (CV_VERSION_MINOR == 5 && CV_VERSION_REVISION >= 2)))
+    if (acceleration != "none")
+    {
+        // the encoding is dispatched to the hardware encoder exposed by the FFmpeg backend
+        // (e.g. VAAPI or NVENC); the frames handed to write() are uploaded by the backend
+        // without an intermediate copy
+        cv::VideoAccelerationType accelerationType = cv::VIDEO_ACCELERATION_ANY;
+        if (acceleration == "vaapi")
+        {
+            accelerationType = cv::VIDEO_ACCELERATION_VAAPI;
+        } else if (acceleration == "mfx")
+        {
+            accelerationType = cv::VIDEO_ACCELERATION_MFX;
+        } else if (acceleration == "d3d11")
+        {
+            accelerationType = cv::VIDEO_ACCELERATION_D3D11;
+        }
+
+        const std::vector<int> writerParams = {cv::VIDEOWRITER_PROP_HW_ACCELERATION,
+                                               static_cast<int>(accelerationType),
+                                               cv::VIDEOWRITER_PROP_IS_COLOR,
+                                               isColor ? 1 : 0};
+
+        imageSaver->writer = std::make_shared<cv::VideoWriter>(fileName,
+                                                               cv::CAP_FFMPEG,
+                                                               fourcc,
+                                                               videoWriter->second.fps,
+                                                               frameSize,
+                                                               writerParams);
+        if (imageSaver->writer->isOpened())
+        {
+            return true;
+        }
+
+        log()->warn("{} Unable to open the hardware accelerated writer ({}) for the camera named "
+                    "{}. Falling back to the software encoder.",
+                    logPrefix,
+                    acceleration,
+                    camera);
+    }
+#else
+    if (acceleration != "none")
+    {
+        log()->warn("{} The hardware accelerated encoding requires OpenCV >= 4.5.2. The software "
+                    "encoder will be used for the camera named {}.",
+                    logPrefix,
+                    camera);
+    }
+#endif
+
+    imageSaver->writer = std::make_shared<cv::VideoWriter>(fileName,
+                                                           fourcc,
+                                                           videoWriter->second.fps,
+                                                           frameSize,
+                                                           isColor);
     return true;
 }
 
@@ -972,7 +1276,6 @@ void YarpRobotLoggerDevice::lookForExogenousSignals()
         {
             if (!signal.connected && yarp::os::Network::exists(name))
             {
-                std::lock_guard<std::mutex> lock(signal.mutex);
                 signal.connected = signal.connect();
             }
         }
@@ -1065,6 +1368,81 @@ void YarpRobotLoggerDevice::lookForNewLogs()
     }
 }
 
+void YarpRobotLoggerDevice::processTextLogs()
+{
+    using namespace std::chrono_literals;
+    constexpr auto logPrefix = "[YarpRobotLoggerDevice::processTextLogs]";
+
+    // the thread runs at low rate so the deserialization of the text log messages never
+    // competes with the signal path for the CPU
+    const auto processTextLogsPeriod = 200ms;
+
+    auto time = BipedalLocomotion::clock().now();
+    auto oldTime = time;
+    auto wakeUpTime = time;
+    m_processTextLogsIsRunning = true;
+
+    std::string signalFullName;
+
+    while (m_processTextLogsIsRunning)
+    {
+        // detect if a clock has been reset
+        oldTime = time;
+        time = BipedalLocomotion::clock().now();
+        // if the current time is lower than old time, the timer has been reset.
+        if ((time - oldTime).count() < 1e-12)
+        {
+            wakeUpTime = time;
+        }
+        wakeUpTime += processTextLogsPeriod;
+
+        // drain the ring buffer filled by the port callback
+        for (auto* sample = m_textLogReceiver.ringBuffer.front(); sample != nullptr;
+             sample = m_textLogReceiver.ringBuffer.front())
+        {
+            const TextLoggingEntry msg
+                = TextLoggingEntry::deserializeMessage(sample->data, std::to_string(sample->time));
+            if (msg.isValid)
+            {
+                signalFullName = msg.portSystem + "::" + msg.portPrefix + "::" + msg.processName
+                                 + "::p" + msg.processPID;
+
+                // matlab does not support the character - as a key of a struct
+                findAndReplaceAll(signalFullName, "-", "_");
+
+                std::lock_guard lock(m_bufferManagerMutex);
+
+                // if it is the first time this signal is seen by the device the channel is
+                // added
+                if (m_textLogsStoredInManager.find(signalFullName)
+                    == m_textLogsStoredInManager.end())
+                {
+                    m_bufferManager.addChannel({signalFullName, {1, 1}});
+                    m_textLogsStoredInManager.insert(signalFullName);
+                }
+
+                m_bufferManager.push_back(msg, sample->time, signalFullName);
+            }
+
+            m_textLogReceiver.ringBuffer.popFront();
+        }
+
+        const std::size_t dropped = m_textLogReceiver.droppedMessages.exchange(0);
+        if (dropped > 0)
+        {
+            log()->warn("{} {} text log messages have been dropped since the buffer was full.",
+                        logPrefix,
+                        dropped);
+        }
+
+        // release the CPU
+        BipedalLocomotion::clock().yield();
+
+        // sleep
+        BipedalLocomotion::clock().sleepUntil(wakeUpTime);
+    }
+}
+
 void YarpRobotLoggerDevice::recordVideo(const std::string& cameraName, VideoWriter& writer)
 {
     constexpr auto logPrefix = "[YarpRobotLoggerDevice::recordVideo]";
@@ -1196,6 +1574,20 @@ void YarpRobotLoggerDevice::run()
 {
     constexpr auto logPrefix = "[YarpRobotLoggerDevice::run]";
 
+    // dump the flight recorder ring buffers if a trigger fired (RPC command or process
+    // signal). This is the only disk access performed when the flight recorder is active
+    if (m_flightRecorderEnabled
+        && (m_flightRecorderDumpRequested.exchange(false)
+            || g_flightRecorderSignalReceived.exchange(false)))
+    {
+        log()->info("{} Flight recorder trigger received. Dumping the ring buffers.", logPrefix);
+        std::lock_guard lock(m_bufferManagerMutex);
+        if (!m_bufferManager.saveToFile())
+        {
+            log()->error("{} Unable to dump the flight recorder buffers.", logPrefix);
+        }
+    }
+
     // get the data
     if (!m_robotSensorBridge->advance())
     {
@@ -1210,19 +1602,19 @@ void YarpRobotLoggerDevice::run()
     {
         if (m_robotSensorBridge->getJointPositions(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "joints_state::positions");
+            this->logData(m_jointSensorBuffer, time, "joints_state::positions");
         }
         if (m_robotSensorBridge->getJointVelocities(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "joints_state::velocities");
+            this->logData(m_jointSensorBuffer, time, "joints_state::velocities");
         }
         if (m_robotSensorBridge->getJointAccelerations(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "joints_state::accelerations");
+            this->logData(m_jointSensorBuffer, time, "joints_state::accelerations");
         }
         if (m_robotSensorBridge->getJointTorques(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "joints_state::torques");
+            this->logData(m_jointSensorBuffer, time, "joints_state::torques");
         }
     }
 
@@ -1230,19 +1622,19 @@ void YarpRobotLoggerDevice::run()
     {
         if (m_robotSensorBridge->getMotorPositions(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "motors_state::positions");
+            this->logData(m_jointSensorBuffer, time, "motors_state::positions");
         }
         if (m_robotSensorBridge->getMotorVelocities(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "motors_state::velocities");
+            this->logData(m_jointSensorBuffer, time, "motors_state::velocities");
         }
         if (m_robotSensorBridge->getMotorAccelerations(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "motors_state::accelerations");
+            this->logData(m_jointSensorBuffer, time, "motors_state::accelerations");
         }
         if (m_robotSensorBridge->getMotorCurrents(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "motors_state::currents");
+            this->logData(m_jointSensorBuffer, time, "motors_state::currents");
         }
     }
 
@@ -1250,7 +1642,7 @@ void YarpRobotLoggerDevice::run()
     {
         if (m_robotSensorBridge->getMotorPWMs(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "motors_state::PWM");
+            this->logData(m_jointSensorBuffer, time, "motors_state::PWM");
         }
     }
 
@@ -1258,7 +1650,7 @@ void YarpRobotLoggerDevice::run()
     {
         if (m_robotSensorBridge->getPidPositions(m_jointSensorBuffer))
         {
-            m_bufferManager.push_back(m_jointSensorBuffer, time, "PIDs");
+            this->logData(m_jointSensorBuffer, time, "PIDs");
         }
     }
 
@@ -1266,7 +1658,7 @@ void YarpRobotLoggerDevice::run()
     {
         if (m_robotSensorBridge->getSixAxisForceTorqueMeasurement(sensorName, m_ftBuffer))
         {
-            m_bufferManager.push_back(m_ftBuffer, time, "FTs::" + sensorName);
+            this->logData(m_ftBuffer, time, "FTs::" + sensorName);
         }
     }
 
@@ -1275,6 +1667,13 @@ void YarpRobotLoggerDevice::run()
         if (m_robotSensorBridge->getTemperature(sensorname, m_ftTemperatureBuffer))
         {
             m_bufferManager.push_back({m_ftTemperatureBuffer}, time, "temperatures::" + sensorname);
+            if (m_chunkedLoggingEnabled)
+            {
+                m_chunkedLogger.pushBack(&m_ftTemperatureBuffer,
+                                         1,
+                                         time,
+                                         "temperatures::" + sensorname);
+            }
         }
     }
 
@@ -1282,7 +1681,7 @@ void YarpRobotLoggerDevice::run()
     {
         if (m_robotSensorBridge->getGyroscopeMeasure(sensorName, m_gyroBuffer))
         {
-            m_bufferManager.push_back(m_gyroBuffer, time, "gyros::" + sensorName);
+            this->logData(m_gyroBuffer, time, "gyros::" + sensorName);
         }
     }
 
@@ -1291,7 +1690,7 @@ void YarpRobotLoggerDevice::run()
         if (m_robotSensorBridge->getLinearAccelerometerMeasurement(sensorName,
                                                                    m_acceloremeterBuffer))
         {
-            m_bufferManager.push_back(m_acceloremeterBuffer, time, "accelerometers::" + sensorName);
+            this->logData(m_acceloremeterBuffer, time, "accelerometers::" + sensorName);
         }
     }
 
@@ -1299,7 +1698,7 @@ void YarpRobotLoggerDevice::run()
     {
         if (m_robotSensorBridge->getOrientationSensorMeasurement(sensorName, m_orientationBuffer))
         {
-            m_bufferManager.push_back(m_orientationBuffer, time, "orientations::" + sensorName);
+            this->logData(m_orientationBuffer, time, "orientations::" + sensorName);
         }
     }
 
@@ -1307,7 +1706,7 @@ void YarpRobotLoggerDevice::run()
     {
         if (m_robotSensorBridge->getMagnetometerMeasurement(sensorName, m_magnemetometerBuffer))
         {
-            m_bufferManager.push_back(m_magnemetometerBuffer, time, "magnetometers::" + sensorName);
+            this->logData(m_magnemetometerBuffer, time, "magnetometers::" + sensorName);
         }
     }
 
@@ -1322,9 +1721,9 @@ void YarpRobotLoggerDevice::run()
                             m_gyroBuffer,
                             m_orientationBuffer);
 
-            m_bufferManager.push_back(m_acceloremeterBuffer, time, "accelerometers::" + sensorName);
-            m_bufferManager.push_back(m_gyroBuffer, time, "gyros::" + sensorName);
-            m_bufferManager.push_back(m_orientationBuffer, time, "orientations::" + sensorName);
+            this->logData(m_acceloremeterBuffer, time, "accelerometers::" + sensorName);
+            this->logData(m_gyroBuffer, time, "gyros::" + sensorName);
+            this->logData(m_orientationBuffer, time, "orientations::" + sensorName);
         }
     }
 
@@ -1332,20 +1731,22 @@ void YarpRobotLoggerDevice::run()
     {
         if (m_robotSensorBridge->getCartesianWrench(sensorName, m_ftBuffer))
         {
-            m_bufferManager.push_back(m_ftBuffer, time, "cartesian_wrenches::" + sensorName);
+            this->logData(m_ftBuffer, time, "cartesian_wrenches::" + sensorName);
         }
     }
 
+    // drain the ring buffers filled by the port callbacks. Each buffer has a single
+    // producer (the callback) and a single consumer (this thread) so no lock is required
     std::string signalFullName;
     for (auto& [name, signal] : m_vectorsCollectionSignals)
     {
-        std::lock_guard<std::mutex> lock(signal.mutex);
-        BipedalLocomotion::YarpUtilities::VectorsCollection* collection = signal.port.read(false);
-        if (collection != nullptr)
+        for (auto* sample = signal.ringBuffer.front(); sample != nullptr;
+             sample = signal.ringBuffer.front())
         {
+            const BipedalLocomotion::YarpUtilities::VectorsCollection& collection = sample->data;
             if (!signal.dataArrived)
             {
-                for (const auto& [key, vector] : collection->vectors)
+                for (const auto& [key, vector] : collection.vectors)
                 {
                     signalFullName = signal.signalName + "::" + key;
                     m_bufferManager.addChannel({signalFullName, {vector.size(), 1}});
@@ -1353,62 +1754,34 @@ void YarpRobotLoggerDevice::run()
                 signal.dataArrived = true;
             }
 
-            for (const auto& [key, vector] : collection->vectors)
+            for (const auto& [key, vector] : collection.vectors)
             {
                 signalFullName = signal.signalName + "::" + key;
-                m_bufferManager.push_back(vector, time, signalFullName);
+                this->logData(vector, sample->time, signalFullName);
             }
+
+            signal.ringBuffer.popFront();
         }
     }
 
     for (auto& [name, signal] : m_vectorSignals)
     {
-        std::lock_guard<std::mutex> lock(signal.mutex);
-        yarp::sig::Vector* vector = signal.port.read(false);
-        if (vector != nullptr)
+        for (auto* sample = signal.ringBuffer.front(); sample != nullptr;
+             sample = signal.ringBuffer.front())
         {
+            const yarp::sig::Vector& vector = sample->data;
             if (!signal.dataArrived)
             {
-                m_bufferManager.addChannel({signal.signalName, {vector->size(), 1}});
+                m_bufferManager.addChannel({signal.signalName, {vector.size(), 1}});
                 signal.dataArrived = true;
             }
-            m_bufferManager.push_back(*vector, time, signal.signalName);
-        }
-    }
-
-    int bufferportSize = m_textLoggingPort.getPendingReads();
-    BipedalLocomotion::TextLoggingEntry msg;
-
-    while (bufferportSize > 0)
-    {
-        yarp::os::Bottle* b = m_textLoggingPort.read(false);
-        if (b != nullptr)
-        {
-            msg = BipedalLocomotion::TextLoggingEntry::deserializeMessage(*b, std::to_string(time));
-            if (msg.isValid)
-            {
-                signalFullName = msg.portSystem + "::" + msg.portPrefix + "::" + msg.processName
-                                 + "::p" + msg.processPID;
-
-                // matlab does not support the character - as a key of a struct
-                findAndReplaceAll(signalFullName, "-", "_");
-
-                // if it is the first time this signal is seen by the device the channel is added
-                if (m_textLogsStoredInManager.find(signalFullName)
-                    == m_textLogsStoredInManager.end())
-                {
-                    m_bufferManager.addChannel({signalFullName, {1, 1}});
-                    m_textLogsStoredInManager.insert(signalFullName);
-                }
+            this->logData(vector, sample->time, signal.signalName);
 
-                m_bufferManager.push_back(msg, time, signalFullName);
-            }
-            bufferportSize = m_textLoggingPort.getPendingReads();
-        } else
-        {
-            break;
+            signal.ringBuffer.popFront();
         }
     }
+
+    // the text log messages are handled by the processTextLogs thread
 }
 
 bool YarpRobotLoggerDevice::saveCallback(const std::string& fileName,
@@ -1416,6 +1789,13 @@ bool YarpRobotLoggerDevice::saveCallback(const std::string& fileName,
 {
     constexpr auto logPrefix = "[YarpRobotLoggerDevice::saveCallback]";
 
+    // the periodic save becomes a cheap chunk-boundary commit for the chunked stream: the
+    // partially filled chunks are handed over to the background flush thread
+    if (m_chunkedLoggingEnabled)
+    {
+        m_chunkedLogger.commitChunks();
+    }
+
     auto codeStatus = [](const std::string& cmd, const std::string& head) -> std::string {
         std::stringstream processStream, stream;
 
@@ -1644,6 +2024,14 @@ bool YarpRobotLoggerDevice::close()
         m_lookForNewLogsThread = std::thread();
     }
 
+    // close the thread associated to the text logging processing
+    m_processTextLogsIsRunning = false;
+    if (m_processTextLogsThread.joinable())
+    {
+        m_processTextLogsThread.join();
+        m_processTextLogsThread = std::thread();
+    }
+
     m_lookForNewExogenousSignalIsRunning = false;
     if (m_lookForNewExogenousSignalThread.joinable())
     {
@@ -1651,5 +2039,16 @@ bool YarpRobotLoggerDevice::close()
         m_lookForNewExogenousSignalThread = std::thread();
     }
 
+    // flush the pending chunks and stop the background thread
+    if (m_chunkedLoggingEnabled)
+    {
+        m_chunkedLogger.close();
+    }
+
+    if (m_flightRecorderEnabled)
+    {
+        m_flightRecorderPort.close();
+    }
+
     return true;
 }
@@ -8,6 +8,18 @@
 #ifndef BIPEDAL_LOCOMOTION_AUTODIFF_CPPAD_H
 #define BIPEDAL_LOCOMOTION_AUTODIFF_CPPAD_H
 
+#include <cassert>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
 #include <Eigen/Dense>
 #include <cppad/cppad.hpp>
 #include <cppad/example/cppad_eigen.hpp>
@@ -57,6 +69,176 @@ EIGEN_MAKE_TYPEDEFS_ALL_SIZES(::CppAD::AD<double>, AD)
 #undef EIGEN_MAKE_TYPEDEFS
 #undef EIGEN_MAKE_FIXED_TYPEDEFS
 
+namespace detail
+{
+/**
+ * Compute the hash stored in a tape cache file. The hash covers both the serialized tape and the
+ * user signature, so a cache recorded for a different function (or with a stale signature) is
+ * never reloaded.
+ * @param graph tape serialized as a json graph.
+ * @param signature user provided signature.
+ * @return the hash as a decimal string.
+ */
+inline std::string tapeHash(const std::string& graph, const std::string& signature)
+{
+    const std::size_t graphHash = std::hash<std::string>{}(graph);
+    const std::size_t signatureHash = std::hash<std::string>{}(signature);
+
+    // combine the two hashes following the boost::hash_combine recipe
+    const std::size_t hash = graphHash ^ (signatureHash + 0x9e3779b9 + (graphHash << 6)
+                                          + (graphHash >> 2));
+    return std::to_string(hash);
+}
+} // namespace detail
+
+/**
+ * Save a recorded tape to a file so that a future run of the process can reload it with
+ * loadTapeFromFile() instead of re-recording it. The tape is serialized as a json graph and
+ * stored together with a hash of its content and of the user signature.
+ * @param function recorded tape.
+ * @param filePath path of the cache file.
+ * @param signature user provided string identifying the taped function (e.g. the model name and
+ * the parameters used while recording). The same signature must be passed to loadTapeFromFile().
+ * @return true in case of success, false otherwise.
+ */
+inline bool saveTapeToFile(::CppAD::ADFun<double>& function,
+                           const std::string& filePath,
+                           const std::string& signature)
+{
+    const std::string graph = function.to_json();
+
+    std::ofstream file(filePath, std::ios::trunc);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file << detail::tapeHash(graph, signature) << '\n' << signature << '\n' << graph;
+    return file.good();
+}
+
+/**
+ * Reload a tape previously stored with saveTapeToFile(). The tape is reloaded only if the
+ * signature matches the stored one and the stored hash validates the file content, so a corrupted
+ * cache or a cache recorded for a different function is rejected and the caller can fall back to
+ * re-recording.
+ * @param function tape where the cached operation sequence is loaded.
+ * @param filePath path of the cache file.
+ * @param signature user provided string identifying the taped function.
+ * @return true in case of success, false if the cache is missing, stale or corrupted.
+ */
+inline bool loadTapeFromFile(::CppAD::ADFun<double>& function,
+                             const std::string& filePath,
+                             const std::string& signature)
+{
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::string storedHash, storedSignature;
+    if (!std::getline(file, storedHash) || !std::getline(file, storedSignature))
+    {
+        return false;
+    }
+
+    if (storedSignature != signature)
+    {
+        return false;
+    }
+
+    const std::string graph(std::istreambuf_iterator<char>(file), //
+                            std::istreambuf_iterator<char>());
+    if (detail::tapeHash(graph, signature) != storedHash)
+    {
+        return false;
+    }
+
+    function.from_json(graph);
+    return true;
+}
+
+/**
+ * TapeEvaluationPool hands out a private copy of a recorded tape to every thread that asks for
+ * one. A CppAD::ADFun stores the Taylor coefficients of the last evaluation inside the object, so
+ * the same tape cannot be evaluated by two threads at the same time; cloning the tape once per
+ * thread removes the contention while recording the operation sequence only once.
+ *
+ * The typical usage is
+ * @code
+ * TapeEvaluationPool pool;
+ * pool.setPrototype(f); // f is recorded (or reloaded) once
+ * // in each worker thread
+ * Eigen::VectorXd jacobian = pool.context().Jacobian(x);
+ * @endcode
+ */
+class TapeEvaluationPool
+{
+public:
+    /**
+     * Set the tape cloned by the evaluation contexts. The previously created contexts are
+     * dropped.
+     * @param function recorded tape.
+     * @note CppAD forbids the ADFun copy constructor, for this reason the tape is taken by
+     * non-const reference and deep copied through the assignment operator.
+     */
+    void setPrototype(::CppAD::ADFun<double>& function)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_prototype = function;
+        m_contexts.clear();
+        m_hasPrototype = true;
+    }
+
+    /**
+     * Get the evaluation context associated to the calling thread. The first call performed by a
+     * thread clones the prototype, the following ones return the same object.
+     * @return a reference to the tape owned by the calling thread. The reference stays valid
+     * until setPrototype() or clear() is called.
+     * @warning setPrototype() must be called before the first call to this method.
+     */
+    ::CppAD::ADFun<double>& context()
+    {
+        const std::thread::id threadId = std::this_thread::get_id();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        assert(m_hasPrototype && "setPrototype() must be called before context().");
+
+        auto it = m_contexts.find(threadId);
+        if (it == m_contexts.end())
+        {
+            it = m_contexts.emplace(std::piecewise_construct,
+                                    std::forward_as_tuple(threadId),
+                                    std::forward_as_tuple())
+                     .first;
+            it->second = m_prototype;
+        }
+
+        // the references into an unordered_map are not invalidated by further insertions, so the
+        // context can be evaluated outside the lock
+        return it->second;
+    }
+
+    /**
+     * Drop all the per-thread contexts and the prototype.
+     */
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_contexts.clear();
+        m_prototype = ::CppAD::ADFun<double>();
+        m_hasPrototype = false;
+    }
+
+private:
+    std::mutex m_mutex; /**< Mutex protecting the prototype and the contexts map. */
+    ::CppAD::ADFun<double> m_prototype; /**< Tape cloned by the evaluation contexts. */
+    std::unordered_map<std::thread::id, ::CppAD::ADFun<double>> m_contexts; /**< Per-thread
+                                                                                 clones. */
+    bool m_hasPrototype{false}; /**< True when setPrototype() has been called. */
+};
+
 } // namespace CppAD
 } // namespace AutoDiff
 } // namespace BipedalLocomotion
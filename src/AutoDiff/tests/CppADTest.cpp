@@ -5,6 +5,12 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+// std
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
 // Catch2
 #include <catch2/catch_test_macros.hpp>
 
@@ -42,3 +48,68 @@ TEST_CASE("CppAD and Eigen")
     constexpr double tolerance = 1e-4;
     REQUIRE(jacMatrix.isApprox(analyticJacobian(xNum), tolerance));
 }
+
+TEST_CASE("Tape cache and evaluation pool")
+{
+    namespace blfCppAD = BipedalLocomotion::AutoDiff::CppAD;
+
+    // Record a simple tape
+    blfCppAD::VectorXAD x(3);
+    CppAD::Independent(x);
+    blfCppAD::VectorXAD y = (2.0 * x.array()).square() + x.array().sin();
+    CppAD::ADFun<double> f(x, y);
+
+    Eigen::VectorXd xNum = Eigen::VectorXd::Random(3);
+    const Eigen::VectorXd expectedJacobian = f.Jacobian(xNum);
+
+    const std::string filePath = "cppad_tape_cache_test.bin";
+    const std::string signature = "cppad_test_tape_v1";
+
+    SECTION("Save and reload")
+    {
+        REQUIRE(blfCppAD::saveTapeToFile(f, filePath, signature));
+
+        CppAD::ADFun<double> reloaded;
+        REQUIRE(blfCppAD::loadTapeFromFile(reloaded, filePath, signature));
+        REQUIRE(reloaded.Domain() == f.Domain());
+        REQUIRE(reloaded.Range() == f.Range());
+        REQUIRE(reloaded.Jacobian(xNum).isApprox(expectedJacobian));
+
+        // a stale signature must invalidate the cache
+        CppAD::ADFun<double> stale;
+        REQUIRE_FALSE(blfCppAD::loadTapeFromFile(stale, filePath, "cppad_test_tape_v2"));
+    }
+
+    SECTION("Concurrent evaluation")
+    {
+        blfCppAD::TapeEvaluationPool pool;
+        pool.setPrototype(f);
+
+        constexpr std::size_t numberOfThreads = 4;
+        // std::vector<bool> packs its elements, a concurrent write per thread requires distinct
+        // objects
+        std::vector<int> success(numberOfThreads, 0);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < numberOfThreads; i++)
+        {
+            threads.emplace_back([&pool, &xNum, &expectedJacobian, &success, i]() {
+                bool ok = true;
+                for (std::size_t iteration = 0; iteration < 100; iteration++)
+                {
+                    ok = ok && pool.context().Jacobian(xNum).isApprox(expectedJacobian);
+                }
+                success[i] = ok ? 1 : 0;
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (std::size_t i = 0; i < numberOfThreads; i++)
+        {
+            REQUIRE(success[i]);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file AllocationCounter.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_ALLOCATION_COUNTER_H
+#define BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+namespace BipedalLocomotion
+{
+namespace BenchmarkUtils
+{
+
+/**
+ * AllocationCounter counts the heap allocations performed after its construction. The
+ * BenchmarkUtils library replaces the global operator new/delete with counting versions, so an
+ * executable linking it can verify that a hot path does not allocate
+ * \code{.cpp}
+ * BenchmarkUtils::AllocationCounter counter;
+ * codeUnderBenchmark();
+ * REQUIRE(counter.numberOfAllocations() == 0);
+ * \endcode
+ * @warning The counters are process-wide: allocations performed by other threads while the
+ * counter is alive are counted as well, so the check is meaningful only in single-threaded
+ * benchmarks.
+ * @warning Only the allocations routed through operator new are observed. Eigen dynamic-size
+ * objects allocate through std::malloc and are not counted.
+ */
+class AllocationCounter
+{
+public:
+    /**
+     * Constructor. The construction snapshots the global counters.
+     */
+    AllocationCounter();
+
+    /**
+     * Snapshot the global counters again, so the accessors count from this point on.
+     */
+    void reset();
+
+    /**
+     * Get the number of allocations performed since the construction or the last reset.
+     * @return the number of allocations.
+     */
+    std::size_t numberOfAllocations() const;
+
+    /**
+     * Get the number of deallocations performed since the construction or the last reset.
+     * @return the number of deallocations.
+     */
+    std::size_t numberOfDeallocations() const;
+
+    /**
+     * Get the number of bytes allocated since the construction or the last reset.
+     * @return the number of allocated bytes.
+     */
+    std::size_t allocatedBytes() const;
+
+private:
+    std::size_t m_initialAllocations{0}; /**< Allocations at the last snapshot. */
+    std::size_t m_initialDeallocations{0}; /**< Deallocations at the last snapshot. */
+    std::size_t m_initialBytes{0}; /**< Allocated bytes at the last snapshot. */
+};
+
+} // namespace BenchmarkUtils
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_ALLOCATION_COUNTER_H
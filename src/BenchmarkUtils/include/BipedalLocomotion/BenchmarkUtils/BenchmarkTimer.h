@@ -0,0 +1,146 @@
+/**
+ * @file BenchmarkTimer.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_BENCHMARK_TIMER_H
+#define BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_BENCHMARK_TIMER_H
+
+#include <chrono>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <BipedalLocomotion/System/Clock.h>
+
+namespace BipedalLocomotion
+{
+namespace BenchmarkUtils
+{
+
+/**
+ * BenchmarkTimer collects the latency samples of a benchmarked code section and computes the
+ * associated statistics. The time is read from BipedalLocomotion::clock(), so the timer follows
+ * the clock installed with the System::ClockBuilder.
+ * The typical usage is
+ * \code{.cpp}
+ * BenchmarkUtils::BenchmarkTimer timer;
+ * timer.reserve(iterations);
+ * for (std::size_t i = 0; i < iterations; i++)
+ * {
+ *     timer.tic();
+ *     codeUnderBenchmark();
+ *     timer.toc();
+ * }
+ * log()->info("median latency = {}", timer.median());
+ * \endcode
+ */
+class BenchmarkTimer
+{
+public:
+    /**
+     * Reserve the memory required to store the samples, so that the measurement loop does not
+     * allocate.
+     * @param numberOfSamples expected number of samples.
+     */
+    void reserve(const std::size_t numberOfSamples);
+
+    /**
+     * Start the measurement of a sample.
+     */
+    void tic();
+
+    /**
+     * Stop the measurement of a sample and store it.
+     */
+    void toc();
+
+    /**
+     * Store a sample measured externally.
+     * @param sample the duration of the sample.
+     */
+    void addSample(const std::chrono::nanoseconds& sample);
+
+    /**
+     * Get the number of stored samples.
+     * @return the number of samples.
+     */
+    std::size_t numberOfSamples() const;
+
+    /**
+     * Get the mean of the stored samples.
+     * @return the mean, zero if no sample is stored.
+     */
+    std::chrono::nanoseconds mean() const;
+
+    /**
+     * Get the median of the stored samples.
+     * @return the median, zero if no sample is stored.
+     */
+    std::chrono::nanoseconds median() const;
+
+    /**
+     * Get the minimum of the stored samples.
+     * @return the minimum, zero if no sample is stored.
+     */
+    std::chrono::nanoseconds min() const;
+
+    /**
+     * Get the maximum of the stored samples.
+     * @return the maximum, zero if no sample is stored.
+     */
+    std::chrono::nanoseconds max() const;
+
+    /**
+     * Get the stored samples.
+     * @return a const reference to the samples.
+     */
+    const std::vector<std::chrono::nanoseconds>& samples() const;
+
+    /**
+     * Remove all the stored samples.
+     */
+    void reset();
+
+private:
+    std::chrono::nanoseconds m_ticTime{std::chrono::nanoseconds::zero()}; /**< Time of the last
+                                                                             tic() call. */
+    std::vector<std::chrono::nanoseconds> m_samples; /**< Stored samples. */
+};
+
+/**
+ * Measure the latency of a callable. The function runs the callable warmUpIterations times
+ * without measuring, then iterations times storing one sample per call.
+ * @param function the callable to benchmark.
+ * @param warmUpIterations number of discarded warm-up calls.
+ * @param iterations number of measured calls.
+ * @return the BenchmarkTimer containing the samples.
+ */
+template <class Callable>
+BenchmarkTimer
+measure(Callable&& function, const std::size_t warmUpIterations, const std::size_t iterations)
+{
+    BenchmarkTimer timer;
+    timer.reserve(iterations);
+
+    for (std::size_t i = 0; i < warmUpIterations; i++)
+    {
+        function();
+    }
+
+    for (std::size_t i = 0; i < iterations; i++)
+    {
+        timer.tic();
+        function();
+        timer.toc();
+    }
+
+    return timer;
+}
+
+} // namespace BenchmarkUtils
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_BENCHMARK_TIMER_H
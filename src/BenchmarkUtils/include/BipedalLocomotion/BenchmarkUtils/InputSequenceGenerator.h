@@ -0,0 +1,90 @@
+/**
+ * @file InputSequenceGenerator.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_INPUT_SEQUENCE_GENERATOR_H
+#define BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_INPUT_SEQUENCE_GENERATOR_H
+
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace BipedalLocomotion
+{
+namespace BenchmarkUtils
+{
+
+/**
+ * InputSequenceGenerator produces deterministic input sequences for benchmarks. Two generators
+ * built with the same seed produce the same sequences, so a benchmark feeds the code under test
+ * with identical data across runs and machines.
+ */
+class InputSequenceGenerator
+{
+public:
+    /**
+     * Constructor.
+     * @param seed seed of the internal random engine.
+     */
+    explicit InputSequenceGenerator(const unsigned int seed = 42);
+
+    /**
+     * Reset the internal random engine.
+     * @param seed seed of the internal random engine.
+     */
+    void reset(const unsigned int seed);
+
+    /**
+     * Generate a vector of normally distributed values.
+     * @param size size of the vector.
+     * @param mean mean of the distribution.
+     * @param standardDeviation standard deviation of the distribution.
+     * @return the generated vector.
+     */
+    Eigen::VectorXd randomVector(const std::size_t size,
+                                 const double mean = 0.0,
+                                 const double standardDeviation = 1.0);
+
+    /**
+     * Generate a sequence of vectors of normally distributed values.
+     * @param length number of vectors in the sequence.
+     * @param size size of each vector.
+     * @param mean mean of the distribution.
+     * @param standardDeviation standard deviation of the distribution.
+     * @return the generated sequence.
+     */
+    std::vector<Eigen::VectorXd> randomSequence(const std::size_t length,
+                                                const std::size_t size,
+                                                const double mean = 0.0,
+                                                const double standardDeviation = 1.0);
+
+    /**
+     * Generate a sequence of sinusoidal vectors. The i-th element of each vector is a sinusoid
+     * with a phase shift proportional to i, so the elements of the vector are not synchronous.
+     * @param length number of vectors in the sequence.
+     * @param size size of each vector.
+     * @param amplitude amplitude of the sinusoids.
+     * @param period period of the sinusoids.
+     * @param samplingTime time between two consecutive vectors of the sequence.
+     * @return the generated sequence.
+     */
+    std::vector<Eigen::VectorXd> sinusoidalSequence(const std::size_t length,
+                                                    const std::size_t size,
+                                                    const double amplitude,
+                                                    const std::chrono::nanoseconds& period,
+                                                    const std::chrono::nanoseconds& samplingTime);
+
+private:
+    std::default_random_engine m_generator; /**< Seeded random engine. */
+};
+
+} // namespace BenchmarkUtils
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_INPUT_SEQUENCE_GENERATOR_H
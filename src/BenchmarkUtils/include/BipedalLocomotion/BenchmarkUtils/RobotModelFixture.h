@@ -0,0 +1,37 @@
+/**
+ * @file RobotModelFixture.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_ROBOT_MODEL_FIXTURE_H
+#define BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_ROBOT_MODEL_FIXTURE_H
+
+#include <cstddef>
+#include <memory>
+
+#include <iDynTree/KinDynComputations.h>
+
+namespace BipedalLocomotion
+{
+namespace BenchmarkUtils
+{
+
+/**
+ * Create a KinDynComputations object associated to a random model with a deterministic state.
+ * The frame velocity representation is set to MIXED_REPRESENTATION and the robot state is
+ * populated with normally distributed joint positions, zero velocities and the standard gravity.
+ * Two calls with the same number of joints and seed return equivalent objects, so a benchmark
+ * built on this fixture processes the same model across runs and machines.
+ * @param numberOfJoints number of joints of the random model.
+ * @param seed seed used to generate the model and the robot state.
+ * @return a pointer to the KinDynComputations object, nullptr in case of failure.
+ */
+std::shared_ptr<iDynTree::KinDynComputations>
+createRandomKinDynComputations(const std::size_t numberOfJoints, const unsigned int seed = 42);
+
+} // namespace BenchmarkUtils
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_ROBOT_MODEL_FIXTURE_H
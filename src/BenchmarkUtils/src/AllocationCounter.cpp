@@ -0,0 +1,105 @@
+/**
+ * @file AllocationCounter.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <BipedalLocomotion/BenchmarkUtils/AllocationCounter.h>
+
+namespace
+{
+// process-wide counters updated by the replaced operator new/delete. They live in the same
+// translation unit of the AllocationCounter methods so linking the class pulls in the
+// replacement operators as well
+std::atomic<std::size_t> g_numberOfAllocations{0};
+std::atomic<std::size_t> g_numberOfDeallocations{0};
+std::atomic<std::size_t> g_allocatedBytes{0};
+
+void* countingAllocate(std::size_t size)
+{
+    g_numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+    g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (void* pointer = std::malloc(size))
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void countingDeallocate(void* pointer) noexcept
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    g_numberOfDeallocations.fetch_add(1, std::memory_order_relaxed);
+    std::free(pointer);
+}
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    return countingAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return countingAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    countingDeallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    countingDeallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    countingDeallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    countingDeallocate(pointer);
+}
+
+using namespace BipedalLocomotion::BenchmarkUtils;
+
+AllocationCounter::AllocationCounter()
+{
+    this->reset();
+}
+
+void AllocationCounter::reset()
+{
+    m_initialAllocations = g_numberOfAllocations.load(std::memory_order_relaxed);
+    m_initialDeallocations = g_numberOfDeallocations.load(std::memory_order_relaxed);
+    m_initialBytes = g_allocatedBytes.load(std::memory_order_relaxed);
+}
+
+std::size_t AllocationCounter::numberOfAllocations() const
+{
+    return g_numberOfAllocations.load(std::memory_order_relaxed) - m_initialAllocations;
+}
+
+std::size_t AllocationCounter::numberOfDeallocations() const
+{
+    return g_numberOfDeallocations.load(std::memory_order_relaxed) - m_initialDeallocations;
+}
+
+std::size_t AllocationCounter::allocatedBytes() const
+{
+    return g_allocatedBytes.load(std::memory_order_relaxed) - m_initialBytes;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file BenchmarkTimer.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include <BipedalLocomotion/BenchmarkUtils/BenchmarkTimer.h>
+
+using namespace BipedalLocomotion::BenchmarkUtils;
+
+void BenchmarkTimer::reserve(const std::size_t numberOfSamples)
+{
+    m_samples.reserve(numberOfSamples);
+}
+
+void BenchmarkTimer::tic()
+{
+    m_ticTime = BipedalLocomotion::clock().now();
+}
+
+void BenchmarkTimer::toc()
+{
+    m_samples.push_back(BipedalLocomotion::clock().now() - m_ticTime);
+}
+
+void BenchmarkTimer::addSample(const std::chrono::nanoseconds& sample)
+{
+    m_samples.push_back(sample);
+}
+
+std::size_t BenchmarkTimer::numberOfSamples() const
+{
+    return m_samples.size();
+}
+
+std::chrono::nanoseconds BenchmarkTimer::mean() const
+{
+    if (m_samples.empty())
+    {
+        return std::chrono::nanoseconds::zero();
+    }
+
+    const std::chrono::nanoseconds sum = std::accumulate(m_samples.begin(),
+                                                         m_samples.end(),
+                                                         std::chrono::nanoseconds::zero());
+    return sum / m_samples.size();
+}
+
+std::chrono::nanoseconds BenchmarkTimer::median() const
+{
+    if (m_samples.empty())
+    {
+        return std::chrono::nanoseconds::zero();
+    }
+
+    // the samples are copied so the stored sequence is not reordered
+    std::vector<std::chrono::nanoseconds> samples = m_samples;
+    const std::size_t index = samples.size() / 2;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+std::chrono::nanoseconds BenchmarkTimer::min() const
+{
+    if (m_samples.empty())
+    {
+        return std::chrono::nanoseconds::zero();
+    }
+
+    return *std::min_element(m_samples.begin(), m_samples.end());
+}
+
+std::chrono::nanoseconds BenchmarkTimer::max() const
+{
+    if (m_samples.empty())
+    {
+        return std::chrono::nanoseconds::zero();
+    }
+
+    return *std::max_element(m_samples.begin(), m_samples.end());
+}
+
+const std::vector<std::chrono::nanoseconds>& BenchmarkTimer::samples() const
+{
+    return m_samples;
+}
+
+void BenchmarkTimer::reset()
+{
+    m_ticTime = std::chrono::nanoseconds::zero();
+    m_samples.clear();
+}
@@ -0,0 +1,80 @@
+/**
+ * @file InputSequenceGenerator.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cmath>
+
+#include <BipedalLocomotion/BenchmarkUtils/InputSequenceGenerator.h>
+
+using namespace BipedalLocomotion::BenchmarkUtils;
+
+InputSequenceGenerator::InputSequenceGenerator(const unsigned int seed)
+{
+    m_generator.seed(seed);
+}
+
+void InputSequenceGenerator::reset(const unsigned int seed)
+{
+    m_generator.seed(seed);
+}
+
+Eigen::VectorXd InputSequenceGenerator::randomVector(const std::size_t size,
+                                                     const double mean,
+                                                     const double standardDeviation)
+{
+    std::normal_distribution<double> distribution(mean, standardDeviation);
+
+    Eigen::VectorXd vector(size);
+    for (int i = 0; i < vector.size(); i++)
+    {
+        vector[i] = distribution(m_generator);
+    }
+
+    return vector;
+}
+
+std::vector<Eigen::VectorXd> InputSequenceGenerator::randomSequence(const std::size_t length,
+                                                                    const std::size_t size,
+                                                                    const double mean,
+                                                                    const double standardDeviation)
+{
+    std::vector<Eigen::VectorXd> sequence;
+    sequence.reserve(length);
+    for (std::size_t i = 0; i < length; i++)
+    {
+        sequence.push_back(this->randomVector(size, mean, standardDeviation));
+    }
+
+    return sequence;
+}
+
+std::vector<Eigen::VectorXd>
+InputSequenceGenerator::sinusoidalSequence(const std::size_t length,
+                                           const std::size_t size,
+                                           const double amplitude,
+                                           const std::chrono::nanoseconds& period,
+                                           const std::chrono::nanoseconds& samplingTime)
+{
+    constexpr double twoPi = 2.0 * M_PI;
+    const double periodInSeconds = std::chrono::duration<double>(period).count();
+    const double samplingTimeInSeconds = std::chrono::duration<double>(samplingTime).count();
+
+    std::vector<Eigen::VectorXd> sequence;
+    sequence.reserve(length);
+    for (std::size_t k = 0; k < length; k++)
+    {
+        Eigen::VectorXd vector(size);
+        const double time = k * samplingTimeInSeconds;
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const double phase = twoPi * i / size;
+            vector[i] = amplitude * std::sin(twoPi * time / periodInSeconds + phase);
+        }
+        sequence.push_back(std::move(vector));
+    }
+
+    return sequence;
+}
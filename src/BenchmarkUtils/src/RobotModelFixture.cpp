@@ -0,0 +1,68 @@
+/**
+ * @file RobotModelFixture.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cstdlib>
+#include <random>
+
+#include <Eigen/Dense>
+
+#include <iDynTree/Model/ModelTestUtils.h>
+
+#include <BipedalLocomotion/BenchmarkUtils/RobotModelFixture.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion;
+
+std::shared_ptr<iDynTree::KinDynComputations>
+BenchmarkUtils::createRandomKinDynComputations(const std::size_t numberOfJoints,
+                                               const unsigned int seed)
+{
+    constexpr auto logPrefix = "[BenchmarkUtils::createRandomKinDynComputations]";
+
+    // iDynTree::getRandomModel internally relies on std::rand, so the C random engine is seeded
+    // to make the generated model deterministic
+    std::srand(seed);
+
+    auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    if (!kinDyn->setFrameVelocityRepresentation(
+            iDynTree::FrameVelocityRepresentation::MIXED_REPRESENTATION))
+    {
+        log()->error("{} Unable to set the frame velocity representation.", logPrefix);
+        return nullptr;
+    }
+
+    const iDynTree::Model model = iDynTree::getRandomModel(numberOfJoints);
+    if (!kinDyn->loadRobotModel(model))
+    {
+        log()->error("{} Unable to load the random model.", logPrefix);
+        return nullptr;
+    }
+
+    // set a repeatable robot state
+    std::default_random_engine generator;
+    generator.seed(seed);
+    std::normal_distribution<double> distribution(0.0, 0.1);
+
+    const Eigen::Matrix4d basePose = Eigen::Matrix4d::Identity();
+    Eigen::VectorXd jointPositions(kinDyn->getNrOfDegreesOfFreedom());
+    for (int i = 0; i < jointPositions.size(); i++)
+    {
+        jointPositions[i] = distribution(generator);
+    }
+    const Eigen::Matrix<double, 6, 1> baseVelocity = Eigen::Matrix<double, 6, 1>::Zero();
+    const Eigen::VectorXd jointVelocities
+        = Eigen::VectorXd::Zero(kinDyn->getNrOfDegreesOfFreedom());
+    const Eigen::Vector3d gravity{0, 0, -9.81};
+
+    if (!kinDyn->setRobotState(basePose, jointPositions, baseVelocity, jointVelocities, gravity))
+    {
+        log()->error("{} Unable to set the robot state.", logPrefix);
+        return nullptr;
+    }
+
+    return kinDyn;
+}
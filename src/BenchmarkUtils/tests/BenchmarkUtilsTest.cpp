@@ -0,0 +1,146 @@
+/**
+ * @file BenchmarkUtilsTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/BenchmarkUtils/AllocationCounter.h>
+#include <BipedalLocomotion/BenchmarkUtils/BenchmarkTimer.h>
+#include <BipedalLocomotion/BenchmarkUtils/InputSequenceGenerator.h>
+#include <BipedalLocomotion/BenchmarkUtils/RobotModelFixture.h>
+
+#include <iDynTree/Core/EigenHelpers.h>
+
+using namespace BipedalLocomotion::BenchmarkUtils;
+using namespace std::chrono_literals;
+
+TEST_CASE("BenchmarkTimer")
+{
+    BenchmarkTimer timer;
+
+    SECTION("Empty timer")
+    {
+        REQUIRE(timer.numberOfSamples() == 0);
+        REQUIRE(timer.mean() == 0ns);
+        REQUIRE(timer.median() == 0ns);
+        REQUIRE(timer.min() == 0ns);
+        REQUIRE(timer.max() == 0ns);
+    }
+
+    SECTION("Statistics")
+    {
+        for (const auto& sample : {5ns, 1ns, 3ns, 2ns, 4ns})
+        {
+            timer.addSample(sample);
+        }
+
+        REQUIRE(timer.numberOfSamples() == 5);
+        REQUIRE(timer.mean() == 3ns);
+        REQUIRE(timer.median() == 3ns);
+        REQUIRE(timer.min() == 1ns);
+        REQUIRE(timer.max() == 5ns);
+
+        timer.reset();
+        REQUIRE(timer.numberOfSamples() == 0);
+    }
+
+    SECTION("Measure")
+    {
+        int calls = 0;
+        const BenchmarkTimer result = measure([&calls] { calls++; }, 10, 100);
+
+        REQUIRE(calls == 110);
+        REQUIRE(result.numberOfSamples() == 100);
+    }
+}
+
+TEST_CASE("InputSequenceGenerator")
+{
+    constexpr std::size_t size = 23;
+
+    SECTION("Determinism")
+    {
+        InputSequenceGenerator first(42), second(42);
+        REQUIRE(first.randomVector(size).isApprox(second.randomVector(size)));
+
+        InputSequenceGenerator other(1);
+        REQUIRE(!first.randomVector(size).isApprox(other.randomVector(size)));
+    }
+
+    SECTION("Random sequence")
+    {
+        InputSequenceGenerator generator;
+        const std::vector<Eigen::VectorXd> sequence = generator.randomSequence(10, size);
+        REQUIRE(sequence.size() == 10);
+        REQUIRE(sequence.front().size() == size);
+    }
+
+    SECTION("Sinusoidal sequence")
+    {
+        constexpr double amplitude = 2.0;
+        InputSequenceGenerator generator;
+        const std::vector<Eigen::VectorXd> sequence
+            = generator.sinusoidalSequence(100, size, amplitude, 1s, 10ms);
+
+        REQUIRE(sequence.size() == 100);
+        for (const auto& vector : sequence)
+        {
+            REQUIRE(vector.size() == size);
+            REQUIRE(vector.cwiseAbs().maxCoeff() <= amplitude);
+        }
+    }
+}
+
+TEST_CASE("RobotModelFixture")
+{
+    constexpr std::size_t numberOfJoints = 17;
+
+    auto kinDyn = createRandomKinDynComputations(numberOfJoints);
+    REQUIRE(kinDyn != nullptr);
+    REQUIRE(kinDyn->getNrOfDegreesOfFreedom() == numberOfJoints);
+    REQUIRE(kinDyn->getFrameVelocityRepresentation()
+            == iDynTree::FrameVelocityRepresentation::MIXED_REPRESENTATION);
+
+    // the fixture is deterministic
+    auto other = createRandomKinDynComputations(numberOfJoints);
+    REQUIRE(other != nullptr);
+
+    Eigen::VectorXd jointPositions(numberOfJoints), otherJointPositions(numberOfJoints);
+    REQUIRE(kinDyn->getJointPos(jointPositions));
+    REQUIRE(other->getJointPos(otherJointPositions));
+    REQUIRE(jointPositions.isApprox(otherJointPositions));
+}
+
+TEST_CASE("AllocationCounter")
+{
+    AllocationCounter counter;
+
+    SECTION("Allocation is counted")
+    {
+        auto* vector = new std::vector<double>(100);
+        REQUIRE(counter.numberOfAllocations() >= 1);
+        REQUIRE(counter.allocatedBytes() >= 100 * sizeof(double));
+
+        delete vector;
+        REQUIRE(counter.numberOfDeallocations() >= 1);
+    }
+
+    SECTION("Allocation-free section")
+    {
+        double accumulator = 0.0;
+        counter.reset();
+        for (int i = 0; i < 100; i++)
+        {
+            accumulator += i;
+        }
+        REQUIRE(counter.numberOfAllocations() == 0);
+        REQUIRE(accumulator > 0.0);
+    }
+}
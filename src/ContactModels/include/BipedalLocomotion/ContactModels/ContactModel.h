@@ -37,6 +37,8 @@ class ContactModel
                                             computed */
     bool m_isControlMatrixComputed; /**< If true the controllers matrix has been already computed */
 
+    bool m_isStiffnessMatrixComputed; /**< If true the stiffness matrix has been already computed */
+
     bool m_isRegressorComputed; /**< If true the regressor matrix has been already computed */
 
 protected:
@@ -51,6 +53,13 @@ protected:
      * \f$\dot{x} = f + g u\f$ the control matrix is \a g */
     iDynTree::Matrix6x6 m_controlMatrix;
 
+    /** Jacobian of the contact wrench with respect to a perturbation of the contact frame pose
+     * \f$(\delta p, \delta \theta)\f$, where the orientation is perturbed on the left, i.e. \f$R
+     * \leftarrow \exp(S(\delta \theta)) R\f$. Together with the control matrix, which coincides
+     * with the Jacobian of the wrench with respect to the twist, it provides the analytic state
+     * Jacobian required by implicit integrators */
+    iDynTree::Matrix6x6 m_stiffnessMatrix;
+
     /** Contains the regressor of the contact model. \f$f = A \theta\f$, where \f$f\f$ is the
      * contact wrench, \f$A\f$ the regressor and \f$\theta\f$ the parameters */
     iDynTree::MatrixDynSize m_regressor;
@@ -70,6 +79,12 @@ protected:
      */
     virtual void computeControlMatrix() = 0;
 
+    /**
+     * Evaluate the Jacobian of the contact wrench with respect to a perturbation of the contact
+     * frame pose
+     */
+    virtual void computeStiffnessMatrix() = 0;
+
     /**
      * Evaluate the regressor matrix
      */
@@ -127,6 +142,16 @@ public:
      */
     const iDynTree::Matrix6x6& getControlMatrix();
 
+    /**
+     * Get and compute (only if it is necessary) the Jacobian of the contact wrench with respect
+     * to a perturbation of the contact frame pose \f$(\delta p, \delta \theta)\f$, where the
+     * orientation is perturbed on the left, i.e. \f$R \leftarrow \exp(S(\delta \theta)) R\f$.
+     * @note the Jacobian of the wrench with respect to the twist coincides with the control
+     * matrix (see getControlMatrix()).
+     * @return the stiffness matrix at a given state
+     */
+    const iDynTree::Matrix6x6& getStiffnessMatrix();
+
     /**
      * Get and compute (only if it is necessary) the regressor
      * @return the regressor at a given state
@@ -8,6 +8,8 @@
 #ifndef BIPEDAL_LOCOMOTION_CONTACT_MODELS_CONTINUOUS_CONTACT_MODEL_H
 #define BIPEDAL_LOCOMOTION_CONTACT_MODELS_CONTINUOUS_CONTACT_MODEL_H
 
+#include <Eigen/Dense>
+
 #include <iDynTree/Core/Transform.h>
 #include <iDynTree/Core/Twist.h>
 #include <iDynTree/Core/Wrench.h>
@@ -56,6 +58,34 @@ class ContinuousContactModel final : public ContactModel
     double m_length{0.0}; /**< Length of the rectangular contact surface */
     double m_width{0.0}; /**< Width of the rectangular contact surface */
 
+    double m_area{0.0}; /**< Area of the rectangular contact surface */
+
+    /** Skew symmetric matrix associated to the first column of the contact frame rotation */
+    Eigen::Matrix3d m_skewRe1{Eigen::Matrix3d::Zero()};
+
+    /** Skew symmetric matrix associated to the second column of the contact frame rotation */
+    Eigen::Matrix3d m_skewRe2{Eigen::Matrix3d::Zero()};
+
+    /** Moment of the spring distribution over the patch, i.e. \f$ \frac{A}{12} (l^2 S(R e_1) R_0
+     * e_1 + w^2 S(R e_2) R_0 e_2) \f$. The spring coefficient is not embedded in the integral so
+     * that it can be reused by the regressor */
+    Eigen::Vector3d m_springMomentIntegral{Eigen::Vector3d::Zero()};
+
+    /** Moment of the damper distribution over the patch, i.e. \f$ \frac{A}{12} (l^2 S(R e_1)^2 +
+     * w^2 S(R e_2)^2) \f$. The damper coefficient is not embedded in the integral so that it can
+     * be reused by the regressor */
+    Eigen::Matrix3d m_damperMomentIntegral{Eigen::Matrix3d::Zero()};
+
+    /** True if the geometric integrals are consistent with the current frames */
+    bool m_areGeometricIntegralsValid{false};
+
+    /**
+     * Recompute the geometric integrals. The integrals depend only on the orientation of the
+     * contact frame and of the null force frame, hence they are recomputed only if one of the two
+     * frames rotated since the last evaluation.
+     */
+    void updateGeometricIntegrals();
+
     /**
      * Evaluate the contact wrench given a specific contact model
      */
@@ -71,6 +101,12 @@ class ContinuousContactModel final : public ContactModel
      */
     void computeControlMatrix() final;
 
+    /**
+     * Evaluate the Jacobian of the contact wrench with respect to a perturbation of the contact
+     * frame pose
+     */
+    void computeStiffnessMatrix() final;
+
     /**
      * Evaluate the regressor matrix
      */
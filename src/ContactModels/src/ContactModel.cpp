@@ -15,6 +15,7 @@ bool ContactModel::initialize(std::weak_ptr<ParametersHandler::IParametersHandle
     m_isContactWrenchComputed = false;
     m_isControlMatrixComputed = false;
     m_isAutonomousDynamicsComputed = false;
+    m_isStiffnessMatrixComputed = false;
     m_isRegressorComputed = false;
 
     return initializePrivate(handler);
@@ -26,6 +27,7 @@ void ContactModel::setNullForceTransform(const iDynTree::Transform& nullForceTra
     m_isContactWrenchComputed = false;
     m_isControlMatrixComputed = false;
     m_isAutonomousDynamicsComputed = false;
+    m_isStiffnessMatrixComputed = false;
     m_isRegressorComputed = false;
 
 
@@ -40,6 +42,7 @@ void ContactModel::setState(const iDynTree::Twist& twist,
     m_isContactWrenchComputed = false;
     m_isControlMatrixComputed = false;
     m_isAutonomousDynamicsComputed = false;
+    m_isStiffnessMatrixComputed = false;
     m_isRegressorComputed = false;
 
     setStatePrivate(twist, transform);
@@ -80,6 +83,17 @@ const iDynTree::Matrix6x6& ContactModel::getControlMatrix()
     return m_controlMatrix;
 }
 
+const iDynTree::Matrix6x6& ContactModel::getStiffnessMatrix()
+{
+    if (!m_isStiffnessMatrixComputed)
+    {
+        computeStiffnessMatrix();
+        m_isStiffnessMatrixComputed = true;
+    }
+
+    return m_stiffnessMatrix;
+}
+
 const iDynTree::MatrixDynSize& ContactModel::getRegressor()
 {
     if (!m_isRegressorComputed)
@@ -17,6 +17,7 @@ ContinuousContactModel::ContinuousContactModel()
 {
     m_controlMatrix.zero();
     m_autonomousDynamics.zero();
+    m_stiffnessMatrix.zero();
     m_regressor.resize(6, 2);
     m_regressor.zero();
 }
@@ -61,11 +62,24 @@ bool ContinuousContactModel::initializePrivate(std::weak_ptr<ParametersHandler::
                   << std::endl;
         return false;
     }
+
+    m_area = m_length * m_width;
+    m_areGeometricIntegralsValid = false;
+
     return true;
 }
 
 void ContinuousContactModel::setNullForceTransformPrivate(const iDynTree::Transform& transform)
 {
+    // the geometric integrals depend on the orientation of the null force frame: they stay valid
+    // as long as the frame does not rotate
+    if (!(iDynTree::toEigen(transform.getRotation()).array()
+          == iDynTree::toEigen(m_nullForceTransform.getRotation()).array())
+             .all())
+    {
+        m_areGeometricIntegralsValid = false;
+    }
+
     m_nullForceTransform = transform;
 }
 
@@ -73,12 +87,45 @@ void ContinuousContactModel::setStatePrivate(const iDynTree::Twist& twist,
                                              const iDynTree::Transform& transform)
 {
     m_twist = twist;
+
+    // the geometric integrals depend on the orientation of the contact frame: they stay valid as
+    // long as the frame does not rotate (e.g. when only the twist changes between two calls)
+    if (!(iDynTree::toEigen(transform.getRotation()).array()
+          == iDynTree::toEigen(m_frameTransform.getRotation()).array())
+             .all())
+    {
+        m_areGeometricIntegralsValid = false;
+    }
+
     m_frameTransform = transform;
 }
 
+void ContinuousContactModel::updateGeometricIntegrals()
+{
+    if (m_areGeometricIntegralsValid)
+        return;
+
+    auto rotation(iDynTree::toEigen(m_frameTransform.getRotation()));
+    auto nullForceRotation(iDynTree::toEigen(m_nullForceTransform.getRotation()));
+
+    m_skewRe1 = iDynTree::skew(rotation.col(0));
+    m_skewRe2 = iDynTree::skew(rotation.col(1));
+
+    m_springMomentIntegral
+        = m_area / 12
+          * (m_length * m_length * m_skewRe1 * nullForceRotation.col(0)
+             + m_width * m_width * m_skewRe2 * nullForceRotation.col(1));
+
+    m_damperMomentIntegral = m_area / 12
+                             * (m_length * m_length * m_skewRe1 * m_skewRe1
+                                + m_width * m_width * m_skewRe2 * m_skewRe2);
+
+    m_areGeometricIntegralsValid = true;
+}
+
 void ContinuousContactModel::computeContactWrench()
 {
-    double area = m_length * m_width;
+    this->updateGeometricIntegrals();
 
     auto force(iDynTree::toEigen(m_contactWrench.getLinearVec3()));
     auto torque(iDynTree::toEigen(m_contactWrench.getAngularVec3()));
@@ -90,26 +137,21 @@ void ContinuousContactModel::computeContactWrench()
     auto angularVelocity(iDynTree::toEigen(m_twist.getAngularVec3()));
 
     auto nullForcePosition(iDynTree::toEigen(m_nullForceTransform.getPosition()));
-    auto nullForceRotation(iDynTree::toEigen(m_nullForceTransform.getRotation()));
+
+    const double projection = std::abs(rotation(2, 2));
 
     // compute the force
-    force = std::abs(rotation(2, 2)) * area * (m_springCoeff * (nullForcePosition - position)
-                                               - m_damperCoeff * linearVelocity);
-
-    // compute the torque
-    auto skewRe1 = iDynTree::skew(rotation.col(0));
-    auto skewRe2 = iDynTree::skew(rotation.col(1));
-    torque = std::abs(rotation(2, 2)) * area / 12 * (m_length * m_length
-                                                     * (m_damperCoeff * skewRe1 * skewRe1 * angularVelocity
-                                                        + m_springCoeff * skewRe1 * nullForceRotation.col(0))
-                                                     + m_width * m_width
-                                                     * (m_damperCoeff * skewRe2 * skewRe2 * angularVelocity
-                                                        + m_springCoeff * skewRe2 * nullForceRotation.col(1)));
+    force = projection * m_area * (m_springCoeff * (nullForcePosition - position)
+                                   - m_damperCoeff * linearVelocity);
+
+    // compute the torque reusing the cached geometric integrals
+    torque = projection * (m_damperCoeff * m_damperMomentIntegral * angularVelocity
+                           + m_springCoeff * m_springMomentIntegral);
 }
 
 void ContinuousContactModel::computeAutonomousDynamics()
 {
-    double area = m_length * m_width;
+    this->updateGeometricIntegrals();
 
     auto autonomousDynamics(iDynTree::toEigen(m_autonomousDynamics));
 
@@ -124,33 +166,42 @@ void ContinuousContactModel::computeAutonomousDynamics()
 
     Eigen::Matrix3d rotationRateOfChange = iDynTree::skew(angularVelocity) * rotation;
 
-    autonomousDynamics.head(3) = area * (rotationRateOfChange(2,2)  * (m_springCoeff * (nullForcePosition - position)
-                                                                       - m_damperCoeff * linearVelocity)
-                                         - rotation(2,2) * m_springCoeff * linearVelocity);
+    autonomousDynamics.head(3) = m_area * (rotationRateOfChange(2,2)  * (m_springCoeff * (nullForcePosition - position)
+                                                                         - m_damperCoeff * linearVelocity)
+                                           - rotation(2,2) * m_springCoeff * linearVelocity);
 
-    auto skewRe1 = iDynTree::skew(rotation.col(0));
-    auto skewRe2 = iDynTree::skew(rotation.col(1));
-    auto skewDotRe1 = iDynTree::skew(rotationRateOfChange.col(0));
-    auto skewDotRe2 = iDynTree::skew(rotationRateOfChange.col(1));
+    const Eigen::Matrix3d skewDotRe1 = iDynTree::skew(rotationRateOfChange.col(0));
+    const Eigen::Matrix3d skewDotRe2 = iDynTree::skew(rotationRateOfChange.col(1));
 
     autonomousDynamics.tail(3)
-        = area / 12 * (rotationRateOfChange(2, 2) * (m_length * m_length * (m_damperCoeff * skewRe1 * skewRe1 * angularVelocity
-                                                                            + m_springCoeff * skewRe1 * nullForceRotation.col(0))
-                                                     + m_width * m_width * (m_damperCoeff * skewRe2 * skewRe2 * angularVelocity
-                                                                            + m_springCoeff * skewRe2 * nullForceRotation.col(1)))
-                       + rotation(2, 2) * (m_length * m_length * (m_springCoeff * skewDotRe1 * nullForceRotation.col(0)
-                                                                  + m_damperCoeff * (skewDotRe1 * skewRe1 + skewRe1 * skewDotRe1) * angularVelocity)
-                                           + (m_width * m_width * (m_springCoeff * skewDotRe2 * nullForceRotation.col(1)
-                                                                   + m_damperCoeff * (skewDotRe2 * skewRe2 + skewRe2 * skewDotRe2) * angularVelocity))));
-
+        = rotationRateOfChange(2, 2) * (m_damperCoeff * m_damperMomentIntegral * angularVelocity
+                                        + m_springCoeff * m_springMomentIntegral)
+          + rotation(2, 2) * m_area / 12
+                * (m_length * m_length * (m_springCoeff * skewDotRe1 * nullForceRotation.col(0)
+                                          + m_damperCoeff * (skewDotRe1 * m_skewRe1 + m_skewRe1 * skewDotRe1) * angularVelocity)
+                   + m_width * m_width * (m_springCoeff * skewDotRe2 * nullForceRotation.col(1)
+                                          + m_damperCoeff * (skewDotRe2 * m_skewRe2 + m_skewRe2 * skewDotRe2) * angularVelocity));
 }
 
 void ContinuousContactModel::computeControlMatrix()
 {
-    double area = m_length * m_width;
+    this->updateGeometricIntegrals();
 
     auto controlMatrix(iDynTree::toEigen(m_controlMatrix));
 
+    auto rotation(iDynTree::toEigen(m_frameTransform.getRotation()));
+
+    controlMatrix.topLeftCorner(3, 3).diagonal().array() = - m_area * m_damperCoeff * rotation(2,2);
+
+    controlMatrix.bottomRightCorner(3, 3) = rotation(2,2) * m_damperCoeff * m_damperMomentIntegral;
+}
+
+void ContinuousContactModel::computeStiffnessMatrix()
+{
+    this->updateGeometricIntegrals();
+
+    auto stiffnessMatrix(iDynTree::toEigen(m_stiffnessMatrix));
+
     auto position(iDynTree::toEigen(m_frameTransform.getPosition()));
     auto rotation(iDynTree::toEigen(m_frameTransform.getRotation()));
 
@@ -160,14 +211,46 @@ void ContinuousContactModel::computeControlMatrix()
     auto nullForcePosition(iDynTree::toEigen(m_nullForceTransform.getPosition()));
     auto nullForceRotation(iDynTree::toEigen(m_nullForceTransform.getRotation()));
 
-    Eigen::Matrix3d  rotationRateOfChange = iDynTree::skew(angularVelocity) * rotation;
-
-    controlMatrix.topLeftCorner(3, 3).diagonal().array() = - area * m_damperCoeff * rotation(2,2);
-
-    auto skewRe1 = iDynTree::skew(rotation.col(0));
-    auto skewRe2 = iDynTree::skew(rotation.col(1));
-    controlMatrix.bottomRightCorner(3, 3) = area / 12 * rotation(2,2) * m_damperCoeff *
-        (m_length * m_length *  skewRe1 * skewRe1 + m_width * m_width *  skewRe2 * skewRe2);
+    stiffnessMatrix.setZero();
+
+    // the force depends on the position of the contact frame through the spring term only. The
+    // torque does not depend on the position at all, so the bottom left block stays zero
+    stiffnessMatrix.topLeftCorner(3, 3).diagonal().array()
+        = -rotation(2, 2) * m_area * m_springCoeff;
+
+    // wrench stripped of the projection factor R(2,2)
+    const Eigen::Vector3d unprojectedForce
+        = m_area
+          * (m_springCoeff * (nullForcePosition - position) - m_damperCoeff * linearVelocity);
+    const Eigen::Vector3d unprojectedTorque
+        = m_damperCoeff * m_damperMomentIntegral * angularVelocity
+          + m_springCoeff * m_springMomentIntegral;
+
+    // the rotational blocks are built column by column evaluating the directional derivative
+    // along the elements of the basis. The derivation follows computeAutonomousDynamics with the
+    // angular velocity replaced by the orientation perturbation
+    for (int i = 0; i < 3; i++)
+    {
+        const Eigen::Matrix3d perturbedRotation
+            = iDynTree::skew(Eigen::Vector3d::Unit(i)) * rotation;
+
+        stiffnessMatrix.topRightCorner(3, 3).col(i) = perturbedRotation(2, 2) * unprojectedForce;
+
+        const Eigen::Matrix3d skewDotRe1 = iDynTree::skew(perturbedRotation.col(0));
+        const Eigen::Matrix3d skewDotRe2 = iDynTree::skew(perturbedRotation.col(1));
+
+        stiffnessMatrix.bottomRightCorner(3, 3).col(i)
+            = perturbedRotation(2, 2) * unprojectedTorque
+              + rotation(2, 2) * m_area / 12
+                    * (m_length * m_length
+                           * (m_springCoeff * skewDotRe1 * nullForceRotation.col(0)
+                              + m_damperCoeff * (skewDotRe1 * m_skewRe1 + m_skewRe1 * skewDotRe1)
+                                    * angularVelocity)
+                       + m_width * m_width
+                             * (m_springCoeff * skewDotRe2 * nullForceRotation.col(1)
+                                + m_damperCoeff * (skewDotRe2 * m_skewRe2 + m_skewRe2 * skewDotRe2)
+                                      * angularVelocity));
+    }
 }
 
 iDynTree::Force ContinuousContactModel::getForceAtPoint(const double& x, const double& y)
@@ -222,7 +305,8 @@ iDynTree::Torque ContinuousContactModel::getTorqueGeneratedAtPoint(const double&
 
 void ContinuousContactModel::computeRegressor()
 {
-    double area = m_length * m_width;
+    this->updateGeometricIntegrals();
+
     auto position(iDynTree::toEigen(m_frameTransform.getPosition()));
     auto rotation(iDynTree::toEigen(m_frameTransform.getRotation()));
 
@@ -230,27 +314,18 @@ void ContinuousContactModel::computeRegressor()
     auto angularVelocity(iDynTree::toEigen(m_twist.getAngularVec3()));
 
     auto nullForcePosition(iDynTree::toEigen(m_nullForceTransform.getPosition()));
-    auto nullForceRotation(iDynTree::toEigen(m_nullForceTransform.getRotation()));
-
-    auto skewRe1 = iDynTree::skew(rotation.col(0));
-    auto skewRe2 = iDynTree::skew(rotation.col(1));
 
     auto regressor(iDynTree::toEigen(m_regressor));
 
-    regressor.topLeftCorner<3, 1>()
-        = std::abs(rotation(2, 2)) * area * (nullForcePosition - position);
+    const double projection = std::abs(rotation(2, 2));
+
+    regressor.topLeftCorner<3, 1>() = projection * m_area * (nullForcePosition - position);
 
-    regressor.topRightCorner<3, 1>() = -std::abs(rotation(2, 2)) * area * linearVelocity;
+    regressor.topRightCorner<3, 1>() = -projection * m_area * linearVelocity;
 
-    regressor.bottomLeftCorner<3, 1>()
-        = area / 12.0 * std::abs(rotation(2, 2))
-          * (m_length * m_length * skewRe1 * nullForceRotation.col(0)
-             + m_width * m_width * skewRe2 * nullForceRotation.col(1));
+    regressor.bottomLeftCorner<3, 1>() = projection * m_springMomentIntegral;
 
-    regressor.bottomRightCorner<3, 1>()
-        = area / 12.0 * std::abs(rotation(2, 2))
-          * (m_length * m_length * skewRe1 * skewRe1 + m_width * m_width * skewRe2 * skewRe2)
-          * angularVelocity;
+    regressor.bottomRightCorner<3, 1>() = projection * m_damperMomentIntegral * angularVelocity;
 }
 
 const double& ContinuousContactModel::springCoeff() const
@@ -211,4 +211,99 @@ TEST_CASE("Continuous Contact")
         constexpr double tolerance = 1e-4;
         checkVectorAreEqual(contactWrenchRateNumerical, contactWrenchRate, tolerance);
     }
+
+    SECTION("Test stiffness matrix")
+    {
+        // copy the analytic Jacobian before perturbing the state
+        const Eigen::Matrix<double, 6, 6> analyticStiffness = toEigen(model.getStiffnessMatrix());
+
+        constexpr double numericalDerivStep = 1e-6;
+        Eigen::Matrix<double, 6, 6> numericalStiffness;
+
+        for (unsigned int i = 0; i < 6; i++)
+        {
+            Transform world_T_link_prev{world_T_link};
+            Transform world_T_link_next{world_T_link};
+
+            if (i < 3)
+            {
+                // position perturbation
+                Position prevPosition, nextPosition;
+                toEigen(prevPosition) = toEigen(world_T_link.getPosition());
+                toEigen(prevPosition)(i) -= numericalDerivStep;
+                toEigen(nextPosition) = toEigen(world_T_link.getPosition());
+                toEigen(nextPosition)(i) += numericalDerivStep;
+
+                world_T_link_prev.setPosition(prevPosition);
+                world_T_link_next.setPosition(nextPosition);
+            } else
+            {
+                // left orientation perturbation, i.e. R <- exp(skew(delta theta)) R
+                AngularMotionVector3 perturbation;
+                toEigen(perturbation).setZero();
+
+                toEigen(perturbation)(i - 3) = -numericalDerivStep;
+                world_T_link_prev.setRotation(perturbation.exp() * world_T_link.getRotation());
+
+                toEigen(perturbation)(i - 3) = numericalDerivStep;
+                world_T_link_next.setRotation(perturbation.exp() * world_T_link.getRotation());
+            }
+
+            model.setState(linkVelocity, world_T_link_prev);
+            model.setNullForceTransform(nullForceTransform);
+            const Wrench contactWrench_prev = model.getContactWrench();
+
+            model.setState(linkVelocity, world_T_link_next);
+            model.setNullForceTransform(nullForceTransform);
+            const Wrench contactWrench_next = model.getContactWrench();
+
+            numericalStiffness.col(i) = (toEigen(contactWrench_next) - toEigen(contactWrench_prev))
+                                        / (2 * numericalDerivStep);
+        }
+
+        constexpr double tolerance = 1e-4;
+        for (unsigned int i = 0; i < 6; i++)
+            checkVectorAreEqual(numericalStiffness.col(i), analyticStiffness.col(i), tolerance);
+    }
+
+    SECTION("Test cached geometric integrals")
+    {
+        // force the computation of the geometric integrals
+        model.getContactWrench();
+
+        // update the twist while keeping the contact frame fixed: the cached integrals are reused
+        // and the wrench must match the one of a freshly constructed model
+        Twist newVelocity{Twist::Zero()};
+        toEigen(newVelocity.getLinearVec3()).setRandom();
+        toEigen(newVelocity.getAngularVec3()).setRandom();
+
+        model.setState(newVelocity, world_T_link);
+        model.setNullForceTransform(nullForceTransform);
+
+        ContinuousContactModel freshModel;
+        REQUIRE(freshModel.initialize(handler));
+        freshModel.setState(newVelocity, world_T_link);
+        freshModel.setNullForceTransform(nullForceTransform);
+
+        checkVectorAreEqual(model.getContactWrench().getLinearVec3(),
+                            freshModel.getContactWrench().getLinearVec3());
+        checkVectorAreEqual(model.getContactWrench().getAngularVec3(),
+                            freshModel.getContactWrench().getAngularVec3());
+
+        // rotate the contact frame: the integrals must be recomputed
+        Transform world_T_link_new{world_T_link};
+        world_T_link_new.setRotation(Rotation::RPY(0.05, -0.1, 0.3));
+
+        model.setState(newVelocity, world_T_link_new);
+
+        ContinuousContactModel otherFreshModel;
+        REQUIRE(otherFreshModel.initialize(handler));
+        otherFreshModel.setState(newVelocity, world_T_link_new);
+        otherFreshModel.setNullForceTransform(nullForceTransform);
+
+        checkVectorAreEqual(model.getContactWrench().getLinearVec3(),
+                            otherFreshModel.getContactWrench().getLinearVec3());
+        checkVectorAreEqual(model.getContactWrench().getAngularVec3(),
+                            otherFreshModel.getContactWrench().getAngularVec3());
+    }
 }
@@ -14,7 +14,10 @@
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace BipedalLocomotion
 {
@@ -67,13 +70,49 @@ namespace Contacts
  */
 class FixedFootDetector : public ContactDetector
 {
-    ContactPhaseList m_contactPhaselist; /**< List of the contacts */
+    /**
+     * Update applied to a contact state during a phase of the fixed foot schedule.
+     */
+    struct ContactUpdate
+    {
+        std::string name; /**< Name of the contact */
+        bool isActive{false}; /**< True if the contact is fixed during the phase */
+        bool updatePose{false}; /**< True if the pose has to be copied in the contact state */
+        manif::SE3d pose; /**< Pose of the contact */
+    };
+
+    /**
+     * Entry of the fixed foot schedule. Each entry is associated to a phase of the contact
+     * phase list.
+     */
+    struct FixedFootPhase
+    {
+        std::chrono::nanoseconds beginTime; /**< Begin time of the phase */
+        bool updatesContacts{false}; /**< False for the double support phases that keep the
+                                         contact states of the previous single support phase */
+        std::vector<ContactUpdate> updates; /**< Updates applied to the contact states */
+    };
+
+    std::vector<FixedFootPhase> m_schedule; /**< Fixed foot schedule precomputed by
+                                                setContactPhaseList, one entry per phase */
+    std::size_t m_scheduleCursor{0}; /**< Index of the schedule entry associated to the current
+                                         time. Since the time grows monotonically, advance moves
+                                         the cursor forward instead of searching the phase */
+    std::size_t m_phaseListGeneration{0}; /**< Generation stamp of the phase list used to build
+                                              the schedule. 0 means that no list has been set */
     std::chrono::nanoseconds m_currentTime{std::chrono::nanoseconds::zero()}; /**< Current time in
                                                                                  seconds */
     std::chrono::nanoseconds m_dT{std::chrono::nanoseconds::zero()}; /**< Fixed sampling time in
                                                                         seconds */
     EstimatedContact m_dummyContact; /**< A dummy esitmated contact */
 
+    /**
+     * Precompute the fixed foot schedule associated to a phase list.
+     * @param phaseList a contact phase list.
+     * @return true in case of success/false otherwise.
+     */
+    bool buildFixedFootSchedule(const ContactPhaseList& phaseList);
+
     /**
      * Update the fixed foot.
      * @return true in case of success/false otherwise.
@@ -102,6 +141,9 @@ public:
     /**
      * Set the contact phase list
      * @param phaseList a contact phase list
+     * @note The fixed foot schedule is precomputed by this function, so advance only moves a
+     * cursor through the phase boundaries. If the generation stamp of phaseList matches the one
+     * of the list already stored, the schedule is not rebuilt.
      */
     void setContactPhaseList(const ContactPhaseList& phaseList);
 
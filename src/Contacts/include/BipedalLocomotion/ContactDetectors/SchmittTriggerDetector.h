@@ -8,7 +8,11 @@
 #ifndef BIPEDAL_LOCOMOTION_CONTACT_DETECTORS_SCHMITT_TRIGGER_DETECTOR_H
 #define BIPEDAL_LOCOMOTION_CONTACT_DETECTORS_SCHMITT_TRIGGER_DETECTOR_H
 
+#include <chrono>
+#include <cstddef>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <BipedalLocomotion/ContactDetectors/ContactDetector.h>
 #include <BipedalLocomotion/Math/SchmittTrigger.h>
@@ -26,6 +30,18 @@ class SchmittTriggerDetector : public ContactDetector
 {
 public:
 
+    /**
+     * Describes a contact state switch detected by one of the Schmitt trigger units.
+     */
+    struct ContactTransition
+    {
+        std::string name; /**< Name of the contact */
+        bool isActive{false}; /**< Contact state after the transition */
+        std::chrono::nanoseconds switchTime{std::chrono::nanoseconds::zero()}; /**< Time instant
+                                                                                    of the
+                                                                                    transition */
+    };
+
     /**
      * Constructor.
      * It is required by the pimpl idiom.
@@ -49,6 +65,10 @@ public:
     * |  `contact_break_thresholds`  | `vector<double>` | Vector containing Low-value thresholds to initiate an ON state switch after switchOnAfter time-units. For each contact specified in `contacts`  the user needs to specify an element of the vector. |    Yes    |
     * |  `contact_make_switch_times` | `vector<double>` |           Time units to wait for before switching to `contact` state from `no-contact` state. For each contact specified in `contacts` the user needs to specify an element of the vector.          |    Yes    |
     * | `contact_break_switch_times` | `vector<double>` |          Time units to wait for before switching to `no-contact`  state from `contact`  state. For each contact specified in `contacts` the user needs to specify an element of the vector.         |    Yes    |
+    * @note The following parameters are optional
+    * |        Parameter Name        |       Type       |                                                  Description                                                  | Mandatory |
+    * |:----------------------------:|:----------------:|:-------------------------------------------------------------------------------------------------------------:|:---------:|
+    * |`transition_history_capacity` |      `int`       | Maximum number of recent contact transitions stored in the internal ring buffer (default 32). |    No     |
     * @return True in case of success, false otherwise.
     */
     bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler) override;
@@ -62,6 +82,42 @@ public:
     bool setTimedTriggerInput(const std::string& contactName, //
                               const Math::SchmittTriggerInput& input);
 
+    /**
+     * Set trigger input and time stamp for an existing SchmittTrigger unit given its slot.
+     * Combined with getContactSlot(), this avoids hashing the contact name at every sample.
+     * @param[in] slot slot of the contact returned by getContactSlot()
+     * @param[in] input the input of the trigger containing the contact force and the time instant
+     * @return True in case of success, false otherwise.
+     */
+    bool setTimedTriggerInput(const std::size_t slot, //
+                              const Math::SchmittTriggerInput& input);
+
+    /**
+     * Get the slot associated to a contact in the internal flat storage.
+     * The slot remains valid until the set of contacts is modified with addContact() or
+     * removeContact().
+     * @param[in] contactName name of the contact
+     * @return the slot of the contact, -1 if the contact does not exist.
+     */
+    std::ptrdiff_t getContactSlot(const std::string& contactName) const;
+
+    /**
+     * Get the most recent contact transition of a given contact.
+     * The transitions are stored in a fixed-capacity ring buffer, so only the last
+     * `transition_history_capacity` state switches can be retrieved.
+     * @param[in] contactName name of the contact
+     * @param[out] transition latest transition of the contact
+     * @return True if a transition of the contact is available in the buffer, false otherwise.
+     */
+    bool getLatestTransition(const std::string& contactName, ContactTransition& transition) const;
+
+    /**
+     * Get the recent contact transitions, from the oldest to the newest.
+     * @param[out] transitions container filled with the buffered transitions
+     * @return the number of retrieved transitions.
+     */
+    std::size_t getRecentTransitions(std::vector<ContactTransition>& transitions) const;
+
     /**
      * Set trigger input and time stamp for existing units
      * @param[in] timedInputs container of timed trigger inputs, pair(first, second): (time, force)
@@ -8,7 +8,9 @@
 #ifndef BIPEDAL_LOCOMOTION_CONTACTS_CONTACT_H
 #define BIPEDAL_LOCOMOTION_CONTACTS_CONTACT_H
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <ratio>
 #include <string>
 #include <vector>
@@ -145,13 +147,114 @@ struct Corner
     Eigen::Vector3d force; /**< Pure force applied to the contact corner. */
 };
 
+/**
+ * @brief Fixed-capacity container of Corner objects.
+ * The corners are stored inline, so copying a contact (e.g. when a planner clones a contact list at
+ * every re-plan) does not allocate memory. The class exposes the subset of the std::vector
+ * interface used by the framework, hence it can be treated as a drop-in replacement. The number of
+ * corners is bounded by CornerArray::MaxCorners: in practice a contact surface is described by at
+ * most 8 corners.
+ */
+class CornerArray
+{
+public:
+    static constexpr std::size_t MaxCorners = 8; /**< Maximum number of corners. */
+
+    /**
+     * Matrix collecting one scalar component per corner in each column. The storage is column
+     * major, so the x, y and z components of all the corners are contiguous in memory and the
+     * per-corner loops can be vectorized.
+     */
+    using SoAMatrix = Eigen::Matrix<double, Eigen::Dynamic, 3, Eigen::ColMajor, MaxCorners, 3>;
+
+    using iterator = std::array<Corner, MaxCorners>::iterator;
+    using const_iterator = std::array<Corner, MaxCorners>::const_iterator;
+
+    /**
+     * Resize the container.
+     * @param size the desired number of corners.
+     * @return true in case of success, false if the requested size exceeds MaxCorners. In the
+     * latter case an error is printed and the container is left unchanged.
+     */
+    bool resize(std::size_t size);
+
+    /**
+     * Append a corner.
+     * @param corner the corner to append.
+     * @return true in case of success, false if the container is full. In the latter case an error
+     * is printed and the corner is discarded.
+     */
+    bool push_back(const Corner& corner);
+
+    /**
+     * Get the positions of the corners in SoA form.
+     * @return a matrix whose i-th row contains the position of the i-th corner.
+     */
+    SoAMatrix positions() const;
+
+    /**
+     * Get the forces applied to the corners in SoA form.
+     * @return a matrix whose i-th row contains the force applied to the i-th corner.
+     */
+    SoAMatrix forces() const;
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    void clear()
+    {
+        m_size = 0;
+    }
+
+    Corner& operator[](std::size_t index)
+    {
+        return m_corners[index];
+    }
+
+    const Corner& operator[](std::size_t index) const
+    {
+        return m_corners[index];
+    }
+
+    iterator begin()
+    {
+        return m_corners.begin();
+    }
+
+    const_iterator begin() const
+    {
+        return m_corners.begin();
+    }
+
+    iterator end()
+    {
+        return m_corners.begin() + m_size;
+    }
+
+    const_iterator end() const
+    {
+        return m_corners.begin() + m_size;
+    }
+
+private:
+    std::array<Corner, MaxCorners> m_corners; /**< Inline storage of the corners. */
+    std::size_t m_size{0}; /**< Number of corners actually stored. */
+};
+
 /**
  * @brief DiscreteGeometryContact is a contact which is represented by a set of corners that
  * exchanges a pure force whith the enviroment.
  */
 struct DiscreteGeometryContact : public ContactBase
 {
-    std::vector<Corner> corners; /**< List of corners associated to the Contact. */
+    CornerArray corners; /**< List of corners associated to the Contact. */
 };
 
 } // namespace Contacts
@@ -16,6 +16,7 @@
 // std
 #include <chrono>
 #include <functional>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -45,12 +46,49 @@ class ContactList
     std::set<BipedalLocomotion::Contacts::PlannedContact, ContactCompare> m_contacts; /** Data
                                                      structure for inserting and ordering
                                                      contacts. **/
+    mutable std::set<BipedalLocomotion::Contacts::PlannedContact, ContactCompare>::const_iterator
+        m_presentContactHint; /** Contact returned by the last getPresentContact() query. It is
+                                  checked first so that queries at monotonically increasing times
+                                  cost amortized O(1). **/
+    mutable bool m_presentContactHintValid{false}; /** True if m_presentContactHint can be used.
+                                                       Any modification of the list invalidates
+                                                       the hint. **/
+    mutable std::mutex m_presentContactHintMutex; /** Mutex protecting the cached hint, so that
+                                                      concurrent const getPresentContact() queries
+                                                      on a shared list remain safe. **/
     std::string m_defaultName{"ContactList"}; /** Default name for the contact list. **/
     BipedalLocomotion::Contacts::ContactType m_defaultContactType{
         BipedalLocomotion::Contacts::ContactType::FULL}; /** Default contact type. **/
     int m_defaultIndex{-1}; /**< Default Frame index of the contact */
 
 public:
+    ContactList() = default;
+
+    /**
+     * @brief Copy constructor.
+     * The cached hint used by getPresentContact() is an iterator into the source list, hence it is
+     * not copied and the copy starts with an invalid hint.
+     */
+    ContactList(const ContactList& other);
+
+    /**
+     * @brief Move constructor.
+     * The cached hint used by getPresentContact() is invalidated.
+     */
+    ContactList(ContactList&& other) noexcept;
+
+    /**
+     * @brief Copy assignment operator.
+     * The cached hint used by getPresentContact() is invalidated.
+     */
+    ContactList& operator=(const ContactList& other);
+
+    /**
+     * @brief Move assignment operator.
+     * The cached hint used by getPresentContact() is invalidated.
+     */
+    ContactList& operator=(ContactList&& other) noexcept;
+
     using const_iterator
         = std::set<BipedalLocomotion::Contacts::PlannedContact, ContactCompare>::const_iterator;
     using const_reverse_iterator = std::set<BipedalLocomotion::Contacts::PlannedContact,
@@ -216,6 +254,11 @@ public:
      * @param time The present time.
      * @return an iterator to the last contact  having an activation time lower than time.
      * If no contact satisfy this condition, it returns a pointer to the end.
+     * @note The lookup costs O(log n). The result of the previous query is cached, so a series
+     * of queries at monotonically increasing times costs amortized O(1). The cache is protected
+     * by a mutex, hence concurrent const queries on a shared list are safe. As for any standard
+     * container, concurrent access while another thread modifies the list still requires
+     * external synchronization.
      */
     const_iterator getPresentContact(const std::chrono::nanoseconds& time) const;
 
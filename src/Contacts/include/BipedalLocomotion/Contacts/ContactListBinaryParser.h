@@ -0,0 +1,68 @@
+/**
+ * @file ContactListBinaryParser.h
+ * @authors Giulio Romualdi
+ * @copyright 2025 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_CONTACTS_CONTACTLIST_BINARY_PARSER_H
+#define BIPEDAL_LOCOMOTION_CONTACTS_CONTACTLIST_BINARY_PARSER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// BipedalLocomotion
+#include <BipedalLocomotion/Contacts/ContactList.h>
+
+namespace BipedalLocomotion
+{
+namespace Contacts
+{
+
+/**
+ * Store a ContactListMap in a compact binary buffer.
+ * The buffer starts with a magic number and a format version, followed by the contact lists
+ * serialized as fixed-layout records. The times are stored as nanoseconds integers, so the
+ * encoding is exact and the round trip is lossless. A single allocation is performed to build the
+ * buffer, making the format suitable to ship contact plans over the network at every re-plan. The
+ * JSON format implemented in ContactListJsonParser.h remains available for debugging.
+ * @param map a ContactListMap containing the list of the contacts.
+ * @param buffer the buffer where the serialized map is stored. The content of the buffer is
+ * overwritten.
+ * @return return true in case of success, false otherwise.
+ * @warning The format does not perform any endianness conversion, consequently the producer and
+ * the consumer must share the same endianness.
+ */
+bool contactListMapToBinary(const ContactListMap& map, std::vector<std::uint8_t>& buffer);
+
+/**
+ * Store a ContactListMap to a binary file.
+ * @param map a ContactListMap containing the list of the contacts.
+ * @param filename the name of the file where the map should be stored.
+ * @return return true in case of success, false otherwise.
+ * @note The function generates a file readable by
+ * contactListMapFromBinaryFile(const std::string&).
+ */
+bool contactListMapToBinaryFile(const ContactListMap& map, const std::string& filename);
+
+/**
+ * Parse a ContactListMap from a binary buffer generated by contactListMapToBinary().
+ * @param buffer the buffer containing the serialized map.
+ * @return return a ContactListMap containing all the contacts. An empty map is returned if the
+ * buffer is malformed or if the format version is not supported.
+ */
+ContactListMap contactListMapFromBinary(const std::vector<std::uint8_t>& buffer);
+
+/**
+ * Parse a ContactListMap from a binary file generated by contactListMapToBinaryFile().
+ * @param filename the name of the file that should be loaded.
+ * @return return a ContactListMap containing all the contacts. An empty map is returned in case
+ * of failure.
+ */
+ContactListMap contactListMapFromBinaryFile(const std::string& filename);
+
+} // namespace Contacts
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_CONTACTS_CONTACTLIST_BINARY_PARSER_H
@@ -12,6 +12,8 @@
 #include <BipedalLocomotion/Contacts/ContactList.h>
 #include <BipedalLocomotion/Contacts/ContactPhase.h>
 
+#include <atomic>
+#include <cstddef>
 #include <initializer_list>
 #include <vector>
 
@@ -31,6 +33,15 @@ class ContactPhaseList
 
     std::vector<ContactPhase> m_phases; /** The computed phases. **/
 
+    mutable std::atomic<std::size_t> m_presentPhaseHint{0}; /** Index of the phase returned by
+                                                   the last getPresentPhase() query. It is
+                                                   checked first so that queries at
+                                                   monotonically increasing times cost amortized
+                                                   O(1). It is atomic so that concurrent const
+                                                   queries on a shared list remain safe. **/
+
+    std::size_t m_generation{0}; /** Stamp renewed every time the phases are rebuilt. **/
+
     void createPhases(); /** Internal method to compute the phases. **/
 
 public:
@@ -113,9 +124,25 @@ public:
      * @param time The present time.
      * @return an iterator to the last phase having an activation time lower than time.
      * If no phase satisfies this condition, it returns a pointer to the end.
+     * @note The lookup costs O(log n). The result of the previous query is cached, so a series
+     * of queries at monotonically increasing times costs amortized O(1). The cached hint is an
+     * atomic index, hence concurrent const queries on a shared list are safe. As for any
+     * standard container, concurrent access while another thread modifies the list still
+     * requires external synchronization.
      */
     const_iterator getPresentPhase(const std::chrono::nanoseconds& time) const;
 
+    /**
+     * @brief Get the generation stamp of the stored phases.
+     *
+     * The stamp is unique across all the instances of the class and it is renewed every time
+     * the phases are rebuilt. Two calls returning the same value guarantee that the phases did
+     * not change in between, so a consumer can cache data derived from the list and rebuild it
+     * only when the generation changes.
+     * @return the generation stamp. The value 0 is reserved and never returned.
+     */
+    std::size_t generation() const;
+
     /**
      * @brief A reference to the lists stored in this class.
      * @warning All the iterators stored inside the contact phases refer to the lists viewable via this method.
@@ -8,9 +8,66 @@
 #include <chrono>
 
 #include <BipedalLocomotion/Contacts/Contact.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
 
 using namespace BipedalLocomotion::Contacts;
 
+bool CornerArray::resize(std::size_t size)
+{
+    constexpr auto logPrefix = "[CornerArray::resize]";
+
+    if (size > MaxCorners)
+    {
+        BipedalLocomotion::log()->error("{} The requested size {} exceeds the maximum number of "
+                                        "corners {}.",
+                                        logPrefix,
+                                        size,
+                                        MaxCorners);
+        return false;
+    }
+
+    m_size = size;
+    return true;
+}
+
+bool CornerArray::push_back(const Corner& corner)
+{
+    constexpr auto logPrefix = "[CornerArray::push_back]";
+
+    if (m_size == MaxCorners)
+    {
+        BipedalLocomotion::log()->error("{} The container already stores the maximum number of "
+                                        "corners {}. The corner is discarded.",
+                                        logPrefix,
+                                        MaxCorners);
+        return false;
+    }
+
+    m_corners[m_size] = corner;
+    m_size++;
+    return true;
+}
+
+CornerArray::SoAMatrix CornerArray::positions() const
+{
+    SoAMatrix positions(m_size, 3);
+    for (std::size_t i = 0; i < m_size; i++)
+    {
+        positions.row(i) = m_corners[i].position.transpose();
+    }
+    return positions;
+}
+
+CornerArray::SoAMatrix CornerArray::forces() const
+{
+    SoAMatrix forces(m_size, 3);
+    for (std::size_t i = 0; i < m_size; i++)
+    {
+        forces.row(i) = m_corners[i].force.transpose();
+    }
+    return forces;
+}
+
 bool PlannedContact::operator==(const PlannedContact& other) const
 {
     bool eq = true;
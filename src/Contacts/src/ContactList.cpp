@@ -10,6 +10,7 @@
 
 #include <iterator>
 #include <cassert>
+#include <utility>
 
 using namespace BipedalLocomotion::Contacts;
 
@@ -18,6 +19,46 @@ bool ContactList::ContactCompare::operator()(const PlannedContact &lhs, const Pl
     return lhs.deactivationTime < rhs.activationTime;
 }
 
+ContactList::ContactList(const ContactList& other)
+    : m_contacts(other.m_contacts)
+    , m_defaultName(other.m_defaultName)
+    , m_defaultContactType(other.m_defaultContactType)
+    , m_defaultIndex(other.m_defaultIndex)
+{
+    // m_presentContactHint is an iterator into other.m_contacts, hence it is not copied and the
+    // hint starts invalid
+}
+
+ContactList::ContactList(ContactList&& other) noexcept
+    : m_contacts(std::move(other.m_contacts))
+    , m_defaultName(std::move(other.m_defaultName))
+    , m_defaultContactType(other.m_defaultContactType)
+    , m_defaultIndex(other.m_defaultIndex)
+{
+    other.m_presentContactHintValid = false;
+}
+
+ContactList& ContactList::operator=(const ContactList& other)
+{
+    m_contacts = other.m_contacts;
+    m_defaultName = other.m_defaultName;
+    m_defaultContactType = other.m_defaultContactType;
+    m_defaultIndex = other.m_defaultIndex;
+    m_presentContactHintValid = false;
+    return *this;
+}
+
+ContactList& ContactList::operator=(ContactList&& other) noexcept
+{
+    m_contacts = std::move(other.m_contacts);
+    m_defaultName = std::move(other.m_defaultName);
+    m_defaultContactType = other.m_defaultContactType;
+    m_defaultIndex = other.m_defaultIndex;
+    m_presentContactHintValid = false;
+    other.m_presentContactHintValid = false;
+    return *this;
+}
+
 void ContactList::setDefaultName(const std::string &defaultName)
 {
     m_defaultName = defaultName;
@@ -76,6 +117,8 @@ bool ContactList::addContact(const PlannedContact &newContact)
         }
         return false;
     }
+
+    m_presentContactHintValid = false;
     return true;
 }
 
@@ -96,6 +139,7 @@ bool ContactList::addContact(const manif::SE3d& newTransform,
 
 ContactList::const_iterator ContactList::erase(const_iterator iterator)
 {
+    m_presentContactHintValid = false;
     return m_contacts.erase(iterator);
 }
 
@@ -206,6 +250,7 @@ bool ContactList::editContact(ContactList::const_iterator element, const Planned
 
     m_contacts.erase(element);
     m_contacts.insert(nextElement, newContact);
+    m_presentContactHintValid = false;
 
     return true;
 }
@@ -213,22 +258,57 @@ bool ContactList::editContact(ContactList::const_iterator element, const Planned
 ContactList::const_iterator
 ContactList::getPresentContact(const std::chrono::nanoseconds& time) const
 {
-    // With the reverse iterator we find the last step such that the activation time is smaller
-    // equal than time
-    ContactList::const_reverse_iterator presentReverse
-        = std::find_if(rbegin(), rend(), [time](const PlannedContact& a) -> bool {
-              return a.activationTime <= time;
-          });
-
-    if (presentReverse == rend())
+    // a contact is the present one if its activation time is lower equal than time and the
+    // following contact (if any) has not been activated yet
+    auto isPresent = [this, time](const_iterator contact) -> bool {
+        if (contact->activationTime > time)
+        {
+            return false;
+        }
+        const_iterator next = std::next(contact);
+        return next == end() || next->activationTime > time;
+    };
+
+    // The hint is also updated by const queries: the lock keeps concurrent read-only calls on a
+    // shared list safe (e.g. a planner publishing a list consumed by detector and controller
+    // threads)
+    std::lock_guard<std::mutex> lock(m_presentContactHintMutex);
+
+    // Check the cached hint first. Queries at monotonically increasing times (the common
+    // access pattern of the controllers) fall either in the contact returned by the previous
+    // call or in the following one, making the lookup amortized O(1)
+    if (m_presentContactHintValid)
+    {
+        if (isPresent(m_presentContactHint))
+        {
+            return m_presentContactHint;
+        }
+
+        const_iterator next = std::next(m_presentContactHint);
+        if (next != end() && isPresent(next))
+        {
+            m_presentContactHint = next;
+            return m_presentContactHint;
+        }
+    }
+
+    // Binary search. Since the contacts are not overlapping, the comparator used by the set
+    // orders them in time: upper_bound on a zero-length interval placed at time returns the
+    // first contact whose activation time is greater than time
+    PlannedContact sentinel;
+    sentinel.activationTime = time;
+    sentinel.deactivationTime = time;
+    const_iterator upper = m_contacts.upper_bound(sentinel);
+
+    if (upper == begin())
     {
         // No contact has activation time lower than the specified time.
         return end();
     }
 
-    return --(presentReverse.base()); // This is to convert a reverse iterator to a forward
-                                      // iterator. The -- is because base() returns a forward
-                                      // iterator to the next element.
+    m_presentContactHint = std::prev(upper);
+    m_presentContactHintValid = true;
+    return m_presentContactHint;
 }
 
 bool ContactList::keepOnlyPresentContact(const std::chrono::nanoseconds& time)
@@ -253,6 +333,7 @@ bool ContactList::keepOnlyPresentContact(const std::chrono::nanoseconds& time)
 void ContactList::clear()
 {
     m_contacts.clear();
+    m_presentContactHintValid = false;
 }
 
 void ContactList::removeLastContact()
@@ -0,0 +1,267 @@
+/**
+ * @file ContactListBinaryParser.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2025 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <Eigen/Dense>
+
+#include <manif/SE3.h>
+
+// BipedalLocomotion
+#include <BipedalLocomotion/Contacts/ContactList.h>
+#include <BipedalLocomotion/Contacts/ContactListBinaryParser.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace BipedalLocomotion
+{
+namespace Contacts
+{
+
+namespace
+{
+
+constexpr std::uint32_t binaryFormatMagicNumber = 0x43464C42; // the string "BLFC"
+constexpr std::uint16_t binaryFormatVersion = 1;
+
+/**
+ * Fixed-layout record describing the plain-old-data part of a PlannedContact. The name of the
+ * contact is stored separately since its length is not fixed.
+ */
+struct ContactRecord
+{
+    double position[3]; /**< Translation of the contact pose */
+    double quaternion[4]; /**< Quaternion of the contact pose. Same order of
+                             Eigen::Quaterniond::coeffs(), i.e. x y z w */
+    std::int64_t activationTime; /**< Activation time in nanoseconds */
+    std::int64_t deactivationTime; /**< Deactivation time in nanoseconds */
+    std::int32_t index; /**< Frame index of the contact */
+    std::int32_t type; /**< Type of the contact stored as integer */
+};
+
+static_assert(sizeof(ContactRecord)
+                  == 7 * sizeof(double) + 2 * sizeof(std::int64_t) + 2 * sizeof(std::int32_t),
+              "The ContactRecord must not contain padding.");
+
+} // namespace
+
+bool contactListMapToBinary(const ContactListMap& map, std::vector<std::uint8_t>& buffer)
+{
+    // compute the size of the buffer to perform a single allocation
+    std::size_t bufferSize = sizeof(binaryFormatMagicNumber) + sizeof(binaryFormatVersion)
+                             + sizeof(std::uint32_t);
+    for (const auto& [key, contacts] : map)
+    {
+        bufferSize += sizeof(std::uint32_t) + key.size() + sizeof(std::uint32_t);
+        for (const auto& contact : contacts)
+        {
+            bufferSize += sizeof(ContactRecord) + sizeof(std::uint32_t) + contact.name.size();
+        }
+    }
+
+    buffer.clear();
+    buffer.reserve(bufferSize);
+
+    auto append = [&buffer](const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+
+    auto appendString = [&append](const std::string& string) {
+        const std::uint32_t size = string.size();
+        append(&size, sizeof(size));
+        append(string.data(), string.size());
+    };
+
+    append(&binaryFormatMagicNumber, sizeof(binaryFormatMagicNumber));
+    append(&binaryFormatVersion, sizeof(binaryFormatVersion));
+
+    const std::uint32_t numberOfLists = map.size();
+    append(&numberOfLists, sizeof(numberOfLists));
+
+    ContactRecord record;
+    for (const auto& [key, contacts] : map)
+    {
+        appendString(key);
+
+        const std::uint32_t numberOfContacts = contacts.size();
+        append(&numberOfContacts, sizeof(numberOfContacts));
+
+        for (const auto& contact : contacts)
+        {
+            Eigen::Map<Eigen::Vector3d>(record.position) = contact.pose.translation();
+            Eigen::Map<Eigen::Vector4d>(record.quaternion) = contact.pose.quat().coeffs();
+            record.activationTime = contact.activationTime.count();
+            record.deactivationTime = contact.deactivationTime.count();
+            record.index = contact.index;
+            record.type = static_cast<std::int32_t>(contact.type);
+
+            append(&record, sizeof(record));
+            appendString(contact.name);
+        }
+    }
+
+    return true;
+}
+
+bool contactListMapToBinaryFile(const ContactListMap& map, const std::string& filename)
+{
+    constexpr auto logPrefix = "[contactListMapToBinaryFile]";
+
+    // open the file
+    std::ofstream outStream(filename, std::ios::binary);
+
+    if (!outStream.is_open())
+    {
+        log()->error("{} Failed to open {}.", logPrefix, filename);
+        return false;
+    }
+
+    std::vector<std::uint8_t> buffer;
+    if (!contactListMapToBinary(map, buffer))
+    {
+        return false;
+    }
+
+    outStream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+    // close the stream
+    outStream.close();
+
+    return true;
+}
+
+ContactListMap contactListMapFromBinary(const std::vector<std::uint8_t>& buffer)
+{
+    constexpr auto logPrefix = "[contactListMapFromBinary]";
+
+    ContactListMap map;
+
+    std::size_t offset = 0;
+    auto read = [&buffer, &offset](void* data, std::size_t size) -> bool {
+        if (offset + size > buffer.size())
+        {
+            return false;
+        }
+        std::memcpy(data, buffer.data() + offset, size);
+        offset += size;
+        return true;
+    };
+
+    auto readString = [&buffer, &offset, &read](std::string& string) -> bool {
+        std::uint32_t size;
+        if (!read(&size, sizeof(size)) || offset + size > buffer.size())
+        {
+            return false;
+        }
+        string.assign(reinterpret_cast<const char*>(buffer.data()) + offset, size);
+        offset += size;
+        return true;
+    };
+
+    std::uint32_t magicNumber;
+    std::uint16_t version;
+    if (!read(&magicNumber, sizeof(magicNumber)) || magicNumber != binaryFormatMagicNumber)
+    {
+        log()->error("{} The buffer does not contain a serialized ContactListMap. An empty map "
+                     "will be returned.",
+                     logPrefix);
+        return ContactListMap();
+    }
+
+    if (!read(&version, sizeof(version)) || version != binaryFormatVersion)
+    {
+        log()->error("{} Unsupported format version. Supported version: {}. An empty map will be "
+                     "returned.",
+                     logPrefix,
+                     binaryFormatVersion);
+        return ContactListMap();
+    }
+
+    std::uint32_t numberOfLists;
+    if (!read(&numberOfLists, sizeof(numberOfLists)))
+    {
+        log()->error("{} Unable to read the number of contact lists. An empty map will be "
+                     "returned.",
+                     logPrefix);
+        return ContactListMap();
+    }
+
+    std::string key;
+    PlannedContact tempContact;
+    ContactRecord record;
+    for (std::uint32_t list = 0; list < numberOfLists; list++)
+    {
+        std::uint32_t numberOfContacts;
+        if (!readString(key) || !read(&numberOfContacts, sizeof(numberOfContacts)))
+        {
+            log()->error("{} The buffer ended while reading the contact list number {}. An empty "
+                         "map will be returned.",
+                         logPrefix,
+                         list);
+            return ContactListMap();
+        }
+
+        for (std::uint32_t i = 0; i < numberOfContacts; i++)
+        {
+            if (!read(&record, sizeof(record)) || !readString(tempContact.name))
+            {
+                log()->error("{} The buffer ended while reading the contact number {} of the "
+                             "list named {}. An empty map will be returned.",
+                             logPrefix,
+                             i,
+                             key);
+                return ContactListMap();
+            }
+
+            tempContact.pose.translation(Eigen::Map<const Eigen::Vector3d>(record.position));
+            tempContact.pose.quat(Eigen::Map<const manif::SO3d>(record.quaternion));
+            tempContact.activationTime = std::chrono::nanoseconds(record.activationTime);
+            tempContact.deactivationTime = std::chrono::nanoseconds(record.deactivationTime);
+            tempContact.index = record.index;
+            tempContact.type = static_cast<ContactType>(record.type);
+
+            if (!map[key].addContact(tempContact))
+            {
+                log()->error("{} Unable to add the contact number {} to the list named {}. An "
+                             "empty map will be returned.",
+                             logPrefix,
+                             i,
+                             key);
+                return ContactListMap();
+            }
+        }
+    }
+
+    return map;
+}
+
+ContactListMap contactListMapFromBinaryFile(const std::string& filename)
+{
+    constexpr auto logPrefix = "[contactListMapFromBinaryFile]";
+
+    // open the file
+    std::ifstream inputStream(filename, std::ios::binary);
+
+    if (!inputStream.is_open())
+    {
+        log()->error("{} Failed to open {}. An empty map will be returned.", logPrefix, filename);
+        return ContactListMap();
+    }
+
+    std::vector<std::uint8_t> buffer(std::istreambuf_iterator<char>(inputStream), {});
+
+    // close the stream
+    inputStream.close();
+
+    return contactListMapFromBinary(buffer);
+}
+
+} // namespace Contacts
+} // namespace BipedalLocomotion
@@ -8,8 +8,11 @@
 #include <BipedalLocomotion/Contacts/ContactPhaseList.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
-#include <map>
+#include <iterator>
+#include <vector>
 
 using namespace BipedalLocomotion::Contacts;
 
@@ -32,10 +35,34 @@ ContactPhaseList& ContactPhaseList::operator=(const ContactPhaseList& other)
 
 void ContactPhaseList::createPhases()
 {
+    // The counter is shared by all the instances so that two different sets of phases never
+    // carry the same stamp. The value 0 is reserved to mark "no phases seen yet" in the
+    // consumers of the list
+    static std::atomic<std::size_t> generationCounter{0};
+    m_generation = ++generationCounter;
+
     m_phases.clear();
+    m_presentPhaseHint = 0;
+
+    // Event associated to the activation or the deactivation of a contact. The events are stored
+    // in flat preallocated vectors instead of time-indexed maps to avoid performing one node
+    // allocation per contact every time the phases are rebuilt
+    struct Event
+    {
+        std::chrono::nanoseconds time;
+        const std::string* key;
+        ContactList::const_iterator contact;
+    };
 
-    std::map<std::chrono::nanoseconds, std::unordered_map<std::string, ContactList::const_iterator>>
-        activations, deactivations;
+    std::size_t numberOfContacts = 0;
+    for (const auto& [key, list] : m_contactLists)
+    {
+        numberOfContacts += list.size();
+    }
+
+    std::vector<Event> activations, deactivations;
+    activations.reserve(numberOfContacts);
+    deactivations.reserve(numberOfContacts);
 
     for (ContactListMap::iterator list = m_contactLists.begin(); list != m_contactLists.end();
          ++list)
@@ -44,73 +71,103 @@ void ContactPhaseList::createPhases()
         for (ContactList::const_iterator step = list->second.begin(); step != list->second.end();
              ++step)
         {
-            activations[step->activationTime][key] = step; // By construction, there is only a step
-                                                           // given a key and activationTime
-            deactivations[step->deactivationTime][key] = step;
+            activations.push_back({step->activationTime, &key, step}); // By construction, there is
+                                                                       // only a step given a key
+                                                                       // and activationTime
+            deactivations.push_back({step->deactivationTime, &key, step});
         }
     }
 
-    if (!activations.size())
+    if (activations.empty())
     {
         return;
     }
 
-    ContactPhase currentPhase;
-    currentPhase.beginTime = activations.begin()->first;
-    currentPhase.activeContacts = activations.begin()->second;
+    // the events sharing the same time instant form a group, equivalent to an entry of the
+    // time-indexed maps used before
+    auto eventOrdering = [](const Event& a, const Event& b) { return a.time < b.time; };
+    std::stable_sort(activations.begin(), activations.end(), eventOrdering);
+    std::stable_sort(deactivations.begin(), deactivations.end(), eventOrdering);
+
+    auto groupEnd = [](const std::vector<Event>& events, std::size_t head) {
+        std::size_t end = head;
+        while (end < events.size() && events[end].time == events[head].time)
+        {
+            end++;
+        }
+        return end;
+    };
+
+    auto countGroups = [&groupEnd](const std::vector<Event>& events) {
+        std::size_t groups = 0;
+        for (std::size_t i = 0; i < events.size(); i = groupEnd(events, i))
+        {
+            groups++;
+        }
+        return groups;
+    };
+
+    std::size_t remainingActivations = countGroups(activations);
+    std::size_t remainingDeactivations = countGroups(deactivations);
+
+    std::size_t a = 0; // head of the activation events
+    std::size_t d = 0; // head of the deactivation events
+
+    // consume the group of events at the head of the activations
+    auto addActivatedContacts = [&](ContactPhase& phase) {
+        const std::size_t end = groupEnd(activations, a);
+        for (; a < end; a++)
+        {
+            phase.activeContacts[*activations[a].key] = activations[a].contact;
+        }
+        remainingActivations--;
+    };
 
-    activations.erase(activations.begin());
+    m_phases.reserve(remainingActivations + remainingDeactivations);
 
-    while ((activations.size() + deactivations.size()) > 1)
+    ContactPhase currentPhase;
+    currentPhase.beginTime = activations.front().time;
+    addActivatedContacts(currentPhase);
+
+    while ((remainingActivations + remainingDeactivations) > 1)
     {
-        if ((activations.size() == 0)
-            || (deactivations.begin()->first <= activations.begin()->first))
+        if ((remainingActivations == 0) || (deactivations[d].time <= activations[a].time))
         {
             // Here I need to remove from the current phase the contacts that are going to end
-            currentPhase.endTime = deactivations.begin()->first;
+            currentPhase.endTime = deactivations[d].time;
             m_phases.push_back(currentPhase);
 
-            currentPhase.beginTime = deactivations.begin()->first;
+            currentPhase.beginTime = deactivations[d].time;
 
-            for (auto& toBeRemoved : deactivations.begin()->second)
+            const std::size_t end = groupEnd(deactivations, d);
+            for (; d < end; d++)
             {
-                currentPhase.activeContacts.erase(toBeRemoved.first); // Erase all the contacts
-                                                                      // which are deactivativated
-                                                                      // in this instant
+                currentPhase.activeContacts.erase(*deactivations[d].key); // Erase all the contacts
+                                                                          // which are
+                                                                          // deactivativated in
+                                                                          // this instant
             }
+            remainingDeactivations--;
 
-            deactivations.erase(deactivations.begin());
-
-            if (activations.size() && (deactivations.begin()->first == activations.begin()->first))
+            if (remainingActivations > 0 && d < deactivations.size()
+                && (deactivations[d].time == activations[a].time))
             {
-                currentPhase.activeContacts.insert(activations.begin()->second.begin(),
-                                                   activations.begin()->second.end()); // Add the
-                                                                                       // new
-                                                                                       // contacts
-                                                                                       // to the
-                                                                                       // list.
-
-                activations.erase(activations.begin());
+                addActivatedContacts(currentPhase); // Add the new contacts to the list.
             }
-        } else // (activations.begin()->first < deactivations.begin()->first)
+        } else // (activations[a].time < deactivations[d].time)
         {
-            currentPhase.endTime = activations.begin()->first;
+            currentPhase.endTime = activations[a].time;
             m_phases.push_back(currentPhase);
 
-            currentPhase.beginTime = activations.begin()->first;
-            currentPhase.activeContacts.insert(activations.begin()->second.begin(),
-                                               activations.begin()->second.end()); // Add the new
-                                                                                   // contacts to
-                                                                                   // the list.
-
-            activations.erase(activations.begin());
+            currentPhase.beginTime = activations[a].time;
+            addActivatedContacts(currentPhase); // Add the new contacts to the list.
         }
     }
 
-    assert(deactivations.size() == 1); // Only one element should be left (deactivations and
-                                       // activations were equal in number, but the head of
-                                       // activations was deleted at the beginning).
-    currentPhase.endTime = deactivations.begin()->first;
+    assert(remainingDeactivations == 1); // Only one element should be left (deactivations and
+                                         // activations were equal in number, but the head of
+                                         // activations was deleted at the beginning).
+    currentPhase.endTime = deactivations[d].time;
     m_phases.push_back(currentPhase);
 }
 
@@ -143,21 +200,57 @@ bool ContactPhaseList::setLists(const std::initializer_list<ContactList>& contac
 ContactPhaseList::const_iterator
 ContactPhaseList::getPresentPhase(const std::chrono::nanoseconds& time) const
 {
-    // With the reverse iterator we find the last phase such that the begin time is smaller that
-    // time
-    auto presentReverse = std::find_if(rbegin(), rend(), [time](const ContactPhase& a) -> bool {
-        return a.beginTime <= time;
-    });
+    // a phase is the present one if its begin time is lower equal than time and the following
+    // phase (if any) has not begun yet
+    auto isPresent = [this, time](std::size_t index) -> bool {
+        return m_phases[index].beginTime <= time
+               && (index + 1 == m_phases.size() || m_phases[index + 1].beginTime > time);
+    };
+
+    // Check the cached hint first. Queries at monotonically increasing times (the common
+    // access pattern of the controllers) fall either in the phase returned by the previous
+    // call or in the following one, making the lookup amortized O(1). The hint is read once in
+    // a local variable: concurrent const queries may overwrite it at any time, but every value
+    // stored in it is a valid index
+    const std::size_t hint = m_presentPhaseHint;
+    if (hint < m_phases.size())
+    {
+        if (isPresent(hint))
+        {
+            return begin() + hint;
+        }
 
-    if (presentReverse == rend())
+        if (hint + 1 < m_phases.size() && isPresent(hint + 1))
+        {
+            m_presentPhaseHint = hint + 1;
+            return begin() + (hint + 1);
+        }
+    }
+
+    // Binary search for the first phase whose begin time is greater than time. The present
+    // phase is the one before it
+    const_iterator upper = std::upper_bound(begin(),
+                                            end(),
+                                            time,
+                                            [](const std::chrono::nanoseconds& t,
+                                               const ContactPhase& phase) -> bool {
+                                                return t < phase.beginTime;
+                                            });
+
+    if (upper == begin())
     {
         // No phase has begin time lower than the specified time.
         return end();
     }
 
-    // This is to convert a reverse iterator to a forward iterator. The -- is because base() returns
-    // a forward iterator to the next element.
-    return --(presentReverse.base());
+    const std::size_t present = std::distance(begin(), std::prev(upper));
+    m_presentPhaseHint = present;
+    return begin() + present;
+}
+
+std::size_t ContactPhaseList::generation() const
+{
+    return m_generation;
 }
 
 const BipedalLocomotion::Contacts::ContactListMap&
@@ -228,6 +321,8 @@ size_t ContactPhaseList::size() const
 
 void ContactPhaseList::clear()
 {
-    m_phases.clear();
     m_contactLists.clear();
+
+    // createPhases with no list clears the phases and renews the generation stamp
+    createPhases();
 }
@@ -10,7 +10,9 @@
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
+#include <cassert>
 #include <chrono>
+#include <iterator>
 #include <limits>
 #include <memory>
 
@@ -53,128 +55,186 @@ bool FixedFootDetector::initialize(std::weak_ptr<const IParametersHandler> handl
     return true;
 }
 
-bool FixedFootDetector::updateFixedFoot()
+bool FixedFootDetector::buildFixedFootSchedule(const ContactPhaseList& phaseList)
 {
-    constexpr auto logPrefix = "[FixedFootDetector::updateFixedFoot]";
+    constexpr auto logPrefix = "[FixedFootDetector::buildFixedFootSchedule]";
 
-    // search the phase associated to the current time
-    auto phase = m_contactPhaselist.getPresentPhase(m_currentTime);
+    m_schedule.clear();
+    m_scheduleCursor = 0;
+    m_schedule.reserve(phaseList.size());
 
-    if(phase == m_contactPhaselist.end())
+    for (auto phase = phaseList.begin(); phase != phaseList.end(); ++phase)
     {
-        log()->error("{} No phase has the begin time lower than the specified time.", logPrefix);
-        return false;
-    }
-
-    if (phase->activeContacts.size() > 2)
-    {
-        log()->error("{} The base detector can be used only for bipedal locomotion and it cannot "
-                     "handle more than two actives contacts.",
-                     logPrefix);
-        return false;
-    }
+        FixedFootPhase& entry = m_schedule.emplace_back();
+        entry.beginTime = phase->beginTime;
 
-    // if the robot is in single support only one contact is enabled
-    if (phase->activeContacts.size() == 1)
-    {
-        // get the enabled contact
-        const auto it = phase->activeContacts.cbegin();
-        if (m_contactStates.find(it->first) == m_contactStates.end())
+        if (phase->activeContacts.size() > 2)
         {
-            log()->error("{} Unable to find the contact.", logPrefix);
+            log()->error("{} The base detector can be used only for bipedal locomotion and it "
+                         "cannot handle more than two actives contacts.",
+                         logPrefix);
             return false;
         }
 
-        // update the contacts
-        for (auto& [name, contact] : m_contactStates)
+        // if the robot is in single support only one contact is enabled
+        if (phase->activeContacts.size() == 1)
         {
-            contact.lastUpdateTime = m_currentTime;
-            contact.switchTime = phase->beginTime;
-            if (name != it->first)
+            // get the enabled contact
+            const auto it = phase->activeContacts.cbegin();
+            if (m_contactStates.find(it->first) == m_contactStates.end())
             {
-                contact.isActive = false;
-            } else
+                log()->error("{} Unable to find the contact.", logPrefix);
+                return false;
+            }
+
+            entry.updatesContacts = true;
+            for (const auto& [name, contact] : m_contactStates)
             {
-                contact.isActive = true;
-                contact.pose = it->second->pose;
+                ContactUpdate& update = entry.updates.emplace_back();
+                update.name = name;
+                update.isActive = (name == it->first);
+                update.updatePose = update.isActive;
+                if (update.updatePose)
+                {
+                    update.pose = it->second->pose;
+                }
             }
+
+            continue;
         }
 
-        return true;
+        // the active contacts are 2
+        if (phase->activeContacts.size() != 2)
+        {
+            log()->error("{} This class supports only the bipedal robots where at list one foot "
+                         "is in contact with the ground. This means that the maximum number of "
+                         "active contact must be equal to 1 or 2. In the current phase the number "
+                         "of active contacts is equal to {}.",
+                         logPrefix,
+                         phase->activeContacts.size());
+            return false;
+        }
+
+        // Notice that here we do not analyze the case in which the phase is different from
+        // firstPhase. Indeed in this case we should not update the contact states dictionary.
+        // (The content of the dictionary is the one of the previous single support phase)
+        if (phase != phaseList.firstPhase())
+        {
+            continue;
+        }
+
+        entry.updatesContacts = true;
+
+        // if the current phase is the first and there are at least 2 phases the active contact
+        // will be the one that is going to be active in the next phase.
+        if (phaseList.size() > 1)
+        {
+            const auto nextPhase = std::next(phase);
+            const auto it = nextPhase->activeContacts.cbegin();
+
+            assert(m_contactStates.find(it->first) != m_contactStates.end()
+                   && "[FixedFootDetector::buildFixedFootSchedule] Unable to find the contact. "
+                      "This should not be possible. If you read this assert there is a bug in "
+                      "the code");
+
+            for (const auto& [name, contact] : m_contactStates)
+            {
+                ContactUpdate& update = entry.updates.emplace_back();
+                update.name = name;
+                if (name != it->first)
+                {
+                    update.isActive = true;
+                    update.updatePose = true;
+                    update.pose = phase->activeContacts.find(name)->second->pose;
+                }
+            }
+        } else // phaseList.size() == 1
+        {
+            // there is only one contact phase and this phase is a double support phase.
+            // Here we take the first contact as active contact.
+            auto contact = phase->activeContacts.cbegin();
+
+            assert(m_contactStates.find(contact->first) != m_contactStates.end()
+                   && "[FixedFootDetector::buildFixedFootSchedule] Unable to find the contact. "
+                      "This should not be possible. If you read this assert there is a bug in "
+                      "the code");
+
+            ContactUpdate& active = entry.updates.emplace_back();
+            active.name = contact->first;
+            active.isActive = true;
+            active.updatePose = true;
+            active.pose = contact->second->pose;
+
+            std::advance(contact, 1);
+
+            assert(m_contactStates.find(contact->first) != m_contactStates.end()
+                   && "[FixedFootDetector::buildFixedFootSchedule] Unable to find the contact. "
+                      "This should not be possible. If you read this assert there is a bug in "
+                      "the code");
+
+            ContactUpdate& inactive = entry.updates.emplace_back();
+            inactive.name = contact->first;
+        }
     }
 
-    // the active contacts are 2
-    if (phase->activeContacts.size() != 2)
+    return true;
+}
+
+bool FixedFootDetector::updateFixedFoot()
+{
+    constexpr auto logPrefix = "[FixedFootDetector::updateFixedFoot]";
+
+    if (m_schedule.empty())
     {
-        log()->error("{} This class supports only the bipedal robots where at list one foot is in "
-                     "contact with the ground. This means that the maximum number of active "
-                     "contact must be equal to 1 or 2. In the current phase the number of active "
-                     "contacts is equal to {}.",
-                     logPrefix,
-                     phase->activeContacts.size());
+        log()->error("{} The fixed foot schedule is empty. Please call setContactPhaseList().",
+                     logPrefix);
         return false;
     }
 
-    // Notice that here we do not analyze the case in which the phase is different from
-    // firstPhase. Indeed in this case we should not update the contact states dictionary. (The
-    // content of the dictionary is the one of the previous single support phase)
-    if (phase != m_contactPhaselist.firstPhase())
+    if (m_currentTime < m_schedule.front().beginTime)
     {
-        return true;
+        log()->error("{} No phase has the begin time lower than the specified time.", logPrefix);
+        return false;
     }
 
-    // if the current phase is the first and there are at least 2 phases the active contact will be
-    // the one that is going to be active in the next phase.
-    if (m_contactPhaselist.size() > 1)
+    // the time may have been moved backward with resetTime
+    if (m_currentTime < m_schedule[m_scheduleCursor].beginTime)
     {
-        const auto nextPhase = std::next(phase);
-        const auto it = nextPhase->activeContacts.cbegin();
-
-        assert(m_contactStates.find(it->first) != m_contactStates.end()
-               && "[FixedFootDetector::updateFixedFoot] Unable to find the contact. "
-                  "This should not be possible. If you read this assert there is a bug in "
-                  "the code");
+        m_scheduleCursor = 0;
+    }
 
-        // update the contacts
-        for (auto& [name, contact] : m_contactStates)
-        {
-            contact.lastUpdateTime = m_currentTime;
-            contact.switchTime = phase->beginTime;
-            if (name != it->first)
-            {
-                contact.isActive = true;
-                contact.pose = phase->activeContacts.find(name)->second->pose;
-            } else
-            {
-                contact.isActive = false;
-            }
-        }
-    } else // contactPhaselist.size() == 1
+    // the time grows monotonically, so the phase associated to the current time is found by
+    // moving the cursor through the precomputed phase boundaries instead of searching the list
+    while (m_scheduleCursor + 1 < m_schedule.size()
+           && m_schedule[m_scheduleCursor + 1].beginTime <= m_currentTime)
     {
-        // there is only one contact phase and this phase is a double support phase.
-        // Here we take the first contact as active contact.
-        auto contact = phase->activeContacts.cbegin();
-
-        assert(m_contactStates.find(contact->first) != m_contactStates.end()
-               && "[FixedFootDetector::updateFixedFoot] Unable to find the contact. "
-                  "This should not be possible. If you read this assert there is a bug in "
-                  "the code");
+        m_scheduleCursor++;
+    }
 
-        m_contactStates[contact->first].lastUpdateTime = m_currentTime;
-        m_contactStates[contact->first].switchTime = phase->beginTime;
-        m_contactStates[contact->first].isActive = true;
-        m_contactStates[contact->first].pose = contact->second->pose;
+    const FixedFootPhase& phase = m_schedule[m_scheduleCursor];
 
-        std::advance(contact, 1);
+    // the double support phases different from the first one do not update the contact states
+    // (the content of the dictionary is the one of the previous single support phase)
+    if (!phase.updatesContacts)
+    {
+        return true;
+    }
 
-        assert(m_contactStates.find(contact->first) != m_contactStates.end()
+    for (const ContactUpdate& update : phase.updates)
+    {
+        auto contact = m_contactStates.find(update.name);
+        assert(contact != m_contactStates.end()
                && "[FixedFootDetector::updateFixedFoot] Unable to find the contact. "
                   "This should not be possible. If you read this assert there is a bug in "
                   "the code");
 
-        m_contactStates[contact->first].lastUpdateTime = m_currentTime;
-        m_contactStates[contact->first].switchTime = phase->beginTime;
-        m_contactStates[contact->first].isActive = false;
+        contact->second.lastUpdateTime = m_currentTime;
+        contact->second.switchTime = phase.beginTime;
+        contact->second.isActive = update.isActive;
+        if (update.updatePose)
+        {
+            contact->second.pose = update.pose;
+        }
     }
 
     return true;
@@ -208,7 +268,13 @@ bool FixedFootDetector::advance()
 
 void FixedFootDetector::setContactPhaseList(const ContactPhaseList& phaseList)
 {
-    m_contactPhaselist = phaseList;
+    constexpr auto logPrefix = "[FixedFootDetector::setContactPhaseList]";
+
+    // the schedule associated to this set of phases has already been computed
+    if (phaseList.generation() == m_phaseListGeneration)
+    {
+        return;
+    }
 
     std::vector<std::string> removedContacts;
     std::vector<std::string> newContacts;
@@ -243,11 +309,26 @@ void FixedFootDetector::setContactPhaseList(const ContactPhaseList& phaseList)
         m_contactStates[contact].name = contact;
         m_contactStates[contact].index = phaseList.lists().find(contact)->second.cbegin()->index;
     }
+
+    if (!this->buildFixedFootSchedule(phaseList))
+    {
+        log()->error("{} Unable to build the fixed foot schedule. The stored schedule has been "
+                     "cleared.",
+                     logPrefix);
+        m_schedule.clear();
+        m_phaseListGeneration = 0;
+        return;
+    }
+
+    m_phaseListGeneration = phaseList.generation();
 }
 
 void FixedFootDetector::resetTime(const std::chrono::nanoseconds &time)
 {
     m_currentTime = time;
+
+    // updateFixedFoot moves the cursor only forward, so restart from the first phase
+    m_scheduleCursor = 0;
 }
 
 const EstimatedContact& FixedFootDetector::getFixedFoot() const
@@ -11,6 +11,7 @@
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 #include <chrono>
+#include <vector>
 
 namespace blf = BipedalLocomotion;
 using namespace BipedalLocomotion::Contacts;
@@ -18,15 +19,54 @@ using namespace BipedalLocomotion::ParametersHandler;
 
 struct SchmittTriggerDetector::Impl
 {
-    /** Container for SchmittTrigger for each contact */
-    std::unordered_map<std::string, blf::Math::SchmittTrigger> manager;
+    /** Single Schmitt trigger unit stored in the flat contact storage */
+    struct TriggerUnit
+    {
+        std::string name; /**< Name of the contact */
+        blf::Math::SchmittTrigger trigger; /**< Schmitt trigger cell */
+        blf::Contacts::EstimatedContact* contact{nullptr}; /**< Associated contact state. The
+                                                                pointer remains valid since
+                                                                references into an unordered_map
+                                                                are stable under insertion */
+        bool previousState{false}; /**< Trigger state at the previous advance call */
+    };
+
+    std::vector<TriggerUnit> units; /**< Flat container of Schmitt trigger units iterated by
+                                         advance() without hash lookups */
+    std::unordered_map<std::string, std::size_t> slots; /**< One-time name-to-slot resolution */
+
+    /** Fixed-capacity ring buffer of the recent contact transitions */
+    std::vector<ContactTransition> transitions;
+    std::size_t transitionHead{0}; /**< Index of the slot written by the next transition */
+    std::size_t transitionCount{0}; /**< Number of valid entries in the ring buffer */
+
+    static constexpr int defaultTransitionCapacity{32};
 
     /**
      * Utility function to check if contact exists
      */
     [[nodiscard]] inline bool contactExists(const std::string& contactName) const
     {
-        return manager.find(contactName) != manager.end();
+        return slots.find(contactName) != slots.end();
+    }
+
+    /**
+     * Store a contact transition in the ring buffer, overwriting the oldest entry when full
+     */
+    void recordTransition(const std::string& contactName,
+                          const bool isActive,
+                          const std::chrono::nanoseconds& switchTime)
+    {
+        ContactTransition& entry = transitions[transitionHead];
+        entry.name = contactName;
+        entry.isActive = isActive;
+        entry.switchTime = switchTime;
+
+        transitionHead = (transitionHead + 1) % transitions.size();
+        if (transitionCount < transitions.size())
+        {
+            transitionCount++;
+        }
     }
 };
 
@@ -34,7 +74,9 @@ SchmittTriggerDetector::SchmittTriggerDetector()
     : m_pimpl(std::make_unique<Impl>())
 {
     m_contactStates.clear();
-    m_pimpl->manager.clear();
+    m_pimpl->units.clear();
+    m_pimpl->slots.clear();
+    m_pimpl->transitions.resize(Impl::defaultTransitionCapacity);
 }
 
 SchmittTriggerDetector::~SchmittTriggerDetector() = default;
@@ -92,6 +134,21 @@ bool SchmittTriggerDetector::initialize(std::weak_ptr<const IParametersHandler>
         return false;
     }
 
+    int transitionCapacity{Impl::defaultTransitionCapacity};
+    if (ptr->getParameter("transition_history_capacity", transitionCapacity))
+    {
+        if (transitionCapacity < 1)
+        {
+            log()->error("{} The parameter named 'transition_history_capacity' must be a positive "
+                         "integer.",
+                         logPrefix);
+            return false;
+        }
+    }
+    m_pimpl->transitions.assign(static_cast<std::size_t>(transitionCapacity), ContactTransition());
+    m_pimpl->transitionHead = 0;
+    m_pimpl->transitionCount = 0;
+
     // initialize the smith trigger for each contact
     for (std::size_t idx = 0; idx < contacts.size(); idx++)
     {
@@ -133,39 +190,70 @@ bool SchmittTriggerDetector::advance()
         m_detectorState = State::Running;
     }
 
-    for (auto& [contactName, schmittTrigger] : m_pimpl->manager)
+    for (auto& unit : m_pimpl->units)
     {
         // advance the trigger and get the state
-        if (!schmittTrigger.advance())
+        if (!unit.trigger.advance())
         {
             log()->error("{} Unable to update the state of the Schmitt trigger cell for the "
                          "contact named: '{}'.",
                          logPrefix,
-                         contactName);
+                         unit.name);
             return false;
         }
 
         // update the contact
-        const blf::Math::SchmittTriggerOutput& output = schmittTrigger.getOutput();
-        blf::Contacts::EstimatedContact& contact = m_contactStates.at(contactName);
-        contact.isActive = output.state;
-        contact.switchTime = output.switchTime;
+        const blf::Math::SchmittTriggerOutput& output = unit.trigger.getOutput();
+        unit.contact->isActive = output.state;
+        unit.contact->switchTime = output.switchTime;
+
+        // store the state switch in the transition ring buffer
+        if (output.state != unit.previousState)
+        {
+            m_pimpl->recordTransition(unit.name, output.state, output.switchTime);
+            unit.previousState = output.state;
+        }
     }
 
     return true;
 }
 
+std::ptrdiff_t SchmittTriggerDetector::getContactSlot(const std::string& contactName) const
+{
+    auto it = m_pimpl->slots.find(contactName);
+    if (it == m_pimpl->slots.end())
+    {
+        return -1;
+    }
+
+    return static_cast<std::ptrdiff_t>(it->second);
+}
+
+bool SchmittTriggerDetector::setTimedTriggerInput(const std::size_t slot,
+                                                  const blf::Math::SchmittTriggerInput& input)
+{
+    constexpr auto logPrefix = "[SchmittTriggerDetector::setTimedTriggerInput]";
+    if (slot >= m_pimpl->units.size())
+    {
+        log()->error("{} Invalid contact slot. Cannot set measurement", logPrefix);
+        return false;
+    }
+
+    return m_pimpl->units[slot].trigger.setInput(input);
+}
+
 bool SchmittTriggerDetector::setTimedTriggerInput(const std::string& contactName,
                                                   const blf::Math::SchmittTriggerInput& input)
 {
     constexpr auto logPrefix = "[SchmittTriggerDetector::setTimedTriggerInput]";
-    if (!m_pimpl->contactExists(contactName))
+    auto it = m_pimpl->slots.find(contactName);
+    if (it == m_pimpl->slots.end())
     {
         log()->error("{} Contact does not exist. Cannot set measurement", logPrefix);
         return false;
     }
 
-    return m_pimpl->manager.at(contactName).setInput(input);
+    return m_pimpl->units[it->second].trigger.setInput(input);
 }
 
 bool SchmittTriggerDetector::setTimedTriggerInputs(
@@ -176,13 +264,14 @@ bool SchmittTriggerDetector::setTimedTriggerInputs(
     std::string skippedUpdatesFrames;
     for (const auto& [contactName, measure] : timedInputs)
     {
-        if (!m_pimpl->contactExists(contactName))
+        auto it = m_pimpl->slots.find(contactName);
+        if (it == m_pimpl->slots.end())
         {
             skippedUpdatesFrames += " " + contactName;
             continue;
         }
 
-        m_pimpl->manager.at(contactName).setInput(measure);
+        m_pimpl->units[it->second].trigger.setInput(measure);
     }
 
     if (skippedUpdatesFrames.size())
@@ -195,6 +284,42 @@ bool SchmittTriggerDetector::setTimedTriggerInputs(
     return true;
 }
 
+bool SchmittTriggerDetector::getLatestTransition(const std::string& contactName,
+                                                 ContactTransition& transition) const
+{
+    const std::size_t capacity = m_pimpl->transitions.size();
+
+    // scan the ring buffer from the newest to the oldest entry
+    for (std::size_t i = 0; i < m_pimpl->transitionCount; i++)
+    {
+        const std::size_t idx = (m_pimpl->transitionHead + capacity - 1 - i) % capacity;
+        if (m_pimpl->transitions[idx].name == contactName)
+        {
+            transition = m_pimpl->transitions[idx];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::size_t
+SchmittTriggerDetector::getRecentTransitions(std::vector<ContactTransition>& transitions) const
+{
+    const std::size_t capacity = m_pimpl->transitions.size();
+
+    transitions.resize(m_pimpl->transitionCount);
+    for (std::size_t i = 0; i < m_pimpl->transitionCount; i++)
+    {
+        // fill the output from the oldest to the newest entry
+        const std::size_t idx
+            = (m_pimpl->transitionHead + capacity - m_pimpl->transitionCount + i) % capacity;
+        transitions[i] = m_pimpl->transitions[idx];
+    }
+
+    return m_pimpl->transitionCount;
+}
+
 bool SchmittTriggerDetector::addContact(const std::string& contactName,
                                         const blf::Math::SchmittTriggerState& initialState,
                                         const blf::Math::SchmittTrigger::Params& params)
@@ -207,20 +332,25 @@ bool SchmittTriggerDetector::addContact(const std::string& contactName,
         return false;
     }
 
-    EstimatedContact newContact;
-    newContact.isActive = initialState.state;
-    newContact.name = contactName;
-
-    if (!m_pimpl->manager[contactName].initialize(params)
-        || !m_pimpl->manager[contactName].setState(initialState))
+    Impl::TriggerUnit unit;
+    unit.name = contactName;
+    unit.previousState = initialState.state;
+    if (!unit.trigger.initialize(params) || !unit.trigger.setState(initialState))
     {
         log()->error("{} Unable to initialize the trigger named: {}.", logPrefix, contactName);
-        m_pimpl->manager.erase(contactName);
         return false;
     }
 
+    EstimatedContact newContact;
+    newContact.isActive = initialState.state;
+    newContact.name = contactName;
+
     std::string contactsKey = contactName;
-    m_contactStates.emplace(std::move(contactsKey), std::move(newContact));
+    auto [it, inserted] = m_contactStates.emplace(std::move(contactsKey), std::move(newContact));
+    unit.contact = &it->second;
+
+    m_pimpl->slots.emplace(contactName, m_pimpl->units.size());
+    m_pimpl->units.push_back(std::move(unit));
 
     return true;
 }
@@ -228,13 +358,24 @@ bool SchmittTriggerDetector::addContact(const std::string& contactName,
 bool SchmittTriggerDetector::removeContact(const std::string& contactName)
 {
     constexpr auto logPrefix = "[SchmittTriggerDetector::removeContact]";
-    if (!m_pimpl->contactExists(contactName))
+    auto it = m_pimpl->slots.find(contactName);
+    if (it == m_pimpl->slots.end())
     {
         log()->error("{} The contact named '{}' does not exist", logPrefix, contactName);
         return false;
     }
 
-    m_pimpl->manager.erase(contactName);
+    // keep the flat storage compact by moving the last unit into the freed slot
+    const std::size_t slot = it->second;
+    const std::size_t last = m_pimpl->units.size() - 1;
+    if (slot != last)
+    {
+        m_pimpl->units[slot] = std::move(m_pimpl->units[last]);
+        m_pimpl->slots[m_pimpl->units[slot].name] = slot;
+    }
+    m_pimpl->units.pop_back();
+
+    m_pimpl->slots.erase(contactName);
     m_contactStates.erase(contactName);
     return true;
 }
@@ -244,14 +385,15 @@ bool SchmittTriggerDetector::resetContact(const std::string& contactName,
                                           const blf::Math::SchmittTrigger::Params& params)
 {
     constexpr auto logPrefix = "[SchmittTriggerDetector::resetContact]";
-    if (!m_pimpl->contactExists(contactName))
+    auto it = m_pimpl->slots.find(contactName);
+    if (it == m_pimpl->slots.end())
     {
         log()->error("{} The contact named '{}' does not exist", logPrefix, contactName);
         return false;
     }
 
-    auto& trigger = m_pimpl->manager.at(contactName);
-    if (!trigger.initialize(params))
+    auto& unit = m_pimpl->units[it->second];
+    if (!unit.trigger.initialize(params))
     {
         log()->error("{} Unable to initialize the trigger for the contact named '{}'.",
                      logPrefix,
@@ -260,9 +402,10 @@ bool SchmittTriggerDetector::resetContact(const std::string& contactName,
     }
     blf::Math::SchmittTriggerState triggerState;
     triggerState.state = state;
-    trigger.setState(triggerState);
-    m_contactStates.at(contactName).isActive = state;
-    m_contactStates.at(contactName).switchTime = std::chrono::nanoseconds::zero();
+    unit.trigger.setState(triggerState);
+    unit.previousState = state;
+    unit.contact->isActive = state;
+    unit.contact->switchTime = std::chrono::nanoseconds::zero();
 
     return true;
 }
@@ -270,17 +413,20 @@ bool SchmittTriggerDetector::resetContact(const std::string& contactName,
 bool SchmittTriggerDetector::resetState(const std::string& contactName, const bool& state)
 {
     constexpr auto logPrefix = "[SchmittTriggerDetector::resetContact]";
-    if (!m_pimpl->contactExists(contactName))
+    auto it = m_pimpl->slots.find(contactName);
+    if (it == m_pimpl->slots.end())
     {
         log()->error("{} The contact named '{}' does not exist", logPrefix, contactName);
         return false;
     }
 
+    auto& unit = m_pimpl->units[it->second];
     blf::Math::SchmittTriggerState triggerState;
     triggerState.state = state;
-    m_pimpl->manager.at(contactName).setState(triggerState);
-    m_contactStates.at(contactName).isActive = state;
-    m_contactStates.at(contactName).switchTime = std::chrono::nanoseconds::zero();
+    unit.trigger.setState(triggerState);
+    unit.previousState = state;
+    unit.contact->isActive = state;
+    unit.contact->switchTime = std::chrono::nanoseconds::zero();
 
     return true;
 }
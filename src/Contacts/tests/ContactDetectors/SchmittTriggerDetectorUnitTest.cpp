@@ -73,6 +73,26 @@ TEST_CASE("Schmitt Trigger Detector")
     REQUIRE(!rightContact.isActive);
     REQUIRE(rightContact.switchTime == 600ms);
 
+    // both state switches must be available in the transition ring buffer
+    SchmittTriggerDetector::ContactTransition transition;
+    REQUIRE(detector.getLatestTransition("right", transition));
+    REQUIRE(!transition.isActive);
+    REQUIRE(transition.switchTime == 600ms);
+
+    std::vector<SchmittTriggerDetector::ContactTransition> transitions;
+    REQUIRE(detector.getRecentTransitions(transitions) == 2);
+    REQUIRE(transitions.front().isActive);
+    REQUIRE(transitions.front().switchTime == 300ms);
+
+    // the slot based API avoids hashing the contact name at every sample
+    const auto rightSlot = detector.getContactSlot("right");
+    REQUIRE(rightSlot >= 0);
+    REQUIRE(detector.getContactSlot("unknown") < 0);
+    REQUIRE(detector.setTimedTriggerInput(static_cast<std::size_t>(rightSlot), {650ms, 7}));
+    REQUIRE(detector.advance());
+    REQUIRE(detector.get("right", rightContact));
+    REQUIRE(!rightContact.isActive);
+
     // add a new contact
     EstimatedContact newContact;
     SchmittTrigger::Params params;
@@ -14,6 +14,7 @@
 #include <manif/manif.h>
 
 #include <BipedalLocomotion/Contacts/ContactList.h>
+#include <BipedalLocomotion/Contacts/ContactListBinaryParser.h>
 #include <BipedalLocomotion/Contacts/ContactListJsonParser.h>
 #include <BipedalLocomotion/Contacts/Contact.h>
 
@@ -96,6 +97,53 @@ TEST_CASE("ContactList")
         REQUIRE(same);
     }
 
+    SECTION("Present step on a long list")
+    {
+        ContactList longList;
+        constexpr std::size_t numberOfContacts = 200;
+        for (std::size_t i = 0; i < numberOfContacts; i++)
+        {
+            PlannedContact contact;
+            contact.activationTime = i * 1s;
+            contact.deactivationTime = i * 1s + 500ms;
+            REQUIRE(longList.addContact(contact));
+        }
+
+        // monotone queries exploit the cached hint
+        for (std::size_t i = 0; i < numberOfContacts; i++)
+        {
+            REQUIRE(longList.getPresentContact(i * 1s + 200ms)->activationTime == i * 1s);
+        }
+
+        // a query in the past falls back to the binary search
+        REQUIRE(longList.getPresentContact(10s + 700ms)->activationTime == 10s);
+
+        // adding a contact invalidates the hint
+        PlannedContact contact;
+        contact.activationTime = numberOfContacts * 1s;
+        contact.deactivationTime = numberOfContacts * 1s + 500ms;
+        REQUIRE(longList.addContact(contact));
+        REQUIRE(longList.getPresentContact(numberOfContacts * 1s)->activationTime
+                == numberOfContacts * 1s);
+    }
+
+    SECTION("Copy does not share the cached hint")
+    {
+        // warm the hint of the original list
+        REQUIRE(contactsAreEqual(p2, *list.getPresentContact(1s + 200ms)));
+
+        ContactList copy = list;
+        ContactList::const_iterator present = copy.getPresentContact(1s + 200ms);
+        REQUIRE(contactsAreEqual(p2, *present));
+
+        // the iterator returned by the copy must belong to the copy
+        REQUIRE(present == copy.lastContact());
+
+        // the copy keeps working once the original is cleared
+        list.clear();
+        REQUIRE(contactsAreEqual(p2, *copy.getPresentContact(1s + 200ms)));
+    }
+
     SECTION("Keep present step")
     {
         list.clear();
@@ -148,3 +196,47 @@ TEST_CASE("ContactList JSON parser")
         }
     }
 }
+
+TEST_CASE("ContactList binary parser")
+{
+    using namespace std::chrono_literals;
+
+    ContactListMap contactListMap;
+    contactListMap["left"].setDefaultName("left_foot");
+    REQUIRE(contactListMap["left"].addContact(manif::SE3d::Random(), 0s, 1s));
+    REQUIRE(contactListMap["left"].addContact(manif::SE3d::Random(), 2s, 5s));
+
+    contactListMap["right"].setDefaultName("right_foot");
+    contactListMap["right"].setDefaultContactType(ContactType::POINT);
+    REQUIRE(contactListMap["right"].addContact(manif::SE3d::Random(), 0s, 3s));
+
+    std::vector<std::uint8_t> buffer;
+    REQUIRE(contactListMapToBinary(contactListMap, buffer));
+
+    // the round trip through the buffer must be lossless
+    ContactListMap newContactListMap = contactListMapFromBinary(buffer);
+    REQUIRE(newContactListMap.size() == contactListMap.size());
+    for (const auto& [key, contacts] : newContactListMap)
+    {
+        for (int i = 0; i < contacts.size(); i++)
+        {
+            REQUIRE(contactsAreEqual(contactListMap[key][i], contacts[i]));
+        }
+    }
+
+    // a truncated buffer must be rejected
+    buffer.resize(buffer.size() / 2);
+    REQUIRE(contactListMapFromBinary(buffer).empty());
+
+    // round trip through a file
+    REQUIRE(contactListMapToBinaryFile(contactListMap, "contact_list.bin"));
+    newContactListMap = contactListMapFromBinaryFile("contact_list.bin");
+    REQUIRE(newContactListMap.size() == contactListMap.size());
+    for (const auto& [key, contacts] : newContactListMap)
+    {
+        for (int i = 0; i < contacts.size(); i++)
+        {
+            REQUIRE(contactsAreEqual(contactListMap[key][i], contacts[i]));
+        }
+    }
+}
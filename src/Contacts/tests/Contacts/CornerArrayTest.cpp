@@ -0,0 +1,92 @@
+/**
+ * @file CornerArrayTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/Contacts/Contact.h>
+
+using namespace BipedalLocomotion::Contacts;
+
+TEST_CASE("CornerArray")
+{
+    CornerArray corners;
+    REQUIRE(corners.empty());
+    REQUIRE(corners.size() == 0);
+
+    SECTION("Push back and iterate")
+    {
+        constexpr std::size_t numberOfCorners = 4;
+        for (std::size_t i = 0; i < numberOfCorners; i++)
+        {
+            Corner corner;
+            corner.position << static_cast<double>(i), 0.0, 0.0;
+            corner.force << 0.0, 0.0, static_cast<double>(i);
+            REQUIRE(corners.push_back(corner));
+        }
+
+        REQUIRE(corners.size() == numberOfCorners);
+
+        std::size_t index = 0;
+        for (const auto& corner : corners)
+        {
+            REQUIRE(corner.position(0) == static_cast<double>(index));
+            REQUIRE(corner.force(2) == static_cast<double>(index));
+            index++;
+        }
+        REQUIRE(index == numberOfCorners);
+
+        corners.clear();
+        REQUIRE(corners.empty());
+    }
+
+    SECTION("SoA accessors")
+    {
+        REQUIRE(corners.resize(3));
+        for (std::size_t i = 0; i < corners.size(); i++)
+        {
+            corners[i].position << 1.0 * i, 2.0 * i, 3.0 * i;
+            corners[i].force << -1.0 * i, -2.0 * i, -3.0 * i;
+        }
+
+        const CornerArray::SoAMatrix positions = corners.positions();
+        const CornerArray::SoAMatrix forces = corners.forces();
+
+        REQUIRE(positions.rows() == 3);
+        REQUIRE(forces.rows() == 3);
+
+        for (std::size_t i = 0; i < corners.size(); i++)
+        {
+            REQUIRE(positions.row(i).transpose() == corners[i].position);
+            REQUIRE(forces.row(i).transpose() == corners[i].force);
+        }
+    }
+
+    SECTION("Capacity is enforced")
+    {
+        // resizing beyond the maximum number of corners fails and leaves the container unchanged
+        REQUIRE_FALSE(corners.resize(CornerArray::MaxCorners + 1));
+        REQUIRE(corners.empty());
+
+        // once the container is full push_back discards the corner
+        REQUIRE(corners.resize(CornerArray::MaxCorners));
+        REQUIRE_FALSE(corners.push_back(Corner()));
+        REQUIRE(corners.size() == CornerArray::MaxCorners);
+    }
+
+    SECTION("Copy does not share storage")
+    {
+        REQUIRE(corners.resize(1));
+        corners[0].position << 1.0, 2.0, 3.0;
+
+        CornerArray copy = corners;
+        copy[0].position << 4.0, 5.0, 6.0;
+
+        REQUIRE(corners[0].position(0) == 1.0);
+        REQUIRE(copy[0].position(0) == 4.0);
+    }
+}
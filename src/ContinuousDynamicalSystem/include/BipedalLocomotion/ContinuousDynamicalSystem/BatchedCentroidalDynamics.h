@@ -0,0 +1,155 @@
+/**
+ * @file BatchedCentroidalDynamics.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_BATCHED_CENTROIDAL_DYNAMICS_H
+#define BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_BATCHED_CENTROIDAL_DYNAMICS_H
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <BipedalLocomotion/ContinuousDynamicalSystem/CentroidalDynamics.h>
+#include <BipedalLocomotion/Math/Constants.h>
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+
+#include <Eigen/Dense>
+
+namespace BipedalLocomotion
+{
+namespace ContinuousDynamicalSystem
+{
+
+/**
+ * BatchedCentroidalDynamics integrates a batch of CentroidalDynamics systems simultaneously. It is
+ * designed for sampling-based controllers that roll out the centroidal model many times per
+ * control cycle: instead of building one system+integrator pair per rollout, the engine stores the
+ * N centroidal states in structure-of-arrays layout (one column per rollout) and advances all the
+ * rollouts with a single vectorized forward Euler step. The per-column arithmetic is evaluated
+ * with Eigen row-wise expressions, so it is vectorized across the rollouts; optionally the batch
+ * is partitioned among a set of threads.
+ * @note The engine implements the same dynamics of CentroidalDynamics. The contact points are
+ * provided already expressed in the inertial frame (i.e. the caller applies the contact pose to
+ * the corners), since in a sampling-based controller the contact locations are usually shared
+ * among the rollouts while the forces differ.
+ */
+class BatchedCentroidalDynamics
+{
+public:
+    /**
+     * ContactPointBatch describes a contact point across all the rollouts. Each column refers to
+     * a rollout.
+     */
+    struct ContactPointBatch
+    {
+        Eigen::Matrix3Xd positions; /**< Position of the contact point for each rollout expressed
+                                       in the inertial frame */
+        Eigen::Matrix3Xd forces; /**< Force applied at the contact point for each rollout whose
+                                    coordinates are expressed in the inertial frame */
+    };
+
+    // clang-format off
+    /**
+     * Initialize the batched centroidal dynamics.
+     * @param handler pointer to the parameter handler.
+     * @note The following parameters are used
+     * |    Parameter Name    |        Type        |                                    Description                                   | Mandatory |
+     * |:--------------------:|:------------------:|:--------------------------------------------------------------------------------:|:---------:|
+     * | `number_of_rollouts` |        `int`       |                     Number of rollouts integrated in parallel                    |    Yes    |
+     * |   `sampling_time`    | `chrono::duration` |                      Integration step of the forward Euler                       |    Yes    |
+     * |       `mass`         |      `double`      |             Value of the mass in kg. If not defined 1 is used.                   |    No     |
+     * |      `gravity`       |      `vector`      | Gravity vector. If not defined Math::StandardAccelerationOfGravitation is used.  |    No     |
+     * |  `number_of_threads` |        `int`       |  Number of threads used to partition the batch. If not defined 1 is used.        |    No     |
+     * @return true in case of success/false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
+    // clang-format on
+
+    /**
+     * Get the number of rollouts.
+     * @return the number of rollouts handled by the engine.
+     */
+    Eigen::Index numberOfRollouts() const;
+
+    /**
+     * Set the state of all the rollouts.
+     * @param state state of the centroidal dynamics broadcast to all the rollouts.
+     */
+    void setState(const CentroidalDynamics::State& state);
+
+    /**
+     * Set the state of a single rollout.
+     * @param rollout index of the rollout.
+     * @param state state of the centroidal dynamics.
+     * @return true in case of success, false otherwise.
+     */
+    bool setState(Eigen::Index rollout, const CentroidalDynamics::State& state);
+
+    /**
+     * Get the state of a single rollout.
+     * @param rollout index of the rollout.
+     * @return the state of the centroidal dynamics associated to the rollout.
+     */
+    CentroidalDynamics::State getState(Eigen::Index rollout) const;
+
+    /**
+     * Get the CoM position of all the rollouts.
+     * @return a 3xN matrix where each column is the CoM position of a rollout.
+     */
+    const Eigen::Matrix3Xd& comPositions() const;
+
+    /**
+     * Get the CoM velocity of all the rollouts.
+     * @return a 3xN matrix where each column is the CoM velocity of a rollout.
+     */
+    const Eigen::Matrix3Xd& comVelocities() const;
+
+    /**
+     * Get the angular momentum of all the rollouts.
+     * @return a 3xN matrix where each column is the angular momentum of a rollout.
+     */
+    const Eigen::Matrix3Xd& angularMomenta() const;
+
+    /**
+     * Advance all the rollouts of one integration step given the contact points.
+     * @param contactPoints list of contact points. Each element describes a contact point across
+     * all the rollouts.
+     * @return true in case of success, false otherwise.
+     */
+    bool step(const std::vector<ContactPointBatch>& contactPoints);
+
+private:
+    /**
+     * Evaluate the dynamics and integrate the columns in the range [begin, begin + cols).
+     */
+    void stepColumns(const std::vector<ContactPointBatch>& contactPoints,
+                     Eigen::Index begin,
+                     Eigen::Index cols);
+
+    Eigen::Matrix3Xd m_comPosition; /**< CoM position of each rollout (one column per rollout) */
+    Eigen::Matrix3Xd m_comVelocity; /**< CoM velocity of each rollout (one column per rollout) */
+    Eigen::Matrix3Xd m_angularMomentum; /**< Angular momentum of each rollout (one column per
+                                           rollout) */
+
+    Eigen::Matrix3Xd m_comAcceleration; /**< Preallocated buffer containing the CoM acceleration */
+    Eigen::Matrix3Xd m_angularMomentumRate; /**< Preallocated buffer containing the angular
+                                               momentum rate */
+    Eigen::Matrix3Xd m_relativePosition; /**< Preallocated buffer containing the contact point
+                                            position relative to the CoM */
+
+    /** Gravity vector expressed in the inertial frame */
+    Eigen::Vector3d m_gravity{0, 0, -Math::StandardAccelerationOfGravitation};
+    double m_mass{1}; /**< Entire mass of the robot in kg */
+    double m_dTInSeconds{0}; /**< Integration step expressed in seconds */
+    int m_numberOfThreads{1}; /**< Number of threads used to partition the batch */
+
+    bool m_isInitialized{false}; /**< True if initialize has been successfully called */
+};
+
+} // namespace ContinuousDynamicalSystem
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_BATCHED_CENTROIDAL_DYNAMICS_H
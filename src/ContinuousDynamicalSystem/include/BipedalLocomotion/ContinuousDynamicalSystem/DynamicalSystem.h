@@ -58,6 +58,10 @@ namespace ContinuousDynamicalSystem
  * }
  * }
  * \endcode
+ * Optionally, the derived class may expose a `State& mutableState()` accessor returning a mutable
+ * reference to the internal state. When available, the fixed step integrators (e.g. ForwardEuler
+ * and RK4) update the state of the dynamical system in place, avoiding the copy of the full state
+ * tuple at every step boundary.
  */
 template <class _Derived> class DynamicalSystem
 {
@@ -0,0 +1,136 @@
+/**
+ * @file FirstOrderSmootherBank.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_FIRST_ORDER_SMOOTHER_BANK_H
+#define BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_FIRST_ORDER_SMOOTHER_BANK_H
+
+#include <memory>
+#include <vector>
+
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/System/Advanceable.h>
+
+#include <Eigen/Dense>
+
+namespace BipedalLocomotion
+{
+namespace ContinuousDynamicalSystem
+{
+
+/**
+ * FirstOrderSmootherBank implements a bank of first order smoothers sharing one contiguous state
+ * vector. Each channel of the bank behaves as a FirstOrderSmoother, i.e. it implements the ode
+ * \f[
+ * \dot{x} = a (-x + u)
+ * \f]
+ * where \f$a = 3.0/T_{s_5}\f$ and \f$T_{s_5}\f$ is the 5% settling time of the channel. All the
+ * channels are stacked in a single vector and propagated with one vectorized forward Euler step,
+ * so a set of signals filtered with different cutoffs requires a single advance() call instead of
+ * one Advanceable per signal.
+ */
+class FirstOrderSmootherBank
+    : public BipedalLocomotion::System::Advanceable<Eigen::VectorXd, Eigen::VectorXd>
+{
+public:
+    // clang-format off
+    /**
+     * Initialize the bank of smoothers.
+     * @param handler pointer to the parameter handler.
+     * @note the following parameters are required
+     * |   Parameter Name  |        Type        |                            Description                            | Mandatory |
+     * |:-----------------:|:------------------:|:-----------------------------------------------------------------:|:---------:|
+     * |  `sampling_time`  | `chrono::duration` |          Sampling time used to discrete the linear system         |    Yes    |
+     * |  `channel_sizes`  |   `vector<int>`    |              Number of elements of each channel                   |    Yes    |
+     * | `settling_times`  |  `vector<double>`  | 5% settling time of each channel. One element per channel         |    Yes    |
+     * @return true in case of success/false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler) override;
+    // clang-format on
+
+    /**
+     * Set the state of all the channels of the bank.
+     * @param initialState initial state of the bank. The channels are stacked in a single vector.
+     * @return true in case of success, false otherwise.
+     */
+    bool reset(Eigen::Ref<const Eigen::VectorXd> initialState);
+
+    /**
+     * Set the state of a single channel of the bank.
+     * @param channel index of the channel.
+     * @param initialState initial state of the channel.
+     * @note reset() must be called at least once before resetting a single channel.
+     * @return true in case of success, false otherwise.
+     */
+    bool resetChannel(std::size_t channel, Eigen::Ref<const Eigen::VectorXd> initialState);
+
+    /**
+     * @brief Advance all the channels of the bank of one integration step.
+     * @return True in case of success and false otherwise
+     */
+    bool advance() override;
+
+    /**
+     * Get the output of the bank.
+     * @return a vector containing the stacked output of all the channels.
+     */
+    const Eigen::VectorXd& getOutput() const override;
+
+    /**
+     * Get the output of a single channel.
+     * @param channel index of the channel.
+     * @return a view on the portion of the output associated to the channel.
+     */
+    Eigen::Ref<const Eigen::VectorXd> getChannelOutput(std::size_t channel) const;
+
+    /**
+     * @brief Set the input of all the channels of the bank.
+     * @param input the stacked input of all the channels.
+     * @return True in case of success and false otherwise
+     */
+    bool setInput(const Eigen::VectorXd& input) override;
+
+    /**
+     * @brief Set the input of a single channel.
+     * @param channel index of the channel.
+     * @param input the input of the channel.
+     * @return True in case of success and false otherwise
+     */
+    bool setChannelInput(std::size_t channel, Eigen::Ref<const Eigen::VectorXd> input);
+
+    /**
+     * Get the number of channels of the bank.
+     * @return the number of channels.
+     */
+    std::size_t numberOfChannels() const;
+
+    /**
+     * Determines the validity of the object retrieved with getOutput()
+     * @return True if the object is valid, false otherwise.
+     */
+    bool isOutputValid() const override;
+
+private:
+    bool m_isInitialized{false};
+    bool m_isInitialStateSet{false};
+    bool m_isOutputValid{false};
+
+    double m_dTInSeconds{0}; /**< Integration step expressed in seconds */
+
+    std::vector<Eigen::Index> m_offsets; /**< Offset of each channel in the stacked vectors */
+    std::vector<Eigen::Index> m_sizes; /**< Number of elements of each channel */
+
+    Eigen::VectorXd m_gains; /**< Element-wise gains, i.e. 3 / settling_time of each channel
+                                repeated for all its elements */
+    Eigen::VectorXd m_state; /**< Stacked state of all the channels */
+    Eigen::VectorXd m_input; /**< Stacked input of all the channels */
+    Eigen::VectorXd m_output; /**< Stacked output of all the channels */
+};
+
+} // namespace ContinuousDynamicalSystem
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_FIRST_ORDER_SMOOTHER_BANK_H
@@ -144,6 +144,14 @@ public:
      */
     const State& getState() const;
 
+    /**
+     * Get a mutable reference to the state of the dynamical system.
+     * @note This accessor allows the integrators to update the state in place, avoiding the copy
+     * of the full state tuple at every step boundary.
+     * @return a mutable reference to the current state of the dynamical system.
+     */
+    State& mutableState();
+
     /**
      * Set the control input to the dynamical system.
      * @param controlInput the value of the control input used to compute the system dynamics.
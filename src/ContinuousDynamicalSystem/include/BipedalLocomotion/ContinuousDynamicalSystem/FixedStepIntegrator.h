@@ -10,6 +10,8 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <ratio>
 
 #include <BipedalLocomotion/ContinuousDynamicalSystem/Integrator.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
@@ -30,6 +32,29 @@ namespace BipedalLocomotion
 namespace ContinuousDynamicalSystem
 {
 
+/**
+ * FixedTimeStep describes an integration step known at compile time. It can be passed as
+ * additional template parameter to the integrators supporting it (e.g. ForwardEuler and RK4). In
+ * this case the arithmetic performed in `oneStepIntegration()` involves only compile time
+ * constants and the runtime conversion from std::chrono to seconds disappears from the hot path.
+ * The step is expressed as the rational number `_Num / _Den` in seconds, for instance
+ * `FixedTimeStep<1, 1000>` describes an integration performed at 1 kHz.
+ * @tparam _Num numerator of the integration step expressed in seconds.
+ * @tparam _Den denominator of the integration step expressed in seconds.
+ */
+template <std::intmax_t _Num, std::intmax_t _Den = 1> struct FixedTimeStep
+{
+    static_assert(_Num > 0 && _Den > 0, "The integration step must be a strict positive number.");
+
+    /** Integration step */
+    static constexpr std::chrono::nanoseconds value
+        = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<std::intmax_t, std::ratio<_Num, _Den>>(1));
+
+    /** Integration step converted in seconds */
+    static constexpr double valueInSeconds = static_cast<double>(_Num) / static_cast<double>(_Den);
+};
+
 /**
  * Fixed step integrator base class. Please inherit publicly from this class in order to specify a
  * custom integration method. The custom integration method must define a method called
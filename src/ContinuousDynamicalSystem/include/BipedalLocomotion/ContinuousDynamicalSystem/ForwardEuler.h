@@ -21,11 +21,11 @@ namespace BipedalLocomotion
 {
 namespace ContinuousDynamicalSystem
 {
-template <typename _DynamicalSystem> class ForwardEuler;
+template <typename _DynamicalSystem, typename _TimeStep = void> class ForwardEuler;
 }
 }
 
-BLF_DEFINE_INTEGRATOR_STRUCTURE(ForwardEuler, _DynamicalSystemType)
+BLF_DEFINE_FIXED_TIME_STEP_INTEGRATOR_STRUCTURE(ForwardEuler, _DynamicalSystemType, _TimeStepType)
 
 namespace BipedalLocomotion
 {
@@ -36,6 +36,11 @@ namespace ContinuousDynamicalSystem
 /**
  * Forward Euler integration method.
  * @tparam _DynamicalSystem a class derived from DynamicalSystem
+ * @tparam _TimeStep an optional FixedTimeStep describing an integration step known at compile
+ * time. When provided, the integration step is initialized accordingly and the arithmetic
+ * performed in oneStepIntegration() involves only compile time constants, i.e. the runtime
+ * conversion from std::chrono to seconds disappears from the hot path. For instance
+ * `ForwardEuler<MySystem, FixedTimeStep<1, 1000>>` integrates at 1 kHz.
  * @warning We assume that the operator + is defined for the objects contained in the
  * DynamicalSystem::State and DynamicalSystem::StateDerivative.
  * @warning The ForwardEuler integrator is compatible with Lie groups defined by the `manif` library.
@@ -46,13 +51,15 @@ namespace ContinuousDynamicalSystem
  * \f]
  * where \f$X\f$ belongs to a Lie group and \f$\psi\f$ belongs to the tangent space.
  */
-template <class _DynamicalSystem>
-class ForwardEuler : public FixedStepIntegrator<ForwardEuler<_DynamicalSystem>>
+template <class _DynamicalSystem, class _TimeStep>
+class ForwardEuler : public FixedStepIntegrator<ForwardEuler<_DynamicalSystem, _TimeStep>>
 {
 public:
-    using DynamicalSystem = typename internal::traits<ForwardEuler<_DynamicalSystem>>::DynamicalSystem;
-    using State = typename internal::traits<ForwardEuler<_DynamicalSystem>>::State;
-    using StateDerivative = typename internal::traits<ForwardEuler<_DynamicalSystem>>::StateDerivative;
+    using DynamicalSystem =
+        typename internal::traits<ForwardEuler<_DynamicalSystem, _TimeStep>>::DynamicalSystem;
+    using State = typename internal::traits<ForwardEuler<_DynamicalSystem, _TimeStep>>::State;
+    using StateDerivative =
+        typename internal::traits<ForwardEuler<_DynamicalSystem, _TimeStep>>::StateDerivative;
 
 private:
 
@@ -64,26 +71,45 @@ private:
 
     template <std::size_t I = 0>
     inline typename std::enable_if<I == std::tuple_size<State>::value, void>::type
-    addArea(const StateDerivative& dx, const std::chrono::nanoseconds& dT, State& x)
+    addArea(const StateDerivative& dx, const double& dTInSeconds, State& x)
     {
         static_assert(std::tuple_size<State>::value == std::tuple_size<StateDerivative>::value);
     }
 
     template <std::size_t I = 0>
     inline typename std::enable_if<(I < std::tuple_size<State>::value), void>::type
-    addArea(const StateDerivative& dx, const std::chrono::nanoseconds& dT, State& x)
+    addArea(const StateDerivative& dx, const double& dTInSeconds, State& x)
     {
         static_assert(std::tuple_size<State>::value == std::tuple_size<StateDerivative>::value);
 
         // the order matters since we assume that all the velocities are left trivialized.
         using std::get;
 
-        // convert the dT in seconds
-        get<I>(x) = (get<I>(dx) * std::chrono::duration<double>(dT).count()) + get<I>(x);
-        addArea<I + 1>(dx, dT, x);
+        get<I>(x) = (get<I>(dx) * dTInSeconds) + get<I>(x);
+        addArea<I + 1>(dx, dTInSeconds, x);
     }
 
+    /**
+     * Integrate one step given the integration step already converted in seconds.
+     * @param t0 initial time.
+     * @param dTInSeconds sampling time expressed in seconds.
+     * @return true in case of success, false otherwise.
+     */
+    bool oneStepIntegrationImpl(const std::chrono::nanoseconds& t0, const double& dTInSeconds);
+
 public:
+    /**
+     * Constructor. If the integration step is provided at compile time through the _TimeStep
+     * template parameter, it is used to initialize the integration step.
+     */
+    ForwardEuler()
+    {
+        if constexpr (!std::is_void_v<_TimeStep>)
+        {
+            this->m_dT = _TimeStep::value;
+        }
+    }
+
     /**
      * Integrate one step.
      * @param t0 initial time.
@@ -93,9 +119,27 @@ public:
     bool oneStepIntegration(const std::chrono::nanoseconds& t0, const std::chrono::nanoseconds& dT);
 };
 
-template <class _DynamicalSystem>
-bool ForwardEuler<_DynamicalSystem>::oneStepIntegration(const std::chrono::nanoseconds& t0,
-                                                        const std::chrono::nanoseconds& dT)
+template <class _DynamicalSystem, class _TimeStep>
+bool ForwardEuler<_DynamicalSystem, _TimeStep>::oneStepIntegration(
+    const std::chrono::nanoseconds& t0, const std::chrono::nanoseconds& dT)
+{
+    if constexpr (!std::is_void_v<_TimeStep>)
+    {
+        // when the actual step matches the one provided at compile time the integration
+        // arithmetic is evaluated on a compile time constant. The last step performed by
+        // FixedStepIntegrator::integrate() may be shorter and falls back to the runtime path
+        if (dT == _TimeStep::value)
+        {
+            return this->oneStepIntegrationImpl(t0, _TimeStep::valueInSeconds);
+        }
+    }
+
+    return this->oneStepIntegrationImpl(t0, std::chrono::duration<double>(dT).count());
+}
+
+template <class _DynamicalSystem, class _TimeStep>
+bool ForwardEuler<_DynamicalSystem, _TimeStep>::oneStepIntegrationImpl(
+    const std::chrono::nanoseconds& t0, const double& dTInSeconds)
 {
     constexpr auto errorPrefix = "[ForwardEuler::oneStepIntegration]";
     if (this->m_dynamicalSystem == nullptr)
@@ -111,13 +155,25 @@ bool ForwardEuler<_DynamicalSystem>::oneStepIntegration(const std::chrono::nanos
     }
 
     // x = dT * dx + x0
-    this->m_computationalBufferState = this->m_dynamicalSystem->getState();
-    this->addArea(this->m_computationalBufferStateDerivative, dT, this->m_computationalBufferState);
-
-    if (!this->m_dynamicalSystem->setState(this->m_computationalBufferState))
+    if constexpr (internal::has_mutable_state<DynamicalSystem>::value)
     {
-        log()->error("{} Unable to set the new state in the dynamical system.", errorPrefix);
-        return false;
+        // the dynamical system exposes a mutable state: the integration is performed in place
+        // avoiding the copy of the full state tuple
+        this->addArea(this->m_computationalBufferStateDerivative,
+                      dTInSeconds,
+                      this->m_dynamicalSystem->mutableState());
+    } else
+    {
+        this->m_computationalBufferState = this->m_dynamicalSystem->getState();
+        this->addArea(this->m_computationalBufferStateDerivative,
+                      dTInSeconds,
+                      this->m_computationalBufferState);
+
+        if (!this->m_dynamicalSystem->setState(this->m_computationalBufferState))
+        {
+            log()->error("{} Unable to set the new state in the dynamical system.", errorPrefix);
+            return false;
+        }
     }
 
     return true;
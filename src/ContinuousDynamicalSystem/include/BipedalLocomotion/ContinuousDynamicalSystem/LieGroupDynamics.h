@@ -105,6 +105,17 @@ public:
         return m_state;
     }
 
+    /**
+     * Get a mutable reference to the state of the dynamical system.
+     * @note This accessor allows the integrators to update the state in place, avoiding the copy
+     * of the full state tuple at every step boundary.
+     * @return a mutable reference to the current state of the dynamical system.
+     */
+    State& mutableState()
+    {
+        return m_state;
+    }
+
     /**
      * Set the control input to the dynamical system.
      * @param controlInput the value of the control input used to compute the system dynamics.
@@ -104,6 +104,14 @@ public:
      */
     const State& getState() const;
 
+    /**
+     * Get a mutable reference to the state of the dynamical system.
+     * @note This accessor allows the integrators to update the state in place, avoiding the copy
+     * of the full state tuple at every step boundary.
+     * @return a mutable reference to the current state of the dynamical system.
+     */
+    State& mutableState();
+
     /**
      * Set the control input to the dynamical system.
      * @note In principle, there is no need to override this method. This value is stored in an
@@ -45,6 +45,7 @@ public:
      * |    `states`      | `vector<string>` |  Vector associated to the names of the state stored in the provider  |    Yes    |
      * |  `sampling_time`  | `double` | Sampling time used to discrete the linear system |     Yes    |
      * |  `settling_time`  | `double` | 5% settling time (The settling time, \f$T_s\f$, is the time required for the system output to fall within a certain percentage (i.e. 5%) of the steady-state value for a step input.) |    Yes    |
+     * | `convergence_tolerance` | `double` | Threshold on the infinity norm of the difference between the smoothed weight and its target below which the propagation is frozen until the next setState call. If not defined 1e-6 is used. |    No    |
      *
      * For each `state` defined in `states`, you should define a Group called `state` that contains the following parameters
      * |  Parameter Name  |        Type      |                              Description                          | Mandatory |
@@ -90,6 +91,16 @@ private:
     std::unordered_map<std::string, Eigen::VectorXd> m_states; /**< Map representing the states of
                                                                    the provider */
     FirstOrderSmoother m_smoother; /**< Smoother required to perform the weight scheduling */
+
+    Eigen::VectorXd m_targetWeight; /**< Weight associated to the current state */
+
+    /** Threshold on the infinity norm of the difference between the smoothed weight and its
+     * target below which the propagation is frozen */
+    double m_convergenceTolerance{1e-6};
+
+    bool m_isInSteadyState{false}; /**< True when the smoother converged to the target weight */
+    bool m_isOutputValid{false}; /**< True if advance has been successfully called at least once
+                                    since the last reset */
 };
 
 BLF_REGISTER_WEIGHT_PROVIDER(MultiStateWeightProvider);
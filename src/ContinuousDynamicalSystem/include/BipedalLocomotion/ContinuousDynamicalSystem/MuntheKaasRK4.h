@@ -0,0 +1,251 @@
+/**
+ * @file MuntheKaasRK4.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_MUNTHE_KAAS_RK4_H
+#define BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_MUNTHE_KAAS_RK4_H
+
+#include <chrono>
+#include <type_traits>
+
+#include <BipedalLocomotion/ContinuousDynamicalSystem/FixedStepIntegrator.h>
+#include <BipedalLocomotion/ContinuousDynamicalSystem/LieGroupDynamics.h>
+#include <BipedalLocomotion/GenericContainer/NamedTuple.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace BipedalLocomotion
+{
+namespace ContinuousDynamicalSystem
+{
+template <typename _DynamicalSystem, typename _TimeStep = void> class MuntheKaasRK4;
+}
+} // namespace BipedalLocomotion
+
+BLF_DEFINE_FIXED_TIME_STEP_INTEGRATOR_STRUCTURE(MuntheKaasRK4, _DynamicalSystemType, _TimeStepType)
+
+namespace BipedalLocomotion::ContinuousDynamicalSystem::internal
+{
+
+/** is_lie_group_dynamics is a utility used to detect a LieGroupDynamics specialization. */
+template <typename T> struct is_lie_group_dynamics : std::false_type
+{
+};
+
+template <typename _Derived>
+struct is_lie_group_dynamics<LieGroupDynamics<_Derived>> : std::true_type
+{
+};
+
+/** lie_group_dynamics_group extracts the Lie group handled by a LieGroupDynamics
+ * specialization. */
+template <typename T> struct lie_group_dynamics_group;
+
+template <typename _Derived> struct lie_group_dynamics_group<LieGroupDynamics<_Derived>>
+{
+    using type = _Derived;
+};
+
+} // namespace BipedalLocomotion::ContinuousDynamicalSystem::internal
+
+namespace BipedalLocomotion
+{
+namespace ContinuousDynamicalSystem
+{
+
+/**
+ * MuntheKaasRK4 implements the 4-th order Runge-Kutta-Munthe-Kaas integration method for a
+ * dynamical system evolving on a Lie group \f$G\f$. Given the left trivialized dynamics
+ * \f[
+ * \dot{X} = \psi ^ \wedge X
+ * \f]
+ * the integrator solves the associated tangent space differential equation
+ * \f[
+ * \dot{\sigma} = J_l^{-1}(\sigma) \psi
+ * \f]
+ * with \f$\sigma(0) = 0\f$ using a classical Runge-Kutta 4 scheme, where \f$J_l^{-1}\f$ is the
+ * inverse of the left Jacobian of \f$G\f$, and finally reconstructs the group element as
+ * \f[
+ * X_{k+1} = \exp(\sigma) X_k
+ * \f]
+ * All the internal stages are evaluated in the tangent space, i.e. a single exponential map is
+ * required per integration step. As a comparison, integrating the same system with the generic
+ * machinery requires one exponential per stage. Since the dynamics implemented by
+ * LieGroupDynamics does not depend on the group element, the intermediate stages do not need to
+ * reconstruct the state and only the inverse left Jacobian is evaluated.
+ * @tparam _DynamicalSystem a LieGroupDynamics specialization (e.g. SO3Dynamics).
+ * @tparam _TimeStep an optional FixedTimeStep describing an integration step known at compile
+ * time. When provided, the integration step is initialized accordingly and the stage combination
+ * arithmetic performed in oneStepIntegration() involves only compile time constants. For instance
+ * `MuntheKaasRK4<SO3Dynamics, FixedTimeStep<1, 1000>>` integrates at 1 kHz.
+ */
+template <class _DynamicalSystem, class _TimeStep>
+class MuntheKaasRK4 : public FixedStepIntegrator<MuntheKaasRK4<_DynamicalSystem, _TimeStep>>
+{
+    static_assert(internal::is_lie_group_dynamics<_DynamicalSystem>::value,
+                  "MuntheKaasRK4 supports only dynamical systems of type LieGroupDynamics.");
+
+public:
+    using DynamicalSystem =
+        typename internal::traits<MuntheKaasRK4<_DynamicalSystem, _TimeStep>>::DynamicalSystem;
+    using State = typename internal::traits<MuntheKaasRK4<_DynamicalSystem, _TimeStep>>::State;
+    using StateDerivative =
+        typename internal::traits<MuntheKaasRK4<_DynamicalSystem, _TimeStep>>::StateDerivative;
+
+    /** Lie group handled by the dynamical system */
+    using LieGroup = typename internal::lie_group_dynamics_group<_DynamicalSystem>::type;
+
+    /** Element of the tangent space of the Lie group */
+    using Tangent = typename LieGroup::Tangent;
+
+private:
+    /** Temporary buffers usefully to avoid continuous memory allocation */
+    StateDerivative m_k1;
+    StateDerivative m_k2;
+    StateDerivative m_k3;
+    StateDerivative m_k4;
+
+    /** Tangent space increment accumulated during the step */
+    Tangent m_sigma;
+
+    /** Temporary buffer containing the state when the dynamical system does not expose a mutable
+     * state */
+    State m_computationalBufferState;
+
+    /**
+     * Integrate one step given the integration step already converted in seconds.
+     * @param t0 initial time.
+     * @param dTInSeconds sampling time expressed in seconds.
+     * @return true in case of success, false otherwise.
+     */
+    bool oneStepIntegrationImpl(const std::chrono::nanoseconds& t0, const double& dTInSeconds);
+
+public:
+    /**
+     * Constructor. If the integration step is provided at compile time through the _TimeStep
+     * template parameter, it is used to initialize the integration step.
+     */
+    MuntheKaasRK4()
+    {
+        if constexpr (!std::is_void_v<_TimeStep>)
+        {
+            this->m_dT = _TimeStep::value;
+        }
+    }
+
+    /**
+     * Integrate one step.
+     * @param t0 initial time.
+     * @param dT sampling time.
+     * @return true in case of success, false otherwise.
+     */
+    bool oneStepIntegration(const std::chrono::nanoseconds& t0, const std::chrono::nanoseconds& dT);
+};
+
+template <class _DynamicalSystem, class _TimeStep>
+bool MuntheKaasRK4<_DynamicalSystem, _TimeStep>::oneStepIntegration(
+    const std::chrono::nanoseconds& t0, const std::chrono::nanoseconds& dT)
+{
+    if constexpr (!std::is_void_v<_TimeStep>)
+    {
+        // when the actual step matches the one provided at compile time the stage combination
+        // arithmetic is evaluated on a compile time constant. The last step performed by
+        // FixedStepIntegrator::integrate() may be shorter and falls back to the runtime path
+        if (dT == _TimeStep::value)
+        {
+            return this->oneStepIntegrationImpl(t0, _TimeStep::valueInSeconds);
+        }
+    }
+
+    return this->oneStepIntegrationImpl(t0, std::chrono::duration<double>(dT).count());
+}
+
+template <class _DynamicalSystem, class _TimeStep>
+bool MuntheKaasRK4<_DynamicalSystem, _TimeStep>::oneStepIntegrationImpl(
+    const std::chrono::nanoseconds& t0, const double& dTInSeconds)
+{
+    using namespace BipedalLocomotion::GenericContainer::literals;
+
+    constexpr auto errorPrefix = "[MuntheKaasRK4::oneStepIntegration]";
+    const double halfDTInSeconds = dTInSeconds / 2;
+
+    if (this->m_dynamicalSystem == nullptr)
+    {
+        log()->error("{} Please specify the dynamical system.", errorPrefix);
+        return false;
+    }
+
+    // evaluate k1
+    // sigma_1 is equal to zero, hence the inverse left Jacobian is the identity
+    if (!this->m_dynamicalSystem->dynamics(t0, this->m_k1))
+    {
+        log()->error("{} Unable to compute the system dynamics while evaluating k1.", errorPrefix);
+        return false;
+    }
+    const auto& k1 = this->m_k1.template get_from_hash<"Tangent"_h>();
+
+    // evaluate k2
+    // sigma_2 = dT / 2 * k1
+    this->m_sigma = k1 * halfDTInSeconds;
+    if (!this->m_dynamicalSystem->dynamics(t0, this->m_k2))
+    {
+        log()->error("{} Unable to compute the system dynamics while evaluating k2.", errorPrefix);
+        return false;
+    }
+    auto& k2 = this->m_k2.template get_from_hash<"Tangent"_h>();
+    k2 = Tangent(this->m_sigma.ljacinv() * k2.coeffs());
+
+    // evaluate k3
+    // sigma_3 = dT / 2 * k2
+    this->m_sigma = k2 * halfDTInSeconds;
+    if (!this->m_dynamicalSystem->dynamics(t0, this->m_k3))
+    {
+        log()->error("{} Unable to compute the system dynamics while evaluating k3.", errorPrefix);
+        return false;
+    }
+    auto& k3 = this->m_k3.template get_from_hash<"Tangent"_h>();
+    k3 = Tangent(this->m_sigma.ljacinv() * k3.coeffs());
+
+    // evaluate k4
+    // sigma_4 = dT * k3
+    this->m_sigma = k3 * dTInSeconds;
+    if (!this->m_dynamicalSystem->dynamics(t0, this->m_k4))
+    {
+        log()->error("{} Unable to compute the system dynamics while evaluating k4.", errorPrefix);
+        return false;
+    }
+    auto& k4 = this->m_k4.template get_from_hash<"Tangent"_h>();
+    k4 = Tangent(this->m_sigma.ljacinv() * k4.coeffs());
+
+    // combine the stages in the tangent space and reconstruct the group element with a single
+    // exponential
+    this->m_sigma = (k1 + 2 * k2 + 2 * k3 + k4) * (dTInSeconds / 6);
+
+    if constexpr (internal::has_mutable_state<DynamicalSystem>::value)
+    {
+        auto& element
+            = this->m_dynamicalSystem->mutableState().template get_from_hash<"LieGroup"_h>();
+        element = this->m_sigma + element;
+    } else
+    {
+        this->m_computationalBufferState = this->m_dynamicalSystem->getState();
+        auto& element
+            = this->m_computationalBufferState.template get_from_hash<"LieGroup"_h>();
+        element = this->m_sigma + element;
+
+        if (!this->m_dynamicalSystem->setState(this->m_computationalBufferState))
+        {
+            log()->error("{} Unable to set the new state in the dynamical system.", errorPrefix);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace ContinuousDynamicalSystem
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_MUNTHE_KAAS_RK4_H
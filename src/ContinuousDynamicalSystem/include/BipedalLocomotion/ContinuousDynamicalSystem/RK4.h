@@ -21,11 +21,11 @@ namespace BipedalLocomotion
 {
 namespace ContinuousDynamicalSystem
 {
-template <typename _DynamicalSystem> class RK4;
+template <typename _DynamicalSystem, typename _TimeStep = void> class RK4;
 }
 } // namespace BipedalLocomotion
 
-BLF_DEFINE_INTEGRATOR_STRUCTURE(RK4, _DynamicalSystemType)
+BLF_DEFINE_FIXED_TIME_STEP_INTEGRATOR_STRUCTURE(RK4, _DynamicalSystemType, _TimeStepType)
 
 namespace BipedalLocomotion
 {
@@ -50,18 +50,26 @@ namespace ContinuousDynamicalSystem
  * where \f$x_k\f$ is the state at time \f$t_k\f$, \f$u_k\f$ is the input at time \f$t_k\f$ and
  * \f$dt\f$ is the sampling time.
  * @tparam _DynamicalSystem a class derived from DynamicalSystem
+ * @tparam _TimeStep an optional FixedTimeStep describing an integration step known at compile
+ * time. When provided, the integration step is initialized accordingly and the stage combination
+ * arithmetic performed in oneStepIntegration() involves only compile time constants, i.e. the
+ * runtime conversion from std::chrono to seconds disappears from the hot path. For instance
+ * `RK4<MySystem, FixedTimeStep<1, 1000>>` integrates at 1 kHz.
  * @warning We assume that the operator + is defined for the objects contained in the
  * DynamicalSystem::State and DynamicalSystem::StateDerivative.
  * @warning The RK4 integrator is compatible only with tuple containing vectors belonging to the
  * \f$R^n\f$ space. It is not compatible with Lie groups. If you want to integrate a dynamical
  * system defined on a Lie group please use the ForwardEuler integrator.
  */
-template <class _DynamicalSystem> class RK4 : public FixedStepIntegrator<RK4<_DynamicalSystem>>
+template <class _DynamicalSystem, class _TimeStep>
+class RK4 : public FixedStepIntegrator<RK4<_DynamicalSystem, _TimeStep>>
 {
 public:
-    using DynamicalSystem = typename internal::traits<RK4<_DynamicalSystem>>::DynamicalSystem;
-    using State = typename internal::traits<RK4<_DynamicalSystem>>::State;
-    using StateDerivative = typename internal::traits<RK4<_DynamicalSystem>>::StateDerivative;
+    using DynamicalSystem =
+        typename internal::traits<RK4<_DynamicalSystem, _TimeStep>>::DynamicalSystem;
+    using State = typename internal::traits<RK4<_DynamicalSystem, _TimeStep>>::State;
+    using StateDerivative =
+        typename internal::traits<RK4<_DynamicalSystem, _TimeStep>>::StateDerivative;
 
 private:
     /** Temporary buffer usefully to avoid continuous memory allocation */
@@ -70,29 +78,31 @@ private:
     StateDerivative m_k3;
     StateDerivative m_k4;
 
-    /** Temporary buffer usefully to avoid continuous memory allocation */
-    State m_computationalBufferState1;
-    State m_computationalBufferState2;
-    State m_computationalBufferState3;
-    State m_computationalBufferState4;
+    /** Temporary buffer usefully to avoid continuous memory allocation. It contains the state at
+     * the beginning of the step */
+    State m_computationalBufferInitialState;
+
+    /** Temporary buffer usefully to avoid continuous memory allocation. It contains the
+     * intermediate stage states when the dynamical system does not expose a mutable state */
+    State m_computationalBufferState;
 
     template <std::size_t I = 0>
     inline typename std::enable_if<I == std::tuple_size<State>::value, void>::type
-    computeNextState(const StateDerivative& k, const std::chrono::nanoseconds& dT, State& x)
+    computeNextState(const State& x0, const StateDerivative& k, const double& dTInSeconds, State& x)
     {
     }
 
     template <std::size_t I = 0>
     inline typename std::enable_if<(I < std::tuple_size<State>::value), void>::type
-    computeNextState(const StateDerivative& k, const std::chrono::nanoseconds& dT, State& x)
+    computeNextState(const State& x0, const StateDerivative& k, const double& dTInSeconds, State& x)
     {
         static_assert(std::tuple_size<State>::value == std::tuple_size<StateDerivative>::value);
 
         using std::get;
 
-        // convert the dT in seconds and compute the next state
-        get<I>(x) = (get<I>(k) * std::chrono::duration<double>(dT).count()) + get<I>(x);
-        computeNextState<I + 1>(k, dT, x);
+        // compute the next state
+        get<I>(x) = (get<I>(k) * dTInSeconds) + get<I>(x0);
+        computeNextState<I + 1>(x0, k, dTInSeconds, x);
     }
 
     template <std::size_t I = 0>
@@ -101,7 +111,8 @@ private:
                  const StateDerivative& k2,
                  const StateDerivative& k3,
                  const StateDerivative& k4,
-                 const std::chrono::nanoseconds& dT,
+                 const State& x0,
+                 const double& dTInSeconds,
                  State& x)
     {
     }
@@ -112,22 +123,40 @@ private:
                  const StateDerivative& k2,
                  const StateDerivative& k3,
                  const StateDerivative& k4,
-                 const std::chrono::nanoseconds& dT,
+                 const State& x0,
+                 const double& dTInSeconds,
                  State& x)
     {
         static_assert(std::tuple_size<State>::value == std::tuple_size<StateDerivative>::value);
         using std::get;
 
-        // convert the dT in seconds
-        const double dTInSeconds = std::chrono::duration<double>(dT).count();
-
         // complete the RK4 integration
-        get<I>(x) = get<I>(x)
+        get<I>(x) = get<I>(x0)
                     + dTInSeconds / 6 * (get<I>(k1) + 2 * get<I>(k2) + 2 * get<I>(k3) + get<I>(k4));
-        this->integrateRK4<I + 1>(k1, k2, k3, k4, dT, x);
+        this->integrateRK4<I + 1>(k1, k2, k3, k4, x0, dTInSeconds, x);
     }
 
+    /**
+     * Integrate one step given the integration step already converted in seconds.
+     * @param t0 initial time.
+     * @param dTInSeconds sampling time expressed in seconds.
+     * @return true in case of success, false otherwise.
+     */
+    bool oneStepIntegrationImpl(const std::chrono::nanoseconds& t0, const double& dTInSeconds);
+
 public:
+    /**
+     * Constructor. If the integration step is provided at compile time through the _TimeStep
+     * template parameter, it is used to initialize the integration step.
+     */
+    RK4()
+    {
+        if constexpr (!std::is_void_v<_TimeStep>)
+        {
+            this->m_dT = _TimeStep::value;
+        }
+    }
+
     /**
      * Integrate one step.
      * @param t0 initial time.
@@ -137,22 +166,58 @@ public:
     bool oneStepIntegration(const std::chrono::nanoseconds& t0, const std::chrono::nanoseconds& dT);
 };
 
-template <class _DynamicalSystem>
-bool RK4<_DynamicalSystem>::oneStepIntegration(const std::chrono::nanoseconds& t0,
-                                               const std::chrono::nanoseconds& dT)
+template <class _DynamicalSystem, class _TimeStep>
+bool RK4<_DynamicalSystem, _TimeStep>::oneStepIntegration(const std::chrono::nanoseconds& t0,
+                                                          const std::chrono::nanoseconds& dT)
+{
+    if constexpr (!std::is_void_v<_TimeStep>)
+    {
+        // when the actual step matches the one provided at compile time the stage combination
+        // arithmetic is evaluated on a compile time constant. The last step performed by
+        // FixedStepIntegrator::integrate() may be shorter and falls back to the runtime path
+        if (dT == _TimeStep::value)
+        {
+            return this->oneStepIntegrationImpl(t0, _TimeStep::valueInSeconds);
+        }
+    }
+
+    return this->oneStepIntegrationImpl(t0, std::chrono::duration<double>(dT).count());
+}
+
+template <class _DynamicalSystem, class _TimeStep>
+bool RK4<_DynamicalSystem, _TimeStep>::oneStepIntegrationImpl(const std::chrono::nanoseconds& t0,
+                                                              const double& dTInSeconds)
 {
     constexpr auto errorPrefix = "[RK4::oneStepIntegration]";
+    const double halfDTInSeconds = dTInSeconds / 2;
     if (this->m_dynamicalSystem == nullptr)
     {
         log()->error("{} Please specify the dynamical system.", errorPrefix);
         return false;
     }
 
-    // copy the state 4 times since we need to compute the k1, k2, k3 and k4
-    this->m_computationalBufferState1 = this->m_dynamicalSystem->getState();
-    this->m_computationalBufferState2 = this->m_dynamicalSystem->getState();
-    this->m_computationalBufferState3 = this->m_dynamicalSystem->getState();
-    this->m_computationalBufferState4 = this->m_dynamicalSystem->getState();
+    // copy the state once since we need to compute the stage states from x0. When the dynamical
+    // system exposes a mutable state, the stage states are written directly into it, otherwise
+    // they are computed in a preallocated buffer and copied with setState()
+    this->m_computationalBufferInitialState = this->m_dynamicalSystem->getState();
+
+    auto setStageState = [this](const StateDerivative& k, const double& weight) -> bool {
+        if constexpr (internal::has_mutable_state<DynamicalSystem>::value)
+        {
+            this->computeNextState(this->m_computationalBufferInitialState,
+                                   k,
+                                   weight,
+                                   this->m_dynamicalSystem->mutableState());
+            return true;
+        } else
+        {
+            this->computeNextState(this->m_computationalBufferInitialState,
+                                   k,
+                                   weight,
+                                   this->m_computationalBufferState);
+            return this->m_dynamicalSystem->setState(this->m_computationalBufferState);
+        }
+    };
 
     // evaluate k1
     // k1 = f(x0, u0)
@@ -164,8 +229,7 @@ bool RK4<_DynamicalSystem>::oneStepIntegration(const std::chrono::nanoseconds& t
 
     // evaluate k2
     // k2 = f(x0 + dt / 2 * k1, u0);
-    this->computeNextState(this->m_k1, dT / 2, this->m_computationalBufferState2);
-    if (!this->m_dynamicalSystem->setState(this->m_computationalBufferState2))
+    if (!setStageState(this->m_k1, halfDTInSeconds))
     {
         log()->error("{} Unable to set the new state in the dynamical system required to evaluate "
                      "k2.",
@@ -181,8 +245,7 @@ bool RK4<_DynamicalSystem>::oneStepIntegration(const std::chrono::nanoseconds& t
 
     // evaluate k3
     // k3 = f(x0 + dt / 2 * k2, u0);
-    this->computeNextState(this->m_k2, dT / 2, this->m_computationalBufferState3);
-    if (!this->m_dynamicalSystem->setState(this->m_computationalBufferState3))
+    if (!setStageState(this->m_k2, halfDTInSeconds))
     {
         log()->error("{} Unable to set the new state in the dynamical system required to evaluate "
                      "k3.",
@@ -198,8 +261,7 @@ bool RK4<_DynamicalSystem>::oneStepIntegration(const std::chrono::nanoseconds& t
 
     // evaluate k4
     // k4 = f(x0 + dt * k3, u0);
-    this->computeNextState(this->m_k3, dT, this->m_computationalBufferState4);
-    if (!this->m_dynamicalSystem->setState(this->m_computationalBufferState4))
+    if (!setStageState(this->m_k3, dTInSeconds))
     {
         log()->error("{} Unable to set the new state in the dynamical system required to evaluate "
                      "k4.",
@@ -214,16 +276,29 @@ bool RK4<_DynamicalSystem>::oneStepIntegration(const std::chrono::nanoseconds& t
     }
 
     // compute the integration
-    this->integrateRK4(this->m_k1,
-                       this->m_k2,
-                       this->m_k3,
-                       this->m_k4,
-                       dT,
-                       this->m_computationalBufferState1);
-    if (!this->m_dynamicalSystem->setState(this->m_computationalBufferState1))
-    {
-        log()->error("{} Unable to set the new state in the dynamical system.", errorPrefix);
-        return false;
+    if constexpr (internal::has_mutable_state<DynamicalSystem>::value)
+    {
+        this->integrateRK4(this->m_k1,
+                           this->m_k2,
+                           this->m_k3,
+                           this->m_k4,
+                           this->m_computationalBufferInitialState,
+                           dTInSeconds,
+                           this->m_dynamicalSystem->mutableState());
+    } else
+    {
+        this->integrateRK4(this->m_k1,
+                           this->m_k2,
+                           this->m_k3,
+                           this->m_k4,
+                           this->m_computationalBufferInitialState,
+                           dTInSeconds,
+                           this->m_computationalBufferInitialState);
+        if (!this->m_dynamicalSystem->setState(this->m_computationalBufferInitialState))
+        {
+            log()->error("{} Unable to set the new state in the dynamical system.", errorPrefix);
+            return false;
+        }
     }
 
     return true;
@@ -0,0 +1,408 @@
+/**
+ * @file RK45.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_RK45_H
+#define BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_RK45_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include <iDynTree/Core/EigenHelpers.h>
+
+#include <BipedalLocomotion/ContinuousDynamicalSystem/Integrator.h>
+#include <BipedalLocomotion/GenericContainer/NamedTuple.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace BipedalLocomotion
+{
+namespace ContinuousDynamicalSystem
+{
+template <typename _DynamicalSystem> class RK45;
+}
+} // namespace BipedalLocomotion
+
+BLF_DEFINE_INTEGRATOR_STRUCTURE(RK45, _DynamicalSystemType)
+
+namespace BipedalLocomotion
+{
+namespace ContinuousDynamicalSystem
+{
+
+/**
+ * RK45 implements the embedded Runge-Kutta 4(5) integration method with the Dormand-Prince
+ * coefficients. At every step the method computes a 5th order solution together with a 4th order
+ * error estimate. The step size is adapted so that the scaled error
+ * \f[
+ * \sqrt{\frac{1}{n} \sum_i \left( \frac{e_i}{a_{tol} + r_{tol} \max(|x_i|, |\hat{x}_i|)}
+ * \right)^2}
+ * \f]
+ * stays below one: large steps are taken when the dynamics is smooth while the step shrinks in
+ * the stiff phases (e.g. at the impact instants of a compliant contact model). The step size is
+ * clamped in the interval provided with setStepSizeBounds(). When the error cannot be reduced
+ * below the tolerance with the minimum step, the step is accepted anyway to guarantee progress.
+ * @tparam _DynamicalSystem a class derived from DynamicalSystem
+ * @warning We assume that the operator + is defined for the objects contained in the
+ * DynamicalSystem::State and DynamicalSystem::StateDerivative.
+ * @warning The RK45 integrator is compatible only with tuple containing vectors belonging to the
+ * \f$R^n\f$ space. It is not compatible with Lie groups. If you want to integrate a dynamical
+ * system defined on a Lie group please use the ForwardEuler integrator.
+ */
+template <class _DynamicalSystem> class RK45 : public Integrator<RK45<_DynamicalSystem>>
+{
+public:
+    using DynamicalSystem = typename internal::traits<RK45<_DynamicalSystem>>::DynamicalSystem;
+    using State = typename internal::traits<RK45<_DynamicalSystem>>::State;
+    using StateDerivative = typename internal::traits<RK45<_DynamicalSystem>>::StateDerivative;
+
+private:
+    static constexpr std::size_t NumberOfStages = 7; /**< Number of Dormand-Prince stages */
+
+    /** Nodes of the Butcher tableau */
+    static constexpr std::array<double, NumberOfStages> m_nodes
+        = {0.0, 1.0 / 5, 3.0 / 10, 4.0 / 5, 8.0 / 9, 1.0, 1.0};
+
+    /** Runge-Kutta matrix of the Butcher tableau */
+    static constexpr std::array<std::array<double, NumberOfStages - 1>, NumberOfStages - 1>
+        m_matrix = {{{1.0 / 5, 0.0, 0.0, 0.0, 0.0, 0.0},
+                     {3.0 / 40, 9.0 / 40, 0.0, 0.0, 0.0, 0.0},
+                     {44.0 / 45, -56.0 / 15, 32.0 / 9, 0.0, 0.0, 0.0},
+                     {19372.0 / 6561, -25360.0 / 2187, 64448.0 / 6561, -212.0 / 729, 0.0, 0.0},
+                     {9017.0 / 3168, -355.0 / 33, 46732.0 / 5247, 49.0 / 176, -5103.0 / 18656, 0.0},
+                     {35.0 / 384, 0.0, 500.0 / 1113, 125.0 / 192, -2187.0 / 6784, 11.0 / 84}}};
+
+    /** Weights of the 5th order solution */
+    static constexpr std::array<double, NumberOfStages> m_weights
+        = {35.0 / 384, 0.0, 500.0 / 1113, 125.0 / 192, -2187.0 / 6784, 11.0 / 84, 0.0};
+
+    /** Difference between the 5th and the 4th order weights used to estimate the error */
+    static constexpr std::array<double, NumberOfStages> m_errorWeights
+        = {71.0 / 57600,
+           0.0,
+           -71.0 / 16695,
+           71.0 / 1920,
+           -17253.0 / 339200,
+           22.0 / 525,
+           -1.0 / 40};
+
+    /** Temporary buffer usefully to avoid continuous memory allocation */
+    std::array<StateDerivative, NumberOfStages> m_k;
+
+    /** Temporary buffer usefully to avoid continuous memory allocation. It contains the state at
+     * the beginning of the step */
+    State m_computationalBufferInitialState;
+
+    /** Temporary buffer usefully to avoid continuous memory allocation. It contains the
+     * intermediate stage states and the candidate solution */
+    State m_computationalBufferState;
+
+    /** Temporary buffer usefully to avoid continuous memory allocation. It contains the error
+     * estimate of the step */
+    StateDerivative m_computationalBufferError;
+
+    double m_absoluteTolerance{1e-6}; /**< Absolute tolerance of the error control */
+    double m_relativeTolerance{1e-6}; /**< Relative tolerance of the error control */
+
+    std::chrono::nanoseconds m_minStep{std::chrono::microseconds(1)}; /**< Lower bound of the
+                                                                        adapted step */
+    std::chrono::nanoseconds m_maxStep{std::chrono::milliseconds(10)}; /**< Upper bound of the
+                                                                         adapted step */
+
+    /** Step attempted at the beginning of the next integration interval. It is initialized by
+     * setInitialStep() and updated with the last adapted value */
+    std::chrono::nanoseconds m_nextStep{std::chrono::nanoseconds::min()};
+
+    /**
+     * Compute x = x0 + dT * sum(weights[i] * k[i]) for the first `stages` stages.
+     */
+    template <std::size_t I = 0, std::size_t N>
+    inline void combineStages(const State& x0,
+                              const std::array<double, N>& weights,
+                              const std::size_t stages,
+                              const double& dTInSeconds,
+                              State& x)
+    {
+        if constexpr (I < std::tuple_size<State>::value)
+        {
+            static_assert(std::tuple_size<State>::value
+                          == std::tuple_size<StateDerivative>::value);
+            using std::get;
+
+            get<I>(x) = get<I>(x0);
+            for (std::size_t n = 0; n < stages; n++)
+            {
+                if (weights[n] != 0.0)
+                {
+                    get<I>(x) += (dTInSeconds * weights[n]) * get<I>(m_k[n]);
+                }
+            }
+
+            this->combineStages<I + 1>(x0, weights, stages, dTInSeconds, x);
+        }
+    }
+
+    /**
+     * Accumulate the squared scaled error of the step given the initial state and the candidate
+     * solution.
+     */
+    template <std::size_t I = 0>
+    inline void accumulateError(const State& x0,
+                                const State& x,
+                                const double& dTInSeconds,
+                                double& squaredError,
+                                std::size_t& numberOfElements)
+    {
+        if constexpr (I < std::tuple_size<State>::value)
+        {
+            using std::get;
+
+            // error estimate e = dT * sum((b_i - b*_i) * k_i)
+            auto& error = get<I>(m_computationalBufferError);
+            error = (dTInSeconds * m_errorWeights[0]) * get<I>(m_k[0]);
+            for (std::size_t n = 1; n < NumberOfStages; n++)
+            {
+                if (m_errorWeights[n] != 0.0)
+                {
+                    error += (dTInSeconds * m_errorWeights[n]) * get<I>(m_k[n]);
+                }
+            }
+
+            const auto scale = m_absoluteTolerance
+                               + m_relativeTolerance
+                                     * get<I>(x0).cwiseAbs().cwiseMax(get<I>(x).cwiseAbs()).array();
+
+            squaredError += (error.array() / scale).square().sum();
+            numberOfElements += static_cast<std::size_t>(get<I>(x).size());
+
+            this->accumulateError<I + 1>(x0, x, dTInSeconds, squaredError, numberOfElements);
+        }
+    }
+
+    /**
+     * Set the state of the dynamical system, writing it in place when the system allows it.
+     */
+    bool applyState(const State& state)
+    {
+        if constexpr (internal::has_mutable_state<DynamicalSystem>::value)
+        {
+            this->m_dynamicalSystem->mutableState() = state;
+            return true;
+        } else
+        {
+            return this->m_dynamicalSystem->setState(state);
+        }
+    }
+
+public:
+    /**
+     * Set the tolerances used by the error control.
+     * @param absoluteTolerance absolute tolerance.
+     * @param relativeTolerance relative tolerance.
+     * @return true in case of success, false otherwise.
+     */
+    bool setTolerances(double absoluteTolerance, double relativeTolerance)
+    {
+        constexpr auto errorPrefix = "[RK45::setTolerances]";
+        if (absoluteTolerance <= 0 || relativeTolerance < 0)
+        {
+            log()->error("{} The absolute tolerance must be a strict positive number and the "
+                         "relative tolerance must be a non negative number.",
+                         errorPrefix);
+            return false;
+        }
+
+        m_absoluteTolerance = absoluteTolerance;
+        m_relativeTolerance = relativeTolerance;
+        return true;
+    }
+
+    /**
+     * Set the bounds of the adapted step size.
+     * @param minStep lower bound of the step size.
+     * @param maxStep upper bound of the step size.
+     * @return true in case of success, false otherwise.
+     */
+    bool setStepSizeBounds(const std::chrono::nanoseconds& minStep,
+                           const std::chrono::nanoseconds& maxStep)
+    {
+        constexpr auto errorPrefix = "[RK45::setStepSizeBounds]";
+        if (minStep <= std::chrono::nanoseconds::zero() || maxStep < minStep)
+        {
+            log()->error("{} The minimum step must be a strict positive number and the maximum "
+                         "step must be greater than the minimum one.",
+                         errorPrefix);
+            return false;
+        }
+
+        m_minStep = minStep;
+        m_maxStep = maxStep;
+        return true;
+    }
+
+    /**
+     * Set the step attempted at the beginning of the first integration interval.
+     * @param dT initial step.
+     * @return true in case of success, false otherwise.
+     */
+    bool setInitialStep(const std::chrono::nanoseconds& dT)
+    {
+        constexpr auto errorPrefix = "[RK45::setInitialStep]";
+        if (dT <= std::chrono::nanoseconds::zero())
+        {
+            log()->error("{} The initial step must be a strict positive number.", errorPrefix);
+            return false;
+        }
+
+        m_nextStep = dT;
+        return true;
+    }
+
+    /**
+     * Integrate the dynamical system from initialTime to finalTime adapting the step size.
+     * @note We assume a constant control input in the interval.
+     * @param initialTime initial time of the integration.
+     * @param finalTime final time of the integration.
+     * @return true in case of success, false otherwise.
+     */
+    bool integrate(const std::chrono::nanoseconds& initialTime,
+                   const std::chrono::nanoseconds& finalTime)
+    {
+        constexpr auto errorPrefix = "[RK45::integrate]";
+
+        if (this->m_dynamicalSystem == nullptr)
+        {
+            log()->error("{} Please set the dynamical system before call this function.",
+                         errorPrefix);
+            return false;
+        }
+
+        if (initialTime > finalTime)
+        {
+            log()->error("{} The final time has to be greater than the initial one.", errorPrefix);
+            return false;
+        }
+
+        if (m_nextStep <= std::chrono::nanoseconds::zero())
+        {
+            log()->error("{} Please set the initial step.", errorPrefix);
+            return false;
+        }
+
+        std::chrono::nanoseconds currentTime = initialTime;
+        std::chrono::nanoseconds dT = std::clamp(m_nextStep, m_minStep, m_maxStep);
+
+        while (currentTime < finalTime)
+        {
+            const std::chrono::nanoseconds h = std::min(dT, finalTime - currentTime);
+            const double hInSeconds = std::chrono::duration<double>(h).count();
+
+            // save the state at the beginning of the step
+            this->m_computationalBufferInitialState = this->m_dynamicalSystem->getState();
+
+            // evaluate the stages
+            for (std::size_t n = 0; n < NumberOfStages; n++)
+            {
+                if (n > 0)
+                {
+                    this->combineStages(this->m_computationalBufferInitialState,
+                                        m_matrix[n - 1],
+                                        n,
+                                        hInSeconds,
+                                        this->m_computationalBufferState);
+                    if (!this->applyState(this->m_computationalBufferState))
+                    {
+                        log()->error("{} Unable to set the new state in the dynamical system "
+                                     "required to evaluate the stage {}.",
+                                     errorPrefix,
+                                     n + 1);
+                        return false;
+                    }
+                }
+
+                const auto stageTime
+                    = currentTime
+                      + std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::duration<double, std::nano>(h) * m_nodes[n]);
+                if (!this->m_dynamicalSystem->dynamics(stageTime, this->m_k[n]))
+                {
+                    log()->error("{} Unable to compute the system dynamics while evaluating the "
+                                 "stage {}.",
+                                 errorPrefix,
+                                 n + 1);
+                    return false;
+                }
+            }
+
+            // compute the 5th order candidate solution
+            this->combineStages(this->m_computationalBufferInitialState,
+                                m_weights,
+                                NumberOfStages,
+                                hInSeconds,
+                                this->m_computationalBufferState);
+
+            // compute the scaled error of the step
+            double squaredError = 0;
+            std::size_t numberOfElements = 0;
+            this->accumulateError(this->m_computationalBufferInitialState,
+                                  this->m_computationalBufferState,
+                                  hInSeconds,
+                                  squaredError,
+                                  numberOfElements);
+            const double error
+                = numberOfElements == 0
+                      ? 0.0
+                      : std::sqrt(squaredError / static_cast<double>(numberOfElements));
+
+            // the step is accepted when the scaled error is below one or when it cannot be
+            // reduced any further
+            const bool accepted = error <= 1.0 || h <= m_minStep;
+            if (accepted)
+            {
+                if (!this->applyState(this->m_computationalBufferState))
+                {
+                    log()->error("{} Unable to set the new state in the dynamical system.",
+                                 errorPrefix);
+                    return false;
+                }
+                currentTime += h;
+            } else
+            {
+                // restore the state at the beginning of the step
+                if (!this->applyState(this->m_computationalBufferInitialState))
+                {
+                    log()->error("{} Unable to restore the state in the dynamical system.",
+                                 errorPrefix);
+                    return false;
+                }
+            }
+
+            // adapt the step size. The exponent is 1/5 since the solution is 5th order accurate
+            constexpr double safetyFactor = 0.9;
+            const double factor = error == 0.0
+                                      ? 5.0
+                                      : std::clamp(safetyFactor * std::pow(error, -0.2), 0.2, 5.0);
+            dT = std::clamp(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::duration<double, std::nano>(h) * factor),
+                            m_minStep,
+                            m_maxStep);
+        }
+
+        // reuse the last adapted step as initial guess for the next integration interval
+        m_nextStep = dT;
+
+        return true;
+    }
+};
+
+} // namespace ContinuousDynamicalSystem
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_RK45_H
@@ -9,6 +9,8 @@
 #define BIPEDAL_LOCOMOTION_CONTINUOUS_DYNAMICAL_SYSTEM_IMPL_TRAITS_H
 
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 #define BLF_CONTINUOUS_DYNAMICAL_SYSTEM_STATE(...) using State = std::tuple<__VA_ARGS__>
 
@@ -73,6 +75,35 @@
     }                                                                       \
     }
 
+/**
+ * The user must call this macro before defining a custom
+ * ContinuousDynamicalSystem::FixedStepIntegrator whose integration step may be provided at compile
+ * time through an additional template parameter.
+ * @param IntegratorType the type of the integrator.
+ * @param _Derived the type derived integrator.
+ * @param _TimeStep the type describing the compile time integration step.
+ */
+#define BLF_DEFINE_FIXED_TIME_STEP_INTEGRATOR_STRUCTURE(IntegratorType, _Derived, _TimeStep)  \
+    namespace BipedalLocomotion                                                               \
+    {                                                                                         \
+    namespace ContinuousDynamicalSystem                                                       \
+    {                                                                                         \
+    namespace internal                                                                        \
+    {                                                                                         \
+    template <class _Derived, class _TimeStep>                                                \
+    struct traits<IntegratorType<_Derived, _TimeStep>>                                        \
+    {                                                                                         \
+        /** State of the integrator */                                                        \
+        using State = typename traits<_Derived>::State;                                       \
+        /** State derivative of the integrator */                                             \
+        using StateDerivative = typename traits<_Derived>::StateDerivative;                   \
+        /** Type of the dynamical system */                                                   \
+        using DynamicalSystem = typename traits<_Derived>::DynamicalSystem;                   \
+    };                                                                                        \
+    }                                                                                         \
+    }                                                                                         \
+    }
+
 namespace BipedalLocomotion
 {
 namespace ContinuousDynamicalSystem
@@ -93,6 +124,21 @@ template <typename T> struct traits<const T> : traits<T>
 {
 };
 
+/**
+ * has_mutable_state detects whether a DynamicalSystem exposes a `State& mutableState()` accessor.
+ * When available, the fixed step integrators update the state of the dynamical system in place
+ * instead of copying the full state tuple through getState()/setState() at every step boundary.
+ */
+template <typename T, typename = void> struct has_mutable_state : std::false_type
+{
+};
+
+template <typename T>
+struct has_mutable_state<T, std::void_t<decltype(std::declval<T&>().mutableState())>>
+    : std::is_same<decltype(std::declval<T&>().mutableState()), typename traits<T>::State&>
+{
+};
+
 } // namespace internal
 } // namespace ContinuousDynamicalSystem
 } // namespace BipedalLocomotion
@@ -0,0 +1,233 @@
+/**
+ * @file BatchedCentroidalDynamics.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <BipedalLocomotion/ContinuousDynamicalSystem/BatchedCentroidalDynamics.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::ContinuousDynamicalSystem;
+using namespace BipedalLocomotion::ParametersHandler;
+
+bool BatchedCentroidalDynamics::initialize(std::weak_ptr<const IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[BatchedCentroidalDynamics::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} The parameter handler is expired. Please call the function passing a "
+                     "pointer pointing an already allocated memory.",
+                     logPrefix);
+        return false;
+    }
+
+    int numberOfRollouts = 0;
+    if (!ptr->getParameter("number_of_rollouts", numberOfRollouts) || numberOfRollouts <= 0)
+    {
+        log()->error("{} Unable to find a valid parameter named 'number_of_rollouts'. The "
+                     "parameter must be a strict positive number.",
+                     logPrefix);
+        return false;
+    }
+
+    std::chrono::nanoseconds samplingTime{std::chrono::nanoseconds::zero()};
+    if (!ptr->getParameter("sampling_time", samplingTime)
+        || samplingTime <= std::chrono::nanoseconds::zero())
+    {
+        log()->error("{} Unable to find a valid parameter named 'sampling_time'. The parameter "
+                     "must be a strict positive number.",
+                     logPrefix);
+        return false;
+    }
+    m_dTInSeconds = std::chrono::duration<double>(samplingTime).count();
+
+    if (!ptr->getParameter("mass", m_mass))
+    {
+        log()->info("{} The mass is not found. The default one will be used {} kg.",
+                    logPrefix,
+                    m_mass);
+    }
+
+    if (!ptr->getParameter("gravity", m_gravity))
+    {
+        log()->info("{} The gravity vector not found. The default one will be used {}.",
+                    logPrefix,
+                    m_gravity.transpose());
+    }
+
+    if (!ptr->getParameter("number_of_threads", m_numberOfThreads))
+    {
+        log()->info("{} The number of threads is not found. The default one will be used {}.",
+                    logPrefix,
+                    m_numberOfThreads);
+    }
+
+    if (m_numberOfThreads <= 0)
+    {
+        log()->error("{} The number of threads must be a strict positive number.", logPrefix);
+        return false;
+    }
+
+    m_comPosition.setZero(3, numberOfRollouts);
+    m_comVelocity.setZero(3, numberOfRollouts);
+    m_angularMomentum.setZero(3, numberOfRollouts);
+    m_comAcceleration.setZero(3, numberOfRollouts);
+    m_angularMomentumRate.setZero(3, numberOfRollouts);
+    m_relativePosition.setZero(3, numberOfRollouts);
+
+    m_isInitialized = true;
+
+    return true;
+}
+
+Eigen::Index BatchedCentroidalDynamics::numberOfRollouts() const
+{
+    return m_comPosition.cols();
+}
+
+void BatchedCentroidalDynamics::setState(const CentroidalDynamics::State& state)
+{
+    using namespace BipedalLocomotion::GenericContainer::literals;
+
+    m_comPosition.colwise() = state.get_from_hash<"com_pos"_h>();
+    m_comVelocity.colwise() = state.get_from_hash<"com_vel"_h>();
+    m_angularMomentum.colwise() = state.get_from_hash<"angular_momentum"_h>();
+}
+
+bool BatchedCentroidalDynamics::setState(Eigen::Index rollout,
+                                         const CentroidalDynamics::State& state)
+{
+    using namespace BipedalLocomotion::GenericContainer::literals;
+
+    if (rollout < 0 || rollout >= this->numberOfRollouts())
+    {
+        log()->error("[BatchedCentroidalDynamics::setState] The rollout index is out of range.");
+        return false;
+    }
+
+    m_comPosition.col(rollout) = state.get_from_hash<"com_pos"_h>();
+    m_comVelocity.col(rollout) = state.get_from_hash<"com_vel"_h>();
+    m_angularMomentum.col(rollout) = state.get_from_hash<"angular_momentum"_h>();
+    return true;
+}
+
+CentroidalDynamics::State BatchedCentroidalDynamics::getState(Eigen::Index rollout) const
+{
+    using namespace BipedalLocomotion::GenericContainer::literals;
+
+    CentroidalDynamics::State state;
+    state.get_from_hash<"com_pos"_h>() = m_comPosition.col(rollout);
+    state.get_from_hash<"com_vel"_h>() = m_comVelocity.col(rollout);
+    state.get_from_hash<"angular_momentum"_h>() = m_angularMomentum.col(rollout);
+    return state;
+}
+
+const Eigen::Matrix3Xd& BatchedCentroidalDynamics::comPositions() const
+{
+    return m_comPosition;
+}
+
+const Eigen::Matrix3Xd& BatchedCentroidalDynamics::comVelocities() const
+{
+    return m_comVelocity;
+}
+
+const Eigen::Matrix3Xd& BatchedCentroidalDynamics::angularMomenta() const
+{
+    return m_angularMomentum;
+}
+
+void BatchedCentroidalDynamics::stepColumns(const std::vector<ContactPointBatch>& contactPoints,
+                                            Eigen::Index begin,
+                                            Eigen::Index cols)
+{
+    auto acceleration = m_comAcceleration.middleCols(begin, cols);
+    auto momentumRate = m_angularMomentumRate.middleCols(begin, cols);
+    auto relativePosition = m_relativePosition.middleCols(begin, cols);
+    const auto comPosition = m_comPosition.middleCols(begin, cols);
+
+    acceleration.setZero();
+    acceleration.colwise() += m_gravity;
+    momentumRate.setZero();
+
+    for (const auto& point : contactPoints)
+    {
+        const auto force = point.forces.middleCols(begin, cols);
+        const auto position = point.positions.middleCols(begin, cols);
+
+        acceleration.noalias() += (1 / m_mass) * force;
+
+        // column-wise cross product (position - com) x force evaluated with row-wise expressions
+        // so that it is vectorized across the rollouts
+        relativePosition = position - comPosition;
+        momentumRate.row(0) += relativePosition.row(1).cwiseProduct(force.row(2))
+                               - relativePosition.row(2).cwiseProduct(force.row(1));
+        momentumRate.row(1) += relativePosition.row(2).cwiseProduct(force.row(0))
+                               - relativePosition.row(0).cwiseProduct(force.row(2));
+        momentumRate.row(2) += relativePosition.row(0).cwiseProduct(force.row(1))
+                               - relativePosition.row(1).cwiseProduct(force.row(0));
+    }
+
+    // explicit forward Euler: the derivative is evaluated at the current state
+    m_comPosition.middleCols(begin, cols).noalias()
+        += m_dTInSeconds * m_comVelocity.middleCols(begin, cols);
+    m_comVelocity.middleCols(begin, cols).noalias() += m_dTInSeconds * acceleration;
+    m_angularMomentum.middleCols(begin, cols).noalias() += m_dTInSeconds * momentumRate;
+}
+
+bool BatchedCentroidalDynamics::step(const std::vector<ContactPointBatch>& contactPoints)
+{
+    constexpr auto logPrefix = "[BatchedCentroidalDynamics::step]";
+
+    if (!m_isInitialized)
+    {
+        log()->error("{} Please initialize the class before calling step().", logPrefix);
+        return false;
+    }
+
+    const Eigen::Index rollouts = this->numberOfRollouts();
+    for (const auto& point : contactPoints)
+    {
+        if (point.positions.cols() != rollouts || point.forces.cols() != rollouts)
+        {
+            log()->error("{} Each contact point batch must contain one column per rollout. "
+                         "Expected columns: {}.",
+                         logPrefix,
+                         rollouts);
+            return false;
+        }
+    }
+
+    if (m_numberOfThreads == 1 || rollouts < 2 * m_numberOfThreads)
+    {
+        this->stepColumns(contactPoints, 0, rollouts);
+        return true;
+    }
+
+    // partition the batch in contiguous chunks, one per thread
+    std::vector<std::thread> threads;
+    threads.reserve(m_numberOfThreads);
+    const Eigen::Index chunk = (rollouts + m_numberOfThreads - 1) / m_numberOfThreads;
+    for (Eigen::Index begin = 0; begin < rollouts; begin += chunk)
+    {
+        const Eigen::Index cols = std::min(chunk, rollouts - begin);
+        threads.emplace_back([this, &contactPoints, begin, cols] {
+            this->stepColumns(contactPoints, begin, cols);
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return true;
+}
@@ -89,6 +89,11 @@ const CentroidalDynamics::State& CentroidalDynamics::getState() const
     return m_state;
 }
 
+CentroidalDynamics::State& CentroidalDynamics::mutableState()
+{
+    return m_state;
+}
+
 bool CentroidalDynamics::setControlInput(const Input& controlInput)
 {
     m_controlInput = controlInput;
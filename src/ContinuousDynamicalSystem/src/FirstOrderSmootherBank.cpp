@@ -0,0 +1,259 @@
+/**
+ * @file FirstOrderSmootherBank.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <numeric>
+
+#include <BipedalLocomotion/ContinuousDynamicalSystem/FirstOrderSmootherBank.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::ContinuousDynamicalSystem;
+
+bool FirstOrderSmootherBank::initialize(
+    std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[FirstOrderSmootherBank::initialize]";
+    auto ptr = handler.lock();
+
+    if (ptr == nullptr)
+    {
+        log()->error("{} Invalid parameter handler.", logPrefix);
+        return false;
+    }
+
+    std::chrono::nanoseconds samplingTime;
+    if (!ptr->getParameter("sampling_time", samplingTime)
+        || samplingTime <= std::chrono::nanoseconds::zero())
+    {
+        log()->error("{} Unable to get the 'sampling_time' parameter. The parameter must be a "
+                     "strict positive number.",
+                     logPrefix);
+        return false;
+    }
+    m_dTInSeconds = std::chrono::duration<double>(samplingTime).count();
+
+    std::vector<int> channelSizes;
+    if (!ptr->getParameter("channel_sizes", channelSizes) || channelSizes.empty())
+    {
+        log()->error("{} Unable to get the 'channel_sizes' parameter.", logPrefix);
+        return false;
+    }
+
+    std::vector<double> settlingTimes;
+    if (!ptr->getParameter("settling_times", settlingTimes)
+        || settlingTimes.size() != channelSizes.size())
+    {
+        log()->error("{} Unable to get the 'settling_times' parameter. One settling time per "
+                     "channel is required. Number of channels: {}.",
+                     logPrefix,
+                     channelSizes.size());
+        return false;
+    }
+
+    m_offsets.resize(channelSizes.size());
+    m_sizes.resize(channelSizes.size());
+    Eigen::Index totalSize = 0;
+    for (std::size_t i = 0; i < channelSizes.size(); i++)
+    {
+        if (channelSizes[i] <= 0)
+        {
+            log()->error("{} The size of the channel {} must be a strict positive number.",
+                         logPrefix,
+                         i);
+            return false;
+        }
+
+        if (settlingTimes[i] <= 0)
+        {
+            log()->error("{} The settling time of the channel {} must be a strict positive "
+                         "number.",
+                         logPrefix,
+                         i);
+            return false;
+        }
+
+        m_offsets[i] = totalSize;
+        m_sizes[i] = channelSizes[i];
+        totalSize += channelSizes[i];
+    }
+
+    // each channel implements dx = a (-x + u) with a = 3 / settling_time. The gain is expanded to
+    // all the elements of the channel so that the bank is propagated with a single element-wise
+    // pass
+    m_gains.resize(totalSize);
+    for (std::size_t i = 0; i < channelSizes.size(); i++)
+    {
+        m_gains.segment(m_offsets[i], m_sizes[i]).setConstant(3.0 / settlingTimes[i]);
+    }
+
+    m_state.setZero(totalSize);
+    m_input.setZero(totalSize);
+    m_output.setZero(totalSize);
+
+    m_isInitialized = true;
+
+    return true;
+}
+
+bool FirstOrderSmootherBank::reset(Eigen::Ref<const Eigen::VectorXd> initialState)
+{
+    constexpr auto logPrefix = "[FirstOrderSmootherBank::reset]";
+    m_isInitialStateSet = false;
+
+    if (!m_isInitialized)
+    {
+        log()->error("{} Please initialize the class before.", logPrefix);
+        return false;
+    }
+
+    if (initialState.size() != m_state.size())
+    {
+        log()->error("{} Unexpected size of the initial state. Expected: {}. Provided: {}.",
+                     logPrefix,
+                     m_state.size(),
+                     initialState.size());
+        return false;
+    }
+
+    m_state = initialState;
+    m_input = initialState;
+    m_output = initialState;
+    m_isInitialStateSet = true;
+
+    return true;
+}
+
+bool FirstOrderSmootherBank::resetChannel(std::size_t channel,
+                                          Eigen::Ref<const Eigen::VectorXd> initialState)
+{
+    constexpr auto logPrefix = "[FirstOrderSmootherBank::resetChannel]";
+
+    if (!m_isInitialized || !m_isInitialStateSet)
+    {
+        log()->error("{} Please call initialize() and reset() before resetting a single channel.",
+                     logPrefix);
+        return false;
+    }
+
+    if (channel >= m_offsets.size())
+    {
+        log()->error("{} The channel index is out of range. Number of channels: {}.",
+                     logPrefix,
+                     m_offsets.size());
+        return false;
+    }
+
+    if (initialState.size() != m_sizes[channel])
+    {
+        log()->error("{} Unexpected size of the initial state. Expected: {}. Provided: {}.",
+                     logPrefix,
+                     m_sizes[channel],
+                     initialState.size());
+        return false;
+    }
+
+    m_state.segment(m_offsets[channel], m_sizes[channel]) = initialState;
+    m_input.segment(m_offsets[channel], m_sizes[channel]) = initialState;
+    m_output.segment(m_offsets[channel], m_sizes[channel]) = initialState;
+
+    return true;
+}
+
+bool FirstOrderSmootherBank::advance()
+{
+    m_isOutputValid = false;
+
+    if (!m_isInitialized || !m_isInitialStateSet)
+    {
+        log()->error("[FirstOrderSmootherBank::advance] Please call initialize() and reset() "
+                     "before advance.");
+        return false;
+    }
+
+    // forward Euler step of dx = a (-x + u) evaluated for all the channels in a single
+    // element-wise pass
+    m_state += m_dTInSeconds * m_gains.cwiseProduct(m_input - m_state);
+    m_output = m_state;
+    m_isOutputValid = true;
+
+    return true;
+}
+
+bool FirstOrderSmootherBank::setInput(const Eigen::VectorXd& input)
+{
+    constexpr auto logPrefix = "[FirstOrderSmootherBank::setInput]";
+
+    if (!m_isInitialized || !m_isInitialStateSet)
+    {
+        log()->error("{} Please call initialize() and reset() before setInput.", logPrefix);
+        return false;
+    }
+
+    if (input.size() != m_input.size())
+    {
+        log()->error("{} Unexpected size of the input. Expected: {}. Provided: {}.",
+                     logPrefix,
+                     m_input.size(),
+                     input.size());
+        return false;
+    }
+
+    m_input = input;
+    return true;
+}
+
+bool FirstOrderSmootherBank::setChannelInput(std::size_t channel,
+                                             Eigen::Ref<const Eigen::VectorXd> input)
+{
+    constexpr auto logPrefix = "[FirstOrderSmootherBank::setChannelInput]";
+
+    if (!m_isInitialized || !m_isInitialStateSet)
+    {
+        log()->error("{} Please call initialize() and reset() before setChannelInput.", logPrefix);
+        return false;
+    }
+
+    if (channel >= m_offsets.size())
+    {
+        log()->error("{} The channel index is out of range. Number of channels: {}.",
+                     logPrefix,
+                     m_offsets.size());
+        return false;
+    }
+
+    if (input.size() != m_sizes[channel])
+    {
+        log()->error("{} Unexpected size of the input. Expected: {}. Provided: {}.",
+                     logPrefix,
+                     m_sizes[channel],
+                     input.size());
+        return false;
+    }
+
+    m_input.segment(m_offsets[channel], m_sizes[channel]) = input;
+    return true;
+}
+
+const Eigen::VectorXd& FirstOrderSmootherBank::getOutput() const
+{
+    return m_output;
+}
+
+Eigen::Ref<const Eigen::VectorXd> FirstOrderSmootherBank::getChannelOutput(std::size_t channel) const
+{
+    return m_output.segment(m_offsets[channel], m_sizes[channel]);
+}
+
+std::size_t FirstOrderSmootherBank::numberOfChannels() const
+{
+    return m_offsets.size();
+}
+
+bool FirstOrderSmootherBank::isOutputValid() const
+{
+    return m_isOutputValid;
+}
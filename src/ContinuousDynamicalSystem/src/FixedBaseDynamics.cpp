@@ -214,6 +214,11 @@ const FixedBaseDynamics::State& FixedBaseDynamics::getState() const
     return m_state;
 }
 
+FixedBaseDynamics::State& FixedBaseDynamics::mutableState()
+{
+    return m_state;
+}
+
 bool FixedBaseDynamics::setControlInput(const Input& controlInput)
 {
     m_controlInput = controlInput;
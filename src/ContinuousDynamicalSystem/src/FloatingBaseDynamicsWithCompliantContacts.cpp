@@ -280,6 +280,11 @@ FloatingBaseDynamicsWithCompliantContacts::getState() const
     return m_state;
 }
 
+FloatingBaseDynamicsWithCompliantContacts::State& FloatingBaseDynamicsWithCompliantContacts::mutableState()
+{
+    return m_state;
+}
+
 bool FloatingBaseDynamicsWithCompliantContacts::setControlInput(const Input& controlInput)
 {
     m_controlInput = controlInput;
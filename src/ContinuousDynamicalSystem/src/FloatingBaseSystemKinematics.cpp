@@ -77,6 +77,11 @@ const FloatingBaseSystemKinematics::State& FloatingBaseSystemKinematics::getStat
     return m_state;
 }
 
+FloatingBaseSystemKinematics::State& FloatingBaseSystemKinematics::mutableState()
+{
+    return m_state;
+}
+
 bool FloatingBaseSystemKinematics::setControlInput(const Input& controlInput)
 {
     m_controlInput = controlInput;
@@ -88,6 +88,11 @@ const LinearTimeInvariantSystem::State& LinearTimeInvariantSystem::getState() co
     return m_state;
 }
 
+LinearTimeInvariantSystem::State& LinearTimeInvariantSystem::mutableState()
+{
+    return m_state;
+}
+
 bool LinearTimeInvariantSystem::setControlInput(const LinearTimeInvariantSystem::Input& controlInput)
 {
     m_controlInput = controlInput;
@@ -17,7 +17,7 @@ const Eigen::VectorXd& MultiStateWeightProvider::getOutput() const
 
 bool MultiStateWeightProvider::isOutputValid() const
 {
-    return m_smoother.isOutputValid();
+    return m_isOutputValid;
 }
 
 bool MultiStateWeightProvider::initialize(
@@ -45,6 +45,14 @@ bool MultiStateWeightProvider::initialize(
         return false;
     }
 
+    if (!ptr->getParameter("convergence_tolerance", m_convergenceTolerance))
+    {
+        log()->info("{} The 'convergence_tolerance' parameter is not found. The default one will "
+                    "be used {}.",
+                    logPrefix,
+                    m_convergenceTolerance);
+    }
+
     std::string name;
     for (const auto& state : states)
     {
@@ -89,7 +97,18 @@ bool MultiStateWeightProvider::reset(const std::string& state)
         return false;
     }
 
-    return m_smoother.reset(weight->second);
+    if (!m_smoother.reset(weight->second))
+    {
+        return false;
+    }
+
+    // after a reset the smoothed weight coincides with the target: the propagation is frozen
+    // until the next setState call
+    m_targetWeight = weight->second;
+    m_isInSteadyState = true;
+    m_isOutputValid = false;
+
+    return true;
 }
 
 bool MultiStateWeightProvider::setState(const std::string& state)
@@ -103,10 +122,43 @@ bool MultiStateWeightProvider::setState(const std::string& state)
         return false;
     }
 
-    return m_smoother.setInput(weight->second);
+    // if the smoother already converged to the very same weight there is nothing to do
+    if (m_isInSteadyState && weight->second.size() == m_targetWeight.size()
+        && (weight->second.array() == m_targetWeight.array()).all())
+    {
+        return true;
+    }
+
+    if (!m_smoother.setInput(weight->second))
+    {
+        return false;
+    }
+
+    m_targetWeight = weight->second;
+    m_isInSteadyState = false;
+
+    return true;
 }
 
 bool MultiStateWeightProvider::advance()
 {
-    return m_smoother.advance();
+    // once the smoother converged there is nothing to propagate: the cached weight is returned
+    // until the next setState call
+    if (m_isInSteadyState)
+    {
+        m_isOutputValid = true;
+        return true;
+    }
+
+    if (!m_smoother.advance())
+    {
+        m_isOutputValid = false;
+        return false;
+    }
+    m_isOutputValid = true;
+
+    m_isInSteadyState = (m_smoother.getOutput() - m_targetWeight).lpNorm<Eigen::Infinity>()
+                        < m_convergenceTolerance;
+
+    return true;
 }
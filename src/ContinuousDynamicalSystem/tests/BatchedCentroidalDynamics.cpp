@@ -0,0 +1,131 @@
+/**
+ * @file BatchedCentroidalDynamics.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <memory>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/ContinuousDynamicalSystem/BatchedCentroidalDynamics.h>
+#include <BipedalLocomotion/ContinuousDynamicalSystem/CentroidalDynamics.h>
+#include <BipedalLocomotion/ContinuousDynamicalSystem/ForwardEuler.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+using namespace BipedalLocomotion::ContinuousDynamicalSystem;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::GenericContainer::literals;
+
+TEST_CASE("Batched centroidal dynamics")
+{
+    using namespace std::chrono_literals;
+
+    constexpr std::chrono::nanoseconds dT = 1ms;
+    constexpr int numberOfRollouts = 5;
+    constexpr int numberOfSteps = 50;
+    constexpr double mass = 30.0;
+    constexpr std::size_t numberOfCorners = 4;
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("number_of_rollouts", numberOfRollouts);
+    handler->setParameter("sampling_time", dT);
+    handler->setParameter("mass", mass);
+
+    BatchedCentroidalDynamics batch;
+    REQUIRE(batch.initialize(handler));
+    REQUIRE(batch.numberOfRollouts() == numberOfRollouts);
+
+    // common initial state
+    CentroidalDynamics::State initialState;
+    initialState.get_from_hash<"com_pos"_h>() = Eigen::Vector3d(0.0, 0.0, 0.6);
+    initialState.get_from_hash<"com_vel"_h>() = Eigen::Vector3d(0.1, 0.0, 0.0);
+    initialState.get_from_hash<"angular_momentum"_h>().setZero();
+    batch.setState(initialState);
+
+    // one contact point batch per corner, with a different force for each rollout
+    std::vector<BatchedCentroidalDynamics::ContactPointBatch> contactPoints(numberOfCorners);
+    for (std::size_t corner = 0; corner < numberOfCorners; corner++)
+    {
+        contactPoints[corner].positions = Eigen::Matrix3Xd::Random(3, numberOfRollouts) * 0.1;
+        contactPoints[corner].forces = Eigen::Matrix3Xd::Random(3, numberOfRollouts) * 10.0;
+        contactPoints[corner].forces.row(2).array() += mass * 9.81 / numberOfCorners;
+    }
+
+    // reference: one system+integrator pair per rollout
+    std::vector<ForwardEuler<CentroidalDynamics>> integrators(numberOfRollouts);
+    std::vector<std::shared_ptr<CentroidalDynamics>> systems(numberOfRollouts);
+    for (int rollout = 0; rollout < numberOfRollouts; rollout++)
+    {
+        systems[rollout] = std::make_shared<CentroidalDynamics>();
+        REQUIRE(systems[rollout]->initialize(handler));
+        REQUIRE(systems[rollout]->setState(initialState));
+
+        CentroidalDynamics::Input input;
+        auto& contacts = input.get_from_hash<"contacts"_h>();
+        auto& contact = contacts["foot"];
+        contact.corners.resize(numberOfCorners);
+        for (std::size_t corner = 0; corner < numberOfCorners; corner++)
+        {
+            contact.corners[corner].position = contactPoints[corner].positions.col(rollout);
+            contact.corners[corner].force = contactPoints[corner].forces.col(rollout);
+        }
+        REQUIRE(systems[rollout]->setControlInput(input));
+
+        REQUIRE(integrators[rollout].setIntegrationStep(dT));
+        REQUIRE(integrators[rollout].setDynamicalSystem(systems[rollout]));
+    }
+
+    // roll out the batch and the reference integrators
+    for (int step = 0; step < numberOfSteps; step++)
+    {
+        REQUIRE(batch.step(contactPoints));
+        for (int rollout = 0; rollout < numberOfRollouts; rollout++)
+        {
+            REQUIRE(integrators[rollout].integrate(0s, dT));
+        }
+    }
+
+    constexpr double tolerance = 1e-10;
+    for (int rollout = 0; rollout < numberOfRollouts; rollout++)
+    {
+        const auto& reference = integrators[rollout].getSolution();
+        REQUIRE(batch.comPositions().col(rollout).isApprox( //
+            reference.get_from_hash<"com_pos"_h>(),
+            tolerance));
+        REQUIRE(batch.comVelocities().col(rollout).isApprox( //
+            reference.get_from_hash<"com_vel"_h>(),
+            tolerance));
+        REQUIRE(batch.angularMomenta().col(rollout).isApprox( //
+            reference.get_from_hash<"angular_momentum"_h>(),
+            tolerance));
+
+        const auto state = batch.getState(rollout);
+        REQUIRE(state.get_from_hash<"com_pos"_h>().isApprox(batch.comPositions().col(rollout)));
+    }
+
+    SECTION("Threaded batch")
+    {
+        handler->setParameter("number_of_threads", 2);
+
+        BatchedCentroidalDynamics threadedBatch;
+        REQUIRE(threadedBatch.initialize(handler));
+        threadedBatch.setState(initialState);
+
+        for (int step = 0; step < numberOfSteps; step++)
+        {
+            REQUIRE(threadedBatch.step(contactPoints));
+        }
+
+        // with 5 rollouts and 2 threads the single threaded path is taken when the batch is too
+        // small: the result must not depend on the partitioning
+        REQUIRE(threadedBatch.comPositions().isApprox(batch.comPositions(), tolerance));
+        REQUIRE(threadedBatch.comVelocities().isApprox(batch.comVelocities(), tolerance));
+        REQUIRE(threadedBatch.angularMomenta().isApprox(batch.angularMomenta(), tolerance));
+    }
+}
@@ -0,0 +1,90 @@
+/**
+ * @file FirstOrderSmootherBank.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/ContinuousDynamicalSystem/FirstOrderSmoother.h>
+#include <BipedalLocomotion/ContinuousDynamicalSystem/FirstOrderSmootherBank.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+using namespace BipedalLocomotion::ContinuousDynamicalSystem;
+using namespace BipedalLocomotion::ParametersHandler;
+
+TEST_CASE("First order smoother bank")
+{
+    using namespace std::chrono_literals;
+
+    constexpr std::chrono::nanoseconds dT = 100us;
+    constexpr unsigned int numberOfSteps = 1000;
+
+    const std::vector<int> channelSizes{3, 2, 6};
+    const std::vector<double> settlingTimes{0.1, 0.05, 0.2};
+
+    auto params = std::make_shared<StdImplementation>();
+    params->setParameter("sampling_time", dT);
+    params->setParameter("channel_sizes", channelSizes);
+    params->setParameter("settling_times", settlingTimes);
+
+    FirstOrderSmootherBank bank;
+    REQUIRE(bank.initialize(params));
+    REQUIRE(bank.numberOfChannels() == channelSizes.size());
+
+    // one FirstOrderSmoother per channel used as reference
+    std::vector<FirstOrderSmoother> smoothers(channelSizes.size());
+    std::vector<Eigen::VectorXd> inputs(channelSizes.size());
+    std::vector<Eigen::VectorXd> initialStates(channelSizes.size());
+    for (std::size_t i = 0; i < channelSizes.size(); i++)
+    {
+        auto smootherParams = std::make_shared<StdImplementation>();
+        smootherParams->setParameter("sampling_time", dT);
+        smootherParams->setParameter("settling_time", settlingTimes[i]);
+        REQUIRE(smoothers[i].initialize(smootherParams));
+
+        initialStates[i] = Eigen::VectorXd::Random(channelSizes[i]);
+        REQUIRE(smoothers[i].reset(initialStates[i]));
+
+        inputs[i] = Eigen::VectorXd::Random(channelSizes[i]);
+        REQUIRE(smoothers[i].setInput(inputs[i]));
+    }
+
+    Eigen::VectorXd stackedInitialState(11);
+    stackedInitialState << initialStates[0], initialStates[1], initialStates[2];
+    REQUIRE(bank.reset(stackedInitialState));
+    for (std::size_t i = 0; i < channelSizes.size(); i++)
+    {
+        REQUIRE(bank.resetChannel(i, initialStates[i]));
+        REQUIRE(bank.setChannelInput(i, inputs[i]));
+    }
+
+    constexpr double tolerance = 1e-10;
+    for (unsigned int step = 0; step < numberOfSteps; step++)
+    {
+        for (std::size_t i = 0; i < channelSizes.size(); i++)
+        {
+            REQUIRE(bank.getChannelOutput(i).isApprox(smoothers[i].getOutput(), tolerance));
+        }
+
+        REQUIRE(bank.advance());
+        REQUIRE(bank.isOutputValid());
+        for (auto& smoother : smoothers)
+        {
+            REQUIRE(smoother.advance());
+        }
+    }
+
+    // the stacked output must be the concatenation of the channel outputs
+    Eigen::VectorXd stackedOutput(11);
+    stackedOutput << smoothers[0].getOutput(), smoothers[1].getOutput(), smoothers[2].getOutput();
+    REQUIRE(bank.getOutput().isApprox(stackedOutput, tolerance));
+}
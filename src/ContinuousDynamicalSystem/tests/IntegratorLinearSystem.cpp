@@ -16,6 +16,7 @@
 #include <BipedalLocomotion/ContinuousDynamicalSystem/ForwardEuler.h>
 #include <BipedalLocomotion/ContinuousDynamicalSystem/LinearTimeInvariantSystem.h>
 #include <BipedalLocomotion/ContinuousDynamicalSystem/RK4.h>
+#include <BipedalLocomotion/ContinuousDynamicalSystem/RK45.h>
 
 using namespace BipedalLocomotion::ContinuousDynamicalSystem;
 
@@ -62,6 +63,9 @@ TEST_CASE("Integrator - Linear system")
     system->setControlInput({u});
     system->setState({x0});
 
+    // the in-place integration updates the very same state returned by getState()
+    REQUIRE(&system->mutableState() == &system->getState());
+
     SECTION("Forward Euler")
     {
         constexpr double tolerance = 1e-3;
@@ -97,4 +101,64 @@ TEST_CASE("Integrator - Linear system")
             REQUIRE(integrator.integrate(0s, dT));
         }
     }
+
+    SECTION("RK45")
+    {
+        using namespace std::chrono_literals;
+
+        constexpr double tolerance = 1e-6;
+        RK45<LinearTimeInvariantSystem> integrator;
+        REQUIRE(integrator.setTolerances(1e-9, 1e-9));
+        REQUIRE(integrator.setStepSizeBounds(1us, 100ms));
+        REQUIRE(integrator.setInitialStep(dT));
+        integrator.setDynamicalSystem(system);
+
+        // the step size is adapted internally: the integration is performed in a single interval
+        REQUIRE(integrator.integrate(0s, simulationTime));
+
+        const auto& [solution] = integrator.getSolution();
+        REQUIRE(solution.isApprox(closeFormSolution(std::chrono::duration<double>(simulationTime)
+                                                        .count()),
+                                  tolerance));
+    }
+
+    SECTION("Forward Euler - compile time step")
+    {
+        constexpr double tolerance = 1e-3;
+
+        // the integration step (100us i.e. 1/10000 s) is provided at compile time
+        ForwardEuler<LinearTimeInvariantSystem, FixedTimeStep<1, 10000>> integrator;
+        REQUIRE(integrator.getIntegrationStep() == dT);
+        integrator.setDynamicalSystem(system);
+
+        for (int i = 0; i < simulationTime / dT; i++)
+        {
+            const auto& [solution] = integrator.getSolution();
+
+            REQUIRE(
+                solution.isApprox(closeFormSolution(std::chrono::duration<double>(dT * i).count()),
+                                  tolerance));
+            REQUIRE(integrator.integrate(0s, dT));
+        }
+    }
+
+    SECTION("RK4 - compile time step")
+    {
+        constexpr double tolerance = 1e-8;
+
+        // the integration step (100us i.e. 1/10000 s) is provided at compile time
+        RK4<LinearTimeInvariantSystem, FixedTimeStep<1, 10000>> integrator;
+        REQUIRE(integrator.getIntegrationStep() == dT);
+        integrator.setDynamicalSystem(system);
+
+        for (int i = 0; i < simulationTime / dT; i++)
+        {
+            const auto& [solution] = integrator.getSolution();
+
+            REQUIRE(
+                solution.isApprox(closeFormSolution(std::chrono::duration<double>(dT * i).count()),
+                                  tolerance));
+            REQUIRE(integrator.integrate(0s, dT));
+        }
+    }
 }
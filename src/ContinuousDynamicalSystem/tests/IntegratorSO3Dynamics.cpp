@@ -0,0 +1,107 @@
+/**
+ * @file IntegratorSO3Dynamics.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <memory>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <manif/SO3.h>
+
+#include <BipedalLocomotion/ContinuousDynamicalSystem/ForwardEuler.h>
+#include <BipedalLocomotion/ContinuousDynamicalSystem/MuntheKaasRK4.h>
+#include <BipedalLocomotion/ContinuousDynamicalSystem/SO3Dynamics.h>
+
+using namespace BipedalLocomotion::ContinuousDynamicalSystem;
+using namespace BipedalLocomotion::GenericContainer::literals;
+using namespace std::chrono_literals;
+
+TEST_CASE("Munthe-Kaas RK4 - SO3")
+{
+    constexpr std::chrono::nanoseconds dT = 10ms;
+    constexpr std::chrono::nanoseconds simulationTime = 2s;
+
+    const manif::SO3d initialState = manif::SO3d::Random();
+    manif::SO3d::Tangent angularVelocity;
+    angularVelocity.coeffs() << 0.3, -0.1, 0.4;
+
+    auto system = std::make_shared<SO3Dynamics>();
+    REQUIRE(system->setState({initialState}));
+    REQUIRE(system->setControlInput({angularVelocity}));
+
+    SECTION("Constant angular velocity")
+    {
+        MuntheKaasRK4<SO3Dynamics> integrator;
+        REQUIRE(integrator.setIntegrationStep(dT));
+        REQUIRE(integrator.setDynamicalSystem(system));
+
+        for (std::chrono::nanoseconds t = 0s; t < simulationTime; t += dT)
+        {
+            // the closed form solution of the dynamics is R(t) = exp(t * omega) * R(0)
+            const double tInSeconds = std::chrono::duration<double>(t).count();
+            const manif::SO3d expected
+                = (angularVelocity * tInSeconds).exp() * initialState;
+
+            const auto& solution
+                = integrator.getSolution().get_from_hash<"LieGroup"_h>();
+
+            constexpr double tolerance = 1e-9;
+            REQUIRE(solution.rotation().isApprox(expected.rotation(), tolerance));
+
+            REQUIRE(integrator.integrate(0s, dT));
+        }
+    }
+
+    SECTION("Comparison with the forward Euler")
+    {
+        MuntheKaasRK4<SO3Dynamics> integrator;
+        REQUIRE(integrator.setIntegrationStep(dT));
+        REQUIRE(integrator.setDynamicalSystem(system));
+
+        // the forward Euler integrates the same system with a much smaller step
+        constexpr std::chrono::nanoseconds eulerDT = 100us;
+        auto eulerSystem = std::make_shared<SO3Dynamics>();
+        REQUIRE(eulerSystem->setState({initialState}));
+        REQUIRE(eulerSystem->setControlInput({angularVelocity}));
+
+        ForwardEuler<SO3Dynamics> eulerIntegrator;
+        REQUIRE(eulerIntegrator.setIntegrationStep(eulerDT));
+        REQUIRE(eulerIntegrator.setDynamicalSystem(eulerSystem));
+
+        REQUIRE(integrator.integrate(0s, simulationTime));
+        REQUIRE(eulerIntegrator.integrate(0s, simulationTime));
+
+        constexpr double tolerance = 1e-3;
+        REQUIRE(integrator.getSolution()
+                    .get_from_hash<"LieGroup"_h>()
+                    .rotation()
+                    .isApprox(eulerIntegrator.getSolution() //
+                                  .get_from_hash<"LieGroup"_h>()
+                                  .rotation(),
+                              tolerance));
+    }
+
+    SECTION("Compile time step")
+    {
+        // 1/100 s = 10 ms
+        MuntheKaasRK4<SO3Dynamics, FixedTimeStep<1, 100>> integrator;
+        REQUIRE(integrator.getIntegrationStep() == dT);
+        REQUIRE(integrator.setDynamicalSystem(system));
+
+        REQUIRE(integrator.integrate(0s, simulationTime));
+
+        const double tInSeconds = std::chrono::duration<double>(simulationTime).count();
+        const manif::SO3d expected = (angularVelocity * tInSeconds).exp() * initialState;
+
+        constexpr double tolerance = 1e-9;
+        REQUIRE(integrator.getSolution()
+                    .get_from_hash<"LieGroup"_h>()
+                    .rotation()
+                    .isApprox(expected.rotation(), tolerance));
+    }
+}
@@ -89,4 +89,34 @@ TEST_CASE("Multistate weight provider")
 
         REQUIRE(provider.getOutput().isApprox(walkingWeight, tolerance));
     }
+
+    SECTION("Steady state detection")
+    {
+        MultiStateWeightProvider provider;
+        REQUIRE(provider.initialize(params));
+
+        // the provider is initialized with the first state: the propagation is already frozen
+        REQUIRE(provider.advance());
+        const Eigen::VectorXd frozenOutput = provider.getOutput();
+        REQUIRE(provider.advance());
+        REQUIRE((provider.getOutput().array() == frozenOutput.array()).all());
+
+        REQUIRE(provider.setState("stance"));
+        for (unsigned int i = 0; i < 200; i++)
+        {
+            REQUIRE(provider.advance());
+        }
+
+        // after the transient the smoother converged and the output is frozen to the cached
+        // weight
+        const Eigen::VectorXd convergedOutput = provider.getOutput();
+        REQUIRE(convergedOutput.isApprox(stanceWeight, tolerance));
+        REQUIRE(provider.advance());
+        REQUIRE((provider.getOutput().array() == convergedOutput.array()).all());
+
+        // a new state unfreezes the propagation
+        REQUIRE(provider.setState("walking"));
+        REQUIRE(provider.advance());
+        REQUIRE_FALSE((provider.getOutput().array() == convergedOutput.array()).all());
+    }
 }
@@ -8,6 +8,9 @@
 #ifndef BIPEDAL_LOCOMOTION_CASADI_CONVERSIONS_H
 #define BIPEDAL_LOCOMOTION_CASADI_CONVERSIONS_H
 
+#include <cassert>
+#include <type_traits>
+
 #include <Eigen/Dense>
 
 #include <casadi/casadi.hpp>
@@ -17,26 +20,88 @@ namespace BipedalLocomotion
 namespace Conversions
 {
 
+// The zero-copy maps below rely on Eigen and casadi agreeing on the dense storage layout: both
+// store dense matrices column by column with double scalars
+static_assert(!Eigen::MatrixXd::IsRowMajor,
+              "The casadi::DM storage is column major. The zero-copy conversions require Eigen "
+              "matrices with the same layout.");
+static_assert(std::is_same_v<std::remove_pointer_t<decltype(std::declval<casadi::DM>().ptr())>,
+                             double>,
+              "The zero-copy conversions require casadi::DM to store double scalars.");
+
 /**
  * @brief Conversion from a casadi::DM to an Eigen matrix,
  * @param input The casadi::DM matrix.
+ * @warning The casadi matrix must be dense, otherwise the internal storage contains the nonzero
+ * entries only. Please use toEigenCopy() for a possibly sparse matrix.
  * @return A map from the internal data of the casadi matrix.
  */
 inline Eigen::Map<Eigen::MatrixXd> toEigen(casadi::DM& input)
 {
+    assert(input.is_dense());
     return Eigen::Map<Eigen::MatrixXd>(input.ptr(), input.rows(), input.columns());
 }
 
 /**
  * @brief Conversion from a casadi::DM to an Eigen matrix,
  * @param input The casadi::DM matrix.
+ * @warning The casadi matrix must be dense, otherwise the internal storage contains the nonzero
+ * entries only. Please use toEigenCopy() for a possibly sparse matrix.
  * @return A map from the internal data of the casadi matrix.
  */
 inline Eigen::Map<const Eigen::MatrixXd> toEigen(const casadi::DM& input)
 {
+    assert(input.is_dense());
     return Eigen::Map<const Eigen::MatrixXd>(input.ptr(), input.rows(), input.columns());
 }
 
+/**
+ * @brief Conversion from a casadi::DM to an Eigen matrix when the zero-copy map cannot be used,
+ * i.e. when the casadi matrix may be sparse. The matrix is densified and copied in bulk.
+ * @param input The casadi::DM matrix.
+ * @return An Eigen matrix containing the content of the casadi matrix.
+ */
+inline Eigen::MatrixXd toEigenCopy(const casadi::DM& input)
+{
+    if (input.is_dense())
+    {
+        return toEigen(input);
+    }
+
+    const casadi::DM dense = casadi::DM::densify(input);
+    return toEigen(dense);
+}
+
+/**
+ * @brief Conversion from an Eigen matrix to a casadi::DM. The output is resized only if needed
+ * and the content is copied in bulk through a map over the casadi storage, avoiding the scalar
+ * copies of the element-wise assignment.
+ * @param input The Eigen matrix.
+ * @param output The casadi::DM matrix.
+ */
+inline void toCasadiDM(const Eigen::Ref<const Eigen::MatrixXd>& input, casadi::DM& output)
+{
+    if (!output.is_dense() || output.rows() != input.rows() || output.columns() != input.cols())
+    {
+        output = casadi::DM::zeros(input.rows(), input.cols());
+    }
+
+    Eigen::Map<Eigen::MatrixXd>(output.ptr(), output.rows(), output.columns()) = input;
+}
+
+/**
+ * @brief Conversion from an Eigen matrix to a casadi::DM. The content is copied in bulk through a
+ * map over the casadi storage, avoiding the scalar copies of the element-wise assignment.
+ * @param input The Eigen matrix.
+ * @return A casadi::DM matrix containing the content of the Eigen matrix.
+ */
+inline casadi::DM toCasadiDM(const Eigen::Ref<const Eigen::MatrixXd>& input)
+{
+    casadi::DM output = casadi::DM::zeros(input.rows(), input.cols());
+    Eigen::Map<Eigen::MatrixXd>(output.ptr(), output.rows(), output.columns()) = input;
+    return output;
+}
+
 } // namespace Conversions
 } // namespace BipedalLocomotion
 
@@ -8,6 +8,8 @@
 #ifndef BIPEDAL_LOCOMOTION_COMMON_CONVERSIONS_H
 #define BIPEDAL_LOCOMOTION_COMMON_CONVERSIONS_H
 
+#include <type_traits>
+
 #include <Eigen/Dense>
 
 namespace BipedalLocomotion
@@ -17,14 +19,29 @@ namespace Conversions
     /**
      * @brief Construct homogeneous transformation matrix from rotation matrix and translation vector
      *
-     * @param rotation reference of rotation matrix
-     * @param translation reference of translation vector
+     * The arguments can be any Eigen expression (e.g. a block or a map) with the proper
+     * compile-time size: the expressions are evaluated directly in the returned matrix, so no
+     * temporary is materialized.
+     * @param rotation a 3x3 rotation matrix expression
+     * @param translation a 3x1 translation vector expression
      * @return homogeneous transform as a Eigen::Matrix4d object
      */
-    template <class Scalar>
-    Eigen::Matrix<Scalar, 4, 4> toEigenPose(const Eigen::Matrix<Scalar, 3, 3>& rotation,
-                                            const Eigen::Matrix<Scalar, 3, 1>& translation)
+    template <class RotationDerived, class TranslationDerived>
+    Eigen::Matrix<typename RotationDerived::Scalar, 4, 4>
+    toEigenPose(const Eigen::MatrixBase<RotationDerived>& rotation,
+                const Eigen::MatrixBase<TranslationDerived>& translation)
     {
+        static_assert(RotationDerived::RowsAtCompileTime == 3
+                          && RotationDerived::ColsAtCompileTime == 3,
+                      "The rotation must be a 3x3 matrix expression.");
+        static_assert(TranslationDerived::RowsAtCompileTime == 3
+                          && TranslationDerived::ColsAtCompileTime == 1,
+                      "The translation must be a 3x1 vector expression.");
+        static_assert(std::is_same<typename RotationDerived::Scalar,
+                                   typename TranslationDerived::Scalar>::value,
+                      "The rotation and the translation must share the same scalar type.");
+
+        using Scalar = typename RotationDerived::Scalar;
         Eigen::Matrix<Scalar, 4, 4> transform;
         transform.template topLeftCorner<3,3>() = rotation;
         transform.template topRightCorner<3,1>() = translation;
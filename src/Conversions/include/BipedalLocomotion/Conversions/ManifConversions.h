@@ -8,6 +8,8 @@
 #ifndef BIPEDAL_LOCOMOTION_MANIF_CONVERSIONS_H
 #define BIPEDAL_LOCOMOTION_MANIF_CONVERSIONS_H
 
+#include <cassert>
+
 #include <iDynTree/Core/EigenHelpers.h>
 #include <iDynTree/Core/Transform.h>
 #include <iDynTree/Core/Twist.h>
@@ -37,6 +39,9 @@ manif::SE3<Scalar> toManifPose(const Eigen::Matrix<Scalar, 3, 3>& rotation,
 /**
  * @brief Convert rotation matrix and translation vector to manif SE3d object
  *
+ * The Eigen refs bind blocks and maps with compatible storage without copying them; the only
+ * work performed by the conversion is the rotation matrix to quaternion transformation
+ * required by the manif representation.
  * @param rotation Eigen ref of 3x3 rotation matrix
  * @param translation Eigen ref of 3x1 translation vector
  * @return pose as manif SE3d object
@@ -103,6 +108,8 @@ inline manif::SO3d toManifRot(const iDynTree::Rotation& R)
  *
  * @param twist reference to iDynTree twist object
  * @return a twist as manif SE3Tangentd object
+ * @note The content of the twist is copied. If the twist outlives the conversion, consider
+ * using toManifTwistView() which returns a zero-cost view.
  */
 inline manif::SE3Tangentd toManifTwist(const iDynTree::Twist& twist)
 {
@@ -112,6 +119,28 @@ inline manif::SE3Tangentd toManifTwist(const iDynTree::Twist& twist)
     return manifTwist;
 }
 
+/**
+ * @brief Create a manif SE3Tangentd view over an iDynTree twist object
+ *
+ * Both the iDynTree twist and the manif SE3 tangent store six contiguous doubles with the
+ * linear part first, so the conversion is zero-cost: no element is copied and the returned map
+ * reads directly the memory of the twist.
+ * @param twist reference to iDynTree twist object
+ * @return a manif map over the twist
+ * @warning The map is valid only as long as the twist is alive.
+ */
+inline Eigen::Map<const manif::SE3Tangentd> toManifTwistView(const iDynTree::Twist& twist)
+{
+    // the view is meaningful only if the twist stores the linear and the angular parts in six
+    // contiguous doubles
+    static_assert(sizeof(iDynTree::Twist) == 6 * sizeof(double),
+                  "iDynTree::Twist is expected to store six contiguous doubles.");
+    assert(twist.getAngularVec3().data() == twist.getLinearVec3().data() + 3
+           && "The angular part of the twist is expected to follow the linear one.");
+
+    return Eigen::Map<const manif::SE3Tangentd>(twist.getLinearVec3().data());
+}
+
 /**
  * @brief Convert a manif SE3 object into and iDynTree::Transform
  *
@@ -8,10 +8,16 @@
 #ifndef BIPEDAL_LOCOMOTION_MATIOCPPCONVERSIONS_H
 #define BIPEDAL_LOCOMOTION_MATIOCPPCONVERSIONS_H
 
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
 #include <Eigen/Core>
 #include <iDynTree/Core/MatrixDynSize.h>
 #include <iDynTree/Core/EigenHelpers.h>
 #include <iDynTree/Core/MatrixFixSize.h>
+#include <matio.h>
 #include <matioCpp/matioCpp.h>
 #include <BipedalLocomotion/GenericContainer/Vector.h>
 
@@ -73,6 +79,9 @@ const Eigen::Map<Eigen::Matrix<type, Eigen::Dynamic, 1>> toEigen(const matioCpp:
  * @param input The input matrix.
  * @param name The name of the resulting matioCpp variable.
  * @return A matioCpp::MultiDimensionalArray containing a copy of the input data
+ * @note The input is copied once, directly in the storage owned by the matioCpp variable. A
+ * zero-copy conversion is not possible since matioCpp variables always own their buffer; to
+ * write a large matrix to file without materializing it twice use MatioChunkedWriter.
  */
 template <typename EigenDerived, typename = std::enable_if_t<Eigen::MatrixBase<EigenDerived>::RowsAtCompileTime != 1 &&
                                                              Eigen::MatrixBase<EigenDerived>::ColsAtCompileTime != 1>>
@@ -255,6 +264,143 @@ matioCpp::CellArray toMatioCppCellArray(const iterator& begin, const iterator& e
 }
 
 
+/**
+ * @brief Helper writing large matrices to a MAT file in chunks.
+ *
+ * The 7.3 version of the MAT format allows appending data to an existing variable. The writer
+ * exploits this feature to stream a large matrix to disk one block of columns at a time: each
+ * block is wrapped without copying it (the underlying matio variable points directly to the
+ * input buffer), so the peak memory required to save a matrix is the size of a block instead
+ * of twice the size of the full matrix.
+ *
+ * The expected usage is
+ * @code{.cpp}
+ * MatioChunkedWriter writer;
+ * writer.open("signals.mat");
+ * while (...)
+ * {
+ *     // chunk is a column-major Eigen matrix whose rows do not change between calls
+ *     writer.append(chunk, "joint_positions");
+ * }
+ * writer.close();
+ * @endcode
+ */
+class MatioChunkedWriter
+{
+public:
+    MatioChunkedWriter() = default;
+
+    /**
+     * @brief Destructor. It closes the file if still open.
+     */
+    ~MatioChunkedWriter()
+    {
+        this->close();
+    }
+
+    MatioChunkedWriter(const MatioChunkedWriter&) = delete;
+    MatioChunkedWriter& operator=(const MatioChunkedWriter&) = delete;
+
+    /**
+     * @brief Open the file associated to the writer.
+     * @param filePath path of the file. If the file already exists it is overwritten.
+     * @return true in case of success/false otherwise.
+     */
+    bool open(const std::string& filePath)
+    {
+        this->close();
+
+        // appending to an existing variable is supported only by the 7.3 version of the MAT
+        // format
+        m_file = Mat_CreateVer(filePath.c_str(), nullptr, MAT_FT_MAT73);
+        return m_file != nullptr;
+    }
+
+    /**
+     * @brief Append a block of columns to a variable of the file.
+     *
+     * The variable is created at the first call. The block is wrapped without copying it, so
+     * it must provide direct access to contiguous column-major storage (checked at compile
+     * time) and the number of rows must not change between two calls.
+     * @param chunk the block of columns to be appended.
+     * @param name the name of the variable.
+     * @param compression the compression applied to the block.
+     * @return true in case of success/false otherwise.
+     */
+    template <typename EigenDerived>
+    bool append(const Eigen::DenseBase<EigenDerived>& chunk,
+                const std::string& name,
+                const matio_compression compression = MAT_COMPRESSION_NONE)
+    {
+        using Scalar = typename EigenDerived::Scalar;
+
+        static_assert(std::is_same<Scalar, double>::value || std::is_same<Scalar, float>::value,
+                      "Only double and float matrices can be appended.");
+        static_assert(!EigenDerived::IsRowMajor,
+                      "The chunk must be stored in column-major order as required by the MAT "
+                      "format.");
+        static_assert((EigenDerived::Flags & Eigen::DirectAccessBit) != 0,
+                      "The chunk must provide direct access to its storage. Please evaluate the "
+                      "expression in a matrix before appending it.");
+
+        if (m_file == nullptr)
+        {
+            assert(false && "[MatioChunkedWriter::append] The file is not open.");
+            return false;
+        }
+
+        const auto& derived = chunk.derived();
+        if (derived.outerStride() != derived.rows())
+        {
+            // the storage is not contiguous (e.g. the chunk is a block of a bigger matrix)
+            assert(false && "[MatioChunkedWriter::append] The chunk storage is not contiguous.");
+            return false;
+        }
+
+        std::size_t dimensions[2] = {static_cast<std::size_t>(derived.rows()),
+                                     static_cast<std::size_t>(derived.cols())};
+
+        // MAT_F_DONT_COPY_DATA makes the variable point directly to the input buffer
+        matvar_t* variable
+            = Mat_VarCreate(name.c_str(),
+                            std::is_same<Scalar, float>::value ? MAT_C_SINGLE : MAT_C_DOUBLE,
+                            std::is_same<Scalar, float>::value ? MAT_T_SINGLE : MAT_T_DOUBLE,
+                            2,
+                            dimensions,
+                            const_cast<Scalar*>(derived.data()),
+                            MAT_F_DONT_COPY_DATA);
+        if (variable == nullptr)
+        {
+            return false;
+        }
+
+        // append along the second dimension, i.e. the chunk columns follow the ones already
+        // written
+        constexpr int appendDimension = 2;
+        const bool ok = Mat_VarWriteAppend(m_file, variable, compression, appendDimension) == 0;
+
+        // the input buffer is not freed since the variable does not own it
+        Mat_VarFree(variable);
+
+        return ok;
+    }
+
+    /**
+     * @brief Close the file.
+     */
+    void close()
+    {
+        if (m_file != nullptr)
+        {
+            Mat_Close(m_file);
+            m_file = nullptr;
+        }
+    }
+
+private:
+    mat_t* m_file{nullptr}; /**< Underlying matio file. */
+};
+
 } //namespace Conversions
 } //namespace BipedalLocomotion
 
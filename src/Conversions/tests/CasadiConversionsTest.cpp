@@ -0,0 +1,68 @@
+/**
+ * @file CasadiConversionsTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <Eigen/Dense>
+#include <casadi/casadi.hpp>
+
+#include <BipedalLocomotion/Conversions/CasadiConversions.h>
+
+using namespace BipedalLocomotion::Conversions;
+
+TEST_CASE("Casadi Conversions")
+{
+    SECTION("Zero-copy map over a dense casadi::DM")
+    {
+        casadi::DM dm = casadi::DM::zeros(3, 2);
+        auto map = toEigen(dm);
+        map.setRandom();
+
+        // the map writes directly in the casadi storage
+        for (int i = 0; i < 3; i++)
+        {
+            for (int j = 0; j < 2; j++)
+            {
+                REQUIRE(static_cast<double>(dm(i, j)) == map(i, j));
+            }
+        }
+    }
+
+    SECTION("Eigen to casadi::DM round trip")
+    {
+        const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(4, 3);
+
+        const casadi::DM dm = toCasadiDM(matrix);
+        REQUIRE(toEigen(dm).isApprox(matrix));
+
+        // the in-place overload reuses the storage when the size matches
+        casadi::DM buffer = casadi::DM::zeros(4, 3);
+        const double* ptr = buffer.ptr();
+        toCasadiDM(matrix, buffer);
+        REQUIRE(buffer.ptr() == ptr);
+        REQUIRE(toEigen(buffer).isApprox(matrix));
+
+        // a mismatching buffer is resized
+        casadi::DM smallBuffer = casadi::DM::zeros(2, 2);
+        toCasadiDM(matrix, smallBuffer);
+        REQUIRE(smallBuffer.rows() == 4);
+        REQUIRE(smallBuffer.columns() == 3);
+        REQUIRE(toEigen(smallBuffer).isApprox(matrix));
+    }
+
+    SECTION("Bulk copy fallback for a sparse casadi::DM")
+    {
+        // casadi::DM::eye is stored as a sparse diagonal matrix, hence the zero-copy map cannot
+        // be used
+        const casadi::DM sparse = casadi::DM::eye(3);
+        REQUIRE_FALSE(sparse.is_dense());
+
+        const Eigen::MatrixXd dense = toEigenCopy(sparse);
+        REQUIRE(dense.isApprox(Eigen::MatrixXd::Identity(3, 3)));
+    }
+}
@@ -32,4 +32,28 @@ TEST_CASE("Manif Conversions")
 
     manif::SE3d pose2 = BipedalLocomotion::Conversions::toManifPose(R, pos);
     REQUIRE(pose2.transform().isApprox(iDynTree::toEigen(iDynH.asHomogeneousTransform())));
+
+    // toEigenPose accepts generic expressions without materializing them
+    Eigen::Matrix4d HFromBlocks
+        = BipedalLocomotion::Conversions::toEigenPose(H.topLeftCorner<3, 3>(),
+                                                      H.topRightCorner<3, 1>());
+    REQUIRE(HFromBlocks.isApprox(H, tolerance));
+}
+
+TEST_CASE("Twist View")
+{
+    iDynTree::Twist twist;
+    for (unsigned int i = 0; i < 6; i++)
+    {
+        twist(i) = i + 0.5;
+    }
+
+    const manif::SE3Tangentd copied = BipedalLocomotion::Conversions::toManifTwist(twist);
+    const auto view = BipedalLocomotion::Conversions::toManifTwistView(twist);
+
+    REQUIRE(view.coeffs().isApprox(copied.coeffs()));
+
+    // the view reads directly the memory of the twist
+    twist(0) = -1.0;
+    REQUIRE(view.coeffs()(0) == -1.0);
 }
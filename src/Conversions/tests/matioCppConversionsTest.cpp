@@ -152,3 +152,27 @@ TEST_CASE("From matioCpp to Eigen")
     checkSameMatrix(toEigenMatrix, matioCppMatrix);
 
 }
+
+TEST_CASE("Chunked writer")
+{
+    const std::string filePath = "chunked_writer_test.mat";
+
+    Eigen::MatrixXd firstChunk = Eigen::MatrixXd::Random(4, 3);
+    Eigen::MatrixXd secondChunk = Eigen::MatrixXd::Random(4, 5);
+
+    MatioChunkedWriter writer;
+    REQUIRE(writer.open(filePath));
+    REQUIRE(writer.append(firstChunk, "signal"));
+    REQUIRE(writer.append(secondChunk, "signal"));
+    writer.close();
+
+    // the chunks are expected to be stacked along the columns
+    matioCpp::File file(filePath);
+    REQUIRE(file.isOpen());
+    matioCpp::MultiDimensionalArray<double> signal
+        = file.read("signal").asMultiDimensionalArray<double>();
+
+    Eigen::MatrixXd expected(4, 8);
+    expected << firstChunk, secondChunk;
+    checkSameMatrix(expected, signal);
+}
@@ -24,6 +24,9 @@ namespace Estimators
  * RecursiveLeastSquare contains the implementation of the Recursive least square filter described
  * in Lennart Ljung - System Identification Theory for the User (1999, Prentice Hall). Chapter 11
  * Section 2.
+ * Beside the classic exponential forgetting formulation, the filter can run in sliding-window
+ * mode: only the last "window_size" samples contribute to the estimate and the information matrix
+ * is modified with a rank-1 update (downdate) every time a sample enters (leaves) the window.
  */
 
 struct RecursiveLeastSquareState
@@ -58,6 +61,62 @@ class RecursiveLeastSquare : public System::Source<RecursiveLeastSquareState>
 
     Eigen::MatrixXd m_regressor; /**< Regressor matrix */
 
+    int m_windowSize{0}; /**< Number of samples stored in the sliding window. If equal to 0 the
+                              classic exponential forgetting formulation is used */
+
+    Eigen::MatrixXd m_windowRegressors; /**< Vertical stack of the regressors of the samples stored
+                                             in the sliding window */
+
+    Eigen::MatrixXd m_windowMeasurements; /**< Measurements of the samples stored in the sliding
+                                               window, one column per sample */
+
+    int m_windowHead{0}; /**< Index of the oldest sample stored in the sliding window */
+
+    int m_windowCount{0}; /**< Number of samples currently stored in the sliding window */
+
+    Eigen::VectorXd m_measurementVariances; /**< Diagonal of the measurement covariance matrix */
+
+    Eigen::VectorXd m_covarianceTimesRegressorRow; /**< Workspace containing the product between
+                                                        the state covariance and a row of the
+                                                        regressor */
+
+    Eigen::VectorXd m_windowGain; /**< Workspace containing the gain of the rank-1 update */
+
+    /**
+     * Update the state and its covariance with the classic exponential forgetting formulation.
+     * @param regressor regressor of the sample
+     * @param measurements measurements of the sample
+     * @return True in case of success, false otherwise.
+     */
+    bool updateWithForgettingFactor(const Eigen::Ref<const Eigen::MatrixXd>& regressor,
+                                    const Eigen::Ref<const Eigen::VectorXd>& measurements);
+
+    /**
+     * Insert a sample in the sliding window, evicting the oldest one when the window is full. The
+     * information matrix is modified with a rank-1 update (downdate) for each row of the regressor
+     * of the entering (leaving) sample, so sliding the window costs O(n^2) in the number of
+     * estimated parameters instead of re-solving the full least square problem.
+     * @param regressor regressor of the sample
+     * @param measurements measurements of the sample
+     * @return True in case of success, false otherwise.
+     */
+    bool updateWithSlidingWindow(const Eigen::Ref<const Eigen::MatrixXd>& regressor,
+                                 const Eigen::Ref<const Eigen::VectorXd>& measurements);
+
+    /**
+     * Apply a rank-1 update (or downdate) of the information matrix directly on the state and its
+     * covariance by means of the Sherman-Morrison formula.
+     * @param regressorRow row of the regressor associated to the scalar measurement
+     * @param measurement scalar measurement
+     * @param variance variance of the measurement
+     * @param downdate if true the contribution of the sample is removed from the estimate
+     * @return True in case of success, false otherwise.
+     */
+    bool applyRankOneUpdate(const Eigen::Ref<const Eigen::RowVectorXd>& regressorRow,
+                            const double& measurement,
+                            const double& variance,
+                            const bool& downdate);
+
     /**
      * Enumerator useful to described the current status of the filter
      */
@@ -83,6 +142,11 @@ public:
      equivalent to a kalman filter if lambda is equal to 1)
      * - "state" vector containing the initial guess of the state
      * - "state_covariance" vector containing the diagonal matrix of the covariance of the state
+     * @note The following parameter is optional:
+     * - "window_size" number of samples kept in the sliding window. If the parameter is set the
+     filter estimates the parameters using only the last "window_size" samples: every time a sample
+     enters (leaves) the window the information matrix is modified with a rank-1 update (downdate).
+     In this mode "lambda" is not used.
      * @param handlerWeak weak pointer to a ParametersHandler::IParametersHandler interface
      * @tparameter Derived particular implementation of the IParameterHandler
      * @return True in case of success, false otherwise.
@@ -120,6 +184,18 @@ public:
      */
     bool advance() final;
 
+    /**
+     * Compute one step of the filter for each sample of a batch of measurements
+     * @parameter regressors vertical stack of the regressor matrices, one block of rows per sample
+     * @parameter measurements matrix containing the measurements, one column per sample
+     * @note This method is useful when the samples arrive in bursts, e.g. when the measurements
+     * are collected by a sensor bridge running at a rate higher than the one of the estimation
+     * loop. The samples are processed in order, from the first column to the last one.
+     * @return True in case of success, false otherwise
+     */
+    bool advanceBatch(const Eigen::Ref<const Eigen::MatrixXd>& regressors,
+                      const Eigen::Ref<const Eigen::MatrixXd>& measurements);
+
     /**
      * Get the expected value and the covariance matrix of the estimated parameters.
      * @return A struct containing the expected value and the covariance of the estimated
@@ -172,6 +172,10 @@ private:
     manif::SE3d m_frame_H_link; /**< coordinate change matrix from foot link frame to foot sole frame
                                  */
     Eigen::Vector3d m_gravity;
+    Eigen::VectorXd m_cachedJointPositions; /**< joint positions used to compute m_link_H_base */
+    manif::SE3d m_link_H_base; /**< coordinate change matrix from the base frame to the stance foot
+                                  link frame, precomputed from the joint positions */
+    bool m_isChainCached{false}; /**< true when m_link_H_base matches m_cachedJointPositions */
     iDynTree::KinDynComputations m_kinDyn;
     iDynTree::Model m_model;
     iDynTree::LinkIndex m_linkIndex;
@@ -209,6 +209,45 @@ public:
     bool setKinematics(const Eigen::VectorXd& encoders,
                        const Eigen::VectorXd& encoderSpeeds);
 
+    /**
+    * Bind the IMU measurement inputs to external buffers, typically the snapshot buffers of a
+    * sensor bridge. The binding replaces the per-tick copy performed by setIMUMeasurement: the
+    * buffers are read directly at the beginning of every estimation step whenever the producer
+    * signals fresh data through signalMeasurementsUpdated().
+    * @note the buffers must outlive the binding and must not be reallocated after this call.
+    * @param[in] accMeas pointer to the accelerometer measurement buffer (3 doubles)
+    * @param[in] gyroMeas pointer to the gyroscope measurement buffer (3 doubles)
+    * @return True in case of success, false otherwise.
+    */
+    bool bindIMUMeasurement(const double* accMeas, const double* gyroMeas);
+
+    /**
+    * Bind the kinematic measurement inputs to external buffers, typically the snapshot buffers of
+    * a sensor bridge. See bindIMUMeasurement for the intended usage pattern.
+    * @note the buffers must outlive the binding and must not be reallocated after this call.
+    * @param[in] encoders pointer to the joint position measurement buffer
+    * @param[in] encoderSpeeds pointer to the joint velocity measurement buffer
+    * @param[in] nrJoints number of joints contained in the buffers
+    * @return True in case of success, false otherwise.
+    */
+    bool bindKinematics(const double* encoders,
+                        const double* encoderSpeeds,
+                        const std::size_t nrJoints);
+
+    /**
+    * Signal that the buffers bound through bindIMUMeasurement or bindKinematics contain fresh
+    * measurements. The bound buffers are consumed at the beginning of the next advance(),
+    * predict() or correct() call; when no new generation is signaled the previous measurements
+    * are reused without touching the buffers.
+    */
+    void signalMeasurementsUpdated();
+
+    /**
+    * Remove all the measurement bindings. The estimator falls back to the measurements passed
+    * through the set methods.
+    */
+    void unbindMeasurements();
+
     /**
      * Set the relative pose of a landmark relative to the base link
      *
@@ -223,12 +262,71 @@ public:
                                  const Eigen::Vector3d& pos,
                                  const std::chrono::nanoseconds& timeNow);
 
+    /**
+     * Fuse a measurement stamped in the past by rewinding the estimator to the
+     * cached state closest to the measurement time stamp, applying the
+     * correction and fast-forwarding to the current time instant by replaying
+     * the cached inputs internally.
+     *
+     * The measurement is a relative pose of a landmark with respect to the base link
+     * (see setLandmarkRelativePose()) and is fused through the
+     * updateLandmarkRelativePoses() hook of the derived class.
+     *
+     * @note this method requires the "enable_delayed_measurement_fusion" option to be enabled.
+     * The time stamp must be expressed on the internal estimation clock, which starts at zero
+     * at the first advance() call and increases by the sampling period at every step
+     * (see getEstimationTime()).
+     *
+     * @param[in] landmarkID unique landmark ID
+     * @param[in] quat relative orientation of the landmark as a quaternion
+     * @param[in] pos relative position of the landmark
+     * @param[in] timeStamp time instant at which the measurement was taken
+     * @return true in case of success, false if the time stamp is older than the
+     * buffered history or the history is disabled
+     */
+    bool setDelayedMeasurement(const int& landmarkID,
+                               const Eigen::Quaterniond& quat,
+                               const Eigen::Vector3d& pos,
+                               const std::chrono::nanoseconds& timeStamp);
+
+    /**
+     * Get the internal estimation time, starting at zero at the first advance() call
+     * and increasing by the sampling period at every step.
+     * @return the internal estimation time
+     */
+    const std::chrono::nanoseconds& getEstimationTime() const;
+
     /**
     * Compute one step of the estimator
     * @return True in case of success, false otherwise.
     */
     virtual bool advance() final;
 
+    /**
+    * Propagate the internal state through the prediction model using the latest IMU measurement
+    * set with setIMUMeasurement(). This method can be called at the IMU rate, decoupled from
+    * correct(), so that the propagation runs at the sensor rate while the expensive
+    * Jacobian-bearing measurement updates are performed only when new kinematic measurements
+    * are available. When using the decoupled interface, the "sampling_period_in_s" parameter
+    * must match the period at which predict() is called, i.e., the IMU period.
+    * @note predict() and correct() are alternatives to the monolithic advance(); do not mix the
+    * two interfaces within the same estimation loop. The delayed measurement fusion
+    * (see setDelayedMeasurement()) is available only with the advance() interface.
+    * @return True in case of success, false otherwise.
+    */
+    bool predict();
+
+    /**
+    * Update the predicted states using the latest kinematic, contact and landmark measurements
+    * set with setKinematics(), setContacts()/setContactStatus() and setLandmarkRelativePose().
+    * This method can be called at the measurement rate, typically lower than the IMU rate. The
+    * time elapsed since the previous correction is accounted for internally by counting the
+    * predict() calls in between, so the measurement noise discretization remains consistent.
+    * @note at least one predict() call must precede the first correct() call.
+    * @return True in case of success, false otherwise.
+    */
+    bool correct();
+
     /**
      * Reset the internal state of the estimator
      * @param[in] newState Internal state of the estimator
@@ -313,6 +411,27 @@ protected:
     virtual bool updateLandmarkRelativePoses(FloatingBaseEstimators::Measurements& meas,
                                              const double& dt) { return true; };
 
+    /**
+    * Cache the internal state covariance representation of the derived filter.
+    * Derived classes maintaining a covariance matrix internally must override this method
+    * for the delayed measurement fusion to restore it consistently during a replay.
+    * @param[out] covariance internal covariance representation
+    * @return True in case of success, false otherwise.
+    */
+    virtual bool cacheInternalCovariance(Eigen::MatrixXd& covariance)
+    {
+        covariance.resize(0, 0);
+        return true;
+    };
+
+    /**
+    * Restore the internal state covariance representation of the derived filter,
+    * previously cached with cacheInternalCovariance().
+    * @param[in] covariance internal covariance representation
+    * @return True in case of success, false otherwise.
+    */
+    virtual bool restoreInternalCovariance(const Eigen::MatrixXd& covariance) { return true; };
+
     /**
      * Wrapper method for getting base state from internal IMU state
      * @param[in] state internal state of the estimator
@@ -331,6 +450,11 @@ protected:
     * - enable_static_imu_bias_initialization [PARAMETER|-|Enable/disable IMU bias initialization assuming static configuration]
     * - nr_samples_for_imu_bias_initialization [PARAMETER|REQUIRED, if staticImuBiasInitializationEnabled is set to true|Number of samples for static bias initialization]
     * - enable_ekf_update [PARAMETER|-|Enable/disable update step of EKF (not recommended to set to false)]
+    * - use_square_root_covariance [PARAMETER|-|Enable/disable the square-root covariance propagation, if supported by the estimator]
+    * - linearization_update_period [PARAMETER|-|Number of predict steps between Jacobian re-linearizations, defaults to 1]
+    * - relinearization_threshold [PARAMETER|-|State displacement from the linearization point forcing an early re-linearization, non-positive to disable]
+    * - enable_delayed_measurement_fusion [PARAMETER|-|Enable/disable the fixed-lag history used by setDelayedMeasurement()]
+    * - measurement_history_depth [PARAMETER|-|Depth of the state and measurement history ring buffer in number of steps, defaults to 64]
     * - acceleration_due_to_gravity [PARAMETER|-|Acceleration due to gravity, 3d vector]
     * @note this is a recipe method that can be called by the derived class from within customInitialization()
     * @param[in] handler parameter handler
@@ -396,6 +520,7 @@ protected:
     ModelComputations m_modelComp; /**< Model computations object */
     FloatingBaseEstimators::Options m_options; /**< Struct holding estimator options */
     FloatingBaseEstimators::Measurements m_meas, m_measPrev; /**< Struct holding the latest measurements that were set to the estimator */
+    FloatingBaseEstimators::MeasurementBindings m_measBindings; /**< Non-owning views over external sensor buffers consumed at every estimation step */
     FloatingBaseEstimators::InternalState m_state, m_statePrev; /**< Structs holding the curent and previous internal states of the estimation algorithm */
     FloatingBaseEstimators::Output m_estimatorOut; /**< Struct holding outputs of the estimator */
     FloatingBaseEstimators::StateStdDev m_priors, m_stateStdDev; /**< Struct holding standard deviations associated to prior state estimates */
@@ -420,6 +545,57 @@ protected:
     bool m_useModelInfo{true}; /**< Flag to enable running the estimator without using the URDF model information*/
     bool m_isInvEKF{false}; /**< Flag to maintain soon to be deprecated functionalities currently existing only in InvEKFBaseEstimator */
 private:
+    /**
+    * Snapshot of the estimator internals cached at every advance() call,
+    * used by setDelayedMeasurement() to rewind and replay the estimation
+    */
+    struct Snapshot
+    {
+        FloatingBaseEstimators::InternalState state; /**< posterior state at this step */
+        FloatingBaseEstimators::StateStdDev stateStdDev; /**< posterior state deviations at this step */
+        FloatingBaseEstimators::Measurements meas; /**< measurements consumed at this step */
+        Eigen::MatrixXd covariance; /**< internal covariance representation of the derived filter */
+        std::chrono::nanoseconds time{std::chrono::nanoseconds::zero()}; /**< internal estimation time of this step */
+    };
+
+    /**
+    * Run one estimation step (prediction and measurement updates) with the given measurements.
+    * This is the core of advance(), shared with the delayed measurement replay.
+    * @param[in] meas measurements used by the update steps
+    * @param[in] measPrev measurements used as exogeneous inputs by the prediction step
+    * @return True in case of success, false otherwise.
+    */
+    bool estimateStep(FloatingBaseEstimators::Measurements& meas,
+                      const FloatingBaseEstimators::Measurements& measPrev);
+
+    /**
+    * Update the robot state of the internal KinDynComputations object with the given encoder
+    * measurements and the current base state estimate
+    * @param[in] meas measurements holding the encoder readings
+    * @return True in case of success, false otherwise.
+    */
+    bool setKinDynRobotState(const FloatingBaseEstimators::Measurements& meas);
+
+    /**
+    * Run the enabled measurement updates (kinematics and landmarks) on the given measurements
+    * @param[in] meas measurements used by the update steps
+    * @param[in] dt time elapsed since the previous measurement update in seconds
+    * @return True in case of success, false otherwise.
+    */
+    bool applyMeasurementUpdates(FloatingBaseEstimators::Measurements& meas, const double& dt);
+
+    /**
+    * Copy the content of the bound sensor buffers into the internal measurement struct if a new
+    * generation was signaled since the last estimation step. It is a no-op when no binding is
+    * active or no fresh data is available.
+    */
+    void refreshBoundMeasurements();
+
+    /**
+    * Store the current estimator internals in the history ring buffer
+    */
+    void pushSnapshot();
+
     /**
     * Setup model related parameters
     *
@@ -440,6 +616,13 @@ private:
     bool setupFixedVectorParamPrivate(const std::string& param, const std::string& prefix,
                                       std::weak_ptr<BipedalLocomotion::ParametersHandler::IParametersHandler> handler,
                                       std::vector<double>& vec);
+
+    std::vector<Snapshot> m_history; /**< Preallocated fixed-lag history ring buffer */
+    std::size_t m_historyHead{0}; /**< Index of the ring buffer slot written by the next snapshot */
+    std::size_t m_historyCount{0}; /**< Number of valid snapshots in the ring buffer */
+    std::chrono::nanoseconds m_estimationTime{std::chrono::nanoseconds::zero()}; /**< Internal estimation time advancing by the sampling period at every step */
+    std::size_t m_predictsSinceCorrection{0}; /**< Number of predict() calls since the last correct() call, used to scale the measurement update period */
+    FloatingBaseEstimators::Measurements m_delayedMeas; /**< Scratch measurements container used during the delayed measurement replay */
 };
 
 
@@ -14,6 +14,7 @@
 #include <BipedalLocomotion/FloatingBaseEstimators/FloatingBaseEstimatorParams.h>
 #include <BipedalLocomotion/Contacts/Contact.h>
 #include <manif/manif.h>
+#include <cstdint>
 #include <map>
 
 namespace BipedalLocomotion
@@ -97,6 +98,29 @@ struct Measurements
     std::map<int, BipedalLocomotion::Contacts::EstimatedContact > stampedContactsStatus;
 };
 
+/**
+* @brief Struct holding non-owning views over the sensor buffers of an external source,
+* typically the snapshot buffers of a sensor bridge
+*
+* @note the views are established once through the bind methods of the estimator and read
+* at every estimation step, so the per-tick cost reduces to incrementing the generation
+* counter on the producer side. The producer must guarantee that the mapped buffers outlive
+* the bindings and are not resized or reallocated after binding.
+*/
+struct MeasurementBindings
+{
+    Eigen::Map<const Eigen::Vector3d> acc{nullptr}; /**< view over the accelerometer measurement buffer */
+    Eigen::Map<const Eigen::Vector3d> gyro{nullptr}; /**< view over the gyroscope measurement buffer */
+    Eigen::Map<const Eigen::VectorXd> encoders{nullptr, 0}; /**< view over the joint position measurement buffer */
+    Eigen::Map<const Eigen::VectorXd> encodersSpeed{nullptr, 0}; /**< view over the joint velocity measurement buffer */
+
+    bool imuBound{false}; /**< flag set when the IMU views are valid */
+    bool kinematicsBound{false}; /**< flag set when the kinematic views are valid */
+
+    std::uint64_t generation{0}; /**< counter incremented by the producer every time the mapped buffers are refreshed */
+    std::uint64_t consumedGeneration{0}; /**< value of the generation counter at the last estimation step */
+};
+
 } // namespace FloatingBaseEstimators
 } // namespace Estimators
 } // namespace BipedalLocomotion
@@ -233,6 +233,48 @@ struct Options
     bool staticLandmarksUpdateEnabled{false};
 
 
+    /**
+     * @brief Enable/disable the square-root covariance propagation.
+     *        When enabled the filter propagates a Cholesky factor of the state
+     *        covariance instead of the full matrix, improving the numerical
+     *        conditioning of the predict/update cycle
+     */
+    bool useSquareRootCovariance{false};
+
+    /**
+     * @brief Period, in number of predict steps, at which the filter Jacobians
+     *        are re-linearized. With the default value of 1 the linearization
+     *        is refreshed at every step. Larger values reuse the cached
+     *        Jacobians in between, reducing the predict-step cost
+     */
+    int linearizationUpdatePeriod{1};
+
+    /**
+     * @brief State displacement between the current estimate and the last
+     *        linearization point that forces an early re-linearization.
+     *        The displacement accumulates the IMU position and linear velocity
+     *        deltas with the orientation geodesic distance. A non-positive
+     *        value disables the check
+     */
+    double relinearizationThreshold{0.0};
+
+    /**
+     * @brief Enable/disable the fixed-lag state and measurement history used to
+     *        fuse delayed measurements. When enabled the estimator caches its
+     *        internal state, covariance and inputs at every advance() call so
+     *        that a measurement stamped in the past can be fused by rewinding
+     *        and replaying internally
+     */
+    bool delayedMeasurementFusionEnabled{false};
+
+    /**
+     * @brief Depth of the preallocated state and measurement history ring
+     *        buffer, in number of estimator steps. It bounds the maximum
+     *        measurement delay that can be recovered to
+     *        measurementHistoryDepth times the sampling period
+     */
+    int measurementHistoryDepth{64};
+
     /**
     * @brief Acceleration vector due to gravity
     *
@@ -123,6 +123,21 @@ protected:
     virtual bool updateKinematics(FloatingBaseEstimators::Measurements& meas,
                                   const double& dt) override;
 
+    /**
+    * Cache the internal state covariance, used by the delayed measurement fusion
+    * @note in square-root mode the Cholesky factor of the covariance is cached
+    * @param[out] covariance internal covariance representation
+    * @return True in case of success, false otherwise.
+    */
+    virtual bool cacheInternalCovariance(Eigen::MatrixXd& covariance) override;
+
+    /**
+    * Restore the internal state covariance previously cached with cacheInternalCovariance()
+    * @param[in] covariance internal covariance representation
+    * @return True in case of success, false otherwise.
+    */
+    virtual bool restoreInternalCovariance(const Eigen::MatrixXd& covariance) override;
+
 private:
     /**
     * Private implementation of the class
@@ -84,6 +84,19 @@ public:
      */
     bool update() override;
 
+    /**
+     * Update the content of the element for a batch of sigma points. Since the model only copies
+     * a segment of the state (plus the bias when enabled), the whole batch is computed with block
+     * operations without sweeping the sigma points one by one.
+     * @param states matrix whose columns are the sigma points.
+     * @param inputs vector of `UKFInput` objects (unused by this model).
+     * @param updatedVariables matrix receiving one updated variable per column.
+     * @return True in case of success, false otherwise.
+     */
+    bool updateBatch(Eigen::Ref<const Eigen::MatrixXd> states,
+                     const std::vector<UKFInput>& inputs,
+                     Eigen::Ref<Eigen::MatrixXd> updatedVariables) override;
+
     /**
      * Set the state of the ukf needed to update the dynamics of the state/measurement variable associated to ths object.
      * @param ukfState reference to the ukf state.
@@ -145,6 +145,24 @@ public:
      */
     virtual bool update();
 
+    /**
+     * Update the dynamics of the variable for a batch of sigma points in a single call. Each
+     * column of `states` is one sigma point and the corresponding column of `updatedVariables`
+     * receives the updated variable, so the per-model virtual dispatch is paid once per batch
+     * instead of three times per sigma point. The base implementation sweeps the columns calling
+     * setState(), setInput() and update(); models whose dynamics depend on the state only can
+     * override it with a vectorized structure-of-arrays sweep.
+     * @param states matrix whose columns are the sigma points.
+     * @param inputs vector of `UKFInput` objects. It must contain either one input per sigma
+     * point or a single input shared by all the sigma points.
+     * @param updatedVariables matrix of size `size() x states.cols()` receiving the updated
+     * variables.
+     * @return True in case of success, false otherwise.
+     */
+    virtual bool updateBatch(Eigen::Ref<const Eigen::MatrixXd> states,
+                             const std::vector<UKFInput>& inputs,
+                             Eigen::Ref<Eigen::MatrixXd> updatedVariables);
+
     /**
      * Get the next value m_updatedVariable.
      * @return a const reference to the next variable value.
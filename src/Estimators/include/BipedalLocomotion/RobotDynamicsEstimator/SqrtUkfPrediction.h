@@ -0,0 +1,115 @@
+/**
+ * @file SqrtUkfPrediction.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_ESTIMATORS_SQRT_UKF_PREDICTION_H
+#define BIPEDAL_LOCOMOTION_ESTIMATORS_SQRT_UKF_PREDICTION_H
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+// BayesFilters
+#include <BayesFilters/AdditiveStateModel.h>
+
+// BLF
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+
+namespace BipedalLocomotion
+{
+namespace Estimators
+{
+namespace RobotDynamicsEstimator
+{
+
+// clang-format off
+/**
+ * SqrtUkfPrediction implements the prediction step of a square-root unscented Kalman filter
+ * (SR-UKF, Van der Merwe and Wan) on top of a `bfl::AdditiveStateModel` such as UkfState.
+ * Differently from the standard unscented prediction, the lower triangular Cholesky factor of the
+ * state covariance is carried across the steps: the sigma points are drawn directly from the
+ * columns of the factor, and the predicted factor is recovered with a thin QR decomposition of the
+ * weighted sigma-point deviations followed by a rank-1 Cholesky update for the central point. No
+ * per-step factorization of the full covariance is ever performed.
+ */
+class SqrtUkfPrediction
+{
+public:
+    /**
+     * Constructor.
+     */
+    SqrtUkfPrediction();
+
+    /**
+     * Destructor.
+     */
+    ~SqrtUkfPrediction();
+
+    /**
+     * Initialize the unscented transform parameters.
+     * @param handler pointer to the IParametersHandler interface.
+     * @note the following parameters are optional
+     * | Parameter Name |   Type   |                        Description                        | Mandatory |
+     * |:--------------:|:--------:|:---------------------------------------------------------:|:---------:|
+     * |    `alpha`     | `double` |  Spread of the sigma points around the mean. Default 1.0. |    No     |
+     * |    `beta`      | `double` | Prior knowledge of the state distribution. Default 2.0.   |    No     |
+     * |    `kappa`     | `double` |        Secondary scaling parameter. Default 0.0.          |    No     |
+     * @return True in case of success, false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
+
+    /**
+     * Set the state model propagating the sigma points. The process noise covariance returned by
+     * the model is factorized once here and reused at every prediction step.
+     * @param stateModel a pointer to the additive state model, e.g., a UkfState.
+     * @return True in case of success, false otherwise.
+     */
+    bool setStateModel(std::shared_ptr<bfl::AdditiveStateModel> stateModel);
+
+    /**
+     * Enable the block-diagonal covariance mode. The state covariance factor is stored and
+     * triangularized per block instead of as one dense factor, exploiting the block-diagonal
+     * structure induced by the sub-model decomposition (see
+     * `UkfState::getCovarianceBlockSizes`). The cross-covariance between different blocks is
+     * dropped by construction, so variables that are strongly coupled should be placed in the same
+     * block by merging the corresponding entries of the partition.
+     * @param blockSizes sizes of the diagonal blocks of the covariance, in state order. The sizes
+     * must be positive and must sum to the state size. An empty vector restores the dense mode.
+     * @note This method should be called after setStateModel.
+     * @return True in case of success, false otherwise.
+     */
+    bool setBlockStructure(const std::vector<Eigen::Index>& blockSizes);
+
+    /**
+     * Perform one square-root unscented prediction step.
+     * @param mean state mean at the previous step.
+     * @param sqrtCovariance lower triangular Cholesky factor S of the state covariance at the
+     * previous step, i.e., P = S S^T.
+     * @param predictedMean predicted state mean.
+     * @param predictedSqrtCovariance lower triangular Cholesky factor of the predicted state
+     * covariance.
+     * @return True in case of success, false otherwise.
+     */
+    bool predict(Eigen::Ref<const Eigen::VectorXd> mean,
+                 Eigen::Ref<const Eigen::MatrixXd> sqrtCovariance,
+                 Eigen::Ref<Eigen::VectorXd> predictedMean,
+                 Eigen::Ref<Eigen::MatrixXd> predictedSqrtCovariance);
+// clang-format on
+
+private:
+    /**
+     * Private implementation
+     */
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+};
+
+} // namespace RobotDynamicsEstimator
+} // namespace Estimators
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_ESTIMATORS_SQRT_UKF_PREDICTION_H
@@ -8,6 +8,7 @@
 #ifndef BIPEDAL_LOCOMOTION_ESTIMATORS_SUB_MODEL_KINDYN_WRAPPER_H
 #define BIPEDAL_LOCOMOTION_ESTIMATORS_SUB_MODEL_KINDYN_WRAPPER_H
 
+#include <cstdint>
 #include <unordered_map>
 
 // iDynTree
@@ -46,28 +47,59 @@ enum class UpdateMode {
 
 /**
  * SubModelKinDynWrapper is a concrete class and implements a wrapper of the KinDynComputation class
- * from iDynTree. The class is used to take updated the sub-model kinematics and dynamics
+ * from iDynTree. The class is used to take updated the sub-model kinematics and dynamics.
+ * The quantities exposed by the accessors (mass matrix, generalized bias forces, jacobians, bias
+ * accelerations, sensor rotations and velocities) are computed lazily: each one is recomputed at
+ * most once per state generation, on the first access after updateFullModelState().
  */
 class SubModelKinDynWrapper
 {
     SubModel m_subModel; /**< SubModel struct containing all the information about the sub-model */
-    iDynTree::KinDynComputations m_kinDyn; /**< kindyncomputation object used to get the sub-model
-                                            kinematic and dynamic information */
-    Eigen::MatrixXd m_massMatrix; /**< Mass matrix of the sub-model */
-    Eigen::VectorXd m_genForces; /**< Generalized force vector */
-    std::unordered_map<std::string, Eigen::MatrixXd> m_jacFTList; /**< Jacobians of the FT sensors */
-    std::unordered_map<std::string, Eigen::MatrixXd> m_jacAccList; /**< Jacobians of the accelerometer
+
+    /** kindyncomputation object used to get the sub-model kinematic and dynamic information. It is
+     * mutable since the quantities exposed by the accessors are computed lazily on first access. */
+    mutable iDynTree::KinDynComputations m_kinDyn;
+
+    mutable Eigen::MatrixXd m_massMatrix; /**< Mass matrix of the sub-model */
+    mutable Eigen::VectorXd m_genForces; /**< Generalized force vector */
+    mutable std::unordered_map<std::string, Eigen::MatrixXd> m_jacFTList; /**< Jacobians of the FT sensors */
+    mutable std::unordered_map<std::string, Eigen::MatrixXd> m_jacAccList; /**< Jacobians of the accelerometer
                                                                   sensors */
-    std::unordered_map<std::string, Eigen::MatrixXd> m_jacGyroList; /**< Jacobians of the gyroscope
+    mutable std::unordered_map<std::string, Eigen::MatrixXd> m_jacGyroList; /**< Jacobians of the gyroscope
                                                                    sensors */
-    std::unordered_map<std::string, Eigen::MatrixXd> m_jacContactList; /**< Jacobians of the external
+    mutable std::unordered_map<std::string, Eigen::MatrixXd> m_jacContactList; /**< Jacobians of the external
                                                                       contacts */
-    std::unordered_map<std::string, Eigen::VectorXd> m_dJnuList; /**< Accelerometer bias accelerations
+    mutable std::unordered_map<std::string, Eigen::VectorXd> m_dJnuList; /**< Accelerometer bias accelerations
                                                               */
-    std::unordered_map<std::string, manif::SO3d> m_accRworldList; /**< Rotation matrix of the
+    mutable std::unordered_map<std::string, manif::SO3d> m_accRworldList; /**< Rotation matrix of the
                                                                  accelerometer frame wrt world */
-    std::unordered_map<std::string, manif::SE3d::Tangent> m_accVelList; /**< Acceleration of the
+    mutable std::unordered_map<std::string, manif::SE3d::Tangent> m_accVelList; /**< Acceleration of the
                                                                  accelerometers */
+
+    /** Generation of the robot state set in the sub-model KinDynComputations object. It is
+     * incremented by updateFullModelState() and invalidates all the cached quantities. */
+    std::uint64_t m_stateGeneration{1};
+
+    mutable std::uint64_t m_massMatrixGeneration{0}; /**< Generation of the cached mass matrix. */
+    mutable std::uint64_t m_genForcesGeneration{0}; /**< Generation of the cached bias forces. */
+    mutable std::unordered_map<std::string, std::uint64_t> m_jacFTGeneration; /**< Generations of
+                                                                 the cached FT jacobians. */
+    mutable std::unordered_map<std::string, std::uint64_t> m_jacAccGeneration; /**< Generations of
+                                                                 the cached accelerometer
+                                                                 jacobians. */
+    mutable std::unordered_map<std::string, std::uint64_t> m_jacGyroGeneration; /**< Generations of
+                                                                 the cached gyroscope jacobians. */
+    mutable std::unordered_map<std::string, std::uint64_t> m_jacContactGeneration; /**< Generations
+                                                                 of the cached contact jacobians. */
+    mutable std::unordered_map<std::string, std::uint64_t> m_dJnuGeneration; /**< Generations of
+                                                                 the cached bias accelerations. */
+    mutable std::unordered_map<std::string, std::uint64_t> m_accRworldGeneration; /**< Generations
+                                                                 of the cached accelerometer
+                                                                 rotations. */
+    mutable std::unordered_map<std::string, std::uint64_t> m_accVelGeneration; /**< Generations of
+                                                                 the cached accelerometer
+                                                                 velocities. */
+
     manif::SE3d::Tangent m_baseVelocity; /**< Velocity of the base of the sub-model */
     std::string m_baseFrame; /**< Name of the base frame of the sub-model */
 
@@ -107,6 +139,21 @@ protected:
      */
     void computeTotalTorqueFromContacts();
 
+    /**
+     * Ensure methods recomputing one cached quantity when its generation stamp is older than the
+     * current state generation. They are const since the caches are mutable, so the accessors can
+     * stay const while computing lazily.
+     */
+    bool ensureMassMatrix() const;
+    bool ensureGeneralizedForces() const;
+    bool ensureFTJacobian(const std::string& ftName) const;
+    bool ensureExtContactJacobian(const std::string& extContactName) const;
+    bool ensureAccelerometerJacobian(const std::string& accName) const;
+    bool ensureGyroscopeJacobian(const std::string& gyroName) const;
+    bool ensureAccelerometerBiasAcceleration(const std::string& accName) const;
+    bool ensureAccelerometerRotation(const std::string& accName) const;
+    bool ensureAccelerometerVelocity(const std::string& accName) const;
+
 public:
     /**
      * @brief set kinDyn
@@ -137,6 +184,55 @@ public:
                      Eigen::Ref<const Eigen::VectorXd> robotJointAcceleration,
                      UpdateMode updateMode);
 
+    /**
+     * @brief updateFullModelState reads the sub-model base pose and velocity and the joint state
+     * from the full-model KinDynComputations object and sets the robot state of the sub-model
+     * KinDynComputations object.
+     * @note this method reads from the shared full-model KinDynComputations object, hence it must
+     * not be called concurrently on wrappers sharing the same full-model object.
+     * @note setting a new robot state increments the state generation, which invalidates all the
+     * cached kinematic and dynamic quantities. Each quantity is recomputed at most once per
+     * generation, on the first access.
+     * @return a boolean value saying if the state has been updated correctly.
+     */
+    bool updateFullModelState();
+
+    /**
+     * @brief updateBaseAcceleration computes the sub-model base acceleration from the full model
+     * given the robot base acceleration and the joint accelerations.
+     * @param robotBaseAcceleration is a manif::SE3d::Tangent representing the robot base acceleration.
+     * @param robotJointAcceleration is a Eigen reference to a Eigen::VectorXd containing the joint accelerations.
+     * @note this method reads from the shared full-model KinDynComputations object, hence it must
+     * not be called concurrently on wrappers sharing the same full-model object.
+     * @return a boolean value saying if the acceleration has been computed correctly.
+     */
+    bool updateBaseAcceleration(const manif::SE3d::Tangent& robotBaseAcceleration,
+                                Eigen::Ref<const Eigen::VectorXd> robotJointAcceleration);
+
+    /**
+     * @brief updateSubModelState refreshes the kinematic and dynamic quantities of the sub-model
+     * (mass matrix, generalized bias forces and jacobians) from the robot state previously set
+     * with updateFullModelState().
+     * @param updateMode says if update only objects for computing the forward dynamics or also information
+     * associated to additional sensors like accelerometers/gyroscopes
+     * @note this method only touches the sub-model KinDynComputations object, hence different
+     * wrappers can be updated concurrently since the sub-models share no mutable state by
+     * construction.
+     * @note calling this method is an optional prefetch: the accessors compute the quantities
+     * lazily on first access per state generation, so callers consuming a subset of the
+     * quantities can skip it and pay only for what they read.
+     * @return a boolean value saying if the state has been updated correctly.
+     */
+    bool updateSubModelState(UpdateMode updateMode);
+
+    /**
+     * @brief stateGeneration access the generation of the robot state set in the sub-model
+     * KinDynComputations object. The generation is incremented every time a new robot state is
+     * set, invalidating the cached quantities exposed by the accessors.
+     * @return the current state generation.
+     */
+    std::uint64_t stateGeneration() const;
+
     /**
      * @brief forwardDynamics computes the free floaing forward dynamics
      * @param motorTorqueAfterGearbox a vector of size number of joints containing the motor torques
@@ -67,6 +67,8 @@ public:
      * |         Parameter Name         |       Type      |                                              Description                                       | Mandatory |
      * |:------------------------------:|:---------------:|:----------------------------------------------------------------------------------------------:|:---------:|
      * |              `dT`              |     `double`    |                                            Sampling time.                                      |    Yes    |
+     * |      `number_of_threads`       |      `int`      |              Number of threads propagating the sigma points. Defaults to 1.                   |    No     |
+     * |   `parallel_submodel_update`   |      `bool`     | Refresh the sub-model dynamics concurrently. Ignored when `number_of_threads` is greater than 1. Defaults to false. |    No     |
      * |         `dynamics_list`        | `vector<string>`|                                          List of dynamics composing the state model.           |    Yes    |
      *  For **each** dynamics listed in the parameter `dynamics_list` the user must specified all the parameters required
      * by the dynamics itself but `dT` since is already specified in the parent group. Moreover the
@@ -138,6 +140,8 @@ public:
      * |         Parameter Name         |       Type      |                                       Description                                              | Mandatory |
      * |:------------------------------:|:---------------:|:----------------------------------------------------------------------------------------------:|:---------:|
      * |              `dT`              |     `double`    |                                      Sampling time.                                            |    Yes    |
+     * |      `number_of_threads`       |      `int`      |            Number of threads propagating the sigma points. Defaults to 1.                      |    No     |
+     * |   `parallel_submodel_update`   |      `bool`     | Refresh the sub-model dynamics concurrently. Ignored when `number_of_threads` is greater than 1. Defaults to false. |    No     |
      * @return True in case of success, false otherwise.
      */
     // clang-format on
@@ -210,6 +214,17 @@ public:
      */
     Eigen::Ref<const Eigen::MatrixXd> getInitialStateCovarianceMatrix();
 
+    /**
+     * @brief getCovarianceBlockSizes access the sizes of the diagonal blocks composing the process
+     * noise covariance matrix. Each dynamics contributes one diagonal block, so the covariance is
+     * structurally block-diagonal; the sizes are listed following the variable ordering of the
+     * state variable handler. The partition can be passed to
+     * `SqrtUkfPrediction::setBlockStructure` to factorize the covariance per block.
+     * @note This method should be called after finalize().
+     * @return the sizes of the diagonal covariance blocks in state order.
+     */
+    const std::vector<Eigen::Index>& getCovarianceBlockSizes() const;
+
 }; // class UKFModel
 
 } // namespace RobotDynamicsEstimator
@@ -50,6 +50,7 @@ bool BaseEstimatorFromFootIMU::setModel(const iDynTree::Model& model)
     constexpr auto logPrefix = "[BaseEstimatorFromFootIMU::setModel]";
 
     m_isModelSet = false;
+    m_isChainCached = false;
 
     m_model = model;
 
@@ -206,6 +207,7 @@ bool BaseEstimatorFromFootIMU::advance()
     // pose matrix.
 
     // for each corner we compute the position in the inertial frame
+    m_transformedFootCorners.clear();
     for (const auto& corner : m_cornersInLocalFrame)
     {
         m_transformedFootCorners.emplace_back(T_foot_raw.act(corner));
@@ -262,22 +264,28 @@ bool BaseEstimatorFromFootIMU::advance()
     // cordinate change is performed from foot sole frame to foot link frame.
     m_measuredFootPose = T_vertexOffset * T_foot_raw * m_frame_H_link;
 
-    Eigen::VectorXd baseVelocity(6);
-    baseVelocity.setZero();
-
-    // setting the robot state in terms of stance foot pose and joint positions.
-    if (!m_kinDyn.setRobotState(m_measuredFootPose.transform(),
-                                m_input.jointPositions,
-                                baseVelocity,
-                                m_input.jointVelocities,
-                                m_gravity))
+    // the foot-to-base kinematic chain depends only on the joint positions: it is recomputed
+    // only when the encoders provide a new measurement. In this way the estimator can run at
+    // IMU rate performing fixed-size operations only on the remaining ticks.
+    if (!m_isChainCached || m_cachedJointPositions.size() != m_input.jointPositions.size()
+        || (m_cachedJointPositions.array() != m_input.jointPositions.array()).any())
     {
-        log()->error("{} Unable to set the robot state.", logPrefix);
-        return false;
+        if (!m_kinDyn.setJointPos(m_input.jointPositions))
+        {
+            log()->error("{} Unable to set the joint positions.", logPrefix);
+            return false;
+        }
+
+        m_link_H_base
+            = Conversions::toManifPose(m_kinDyn.getRelativeTransform(m_linkIndex, m_baseFrame));
+
+        m_cachedJointPositions = m_input.jointPositions;
+        m_isChainCached = true;
     }
 
-    // calculating the pose of the root link given the robot state.
-    m_state.basePose = Conversions::toManifPose(m_kinDyn.getWorldTransform(m_baseFrame));
+    // calculating the pose of the root link by composing the stance foot link pose with the
+    // precomputed foot-to-base chain.
+    m_state.basePose = m_measuredFootPose * m_link_H_base;
 
     m_isOutputValid = true;
 
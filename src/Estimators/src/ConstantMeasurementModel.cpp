@@ -128,6 +128,33 @@ bool RDE::ConstantMeasurementModel::checkStateVariableHandler()
     return true;
 }
 
+bool RDE::ConstantMeasurementModel::updateBatch(Eigen::Ref<const Eigen::MatrixXd> states,
+                                                const std::vector<UKFInput>& /*inputs*/,
+                                                Eigen::Ref<Eigen::MatrixXd> updatedVariables)
+{
+    constexpr auto errorPrefix = "[ConstantMeasurementModel::updateBatch]";
+
+    if (updatedVariables.rows() != m_size || updatedVariables.cols() != states.cols())
+    {
+        log()->error("{} The output matrix must have {} rows and {} columns.",
+                     errorPrefix,
+                     m_size,
+                     states.cols());
+        return false;
+    }
+
+    const auto& variable = m_stateVariableHandler.getVariable(m_name);
+    updatedVariables = states.middleRows(variable.offset, variable.size);
+
+    if (m_useBias)
+    {
+        const auto& bias = m_stateVariableHandler.getVariable(m_biasVariableName);
+        updatedVariables += states.middleRows(bias.offset, bias.size);
+    }
+
+    return true;
+}
+
 bool RDE::ConstantMeasurementModel::update()
 {
     if (m_useBias)
@@ -6,6 +6,7 @@
  */
 
 #include <BipedalLocomotion/RobotDynamicsEstimator/Dynamics.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
 
 namespace RDE = BipedalLocomotion::Estimators::RobotDynamicsEstimator;
 using namespace BipedalLocomotion::System;
@@ -53,6 +54,45 @@ bool RDE::Dynamics::update()
     return true;
 }
 
+bool RDE::Dynamics::updateBatch(Eigen::Ref<const Eigen::MatrixXd> states,
+                                const std::vector<UKFInput>& inputs,
+                                Eigen::Ref<Eigen::MatrixXd> updatedVariables)
+{
+    constexpr auto errorPrefix = "[Dynamics::updateBatch]";
+
+    if (inputs.size() != 1 && static_cast<Eigen::Index>(inputs.size()) != states.cols())
+    {
+        log()->error("{} The number of inputs must be one or equal to the number of sigma points.",
+                     errorPrefix);
+        return false;
+    }
+
+    if (updatedVariables.rows() != m_size || updatedVariables.cols() != states.cols())
+    {
+        log()->error("{} The output matrix must have {} rows and {} columns.",
+                     errorPrefix,
+                     m_size,
+                     states.cols());
+        return false;
+    }
+
+    const bool sharedInput = (inputs.size() == 1);
+    for (Eigen::Index sample = 0; sample < states.cols(); sample++)
+    {
+        this->setState(states.col(sample));
+        this->setInput(sharedInput ? inputs.front() : inputs[sample]);
+
+        if (!this->update())
+        {
+            return false;
+        }
+
+        updatedVariables.col(sample) = m_updatedVariable;
+    }
+
+    return true;
+}
+
 Eigen::Ref<const Eigen::VectorXd> RDE::Dynamics::getUpdatedVariable() const
 {
     return m_updatedVariable;
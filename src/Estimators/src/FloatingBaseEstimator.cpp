@@ -9,7 +9,9 @@
 #include <BipedalLocomotion/FloatingBaseEstimators/FloatingBaseEstimator.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
+#include <algorithm>
 #include <chrono>
+#include <new>
 
 #include <iDynTree/Model/Model.h>
 
@@ -121,6 +123,8 @@ bool FloatingBaseEstimator::advance()
         return false;
     }
 
+    refreshBoundMeasurements();
+
     bool ok{true};
     if (m_estimatorState == State::Initialized)
     {
@@ -128,39 +132,113 @@ bool FloatingBaseEstimator::advance()
         m_measPrev = m_meas;
     }
 
-    if (m_useModelInfo && m_options.kinematicsUpdateEnabled)
+    ok = estimateStep(m_meas, m_measPrev);
+
+    m_statePrev = m_state;
+    m_measPrev = m_meas;
+
+    m_estimatorOut.state = m_state;
+    m_estimatorOut.stateStdDev = m_stateStdDev;
+
+    if (ok && m_options.delayedMeasurementFusionEnabled)
+    {
+        m_estimationTime
+            += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(m_dt));
+        pushSnapshot();
+    }
+
+    // clear the map of landmark and contact measurements
+    if (m_useModelInfo)
+    {
+        m_meas.stampedContactsStatus.clear();
+    }
+
+    if (m_options.staticLandmarksUpdateEnabled)
+    {
+        m_meas.stampedRelLandmarkPoses.clear();
+    }
+    return ok;
+}
+
+bool FloatingBaseEstimator::estimateStep(FloatingBaseEstimators::Measurements& meas,
+                                         const FloatingBaseEstimators::Measurements& measPrev)
+{
+    bool ok = setKinDynRobotState(meas);
+    ok = ok && predictState(measPrev, m_dt);
+    ok = ok && applyMeasurementUpdates(meas, m_dt);
+    ok = ok
+         && updateBaseStateFromIMUState(m_state,
+                                        measPrev,
+                                        m_estimatorOut.basePose,
+                                        m_estimatorOut.baseTwist);
+
+    return ok;
+}
+
+bool FloatingBaseEstimator::setKinDynRobotState(const FloatingBaseEstimators::Measurements& meas)
+{
+    if (!m_useModelInfo || !m_options.kinematicsUpdateEnabled)
+    {
+        return true;
+    }
+
+    // update robot state with previous state estimates
+    if ((meas.encoders.size() == m_modelComp.nrJoints())
+        || (meas.encodersSpeed.size() == m_modelComp.nrJoints()))
     {
-        // update robot state with previous state estimates
-        if ((m_meas.encoders.size() == m_modelComp.nrJoints())
-            || (m_meas.encodersSpeed.size() == m_modelComp.nrJoints()))
+        if (!m_modelComp.kinDyn()->setRobotState(m_estimatorOut.basePose.transform(),
+                                                 meas.encoders,
+                                                 m_estimatorOut.baseTwist,
+                                                 meas.encodersSpeed,
+                                                 m_options.accelerationDueToGravity))
         {
-            if (!m_modelComp.kinDyn()->setRobotState(m_estimatorOut.basePose.transform(),
-                                                     m_meas.encoders,
-                                                     m_estimatorOut.baseTwist,
-                                                     m_meas.encodersSpeed,
-                                                     m_options.accelerationDueToGravity))
-            {
-                log()->error("[FloatingBaseEstimator::advance] "
-                             "Failed to set kindyncomputations robot state.");
-                return false;
-            }
+            log()->error("[FloatingBaseEstimator::setKinDynRobotState] "
+                         "Failed to set kindyncomputations robot state.");
+            return false;
         }
     }
 
-    ok = ok && predictState(m_measPrev, m_dt);
+    return true;
+}
+
+bool FloatingBaseEstimator::applyMeasurementUpdates(FloatingBaseEstimators::Measurements& meas,
+                                                    const double& dt)
+{
+    bool ok{true};
     if (m_options.ekfUpdateEnabled)
     {
         if (m_useModelInfo && m_options.kinematicsUpdateEnabled)
         {
-            ok = ok && updateKinematics(m_meas, m_dt);
+            ok = ok && updateKinematics(meas, dt);
         }
 
         if (m_options.staticLandmarksUpdateEnabled)
         {
-            ok = ok && updateLandmarkRelativePoses(m_meas, m_dt);
+            ok = ok && updateLandmarkRelativePoses(meas, dt);
         }
     }
 
+    return ok;
+}
+
+bool FloatingBaseEstimator::predict()
+{
+    if (m_estimatorState != State::Initialized && m_estimatorState != State::Running)
+    {
+        log()->error("[FloatingBaseEstimator::predict] "
+                     "Please initialize the estimator before calling predict().");
+        return false;
+    }
+
+    refreshBoundMeasurements();
+
+    if (m_estimatorState == State::Initialized)
+    {
+        m_estimatorState = State::Running;
+        m_measPrev = m_meas;
+    }
+
+    bool ok = predictState(m_measPrev, m_dt);
     ok = ok
          && updateBaseStateFromIMUState(m_state,
                                         m_measPrev,
@@ -173,6 +251,40 @@ bool FloatingBaseEstimator::advance()
     m_estimatorOut.state = m_state;
     m_estimatorOut.stateStdDev = m_stateStdDev;
 
+    m_predictsSinceCorrection++;
+    return ok;
+}
+
+bool FloatingBaseEstimator::correct()
+{
+    if (m_estimatorState != State::Running)
+    {
+        log()->error("[FloatingBaseEstimator::correct] "
+                     "Please call predict() at least once before calling correct().");
+        return false;
+    }
+
+    refreshBoundMeasurements();
+
+    // the measurement update period is the time elapsed since the previous correction,
+    // i.e., the number of prediction steps run in between times the sampling period
+    const double dt = m_dt * static_cast<double>(std::max<std::size_t>(m_predictsSinceCorrection, 1));
+
+    bool ok = setKinDynRobotState(m_meas);
+    ok = ok && applyMeasurementUpdates(m_meas, dt);
+    ok = ok
+         && updateBaseStateFromIMUState(m_state,
+                                        m_meas,
+                                        m_estimatorOut.basePose,
+                                        m_estimatorOut.baseTwist);
+
+    m_statePrev = m_state;
+
+    m_estimatorOut.state = m_state;
+    m_estimatorOut.stateStdDev = m_stateStdDev;
+
+    m_predictsSinceCorrection = 0;
+
     // clear the map of landmark and contact measurements
     if (m_useModelInfo)
     {
@@ -186,6 +298,130 @@ bool FloatingBaseEstimator::advance()
     return ok;
 }
 
+void FloatingBaseEstimator::pushSnapshot()
+{
+    Snapshot& entry = m_history[m_historyHead];
+    entry.time = m_estimationTime;
+    entry.state = m_state;
+    entry.stateStdDev = m_stateStdDev;
+    // m_measPrev holds the measurements consumed at this step,
+    // including the stamped maps cleared from m_meas at the end of advance()
+    entry.meas = m_measPrev;
+    cacheInternalCovariance(entry.covariance);
+
+    m_historyHead = (m_historyHead + 1) % m_history.size();
+    if (m_historyCount < m_history.size())
+    {
+        m_historyCount++;
+    }
+}
+
+bool FloatingBaseEstimator::setDelayedMeasurement(const int& landmarkID,
+                                                  const Eigen::Quaterniond& quat,
+                                                  const Eigen::Vector3d& pos,
+                                                  const std::chrono::nanoseconds& timeStamp)
+{
+    if (!m_options.delayedMeasurementFusionEnabled)
+    {
+        log()->error("[FloatingBaseEstimator::setDelayedMeasurement] "
+                     "Please enable the \" enable_delayed_measurement_fusion \" option "
+                     "before calling setDelayedMeasurement().");
+        return false;
+    }
+
+    if (m_estimatorState != State::Running || m_historyCount == 0)
+    {
+        log()->error("[FloatingBaseEstimator::setDelayedMeasurement] "
+                     "The estimator must have been advanced at least once "
+                     "before calling setDelayedMeasurement().");
+        return false;
+    }
+
+    // find the most recent snapshot not newer than the measurement time stamp
+    const std::size_t size = m_history.size();
+    std::ptrdiff_t offsetFromOldest{-1};
+    for (std::size_t i = 0; i < m_historyCount; i++)
+    {
+        const std::size_t idx = (m_historyHead + size - 1 - i) % size;
+        if (m_history[idx].time <= timeStamp)
+        {
+            offsetFromOldest = static_cast<std::ptrdiff_t>(m_historyCount - 1 - i);
+            break;
+        }
+    }
+
+    if (offsetFromOldest < 0)
+    {
+        log()->error("[FloatingBaseEstimator::setDelayedMeasurement] "
+                     "The measurement time stamp is older than the buffered history. "
+                     "Consider increasing \" measurement_history_depth \".");
+        return false;
+    }
+
+    const std::size_t oldest = (m_historyHead + size - m_historyCount) % size;
+
+    // rewind the estimator to the anchor snapshot
+    Snapshot& anchor = m_history[(oldest + offsetFromOldest) % size];
+    m_state = anchor.state;
+    m_statePrev = anchor.state;
+    m_stateStdDev = anchor.stateStdDev;
+    if (!restoreInternalCovariance(anchor.covariance))
+    {
+        log()->error("[FloatingBaseEstimator::setDelayedMeasurement] "
+                     "Could not restore the internal covariance of the filter.");
+        return false;
+    }
+
+    // fuse the delayed measurement at the rewound time instant
+    m_delayedMeas = anchor.meas;
+    m_delayedMeas.stampedRelLandmarkPoses.clear();
+    m_delayedMeas.stampedRelLandmarkPoses[landmarkID].lastUpdateTime = timeStamp;
+    m_delayedMeas.stampedRelLandmarkPoses[landmarkID].pose = manif::SE3d(pos, quat);
+    if (!updateLandmarkRelativePoses(m_delayedMeas, m_dt))
+    {
+        log()->error("[FloatingBaseEstimator::setDelayedMeasurement] "
+                     "Could not fuse the delayed measurement.");
+        return false;
+    }
+
+    anchor.state = m_state;
+    anchor.stateStdDev = m_stateStdDev;
+    cacheInternalCovariance(anchor.covariance);
+
+    // fast-forward to the current time instant replaying the cached inputs
+    for (std::size_t i = static_cast<std::size_t>(offsetFromOldest) + 1; i < m_historyCount; i++)
+    {
+        Snapshot& entry = m_history[(oldest + i) % size];
+        const Snapshot& prevEntry = m_history[(oldest + i - 1) % size];
+
+        // the update steps may consume the stamped maps, so use a scratch copy
+        // and keep the cached measurements intact for future replays
+        m_delayedMeas = entry.meas;
+        if (!estimateStep(m_delayedMeas, prevEntry.meas))
+        {
+            log()->error("[FloatingBaseEstimator::setDelayedMeasurement] "
+                         "Could not replay the estimation step at t = {} ns.",
+                         entry.time.count());
+            return false;
+        }
+        m_statePrev = m_state;
+
+        entry.state = m_state;
+        entry.stateStdDev = m_stateStdDev;
+        cacheInternalCovariance(entry.covariance);
+    }
+
+    m_estimatorOut.state = m_state;
+    m_estimatorOut.stateStdDev = m_stateStdDev;
+
+    return true;
+}
+
+const std::chrono::nanoseconds& FloatingBaseEstimator::getEstimationTime() const
+{
+    return m_estimationTime;
+}
+
 bool FloatingBaseEstimator::ModelComputations::setKinDynObject(
     std::shared_ptr<iDynTree::KinDynComputations> kinDyn)
 {
@@ -373,6 +609,81 @@ bool FloatingBaseEstimator::setKinematics(const Eigen::VectorXd& encoders,
     return true;
 }
 
+bool FloatingBaseEstimator::bindIMUMeasurement(const double* accMeas, const double* gyroMeas)
+{
+    if (accMeas == nullptr || gyroMeas == nullptr)
+    {
+        log()->warn("[FloatingBaseEstimator::bindIMUMeasurement] "
+                    "Invalid measurement buffer, skipping the binding.");
+        return false;
+    }
+
+    // Eigen maps are rebound through placement new, as documented by Eigen
+    new (&m_measBindings.acc) Eigen::Map<const Eigen::Vector3d>(accMeas);
+    new (&m_measBindings.gyro) Eigen::Map<const Eigen::Vector3d>(gyroMeas);
+    m_measBindings.imuBound = true;
+
+    return true;
+}
+
+bool FloatingBaseEstimator::bindKinematics(const double* encoders,
+                                           const double* encoderSpeeds,
+                                           const std::size_t nrJoints)
+{
+    if (encoders == nullptr || encoderSpeeds == nullptr)
+    {
+        log()->warn("[FloatingBaseEstimator::bindKinematics] "
+                    "Invalid measurement buffer, skipping the binding.");
+        return false;
+    }
+
+    if (nrJoints != modelComputations().nrJoints())
+    {
+        log()->warn("[FloatingBaseEstimator::bindKinematics] "
+                    "kinematic measurements size mismatch.");
+        return false;
+    }
+
+    new (&m_measBindings.encoders) Eigen::Map<const Eigen::VectorXd>(encoders, nrJoints);
+    new (&m_measBindings.encodersSpeed) Eigen::Map<const Eigen::VectorXd>(encoderSpeeds, nrJoints);
+    m_measBindings.kinematicsBound = true;
+
+    return true;
+}
+
+void FloatingBaseEstimator::signalMeasurementsUpdated()
+{
+    m_measBindings.generation++;
+}
+
+void FloatingBaseEstimator::unbindMeasurements()
+{
+    m_measBindings.imuBound = false;
+    m_measBindings.kinematicsBound = false;
+}
+
+void FloatingBaseEstimator::refreshBoundMeasurements()
+{
+    if (m_measBindings.generation == m_measBindings.consumedGeneration)
+    {
+        return;
+    }
+
+    if (m_measBindings.imuBound)
+    {
+        m_meas.acc = m_measBindings.acc;
+        m_meas.gyro = m_measBindings.gyro;
+    }
+
+    if (m_measBindings.kinematicsBound)
+    {
+        m_meas.encoders = m_measBindings.encoders;
+        m_meas.encodersSpeed = m_measBindings.encodersSpeed;
+    }
+
+    m_measBindings.consumedGeneration = m_measBindings.generation;
+}
+
 bool FloatingBaseEstimator::setContacts(const bool& lfInContact, const bool& rfInContact)
 {
     m_meas.lfInContact = lfInContact;
@@ -568,6 +879,58 @@ bool FloatingBaseEstimator::setupOptions(
         }
     }
 
+    if (!handle->getParameter("use_square_root_covariance", m_options.useSquareRootCovariance))
+    {
+        m_options.useSquareRootCovariance = false;
+    }
+
+    if (!handle->getParameter("linearization_update_period", m_options.linearizationUpdatePeriod))
+    {
+        m_options.linearizationUpdatePeriod = 1;
+    }
+
+    if (m_options.linearizationUpdatePeriod < 1)
+    {
+        log()->error("[FloatingBaseEstimator::setupOptions] "
+                     "The parameter \" linearization_update_period \" "
+                     "must be a positive integer.");
+        return false;
+    }
+
+    if (!handle->getParameter("relinearization_threshold", m_options.relinearizationThreshold))
+    {
+        m_options.relinearizationThreshold = 0.0;
+    }
+
+    if (!handle->getParameter("enable_delayed_measurement_fusion",
+                              m_options.delayedMeasurementFusionEnabled))
+    {
+        m_options.delayedMeasurementFusionEnabled = false;
+    }
+
+    if (m_options.delayedMeasurementFusionEnabled)
+    {
+        if (!handle->getParameter("measurement_history_depth",
+                                  m_options.measurementHistoryDepth))
+        {
+            m_options.measurementHistoryDepth = 64;
+        }
+
+        if (m_options.measurementHistoryDepth < 1)
+        {
+            log()->error("[FloatingBaseEstimator::setupOptions] "
+                         "The parameter \" measurement_history_depth \" "
+                         "must be a positive integer.");
+            return false;
+        }
+
+        // preallocate the fixed-lag history ring buffer
+        m_history.assign(static_cast<std::size_t>(m_options.measurementHistoryDepth), Snapshot());
+        m_historyHead = 0;
+        m_historyCount = 0;
+        m_estimationTime = std::chrono::nanoseconds::zero();
+    }
+
     // This parameter is optional
     handle->getParameter("acceleration_due_to_gravity", //
                          m_options.accelerationDueToGravity);
@@ -5,6 +5,8 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <cmath>
+
 #include <BipedalLocomotion/FloatingBaseEstimators/InvariantEKFBaseEstimator.h>
 #include <iDynTree/Core/EigenHelpers.h>
 
@@ -27,12 +29,45 @@ public:
         Eigen::Matrix3d plCross; /**< skew of position of left foot contact frame origin */
     };
 
+    static constexpr int m_vecSizeWOBias{15}; /**< Tangent space vector size without considering IMU biases */
+    static constexpr int m_vecSizeWBias{21};  /**< Tangent space vector size considering IMU biases */
+    static constexpr int m_stateMatrixDim{7}; /**< Dimension of the \f[SE_2+2(3)\f] state matrix */
+    static constexpr int m_maxObsDim{14};     /**< Observation vector size with both feet in contact */
+    static constexpr int m_maxMeasDim{6};     /**< Linearized measurement size with both feet in contact */
+
+    /**
+     * Fixed-capacity matrix types sized at compile time on the largest dimensions handled by the
+     * filter. The actual size is still chosen at run time depending on the bias estimation flag
+     * and on the contact configuration, but the storage lives on the stack, no heap allocation is
+     * ever performed and Eigen can unroll the products on the compile-time bounds
+     */
+    using TangentMatrix = Eigen::
+        Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor, m_vecSizeWBias, m_vecSizeWBias>;
+    using TangentVector
+        = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, m_vecSizeWBias, 1>;
+    using StateMatrix = Eigen::Matrix<double, m_stateMatrixDim, m_stateMatrixDim>;
+    using TangentVectorWOBias = Eigen::Matrix<double, m_vecSizeWOBias, 1>;
+    using AdjointMatrix = Eigen::Matrix<double, m_vecSizeWOBias, m_vecSizeWOBias>;
+    using ObsVector = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, m_maxObsDim, 1>;
+    using BigStateMatrix
+        = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor, m_maxObsDim, m_maxObsDim>;
+    using MeasJacobian = Eigen::
+        Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor, m_maxMeasDim, m_vecSizeWBias>;
+    using MeasNoiseMatrix = Eigen::
+        Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor, m_maxMeasDim, m_maxMeasDim>;
+    using AuxMatrix = Eigen::
+        Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor, m_maxMeasDim, m_maxObsDim>;
+    using GainMatrix = Eigen::
+        Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor, m_vecSizeWBias, m_maxMeasDim>;
+    using QRStackMatrix = Eigen::
+        Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor, 2 * m_vecSizeWBias, m_vecSizeWBias>;
+
     /**
      * Construct internal state object given,
      *  - state matrix \f[ X \in SE_2+2(3) \f] and
      *  - parameters vector \f[ \theta \in \mathbb{R}^6 \f]
      */
-    bool constructState(const Eigen::MatrixXd& X,
+    bool constructState(const StateMatrix& X,
                         const Eigen::Matrix<double, 6, 1>& theta,
                         FloatingBaseEstimators::InternalState& state);
 
@@ -43,7 +78,7 @@ public:
      * from internal state object
      */
     void extractState(const FloatingBaseEstimators::InternalState& state,
-                      Eigen::MatrixXd& X,
+                      StateMatrix& X,
                       Eigen::Matrix<double, 6, 1>& theta);
 
     /**
@@ -52,16 +87,25 @@ public:
      */
     void constuctStateVar(const FloatingBaseEstimators::StateStdDev& stateStdDev,
                           const bool& estimateBias,
-                          Eigen::MatrixXd& P);
+                          TangentMatrix& P);
 
     /**
      * Extract internal state standard deviation object,
      * from the diagonal elements of the state covariance matrix
      */
-    void extractStateVar(const Eigen::MatrixXd& P,
+    void extractStateVar(const TangentMatrix& P,
                          const bool& estimateBias,
                          FloatingBaseEstimators::StateStdDev& stateStdDev);
 
+    /**
+     * Extract internal state standard deviation object directly from the
+     * Cholesky factor of the state covariance matrix (square-root mode).
+     * The standard deviation of the i-th state is the norm of the i-th row of the factor
+     */
+    void extractStateVarFromSqrt(const TangentMatrix& sqrtP,
+                                 const bool& estimateBias,
+                                 FloatingBaseEstimators::StateStdDev& stateStdDev);
+
     /**
      * Propagate internal state of the estimator,
      * given previous IMU measurements and predicted foot poses relative to IMU
@@ -75,12 +119,39 @@ public:
     /**
      * Perform the Kalman filter update step given measurements and Jacobians
      */
-    bool updateStates(const Eigen::VectorXd& obs,
-                      const Eigen::MatrixXd measModelJacobian,
-                      const Eigen::MatrixXd& measNoiseVar,
-                      const Eigen::MatrixXd& auxMat,
+    bool updateStates(const ObsVector& obs,
+                      const MeasJacobian& measModelJacobian,
+                      const MeasNoiseMatrix& measNoiseVar,
+                      const AuxMatrix& auxMat,
                       FloatingBaseEstimators::InternalState& state,
-                      Eigen::MatrixXd& P);
+                      TangentMatrix& P);
+
+    /**
+     * Perform the Kalman filter update step propagating the Cholesky factor
+     * of the state covariance instead of the full matrix (square-root mode)
+     */
+    bool updateStatesSquareRoot(const ObsVector& obs,
+                                const MeasJacobian& measModelJacobian,
+                                const MeasNoiseMatrix& measNoiseVar,
+                                const AuxMatrix& auxMat,
+                                FloatingBaseEstimators::InternalState& state,
+                                TangentMatrix& sqrtP);
+
+    /**
+     * Apply the invariant error correction to the state given the
+     * already computed Kalman gain m_K.
+     * This step is shared by the full covariance and the square-root update
+     */
+    bool correctState(const ObsVector& obs,
+                      const AuxMatrix& auxMat,
+                      FloatingBaseEstimators::InternalState& state);
+
+    /**
+     * Triangularize the stacked matrix through a QR decomposition and
+     * store its transposed triangular factor, i.e. given the stack A
+     * compute the lower triangular S such that S S.T = A.T A
+     */
+    void triangularize(const QRStackMatrix& stack, TangentMatrix& S);
 
     /**
      * Compute exponential map of \f[SE_2+2(3)\f]
@@ -95,8 +166,8 @@ public:
      * vl - linear velocity of left foot contact freame
      * We choose this order to be consistent with original paper implementation
      */
-    bool calcExpHatX(const Eigen::VectorXd& vec,
-                     Eigen::MatrixXd& X);
+    bool calcExpHatX(const TangentVectorWOBias& vec,
+                     StateMatrix& X);
 
     /**
      * Compute Adjoint matrix of \f[SE_2+2(3)\f]
@@ -111,15 +182,15 @@ public:
      */
     void calcAdjointX(const FloatingBaseEstimators::InternalState& X,
                       const SkewSymContainter& skew,
-                      Eigen::MatrixXd& AdjX);
+                      AdjointMatrix& AdjX);
 
     /**
      * Copy the state matrix X along block diagonal.
      * This is used for multiplying the stacked observations
      */
-    bool copyDiagX(const Eigen::MatrixXd& X,
+    bool copyDiagX(const StateMatrix& X,
                    const int& n,
-                   Eigen::MatrixXd& BigX);
+                   BigStateMatrix& BigX);
 
     /**
      * Compute continuous time system noise covariance matrix
@@ -129,7 +200,19 @@ public:
                 const FloatingBaseEstimators::SensorsStdDev& sensStdDev,
                 const FloatingBaseEstimators::Measurements& meas,
                 const bool& estimateBias,
-                Eigen::MatrixXd& Qc);
+                TangentMatrix& Qc);
+
+    /**
+     * Compute a square root of the continuous time system noise covariance
+     * using the predicted internal state estimates, i.e. a matrix B such that
+     * B B.T = Qc. The blocks are assembled directly from the sensor standard
+     * deviations, so no matrix square root is computed (square-root mode)
+     */
+    void calcQcSqrt(const FloatingBaseEstimators::InternalState& X,
+                    const FloatingBaseEstimators::SensorsStdDev& sensStdDev,
+                    const FloatingBaseEstimators::Measurements& meas,
+                    const bool& estimateBias,
+                    TangentMatrix& QcSqrt);
 
     /**
      * Compute transformation matrix  for the
@@ -138,7 +221,7 @@ public:
     void calcLc(const FloatingBaseEstimators::InternalState& X,
                 const SkewSymContainter& skew,
                 const bool& estimateBias,
-                Eigen::MatrixXd& Lc);
+                TangentMatrix& Lc);
 
     /**
      * Compute continuous time linearized state propagation matrix
@@ -146,7 +229,7 @@ public:
     void calcFc(const FloatingBaseEstimators::InternalState& X,
                 const SkewSymContainter& skew,
                 const bool& estimateBias,
-                Eigen::MatrixXd& Fc);
+                TangentMatrix& Fc);
 
     /**
      * Compute skew symmetric matrices given states
@@ -159,26 +242,45 @@ public:
      */
     void updateFilterMatrixDimensions(const bool& estimateBias);
 
+    /**
+     * Check whether the cached linearization can be reused for the current
+     * predict step or a fresh one must be computed. The cache is refreshed
+     * every linearizationUpdatePeriod steps, when the contact configuration
+     * or the sampling period changes, or when the state drifted away from
+     * the linearization point beyond relinearizationThreshold
+     */
+    bool shouldRelinearize(const FloatingBaseEstimators::InternalState& state,
+                           const FloatingBaseEstimators::Measurements& meas,
+                           const double& dt,
+                           const int& linearizationUpdatePeriod,
+                           const double& relinearizationThreshold);
+
     SkewSymContainter m_skew; /**< skew symmetric matrix container */
 
-    Eigen::MatrixXd m_P;      /**< state covariance matrix */
-    Eigen::MatrixXd m_Fc, m_Qc, m_Lc; /**< continuous time system propagation matrices */
-    Eigen::MatrixXd m_Fk, m_Qk; /**< discrete time system propagation matrices */
-    Eigen::MatrixXd m_In;  /** identity matrix with dimensions of state manifold tangent space */
-    Eigen::MatrixXd m_PHT, m_S, m_K, m_IminusKH; /** measurement update matrices **/
-    Eigen::VectorXd m_obs; /**< observation vector */
-    Eigen::MatrixXd m_measModelJacobian, m_measNoiseVar, m_auxMat; /**< measurement model matrices */
-    Eigen::MatrixXd m_BigX, m_innovation; /**< invariant error update related matrices */
-    Eigen::VectorXd m_delta; /**< correction term*/
-    Eigen::MatrixXd m_X, m_dX; /**< placeholder for state update variables */
+    TangentMatrix m_P;      /**< state covariance matrix */
+    TangentMatrix m_sqrtP;  /**< lower triangular Cholesky factor of the state covariance (square-root mode) */
+    TangentMatrix m_QcSqrt; /**< square root of the continuous time system noise covariance (square-root mode) */
+    QRStackMatrix m_qrStack; /**< stacked matrix triangularized during the square-root propagation */
+    MeasNoiseMatrix m_sqrtR;  /**< Cholesky factor of the measurement noise covariance (square-root mode) */
+    TangentMatrix m_Fc, m_Qc, m_Lc; /**< continuous time system propagation matrices */
+    TangentMatrix m_Fk, m_Qk; /**< discrete time system propagation matrices */
+    TangentMatrix m_In;  /** identity matrix with dimensions of state manifold tangent space */
+    GainMatrix m_PHT, m_K; /** measurement update matrices **/
+    MeasNoiseMatrix m_S; /**< innovation covariance matrix */
+    TangentMatrix m_IminusKH; /**< Joseph form update matrix */
+    ObsVector m_obs; /**< observation vector */
+    MeasJacobian m_measModelJacobian; /**< measurement model Jacobian */
+    MeasNoiseMatrix m_measNoiseVar; /**< measurement noise covariance */
+    AuxMatrix m_auxMat; /**< auxiliary gain matrix */
+    BigStateMatrix m_BigX; /**< invariant error update related matrix */
+    ObsVector m_innovation; /**< innovation vector */
+    TangentVector m_delta; /**< correction term*/
+    StateMatrix m_X, m_dX; /**< placeholder for state update variables */
     Eigen::Matrix<double, 6, 1> m_theta, m_deltaTheta; /**< placeholder for parameter update variables */
 
     manif::SE3d IMU_H_LF, IMU_H_RF; /**< buffers for relative transforms */
     Eigen::MatrixXd J_IMULF, J_IMURF; /**< buffers for relative Jacobians */
 
-    const size_t m_vecSizeWOBias{15}; /**< Tangent space vector size without considering IMU biases */
-    const size_t m_vecSizeWBias{21};  /**< Tangent space vector size considering IMU biases */
-
     struct {
     const size_t imuOrientation{0};
     const size_t imuLinearVel{3};
@@ -191,6 +293,13 @@ public:
 
     bool m_prevBiasEstimationFlag{false};
 
+    TangentMatrix m_FkLcQcSqrt; /**< cached discrete time noise square root (square-root mode) */
+    FloatingBaseEstimators::InternalState m_linearizationState; /**< state at which the cached Jacobians were computed */
+    bool m_hasCachedLinearization{false}; /**< true if the cached Jacobians are usable */
+    bool m_cachedLfInContact{false}, m_cachedRfInContact{false}; /**< contact configuration at the last linearization */
+    double m_cachedDt{-1.0}; /**< sampling period at the last linearization */
+    int m_stepsSinceLinearization{0}; /**< number of predict steps since the last linearization */
+
     friend class InvariantEKFBaseEstimator;
 };
 
@@ -293,6 +402,10 @@ bool InvariantEKFBaseEstimator::customInitialization(std::weak_ptr<BipedalLocomo
     m_pimpl->updateFilterMatrixDimensions(m_options.imuBiasEstimationEnabled);
     m_pimpl->m_prevBiasEstimationFlag = m_options.imuBiasEstimationEnabled;
     m_pimpl->constuctStateVar(m_priors, m_options.imuBiasEstimationEnabled, m_pimpl->m_P); // construct priors
+    if (m_options.useSquareRootCovariance)
+    {
+        m_pimpl->m_sqrtP = m_pimpl->m_P.llt().matrixL(); // priors are diagonal, the factorization is exact
+    }
 
     size_t baseDim{6};
     m_pimpl->J_IMULF.resize(baseDim, m_modelComp.nrJoints());
@@ -308,6 +421,10 @@ bool InvariantEKFBaseEstimator::resetEstimator(const FloatingBaseEstimators::Int
     m_priors = newPriorDev;
 
     m_pimpl->constuctStateVar(m_priors, m_options.imuBiasEstimationEnabled, m_pimpl->m_P); // construct priors
+    if (m_options.useSquareRootCovariance)
+    {
+        m_pimpl->m_sqrtP = m_pimpl->m_P.llt().matrixL(); // priors are diagonal, the factorization is exact
+    }
     return true;
 }
 
@@ -324,19 +441,55 @@ void BipedalLocomotion::Estimators::InvariantEKFBaseEstimator::Impl::updateFilte
 {
     if (estimateBias)
     {
-        m_In = Eigen::MatrixXd::Identity(m_vecSizeWBias, m_vecSizeWBias);
+        m_In = TangentMatrix::Identity(m_vecSizeWBias, m_vecSizeWBias);
     }
     else
     {
-        m_In = Eigen::MatrixXd::Identity(m_vecSizeWOBias, m_vecSizeWOBias);
+        m_In = TangentMatrix::Identity(m_vecSizeWOBias, m_vecSizeWOBias);
     }
 }
 
+bool InvariantEKFBaseEstimator::Impl::shouldRelinearize(const FloatingBaseEstimators::InternalState& state,
+                                                        const FloatingBaseEstimators::Measurements& meas,
+                                                        const double& dt,
+                                                        const int& linearizationUpdatePeriod,
+                                                        const double& relinearizationThreshold)
+{
+    if (!m_hasCachedLinearization)
+    {
+        return true;
+    }
+
+    // the system noise covariance depends on the feet contact states
+    // and the discretization on the sampling period
+    if (meas.lfInContact != m_cachedLfInContact || meas.rfInContact != m_cachedRfInContact
+        || dt != m_cachedDt)
+    {
+        return true;
+    }
+
+    if (m_stepsSinceLinearization + 1 >= linearizationUpdatePeriod)
+    {
+        return true;
+    }
+
+    if (relinearizationThreshold > 0.0)
+    {
+        double stateDelta = (state.imuPosition - m_linearizationState.imuPosition).norm()
+                            + (state.imuLinearVelocity - m_linearizationState.imuLinearVelocity).norm()
+                            + state.imuOrientation.angularDistance(m_linearizationState.imuOrientation);
+        if (stateDelta > relinearizationThreshold)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool InvariantEKFBaseEstimator::predictState(const FloatingBaseEstimators::Measurements& meas,
                                              const double& dt)
 {
-    m_pimpl->calcSkewSymAtCurrenState(m_statePrev, m_pimpl->m_skew); // compute skews at priori state
-
     // update foot position predictions with previous measures
     if (!m_modelComp.getIMU_H_feet(meas.encoders, m_pimpl->IMU_H_LF, m_pimpl->IMU_H_RF))
     {
@@ -352,19 +505,64 @@ bool InvariantEKFBaseEstimator::predictState(const FloatingBaseEstimators::Measu
     if (m_pimpl->m_prevBiasEstimationFlag != m_options.imuBiasEstimationEnabled)
     {
         m_pimpl->updateFilterMatrixDimensions(m_options.imuBiasEstimationEnabled);
+        m_pimpl->m_hasCachedLinearization = false; // the filter matrix dimensions changed
     }
 
     m_pimpl->m_prevBiasEstimationFlag = m_options.imuBiasEstimationEnabled;
 
-    m_pimpl->calcFc(m_statePrev, m_pimpl->m_skew, m_options.imuBiasEstimationEnabled, m_pimpl->m_Fc); // compute Fc at priori state
-    m_pimpl->calcQc(m_statePrev, m_sensorsDev, meas,  m_options.imuBiasEstimationEnabled, m_pimpl->m_Qc); // compute Qc at priori state and previous measure
-    m_pimpl->calcLc(m_statePrev, m_pimpl->m_skew, m_options.imuBiasEstimationEnabled, m_pimpl->m_Lc); // compute Lc at priori state
+    if (m_pimpl->shouldRelinearize(m_statePrev, meas, dt,
+                                   m_options.linearizationUpdatePeriod,
+                                   m_options.relinearizationThreshold))
+    {
+        m_pimpl->calcSkewSymAtCurrenState(m_statePrev, m_pimpl->m_skew); // compute skews at priori state
+        m_pimpl->calcFc(m_statePrev, m_pimpl->m_skew, m_options.imuBiasEstimationEnabled, m_pimpl->m_Fc); // compute Fc at priori state
+        m_pimpl->calcLc(m_statePrev, m_pimpl->m_skew, m_options.imuBiasEstimationEnabled, m_pimpl->m_Lc); // compute Lc at priori state
+
+        // discretize linearized dynamics
+        m_pimpl->m_Fk = m_pimpl->m_In + (m_pimpl->m_Fc*dt);  // read as Fk = I + (Fc*dt)
+
+        if (m_options.useSquareRootCovariance)
+        {
+            m_pimpl->calcQcSqrt(m_statePrev, m_sensorsDev, meas, m_options.imuBiasEstimationEnabled, m_pimpl->m_QcSqrt); // compute sqrt(Qc) at priori state and previous measure
+            m_pimpl->m_FkLcQcSqrt = std::sqrt(dt)*(m_pimpl->m_Fk*m_pimpl->m_Lc*m_pimpl->m_QcSqrt); // discrete time noise square root
+        }
+        else
+        {
+            m_pimpl->calcQc(m_statePrev, m_sensorsDev, meas,  m_options.imuBiasEstimationEnabled, m_pimpl->m_Qc); // compute Qc at priori state and previous measure
+            m_pimpl->m_Qk = (m_pimpl->m_Fk*m_pimpl->m_Lc*m_pimpl->m_Qc*(m_pimpl->m_Lc.transpose())*(m_pimpl->m_Fk.transpose()))*dt; // read as Qk = Fk Lc Qc Lc.T Fk.T
+        }
+
+        // cache the linearization point
+        m_pimpl->m_linearizationState = m_statePrev;
+        m_pimpl->m_cachedLfInContact = meas.lfInContact;
+        m_pimpl->m_cachedRfInContact = meas.rfInContact;
+        m_pimpl->m_cachedDt = dt;
+        m_pimpl->m_stepsSinceLinearization = 0;
+        m_pimpl->m_hasCachedLinearization = true;
+    }
+    else
+    {
+        m_pimpl->m_stepsSinceLinearization++;
+    }
 
-    // discretize linearized dynamics and propagate covariance
-    m_pimpl->m_Fk = m_pimpl->m_In + (m_pimpl->m_Fc*dt);  // read as Fk = I + (Fc*dt)
-    m_pimpl->m_Qk = (m_pimpl->m_Fk*m_pimpl->m_Lc*m_pimpl->m_Qc*(m_pimpl->m_Lc.transpose())*(m_pimpl->m_Fk.transpose()))*dt; // read as Qk = Fk Lc Qc Lc.T Fk.T
-    m_pimpl->m_P = m_pimpl->m_Fk*m_pimpl->m_P*(m_pimpl->m_Fk.transpose()) + m_pimpl->m_Qk; // read as P = Fk P Fk.T + Qk
-    m_pimpl->extractStateVar(m_pimpl->m_P,m_options.imuBiasEstimationEnabled, m_stateStdDev); // unwrap state covariance matrix diagonal
+    // propagate covariance with the cached discrete time matrices
+    if (m_options.useSquareRootCovariance)
+    {
+        // propagate the Cholesky factor of the state covariance instead of the full matrix,
+        // sqrtP = tria([ (Fk sqrtP).T ; sqrt(dt) (Fk Lc sqrt(Qc)).T ])
+        // which is algebraically equivalent to P = Fk P Fk.T + Qk
+        auto dim = m_pimpl->m_sqrtP.rows();
+        m_pimpl->m_qrStack.resize(2*dim, dim);
+        m_pimpl->m_qrStack.topRows(dim) = (m_pimpl->m_Fk*m_pimpl->m_sqrtP).transpose();
+        m_pimpl->m_qrStack.bottomRows(dim) = m_pimpl->m_FkLcQcSqrt.transpose();
+        m_pimpl->triangularize(m_pimpl->m_qrStack, m_pimpl->m_sqrtP);
+        m_pimpl->extractStateVarFromSqrt(m_pimpl->m_sqrtP, m_options.imuBiasEstimationEnabled, m_stateStdDev); // unwrap state covariance factor row norms
+    }
+    else
+    {
+        m_pimpl->m_P = m_pimpl->m_Fk*m_pimpl->m_P*(m_pimpl->m_Fk.transpose()) + m_pimpl->m_Qk; // read as P = Fk P Fk.T + Qk
+        m_pimpl->extractStateVar(m_pimpl->m_P,m_options.imuBiasEstimationEnabled, m_stateStdDev); // unwrap state covariance matrix diagonal
+    }
 
     return true;
 }
@@ -380,7 +578,6 @@ bool InvariantEKFBaseEstimator::updateKinematics(FloatingBaseEstimators::Measure
     Eigen::Vector3d sIMU_p_RF = m_pimpl->IMU_H_RF.translation();
 
     Eigen::VectorXd encodersVar = m_sensorsDev.encodersNoise.array().square();
-    Eigen::MatrixXd Renc = static_cast<Eigen::MatrixXd>(encodersVar.asDiagonal());
 
     constexpr int firstFootPositionVecOffsetObs{0};
     constexpr int secondFootPositionVecOffsetObs{3};
@@ -448,9 +645,9 @@ bool InvariantEKFBaseEstimator::updateKinematics(FloatingBaseEstimators::Measure
 
         // prepare measurement noise covariance R
         m_pimpl->m_measNoiseVar.resize(linearizedDimension, linearizedDimension);
-        m_pimpl->m_measNoiseVar.topLeftCorner<3, 3>() = A_R_IMU*m_pimpl->J_IMURF.topRows<3>()*Renc*(m_pimpl->J_IMURF.topRows<3>().transpose())*(A_R_IMU.transpose());
+        m_pimpl->m_measNoiseVar.topLeftCorner<3, 3>() = A_R_IMU*m_pimpl->J_IMURF.topRows<3>()*encodersVar.asDiagonal()*(m_pimpl->J_IMURF.topRows<3>().transpose())*(A_R_IMU.transpose());
         m_pimpl->m_measNoiseVar.topRightCorner<3, 3>().setZero();
-        m_pimpl->m_measNoiseVar.bottomRightCorner<3, 3>() = A_R_IMU*m_pimpl->J_IMULF.topRows<3>()*Renc*(m_pimpl->J_IMULF.topRows<3>().transpose())*(A_R_IMU.transpose());
+        m_pimpl->m_measNoiseVar.bottomRightCorner<3, 3>() = A_R_IMU*m_pimpl->J_IMULF.topRows<3>()*encodersVar.asDiagonal()*(m_pimpl->J_IMULF.topRows<3>().transpose())*(A_R_IMU.transpose());
         m_pimpl->m_measNoiseVar.bottomLeftCorner<3, 3>().setZero();
         m_pimpl->m_measNoiseVar /= dt;
     }
@@ -491,7 +688,7 @@ bool InvariantEKFBaseEstimator::updateKinematics(FloatingBaseEstimators::Measure
 
         // prepare measurement noise covariance R
         m_pimpl->m_measNoiseVar.resize(linearizedDimension, linearizedDimension);
-        m_pimpl->m_measNoiseVar.topLeftCorner<3, 3>() = A_R_IMU*m_pimpl->J_IMURF.topRows<3>()*Renc*(m_pimpl->J_IMURF.topRows<3>().transpose())*(A_R_IMU.transpose());
+        m_pimpl->m_measNoiseVar.topLeftCorner<3, 3>() = A_R_IMU*m_pimpl->J_IMURF.topRows<3>()*encodersVar.asDiagonal()*(m_pimpl->J_IMURF.topRows<3>().transpose())*(A_R_IMU.transpose());
         m_pimpl->m_measNoiseVar /= dt;
     }
     else if (meas.lfInContact)
@@ -531,17 +728,28 @@ bool InvariantEKFBaseEstimator::updateKinematics(FloatingBaseEstimators::Measure
 
         // prepare measurement noise covariance R
         m_pimpl->m_measNoiseVar.resize(linearizedDimension, linearizedDimension);
-        m_pimpl->m_measNoiseVar.topLeftCorner<3, 3>() = A_R_IMU*m_pimpl->J_IMULF.topRows<3>()*Renc*(m_pimpl->J_IMULF.topRows<3>().transpose())*(A_R_IMU.transpose());
+        m_pimpl->m_measNoiseVar.topLeftCorner<3, 3>() = A_R_IMU*m_pimpl->J_IMULF.topRows<3>()*encodersVar.asDiagonal()*(m_pimpl->J_IMULF.topRows<3>().transpose())*(A_R_IMU.transpose());
         m_pimpl->m_measNoiseVar /= dt;
     }
 
     if (meas.lfInContact || meas.rfInContact)
     {
-        if (!m_pimpl->updateStates(m_pimpl->m_obs, m_pimpl->m_measModelJacobian, m_pimpl->m_measNoiseVar, m_pimpl->m_auxMat, m_state, m_pimpl->m_P))
+        if (m_options.useSquareRootCovariance)
         {
-            return false;
+            if (!m_pimpl->updateStatesSquareRoot(m_pimpl->m_obs, m_pimpl->m_measModelJacobian, m_pimpl->m_measNoiseVar, m_pimpl->m_auxMat, m_state, m_pimpl->m_sqrtP))
+            {
+                return false;
+            }
+            m_pimpl->extractStateVarFromSqrt(m_pimpl->m_sqrtP, m_options.imuBiasEstimationEnabled, m_stateStdDev); // unwrap state covariance factor row norms
+        }
+        else
+        {
+            if (!m_pimpl->updateStates(m_pimpl->m_obs, m_pimpl->m_measModelJacobian, m_pimpl->m_measNoiseVar, m_pimpl->m_auxMat, m_state, m_pimpl->m_P))
+            {
+                return false;
+            }
+            m_pimpl->extractStateVar(m_pimpl->m_P,m_options.imuBiasEstimationEnabled, m_stateStdDev); // unwrap state covariance matrix diagonal
         }
-        m_pimpl->extractStateVar(m_pimpl->m_P,m_options.imuBiasEstimationEnabled, m_stateStdDev); // unwrap state covariance matrix diagonal
     }
 
     // should we handle removing old contacts and adding new contacts? or let it be as it is.
@@ -549,6 +757,36 @@ bool InvariantEKFBaseEstimator::updateKinematics(FloatingBaseEstimators::Measure
 }
 
 
+bool InvariantEKFBaseEstimator::cacheInternalCovariance(Eigen::MatrixXd& covariance)
+{
+    if (m_options.useSquareRootCovariance)
+    {
+        covariance = m_pimpl->m_sqrtP;
+    }
+    else
+    {
+        covariance = m_pimpl->m_P;
+    }
+
+    return true;
+}
+
+bool InvariantEKFBaseEstimator::restoreInternalCovariance(const Eigen::MatrixXd& covariance)
+{
+    Impl::TangentMatrix& internal = m_options.useSquareRootCovariance ? m_pimpl->m_sqrtP
+                                                                      : m_pimpl->m_P;
+    if ((covariance.rows() != internal.rows()) || (covariance.cols() != internal.cols()))
+    {
+        std::cerr << "[InvariantEKFBaseEstimator::restoreInternalCovariance] "
+                     "Cached covariance size mismatch. "
+                  << std::endl;
+        return false;
+    }
+
+    internal = covariance;
+    return true;
+}
+
 bool InvariantEKFBaseEstimator::Impl::propagateStates(const FloatingBaseEstimators::Measurements& meas,
                                                       const double& dt,
                                                       const Eigen::Vector3d& g,
@@ -584,12 +822,12 @@ bool InvariantEKFBaseEstimator::Impl::propagateStates(const FloatingBaseEstimato
     return true;
 }
 
-bool InvariantEKFBaseEstimator::Impl::updateStates(const Eigen::VectorXd& obs,
-                                                   const Eigen::MatrixXd measModelJacobian,
-                                                   const Eigen::MatrixXd& measNoiseVar,
-                                                   const Eigen::MatrixXd& auxMat,
+bool InvariantEKFBaseEstimator::Impl::updateStates(const ObsVector& obs,
+                                                   const MeasJacobian& measModelJacobian,
+                                                   const MeasNoiseMatrix& measNoiseVar,
+                                                   const AuxMatrix& auxMat,
                                                    FloatingBaseEstimators::InternalState& state,
-                                                   Eigen::MatrixXd& P)
+                                                   TangentMatrix& P)
 {
     if (measModelJacobian.cols() != P.rows())
     {
@@ -617,6 +855,76 @@ bool InvariantEKFBaseEstimator::Impl::updateStates(const Eigen::VectorXd& obs,
     m_S = measModelJacobian*m_PHT + measNoiseVar;
     m_K = m_PHT*(m_S.inverse());
 
+    if (!correctState(obs, auxMat, state))
+    {
+        return false;
+    }
+
+    // update covariance
+    m_IminusKH = TangentMatrix::Identity(P.rows(), P.cols()) - m_K*measModelJacobian;
+    P = m_IminusKH*P*(m_IminusKH.transpose()) + m_K*measNoiseVar*(m_K.transpose());
+    return true;
+}
+
+bool InvariantEKFBaseEstimator::Impl::updateStatesSquareRoot(const ObsVector& obs,
+                                                             const MeasJacobian& measModelJacobian,
+                                                             const MeasNoiseMatrix& measNoiseVar,
+                                                             const AuxMatrix& auxMat,
+                                                             FloatingBaseEstimators::InternalState& state,
+                                                             TangentMatrix& sqrtP)
+{
+    if (measModelJacobian.cols() != sqrtP.rows())
+    {
+        std::cerr << "[InvariantEKFBaseEstimator::updateStatesSquareRoot] Measurement model Jacobian size mismatch" << std::endl;
+        return false;
+    }
+
+    if (measModelJacobian.rows() != measNoiseVar.rows())
+    {
+        std::cerr << "[InvariantEKFBaseEstimator::updateStatesSquareRoot] Measurement noise covariance matrix size mismatch" << std::endl;
+        return false;
+    }
+
+    // the gain is computed as in the full covariance update,
+    // with P reconstructed on the fly from its Cholesky factor
+    m_PHT = sqrtP*(sqrtP.transpose()*measModelJacobian.transpose());
+    m_S = measModelJacobian*m_PHT + measNoiseVar;
+    m_K = m_PHT*(m_S.inverse());
+
+    if (!correctState(obs, auxMat, state))
+    {
+        return false;
+    }
+
+    // Joseph form update in square-root form,
+    // P = (I - KH) P (I - KH).T + K R K.T is rewritten as
+    // sqrtP sqrtP.T with sqrtP the triangularized stack of
+    // (I - KH) sqrtP and K chol(R), preserving symmetry and positive semi-definiteness
+    m_IminusKH = TangentMatrix::Identity(sqrtP.rows(), sqrtP.cols()) - m_K*measModelJacobian;
+    m_sqrtR = measNoiseVar.llt().matrixL();
+
+    auto dim = sqrtP.rows();
+    m_qrStack.resize(sqrtP.cols() + m_sqrtR.cols(), dim);
+    m_qrStack.topRows(sqrtP.cols()) = (m_IminusKH*sqrtP).transpose();
+    m_qrStack.bottomRows(m_sqrtR.cols()) = (m_K*m_sqrtR).transpose();
+    triangularize(m_qrStack, sqrtP);
+    return true;
+}
+
+bool InvariantEKFBaseEstimator::Impl::correctState(const ObsVector& obs,
+                                                   const AuxMatrix& auxMat,
+                                                   FloatingBaseEstimators::InternalState& state)
+{
+    bool estimateBias;
+    if (m_K.rows() == m_vecSizeWBias)
+    {
+        estimateBias = true;
+    }
+    else
+    {
+        estimateBias = false;
+    }
+
     // compute innovation delta
     extractState(state, m_X, m_theta);
 
@@ -636,24 +944,28 @@ bool InvariantEKFBaseEstimator::Impl::updateStates(const Eigen::VectorXd& obs,
     }
 
     // update state
-    if (!calcExpHatX(m_delta.segment(0, m_vecSizeWOBias), m_dX))
+    if (!calcExpHatX(m_delta.head<m_vecSizeWOBias>(), m_dX))
     {
-        std::cerr << "[InvariantEKFBaseEstimator::updateStates] Could not compute state update";
+        std::cerr << "[InvariantEKFBaseEstimator::correctState] Could not compute state update";
         return false;
     }
 
     if (!constructState( m_dX*m_X, m_theta+m_deltaTheta, state) ) // right invariant update
     {
-        std::cerr << "[InvariantEKFBaseEstimator::updateStates] Could not update state";
+        std::cerr << "[InvariantEKFBaseEstimator::correctState] Could not update state";
         return false;
     }
-    // update covariance
-    m_IminusKH = Eigen::MatrixXd::Identity(P.rows(), P.cols()) - m_K*measModelJacobian;
-    P = m_IminusKH*P*(m_IminusKH.transpose()) + m_K*measNoiseVar*(m_K.transpose());
     return true;
 }
 
-void InvariantEKFBaseEstimator::Impl::extractStateVar(const Eigen::MatrixXd& P,
+void InvariantEKFBaseEstimator::Impl::triangularize(const QRStackMatrix& stack, TangentMatrix& S)
+{
+    Eigen::HouseholderQR<QRStackMatrix> qr(stack);
+    S = qr.matrixQR().topRows(stack.cols()).triangularView<Eigen::Upper>();
+    S.transposeInPlace(); // store the lower triangular factor S such that S S.T = stack.T stack
+}
+
+void InvariantEKFBaseEstimator::Impl::extractStateVar(const TangentMatrix& P,
                                                       const bool& estimateBias,
                                                       FloatingBaseEstimators::StateStdDev& stateStdDev)
 {
@@ -669,9 +981,27 @@ void InvariantEKFBaseEstimator::Impl::extractStateVar(const Eigen::MatrixXd& P,
     }
 }
 
+void InvariantEKFBaseEstimator::Impl::extractStateVarFromSqrt(const TangentMatrix& sqrtP,
+                                                              const bool& estimateBias,
+                                                              FloatingBaseEstimators::StateStdDev& stateStdDev)
+{
+    // since P = sqrtP sqrtP.T, the i-th diagonal element of P
+    // is the squared norm of the i-th row of sqrtP
+    stateStdDev.imuOrientation = sqrtP.middleRows<3>(m_vecOffsets.imuOrientation).rowwise().norm();
+    stateStdDev.imuLinearVelocity = sqrtP.middleRows<3>(m_vecOffsets.imuLinearVel).rowwise().norm();
+    stateStdDev.imuPosition = sqrtP.middleRows<3>(m_vecOffsets.imuPosition).rowwise().norm();
+    stateStdDev.rContactFramePosition = sqrtP.middleRows<3>(m_vecOffsets.rContactFramePosition).rowwise().norm();
+    stateStdDev.lContactFramePosition = sqrtP.middleRows<3>(m_vecOffsets.lContactFramePosition).rowwise().norm();
+    if (estimateBias)
+    {
+        stateStdDev.gyroscopeBias = sqrtP.middleRows<3>(m_vecOffsets.gyroBias).rowwise().norm();
+        stateStdDev.accelerometerBias = sqrtP.middleRows<3>(m_vecOffsets.accBias).rowwise().norm();
+    }
+}
+
 void InvariantEKFBaseEstimator::Impl::constuctStateVar(const FloatingBaseEstimators::StateStdDev& stateStdDev,
                                                        const bool& estimateBias,
-                                                       Eigen::MatrixXd& P)
+                                                       TangentMatrix& P)
 {
     if (estimateBias)
     {
@@ -706,7 +1036,7 @@ void InvariantEKFBaseEstimator::Impl::constuctStateVar(const FloatingBaseEstimat
 }
 
 void InvariantEKFBaseEstimator::Impl::extractState(const FloatingBaseEstimators::InternalState& state,
-                                                   Eigen::MatrixXd& X,
+                                                   StateMatrix& X,
                                                    Eigen::Matrix<double, 6, 1>& theta)
 {
     // X =    |R  v  p pr pl|
@@ -714,7 +1044,6 @@ void InvariantEKFBaseEstimator::Impl::extractState(const FloatingBaseEstimators:
     //        |      1      |
     //        |         1   |
     //        |            1|
-    X.resize(7, 7);
     X.block<3, 3>(0, 0) = state.imuOrientation.toRotationMatrix();
     X.block<3, 1>(0, 3) = state.imuLinearVelocity;
     X.block<3, 1>(0, 4) = state.imuPosition;
@@ -727,16 +1056,10 @@ void InvariantEKFBaseEstimator::Impl::extractState(const FloatingBaseEstimators:
     theta.segment<3>(3) = state.accelerometerBias;
 }
 
-bool InvariantEKFBaseEstimator::Impl::constructState(const Eigen::MatrixXd& X,
+bool InvariantEKFBaseEstimator::Impl::constructState(const StateMatrix& X,
                                                      const Eigen::Matrix<double, 6, 1>& theta,
                                                      FloatingBaseEstimators::InternalState& state)
 {
-    if (X.rows() != 7 && X.cols() != 7)
-    {
-        std::cerr << "[InvariantEKFBaseEstimator::constructState] State matrix does not seem to have expected size of 7x7." << std::endl;
-        return false;
-    }
-
     state.imuOrientation = Eigen::Quaterniond(X.block<3, 3>(0, 0));
     state.imuLinearVelocity = X.block<3, 1>(0, 3);
     state.imuPosition = X.block<3, 1>(0, 4);
@@ -747,8 +1070,8 @@ bool InvariantEKFBaseEstimator::Impl::constructState(const Eigen::MatrixXd& X,
     return true;
 }
 
-bool InvariantEKFBaseEstimator::Impl::calcExpHatX(const Eigen::VectorXd& vec,
-                                                  Eigen::MatrixXd& X)
+bool InvariantEKFBaseEstimator::Impl::calcExpHatX(const TangentVectorWOBias& vec,
+                                                  StateMatrix& X)
 {
     // Exp(vec) = Exp([ w]) =    |ExpSO3(w)  JlSO3(w)v  JlSO3(w)p  JlSO3(w)pr  JlSO3(w)pl|
     //               ([ a])      |                   1                                   |
@@ -756,19 +1079,13 @@ bool InvariantEKFBaseEstimator::Impl::calcExpHatX(const Eigen::VectorXd& vec,
     //               ([vr])      |                                         1             |
     //               ([vl])      |                                                      1|
     // where JlSO3 is the left Jacobian of SO(3)
-    if (vec.size() != 15)
-    {
-        std::cerr << "[InvariantEKFBaseEstimator::calcExpHatX] State vector does not seem to have expected size of 15x1." << std::endl;
-        return false;
-    }
-
-    X.resize(7, 7);
     auto omega = manif::SO3Tangentd(vec.segment<3>(m_vecOffsets.imuOrientation));
+    const Eigen::Matrix3d JlSO3 = omega.ljac();
     X.topLeftCorner<3, 3>() = omega.exp().rotation();
-    X.block<3, 1>(0, 3) = omega.ljac()*vec.segment<3>(m_vecOffsets.imuLinearVel);
-    X.block<3, 1>(0, 4) = omega.ljac()*vec.segment<3>(m_vecOffsets.imuPosition);
-    X.block<3, 1>(0, 5) = omega.ljac()*vec.segment<3>(m_vecOffsets.rContactFramePosition);
-    X.block<3, 1>(0, 6) = omega.ljac()*vec.segment<3>(m_vecOffsets.lContactFramePosition);
+    X.block<3, 1>(0, 3) = JlSO3*vec.segment<3>(m_vecOffsets.imuLinearVel);
+    X.block<3, 1>(0, 4) = JlSO3*vec.segment<3>(m_vecOffsets.imuPosition);
+    X.block<3, 1>(0, 5) = JlSO3*vec.segment<3>(m_vecOffsets.rContactFramePosition);
+    X.block<3, 1>(0, 6) = JlSO3*vec.segment<3>(m_vecOffsets.lContactFramePosition);
 
     X.bottomLeftCorner<4, 3>().setZero();
     X.bottomRightCorner<4, 4>() = Eigen::Matrix4d::Identity();
@@ -777,14 +1094,13 @@ bool InvariantEKFBaseEstimator::Impl::calcExpHatX(const Eigen::VectorXd& vec,
 
 void InvariantEKFBaseEstimator::Impl::calcAdjointX(const FloatingBaseEstimators::InternalState& X,
                                                    const SkewSymContainter& skew,
-                                                   Eigen::MatrixXd& AdjX)
+                                                   AdjointMatrix& AdjX)
 {
     // AdjX = |   R         |
     //        | vxR  R      |
     //        | pxR    R    |
     //        |prxR      R  |
     //        |plxR        R|
-    AdjX.resize(m_vecSizeWOBias, m_vecSizeWOBias);
     AdjX.setZero();
     Eigen::Matrix3d R = X.imuOrientation.toRotationMatrix();
 
@@ -802,7 +1118,7 @@ void InvariantEKFBaseEstimator::Impl::calcAdjointX(const FloatingBaseEstimators:
 
 void InvariantEKFBaseEstimator::Impl::calcFc(const FloatingBaseEstimators::InternalState& X,
                                              const SkewSymContainter& skew,
-                                             const bool& estimateBias, Eigen::MatrixXd& Fc)
+                                             const bool& estimateBias, TangentMatrix& Fc)
 {
     // When biases are enabled,
     // Fc = [   0   0   0   0       -R   0]
@@ -846,7 +1162,7 @@ void InvariantEKFBaseEstimator::Impl::calcQc(const FloatingBaseEstimators::Inter
                                              const FloatingBaseEstimators::SensorsStdDev& sensDev,
                                              const FloatingBaseEstimators::Measurements& meas,
                                              const bool& estimateBias,
-                                             Eigen::MatrixXd& Qc)
+                                             TangentMatrix& Qc)
 {
     // When biases are enabled,
     // Qc = blkdiag(Qg, Qa, 0, Qrf, Qlf, Qbg, Qba)
@@ -899,10 +1215,62 @@ void InvariantEKFBaseEstimator::Impl::calcQc(const FloatingBaseEstimators::Inter
     Qc.block<3, 3>(m_vecOffsets.lContactFramePosition, m_vecOffsets.lContactFramePosition) = R*static_cast<Eigen::Matrix3d>(Qlf.asDiagonal())*(R.transpose());
 }
 
+void InvariantEKFBaseEstimator::Impl::calcQcSqrt(const FloatingBaseEstimators::InternalState& X,
+                                                 const FloatingBaseEstimators::SensorsStdDev& sensDev,
+                                                 const FloatingBaseEstimators::Measurements& meas,
+                                                 const bool& estimateBias,
+                                                 TangentMatrix& QcSqrt)
+{
+    // When biases are enabled,
+    // QcSqrt = blkdiag(diag(sg), diag(sa), 0, R diag(srf), R diag(slf), diag(sbg), diag(sba))
+    // where the s* are the sensor standard deviations, so that QcSqrt QcSqrt.T = Qc
+    if (estimateBias)
+    {
+        QcSqrt.resize(m_vecSizeWBias, m_vecSizeWBias);
+    }
+    else
+    {
+        QcSqrt.resize(m_vecSizeWOBias, m_vecSizeWOBias);
+    }
+    QcSqrt.setZero();
+
+    QcSqrt.block<3, 3>(m_vecOffsets.imuOrientation, m_vecOffsets.imuOrientation) = static_cast<Eigen::Matrix3d>(sensDev.gyroscopeNoise.asDiagonal());
+    QcSqrt.block<3, 3>(m_vecOffsets.imuLinearVel, m_vecOffsets.imuLinearVel) = static_cast<Eigen::Matrix3d>(sensDev.accelerometerNoise.asDiagonal());
+
+    if (estimateBias)
+    {
+        QcSqrt.block<3, 3>(m_vecOffsets.gyroBias, m_vecOffsets.gyroBias) = static_cast<Eigen::Matrix3d>(sensDev.gyroscopeBiasNoise.asDiagonal());
+        QcSqrt.block<3, 3>(m_vecOffsets.accBias, m_vecOffsets.accBias) = static_cast<Eigen::Matrix3d>(sensDev.accelerometerBiasNoise.asDiagonal());
+    }
+
+    Eigen::Matrix3d R = X.imuOrientation.toRotationMatrix();
+    Eigen::Vector3d slf, srf;
+    if (meas.lfInContact)
+    {
+        slf = sensDev.contactFootLinvelNoise;
+    }
+    else
+    {
+        slf = sensDev.swingFootLinvelNoise;
+    }
+
+    if (meas.rfInContact)
+    {
+        srf = sensDev.contactFootLinvelNoise;
+    }
+    else
+    {
+        srf = sensDev.swingFootLinvelNoise;
+    }
+
+    QcSqrt.block<3, 3>(m_vecOffsets.rContactFramePosition, m_vecOffsets.rContactFramePosition) = R*static_cast<Eigen::Matrix3d>(srf.asDiagonal());
+    QcSqrt.block<3, 3>(m_vecOffsets.lContactFramePosition, m_vecOffsets.lContactFramePosition) = R*static_cast<Eigen::Matrix3d>(slf.asDiagonal());
+}
+
 void InvariantEKFBaseEstimator::Impl::calcLc(const FloatingBaseEstimators::InternalState& X,
                                              const SkewSymContainter& skew,
                                              const bool& estimateBias,
-                                             Eigen::MatrixXd& Lc)
+                                             TangentMatrix& Lc)
 {
     // When biases are enabled,
     // Lc = blkdiag(AdjX(X), I, I)
@@ -916,7 +1284,7 @@ void InvariantEKFBaseEstimator::Impl::calcLc(const FloatingBaseEstimators::Inter
     {
         Lc.resize(m_vecSizeWOBias, m_vecSizeWOBias);
     }
-    Eigen::MatrixXd AdjX;
+    AdjointMatrix AdjX;
     calcAdjointX(X, skew, AdjX);
     Lc.block(m_vecOffsets.imuOrientation, m_vecOffsets.imuOrientation, m_vecSizeWOBias, m_vecSizeWOBias) = AdjX;
 
@@ -936,25 +1304,22 @@ void InvariantEKFBaseEstimator::Impl::calcSkewSymAtCurrenState(const FloatingBas
 }
 
 
-bool InvariantEKFBaseEstimator::Impl::copyDiagX(const Eigen::MatrixXd& X,
+bool InvariantEKFBaseEstimator::Impl::copyDiagX(const StateMatrix& X,
                                                 const int& n,
-                                                Eigen::MatrixXd& BigX)
+                                                BigStateMatrix& BigX)
 {
-    if (X.rows() != 7 && X.cols() != 7)
+    constexpr int dimX = m_stateMatrixDim;
+    if (n * dimX > m_maxObsDim)
     {
-        std::cerr << "[InvariantEKFBaseEstimator::copyDiagX] State matrix does not seem to have expected size of 7x7." << std::endl;
+        std::cerr << "[InvariantEKFBaseEstimator::copyDiagX] Unexpected number of state matrix copies." << std::endl;
         return false;
     }
 
-    BigX.resize(0, 0);
-    int dimX = X.cols();
+    BigX.resize(n * dimX, n * dimX);
+    BigX.setZero();
     for (int i = 0; i < n; ++i)
     {
-        int startIndex = BigX.rows();
-        BigX.conservativeResize(startIndex + dimX, startIndex + dimX);
-        BigX.block(startIndex, 0, dimX, startIndex) = Eigen::MatrixXd::Zero(dimX, startIndex);
-        BigX.block(0, startIndex, startIndex, dimX) = Eigen::MatrixXd::Zero(startIndex, dimX);
-        BigX.block(startIndex, startIndex, dimX, dimX) = X;
+        BigX.block<dimX, dimX>(i * dimX, i * dimX) = X;
     }
     return true;
 }
@@ -96,6 +96,15 @@ public:
     void resetInternal(FloatingBaseEstimator::ModelComputations& modelComp,
                        const FloatingBaseEstimators::Measurements& meas);
 
+    /**
+     * Resize the weighted least square workspace. The method is a no-op when the
+     * workspace is already well sized, so in steady state (constant number of
+     * active contacts) the velocity computations run without heap allocations
+     */
+    void resizeLeastSquareWorkspace(const std::size_t& nrContacts,
+                                    const std::size_t& nrJoints,
+                                    const bool& withJointVel);
+
     // parameters
     std::string m_initialFixedFrame; /**<  Fixed frame at initialization assumed to be in rigid contact with the environment*/
     std::string m_initialRefFrameForWorld; /**< Reference frame for the world at initialization */
@@ -113,8 +122,10 @@ public:
     LOVelComputation velComp{LOVelComputation::multiFrameLeastSquare}; /**< base velocity estimation method*/
 
     Eigen::MatrixXd m_contactJacobian; /**< mixed velocity jacobian of fixed frame with respect to floating base */
-    Eigen::MatrixXd m_contactJacobianBase; /**< base sub-block of mixed velocity jacobian of fixed frame with respect to floating base */
+    Eigen::Matrix<double, 6, 6> m_contactJacobianBase; /**< base sub-block of mixed velocity jacobian of fixed frame with respect to floating base */
+    Eigen::Matrix<double, 6, 6> m_contactJacobianBaseInv; /**< inverse of the base sub-block of the contact Jacobian */
     Eigen::MatrixXd m_contactJacobianShape; /**< shape sub-block of mixed velocity jacobian of fixed frame with respect to floating base */
+    Eigen::Matrix<double, 6, 1> m_frameVel; /**< contribution of the encoder speeds through the shape sub-block */
     Eigen::VectorXd m_vBase; /**< mixed velocity representation of base link */
     const int m_spatialDim{6};
     const int m_baseOffset{0}; /**< offset in contact Jacobian for the base sub-block*/
@@ -126,6 +137,18 @@ public:
     double wJVel{10.0};
     double reg{1e-6};
     Eigen::VectorXd m_sDotFilt;
+
+    // weighted least square workspace, sized in resizeLeastSquareWorkspace()
+    std::size_t m_lsNrContacts{0}; /**< number of contacts the workspace is sized for */
+    bool m_lsWithJointVel{false}; /**< true if the workspace is sized for the joint velocity variant */
+    Eigen::MatrixXd m_lsA; /**< stacked constraint matrix */
+    Eigen::VectorXd m_lsY; /**< stacked measurement vector */
+    Eigen::VectorXd m_lsWeights; /**< diagonal of the weight matrix */
+    Eigen::MatrixXd m_lsAtW; /**< weighted transpose of the constraint matrix */
+    Eigen::MatrixXd m_lsH; /**< regularized normal equations matrix */
+    Eigen::VectorXd m_lsG; /**< right-hand side of the normal equations */
+    Eigen::VectorXd m_lsSol; /**< least square solution */
+    Eigen::LLT<Eigen::MatrixXd> m_lsLLT; /**< Cholesky solver of the normal equations */
 };
 
 LeggedOdometry::LeggedOdometry() : m_pimpl(std::make_unique<Impl>())
@@ -300,14 +323,62 @@ bool LeggedOdometry::customInitialization(std::weak_ptr<BipedalLocomotion::Param
 
     auto nrJoints = m_modelComp.kinDyn()->getNrOfDegreesOfFreedom();
     m_pimpl->m_contactJacobian.resize(m_pimpl->m_spatialDim, m_pimpl->m_spatialDim + nrJoints);
-    m_pimpl->m_contactJacobianBase.resize(m_pimpl->m_spatialDim, m_pimpl->m_spatialDim);
     m_pimpl->m_contactJacobianShape.resize(m_pimpl->m_spatialDim, nrJoints);
     m_pimpl->m_contactJacobian.setZero();
     m_pimpl->m_contactJacobianBase.setZero();
     m_pimpl->m_contactJacobianShape.setZero();
+
+    m_pimpl->m_sDotFilt.resize(nrJoints);
+    m_pimpl->m_sDotFilt.setZero();
+
+    // pre-size the least square workspace assuming double support. The workspace is
+    // resized automatically if the number of active contacts changes at run time
+    constexpr std::size_t expectedNrOfContacts{2};
+    m_pimpl->resizeLeastSquareWorkspace(expectedNrOfContacts,
+                                        nrJoints,
+                                        m_pimpl->velComp == LOVelComputation::multiFrameLeastSquareWithJVel);
     return true;
 }
 
+void LeggedOdometry::Impl::resizeLeastSquareWorkspace(const std::size_t& nrContacts,
+                                                      const std::size_t& nrJoints,
+                                                      const bool& withJointVel)
+{
+    if (nrContacts == m_lsNrContacts && withJointVel == m_lsWithJointVel && m_lsA.size() > 0)
+    {
+        // the workspace is already well sized, nothing to allocate
+        return;
+    }
+
+    const int n = withJointVel ? m_spatialDim*nrContacts + nrJoints : m_spatialDim*nrContacts;
+    const int m = withJointVel ? m_spatialDim + nrJoints : m_spatialDim;
+
+    m_lsA.setZero(n, m);
+    m_lsY.setZero(n);
+    m_lsWeights.setOnes(n);
+    m_lsAtW.resize(m, n);
+    m_lsH.resize(m, m);
+    m_lsG.resize(m);
+    m_lsSol.resize(m);
+    m_lsLLT = Eigen::LLT<Eigen::MatrixXd>(m);
+
+    constexpr int vec3Offset{3};
+    for (std::size_t cIdx = 0; cIdx < nrContacts; cIdx++)
+    {
+        m_lsWeights.segment(m_spatialDim*cIdx, vec3Offset).setConstant(wLin);
+        m_lsWeights.segment(m_spatialDim*cIdx + vec3Offset, vec3Offset).setConstant(wAng);
+    }
+
+    if (withJointVel)
+    {
+        m_lsWeights.tail(nrJoints).setConstant(wJVel);
+        m_lsA.bottomRightCorner(nrJoints, nrJoints).setIdentity();
+    }
+
+    m_lsNrContacts = nrContacts;
+    m_lsWithJointVel = withJointVel;
+}
+
 void LeggedOdometry::Impl::updateInternalContactStates(FloatingBaseEstimators::Measurements& meas,
                                                        FloatingBaseEstimator::ModelComputations& modelComp,
                                                        std::map<int, EstimatedContact>& contactStates)
@@ -571,7 +642,10 @@ bool LeggedOdometry::Impl::computeBaseVelocityUsingFixedFrameConstraint(Floating
     m_contactJacobianBase = m_contactJacobian.block<6, 6>(m_baseOffset, m_baseOffset);
     m_contactJacobianShape = m_contactJacobian.block(m_baseOffset, m_shapeOffset, m_spatialDim, modelComp.kinDyn()->getNrOfDegreesOfFreedom());
 
-    m_vBase = -(m_contactJacobianBase.inverse()) * m_contactJacobianShape * meas.encodersSpeed;
+    // the fixed-size inverse and the step-wise products avoid heap allocated temporaries
+    m_contactJacobianBaseInv = m_contactJacobianBase.inverse();
+    m_frameVel.noalias() = m_contactJacobianShape * meas.encodersSpeed;
+    m_vBase.noalias() = -m_contactJacobianBaseInv * m_frameVel;
     out.baseTwist = m_vBase;
 
     return true;
@@ -608,18 +682,13 @@ bool LeggedOdometry::Impl::computeBaseVelocityUsingAllFixedFrameConstraint(const
     }
 
 
-    // given number of contacts resize the matrices for weighted least square
-    int n = m_spatialDim*nrContacts + nrJoints;
-    int m = m_spatialDim + nrJoints;
-    Eigen::MatrixXd A(n, m);
+    // resize the preallocated workspace for the weighted least square
+    // (no-op when the number of active contacts did not change)
+    resizeLeastSquareWorkspace(nrContacts, nrJoints, /*withJointVel=*/true);
 
     // Set zero contact velocities and joint velocities
-    Eigen::VectorXd y(n);
-    y.head(n-nrJoints).setZero();
-    y.tail(nrJoints) = meas.encodersSpeed;
-
-    Eigen::MatrixXd W = Eigen::MatrixXd::Identity(n, n);
-    Eigen::MatrixXd Delta = reg*Eigen::MatrixXd::Identity(m, m);
+    // (the contact rows of the measurement vector stay zero)
+    m_lsY.tail(nrJoints) = meas.encodersSpeed;
 
     // run another loop to populate matrices
     std::size_t cIdx{0};
@@ -634,24 +703,29 @@ bool LeggedOdometry::Impl::computeBaseVelocityUsingAllFixedFrameConstraint(const
                 return false;
             }
 
-            A.block(m_spatialDim*cIdx, m_baseOffset, m_spatialDim, m) = m_contactJacobian;
-            int vec3Offset{3};
-            W.block(m_spatialDim*cIdx, m_spatialDim*cIdx, vec3Offset, vec3Offset) *= wLin;
-            W.block(m_spatialDim*cIdx+vec3Offset, m_spatialDim*cIdx+vec3Offset, vec3Offset, vec3Offset) *= wAng;
+            m_lsA.block(m_spatialDim*cIdx, m_baseOffset, m_spatialDim, m_lsA.cols()) = m_contactJacobian;
             cIdx ++;
         }
     }
 
+    // least square solution of the regularized normal equations
+    m_lsAtW.noalias() = m_lsA.transpose()*m_lsWeights.asDiagonal();
+    m_lsH.noalias() = m_lsAtW*m_lsA;
+    m_lsH.diagonal().array() += reg;
+    m_lsG.noalias() = m_lsAtW*m_lsY;
 
-    A.bottomRows(nrJoints) << Eigen::MatrixXd::Zero( nrJoints, m_spatialDim), Eigen::MatrixXd::Identity(nrJoints, nrJoints);
-    W.bottomRightCorner(nrJoints, nrJoints) *= wJVel;
-
-    // least square solution
-    Eigen::MatrixXd S = (A.transpose()*W*A + Delta).inverse();
-    Eigen::VectorXd xOptimal = S*A.transpose()*W*y;
+    m_lsLLT.compute(m_lsH);
+    if (m_lsLLT.info() != Eigen::Success)
+    {
+        std::cerr << printPrefix << "Could not solve the least square problem."
+                << std::endl;
+        return false;
+    }
+    m_lsSol = m_lsG;
+    m_lsLLT.solveInPlace(m_lsSol);
 
-    m_vBase = xOptimal.head(m_spatialDim);
-    m_sDotFilt = xOptimal.tail(nrJoints);
+    m_vBase = m_lsSol.head(m_spatialDim);
+    m_sDotFilt = m_lsSol.tail(nrJoints);
     out.baseTwist = m_vBase;
     return true;
 }
@@ -670,7 +744,7 @@ bool LeggedOdometry::Impl::computeBaseVelocityUsingAllFixedFrameAverage(const Fl
 
     std::size_t nrContacts{0};
     // run two loops (alteratively once can do conservative resize of the matrices)
-    Eigen::VectorXd sumV = Eigen::MatrixXd::Zero(6, 1);
+    Eigen::Matrix<double, 6, 1> sumV = Eigen::Matrix<double, 6, 1>::Zero();
     for (const auto& [idx, contact] : state.supportFrameData)
     {
         if (contact.isActive)
@@ -686,7 +760,10 @@ bool LeggedOdometry::Impl::computeBaseVelocityUsingAllFixedFrameAverage(const Fl
             m_contactJacobianBase = m_contactJacobian.block<6, 6>(m_baseOffset, m_baseOffset);
             m_contactJacobianShape = m_contactJacobian.block(m_baseOffset, m_shapeOffset, m_spatialDim, modelComp.kinDyn()->getNrOfDegreesOfFreedom());
 
-            sumV += -(m_contactJacobianBase.inverse()) * m_contactJacobianShape * meas.encodersSpeed;
+            // the fixed-size inverse and the step-wise products avoid heap allocated temporaries
+            m_contactJacobianBaseInv = m_contactJacobianBase.inverse();
+            m_frameVel.noalias() = m_contactJacobianShape * meas.encodersSpeed;
+            sumV.noalias() -= m_contactJacobianBaseInv * m_frameVel;
         }
     }
 
@@ -732,14 +809,10 @@ bool LeggedOdometry::Impl::computeBaseVelocityUsingAllFixedFrames(const Floating
     }
 
 
-    // given number of contacts resize the matrices for weighted least square
-    int n = m_spatialDim*nrContacts;
-    int m = m_spatialDim;
-    Eigen::MatrixXd A(n, m);
-    Eigen::VectorXd y(n);
-
-    Eigen::MatrixXd W = Eigen::MatrixXd::Identity(n, n);
-    Eigen::MatrixXd Delta = reg*Eigen::MatrixXd::Identity(m, m);
+    // resize the preallocated workspace for the weighted least square
+    // (no-op when the number of active contacts did not change)
+    std::size_t nrJoints{modelComp.kinDyn()->getNrOfDegreesOfFreedom()};
+    resizeLeastSquareWorkspace(nrContacts, nrJoints, /*withJointVel=*/false);
 
     // run another loop to populate matrices
     std::size_t cIdx{0};
@@ -757,22 +830,31 @@ bool LeggedOdometry::Impl::computeBaseVelocityUsingAllFixedFrames(const Floating
             m_contactJacobianBase = m_contactJacobian.block<6, 6>(m_baseOffset, m_baseOffset);
             m_contactJacobianShape = m_contactJacobian.block(m_baseOffset, m_shapeOffset, m_spatialDim, modelComp.kinDyn()->getNrOfDegreesOfFreedom());
 
-            A.block(m_spatialDim*cIdx, m_baseOffset, m_spatialDim, m_spatialDim) = m_contactJacobianBase;
-            y.segment(m_spatialDim*cIdx, m_spatialDim) = - m_contactJacobianShape*meas.encodersSpeed;
-
-            int vec3Offset{3};
-            W.block(m_spatialDim*cIdx, m_spatialDim*cIdx, vec3Offset, vec3Offset) *= wLin;
-            W.block(m_spatialDim*cIdx+vec3Offset, m_spatialDim*cIdx+vec3Offset, vec3Offset, vec3Offset) *= wAng;
+            m_lsA.block<6, 6>(m_spatialDim*cIdx, m_baseOffset) = m_contactJacobianBase;
+            m_frameVel.noalias() = m_contactJacobianShape*meas.encodersSpeed;
+            m_lsY.segment<6>(m_spatialDim*cIdx) = -m_frameVel;
 
             cIdx ++;
         }
     }
 
-    // least square solution
-    Eigen::MatrixXd S = (A.transpose()*W*A + Delta).inverse();
-    Eigen::VectorXd xOptimal = S*A.transpose()*W*y;
+    // least square solution of the regularized normal equations
+    m_lsAtW.noalias() = m_lsA.transpose()*m_lsWeights.asDiagonal();
+    m_lsH.noalias() = m_lsAtW*m_lsA;
+    m_lsH.diagonal().array() += reg;
+    m_lsG.noalias() = m_lsAtW*m_lsY;
+
+    m_lsLLT.compute(m_lsH);
+    if (m_lsLLT.info() != Eigen::Success)
+    {
+        std::cerr << printPrefix << "Could not solve the least square problem."
+                << std::endl;
+        return false;
+    }
+    m_lsSol = m_lsG;
+    m_lsLLT.solveInPlace(m_lsSol);
 
-    m_vBase = xOptimal;
+    m_vBase = m_lsSol;
     out.baseTwist = m_vBase;
 
     return true;
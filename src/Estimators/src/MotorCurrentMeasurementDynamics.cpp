@@ -129,6 +129,29 @@ bool RDE::MotorCurrentMeasurementDynamics::checkStateVariableHandler()
     return true;
 }
 
+bool RDE::MotorCurrentMeasurementDynamics::updateBatch(
+    Eigen::Ref<const Eigen::MatrixXd> states,
+    const std::vector<UKFInput>& /*inputs*/,
+    Eigen::Ref<Eigen::MatrixXd> updatedVariables)
+{
+    constexpr auto errorPrefix = "[MotorCurrentMeasurementDynamics::updateBatch]";
+
+    if (updatedVariables.rows() != m_size || updatedVariables.cols() != states.cols())
+    {
+        log()->error("{} The output matrix must have {} rows and {} columns.",
+                     errorPrefix,
+                     m_size,
+                     states.cols());
+        return false;
+    }
+
+    const auto& torque = m_stateVariableHandler.getVariable("tau_m");
+    updatedVariables.noalias() = (m_kTau.array() * m_gearRatio.array()).inverse().matrix().asDiagonal()
+                                 * states.middleRows(torque.offset, torque.size);
+
+    return true;
+}
+
 bool RDE::MotorCurrentMeasurementDynamics::update()
 {
     m_updatedVariable = m_motorTorque.array() / (m_kTau.array() * m_gearRatio.array());
@@ -55,6 +55,23 @@ bool RecursiveLeastSquare::initialize(std::weak_ptr<const IParametersHandler> ha
         return false;
     }
 
+    // if "window_size" is set the filter runs in sliding-window mode: the last "window_size"
+    // samples are kept in a circular buffer and the information matrix is modified with a rank-1
+    // update (downdate) every time a sample enters (leaves) the window. In this mode lambda is
+    // not used.
+    if (!handler->getParameter("window_size", m_windowSize))
+    {
+        m_windowSize = 0;
+    }
+
+    if (m_windowSize < 0)
+    {
+        std::cerr << "[RecursiveLeastSquare::initialize] The parameter window_size cannot be "
+                     "negative."
+                  << std::endl;
+        return false;
+    }
+
     // check if the presence of the initial initial guess of the state and of the covariance matrix
     if (!handler->getParameter("state", m_state.expectedValue))
     {
@@ -82,6 +99,25 @@ bool RecursiveLeastSquare::initialize(std::weak_ptr<const IParametersHandler> ha
     m_kalmanGain.resize(m_state.expectedValue.size(), measurementCovariance.size());
     m_kalmanGain.setZero();
 
+    // resize the circular buffer containing the samples of the sliding window
+    if (m_windowSize > 0)
+    {
+        m_measurementVariances = measurementCovariance;
+
+        m_windowRegressors.resize(m_windowSize * measurementCovariance.size(),
+                                  m_state.expectedValue.size());
+        m_windowRegressors.setZero();
+
+        m_windowMeasurements.resize(measurementCovariance.size(), m_windowSize);
+        m_windowMeasurements.setZero();
+
+        m_windowHead = 0;
+        m_windowCount = 0;
+
+        m_covarianceTimesRegressorRow.resize(m_state.expectedValue.size());
+        m_windowGain.resize(m_state.expectedValue.size());
+    }
+
     m_estimatorState = State::Initialized;
 
     return true;
@@ -118,20 +154,186 @@ bool RecursiveLeastSquare::advance()
     if (m_estimatorState == State::Initialized)
         m_estimatorState = State::Running;
 
-    auto& expectedValue = m_state.expectedValue;
-    auto& covariance = m_state.covariance;
-
     if(m_regressorFunction)
     {
         m_regressor = m_regressorFunction();
     }
 
-    m_kalmanGain = covariance * m_regressor.transpose()
+    if (m_windowSize > 0)
+    {
+        return this->updateWithSlidingWindow(m_regressor, m_measurements);
+    }
+
+    return this->updateWithForgettingFactor(m_regressor, m_measurements);
+}
+
+bool RecursiveLeastSquare::advanceBatch(const Eigen::Ref<const Eigen::MatrixXd>& regressors,
+                                        const Eigen::Ref<const Eigen::MatrixXd>& measurements)
+{
+    if (m_estimatorState != State::Initialized && m_estimatorState != State::Running)
+    {
+        std::cerr << "[RecursiveLeastSquare::advanceBatch] Please initialize the estimator before "
+                     "calling advanceBatch."
+                  << std::endl;
+        return false;
+    }
+
+    const Eigen::Index numberOfMeasurements = m_measurements.size();
+    const Eigen::Index numberOfSamples = measurements.cols();
+
+    if (measurements.rows() != numberOfMeasurements
+        || regressors.rows() != numberOfSamples * numberOfMeasurements
+        || regressors.cols() != m_state.expectedValue.size())
+    {
+        std::cerr << "[RecursiveLeastSquare::advanceBatch] Unexpected size of the regressors or "
+                     "of the measurements. The regressors are expected to be stacked vertically, "
+                     "one block per sample, and the measurements to be stored one column per "
+                     "sample."
+                  << std::endl;
+        return false;
+    }
+
+    if (m_estimatorState == State::Initialized)
+        m_estimatorState = State::Running;
+
+    // the samples are processed in order, from the first column to the last one
+    for (Eigen::Index i = 0; i < numberOfSamples; i++)
+    {
+        const auto regressor = regressors.middleRows(i * numberOfMeasurements,
+                                                     numberOfMeasurements);
+
+        const bool ok = (m_windowSize > 0)
+                            ? this->updateWithSlidingWindow(regressor, measurements.col(i))
+                            : this->updateWithForgettingFactor(regressor, measurements.col(i));
+
+        if (!ok)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool RecursiveLeastSquare::updateWithForgettingFactor(
+    const Eigen::Ref<const Eigen::MatrixXd>& regressor,
+    const Eigen::Ref<const Eigen::VectorXd>& measurements)
+{
+    auto& expectedValue = m_state.expectedValue;
+    auto& covariance = m_state.covariance;
+
+    m_kalmanGain = covariance * regressor.transpose()
                    * (m_lambda * m_measurementCovarianceMatrix
-                      + (m_regressor * covariance * m_regressor.transpose())).inverse();
+                      + (regressor * covariance * regressor.transpose())).inverse();
+
+    expectedValue += m_kalmanGain * (measurements - regressor * expectedValue);
+    covariance = (covariance - m_kalmanGain * regressor * covariance) / m_lambda;
+
+    return true;
+}
+
+bool RecursiveLeastSquare::updateWithSlidingWindow(
+    const Eigen::Ref<const Eigen::MatrixXd>& regressor,
+    const Eigen::Ref<const Eigen::VectorXd>& measurements)
+{
+    const Eigen::Index numberOfMeasurements = m_measurementVariances.size();
+
+    if (regressor.rows() != numberOfMeasurements
+        || regressor.cols() != m_state.expectedValue.size())
+    {
+        std::cerr << "[RecursiveLeastSquare::updateWithSlidingWindow] Unexpected size of the "
+                     "regressor."
+                  << std::endl;
+        return false;
+    }
+
+    // when the window is full the oldest sample leaves the window. Removing its contribution
+    // from the information matrix is a rank-1 downdate for each row of the stored regressor
+    if (m_windowCount == m_windowSize)
+    {
+        const auto oldestRegressor
+            = m_windowRegressors.middleRows(m_windowHead * numberOfMeasurements,
+                                            numberOfMeasurements);
+
+        for (Eigen::Index i = 0; i < numberOfMeasurements; i++)
+        {
+            if (!this->applyRankOneUpdate(oldestRegressor.row(i),
+                                          m_windowMeasurements(i, m_windowHead),
+                                          m_measurementVariances(i),
+                                          /*downdate = */ true))
+            {
+                return false;
+            }
+        }
+
+        m_windowCount--;
+    }
+
+    // store the new sample in the slot left free by the evicted one and add its contribution to
+    // the information matrix with a rank-1 update for each row of the regressor
+    m_windowRegressors.middleRows(m_windowHead * numberOfMeasurements, numberOfMeasurements)
+        = regressor;
+    m_windowMeasurements.col(m_windowHead) = measurements;
+
+    for (Eigen::Index i = 0; i < numberOfMeasurements; i++)
+    {
+        if (!this->applyRankOneUpdate(regressor.row(i),
+                                      measurements(i),
+                                      m_measurementVariances(i),
+                                      /*downdate = */ false))
+        {
+            return false;
+        }
+    }
+
+    m_windowHead = (m_windowHead + 1) % m_windowSize;
+    m_windowCount++;
+
+    return true;
+}
+
+bool RecursiveLeastSquare::applyRankOneUpdate(
+    const Eigen::Ref<const Eigen::RowVectorXd>& regressorRow,
+    const double& measurement,
+    const double& variance,
+    const bool& downdate)
+{
+    auto& expectedValue = m_state.expectedValue;
+    auto& covariance = m_state.covariance;
+
+    m_covarianceTimesRegressorRow.noalias() = covariance * regressorRow.transpose();
+
+    const double projectedVariance = regressorRow.dot(m_covarianceTimesRegressorRow);
 
-    expectedValue += m_kalmanGain * (m_measurements - m_regressor * expectedValue);
-    covariance = (covariance - m_kalmanGain * m_regressor * covariance) / m_lambda;
+    // thanks to the Sherman-Morrison formula the rank-1 modification of the information matrix
+    // can be applied directly on its inverse, i.e. the state covariance
+    const double denominator = downdate ? variance - projectedVariance //
+                                        : variance + projectedVariance;
+
+    // the denominator of the downdate vanishes only if the sample to be removed does not
+    // contribute to the information matrix, i.e. if the window bookkeeping is broken
+    if (downdate && !(denominator > 0))
+    {
+        std::cerr << "[RecursiveLeastSquare::applyRankOneUpdate] The rank-1 downdate is not well "
+                     "posed. The sliding window does not contain the sample that should be "
+                     "removed."
+                  << std::endl;
+        return false;
+    }
+
+    m_windowGain = m_covarianceTimesRegressorRow / denominator;
+
+    const double innovation = measurement - regressorRow.dot(expectedValue);
+
+    if (downdate)
+    {
+        expectedValue.noalias() -= m_windowGain * innovation;
+        covariance.noalias() += m_windowGain * m_covarianceTimesRegressorRow.transpose();
+    } else
+    {
+        expectedValue.noalias() += m_windowGain * innovation;
+        covariance.noalias() -= m_windowGain * m_covarianceTimesRegressorRow.transpose();
+    }
 
     return true;
 }
@@ -0,0 +1,364 @@
+/**
+ * @file SqrtUkfPrediction.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <BipedalLocomotion/RobotDynamicsEstimator/SqrtUkfPrediction.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Estimators::RobotDynamicsEstimator;
+
+struct SqrtUkfPrediction::Impl
+{
+    double alpha{1.0}; /**< Spread of the sigma points around the mean. */
+    double beta{2.0}; /**< Prior knowledge of the state distribution. */
+    double kappa{0.0}; /**< Secondary scaling parameter. */
+
+    std::shared_ptr<bfl::AdditiveStateModel> stateModel; /**< Model propagating the sigma points. */
+
+    Eigen::Index stateSize{0}; /**< Length of the state vector. */
+    double gamma{0.0}; /**< Sigma point scaling factor sqrt(n + lambda). */
+    double meanWeight0{0.0}; /**< Mean weight of the central sigma point. */
+    double covWeight0{0.0}; /**< Covariance weight of the central sigma point. */
+    double weightI{0.0}; /**< Weight of the non-central sigma points. */
+
+    Eigen::MatrixXd sqrtQ; /**< Lower triangular factor of the process noise covariance. */
+    Eigen::MatrixXd sigmaPoints; /**< Sigma points of the current step. */
+    Eigen::MatrixXd propagatedSigmaPoints; /**< Propagated sigma points of the current step. */
+    Eigen::MatrixXd qrStack; /**< Stacked deviations triangularized during the prediction. */
+    Eigen::VectorXd centralDeviation; /**< Deviation of the central propagated sigma point. */
+    Eigen::HouseholderQR<Eigen::MatrixXd> qr; /**< QR decomposition workspace. */
+
+    std::vector<Eigen::Index> blockSizes; /**< Sizes of the diagonal blocks of the covariance.
+                                             When empty the factor is treated as dense. */
+    std::vector<Eigen::Index> blockOffsets; /**< Offsets of the diagonal blocks in the state. */
+    std::vector<Eigen::MatrixXd> sqrtQBlocks; /**< Lower triangular factors of the diagonal
+                                                 blocks of the process noise covariance. */
+    Eigen::MatrixXd blockQrStack; /**< Stacked deviations of one block, triangularized during the
+                                     block-structured prediction. */
+
+    /**
+     * Rank-1 update (or downdate when weight is negative) of a lower triangular Cholesky factor,
+     * i.e., L L^T <- L L^T + weight v v^T. The factor is modified in place through Givens
+     * (hyperbolic, for the downdate) rotations.
+     */
+    bool choleskyRankUpdate(Eigen::Ref<Eigen::MatrixXd, 0, Eigen::OuterStride<>> L,
+                            Eigen::VectorXd v,
+                            const double weight)
+    {
+        const double sign = (weight < 0.0) ? -1.0 : 1.0;
+        v *= std::sqrt(std::abs(weight));
+
+        const Eigen::Index n = L.rows();
+        for (Eigen::Index k = 0; k < n; k++)
+        {
+            const double squared = L(k, k) * L(k, k) + sign * v(k) * v(k);
+            if (squared <= 0.0)
+            {
+                // the downdate broke the positive definiteness of the factor
+                return false;
+            }
+
+            const double r = std::sqrt(squared);
+            const double c = r / L(k, k);
+            const double s = v(k) / L(k, k);
+            L(k, k) = r;
+
+            if (k + 1 < n)
+            {
+                L.col(k).tail(n - k - 1) = (L.col(k).tail(n - k - 1) + sign * s * v.tail(n - k - 1)) / c;
+                v.tail(n - k - 1) = c * v.tail(n - k - 1) - s * L.col(k).tail(n - k - 1);
+            }
+        }
+
+        return true;
+    }
+};
+
+SqrtUkfPrediction::SqrtUkfPrediction()
+    : m_pimpl(std::make_unique<Impl>())
+{
+}
+
+SqrtUkfPrediction::~SqrtUkfPrediction() = default;
+
+bool SqrtUkfPrediction::initialize(
+    std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[SqrtUkfPrediction::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} The parameter handler is not valid.", logPrefix);
+        return false;
+    }
+
+    // the unscented transform parameters are optional
+    if (!ptr->getParameter("alpha", m_pimpl->alpha))
+    {
+        log()->info("{} The parameter 'alpha' is not found. The default value is used: {}.",
+                    logPrefix,
+                    m_pimpl->alpha);
+    }
+
+    if (!ptr->getParameter("beta", m_pimpl->beta))
+    {
+        log()->info("{} The parameter 'beta' is not found. The default value is used: {}.",
+                    logPrefix,
+                    m_pimpl->beta);
+    }
+
+    if (!ptr->getParameter("kappa", m_pimpl->kappa))
+    {
+        log()->info("{} The parameter 'kappa' is not found. The default value is used: {}.",
+                    logPrefix,
+                    m_pimpl->kappa);
+    }
+
+    if (m_pimpl->alpha <= 0.0)
+    {
+        log()->error("{} The parameter 'alpha' must be strictly positive.", logPrefix);
+        return false;
+    }
+
+    return true;
+}
+
+bool SqrtUkfPrediction::setStateModel(std::shared_ptr<bfl::AdditiveStateModel> stateModel)
+{
+    constexpr auto logPrefix = "[SqrtUkfPrediction::setStateModel]";
+
+    if (stateModel == nullptr)
+    {
+        log()->error("{} The state model is not valid.", logPrefix);
+        return false;
+    }
+
+    m_pimpl->stateModel = stateModel;
+    m_pimpl->stateSize = stateModel->getStateDescription().total_size();
+
+    const Eigen::Index n = m_pimpl->stateSize;
+    const double lambda = m_pimpl->alpha * m_pimpl->alpha * (n + m_pimpl->kappa) - n;
+
+    m_pimpl->gamma = std::sqrt(n + lambda);
+    m_pimpl->meanWeight0 = lambda / (n + lambda);
+    m_pimpl->covWeight0 = m_pimpl->meanWeight0
+                          + (1.0 - m_pimpl->alpha * m_pimpl->alpha + m_pimpl->beta);
+    m_pimpl->weightI = 1.0 / (2.0 * (n + lambda));
+
+    // the process noise is constant, so its factor is computed only once here
+    m_pimpl->sqrtQ = stateModel->getNoiseCovarianceMatrix().llt().matrixL();
+
+    // preallocate the buffers used at every prediction step
+    m_pimpl->sigmaPoints.resize(n, 2 * n + 1);
+    m_pimpl->propagatedSigmaPoints.resize(n, 2 * n + 1);
+    m_pimpl->qrStack.resize(3 * n, n);
+    m_pimpl->centralDeviation.resize(n);
+
+    return true;
+}
+
+bool SqrtUkfPrediction::setBlockStructure(const std::vector<Eigen::Index>& blockSizes)
+{
+    constexpr auto logPrefix = "[SqrtUkfPrediction::setBlockStructure]";
+
+    if (m_pimpl->stateModel == nullptr)
+    {
+        log()->error("{} Please call setStateModel before calling setBlockStructure.", logPrefix);
+        return false;
+    }
+
+    // an empty partition restores the dense mode
+    if (blockSizes.empty())
+    {
+        m_pimpl->blockSizes.clear();
+        m_pimpl->blockOffsets.clear();
+        m_pimpl->sqrtQBlocks.clear();
+        return true;
+    }
+
+    const Eigen::Index n = m_pimpl->stateSize;
+
+    Eigen::Index sum = 0;
+    Eigen::Index maxBlockSize = 0;
+    for (const auto& size : blockSizes)
+    {
+        if (size <= 0)
+        {
+            log()->error("{} The block sizes must be strictly positive.", logPrefix);
+            return false;
+        }
+        sum += size;
+        maxBlockSize = std::max(maxBlockSize, size);
+    }
+
+    if (sum != n)
+    {
+        log()->error("{} The block sizes must sum to the state size. Expected {}, provided {}.",
+                     logPrefix,
+                     n,
+                     sum);
+        return false;
+    }
+
+    m_pimpl->blockSizes = blockSizes;
+    m_pimpl->blockOffsets.resize(blockSizes.size());
+    m_pimpl->sqrtQBlocks.resize(blockSizes.size());
+
+    // factorize the diagonal blocks of the process noise covariance independently. The off-block
+    // entries are discarded, consistently with the block-diagonal factor carried by predict
+    const Eigen::MatrixXd noiseCovariance = m_pimpl->stateModel->getNoiseCovarianceMatrix();
+    Eigen::Index offset = 0;
+    for (std::size_t i = 0; i < blockSizes.size(); i++)
+    {
+        m_pimpl->blockOffsets[i] = offset;
+        m_pimpl->sqrtQBlocks[i]
+            = noiseCovariance.block(offset, offset, blockSizes[i], blockSizes[i]).llt().matrixL();
+        offset += blockSizes[i];
+    }
+
+    Eigen::MatrixXd offBlockResidual = noiseCovariance;
+    for (std::size_t i = 0; i < blockSizes.size(); i++)
+    {
+        offBlockResidual
+            .block(m_pimpl->blockOffsets[i], m_pimpl->blockOffsets[i], blockSizes[i], blockSizes[i])
+            .setZero();
+    }
+    if (!offBlockResidual.isZero())
+    {
+        log()->warn("{} The process noise covariance is not block-diagonal with respect to the "
+                    "provided partition. The off-block entries are discarded.",
+                    logPrefix);
+    }
+
+    m_pimpl->blockQrStack.resize(2 * n + maxBlockSize, maxBlockSize);
+
+    return true;
+}
+
+bool SqrtUkfPrediction::predict(Eigen::Ref<const Eigen::VectorXd> mean,
+                                Eigen::Ref<const Eigen::MatrixXd> sqrtCovariance,
+                                Eigen::Ref<Eigen::VectorXd> predictedMean,
+                                Eigen::Ref<Eigen::MatrixXd> predictedSqrtCovariance)
+{
+    constexpr auto logPrefix = "[SqrtUkfPrediction::predict]";
+
+    if (m_pimpl->stateModel == nullptr)
+    {
+        log()->error("{} Please call setStateModel before calling predict.", logPrefix);
+        return false;
+    }
+
+    const Eigen::Index n = m_pimpl->stateSize;
+    if (mean.size() != n || sqrtCovariance.rows() != n || sqrtCovariance.cols() != n
+        || predictedMean.size() != n || predictedSqrtCovariance.rows() != n
+        || predictedSqrtCovariance.cols() != n)
+    {
+        log()->error("{} Unexpected input size. The state size is {}.", logPrefix, n);
+        return false;
+    }
+
+    // draw the sigma points directly from the columns of the carried Cholesky factor,
+    // chi_0 = mean, chi_i = mean +/- gamma S e_i
+    m_pimpl->sigmaPoints.col(0) = mean;
+    m_pimpl->sigmaPoints.middleCols(1, n) = (m_pimpl->gamma * sqrtCovariance).colwise() + mean;
+    m_pimpl->sigmaPoints.middleCols(1 + n, n)
+        = (-m_pimpl->gamma * sqrtCovariance).colwise() + mean;
+
+    m_pimpl->stateModel->propagate(m_pimpl->sigmaPoints, m_pimpl->propagatedSigmaPoints);
+
+    // predicted mean
+    predictedMean.noalias() = m_pimpl->meanWeight0 * m_pimpl->propagatedSigmaPoints.col(0);
+    predictedMean.noalias()
+        += m_pimpl->weightI * m_pimpl->propagatedSigmaPoints.rightCols(2 * n).rowwise().sum();
+
+    const double sqrtWeightI = std::sqrt(m_pimpl->weightI);
+    m_pimpl->centralDeviation = m_pimpl->propagatedSigmaPoints.col(0) - predictedMean;
+
+    if (m_pimpl->blockSizes.empty())
+    {
+        // predicted factor: triangularize the stack of the weighted non-central deviations and of
+        // the process noise factor, then apply the central deviation as a rank-1 update
+        m_pimpl->qrStack.topRows(2 * n)
+            = (sqrtWeightI
+               * (m_pimpl->propagatedSigmaPoints.rightCols(2 * n).colwise() - predictedMean))
+                  .transpose();
+        m_pimpl->qrStack.bottomRows(n) = m_pimpl->sqrtQ.transpose();
+
+        m_pimpl->qr.compute(m_pimpl->qrStack);
+        predictedSqrtCovariance
+            = m_pimpl->qr.matrixQR().topRows(n).triangularView<Eigen::Upper>().transpose();
+
+        // normalize the signs so that the factor diagonal is non-negative
+        for (Eigen::Index i = 0; i < n; i++)
+        {
+            if (predictedSqrtCovariance(i, i) < 0.0)
+            {
+                predictedSqrtCovariance.col(i) = -predictedSqrtCovariance.col(i);
+            }
+        }
+
+        if (!m_pimpl->choleskyRankUpdate(predictedSqrtCovariance,
+                                         m_pimpl->centralDeviation,
+                                         m_pimpl->covWeight0))
+        {
+            log()->error("{} The rank-1 update of the predicted covariance factor failed.",
+                         logPrefix);
+            return false;
+        }
+
+        return true;
+    }
+
+    // block-structured predicted factor: every diagonal block is triangularized independently from
+    // the rows of the deviations belonging to the block. All the sigma points contribute to each
+    // block, so the cross-coupling of the dynamics is still reflected in the block marginals, only
+    // the cross-covariance between different blocks is dropped
+    predictedSqrtCovariance.setZero();
+    for (std::size_t b = 0; b < m_pimpl->blockSizes.size(); b++)
+    {
+        const Eigen::Index blockOffset = m_pimpl->blockOffsets[b];
+        const Eigen::Index blockSize = m_pimpl->blockSizes[b];
+
+        auto stack = m_pimpl->blockQrStack.topLeftCorner(2 * n + blockSize, blockSize);
+        stack.topRows(2 * n)
+            = (sqrtWeightI
+               * (m_pimpl->propagatedSigmaPoints.block(blockOffset, 1, blockSize, 2 * n).colwise()
+                  - predictedMean.segment(blockOffset, blockSize)))
+                  .transpose();
+        stack.bottomRows(blockSize) = m_pimpl->sqrtQBlocks[b].transpose();
+
+        m_pimpl->qr.compute(stack);
+        auto blockFactor
+            = predictedSqrtCovariance.block(blockOffset, blockOffset, blockSize, blockSize);
+        blockFactor
+            = m_pimpl->qr.matrixQR().topRows(blockSize).triangularView<Eigen::Upper>().transpose();
+
+        for (Eigen::Index i = 0; i < blockSize; i++)
+        {
+            if (blockFactor(i, i) < 0.0)
+            {
+                blockFactor.col(i) = -blockFactor.col(i);
+            }
+        }
+
+        if (!m_pimpl->choleskyRankUpdate(blockFactor,
+                                         m_pimpl->centralDeviation.segment(blockOffset, blockSize),
+                                         m_pimpl->covWeight0))
+        {
+            log()->error("{} The rank-1 update of the covariance factor of block {} failed.",
+                         logPrefix,
+                         b);
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -125,9 +125,24 @@ bool RDE::SubModelKinDynWrapper::initialize(const RDE::SubModel& subModel)
 bool RDE::SubModelKinDynWrapper::updateState(const manif::SE3d::Tangent& robotBaseAcceleration,
                                              Eigen::Ref<const Eigen::VectorXd> robotJointAcceleration,
                                              UpdateMode updateMode)
+{
+    if (!updateFullModelState())
+    {
+        return false;
+    }
+
+    if (!updateBaseAcceleration(robotBaseAcceleration, robotJointAcceleration))
+    {
+        return false;
+    }
+
+    return updateSubModelState(updateMode);
+}
+
+bool RDE::SubModelKinDynWrapper::updateFullModelState()
 {
     constexpr auto logPrefix = "[BipedalLocomotion::Estimators::SubModelKinDynWrapper::"
-                               "updateKinDynState]";
+                               "updateFullModelState]";
 
     // Get world transform for the base frame
     m_worldTBase = blf::Conversions::toManifPose(m_kinDynFullModel->getWorldTransform(m_baseFrame));
@@ -156,6 +171,25 @@ bool RDE::SubModelKinDynWrapper::updateState(const manif::SE3d::Tangent& robotBa
         return false;
     }
 
+    // the new robot state invalidates all the cached quantities, each one is recomputed at most
+    // once per generation on the first access
+    m_stateGeneration++;
+
+    return true;
+}
+
+std::uint64_t RDE::SubModelKinDynWrapper::stateGeneration() const
+{
+    return m_stateGeneration;
+}
+
+bool RDE::SubModelKinDynWrapper::updateBaseAcceleration(
+    const manif::SE3d::Tangent& robotBaseAcceleration,
+    Eigen::Ref<const Eigen::VectorXd> robotJointAcceleration)
+{
+    constexpr auto logPrefix = "[BipedalLocomotion::Estimators::SubModelKinDynWrapper::"
+                               "updateBaseAcceleration]";
+
     if (!m_kinDynFullModel->getFrameAcc(m_baseFrame,
                                         iDynTree::make_span(robotBaseAcceleration.data(),
                                                             manif::SE3d::Tangent::DoF),
@@ -169,13 +203,59 @@ bool RDE::SubModelKinDynWrapper::updateState(const manif::SE3d::Tangent& robotBa
         return false;
     }
 
+    return true;
+}
+
+bool RDE::SubModelKinDynWrapper::updateSubModelState(UpdateMode updateMode)
+{
     return updateDynamicsVariableState(updateMode);
 }
 
 bool RDE::SubModelKinDynWrapper::updateDynamicsVariableState(UpdateMode updateMode)
+{
+    // this method is an eager prefetch of the cached quantities (e.g. used by the worker pools of
+    // the ukf). The ensure methods skip the quantities already computed for the current state
+    // generation, so nothing is computed twice
+    bool ok = ensureMassMatrix() && ensureGeneralizedForces();
+
+    for (auto & [key, value] : m_subModel.getFTList())
+    {
+        ok = ok && ensureFTJacobian(key);
+    }
+
+    for (int idx = 0; idx < m_subModel.getExternalContactList().size(); idx++)
+    {
+        ok = ok && ensureExtContactJacobian(m_subModel.getExternalContactList()[idx]);
+    }
+
+    if (updateMode == UpdateMode::Full)
+    {
+        for (auto & [key, value] : m_subModel.getAccelerometerList())
+        {
+            ok = ok && ensureAccelerometerJacobian(key);
+            ok = ok && ensureAccelerometerBiasAcceleration(key);
+            ok = ok && ensureAccelerometerRotation(key);
+            ok = ok && ensureAccelerometerVelocity(key);
+        }
+
+        for (auto & [key, value] : m_subModel.getGyroscopeList())
+        {
+            ok = ok && ensureGyroscopeJacobian(key);
+        }
+    }
+
+    return ok;
+}
+
+bool RDE::SubModelKinDynWrapper::ensureMassMatrix() const
 {
     constexpr auto logPrefix = "[BipedalLocomotion::Estimators::SubModelKinDynWrapper::"
-                               "updateDynamicsVariableState]";
+                               "ensureMassMatrix]";
+
+    if (m_massMatrixGeneration == m_stateGeneration)
+    {
+        return true;
+    }
 
     if (!m_kinDyn.getFreeFloatingMassMatrix(m_massMatrix))
     {
@@ -183,6 +263,20 @@ bool RDE::SubModelKinDynWrapper::updateDynamicsVariableState(UpdateMode updateMo
         return false;
     }
 
+    m_massMatrixGeneration = m_stateGeneration;
+    return true;
+}
+
+bool RDE::SubModelKinDynWrapper::ensureGeneralizedForces() const
+{
+    constexpr auto logPrefix = "[BipedalLocomotion::Estimators::SubModelKinDynWrapper::"
+                               "ensureGeneralizedForces]";
+
+    if (m_genForcesGeneration == m_stateGeneration)
+    {
+        return true;
+    }
+
     if (!m_kinDyn.generalizedBiasForces(
                 iDynTree::make_span(m_genForces.data(), m_genForces.size())))
     {
@@ -191,82 +285,149 @@ bool RDE::SubModelKinDynWrapper::updateDynamicsVariableState(UpdateMode updateMo
         return false;
     }
 
+    m_genForcesGeneration = m_stateGeneration;
+    return true;
+}
+
+bool RDE::SubModelKinDynWrapper::ensureFTJacobian(const std::string& ftName) const
+{
+    constexpr auto logPrefix = "[BipedalLocomotion::Estimators::SubModelKinDynWrapper::"
+                               "ensureFTJacobian]";
+
+    if (m_jacFTGeneration[ftName] == m_stateGeneration)
+    {
+        return true;
+    }
+
     // The jacobians are computed wrt the base of the submodel
     // (floating base with known pos and vel thanks to the kinematics)
-    for (auto & [key, value] : m_subModel.getFTList())
+    if (!m_kinDyn.getFrameFreeFloatingJacobian(m_subModel.getFTList().at(ftName).frame,
+                                               m_jacFTList[ftName]))
     {
-        if (!m_kinDyn.getFrameFreeFloatingJacobian(value.frame,
-                                                   m_jacFTList[key]))
-        {
-            blf::log()->error("{} Unable to get the compute the free floating jacobian of the "
-                              "frame {}.",
-                              logPrefix,
-                              value.frame);
-            return false;
-        }
+        blf::log()->error("{} Unable to get the compute the free floating jacobian of the "
+                          "frame {}.",
+                          logPrefix,
+                          m_subModel.getFTList().at(ftName).frame);
+        return false;
     }
 
-    // Update external contact jacobians
-    for (int idx = 0; idx < m_subModel.getExternalContactList().size(); idx++)
+    m_jacFTGeneration[ftName] = m_stateGeneration;
+    return true;
+}
+
+bool RDE::SubModelKinDynWrapper::ensureExtContactJacobian(const std::string& extContactName) const
+{
+    constexpr auto logPrefix = "[BipedalLocomotion::Estimators::SubModelKinDynWrapper::"
+                               "ensureExtContactJacobian]";
+
+    if (m_jacContactGeneration[extContactName] == m_stateGeneration)
     {
-        if (!m_kinDyn.getFrameFreeFloatingJacobian(m_subModel.getExternalContactList()[idx],
-                                                   m_jacContactList
-                                                   [m_subModel.getExternalContactList()[idx]]))
-        {
-            blf::log()->error("{} Unable to get the compute the free floating jacobian of the "
-                              "frame {}.",
-                              logPrefix,
-                              m_subModel.getExternalContactList()[idx]);
-            return false;
-        }
+        return true;
     }
 
-    if (updateMode == UpdateMode::Full)
+    if (!m_kinDyn.getFrameFreeFloatingJacobian(extContactName,
+                                               m_jacContactList[extContactName]))
     {
-        // Update accelerometer jacobians, dJnu, rotMatrix
-        for (auto & [key, value] : m_subModel.getAccelerometerList())
-        {
-            // Update jacobian
-            if (!m_kinDyn
-                    .getFrameFreeFloatingJacobian(value.frame, m_jacAccList[key]))
-            {
-                blf::log()->error("{} Unable to get the compute the free floating jacobian of the "
-                                  "frame {}.",
-                                  logPrefix,
-                                  value.frame);
-                return false;
-            }
-
-            // Update dJnu
-            m_dJnuList[key] = iDynTree::toEigen(
-                        m_kinDyn.getFrameBiasAcc(value.frame));
-
-            // Update rotMatrix
-            m_accRworldList[key] = blf::Conversions::toManifRot(
-                        m_kinDyn.getWorldTransform(value.frame)
-                        .getRotation()
-                        .inverse());
-
-            // Update accelerometer velocity
-            m_accVelList[key] = iDynTree::toEigen(
-                        m_kinDyn.getFrameVel(value.frame));
-        }
+        blf::log()->error("{} Unable to get the compute the free floating jacobian of the "
+                          "frame {}.",
+                          logPrefix,
+                          extContactName);
+        return false;
+    }
 
-        // Update gyroscope jacobians
-        for (auto & [key, value] : m_subModel.getGyroscopeList())
-        {
-            if (!m_kinDyn.getFrameFreeFloatingJacobian(value.frame,
-                                                       m_jacGyroList[key]))
-            {
-                blf::log()->error("{} Unable to get the compute the free floating jacobian of the "
-                                  "frame {}.",
-                                  logPrefix,
-                                  value.frame);
-                return false;
-            }
-        }
+    m_jacContactGeneration[extContactName] = m_stateGeneration;
+    return true;
+}
+
+bool RDE::SubModelKinDynWrapper::ensureAccelerometerJacobian(const std::string& accName) const
+{
+    constexpr auto logPrefix = "[BipedalLocomotion::Estimators::SubModelKinDynWrapper::"
+                               "ensureAccelerometerJacobian]";
+
+    if (m_jacAccGeneration[accName] == m_stateGeneration)
+    {
+        return true;
+    }
+
+    if (!m_kinDyn.getFrameFreeFloatingJacobian(m_subModel.getAccelerometerList().at(accName).frame,
+                                               m_jacAccList[accName]))
+    {
+        blf::log()->error("{} Unable to get the compute the free floating jacobian of the "
+                          "frame {}.",
+                          logPrefix,
+                          m_subModel.getAccelerometerList().at(accName).frame);
+        return false;
     }
 
+    m_jacAccGeneration[accName] = m_stateGeneration;
+    return true;
+}
+
+bool RDE::SubModelKinDynWrapper::ensureGyroscopeJacobian(const std::string& gyroName) const
+{
+    constexpr auto logPrefix = "[BipedalLocomotion::Estimators::SubModelKinDynWrapper::"
+                               "ensureGyroscopeJacobian]";
+
+    if (m_jacGyroGeneration[gyroName] == m_stateGeneration)
+    {
+        return true;
+    }
+
+    if (!m_kinDyn.getFrameFreeFloatingJacobian(m_subModel.getGyroscopeList().at(gyroName).frame,
+                                               m_jacGyroList[gyroName]))
+    {
+        blf::log()->error("{} Unable to get the compute the free floating jacobian of the "
+                          "frame {}.",
+                          logPrefix,
+                          m_subModel.getGyroscopeList().at(gyroName).frame);
+        return false;
+    }
+
+    m_jacGyroGeneration[gyroName] = m_stateGeneration;
+    return true;
+}
+
+bool RDE::SubModelKinDynWrapper::ensureAccelerometerBiasAcceleration(const std::string& accName) const
+{
+    if (m_dJnuGeneration[accName] == m_stateGeneration)
+    {
+        return true;
+    }
+
+    m_dJnuList[accName] = iDynTree::toEigen(
+                m_kinDyn.getFrameBiasAcc(m_subModel.getAccelerometerList().at(accName).frame));
+
+    m_dJnuGeneration[accName] = m_stateGeneration;
+    return true;
+}
+
+bool RDE::SubModelKinDynWrapper::ensureAccelerometerRotation(const std::string& accName) const
+{
+    if (m_accRworldGeneration[accName] == m_stateGeneration)
+    {
+        return true;
+    }
+
+    m_accRworldList[accName] = blf::Conversions::toManifRot(
+                m_kinDyn.getWorldTransform(m_subModel.getAccelerometerList().at(accName).frame)
+                .getRotation()
+                .inverse());
+
+    m_accRworldGeneration[accName] = m_stateGeneration;
+    return true;
+}
+
+bool RDE::SubModelKinDynWrapper::ensureAccelerometerVelocity(const std::string& accName) const
+{
+    if (m_accVelGeneration[accName] == m_stateGeneration)
+    {
+        return true;
+    }
+
+    m_accVelList[accName] = iDynTree::toEigen(
+                m_kinDyn.getFrameVel(m_subModel.getAccelerometerList().at(accName).frame));
+
+    m_accVelGeneration[accName] = m_stateGeneration;
     return true;
 }
 
@@ -292,6 +453,11 @@ bool RDE::SubModelKinDynWrapper::forwardDynamics(Eigen::Ref<Eigen::VectorXd> mot
         return false;
     }
 
+    if (!ensureMassMatrix() || !ensureGeneralizedForces())
+    {
+        return false;
+    }
+
     m_FTranspose = m_massMatrix.block(6, 0, m_numOfJoints, 6);
     m_H = m_massMatrix.block(6, 6, m_numOfJoints, m_numOfJoints);
 
@@ -327,52 +493,61 @@ const std::string& RDE::SubModelKinDynWrapper::getBaseFrameName() const
 
 const Eigen::Ref<const Eigen::MatrixXd> RDE::SubModelKinDynWrapper::getMassMatrix() const
 {
+    ensureMassMatrix();
     return m_massMatrix;
 }
 
 const Eigen::Ref<const Eigen::VectorXd> RDE::SubModelKinDynWrapper::getGeneralizedForces() const
 {
+    ensureGeneralizedForces();
     return m_genForces;
 }
 
 const Eigen::Ref<const Eigen::MatrixXd>
 RDE::SubModelKinDynWrapper::getFTJacobian(const std::string& ftName) const
 {
+    ensureFTJacobian(ftName);
     return m_jacFTList.at(ftName);
 }
 
 const Eigen::Ref<const Eigen::MatrixXd>
 RDE::SubModelKinDynWrapper::getAccelerometerJacobian(const std::string& accName) const
 {
+    ensureAccelerometerJacobian(accName);
     return m_jacAccList.at(accName);
 }
 
 const Eigen::Ref<const Eigen::MatrixXd>
 RDE::SubModelKinDynWrapper::getGyroscopeJacobian(const std::string& gyroName) const
 {
+    ensureGyroscopeJacobian(gyroName);
     return m_jacGyroList.at(gyroName);
 }
 
 const Eigen::Ref<const Eigen::MatrixXd>
 RDE::SubModelKinDynWrapper::getExtContactJacobian(const std::string& extContactName) const
 {
+    ensureExtContactJacobian(extContactName);
     return m_jacContactList.at(extContactName);
 }
 
 const Eigen::Ref<const Eigen::VectorXd>
 RDE::SubModelKinDynWrapper::getAccelerometerBiasAcceleration(const std::string& accName) const
 {
+    ensureAccelerometerBiasAcceleration(accName);
     return m_dJnuList.at(accName);
 }
 
 const manif::SO3d&
 RDE::SubModelKinDynWrapper::getAccelerometerRotation(const std::string& accName) const
 {
+    ensureAccelerometerRotation(accName);
     return m_accRworldList.at(accName);
 }
 
 const manif::SE3d::Tangent&
 RDE::SubModelKinDynWrapper::getAccelerometerVelocity(const std::string& accName)
 {
+    ensureAccelerometerVelocity(accName);
     return m_accVelList[accName];
 }
@@ -5,9 +5,11 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <algorithm>
 #include <map>
 
 #include <BipedalLocomotion/Math/Constants.h>
+#include <BipedalLocomotion/System/ParallelTaskGroupUpdater.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 #include <BipedalLocomotion/RobotDynamicsEstimator/FrictionTorqueStateDynamics.h>
@@ -31,63 +33,133 @@ struct RDE::UkfState::Impl
 
     Eigen::MatrixXd covarianceQ; /**< Covariance matrix. */
     Eigen::MatrixXd initialCovariance; /**< Initial covariance matrix. */
+    std::vector<Eigen::Index> covarianceBlockSizes; /**< Sizes of the diagonal blocks of the
+                                                       covariance matrix, one per dynamics, in
+                                                       state order. */
     std::size_t stateSize; /**< Length of the state vector. */
     std::chrono::nanoseconds dT; /**< Sampling time */
 
-    std::vector<std::pair<std::string, std::shared_ptr<Dynamics>>> dynamicsList; /**< List of the
-                                                                                    dynamics
-                                                                                    composing the
-                                                                                    process model.
-                                                                                  */
-
     System::VariablesHandler stateVariableHandler; /**< Variable handler describing the state
                                                       vector. */
 
-    std::shared_ptr<iDynTree::KinDynComputations> kinDynFullModel; /**< KinDynComputation object for
-                                                                      the full model. */
     std::vector<SubModel> subModelList; /**< List of SubModel object describing the sub-models
                                            composing the full model. */
-    std::vector<std::shared_ptr<SubModelKinDynWrapper>> kinDynWrapperList; /**< List of
-                                                                              SubModelKinDynWrapper
-                                                                              objects containing
-                                                                              kinematic and dynamic
-                                                                              information specific
-                                                                              of each sub-model. */
 
     std::shared_ptr<const UkfInputProvider> ukfInputProvider; /**< Provider containing the updated
                                                                  robot state. */
     UKFInput ukfInput; /**< Struct containing the inputs for the ukf populated by the
                           ukfInputProvider. */
 
-    Eigen::VectorXd jointVelocityState; /**< Joint velocity computed by the ukf. */
-    Eigen::VectorXd jointAccelerationState; /**< Joint acceleration computed from forward dynamics
-                                               which depends on the current ukf state. */
-    Eigen::VectorXd currentState; /**< State estimated in the previous step. */
-    Eigen::VectorXd nextState; /**< Vector containing all the updated states. */
-
-    std::vector<Eigen::VectorXd> subModelJointVel; /**< List of sub-model joint velocities. */
-    std::vector<Eigen::VectorXd> subModelJointAcc; /**< List of sub-model joint accelerations. */
-    std::vector<Eigen::VectorXd> subModelJointMotorTorque; /**< List of sub-model joint motor
-                                                              torques. */
-    std::vector<Eigen::VectorXd> subModelFrictionTorque; /**< List of sub-model friction torques. */
-    std::map<std::string, Math::Wrenchd> FTMap; /**< The map contains names of the ft sensors and
-                                                   values of the wrench */
-    std::map<std::string, Math::Wrenchd> extContactMap; /**< The map contains names of the ft
-                                                           sensors and values of the wrench */
-    manif::SE3d::Tangent tempSubModelBaseAcc; /**< Acceleration of the base of the sub-model. */
-
-    // Support variables
-    std::vector<Eigen::VectorXd> totalTorqueFromContacts; /**< Joint torques due to known and
-                                                             unknown contacts on the sub-model. */
-    std::vector<Eigen::VectorXd> torqueFromContact; /**< Joint torques due to a specific contact. */
-    Math::Wrenchd wrench; /**< Joint torques due to a specific contact. */
-
     bool updateRobotDynamicsOnly{true};
 
-    void unpackState()
+    /**
+     * Set of objects and buffers needed to propagate one sigma point. The calling thread and each
+     * worker thread own a private context (with their own KinDynComputations,
+     * SubModelKinDynWrapper and Dynamics instances) so that the sigma points can be propagated
+     * concurrently without sharing non-thread-safe resources.
+     */
+    struct PropagationContext
+    {
+        std::shared_ptr<iDynTree::KinDynComputations> kinDynFullModel; /**< KinDynComputation
+                                                                          object for the full
+                                                                          model. */
+        std::vector<std::shared_ptr<SubModelKinDynWrapper>> kinDynWrapperList; /**< List of
+                                                                                  SubModelKinDynWrapper
+                                                                                  objects containing
+                                                                                  kinematic and
+                                                                                  dynamic
+                                                                                  information
+                                                                                  specific of each
+                                                                                  sub-model. */
+        std::vector<std::pair<std::string, std::shared_ptr<Dynamics>>> dynamicsList; /**< List of
+                                                                                        the dynamics
+                                                                                        composing
+                                                                                        the process
+                                                                                        model. */
+        UKFInput ukfInput; /**< Struct containing the inputs for the ukf. */
+
+        Eigen::VectorXd jointVelocityState; /**< Joint velocity computed by the ukf. */
+        Eigen::VectorXd jointAccelerationState; /**< Joint acceleration computed from forward
+                                                   dynamics which depends on the current ukf
+                                                   state. */
+        Eigen::VectorXd currentState; /**< State estimated in the previous step. */
+        Eigen::VectorXd nextState; /**< Vector containing all the updated states. */
+
+        std::vector<Eigen::VectorXd> subModelJointVel; /**< List of sub-model joint velocities. */
+        std::vector<Eigen::VectorXd> subModelJointAcc; /**< List of sub-model joint
+                                                          accelerations. */
+        std::vector<Eigen::VectorXd> subModelJointMotorTorque; /**< List of sub-model joint motor
+                                                                  torques. */
+        std::vector<Eigen::VectorXd> subModelFrictionTorque; /**< List of sub-model friction
+                                                                torques. */
+        std::map<std::string, Math::Wrenchd> FTMap; /**< The map contains names of the ft sensors
+                                                       and values of the wrench */
+        std::map<std::string, Math::Wrenchd> extContactMap; /**< The map contains names of the ft
+                                                               sensors and values of the wrench */
+        manif::SE3d::Tangent tempSubModelBaseAcc; /**< Acceleration of the base of the
+                                                     sub-model. */
+
+        // Support variables
+        std::vector<Eigen::VectorXd> totalTorqueFromContacts; /**< Joint torques due to known and
+                                                                 unknown contacts on the
+                                                                 sub-model. */
+        std::vector<Eigen::VectorXd> torqueFromContact; /**< Joint torques due to a specific
+                                                           contact. */
+        Math::Wrenchd wrench; /**< Joint torques due to a specific contact. */
+    };
+
+    PropagationContext primaryContext; /**< Context used by the calling thread. */
+    std::vector<PropagationContext> workerContexts; /**< Contexts owned by the worker threads. */
+    int numberOfThreads{1}; /**< Number of threads propagating the sigma points. */
+    System::ParallelTaskGroupUpdater parallelUpdater; /**< Persistent worker pool propagating the
+                                                         sigma points concurrently. */
+
+    bool parallelSubModelUpdate{false}; /**< Refresh the sub-model dynamics concurrently. */
+    bool useSubModelUpdater{false}; /**< True when the sub-model worker pool is active. */
+    System::ParallelTaskGroupUpdater subModelUpdater; /**< Persistent worker pool refreshing the
+                                                         sub-model dynamics concurrently. */
+
+    const double* curStatesData{nullptr}; /**< Sigma points propagated in the current call. */
+    double* propStatesData{nullptr}; /**< Propagated sigma points of the current call. */
+    Eigen::Index samplesRows{0}; /**< Number of rows of the sigma-point matrix. */
+    Eigen::Index samplesCols{0}; /**< Number of columns of the sigma-point matrix. */
+
+    void resizeContextBuffers(PropagationContext& context)
     {
-        jointVelocityState = currentState.segment(stateVariableHandler.getVariable("ds").offset,
-                                                  stateVariableHandler.getVariable("ds").size);
+        context.jointVelocityState.resize(context.kinDynFullModel->model().getNrOfDOFs());
+        context.jointAccelerationState.resize(context.kinDynFullModel->model().getNrOfDOFs());
+
+        context.subModelJointVel.clear();
+        context.subModelJointAcc.clear();
+        context.subModelJointMotorTorque.clear();
+        context.subModelFrictionTorque.clear();
+        context.totalTorqueFromContacts.clear();
+        context.torqueFromContact.clear();
+        for (int idx = 0; idx < subModelList.size(); idx++)
+        {
+            context.subModelJointVel.emplace_back(subModelList[idx].getModel().getNrOfDOFs());
+            context.subModelJointAcc.emplace_back(subModelList[idx].getModel().getNrOfDOFs());
+            context.subModelJointMotorTorque.emplace_back(
+                subModelList[idx].getModel().getNrOfDOFs());
+            context.subModelFrictionTorque.emplace_back(
+                subModelList[idx].getModel().getNrOfDOFs());
+            context.totalTorqueFromContacts.emplace_back(
+                subModelList[idx].getModel().getNrOfDOFs());
+            context.torqueFromContact.emplace_back(subModelList[idx].getModel().getNrOfDOFs());
+        }
+
+        context.currentState.resize(stateSize);
+        context.currentState.setZero();
+
+        context.nextState.resize(stateSize);
+        context.nextState.setZero();
+    }
+
+    void unpackState(PropagationContext& context)
+    {
+        context.jointVelocityState
+            = context.currentState.segment(stateVariableHandler.getVariable("ds").offset,
+                                           stateVariableHandler.getVariable("ds").size);
 
         for (int subModelIdx = 0; subModelIdx < subModelList.size(); subModelIdx++)
         {
@@ -96,28 +168,32 @@ struct RDE::UkfState::Impl
             for (int jointIdx = 0; jointIdx < subModelList[subModelIdx].getModel().getNrOfDOFs();
                  jointIdx++)
             {
-                subModelJointVel[subModelIdx](jointIdx)
-                    = jointVelocityState(subModelList[subModelIdx].getJointMapping()[jointIdx]);
-
-                subModelJointMotorTorque[subModelIdx](jointIdx)
-                    = currentState[stateVariableHandler.getVariable("tau_m").offset
-                                   + subModelList[subModelIdx].getJointMapping()[jointIdx]];
-
-                subModelFrictionTorque[subModelIdx](jointIdx)
-                    = currentState[stateVariableHandler.getVariable("tau_F").offset
-                                   + subModelList[subModelIdx].getJointMapping()[jointIdx]];
+                context.subModelJointVel[subModelIdx](jointIdx)
+                    = context.jointVelocityState(
+                        subModelList[subModelIdx].getJointMapping()[jointIdx]);
+
+                context.subModelJointMotorTorque[subModelIdx](jointIdx)
+                    = context.currentState[stateVariableHandler.getVariable("tau_m").offset
+                                           + subModelList[subModelIdx]
+                                                 .getJointMapping()[jointIdx]];
+
+                context.subModelFrictionTorque[subModelIdx](jointIdx)
+                    = context.currentState[stateVariableHandler.getVariable("tau_F").offset
+                                           + subModelList[subModelIdx]
+                                                 .getJointMapping()[jointIdx]];
             }
 
             for (const auto& [key, value] : subModelList[subModelIdx].getFTList())
             {
-                FTMap[key] = currentState.segment(stateVariableHandler.getVariable(key).offset,
-                                                  stateVariableHandler.getVariable(key).size);
+                context.FTMap[key]
+                    = context.currentState.segment(stateVariableHandler.getVariable(key).offset,
+                                                   stateVariableHandler.getVariable(key).size);
             }
 
             for (int idx = 0; idx < subModelList[subModelIdx].getNrOfExternalContact(); idx++)
             {
-                extContactMap[subModelList[subModelIdx].getExternalContact(idx)]
-                    = currentState
+                context.extContactMap[subModelList[subModelIdx].getExternalContact(idx)]
+                    = context.currentState
                           .segment(stateVariableHandler
                                        .getVariable(
                                            subModelList[subModelIdx].getExternalContact(idx))
@@ -130,67 +206,114 @@ struct RDE::UkfState::Impl
         }
     }
 
-    bool updateState()
+    bool updateState(PropagationContext& context)
     {
         // Update kindyn full model
-        kinDynFullModel->setRobotState(ukfInput.robotBasePose.transform(),
-                                       ukfInput.robotJointPositions,
-                                       iDynTree::make_span(ukfInput.robotBaseVelocity.data(),
-                                                           manif::SE3d::Tangent::DoF),
-                                       jointVelocityState,
-                                       gravity);
-
-        // compute joint acceleration per each sub-model
+        context.kinDynFullModel->setRobotState(context.ukfInput.robotBasePose.transform(),
+                                               context.ukfInput.robotJointPositions,
+                                               iDynTree::make_span(context.ukfInput
+                                                                       .robotBaseVelocity.data(),
+                                                                   manif::SE3d::Tangent::DoF),
+                                               context.jointVelocityState,
+                                               gravity);
+
+        // read the full-model state into each sub-model wrapper. This phase touches the shared
+        // full-model KinDynComputations object, hence it runs serially
         for (int subModelIdx = 0; subModelIdx < subModelList.size(); subModelIdx++)
         {
-            // Update the kindyn wrapper object of the submodel
-            kinDynWrapperList[subModelIdx]->updateState(ukfInput.robotBaseAcceleration,
-                                                        jointAccelerationState,
-                                                        UpdateMode::RobotDynamicsOnly);
+            if (!context.kinDynWrapperList[subModelIdx]->updateFullModelState())
+            {
+                log()->error("Cannot update the state of the sub-model {}.", subModelIdx);
+                return false;
+            }
+        }
+
+        // refresh the sub-model dynamics (mass matrix, bias forces and jacobians). The sub-models
+        // share no mutable state by construction, so this dominant cost is spread across the
+        // worker pool when the parallel sub-model update is enabled. update() acts as a barrier,
+        // the dynamics below consume the refreshed quantities only after it returns
+        if (useSubModelUpdater && (&context == &primaryContext))
+        {
+            if (!subModelUpdater.update())
+            {
+                log()->error("Cannot update the dynamics of the sub-models.");
+                return false;
+            }
+        } else
+        {
+            for (int subModelIdx = 0; subModelIdx < subModelList.size(); subModelIdx++)
+            {
+                if (!context.kinDynWrapperList[subModelIdx]
+                         ->updateSubModelState(UpdateMode::RobotDynamicsOnly))
+                {
+                    log()->error("Cannot update the dynamics of the sub-model {}.", subModelIdx);
+                    return false;
+                }
+            }
+        }
+
+        // compute joint acceleration per each sub-model. This phase keeps the original sub-model
+        // ordering since the base acceleration of a sub-model depends on the joint accelerations
+        // computed for the preceding ones
+        for (int subModelIdx = 0; subModelIdx < subModelList.size(); subModelIdx++)
+        {
+            if (!context.kinDynWrapperList[subModelIdx]
+                     ->updateBaseAcceleration(context.ukfInput.robotBaseAcceleration,
+                                              context.jointAccelerationState))
+            {
+                log()->error("Cannot update the base acceleration of the sub-model {}.",
+                             subModelIdx);
+                return false;
+            }
 
             if (subModelList[subModelIdx].getModel().getNrOfDOFs() > 0)
             {
-                totalTorqueFromContacts[subModelIdx].setZero();
+                context.totalTorqueFromContacts[subModelIdx].setZero();
 
                 // Contribution of FT measurements
                 for (const auto& [key, value] : subModelList[subModelIdx].getFTList())
                 {
-                    wrench.noalias() = static_cast<int>(value.forceDirection) * FTMap[key];
+                    context.wrench.noalias()
+                        = static_cast<int>(value.forceDirection) * context.FTMap[key];
 
-                    torqueFromContact[subModelIdx].noalias()
-                        = kinDynWrapperList[subModelIdx]
+                    context.torqueFromContact[subModelIdx].noalias()
+                        = context.kinDynWrapperList[subModelIdx]
                               ->getFTJacobian(key)
                               .block(0, 6, 6, subModelList[subModelIdx].getModel().getNrOfDOFs())
                               .transpose()
-                          * wrench;
+                          * context.wrench;
 
-                    totalTorqueFromContacts[subModelIdx]
-                        = totalTorqueFromContacts[subModelIdx] + torqueFromContact[subModelIdx];
+                    context.totalTorqueFromContacts[subModelIdx]
+                        = context.totalTorqueFromContacts[subModelIdx]
+                          + context.torqueFromContact[subModelIdx];
                 }
 
                 // Contribution of unknown external contacts
                 for (int idx = 0; idx < subModelList[subModelIdx].getNrOfExternalContact(); idx++)
                 {
-                    torqueFromContact[subModelIdx].noalias()
-                        = kinDynWrapperList[subModelIdx]
+                    context.torqueFromContact[subModelIdx].noalias()
+                        = context.kinDynWrapperList[subModelIdx]
                               ->getExtContactJacobian(
                                   subModelList[subModelIdx].getExternalContact(idx))
                               .block(0, 6, 6, subModelList[subModelIdx].getModel().getNrOfDOFs())
                               .transpose()
-                          * extContactMap[subModelList[subModelIdx].getExternalContact(idx)];
+                          * context.extContactMap[subModelList[subModelIdx].getExternalContact(
+                              idx)];
 
-                    totalTorqueFromContacts[subModelIdx]
-                        = totalTorqueFromContacts[subModelIdx] + torqueFromContact[subModelIdx];
+                    context.totalTorqueFromContacts[subModelIdx]
+                        = context.totalTorqueFromContacts[subModelIdx]
+                          + context.torqueFromContact[subModelIdx];
                 }
 
-                tempSubModelBaseAcc = kinDynWrapperList[subModelIdx]->getBaseAcceleration();
+                context.tempSubModelBaseAcc
+                    = context.kinDynWrapperList[subModelIdx]->getBaseAcceleration();
 
-                if (!kinDynWrapperList[subModelIdx]
-                         ->forwardDynamics(subModelJointMotorTorque[subModelIdx],
-                                           subModelFrictionTorque[subModelIdx],
-                                           totalTorqueFromContacts[subModelIdx],
-                                           tempSubModelBaseAcc.coeffs(),
-                                           subModelJointAcc[subModelIdx]))
+                if (!context.kinDynWrapperList[subModelIdx]
+                         ->forwardDynamics(context.subModelJointMotorTorque[subModelIdx],
+                                           context.subModelFrictionTorque[subModelIdx],
+                                           context.totalTorqueFromContacts[subModelIdx],
+                                           context.tempSubModelBaseAcc.coeffs(),
+                                           context.subModelJointAcc[subModelIdx]))
                 {
                     log()->error("Cannot compute the inverse dynamics.");
                     return false;
@@ -201,14 +324,67 @@ struct RDE::UkfState::Impl
                      jointIdx < subModelList[subModelIdx].getJointMapping().size();
                      jointIdx++)
                 {
-                    jointAccelerationState[subModelList[subModelIdx].getJointMapping()[jointIdx]]
-                        = subModelJointAcc[subModelIdx][jointIdx];
+                    context.jointAccelerationState[subModelList[subModelIdx]
+                                                       .getJointMapping()[jointIdx]]
+                        = context.subModelJointAcc[subModelIdx][jointIdx];
                 }
             }
         }
 
         return true;
     }
+
+    bool propagateSamples(PropagationContext& context,
+                          const Eigen::Index& firstSample,
+                          const Eigen::Index& stride)
+    {
+        constexpr auto logPrefix = "[UkfState::propagate]";
+
+        Eigen::Map<const Eigen::MatrixXd> curStates(curStatesData, samplesRows, samplesCols);
+        Eigen::Map<Eigen::MatrixXd> propStates(propStatesData, samplesRows, samplesCols);
+
+        for (Eigen::Index sample = firstSample; sample < samplesCols; sample += stride)
+        {
+            context.currentState = curStates.col(sample);
+
+            unpackState(context);
+
+            if (!updateState(context))
+            {
+                log()->error("{} The joint accelerations are not updated.", logPrefix);
+                return false;
+            }
+
+            context.ukfInput.robotJointAccelerations = context.jointAccelerationState;
+
+            for (int indexDyn = 0; indexDyn < context.dynamicsList.size(); indexDyn++)
+            {
+                context.dynamicsList[indexDyn].second->setState(context.currentState);
+
+                context.dynamicsList[indexDyn].second->setInput(context.ukfInput);
+
+                if (!context.dynamicsList[indexDyn].second->update())
+                {
+                    log()->error("{} Cannot update the dynamics with name `{}`.",
+                                 logPrefix,
+                                 context.dynamicsList[indexDyn].first);
+                    return false;
+                }
+
+                context.nextState.segment(stateVariableHandler
+                                              .getVariable(context.dynamicsList[indexDyn].first)
+                                              .offset,
+                                          stateVariableHandler
+                                              .getVariable(context.dynamicsList[indexDyn].first)
+                                              .size)
+                    = context.dynamicsList[indexDyn].second->getUpdatedVariable();
+            }
+
+            propStates.col(sample) = context.nextState;
+        }
+
+        return true;
+    }
 };
 
 RDE::UkfState::UkfState()
@@ -235,6 +411,23 @@ bool RDE::UkfState::initialize(std::weak_ptr<const ParametersHandler::IParameter
         return false;
     }
 
+    if (!ptr->getParameter("number_of_threads", m_pimpl->numberOfThreads))
+    {
+        m_pimpl->numberOfThreads = 1;
+    }
+
+    if (m_pimpl->numberOfThreads < 1)
+    {
+        log()->error("{} The parameter `number_of_threads` must be a positive integer.",
+                     logPrefix);
+        return false;
+    }
+
+    if (!ptr->getParameter("parallel_submodel_update", m_pimpl->parallelSubModelUpdate))
+    {
+        m_pimpl->parallelSubModelUpdate = false;
+    }
+
     m_pimpl->isInitialized = true;
 
     return true;
@@ -255,17 +448,32 @@ bool RDE::UkfState::finalize(const System::VariablesHandler& handler)
     m_pimpl->stateSize = 0;
 
     // finalize all the dynamics
-    for (int indexDyn1 = 0; indexDyn1 < m_pimpl->dynamicsList.size(); indexDyn1++)
+    for (int indexDyn1 = 0; indexDyn1 < m_pimpl->primaryContext.dynamicsList.size(); indexDyn1++)
     {
-        if (!m_pimpl->dynamicsList[indexDyn1].second->finalize(handler))
+        if (!m_pimpl->primaryContext.dynamicsList[indexDyn1].second->finalize(handler))
         {
             log()->error("{} Error while finalizing the dynamics named {}",
                          logPrefix,
-                         m_pimpl->dynamicsList[indexDyn1].first);
+                         m_pimpl->primaryContext.dynamicsList[indexDyn1].first);
             return false;
         }
 
-        m_pimpl->stateSize += m_pimpl->dynamicsList[indexDyn1].second->size();
+        m_pimpl->stateSize += m_pimpl->primaryContext.dynamicsList[indexDyn1].second->size();
+    }
+
+    // finalize the dynamics cloned in the worker contexts
+    for (auto& context : m_pimpl->workerContexts)
+    {
+        for (int indexDyn = 0; indexDyn < context.dynamicsList.size(); indexDyn++)
+        {
+            if (!context.dynamicsList[indexDyn].second->finalize(handler))
+            {
+                log()->error("{} Error while finalizing the dynamics named {}",
+                             logPrefix,
+                             context.dynamicsList[indexDyn].first);
+                return false;
+            }
+        }
     }
 
     // Set value of process covariance matrix
@@ -275,45 +483,100 @@ bool RDE::UkfState::finalize(const System::VariablesHandler& handler)
     m_pimpl->initialCovariance.resize(m_pimpl->stateSize, m_pimpl->stateSize);
     m_pimpl->initialCovariance.setZero();
 
-    for (int indexDyn2 = 0; indexDyn2 < m_pimpl->dynamicsList.size(); indexDyn2++)
+    for (int indexDyn2 = 0; indexDyn2 < m_pimpl->primaryContext.dynamicsList.size(); indexDyn2++)
     {
         m_pimpl->covarianceQ
-            .block(handler.getVariable(m_pimpl->dynamicsList[indexDyn2].first).offset,
-                   handler.getVariable(m_pimpl->dynamicsList[indexDyn2].first).offset,
-                   handler.getVariable(m_pimpl->dynamicsList[indexDyn2].first).size,
-                   handler.getVariable(m_pimpl->dynamicsList[indexDyn2].first).size)
-            = m_pimpl->dynamicsList[indexDyn2].second->getCovariance().asDiagonal();
+            .block(handler.getVariable(m_pimpl->primaryContext.dynamicsList[indexDyn2].first)
+                       .offset,
+                   handler.getVariable(m_pimpl->primaryContext.dynamicsList[indexDyn2].first)
+                       .offset,
+                   handler.getVariable(m_pimpl->primaryContext.dynamicsList[indexDyn2].first).size,
+                   handler.getVariable(m_pimpl->primaryContext.dynamicsList[indexDyn2].first).size)
+            = m_pimpl->primaryContext.dynamicsList[indexDyn2]
+                  .second->getCovariance()
+                  .asDiagonal();
 
         m_pimpl->initialCovariance
-            .block(handler.getVariable(m_pimpl->dynamicsList[indexDyn2].first).offset,
-                   handler.getVariable(m_pimpl->dynamicsList[indexDyn2].first).offset,
-                   handler.getVariable(m_pimpl->dynamicsList[indexDyn2].first).size,
-                   handler.getVariable(m_pimpl->dynamicsList[indexDyn2].first).size)
-            = m_pimpl->dynamicsList[indexDyn2].second->getInitialStateCovariance().asDiagonal();
+            .block(handler.getVariable(m_pimpl->primaryContext.dynamicsList[indexDyn2].first)
+                       .offset,
+                   handler.getVariable(m_pimpl->primaryContext.dynamicsList[indexDyn2].first)
+                       .offset,
+                   handler.getVariable(m_pimpl->primaryContext.dynamicsList[indexDyn2].first).size,
+                   handler.getVariable(m_pimpl->primaryContext.dynamicsList[indexDyn2].first).size)
+            = m_pimpl->primaryContext.dynamicsList[indexDyn2]
+                  .second->getInitialStateCovariance()
+                  .asDiagonal();
     }
 
-    m_pimpl->jointVelocityState.resize(m_pimpl->kinDynFullModel->model().getNrOfDOFs());
-    m_pimpl->jointAccelerationState.resize(m_pimpl->kinDynFullModel->model().getNrOfDOFs());
+    // the covariance is block-diagonal by construction, one block per dynamics. Store the block
+    // partition in state order so that a block-structured square-root prediction can factorize the
+    // blocks independently
+    std::vector<std::pair<std::ptrdiff_t, Eigen::Index>> covarianceBlocks;
+    for (int indexDyn3 = 0; indexDyn3 < m_pimpl->primaryContext.dynamicsList.size(); indexDyn3++)
+    {
+        const auto& variable
+            = handler.getVariable(m_pimpl->primaryContext.dynamicsList[indexDyn3].first);
+        covarianceBlocks.emplace_back(variable.offset, variable.size);
+    }
+    std::sort(covarianceBlocks.begin(), covarianceBlocks.end());
+
+    m_pimpl->covarianceBlockSizes.clear();
+    for (const auto& [offset, size] : covarianceBlocks)
+    {
+        m_pimpl->covarianceBlockSizes.push_back(size);
+    }
 
-    for (int idx = 0; idx < m_pimpl->subModelList.size(); idx++)
+    m_pimpl->resizeContextBuffers(m_pimpl->primaryContext);
+    for (auto& context : m_pimpl->workerContexts)
     {
-        m_pimpl->subModelJointVel.emplace_back(m_pimpl->subModelList[idx].getModel().getNrOfDOFs());
-        m_pimpl->subModelJointAcc.emplace_back(m_pimpl->subModelList[idx].getModel().getNrOfDOFs());
-        m_pimpl->subModelJointMotorTorque.emplace_back(
-            m_pimpl->subModelList[idx].getModel().getNrOfDOFs());
-        m_pimpl->subModelFrictionTorque.emplace_back(
-            m_pimpl->subModelList[idx].getModel().getNrOfDOFs());
-        m_pimpl->totalTorqueFromContacts.emplace_back(
-            m_pimpl->subModelList[idx].getModel().getNrOfDOFs());
-        m_pimpl->torqueFromContact.emplace_back(
-            m_pimpl->subModelList[idx].getModel().getNrOfDOFs());
+        m_pimpl->resizeContextBuffers(context);
     }
 
-    m_pimpl->currentState.resize(m_pimpl->stateSize);
-    m_pimpl->currentState.setZero();
+    // set up the persistent worker pool propagating the sigma points. The calling thread
+    // propagates its share of the sigma points through the primary context, while each worker
+    // thread propagates an interleaved share through its own context
+    if (m_pimpl->numberOfThreads > 1)
+    {
+        std::vector<std::vector<System::ParallelTaskGroupUpdater::UpdateFunction>> groups;
+        groups.push_back({[impl = m_pimpl.get()]() {
+            return impl->propagateSamples(impl->primaryContext, 0, impl->numberOfThreads);
+        }});
+        for (int threadIdx = 1; threadIdx < m_pimpl->numberOfThreads; threadIdx++)
+        {
+            groups.push_back({[impl = m_pimpl.get(), threadIdx]() {
+                return impl->propagateSamples(impl->workerContexts[threadIdx - 1],
+                                              threadIdx,
+                                              impl->numberOfThreads);
+            }});
+        }
+        m_pimpl->parallelUpdater.setGroups(std::move(groups));
+    }
 
-    m_pimpl->nextState.resize(m_pimpl->stateSize);
-    m_pimpl->nextState.setZero();
+    // set up the persistent worker pool refreshing the sub-model dynamics concurrently. The
+    // sigma-point parallelism takes precedence since the two worker pools cannot be nested
+    m_pimpl->useSubModelUpdater = false;
+    if (m_pimpl->parallelSubModelUpdate)
+    {
+        if (m_pimpl->numberOfThreads > 1)
+        {
+            log()->warn("{} The parameter `parallel_submodel_update` is ignored when "
+                        "`number_of_threads` is greater than 1.",
+                        logPrefix);
+        } else if (m_pimpl->subModelList.size() > 1)
+        {
+            std::vector<std::vector<System::ParallelTaskGroupUpdater::UpdateFunction>> groups;
+            for (std::size_t subModelIdx = 0; subModelIdx < m_pimpl->subModelList.size();
+                 subModelIdx++)
+            {
+                groups.push_back({[impl = m_pimpl.get(), subModelIdx]() {
+                    return impl->primaryContext.kinDynWrapperList[subModelIdx]
+                        ->updateSubModelState(UpdateMode::RobotDynamicsOnly);
+                }});
+            }
+            m_pimpl->subModelUpdater.setGroups(std::move(groups));
+            m_pimpl->useSubModelUpdater = true;
+        }
+    }
 
     m_pimpl->isFinalized = true;
 
@@ -357,15 +620,51 @@ RDE::UkfState::build(std::weak_ptr<const ParametersHandler::IParametersHandler>
     }
 
     // Set KinDynComputation for the full model
-    state->m_pimpl->kinDynFullModel = kinDynFullModel;
+    state->m_pimpl->primaryContext.kinDynFullModel = kinDynFullModel;
 
     // Set the list of SubModel
     state->m_pimpl->subModelList.reserve(subModelList.size());
     state->m_pimpl->subModelList = subModelList;
 
     // set the list of SubModelKinDynWrapper
-    state->m_pimpl->kinDynWrapperList.reserve(kinDynWrapperList.size());
-    state->m_pimpl->kinDynWrapperList = kinDynWrapperList;
+    state->m_pimpl->primaryContext.kinDynWrapperList.reserve(kinDynWrapperList.size());
+    state->m_pimpl->primaryContext.kinDynWrapperList = kinDynWrapperList;
+
+    // create the propagation contexts owned by the worker threads. Each context clones the full
+    // model KinDynComputations object and the SubModelKinDynWrapper objects since they are not
+    // thread-safe
+    if (state->m_pimpl->numberOfThreads > 1)
+    {
+        state->m_pimpl->workerContexts.resize(state->m_pimpl->numberOfThreads - 1);
+        for (auto& context : state->m_pimpl->workerContexts)
+        {
+            context.kinDynFullModel = std::make_shared<iDynTree::KinDynComputations>();
+            if (!context.kinDynFullModel->loadRobotModel(kinDynFullModel->model()))
+            {
+                log()->error("{} Unable to clone the full model KinDynComputations object.",
+                             logPrefix);
+                return nullptr;
+            }
+            context.kinDynFullModel->setFrameVelocityRepresentation(
+                kinDynFullModel->getFrameVelocityRepresentation());
+
+            context.kinDynWrapperList.reserve(kinDynWrapperList.size());
+            for (int idx = 0; idx < subModelList.size(); idx++)
+            {
+                auto kinDynWrapperClone = std::make_shared<SubModelKinDynWrapper>();
+                if (!kinDynWrapperClone->setKinDyn(context.kinDynFullModel)
+                    || !kinDynWrapperClone->initialize(subModelList[idx]))
+                {
+                    log()->error("{} Unable to clone the SubModelKinDynWrapper object of the "
+                                 "sub-model {}.",
+                                 logPrefix,
+                                 idx);
+                    return nullptr;
+                }
+                context.kinDynWrapperList.push_back(kinDynWrapperClone);
+            }
+        }
+    }
 
     // per each dynamics add variable to the variableHandler
     // and add the dynamics to the list
@@ -424,7 +723,28 @@ RDE::UkfState::build(std::weak_ptr<const ParametersHandler::IParametersHandler>
         dynamicsInstance->initialize(dynamicsGroup);
 
         // add dynamics to the list
-        state->m_pimpl->dynamicsList.emplace_back(dynamicsName, dynamicsInstance);
+        state->m_pimpl->primaryContext.dynamicsList.emplace_back(dynamicsName, dynamicsInstance);
+
+        // clone the dynamics in the worker contexts, binding each clone to the
+        // SubModelKinDynWrapper objects of its context
+        for (auto& context : state->m_pimpl->workerContexts)
+        {
+            std::shared_ptr<Dynamics> dynamicsClone
+                = RDE::DynamicsFactory::createInstance(dynamicModel);
+            if (dynamicsClone == nullptr)
+            {
+                log()->error("{} The dynamic model '{}' has not been registered.",
+                             logPrefix,
+                             dynamicModel);
+                return nullptr;
+            }
+
+            dynamicsClone->setSubModels(subModelList, context.kinDynWrapperList);
+
+            dynamicsClone->initialize(dynamicsGroup);
+
+            context.dynamicsList.emplace_back(dynamicsName, dynamicsClone);
+        }
     }
 
     // finalize estimator
@@ -475,45 +795,32 @@ void RDE::UkfState::propagate(const Eigen::Ref<const Eigen::MatrixXd>& curStates
 
     propStates.resize(curStates.rows(), curStates.cols());
 
-    for (int sample = 0; sample < curStates.cols(); sample++)
-    {
-        m_pimpl->currentState = curStates.block(0, sample, curStates.rows(), 1);
+    m_pimpl->curStatesData = curStates.data();
+    m_pimpl->propStatesData = propStates.data();
+    m_pimpl->samplesRows = curStates.rows();
+    m_pimpl->samplesCols = curStates.cols();
 
-        m_pimpl->unpackState();
+    m_pimpl->primaryContext.ukfInput = m_pimpl->ukfInput;
 
-        if (!m_pimpl->updateState())
+    if (m_pimpl->numberOfThreads <= 1)
+    {
+        if (!m_pimpl->propagateSamples(m_pimpl->primaryContext, 0, 1))
         {
-            log()->error("{} The joint accelerations are not updated.", logPrefix);
             throw std::runtime_error("Error");
         }
+        return;
+    }
 
-        m_pimpl->ukfInput.robotJointAccelerations = m_pimpl->jointAccelerationState;
-
-        // TODO (ines) Investigate if the following code can be parallelized
-        for (int indexDyn = 0; indexDyn < m_pimpl->dynamicsList.size(); indexDyn++)
-        {
-            m_pimpl->dynamicsList[indexDyn].second->setState(m_pimpl->currentState);
-
-            m_pimpl->dynamicsList[indexDyn].second->setInput(m_pimpl->ukfInput);
-
-            if (!m_pimpl->dynamicsList[indexDyn].second->update())
-            {
-                log()->error("{} Cannot update the dynamics with name `{}`.",
-                             logPrefix,
-                             m_pimpl->dynamicsList[indexDyn].first);
-                throw std::runtime_error("Error");
-            }
-
-            m_pimpl->nextState.segment(m_pimpl->stateVariableHandler
-                                           .getVariable(m_pimpl->dynamicsList[indexDyn].first)
-                                           .offset,
-                                       m_pimpl->stateVariableHandler
-                                           .getVariable(m_pimpl->dynamicsList[indexDyn].first)
-                                           .size)
-                = m_pimpl->dynamicsList[indexDyn].second->getUpdatedVariable();
-        }
+    for (auto& context : m_pimpl->workerContexts)
+    {
+        context.ukfInput = m_pimpl->ukfInput;
+    }
 
-        propStates.block(0, sample, curStates.rows(), 1) = m_pimpl->nextState;
+    // propagate the sigma points concurrently. Each thread works on its own context, so the
+    // dominant forward-dynamics cost scales across the cores
+    if (!m_pimpl->parallelUpdater.update())
+    {
+        throw std::runtime_error("Error");
     }
 }
 
@@ -527,6 +834,11 @@ std::size_t RDE::UkfState::getStateSize() const
     return m_pimpl->stateSize;
 }
 
+const std::vector<Eigen::Index>& RDE::UkfState::getCovarianceBlockSizes() const
+{
+    return m_pimpl->covarianceBlockSizes;
+}
+
 Eigen::Ref<const Eigen::MatrixXd> RDE::UkfState::getInitialStateCovarianceMatrix()
 {
     return m_pimpl->initialCovariance;
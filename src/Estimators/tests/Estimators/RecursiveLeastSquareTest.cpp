@@ -118,3 +118,96 @@ TEST_CASE("Recursive Least Square")
     REQUIRE(relativeError1 < admissibleError);
     REQUIRE(relativeError2 < admissibleError);
 }
+
+TEST_CASE("Recursive Least Square with sliding window")
+{
+    // instantiate model
+    Eigen::Vector2d parameters;
+    parameters(0) = 43.2;
+    parameters(1) = 12.2;
+
+    std::shared_ptr<IParametersHandler> parameterHandler = std::make_shared<StdImplementation>();
+    parameterHandler->setParameter("lambda", 1.0);
+    parameterHandler->setParameter("measurement_covariance", std::vector<double>{0.5, 0.5});
+    parameterHandler->setParameter("state", std::vector<double>{0.0, 0.0});
+    parameterHandler->setParameter("state_covariance", std::vector<double>{10.0, 10.0});
+
+    SECTION("Equivalence with the classic formulation")
+    {
+        // when the window is longer than the number of processed samples no sample is evicted,
+        // therefore the windowed estimator is equivalent to the classic one with unitary
+        // forgetting factor
+        Model model(parameters);
+        Model windowedModel(parameters);
+
+        RecursiveLeastSquare estimator;
+        REQUIRE(estimator.initialize(parameterHandler));
+
+        parameterHandler->setParameter("window_size", 1000);
+
+        RecursiveLeastSquare windowedEstimator;
+        REQUIRE(windowedEstimator.initialize(parameterHandler));
+
+        estimator.setRegressorFunction(std::bind(&Model::regressor, &model));
+        windowedEstimator.setRegressorFunction(std::bind(&Model::regressor, &windowedModel));
+
+        for (int i = 0; i < 300; i++)
+        {
+            model.setX(std::cos(i / 10.0));
+            windowedModel.setX(std::cos(i / 10.0));
+
+            estimator.setMeasurements(model.getOutput());
+            windowedEstimator.setMeasurements(windowedModel.getOutput());
+
+            REQUIRE(estimator.advance());
+            REQUIRE(windowedEstimator.advance());
+        }
+
+        REQUIRE(windowedEstimator.getOutput().expectedValue.isApprox(
+            estimator.getOutput().expectedValue, 1e-6));
+        REQUIRE(windowedEstimator.getOutput().covariance.isApprox( //
+            estimator.getOutput().covariance, 1e-6));
+    }
+
+    SECTION("Batched ingestion")
+    {
+        Model model(parameters);
+
+        parameterHandler->setParameter("window_size", 500);
+
+        RecursiveLeastSquare estimator;
+        REQUIRE(estimator.initialize(parameterHandler));
+
+        // the samples are ingested in bursts as if they were collected by a sensor bridge
+        // running at a rate higher than the one of the estimation loop
+        constexpr int samplesInBatch = 10;
+        constexpr int numberOfBatches = 1000;
+
+        Eigen::MatrixXd regressors(2 * samplesInBatch, 2);
+        Eigen::MatrixXd measurements(2, samplesInBatch);
+
+        for (int i = 0; i < numberOfBatches; i++)
+        {
+            for (int j = 0; j < samplesInBatch; j++)
+            {
+                model.setX(std::cos((i * samplesInBatch + j) / 10.0));
+                regressors.middleRows<2>(2 * j) = model.regressor();
+                measurements.col(j) = model.getOutput();
+            }
+
+            REQUIRE(estimator.advanceBatch(regressors, measurements));
+        }
+
+        // since only the last 500 samples contribute to the estimate, the admissible error is
+        // larger than the one of the classic test
+        constexpr double admissibleError = 2.0 / 100.0;
+
+        // compute the relative error of the parameters
+        const auto& state = estimator.getOutput();
+        double relativeError1 = std::abs((state.expectedValue(0) - parameters(0)) / parameters(0));
+        double relativeError2 = std::abs((state.expectedValue(1) - parameters(1)) / parameters(1));
+
+        REQUIRE(relativeError1 < admissibleError);
+        REQUIRE(relativeError2 < admissibleError);
+    }
+}
@@ -0,0 +1,393 @@
+/**
+ * @file BaseEstimatorsBenchmarkTest.cpp
+ * @authors Prashanth Ramadoss
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+// std
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <Eigen/Dense>
+
+// BipedalLocomotion
+#include <BipedalLocomotion/FloatingBaseEstimators/InvariantEKFBaseEstimator.h>
+#include <BipedalLocomotion/FloatingBaseEstimators/LeggedOdometry.h>
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+#include <iDynTree/KinDynComputations.h>
+#include <iDynTree/ModelIO/ModelLoader.h>
+
+#include <iCubModels/iCubModels.h>
+
+#include <matioCpp/matioCpp.h>
+
+using namespace BipedalLocomotion::Estimators;
+using namespace BipedalLocomotion::ParametersHandler;
+
+namespace
+{
+
+/** Environment variable pointing to a mat file produced by YarpRobotLoggerDevice. When it is not
+ * set the benchmark replays a synthetic double-support trajectory. */
+constexpr auto logPathEnvVariable = "BLF_ESTIMATORS_BENCHMARK_LOG";
+
+/** Environment variable pointing to the urdf of the logged robot. When it is not set the
+ * iCubGazeboV2_5_plus model is used. */
+constexpr auto modelPathEnvVariable = "BLF_ESTIMATORS_BENCHMARK_MODEL";
+
+/** Sensor stream replayed through the estimators, either loaded from a recorded log or generated
+ * synthetically. Each measurement matrix stores one sample per column. */
+struct SensorLog
+{
+    std::vector<std::string> jointsList;
+    Eigen::MatrixXd jointPositions;
+    Eigen::MatrixXd jointVelocities;
+    Eigen::MatrixXd accelerometer;
+    Eigen::MatrixXd gyroscope;
+    double samplingPeriod{0.01};
+};
+
+inline double deg2rad(const double& ang)
+{
+    return ang * (M_PI / 180);
+}
+
+Eigen::MatrixXd toSampleMatrix(const matioCpp::Variable& channel)
+{
+    const auto data = channel.asStruct()["data"].asMultiDimensionalArray<double>();
+    REQUIRE(data.isValid());
+
+    // robometry stores each sample as a d1 x d2 slice, the last dimension spans the samples
+    const auto dimensions = data.dimensions();
+    REQUIRE(dimensions.size() == 3);
+
+    const Eigen::Index rows = dimensions[0] * dimensions[1];
+    const Eigen::Index samples = dimensions[2];
+
+    return Eigen::Map<const Eigen::MatrixXd>(data.data(), rows, samples);
+}
+
+std::vector<std::string> toStringVector(const matioCpp::Variable& variable)
+{
+    const auto cells = variable.asCellArray();
+    REQUIRE(cells.isValid());
+
+    std::vector<std::string> strings;
+    for (std::size_t i = 0; i < cells.numberOfElements(); i++)
+    {
+        strings.push_back(cells[i].asString()());
+    }
+    return strings;
+}
+
+SensorLog loadRecordedLog(const std::string& path)
+{
+    SensorLog log;
+
+    matioCpp::File file(path);
+    REQUIRE(file.isOpen());
+
+    const auto logger = file.read("robot_logger_device").asStruct();
+    REQUIRE(logger.isValid());
+
+    const auto jointsState = logger["joints_state"].asStruct();
+    REQUIRE(jointsState.isValid());
+
+    log.jointsList = toStringVector(jointsState["positions"].asStruct()["elements_names"]);
+    log.jointPositions = toSampleMatrix(jointsState["positions"]);
+    log.jointVelocities = toSampleMatrix(jointsState["velocities"]);
+
+    REQUIRE(log.jointPositions.rows() == static_cast<Eigen::Index>(log.jointsList.size()));
+    REQUIRE(log.jointVelocities.rows() == log.jointPositions.rows());
+
+    // the first logged accelerometer and gyroscope are assumed to belong to the base IMU
+    const auto accelerometers = logger["accelerometers"].asStruct();
+    REQUIRE(accelerometers.isValid());
+    log.accelerometer = toSampleMatrix(accelerometers[accelerometers.fields().front()]);
+    REQUIRE(log.accelerometer.rows() == 3);
+
+    const auto gyros = logger["gyros"].asStruct();
+    REQUIRE(gyros.isValid());
+    log.gyroscope = toSampleMatrix(gyros[gyros.fields().front()]);
+    REQUIRE(log.gyroscope.rows() == 3);
+
+    // estimate the sampling period from the encoder timestamps
+    const auto timestamps
+        = jointsState["positions"].asStruct()["timestamps"].asMultiDimensionalArray<double>();
+    REQUIRE(timestamps.isValid());
+    const std::size_t nrOfStamps = timestamps.numberOfElements();
+    if (nrOfStamps > 1)
+    {
+        log.samplingPeriod
+            = (timestamps.data()[nrOfStamps - 1] - timestamps.data()[0]) / (nrOfStamps - 1);
+    }
+
+    return log;
+}
+
+SensorLog generateSyntheticLog(const Eigen::Index nrSamples)
+{
+    SensorLog log;
+    log.jointsList = {"neck_pitch", "neck_roll", "neck_yaw",
+        "torso_pitch", "torso_roll", "torso_yaw",
+        "l_shoulder_pitch", "l_shoulder_roll", "l_shoulder_yaw", "l_elbow",
+        "r_shoulder_pitch", "r_shoulder_roll", "r_shoulder_yaw", "r_elbow",
+        "l_hip_pitch", "l_hip_roll", "l_hip_yaw",
+        "l_knee", "l_ankle_pitch", "l_ankle_roll",
+        "r_hip_pitch", "r_hip_roll", "r_hip_yaw",
+        "r_knee", "r_ankle_pitch", "r_ankle_roll"};
+
+    const Eigen::Index nrJoints = log.jointsList.size();
+    Eigen::VectorXd encoders(nrJoints);
+    encoders << -0.0001, 0.0000, 0.0000,
+    0.1570, 0.0003, -0.0000,
+    -0.0609, 0.4350, 0.1833, 0.5375,
+    -0.0609,    0.4349, 0.1834, 0.5375,
+    0.0895, 0.0090, -0.0027,
+    -0.5694, -0.3771, -0.0211,
+    0.0896, 0.0090, -0.0027,
+    -0.5695, -0.3771, -0.0211;
+
+    log.jointPositions.resize(nrJoints, nrSamples);
+    log.jointVelocities.resize(nrJoints, nrSamples);
+    log.accelerometer.resize(3, nrSamples);
+    log.gyroscope.resize(3, nrSamples);
+
+    // small joint oscillations around the double-support configuration so that the kinematic
+    // updates do not become trivial constant measurements
+    constexpr double amplitude = 0.005;
+    constexpr double angularFrequency = 2 * M_PI * 0.5;
+    for (Eigen::Index i = 0; i < nrSamples; i++)
+    {
+        const double t = i * log.samplingPeriod;
+        for (Eigen::Index j = 0; j < nrJoints; j++)
+        {
+            log.jointPositions(j, i) = encoders(j) + amplitude * std::sin(angularFrequency * t + j);
+            log.jointVelocities(j, i) = amplitude * angularFrequency
+                                        * std::cos(angularFrequency * t + j);
+        }
+
+        log.accelerometer.col(i) << 0.0, -7.9431, -5.7513;
+        log.gyroscope.col(i).setZero();
+    }
+
+    return log;
+}
+
+IParametersHandler::shared_ptr createConfig(const SensorLog& log)
+{
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("sampling_period_in_s", log.samplingPeriod);
+
+    auto modelInfoGroup = std::make_shared<StdImplementation>();
+    handler->setGroup("ModelInfo", modelInfoGroup);
+    modelInfoGroup->setParameter("base_link", "root_link");
+    modelInfoGroup->setParameter("base_link_imu", "root_link_imu_acc");
+    modelInfoGroup->setParameter("left_foot_contact_frame", "l_sole");
+    modelInfoGroup->setParameter("right_foot_contact_frame", "r_sole");
+
+    auto optionsGroup = std::make_shared<StdImplementation>();
+    handler->setGroup("Options", optionsGroup);
+    optionsGroup->setParameter("enable_imu_bias_estimation", false);
+    optionsGroup->setParameter("enable_ekf_update", true);
+
+    // the noise parameters and the initial states refer to the canonical double-support
+    // configuration. When replaying a recorded log they only affect the accuracy of the estimates,
+    // which is not what this benchmark measures.
+    auto sensorsdevGroup = std::make_shared<StdImplementation>();
+    handler->setGroup("SensorsStdDev", sensorsdevGroup);
+    sensorsdevGroup->setParameter("accelerometer_measurement_noise_std_dev", std::vector<double>{0.0382, 0.01548, 0.0042});
+    sensorsdevGroup->setParameter("gyroscope_measurement_noise_std_dev", std::vector<double>{0.0111, 0.0024, 0.0043});
+    sensorsdevGroup->setParameter("contact_foot_linear_velocity_noise_std_dev", std::vector<double>{9e-3, 9.5e-3, 7e-3});
+    sensorsdevGroup->setParameter("contact_foot_angular_velocity_noise_std_dev", std::vector<double>{0.007, 0.0075, 0.004});
+    sensorsdevGroup->setParameter("swing_foot_linear_velocity_noise_std_dev", std::vector<double>{0.05, 0.05, 0.05});
+    sensorsdevGroup->setParameter("swing_foot_angular_velocity_noise_std_dev", std::vector<double>{0.015, 0.015, 0.015});
+    sensorsdevGroup->setParameter("forward_kinematic_measurement_noise_std_dev", std::vector<double>{1e-3, 1e-3, 1e-3, 1e-6, 1e-6, 1e-6});
+    sensorsdevGroup->setParameter("encoders_measurement_noise_std_dev",
+                                  std::vector<double>(log.jointsList.size(), 1e-6));
+
+    auto initStateGroup = std::make_shared<StdImplementation>();
+    handler->setGroup("InitialStates", initStateGroup);
+    initStateGroup->setParameter("imu_orientation_quaternion_wxyz", std::vector<double>{0.3218, -0.6304, -0.6292, 0.3212});
+    initStateGroup->setParameter("l_contact_frame_orientation_quaternion_wxyz", std::vector<double>{1.0000, -0.0059, -0.0001, -0.0015});
+    initStateGroup->setParameter("r_contact_frame_orientation_quaternion_wxyz", std::vector<double>{1.0000, 0.0059, -0.0002, -0.0004});
+    initStateGroup->setParameter("imu_position_xyz", std::vector<double>{0.0296, -0.1439, 0.4915});
+    initStateGroup->setParameter("imu_linear_velocity_xyz", std::vector<double>{0, 0, 0});
+    initStateGroup->setParameter("l_contact_frame_position_xyz", std::vector<double>{0.0791, -0.0817, 0.0109});
+    initStateGroup->setParameter("r_contact_frame_position_xyz", std::vector<double>{0.0788, -0.2282, 0.0109});
+
+    auto priordevGroup = std::make_shared<StdImplementation>();
+    handler->setGroup("PriorsStdDev", priordevGroup);
+    priordevGroup->setParameter("imu_orientation", std::vector<double>{deg2rad(10), deg2rad(10), deg2rad(1)});
+    priordevGroup->setParameter("imu_position", std::vector<double>{1e-3, 1e-3, 1e-3});
+    priordevGroup->setParameter("imu_linear_velocity", std::vector<double>{0.075, 0.05, 0.05});
+    priordevGroup->setParameter("l_contact_frame_orientation", std::vector<double>{deg2rad(10), deg2rad(10), deg2rad(10)});
+    priordevGroup->setParameter("l_contact_frame_position", std::vector<double>{1e-3, 1e-3, 1e-3});
+    priordevGroup->setParameter("r_contact_frame_orientation", std::vector<double>{deg2rad(10), deg2rad(10), deg2rad(10)});
+    priordevGroup->setParameter("r_contact_frame_position", std::vector<double>{1e-3, 1e-3, 1e-3});
+
+    auto loGroup = std::make_shared<StdImplementation>();
+    handler->setGroup("LeggedOdom", loGroup);
+    loGroup->setParameter("initial_fixed_frame", "l_sole");
+    loGroup->setParameter("switching_pattern", "latest");
+    loGroup->setParameter("vel_computation_method", "multiLS");
+
+    return handler;
+}
+
+std::chrono::nanoseconds median(std::vector<std::chrono::nanoseconds> samples)
+{
+    const std::size_t index = samples.size() / 2;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+void printReport(const std::string& name,
+                 const Eigen::Index nrSamples,
+                 const std::chrono::nanoseconds& total,
+                 const std::chrono::nanoseconds& ingestionMedian,
+                 const std::chrono::nanoseconds& advanceMedian,
+                 const double samplingPeriod)
+{
+    const double seconds = std::chrono::duration<double>(total).count();
+    const double stepsPerSecond = nrSamples / seconds;
+
+    BipedalLocomotion::log()->info("[benchmark_FloatingBaseEstimators] {}: {} steps in {:.3f} s "
+                                   "({:.0f} steps/s, {:.1f}x realtime), ingestion median = {} us, "
+                                   "advance() median = {} us",
+                                   name,
+                                   nrSamples,
+                                   seconds,
+                                   stepsPerSecond,
+                                   stepsPerSecond * samplingPeriod,
+                                   std::chrono::duration_cast<std::chrono::microseconds>(
+                                       ingestionMedian)
+                                       .count(),
+                                   std::chrono::duration_cast<std::chrono::microseconds>(
+                                       advanceMedian)
+                                       .count());
+}
+
+} // namespace
+
+TEST_CASE("FloatingBaseEstimators benchmark")
+{
+    SensorLog log;
+    const char* logPath = std::getenv(logPathEnvVariable);
+    if (logPath != nullptr)
+    {
+        log = loadRecordedLog(logPath);
+    } else
+    {
+        log = generateSyntheticLog(2000);
+    }
+
+    const char* customModelPath = std::getenv(modelPathEnvVariable);
+    const std::string modelPath = (customModelPath != nullptr)
+                                      ? std::string(customModelPath)
+                                      : iCubModels::getModelFile("iCubGazeboV2_5_plus");
+
+    iDynTree::ModelLoader loader;
+    REQUIRE(loader.loadReducedModelFromFile(modelPath, log.jointsList));
+
+    const Eigen::Index nrSamples = std::min({log.jointPositions.cols(),
+                                             log.jointVelocities.cols(),
+                                             log.accelerometer.cols(),
+                                             log.gyroscope.cols()});
+    REQUIRE(nrSamples > 0);
+
+    const std::chrono::nanoseconds dt{std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>(log.samplingPeriod))};
+
+    Eigen::VectorXd encoders(log.jointPositions.rows());
+    Eigen::VectorXd encoderSpeeds(log.jointVelocities.rows());
+
+    std::vector<std::chrono::nanoseconds> ingestionLatencies, advanceLatencies;
+    ingestionLatencies.reserve(nrSamples);
+    advanceLatencies.reserve(nrSamples);
+
+    SECTION("LeggedOdometry")
+    {
+        auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+        REQUIRE(kinDyn->loadRobotModel(loader.model()));
+
+        LeggedOdometry estimator;
+        REQUIRE(estimator.initialize(createConfig(log), kinDyn));
+
+        std::chrono::nanoseconds timeNow{std::chrono::nanoseconds::zero()};
+
+        const auto replayStart = std::chrono::steady_clock::now();
+        for (Eigen::Index i = 0; i < nrSamples; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            encoders = log.jointPositions.col(i);
+            encoderSpeeds = log.jointVelocities.col(i);
+            bool ok = estimator.setKinematics(encoders, encoderSpeeds);
+            ok = ok && estimator.setContactStatus("l_sole", true, timeNow, timeNow);
+            ok = ok && estimator.setContactStatus("r_sole", true, timeNow, timeNow);
+            ingestionLatencies.push_back(std::chrono::steady_clock::now() - start);
+
+            start = std::chrono::steady_clock::now();
+            ok = ok && estimator.advance();
+            advanceLatencies.push_back(std::chrono::steady_clock::now() - start);
+
+            REQUIRE(ok);
+            timeNow += dt;
+        }
+        const auto total = std::chrono::steady_clock::now() - replayStart;
+
+        printReport("LeggedOdometry",
+                    nrSamples,
+                    total,
+                    median(std::move(ingestionLatencies)),
+                    median(std::move(advanceLatencies)),
+                    log.samplingPeriod);
+    }
+
+    SECTION("InvariantEKFBaseEstimator")
+    {
+        auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+        REQUIRE(kinDyn->loadRobotModel(loader.model()));
+
+        InvariantEKFBaseEstimator estimator;
+        REQUIRE(estimator.initialize(createConfig(log), kinDyn));
+
+        const auto replayStart = std::chrono::steady_clock::now();
+        for (Eigen::Index i = 0; i < nrSamples; i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            encoders = log.jointPositions.col(i);
+            encoderSpeeds = log.jointVelocities.col(i);
+            bool ok = estimator.setIMUMeasurement(log.accelerometer.col(i), log.gyroscope.col(i));
+            ok = ok && estimator.setContacts(true, true);
+            ok = ok && estimator.setKinematics(encoders, encoderSpeeds);
+            ingestionLatencies.push_back(std::chrono::steady_clock::now() - start);
+
+            start = std::chrono::steady_clock::now();
+            ok = ok && estimator.advance();
+            advanceLatencies.push_back(std::chrono::steady_clock::now() - start);
+
+            REQUIRE(ok);
+        }
+        const auto total = std::chrono::steady_clock::now() - replayStart;
+
+        printReport("InvariantEKFBaseEstimator",
+                    nrSamples,
+                    total,
+                    median(std::move(ingestionLatencies)),
+                    median(std::move(advanceLatencies)),
+                    log.samplingPeriod);
+    }
+}
@@ -109,4 +109,14 @@ TEST_CASE("Bare Bones Base Estimator")
         REQUIRE(estimator.advance());
     }
 
+    // bind the measurement buffers once and advance through the zero-copy path
+    REQUIRE(estimator.bindIMUMeasurement(acc.data(), gyro.data()));
+    REQUIRE(estimator.bindKinematics(encoders.data(), encoder_speeds.data(), joints_list.size()));
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.signalMeasurementsUpdated();
+        REQUIRE(estimator.setContacts(lf_contact, rf_contact));
+        REQUIRE(estimator.advance());
+    }
+    estimator.unbindMeasurements();
 }
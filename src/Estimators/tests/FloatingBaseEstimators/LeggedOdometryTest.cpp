@@ -0,0 +1,179 @@
+/**
+ * @file LeggedOdometryTest.cpp
+ * @authors Prashanth Ramadoss
+ * @copyright 2020 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/FloatingBaseEstimators/LeggedOdometry.h>
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+#include <iDynTree/ModelIO/ModelLoader.h>
+
+#include <iCubModels/iCubModels.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+using namespace BipedalLocomotion::Estimators;
+using namespace BipedalLocomotion::ParametersHandler;
+
+// global allocation counter used to verify that the steady-state estimator
+// pipeline does not perform any dynamic memory allocation.
+// counting is enabled only around the measured loop to avoid
+// accounting for allocations made by the test framework itself.
+static std::atomic<bool> g_countingEnabled{false};
+static std::atomic<std::int64_t> g_allocationCount{0};
+
+static void* countedAlloc(std::size_t size)
+{
+    if (g_countingEnabled.load(std::memory_order_relaxed))
+    {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    void* ptr = std::malloc(size > 0 ? size : 1);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+static void* countedAlignedAlloc(std::size_t size, std::size_t alignment)
+{
+    if (g_countingEnabled.load(std::memory_order_relaxed))
+    {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // std::aligned_alloc requires the size to be a multiple of the alignment
+    std::size_t paddedSize = ((size + alignment - 1) / alignment) * alignment;
+    void* ptr = std::aligned_alloc(alignment, paddedSize > 0 ? paddedSize : alignment);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void* operator new(std::size_t size, std::align_val_t al) { return countedAlignedAlloc(size, static_cast<std::size_t>(al)); }
+void* operator new[](std::size_t size, std::align_val_t al) { return countedAlignedAlloc(size, static_cast<std::size_t>(al)); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+bool populateConfig(std::weak_ptr<IParametersHandler> handler)
+{
+    auto handle = handler.lock();
+    if (handle == nullptr) {return false;}
+    handle->setParameter("sampling_period_in_s", 0.01);
+
+    auto modelInfoGroup = std::make_shared<StdImplementation>();
+    handle->setGroup("ModelInfo", modelInfoGroup);
+    modelInfoGroup->setParameter("base_link", "root_link");
+    modelInfoGroup->setParameter("base_link_imu", "root_link_imu_acc");
+    modelInfoGroup->setParameter("left_foot_contact_frame", "l_sole");
+    modelInfoGroup->setParameter("right_foot_contact_frame", "r_sole");
+
+    auto loGroup = std::make_shared<StdImplementation>();
+    handle->setGroup("LeggedOdom", loGroup);
+    loGroup->setParameter("initial_fixed_frame", "l_sole");
+    loGroup->setParameter("switching_pattern", "latest");
+    loGroup->setParameter("vel_computation_method", "multiLS");
+
+    return true;
+}
+
+TEST_CASE("Legged Odometry allocation-free steady state")
+{
+    std::shared_ptr<StdImplementation> originalHandler = std::make_shared<StdImplementation>();
+    IParametersHandler::shared_ptr parameterHandler = originalHandler;
+
+    // Populate the input configuration to be passed to the estimator
+    REQUIRE(populateConfig(parameterHandler));
+
+    // Load the reduced iDynTree model to be passed to the estimator
+    const std::string model_path = iCubModels::getModelFile("iCubGazeboV2_5_plus");
+    std::vector<std::string> joints_list = {"neck_pitch", "neck_roll", "neck_yaw",
+        "torso_pitch", "torso_roll", "torso_yaw",
+        "l_shoulder_pitch", "l_shoulder_roll", "l_shoulder_yaw", "l_elbow",
+        "r_shoulder_pitch", "r_shoulder_roll", "r_shoulder_yaw", "r_elbow",
+        "l_hip_pitch", "l_hip_roll", "l_hip_yaw",
+        "l_knee", "l_ankle_pitch", "l_ankle_roll",
+        "r_hip_pitch", "r_hip_roll", "r_hip_yaw",
+        "r_knee", "r_ankle_pitch", "r_ankle_roll"};
+
+    iDynTree::ModelLoader mdl_ldr;
+    REQUIRE(mdl_ldr.loadReducedModelFromFile(model_path, joints_list));
+
+    auto model = mdl_ldr.model().copy();
+
+    auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    kinDyn->loadRobotModel(model);
+
+    // Instantiate the estimator
+    LeggedOdometry estimator;
+    REQUIRE(estimator.initialize(parameterHandler, kinDyn));
+
+    // kinematic measures
+    Eigen::VectorXd encoders(joints_list.size()), encoder_speeds(joints_list.size());
+    encoders << -0.0001, 0.0000, 0.0000,
+    0.1570, 0.0003, -0.0000,
+    -0.0609, 0.4350, 0.1833, 0.5375,
+    -0.0609,    0.4349, 0.1834, 0.5375,
+    0.0895, 0.0090, -0.0027,
+    -0.5694, -0.3771, -0.0211,
+    0.0896, 0.0090, -0.0027,
+    -0.5695, -0.3771, -0.0211;
+
+    encoder_speeds.setZero();
+
+    std::chrono::nanoseconds timeNow{std::chrono::nanoseconds::zero()};
+    const std::chrono::nanoseconds dt{std::chrono::milliseconds(10)};
+
+    // warm-up phase: let the estimator reach its steady state so that
+    // all the internal buffers are sized
+    for (int i = 0; i < 50; i++)
+    {
+        REQUIRE(estimator.setKinematics(encoders, encoder_speeds));
+        REQUIRE(estimator.setContactStatus("l_sole", true, timeNow, timeNow));
+        REQUIRE(estimator.setContactStatus("r_sole", true, timeNow, timeNow));
+        REQUIRE(estimator.advance());
+        timeNow += dt;
+    }
+
+    // measured phase: the steady-state measurement pipeline must not allocate.
+    // the contact configuration does not change, so the contact states set
+    // during the warm-up phase remain valid.
+    // note: Catch2 assertions may allocate, so failures are only accumulated
+    // inside the loop and checked once counting is disabled
+    bool ok{true};
+    g_allocationCount.store(0);
+    g_countingEnabled.store(true);
+    for (int i = 0; i < 100; i++)
+    {
+        ok = ok && estimator.setKinematics(encoders, encoder_speeds);
+        ok = ok && estimator.advance();
+        timeNow += dt;
+    }
+    g_countingEnabled.store(false);
+
+    REQUIRE(ok);
+    REQUIRE(g_allocationCount.load() == 0);
+}
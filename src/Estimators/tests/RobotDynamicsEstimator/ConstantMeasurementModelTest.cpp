@@ -74,4 +74,20 @@ TEST_CASE("Constant Measurement Model")
     Eigen::VectorXd ftPre = state.segment(variableHandler.getVariable("r_leg_ft").offset, variableHandler.getVariable("r_leg_ft").size);
 
     REQUIRE((ftPre+bias).isApprox(updatedVariable));
+
+    // the batched update must match the per-sigma-point update
+    constexpr Eigen::Index numberOfSigmaPoints = 7;
+    Eigen::MatrixXd sigmaPoints
+        = Eigen::MatrixXd::Random(state.size(), numberOfSigmaPoints);
+    Eigen::MatrixXd batchedVariables(ft.size(), numberOfSigmaPoints);
+
+    std::vector<UKFInput> inputs(1);
+    REQUIRE(ft.updateBatch(sigmaPoints, inputs, batchedVariables));
+
+    for (Eigen::Index sample = 0; sample < numberOfSigmaPoints; sample++)
+    {
+        ft.setState(sigmaPoints.col(sample));
+        REQUIRE(ft.update());
+        REQUIRE(batchedVariables.col(sample).isApprox(ft.getUpdatedVariable()));
+    }
 }
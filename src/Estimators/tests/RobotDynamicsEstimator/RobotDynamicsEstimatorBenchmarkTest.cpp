@@ -0,0 +1,216 @@
+/**
+ * @file RobotDynamicsEstimatorBenchmarkTest.cpp
+ * @authors Ines Sorrentino
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <ConfigFolderPath.h>
+#include <catch2/catch_test_macros.hpp>
+#include <iCubModels/iCubModels.h>
+#include <yarp/os/ResourceFinder.h>
+
+// BLF
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/ParametersHandler/YarpImplementation.h>
+#include <BipedalLocomotion/System/VariablesHandler.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+// iDynTree
+#include <iDynTree/KinDynComputations.h>
+#include <iDynTree/ModelIO/ModelLoader.h>
+
+// LIBRARYTOTEST
+#include <BipedalLocomotion/RobotDynamicsEstimator/Dynamics.h>
+#include <BipedalLocomotion/RobotDynamicsEstimator/SubModel.h>
+#include <BipedalLocomotion/RobotDynamicsEstimator/SubModelKinDynWrapper.h>
+#include <BipedalLocomotion/RobotDynamicsEstimator/UkfState.h>
+
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion::Estimators::RobotDynamicsEstimator;
+
+IParametersHandler::shared_ptr loadParameterHandler()
+{
+    std::shared_ptr<YarpImplementation> originalHandler = std::make_shared<YarpImplementation>();
+    IParametersHandler::shared_ptr parameterHandler = originalHandler;
+
+    yarp::os::ResourceFinder& rf = yarp::os::ResourceFinder::getResourceFinderSingleton();
+    rf.setDefaultConfigFile("/config/config.ini");
+
+    std::vector<std::string> arguments = {" ", "--from ", getConfigPath()};
+
+    std::vector<char*> argv;
+    for (const auto& arg : arguments)
+        argv.push_back((char*)arg.data());
+    argv.push_back(nullptr);
+
+    rf.configure(argv.size() - 1, argv.data());
+
+    REQUIRE_FALSE(rf.isNull());
+    parameterHandler->clear();
+    REQUIRE(parameterHandler->isEmpty());
+
+    originalHandler->set(rf);
+
+    return parameterHandler;
+}
+
+void createModelLoader(IParametersHandler::weak_ptr group, iDynTree::ModelLoader& mdlLdr)
+{
+    const std::string modelPath = iCubModels::getModelFile("iCubGenova09");
+
+    std::vector<std::string> jointList;
+    REQUIRE(group.lock()->getParameter("joint_list", jointList));
+
+    std::vector<std::string> ftFramesList;
+    auto ftGroup = group.lock()->getGroup("FT").lock();
+    REQUIRE(ftGroup->getParameter("associated_joints", ftFramesList));
+
+    std::vector<std::string> jointsAndFTs;
+    jointsAndFTs.insert(jointsAndFTs.begin(), jointList.begin(), jointList.end());
+    jointsAndFTs.insert(jointsAndFTs.end(), ftFramesList.begin(), ftFramesList.end());
+
+    REQUIRE(mdlLdr.loadReducedModelFromFile(modelPath, jointsAndFTs));
+}
+
+std::chrono::nanoseconds median(std::vector<std::chrono::nanoseconds> samples)
+{
+    const std::size_t index = samples.size() / 2;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+TEST_CASE("RobotDynamicsEstimator UKF benchmark")
+{
+    auto parameterHandler = loadParameterHandler();
+
+    iDynTree::ModelLoader modelLoader;
+    auto modelHandler = parameterHandler->getGroup("MODEL").lock();
+
+    REQUIRE_FALSE(modelHandler == nullptr);
+
+    createModelLoader(modelHandler, modelLoader);
+
+    auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    REQUIRE(kinDyn->loadRobotModel(modelLoader.model()));
+
+    SubModelCreator subModelCreator;
+    subModelCreator.setModelAndSensors(kinDyn->model(), modelLoader.sensors());
+    REQUIRE(subModelCreator.setKinDyn(kinDyn));
+
+    REQUIRE(subModelCreator.createSubModels(modelHandler));
+
+    std::vector<std::shared_ptr<SubModelKinDynWrapper>> kinDynWrapperList;
+
+    const auto& subModelList = subModelCreator.getSubModelList();
+
+    for (int idx = 0; idx < subModelList.size(); idx++)
+    {
+        kinDynWrapperList.emplace_back(std::make_shared<SubModelKinDynWrapper>());
+        REQUIRE(kinDynWrapperList.at(idx)->setKinDyn(kinDyn));
+        REQUIRE(kinDynWrapperList.at(idx)->initialize(subModelList[idx]));
+    }
+
+    // Build the UkfState
+    auto groupUKF = parameterHandler->getGroup("UKF").lock();
+    REQUIRE_FALSE(groupUKF == nullptr);
+
+    auto groupUKFStateTmp = groupUKF->getGroup("UKF_STATE").lock();
+    REQUIRE_FALSE(groupUKFStateTmp == nullptr);
+
+    auto groupUKFState = groupUKFStateTmp->clone();
+    std::chrono::nanoseconds dT;
+    REQUIRE(parameterHandler->getGroup("GENERAL").lock()->getParameter("sampling_time", dT));
+    groupUKFState->setParameter("sampling_time", dT);
+
+    std::unique_ptr<UkfState> stateModel
+        = UkfState::build(groupUKFState, kinDyn, subModelList, kinDynWrapperList);
+
+    // Create an input for the ukf state
+    UKFInput input;
+    input.robotJointPositions = Eigen::VectorXd::Zero(kinDyn->model().getNrOfDOFs());
+    input.robotBasePose = manif::SE3d::Identity();
+    input.robotBaseVelocity.setZero();
+    input.robotBaseAcceleration.setZero();
+
+    for (int idx = 0; idx < subModelList.size(); idx++)
+    {
+        REQUIRE(kinDynWrapperList.at(idx)
+                    ->updateState(input.robotBaseAcceleration,
+                                  Eigen::VectorXd(kinDyn->model().getNrOfDOFs()).setZero(),
+                                  UpdateMode::Full));
+    }
+
+    std::shared_ptr<UkfInputProvider> inputProvider = std::make_shared<UkfInputProvider>();
+    REQUIRE(inputProvider->setInput(input));
+    stateModel->setUkfInputProvider(inputProvider);
+
+    BipedalLocomotion::System::VariablesHandler stateHandler
+        = stateModel->getStateVariableHandler();
+    const int stateSize = stateModel->getStateSize();
+
+    // a static double-support-like state: the propagation cost does not depend on the values of
+    // the state, so a fixed input is representative of a log replay
+    Eigen::VectorXd currentState = Eigen::VectorXd::Zero(stateSize);
+
+    Eigen::VectorXd motorTorques(kinDyn->model().getNrOfDOFs());
+    motorTorques << -1.6298, -1.10202, 0, -0.74, 0.0877, -0.00173;
+    Eigen::VectorXd wrenchFTtLeg(6);
+    wrenchFTtLeg << 0, 0, 100.518, 0.748, 0.91, 0;
+    Eigen::VectorXd wrenchFTFootFront(6);
+    wrenchFTFootFront << 0, 0, 1.761, -0.001, 0.0003, 0;
+    Eigen::VectorXd wrenchFTFootRear(6);
+    wrenchFTFootRear << 0, 0, 1.752, 0.000876, 0.000649, 0;
+
+    currentState.segment(stateHandler.getVariable("tau_m").offset,
+                         stateHandler.getVariable("tau_m").size)
+        = motorTorques;
+    currentState.segment(stateHandler.getVariable("r_leg_ft").offset,
+                         stateHandler.getVariable("r_leg_ft").size)
+        = wrenchFTtLeg;
+    currentState.segment(stateHandler.getVariable("r_foot_front_ft").offset,
+                         stateHandler.getVariable("r_foot_front_ft").size)
+        = wrenchFTFootFront;
+    currentState.segment(stateHandler.getVariable("r_foot_rear_ft").offset,
+                         stateHandler.getVariable("r_foot_rear_ft").size)
+        = wrenchFTFootRear;
+
+    Eigen::VectorXd updatedState(stateSize);
+
+    // warm-up tick so that the lazily allocated internal buffers do not pollute the measurement
+    stateModel->propagate(currentState, updatedState);
+
+    constexpr int numberOfTicks = 100;
+    std::vector<std::chrono::nanoseconds> latencies;
+    latencies.reserve(numberOfTicks);
+
+    const auto replayStart = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < numberOfTicks; tick++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        stateModel->propagate(currentState, updatedState);
+        latencies.push_back(std::chrono::steady_clock::now() - start);
+    }
+    const auto total = std::chrono::steady_clock::now() - replayStart;
+
+    const double seconds = std::chrono::duration<double>(total).count();
+    const double stepsPerSecond = numberOfTicks / seconds;
+    const double realtimeFactor = stepsPerSecond * std::chrono::duration<double>(dT).count();
+
+    BipedalLocomotion::log()->info("[benchmark_RobotDynamicsEstimatorUkf] state propagation: {} "
+                                   "steps in {:.3f} s ({:.0f} steps/s, {:.1f}x realtime), "
+                                   "propagate() median = {} us",
+                                   numberOfTicks,
+                                   seconds,
+                                   stepsPerSecond,
+                                   realtimeFactor,
+                                   std::chrono::duration_cast<std::chrono::microseconds>(
+                                       median(std::move(latencies)))
+                                       .count());
+}
@@ -0,0 +1,189 @@
+/**
+ * @file SqrtUkfPredictionTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <memory>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <Eigen/Dense>
+
+// BayesFilters
+#include <BayesFilters/AdditiveStateModel.h>
+
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/RobotDynamicsEstimator/SqrtUkfPrediction.h>
+
+using namespace BipedalLocomotion::Estimators::RobotDynamicsEstimator;
+using namespace BipedalLocomotion::ParametersHandler;
+
+namespace
+{
+/**
+ * Linear additive state model x' = A x used to validate the square-root prediction: the unscented
+ * transform is exact on linear models, so the predicted covariance must equal A P A^T + Q
+ */
+class LinearStateModel : public bfl::AdditiveStateModel
+{
+public:
+    LinearStateModel(const Eigen::MatrixXd& A, const Eigen::MatrixXd& Q)
+        : m_A(A)
+        , m_Q(Q)
+    {
+    }
+
+    void propagate(const Eigen::Ref<const Eigen::MatrixXd>& curStates,
+                   Eigen::Ref<Eigen::MatrixXd> propStates) override
+    {
+        propStates = m_A * curStates;
+    }
+
+    Eigen::MatrixXd getNoiseCovarianceMatrix() override
+    {
+        return m_Q;
+    }
+
+    bool setProperty(const std::string& property) override
+    {
+        return false;
+    }
+
+    bfl::VectorDescription getStateDescription() override
+    {
+        return bfl::VectorDescription(m_A.rows());
+    }
+
+private:
+    Eigen::MatrixXd m_A;
+    Eigen::MatrixXd m_Q;
+};
+} // namespace
+
+TEST_CASE("SqrtUkfPrediction")
+{
+    constexpr int stateSize = 8;
+
+    // build a random stable linear model with a diagonal process noise
+    Eigen::MatrixXd A = 0.1 * Eigen::MatrixXd::Random(stateSize, stateSize);
+    A.diagonal().array() += 1.0;
+    const Eigen::MatrixXd Q
+        = (0.01 * Eigen::VectorXd::Random(stateSize).cwiseAbs().array() + 1e-4)
+              .matrix()
+              .asDiagonal();
+
+    auto model = std::make_shared<LinearStateModel>(A, Q);
+
+    auto handler = std::make_shared<StdImplementation>();
+    SqrtUkfPrediction prediction;
+    REQUIRE(prediction.initialize(handler));
+    REQUIRE(prediction.setStateModel(model));
+
+    // random symmetric positive definite initial covariance
+    const Eigen::MatrixXd temp = Eigen::MatrixXd::Random(stateSize, stateSize);
+    const Eigen::MatrixXd P
+        = temp * temp.transpose() + 0.1 * Eigen::MatrixXd::Identity(stateSize, stateSize);
+    const Eigen::MatrixXd sqrtP = P.llt().matrixL();
+
+    const Eigen::VectorXd mean = Eigen::VectorXd::Random(stateSize);
+
+    Eigen::VectorXd predictedMean(stateSize);
+    Eigen::MatrixXd predictedSqrtP(stateSize, stateSize);
+    REQUIRE(prediction.predict(mean, sqrtP, predictedMean, predictedSqrtP));
+
+    // on a linear model the prediction is exact
+    constexpr double tolerance = 1e-8;
+    REQUIRE(predictedMean.isApprox(A * mean, tolerance));
+
+    const Eigen::MatrixXd predictedP = predictedSqrtP * predictedSqrtP.transpose();
+    const Eigen::MatrixXd expectedP = A * P * A.transpose() + Q;
+    REQUIRE(predictedP.isApprox(expectedP, tolerance));
+
+    // the factor is lower triangular
+    REQUIRE(predictedSqrtP.triangularView<Eigen::StrictlyUpper>()
+                .toDenseMatrix()
+                .isZero(tolerance));
+
+    // the factor can be carried to the next step
+    Eigen::VectorXd nextMean(stateSize);
+    Eigen::MatrixXd nextSqrtP(stateSize, stateSize);
+    REQUIRE(prediction.predict(predictedMean, predictedSqrtP, nextMean, nextSqrtP));
+    REQUIRE((nextSqrtP * nextSqrtP.transpose())
+                .isApprox(A * expectedP * A.transpose() + Q, tolerance));
+}
+
+TEST_CASE("SqrtUkfPrediction block-diagonal mode")
+{
+    const std::vector<Eigen::Index> blockSizes{3, 5, 2};
+    const Eigen::Index stateSize = 10;
+    std::vector<Eigen::Index> blockOffsets{0, 3, 8};
+
+    // fully coupled linear model with a diagonal process noise
+    Eigen::MatrixXd A = 0.1 * Eigen::MatrixXd::Random(stateSize, stateSize);
+    A.diagonal().array() += 1.0;
+    const Eigen::MatrixXd Q
+        = (0.01 * Eigen::VectorXd::Random(stateSize).cwiseAbs().array() + 1e-4)
+              .matrix()
+              .asDiagonal();
+
+    auto model = std::make_shared<LinearStateModel>(A, Q);
+
+    auto handler = std::make_shared<StdImplementation>();
+    SqrtUkfPrediction prediction;
+    REQUIRE(prediction.initialize(handler));
+
+    // the block structure can be set only after the state model
+    REQUIRE_FALSE(prediction.setBlockStructure(blockSizes));
+    REQUIRE(prediction.setStateModel(model));
+
+    // the block sizes must sum to the state size
+    REQUIRE_FALSE(prediction.setBlockStructure({3, 5, 3}));
+    REQUIRE(prediction.setBlockStructure(blockSizes));
+
+    // block-diagonal initial covariance
+    Eigen::MatrixXd P = Eigen::MatrixXd::Zero(stateSize, stateSize);
+    for (std::size_t b = 0; b < blockSizes.size(); b++)
+    {
+        const Eigen::MatrixXd temp = Eigen::MatrixXd::Random(blockSizes[b], blockSizes[b]);
+        P.block(blockOffsets[b], blockOffsets[b], blockSizes[b], blockSizes[b])
+            = temp * temp.transpose()
+              + 0.1 * Eigen::MatrixXd::Identity(blockSizes[b], blockSizes[b]);
+    }
+    const Eigen::MatrixXd sqrtP = P.llt().matrixL();
+    const Eigen::VectorXd mean = Eigen::VectorXd::Random(stateSize);
+
+    Eigen::VectorXd predictedMean(stateSize);
+    Eigen::MatrixXd predictedSqrtP(stateSize, stateSize);
+    REQUIRE(prediction.predict(mean, sqrtP, predictedMean, predictedSqrtP));
+
+    constexpr double tolerance = 1e-8;
+    REQUIRE(predictedMean.isApprox(A * mean, tolerance));
+
+    // all the sigma points contribute to each block, so the block marginals match the diagonal
+    // blocks of A P A^T + Q even though A couples the blocks
+    const Eigen::MatrixXd predictedP = predictedSqrtP * predictedSqrtP.transpose();
+    const Eigen::MatrixXd expectedP = A * P * A.transpose() + Q;
+    Eigen::MatrixXd offBlock = predictedSqrtP;
+    for (std::size_t b = 0; b < blockSizes.size(); b++)
+    {
+        REQUIRE(predictedP.block(blockOffsets[b], blockOffsets[b], blockSizes[b], blockSizes[b])
+                    .isApprox(expectedP.block(blockOffsets[b],
+                                              blockOffsets[b],
+                                              blockSizes[b],
+                                              blockSizes[b]),
+                              tolerance));
+        offBlock.block(blockOffsets[b], blockOffsets[b], blockSizes[b], blockSizes[b]).setZero();
+    }
+
+    // the carried factor is block-diagonal by construction
+    REQUIRE(offBlock.isZero(tolerance));
+
+    // an empty partition restores the dense mode
+    REQUIRE(prediction.setBlockStructure({}));
+    REQUIRE(prediction.predict(mean, sqrtP, predictedMean, predictedSqrtP));
+    REQUIRE((predictedSqrtP * predictedSqrtP.transpose()).isApprox(expectedP, tolerance));
+}
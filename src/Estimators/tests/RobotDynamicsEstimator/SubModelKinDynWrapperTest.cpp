@@ -318,5 +318,12 @@ TEST_CASE("SubModelKinDynWrapper")
             REQUIRE(jacobianAcc.rows() == 6);
             REQUIRE(jacobianAcc.cols() == 6 + numberOfJoints);
         }
+
+        // the accessors compute lazily: setting a new robot state bumps the generation and is
+        // enough to refresh the quantities, without calling updateSubModelState
+        const auto generation = kinDynSubModel.stateGeneration();
+        REQUIRE(kinDynSubModel.updateFullModelState());
+        REQUIRE(kinDynSubModel.stateGeneration() == generation + 1);
+        REQUIRE(kinDynSubModel.getMassMatrix().rows() == (6 + numberOfJoints));
     }
 }
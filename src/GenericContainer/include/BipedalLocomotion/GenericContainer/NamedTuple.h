@@ -10,7 +10,10 @@
 #ifndef BIPEDAL_LOCOMOTION_GENERIC_CONTAINER_NAMED_TUPLE_H
 #define BIPEDAL_LOCOMOTION_GENERIC_CONTAINER_NAMED_TUPLE_H
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -93,6 +96,58 @@ template <typename... Params> struct named_tuple : public std::tuple<Params...>
     /** Underlying tuple that can be generate from this named_tuple */
     using underlying_tuple = std::tuple<typename Params::Type...>;
 
+    /** Number of elements stored in the named_tuple */
+    static constexpr std::size_t tuple_size = sizeof...(Params);
+
+    /** True when every element type can be copied with std::memcpy. Only in this case the flat
+     * layout metadata and the to_flat_buffer()/from_flat_buffer() marshallers are meaningful. */
+    static constexpr bool is_flat_packable
+        = (std::is_trivially_copyable<typename Params::Type>::value && ...);
+
+    /** Number of bytes required to store the named_tuple in the flat layout, i.e. the sum of the
+     * sizes of the element types without any padding. */
+    static constexpr std::size_t flat_size = (sizeof(typename Params::Type) + ... + 0);
+
+    /**
+     * Get the hashes of the elements of the named_tuple, in declaration order.
+     * @return an array containing the compile time hash of each element.
+     * @note The named_tuple identifies its fields through the compile time hash of their name:
+     * a consumer can resolve hash to name once (e.g. at connection setup) and then rely on the
+     * positional flat layout.
+     */
+    static constexpr std::array<hash_type, tuple_size> hashes() noexcept
+    {
+        return {Params::hash...};
+    }
+
+    /**
+     * Get the size (in bytes) of each element of the named_tuple, in declaration order.
+     * @return an array containing the size of each element type.
+     */
+    static constexpr std::array<std::size_t, tuple_size> flat_sizes() noexcept
+    {
+        return {sizeof(typename Params::Type)...};
+    }
+
+    /**
+     * Get the offset (in bytes) of each element of the named_tuple in the flat layout, in
+     * declaration order. The elements are packed back to back without padding.
+     * @return an array containing the offset of each element.
+     */
+    static constexpr std::array<std::size_t, tuple_size> flat_offsets() noexcept
+    {
+        std::array<std::size_t, tuple_size> offsets{};
+        constexpr std::array<std::size_t, tuple_size> sizes = flat_sizes();
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < tuple_size; i++)
+        {
+            offsets[i] = offset;
+            offset += sizes[i];
+        }
+        return offsets;
+    }
+
     /**
      * Constructor
      */
@@ -209,7 +264,63 @@ template <typename... Params> struct named_tuple : public std::tuple<Params...>
         return temp;
     }
 
+    /**
+     * Pack the named_tuple in a flat buffer. The elements are copied back to back at the offsets
+     * returned by flat_offsets(), so the marshalling reduces to a sequence of memcpy whose sizes
+     * and destinations are known at compile time.
+     * @param buffer pointer to a buffer of at least flat_size bytes.
+     * @note This method is available only if every element type is trivially copyable.
+     */
+    void to_flat_buffer(std::uint8_t* buffer) const noexcept
+    {
+        static_assert(is_flat_packable,
+                      "to_flat_buffer() requires all the element types to be trivially "
+                      "copyable.");
+        this->pack_to_buffer(buffer, std::make_index_sequence<tuple_size>());
+    }
+
+    /**
+     * Unpack the named_tuple from a flat buffer filled by to_flat_buffer().
+     * @param buffer pointer to a buffer of at least flat_size bytes.
+     * @note This method is available only if every element type is trivially copyable.
+     */
+    void from_flat_buffer(const std::uint8_t* buffer) noexcept
+    {
+        static_assert(is_flat_packable,
+                      "from_flat_buffer() requires all the element types to be trivially "
+                      "copyable.");
+        this->unpack_from_buffer(buffer, std::make_index_sequence<tuple_size>());
+    }
+
 private:
+    /**
+     * Copy each element in the buffer at its compile time offset.
+     * @param buffer pointer to the destination buffer.
+     */
+    template <std::size_t... I>
+    void pack_to_buffer(std::uint8_t* buffer, std::index_sequence<I...>) const noexcept
+    {
+        constexpr std::array<std::size_t, tuple_size> offsets = flat_offsets();
+        (std::memcpy(buffer + offsets[I],
+                     &this->get<I>(),
+                     sizeof(typename std::tuple_element<I, underlying_tuple>::type)),
+         ...);
+    }
+
+    /**
+     * Copy each element from the buffer at its compile time offset.
+     * @param buffer pointer to the source buffer.
+     */
+    template <std::size_t... I>
+    void unpack_from_buffer(const std::uint8_t* buffer, std::index_sequence<I...>) noexcept
+    {
+        constexpr std::array<std::size_t, tuple_size> offsets = flat_offsets();
+        (std::memcpy(&this->get<I>(),
+                     buffer + offsets[I],
+                     sizeof(typename std::tuple_element<I, underlying_tuple>::type)),
+         ...);
+    }
+
     /**
      * Copy an element of a named_tuple in tuple.
      * @param t a tuple
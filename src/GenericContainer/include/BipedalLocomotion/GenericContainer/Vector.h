@@ -17,8 +17,10 @@
 //std
 #include <functional>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <type_traits>
 
 namespace BipedalLocomotion {
 namespace GenericContainer {
@@ -173,9 +175,21 @@ public:
             }
         }
 
-        for (index_type i = 0; i < size(); ++i)
+        // Fast path dispatched at compile time: both vectors point to contiguous memory, so for
+        // trivially copyable types the element-wise loop collapses to a single bulk copy.
+        if constexpr (std::is_trivially_copyable<value_type>::value && !std::is_const<T>::value)
         {
-            this->operator[](i) = other[i];
+            if (size() > 0)
+            {
+                std::memmove(this->data(), other.data(), size() * sizeof(value_type));
+            }
+        }
+        else
+        {
+            for (index_type i = 0; i < size(); ++i)
+            {
+                this->operator[](i) = other[i];
+            }
         }
 
         return true;
@@ -199,9 +213,20 @@ public:
             }
         }
 
-        for (index_type i = 0; i < size(); ++i)
+        // Fast path dispatched at compile time (see clone(const Vector<T>&)).
+        if constexpr (std::is_trivially_copyable<value_type>::value && !std::is_const<T>::value)
         {
-            this->operator[](i) = other[i];
+            if (size() > 0)
+            {
+                std::memmove(this->data(), other.data(), size() * sizeof(value_type));
+            }
+        }
+        else
+        {
+            for (index_type i = 0; i < size(); ++i)
+            {
+                this->operator[](i) = other[i];
+            }
         }
 
         return true;
@@ -533,6 +558,34 @@ public:
         return eigen_map_const_type(data(), size());
     }
 
+    /**
+     * @brief asSpan Get a raw contiguous view on the pointed data
+     * @return The span used internally.
+     *
+     * The storage is resolved once: consumers iterating element by element can hoist this call
+     * out of their loops and access the raw view directly, avoiding any per-element indirection
+     * through the type-erased interface.
+     *
+     * @warning The span is invalidated by resize() and by the deallocation of the original
+     * container.
+     */
+    iDynTree::Span<T> asSpan()
+    {
+        return m_span;
+    }
+
+    /**
+     * @brief asSpan Get a raw contiguous read-only view on the pointed data
+     * @return A span of const elements pointing to the same data of the span used internally.
+     *
+     * @warning The span is invalidated by resize() and by the deallocation of the original
+     * container.
+     */
+    iDynTree::Span<const value_type> asSpan() const
+    {
+        return iDynTree::Span<const value_type>(m_span.data(), m_span.size());
+    }
+
     /**
      * Forward declaration of Ref, which is used as a reference to the Vector (as &).
      */
@@ -709,4 +709,30 @@ TEST_CASE("GenericContainer::Vector")
         }
     }
 
+    SECTION("As span")
+    {
+        std::vector<double> vec{1, 2, 3, 4, 5};
+        GenericContainer::Vector<double>::Ref container(vec);
+
+        iDynTree::Span<double> span = container.asSpan();
+        REQUIRE(span.size() == static_cast<long>(vec.size()));
+        REQUIRE(span.data() == vec.data());
+
+        // the view writes directly in the original container
+        span[0] = -1.0;
+        REQUIRE(vec[0] == -1.0);
+
+        const GenericContainer::Vector<double>::Ref& constContainer = container;
+        iDynTree::Span<const double> constSpan = constContainer.asSpan();
+        REQUIRE(constSpan.data() == vec.data());
+        REQUIRE(constSpan[0] == -1.0);
+
+        // non trivially copyable types still go through the element-wise copy
+        std::vector<std::string> strings{"a", "b"};
+        std::vector<std::string> copiedStrings(2);
+        GenericContainer::Vector<std::string>::Ref stringContainer(copiedStrings);
+        stringContainer = GenericContainer::make_vector(strings);
+        REQUIRE(copiedStrings[1] == "b");
+    }
+
 }
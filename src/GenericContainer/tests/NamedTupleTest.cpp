@@ -6,6 +6,8 @@
  */
 
 #include <Eigen/Dense>
+#include <array>
+#include <cstdint>
 #include <tuple>
 #include <iostream>
 
@@ -123,3 +125,50 @@ TEST_CASE("Test NamedTuple")
         newNamedTuple2 = tempTuple;
     }
 }
+
+TEST_CASE("Test NamedTuple - flat layout")
+{
+    using namespace BipedalLocomotion::GenericContainer::literals;
+
+    auto foo = make_named_tuple(named_param<"number"_h, int>(),
+                                named_param<"floating_number"_h, double>(),
+                                named_param<"position"_h, std::array<double, 3>>());
+
+    using Tuple = decltype(foo);
+
+    // the metadata is resolved entirely at compile time
+    static_assert(Tuple::tuple_size == 3);
+    static_assert(Tuple::is_flat_packable);
+    static_assert(Tuple::flat_size
+                  == sizeof(int) + sizeof(double) + sizeof(std::array<double, 3>));
+
+    constexpr auto offsets = Tuple::flat_offsets();
+    static_assert(offsets[0] == 0);
+    static_assert(offsets[1] == sizeof(int));
+    static_assert(offsets[2] == sizeof(int) + sizeof(double));
+
+    constexpr auto hashes = Tuple::hashes();
+    static_assert(hashes[0] == "number"_h);
+    static_assert(hashes[2] == "position"_h);
+
+    // a tuple containing a dynamically sized vector cannot be packed with memcpy
+    static_assert(!DummyClass::State::is_flat_packable);
+
+    SECTION("Round trip")
+    {
+        foo.get_from_hash<"number"_h>() = 42;
+        foo.get_from_hash<"floating_number"_h>() = 8.15;
+        foo.get_from_hash<"position"_h>() = std::array<double, 3>{1.0, -2.0, 3.0};
+
+        std::array<std::uint8_t, Tuple::flat_size> buffer;
+        foo.to_flat_buffer(buffer.data());
+
+        Tuple bar;
+        bar.from_flat_buffer(buffer.data());
+
+        REQUIRE(bar.get_from_hash<"number"_h>() == foo.get_from_hash<"number"_h>());
+        REQUIRE(bar.get_from_hash<"floating_number"_h>()
+                == foo.get_from_hash<"floating_number"_h>());
+        REQUIRE(bar.get_from_hash<"position"_h>() == foo.get_from_hash<"position"_h>());
+    }
+}
@@ -13,6 +13,7 @@
 #include <manif/manif.h>
 
 #include <BipedalLocomotion/IK/IKLinearTask.h>
+#include <BipedalLocomotion/System/KinDynComputationsCache.h>
 
 #include <iDynTree/KinDynComputations.h>
 
@@ -63,6 +64,10 @@ class CoMTask : public IKLinearTask
     std::shared_ptr<iDynTree::KinDynComputations> m_kinDyn; /**< Pointer to a KinDynComputations
                                                                object */
 
+    std::shared_ptr<System::KinDynComputationsCache> m_kinDynCache; /**< Optional memoizing layer
+                                                                       shared among several tasks
+                                                                       and solvers. */
+
     /** Mask used to select the DoFs controlled by the task */
     std::array<bool, m_linearVelocitySize> m_mask{true, true, true};
     std::size_t m_DoFs{m_linearVelocitySize}; /**< DoFs associated to the task */
@@ -93,6 +98,17 @@ public:
      */
     bool setKinDyn(std::shared_ptr<iDynTree::KinDynComputations> kinDyn) override;
 
+    /**
+     * Set a shared kinDynComputations cache. When set, the task reads the center of mass position
+     * and jacobian from the cache instead of recomputing them, so the quantities are evaluated
+     * once per tick even if several tasks (or several solvers) consume them.
+     * @param kinDynCache pointer to a KinDynComputationsCache object.
+     * @note The kinDynComputations object wrapped by the cache replaces the one set with
+     * setKinDyn().
+     * @return True in case of success, false otherwise.
+     */
+    bool setKinDynCache(std::shared_ptr<System::KinDynComputationsCache> kinDynCache);
+
     /**
      * Set the set of variables required by the task. The variables are stored in the
      * System::VariablesHandler.
@@ -53,6 +53,7 @@ class DistanceTask : public IKLinearTask
 
     Eigen::MatrixXd m_jacobian, m_relativeJacobian; /**< Internal buffers to store the jacobian. */
     Eigen::Vector3d m_framePosition; /**< Internal buffer to store the frame position. */
+    Eigen::Vector3d m_scaledFramePosition; /**< Frame position divided by the computed distance. */
     double m_kp; /**< Controller gain. */
     double m_desiredDistance{0.0}; /**< Desired distance. */
 
@@ -121,8 +121,10 @@ class GravityTask : public IKLinearTask
     Eigen::MatrixXd m_jacobian; /**< Internal buffer to store the jacobian. */
     Eigen::Vector3d m_desiredZDirectionBody; /**< Desired gravity direction in the target frame. */
     Eigen::Vector3d m_feedForwardBody; /**< Feedforward term expressed in body direction. */
-    Eigen::MatrixXd m_Am; /**< Matrix filtering jacobian rows. */
-    Eigen::MatrixXd m_bm; /**< Matrix filtering acceleration. */
+    Eigen::Matrix<double, 2, 3> m_Am; /**< Matrix filtering jacobian rows. The size is known at
+                                         compile time so the products in update() are unrolled. */
+    Eigen::Matrix<double, 2, 3> m_bm; /**< Matrix filtering acceleration. The size is known at
+                                         compile time so the products in update() are unrolled. */
 
     iDynTree::FrameIndex m_targetFrameIndex; /**< Index of the target frame. */
 
@@ -8,6 +8,7 @@
 #ifndef BIPEDAL_LOCOMOTION_IK_QP_INVERSE_KINEMATICS_H
 #define BIPEDAL_LOCOMOTION_IK_QP_INVERSE_KINEMATICS_H
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include <string>
@@ -127,6 +128,63 @@ public:
     bool setTaskWeight(const std::string& taskName,
                        Eigen::Ref<const Eigen::VectorXd> weight) override;
 
+    /**
+     * Store the warm-boot data (primal and dual variables of the last solve) in the given file.
+     * The data is keyed by a fingerprint of the problem (variables and task stack), so a file
+     * generated by a different problem is rejected when loaded.
+     * @param filePath path of the file.
+     * @note Call this method while shutting down, when a valid solution is available. The
+     * underlying OSQP API does not expose the factorization, so the file contains only the
+     * primal/dual variables: on the next startup the setup cost is still paid once, but the first
+     * solve converges as fast as a steady-state one.
+     * @return true in case of success, false otherwise.
+     */
+    bool storeWarmStartData(const std::string& filePath) const;
+
+    /**
+     * Load the warm-boot data stored with storeWarmStartData(). The primal and dual variables are
+     * fed to the solver before the first solve.
+     * @param filePath path of the file.
+     * @note Call this method after finalize(). If the file does not exist or belongs to a
+     * different problem the method returns false and the solver cold starts.
+     * @return true in case of success, false otherwise.
+     */
+    bool loadWarmStartData(const std::string& filePath);
+
+    /**
+     * Enable or disable an already existing task without changing the structure of the QP.
+     * @param taskName name associated to the task.
+     * @param isEnabled true to enable the task, false to disable it.
+     * @note A disabled task keeps its rows in the problem: a cost contributes with zero weight,
+     * while a constraint keeps zero coefficients and free bounds. Since the QP dimensions and the
+     * sparsity pattern do not change, enabling or disabling a task is a value-only update and does
+     * not require to call finalize() again.
+     * @return true if the task exists, false otherwise.
+     */
+    bool setTaskEnabled(const std::string& taskName, bool isEnabled);
+
+    /**
+     * Set the update decimation associated to an already existing task. A task with decimation
+     * equal to `d` is updated once every `d` calls to advance(), while the cached task matrices
+     * are reused in between. This is useful for tasks whose content changes at a rate lower than
+     * the solver one (e.g. a posture task whose setpoint is refreshed by a slow planner).
+     * @param taskName name associated to the task.
+     * @param decimation number of calls to advance() between two consecutive updates of the task.
+     * The value must be strictly positive. 1 (the default for every task) means that the task is
+     * updated at every call to advance().
+     * @return true in case of success, false otherwise.
+     */
+    bool setTaskUpdateDecimation(const std::string& taskName, std::size_t decimation) override;
+
+    /**
+     * Mark an already existing task as dirty. The task is updated at the next call to advance()
+     * regardless of its update decimation, and its schedule restarts from there. Call this method
+     * when the task setpoint changes between two scheduled updates.
+     * @param taskName name associated to the task.
+     * @return true in case of success, false otherwise.
+     */
+    bool triggerTaskUpdate(const std::string& taskName) override;
+
     /**
      * Get the weightProvider associated to an already existing task
      * @param taskName name associated to the task
@@ -136,6 +194,35 @@ public:
     std::weak_ptr<const System::WeightProviderPort>
     getTaskWeightProvider(const std::string& taskName) const override;
 
+    /**
+     * Split the update of the tasks in groups executed concurrently when advance() is called.
+     * @param groups vector of groups. Each group is a vector of task names. The tasks belonging to
+     * the same group are updated serially on the same thread, while different groups are updated in
+     * parallel. The tasks not listed in any group are updated on the calling thread.
+     * @note This feature is opt-in. If this method is not called (or is called with an empty
+     * vector) all the tasks are updated serially as usual.
+     * @note This method should be called after ALL the tasks have been added with addTask().
+     * @warning The tasks belonging to different groups must not share non-thread-safe resources. In
+     * particular iDynTree::KinDynComputations is not thread-safe, so tasks sharing the same
+     * KinDynComputations object must belong to the same group.
+     * @return true in case of success, false otherwise.
+     */
+    bool setConcurrentTaskUpdateGroups(const std::vector<std::vector<std::string>>& groups);
+
+    /**
+     * Replace the per-task update loop with a user provided function. This is useful when the
+     * task list is frozen and the tasks are updated through a compile-time composed stack (see
+     * System::StaticTaskStack), avoiding the virtual dispatch of LinearTask::update().
+     * @param updater function updating ALL the tasks added to the solver. Passing a nullptr
+     * restores the default update loop.
+     * @note This method and setConcurrentTaskUpdateGroups() are mutually exclusive: the last one
+     * called wins.
+     * @warning The external updater bypasses the per-task update-rate scheduling (see
+     * setTaskUpdateDecimation).
+     * @return true in case of success, false otherwise.
+     */
+    bool setExternalTaskUpdater(std::function<bool()> updater) override;
+
     /**
      * Finalize the IK.
      * @param handler parameter handler.
@@ -149,10 +236,15 @@ public:
      * Initialize the inverse kinematics algorithm.
      * @param handler pointer to the IParametersHandler interface.
      * @note the following parameters are required by the class
-     * |         Parameter Name         |   Type   |                                           Description                                          | Mandatory |
-     * |:------------------------------:|:--------:|:----------------------------------------------------------------------------------------------:|:---------:|
-     * | `robot_velocity_variable_name` | `string` | Name of the variable contained in `VariablesHandler` describing the generalized robot velocity |    Yes    |
-     * |           `verbosity`          |  `bool`  |                         Verbosity of the solver. Default value `false`                         |     No    |
+     * |              Parameter Name              |   Type   |                                           Description                                          | Mandatory |
+     * |:----------------------------------------:|:--------:|:----------------------------------------------------------------------------------------------:|:---------:|
+     * |      `robot_velocity_variable_name`      | `string` | Name of the variable contained in `VariablesHandler` describing the generalized robot velocity |    Yes    |
+     * |                `verbosity`               |  `bool`  |                         Verbosity of the solver. Default value `false`                         |     No    |
+     * |    `enable_lexicographic_priorities`     |  `bool`  | If true the task priorities are resolved lexicographically with nullspace projections instead of weighting the tasks in one QP. In this mode any priority greater or equal to 0 is accepted and only equality tasks are supported. Default value `false` |     No    |
+     * |                `osqp_rho`                | `double` |            ADMM rho step of the OSQP solver. Default value `0.1` (the OSQP default)            |     No    |
+     * |               `osqp_sigma`               | `double` |           ADMM sigma step of the OSQP solver. Default value `1e-6` (the OSQP default)          |     No    |
+     * |              `osqp_scaling`              |   `int`  |      Number of scaling iterations of the OSQP solver. Default value `10` (the OSQP default)    |     No    |
+     * |        `problem_recording_folder`        | `string` | If not empty, every assembled QP instance is dumped in the given folder. The instances can be replayed offline by the osqp-settings-tuner utility to find the best solver settings. Default value empty (recording disabled) |     No    |
      * Where the generalized robot velocity is a vector containing the base spatial velocity
      * (expressed in mixed representation) and the joint velocities.
      * @return True in case of success, false otherwise.
@@ -301,6 +393,26 @@ public:
      * @return a vector containing the solution of the optimization problem
      */
     Eigen::Ref<const Eigen::VectorXd> getRawSolution() const override;
+
+    /**
+     * Return a view of the joint velocity block of the solution buffer. Differently from
+     * getOutput(), no data is copied: the returned object maps the solver's persistent solution
+     * vector.
+     * @return a view of the joint velocity solution.
+     * @warning The view is invalidated by the next call to advance(). Check isOutputValid()
+     * before using it.
+     */
+    Eigen::Ref<const Eigen::VectorXd> getRawJointVelocitySolution() const;
+
+    /**
+     * Return a view of the base velocity block of the solution buffer expressed in mixed
+     * representation. Differently from getOutput(), no data is copied: the returned object maps
+     * the solver's persistent solution vector.
+     * @return a view of the base velocity solution.
+     * @warning The view is invalidated by the next call to advance(). Check isOutputValid()
+     * before using it.
+     */
+    Eigen::Ref<const Eigen::VectorXd> getRawBaseVelocitySolution() const;
 };
 } // namespace IK
 } // namespace BipedalLocomotion
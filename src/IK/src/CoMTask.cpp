@@ -28,6 +28,19 @@ bool CoMTask::setKinDyn(std::shared_ptr<iDynTree::KinDynComputations> kinDyn)
     return true;
 }
 
+bool CoMTask::setKinDynCache(std::shared_ptr<System::KinDynComputationsCache> kinDynCache)
+{
+    if (kinDynCache == nullptr || kinDynCache->kinDyn() == nullptr)
+    {
+        log()->error("[CoMTask::setKinDynCache] Invalid kinDynCache object.");
+        return false;
+    }
+
+    m_kinDynCache = kinDynCache;
+    m_kinDyn = kinDynCache->kinDyn();
+    return true;
+}
+
 bool CoMTask::setVariablesHandler(const System::VariablesHandler& variablesHandler)
 {
     if (!m_isInitialized)
@@ -167,8 +180,15 @@ bool CoMTask::update()
 
     m_isValid = false;
 
-    // set the state
-    m_R3Controller.setState(toEigen(m_kinDyn->getCenterOfMassPosition()));
+    // set the state. If the cache is available the center of mass position is evaluated at most
+    // once per state generation even if several tasks consume it
+    if (m_kinDynCache != nullptr)
+    {
+        m_R3Controller.setState(m_kinDynCache->getCenterOfMassPosition());
+    } else
+    {
+        m_R3Controller.setState(toEigen(m_kinDyn->getCenterOfMassPosition()));
+    }
 
     // update the controller
     m_R3Controller.computeControlLaw();
@@ -180,7 +200,15 @@ bool CoMTask::update()
         m_b = m_R3Controller.getControl().coeffs();
 
         // get the CoM jacobian
-        if (!m_kinDyn->getCenterOfMassJacobian(this->subA(m_robotVelocityVariable)))
+        if (m_kinDynCache != nullptr)
+        {
+            if (!m_kinDynCache->getCenterOfMassJacobian(m_jacobian))
+            {
+                log()->error("[CoMTask::update] Unable to get the jacobian.");
+                return m_isValid;
+            }
+            toEigen(this->subA(m_robotVelocityVariable)) = m_jacobian;
+        } else if (!m_kinDyn->getCenterOfMassJacobian(this->subA(m_robotVelocityVariable)))
         {
             log()->error("[CoMTask::update] Unable to get the jacobian.");
             return m_isValid;
@@ -188,7 +216,10 @@ bool CoMTask::update()
     } else
     {
         // get the CoM jacobian
-        if (!m_kinDyn->getCenterOfMassJacobian(m_jacobian))
+        const bool ok = (m_kinDynCache != nullptr)
+                            ? m_kinDynCache->getCenterOfMassJacobian(m_jacobian)
+                            : m_kinDyn->getCenterOfMassJacobian(m_jacobian);
+        if (!ok)
         {
             log()->error("[CoMTask::update] Unable to get the jacobian.");
             return m_isValid;
@@ -66,6 +66,7 @@ bool DistanceTask::setVariablesHandler(const System::VariablesHandler& variables
     m_relativeJacobian.resize(m_spatialVelocitySize, m_kinDyn->getNrOfDegreesOfFreedom());
     m_relativeJacobian.setZero();
     m_framePosition.setZero();
+    m_scaledFramePosition.setZero();
 
     return true;
 }
@@ -205,14 +206,21 @@ bool DistanceTask::update()
             return m_isValid;
         }
 
-        m_jacobian.rightCols(m_kinDyn->getNrOfDegreesOfFreedom()) = m_relativeJacobian;
+        // the task depends only on the linear part of the jacobian so there is no need to copy
+        // the angular rows
+        m_jacobian.topRows<3>().rightCols(m_kinDyn->getNrOfDegreesOfFreedom())
+            = m_relativeJacobian.topRows<3>();
     }
 
     m_computedDistance = m_framePosition.norm();
 
+    // normalize the fixed-size position before the product with the jacobian so that the scalar
+    // division is performed on 3 elements instead of the whole task row
+    m_scaledFramePosition
+        = m_framePosition / std::max(m_distanceNumericThreshold, m_computedDistance);
+
     toEigen(this->subA(m_robotVelocityVariable)).noalias()
-        = (m_framePosition.transpose() * m_jacobian.topRows<3>())
-          / (std::max(m_distanceNumericThreshold, m_computedDistance));
+        = m_scaledFramePosition.transpose() * m_jacobian.topRows<3>();
     m_b(0) = m_kp * (m_desiredDistance - m_computedDistance);
 
     m_isValid = true;
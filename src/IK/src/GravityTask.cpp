@@ -64,8 +64,6 @@ bool GravityTask::setVariablesHandler(const System::VariablesHandler& variablesH
     m_jacobian.setZero();
     m_desiredZDirectionBody.setZero();
     m_feedForwardBody.setZero();
-    m_Am.resize(2, 3);
-    m_bm.resize(2, 3);
     // clang-format off
     m_Am << 1, 0, 0,
             0, 1, 0;
@@ -152,10 +150,12 @@ bool GravityTask::update()
 
     m_isValid = false;
 
-    auto targetRotation = toEigen(m_kinDyn->getWorldTransform(m_targetFrameIndex).getRotation());
+    // fixed-size copy of the rotation so the following products are fully unrolled
+    const Eigen::Matrix3d targetRotation
+        = toEigen(m_kinDyn->getWorldTransform(m_targetFrameIndex).getRotation());
 
-    Eigen::Vector3d desiredZDirectionAbsolute = targetRotation * m_desiredZDirectionBody;
-    Eigen::Vector3d feedforwardAbsolute = targetRotation * m_feedForwardBody;
+    const Eigen::Vector3d desiredZDirectionAbsolute = targetRotation * m_desiredZDirectionBody;
+    const Eigen::Vector3d feedforwardAbsolute = targetRotation * m_feedForwardBody;
 
     if (!m_kinDyn->getFrameFreeFloatingJacobian(m_targetFrameIndex, m_jacobian))
     {
@@ -222,27 +222,20 @@ bool JointLimitsTask::update()
             = m_klim.asDiagonal() * (-m_lowerLimits + m_jointPosition) / dT;
     } else
     {
-        Eigen::DenseBase<Eigen::Matrix<double, -1, 1, 0, -1, 1>>::SegmentReturnType upperLimitPart
-                = m_b.head(m_kinDyn->getNrOfDegreesOfFreedom());
-        Eigen::DenseBase<Eigen::Matrix<double, -1, 1, 0, -1, 1>>::SegmentReturnType lowerLimitPart
-                = m_b.tail(m_kinDyn->getNrOfDegreesOfFreedom());
-
-        for (int i = 0; i < m_upperLimits.size(); i++)
-        {
-            if (m_upperLimits[i] == OsqpEigen::INFTY)
-            {
-                upperLimitPart(i) = m_klim(i) * (m_upperLimits(i) - m_jointPosition(i)) //
-                                    / dT;
-            }
-        }
-        for (int i = 0; i < m_lowerLimits.size(); i++)
-        {
-            if (m_lowerLimits[i] == -OsqpEigen::INFTY)
-            {
-                lowerLimitPart(i) = m_klim(i) * (m_lowerLimits(i) - m_jointPosition(i)) //
-                                    / dT;
-            }
-        }
+        // joints without limits in the model keep the +/- infinity bound set in
+        // setVariablesHandler, all the others are updated with the proportional law. The selection
+        // is performed element-wise on the whole joint vector in a single pass without branches
+        m_b.head(m_kinDyn->getNrOfDegreesOfFreedom())
+            = (m_upperLimits.array() == OsqpEigen::INFTY)
+                  .select(OsqpEigen::INFTY,
+                          m_klim.array() * (m_upperLimits - m_jointPosition).array() / dT)
+                  .matrix();
+
+        m_b.tail(m_kinDyn->getNrOfDegreesOfFreedom())
+            = (m_lowerLimits.array() == -OsqpEigen::INFTY)
+                  .select(-OsqpEigen::INFTY,
+                          m_klim.array() * (m_jointPosition - m_lowerLimits).array() / dT)
+                  .matrix();
     }
 
     m_isValid = true;
@@ -5,61 +5,144 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <BipedalLocomotion/IK/IKLinearTask.h>
 #include <BipedalLocomotion/IK/QPFixedBaseInverseKinematics.h>
-#include <BipedalLocomotion/IK/SE3Task.h>
-#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
+#include <iDynTree/Core/EigenHelpers.h>
+
 using namespace BipedalLocomotion;
 using namespace BipedalLocomotion::IK;
 using namespace BipedalLocomotion::ParametersHandler;
 
-struct QPFixedBaseInverseKinematics::Impl
+namespace
 {
-    std::string baseLink;
-    std::shared_ptr<SE3Task> baseSE3Task;
-    // const std::string baseContactWrenchVariableName{"base_contact_wrench"};
-    bool isKinDynSet{false};
 
-    bool createBaseSE3Task(std::shared_ptr<const IParametersHandler> handler)
+/**
+ * BaseVelocityLockTask constrains the first six components of the robot velocity variable to zero.
+ * Since the base of the robot is fixed, the mixed-representation base twist coincides with this
+ * sub-variable, hence the task is equivalent to a zero-velocity SE3Task on the base link while its
+ * matrix is a constant selection matrix that does not require any jacobian evaluation at every
+ * update.
+ */
+class BaseVelocityLockTask : public IKLinearTask
+{
+    System::VariablesHandler::VariableDescription m_robotVelocityVariable; /**< Variable describing
+                                                                              the robot velocity
+                                                                              (base + joint) */
+    std::string m_robotVelocityVariableName;
+
+    static constexpr std::size_t m_spatialVelocitySize{6}; /**< Size of the spatial velocity vector.
+                                                            */
+
+    bool m_isValid{false}; /**< True if the task is valid. */
+
+public:
+    bool
+    initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> paramHandler) override
     {
-        constexpr auto logPrefix = "[QPFixedBaseInverseKinematics::createBaseSE3Task]";
+        constexpr auto logPrefix = "[BaseVelocityLockTask::initialize]";
+
+        auto ptr = paramHandler.lock();
+        if (ptr == nullptr)
+        {
+            log()->error("{} The parameter handler is not valid.", logPrefix);
+            return false;
+        }
 
-        auto baseSE3ParameterHandler = std::make_shared<StdImplementation>();
-        std::string robotVelocityVariableName;
-        if (!handler->getParameter("robot_velocity_variable_name", robotVelocityVariableName))
+        if (!ptr->getParameter("robot_velocity_variable_name", m_robotVelocityVariableName))
         {
-            log()->error("{} Unable to get the parameter 'robot_velocity_variable_name'",
+            log()->error("{} Unable to get the parameter 'robot_velocity_variable_name'.",
                          logPrefix);
             return false;
         }
-        baseSE3ParameterHandler->setParameter("robot_velocity_variable_name",
-                                              robotVelocityVariableName);
 
-        // This task is to consider the robot fixed base, so the controller gains are set to 0.
-        // Read it a zero acceleration task
-        baseSE3ParameterHandler->setParameter("kp_linear", 0.0);
-        baseSE3ParameterHandler->setParameter("kp_angular", 0.0);
-        baseSE3ParameterHandler->setParameter("frame_name", this->baseLink);
+        m_description = "Base velocity lock task";
 
-        if (!baseSE3Task->initialize(baseSE3ParameterHandler))
+        return true;
+    }
+
+    bool setVariablesHandler(const System::VariablesHandler& variablesHandler) override
+    {
+        constexpr auto logPrefix = "[BaseVelocityLockTask::setVariablesHandler]";
+
+        if (!variablesHandler.getVariable(m_robotVelocityVariableName, m_robotVelocityVariable))
+        {
+            log()->error("{} Unable to get the variable named {}.",
+                         logPrefix,
+                         m_robotVelocityVariableName);
+            return false;
+        }
+
+        if (m_robotVelocityVariable.size < m_spatialVelocitySize)
         {
-            log()->error("{} Error initializing se3task on the base", logPrefix);
+            log()->error("{} The variable named {} must contain at least the base spatial "
+                         "velocity. Expected minimum size: {}. Given size: {}.",
+                         logPrefix,
+                         m_robotVelocityVariableName,
+                         m_spatialVelocitySize,
+                         m_robotVelocityVariable.size);
             return false;
         }
 
-        baseSE3Task->setTaskControllerMode(SE3Task::Mode::Disable);
-        baseSE3Task->setSetPoint(manif::SE3d::Identity(),
-                                 manif::SE3d::Tangent::Zero());
+        // the task matrix is constant. It selects the base components of the robot velocity
+        //      _                 _
+        // A = |  I_{6x6}  0_{6xn} |
+        //     |_                 _|
+        m_A.resize(m_spatialVelocitySize, variablesHandler.getNumberOfVariables());
+        m_A.setZero();
+        m_b = Eigen::VectorXd::Zero(m_spatialVelocitySize);
+
+        iDynTree::toEigen(this->subA(m_robotVelocityVariable))
+            .leftCols<m_spatialVelocitySize>()
+            .diagonal()
+            .setConstant(1.0);
+
+        m_isValid = true;
 
         return true;
     }
+
+    bool update() override
+    {
+        // the task is constant. Nothing to do here
+        return m_isValid;
+    }
+
+    std::vector<System::LinearTask::ColumnBlock> structuralColumnBlocks() const override
+    {
+        return {{m_robotVelocityVariable.offset,
+                 static_cast<std::ptrdiff_t>(m_spatialVelocitySize)}};
+    }
+
+    std::size_t size() const override
+    {
+        return m_spatialVelocitySize;
+    }
+
+    Type type() const override
+    {
+        return Type::equality;
+    }
+
+    bool isValid() const override
+    {
+        return m_isValid;
+    }
+};
+
+} // namespace
+
+struct QPFixedBaseInverseKinematics::Impl
+{
+    std::shared_ptr<BaseVelocityLockTask> baseLockTask;
+    bool isKinDynSet{false};
 };
 
 QPFixedBaseInverseKinematics::QPFixedBaseInverseKinematics()
 {
     m_pimpl = std::make_unique<QPFixedBaseInverseKinematics::Impl>();
-    m_pimpl->baseSE3Task = std::make_shared<SE3Task>();
+    m_pimpl->baseLockTask = std::make_shared<BaseVelocityLockTask>();
 }
 
 QPFixedBaseInverseKinematics::~QPFixedBaseInverseKinematics() = default;
@@ -74,15 +157,6 @@ bool QPFixedBaseInverseKinematics::setKinDyn(std::shared_ptr<iDynTree::KinDynCom
         return false;
     }
 
-    if (!m_pimpl->baseSE3Task->setKinDyn(kinDyn))
-    {
-        log()->error("{} Unable to set the kinDyn object for SE3Task on the base.", logPrefix);
-        return false;
-    }
-
-    // get the robot base link
-    m_pimpl->baseLink = kinDyn->getFloatingBase();
-
     m_pimpl->isKinDynSet = true;
 
     return true;
@@ -106,9 +180,11 @@ bool QPFixedBaseInverseKinematics::initialize(
         return false;
     }
 
-    if (!m_pimpl->createBaseSE3Task(ptr))
+    // the base lock task reads the robot velocity variable name from the same handler of the
+    // solver
+    if (!m_pimpl->baseLockTask->initialize(ptr))
     {
-        log()->error("{} Error creating SE3task for the base.", logPrefix);
+        log()->error("{} Error initializing the lock task on the base.", logPrefix);
         return false;
     }
 
@@ -119,5 +195,5 @@ bool QPFixedBaseInverseKinematics::initialize(
     }
 
     constexpr std::size_t highPriority = 0;
-    return this->addTask(m_pimpl->baseSE3Task, "base_se3_task", highPriority);
+    return this->addTask(m_pimpl->baseLockTask, "base_lock_task", highPriority);
 }
@@ -5,8 +5,14 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <algorithm>
 #include <cstddef>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
 #include <memory>
+#include <sstream>
 
 #include <iDynTree/KinDynComputations.h>
 
@@ -16,6 +22,8 @@
 #include <BipedalLocomotion/IK/IntegrationBasedIK.h>
 #include <BipedalLocomotion/IK/QPInverseKinematics.h>
 #include <BipedalLocomotion/System/ConstantWeightProvider.h>
+#include <BipedalLocomotion/System/ParallelTaskGroupUpdater.h>
+#include <BipedalLocomotion/System/TimeProfiler.h>
 #include <BipedalLocomotion/System/VariablesHandler.h>
 #include <BipedalLocomotion/System/WeightProvider.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
@@ -32,6 +40,34 @@ struct QPInverseKinematics::Impl
         std::shared_ptr<const System::WeightProviderPort> weightProvider;
         Eigen::MatrixXd tmp; /**< This is a temporary matrix usefull to reduce dynamics allocation
                                 in advance method */
+        bool isEnabled{true}; /**< If false the task rows are kept in the problem with zero
+                                 weight (costs) or free bounds (constraints) so that the QP
+                                 dimensions do not change. */
+
+        std::size_t updateDecimation{1}; /**< Number of calls to advance() between two consecutive
+                                            updates of the task. */
+        std::size_t updateCountdown{0}; /**< Number of calls to advance() before the next update of
+                                           the task. */
+        bool updateRequested{false}; /**< True if the task has been marked as dirty with
+                                        triggerTaskUpdate(). */
+
+        /**
+         * Advance the update schedule of the task. The task is updated when the countdown expires
+         * or when it has been explicitly marked as dirty, otherwise the cached matrices are
+         * reused.
+         */
+        bool shouldUpdate()
+        {
+            if (updateRequested || updateCountdown == 0)
+            {
+                updateRequested = false;
+                updateCountdown = updateDecimation - 1;
+                return true;
+            }
+
+            updateCountdown--;
+            return false;
+        }
     };
 
     QPInverseKinematics::State solution;
@@ -41,6 +77,17 @@ struct QPInverseKinematics::Impl
     OsqpEigen::Solver solver; /**< Optimization solver. */
     bool isVerbose{false};
 
+    /** OSQP solver settings. The defaults match the OSQP ones, so the behavior does not change
+     * unless the corresponding parameters are provided, e.g. with the values found by the
+     * osqp-settings-tuner utility. */
+    double osqpRho{0.1};
+    double osqpSigma{1e-6};
+    int osqpScaling{10};
+
+    std::string problemRecordingFolder; /**< When not empty, every assembled QP instance is dumped
+                                           in this folder for offline settings tuning. */
+    std::size_t recordedProblems{0}; /**< Number of QP instances dumped so far. */
+
     std::unordered_map<std::string, TaskWithPriority> tasks;
 
     std::vector<std::reference_wrapper<const TaskWithPriority>> constraints;
@@ -53,17 +100,97 @@ struct QPInverseKinematics::Impl
     Eigen::VectorXd lowerBound;
     Eigen::VectorXd upperBound;
 
+    /** Persistent sparse matrices whose sparsity pattern is computed once in finalize(). In
+     * advance() only the values are refreshed, so osqp-eigen detects an unchanged pattern and
+     * takes the value-only update path, reusing the KKT factorization across ticks. */
+    Eigen::SparseMatrix<double> hessianSparse;
+    Eigen::SparseMatrix<double> constraintMatrixSparse;
+
+    /** Optional concurrent update of the tasks. The groups are set by the user with
+     * QPInverseKinematics::setConcurrentTaskUpdateGroups(). */
+    System::ParallelTaskGroupUpdater parallelUpdater;
+    bool useConcurrentUpdate{false};
+
+    /** Profiler sections timing the phases of advance(). The samples are recorded only if the
+     * framework is compiled with the FRAMEWORK_ENABLE_PROFILER option. */
+    std::ptrdiff_t taskUpdateSection{System::TimeProfiler::InvalidSectionIndex};
+    std::ptrdiff_t qpSolveSection{System::TimeProfiler::InvalidSectionIndex};
+
+    /** A priority level of the lexicographic mode. It collects all the tasks sharing the same
+     * priority along with the preallocated stacked matrices. */
+    struct LexicographicLevel
+    {
+        std::vector<std::reference_wrapper<TaskWithPriority>> tasks;
+        std::size_t rows{0};
+        Eigen::MatrixXd stackedA;
+        Eigen::VectorXd stackedB;
+        Eigen::MatrixXd projectedA;
+    };
+
+    bool isLexicographicEnabled{false}; /**< If true the priorities are resolved with nullspace
+                                           projections instead of weighting the tasks in one QP. */
+    std::vector<LexicographicLevel> lexicographicLevels; /**< Levels ordered by priority. */
+    Eigen::VectorXd lexicographicSolution;
+    Eigen::MatrixXd nullspaceProjector;
+
+    Eigen::VectorXd warmStartPrimal; /**< Primal variable loaded from the warm-boot file. */
+    Eigen::VectorXd warmStartDual; /**< Dual variable loaded from the warm-boot file. */
+    bool hasWarmStart{false}; /**< True if a warm-boot file has been successfully loaded. */
+
+    /**
+     * Compute a fingerprint of the optimization problem. Two problems with the same variables and
+     * the same task stack (names, priorities and sizes) share the fingerprint, so warm-boot data
+     * stored by one instance can be safely consumed by the other.
+     */
+    std::size_t problemFingerprint() const
+    {
+        std::vector<std::string> taskDescriptions;
+        for (const auto& [name, task] : this->tasks)
+        {
+            taskDescriptions.push_back(name + ":" + std::to_string(task.priority) + ":"
+                                       + std::to_string(task.task->size()));
+        }
+        std::sort(taskDescriptions.begin(), taskDescriptions.end());
+
+        std::ostringstream oss;
+        oss << this->robotVelocityVariable.name << ";" << this->hessian.rows() << ";"
+            << this->numberOfConstraints;
+        for (const auto& description : taskDescriptions)
+        {
+            oss << ";" << description;
+        }
+
+        return std::hash<std::string>{}(oss.str());
+    }
+
     bool isFirstIteration{true};
     bool isValid{false};
     bool isInitialized{false};
     bool isFinalized{false};
 
+    /**
+     * Copy the values of the dense matrices into the persistent sparse structures. The pattern is
+     * fully populated and column-major, so the copy is a plain memcpy of the value arrays with no
+     * allocation.
+     */
+    void syncSparseMatrices()
+    {
+        Eigen::Map<Eigen::VectorXd>(this->hessianSparse.valuePtr(), this->hessian.size())
+            = Eigen::Map<const Eigen::VectorXd>(this->hessian.data(), this->hessian.size());
+        Eigen::Map<Eigen::VectorXd>(this->constraintMatrixSparse.valuePtr(),
+                                    this->constraintMatrix.size())
+            = Eigen::Map<const Eigen::VectorXd>(this->constraintMatrix.data(),
+                                                this->constraintMatrix.size());
+    }
+
     bool initializeSolver()
     {
         constexpr auto logPrefix = "[QPInversekinematics::Impl::initializeSolver]";
+
+        this->syncSparseMatrices();
+
         // Hessian matrix
-        Eigen::SparseMatrix<double> hessianSparse = this->hessian.sparseView();
-        if (!this->solver.data()->setHessianMatrix(hessianSparse))
+        if (!this->solver.data()->setHessianMatrix(this->hessianSparse))
         {
             log()->error("{} Unable to set the hessian matrix.", logPrefix);
             return false;
@@ -76,8 +203,7 @@ struct QPInverseKinematics::Impl
             return false;
         }
 
-        Eigen::SparseMatrix<double> constraintsMatrixSparse = this->constraintMatrix.sparseView();
-        if (!this->solver.data()->setLinearConstraintsMatrix(constraintsMatrixSparse))
+        if (!this->solver.data()->setLinearConstraintsMatrix(this->constraintMatrixSparse))
         {
             log()->error("{} Unable to set the constraint matrix.", logPrefix);
             return false;
@@ -101,9 +227,12 @@ struct QPInverseKinematics::Impl
     bool updateSolver()
     {
         constexpr auto logPrefix = "[QPInversekinematics::Impl::updateSolver]";
-        // Hessian matrix
-        Eigen::SparseMatrix<double> hessianSparse = this->hessian.sparseView();
-        if (!this->solver.updateHessianMatrix(hessianSparse))
+
+        this->syncSparseMatrices();
+
+        // Hessian matrix. Since the sparsity pattern is unchanged, osqp-eigen performs a
+        // value-only update
+        if (!this->solver.updateHessianMatrix(this->hessianSparse))
         {
             log()->error("{} Unable to set the hessian matrix.", logPrefix);
             return false;
@@ -116,8 +245,7 @@ struct QPInverseKinematics::Impl
             return false;
         }
 
-        Eigen::SparseMatrix<double> constraintsMatrixSparse = this->constraintMatrix.sparseView();
-        if (!this->solver.updateLinearConstraintsMatrix(constraintsMatrixSparse))
+        if (!this->solver.updateLinearConstraintsMatrix(this->constraintMatrixSparse))
         {
             log()->error("{} Unable to set the constraint matrix.", logPrefix);
             return false;
@@ -131,6 +259,96 @@ struct QPInverseKinematics::Impl
 
         return true;
     }
+
+    /**
+     * Dump the assembled QP instance in the recording folder as a plain text file. The instances
+     * can be replayed offline by the osqp-settings-tuner utility to sweep the solver settings on
+     * the real problems solved by the controller.
+     */
+    void recordProblem()
+    {
+        constexpr auto logPrefix = "[QPInversekinematics::Impl::recordProblem]";
+
+        std::ostringstream fileName;
+        fileName << this->problemRecordingFolder << "/qp_instance_" << std::setw(6)
+                 << std::setfill('0') << this->recordedProblems << ".txt";
+
+        std::ofstream file(fileName.str());
+        if (!file.is_open())
+        {
+            log()->warn("{} Unable to open the file named {}. The problem recording is disabled.",
+                        logPrefix,
+                        fileName.str());
+            this->problemRecordingFolder.clear();
+            return;
+        }
+
+        const Eigen::IOFormat format(Eigen::FullPrecision, Eigen::DontAlignCols, " ", "\n");
+        file << this->hessian.rows() << " " << this->constraintMatrix.rows() << "\n";
+        file << this->hessian.format(format) << "\n";
+        file << this->gradient.transpose().format(format) << "\n";
+        if (this->constraintMatrix.rows() > 0)
+        {
+            file << this->constraintMatrix.format(format) << "\n";
+            file << this->lowerBound.transpose().format(format) << "\n";
+            file << this->upperBound.transpose().format(format) << "\n";
+        }
+
+        this->recordedProblems++;
+    }
+
+    /**
+     * Solve the lexicographic problem. The levels are solved in strict priority order: each level
+     * is projected in the nullspace of all the higher priority levels, with the projector updated
+     * incrementally, so one sweep over the levels replaces a cascade of QP solves.
+     */
+    bool solveLexicographic()
+    {
+        this->lexicographicSolution.setZero();
+        this->nullspaceProjector.setIdentity();
+
+        for (auto& level : this->lexicographicLevels)
+        {
+            // stack the tasks of the level. The within-level weights are applied as W^(1/2) row
+            // scaling so the level is solved in the weighted least-squares sense
+            std::size_t index = 0;
+            for (auto& taskWithPriority : level.tasks)
+            {
+                const auto& task = taskWithPriority.get().task;
+                const std::size_t size = task->size();
+                if (taskWithPriority.get().weightProvider != nullptr)
+                {
+                    const auto weight
+                        = taskWithPriority.get().weightProvider->getOutput().cwiseSqrt();
+                    level.stackedA.middleRows(index, size).noalias()
+                        = weight.asDiagonal() * task->getA();
+                    level.stackedB.segment(index, size).noalias()
+                        = weight.asDiagonal() * task->getB();
+                } else
+                {
+                    level.stackedA.middleRows(index, size) = task->getA();
+                    level.stackedB.segment(index, size) = task->getB();
+                }
+                index += size;
+            }
+
+            // project the level in the nullspace of the higher priority levels
+            level.projectedA.noalias() = level.stackedA * this->nullspaceProjector;
+
+            Eigen::CompleteOrthogonalDecomposition<Eigen::MatrixXd> decomposition(
+                level.projectedA);
+
+            // x_l = x_{l-1} + pinv(A_l N_{l-1}) (b_l - A_l x_{l-1})
+            this->lexicographicSolution.noalias() += decomposition.solve(
+                level.stackedB - level.stackedA * this->lexicographicSolution);
+
+            // N_l = N_{l-1} - pinv(A_l N_{l-1}) (A_l N_{l-1})
+            this->nullspaceProjector.noalias()
+                -= decomposition.pseudoInverse() * level.projectedA;
+        }
+
+        return true;
+    }
 };
 
 QPInverseKinematics::QPInverseKinematics()
@@ -166,10 +384,18 @@ bool QPInverseKinematics::addTask(std::shared_ptr<QPInverseKinematics::Task> tas
         return false;
     }
 
-    if (priority != 0 && priority != 1)
+    if (priority != 0 && priority != 1 && !m_pimpl->isLexicographicEnabled)
+    {
+        log()->error("{} - [Task name: '{}'] Priority greater than 1 is supported only when the "
+                     "lexicographic mode is enabled.",
+                     logPrefix,
+                     taskName);
+        return false;
+    }
+
+    if (m_pimpl->isLexicographicEnabled && task->type() == System::LinearTask::Type::inequality)
     {
-        log()->error("{} - [Task name: '{}'] For the time being we support only priority equal to "
-                     "0 or 1.",
+        log()->error("{} - [Task name: '{}'] The lexicographic mode supports only equality tasks.",
                      logPrefix,
                      taskName);
         return false;
@@ -189,7 +415,7 @@ bool QPInverseKinematics::addTask(std::shared_ptr<QPInverseKinematics::Task> tas
     m_pimpl->tasks[taskName].priority = priority;
 
     // If the priority is set to 1 the user has to provide the weight in terms of weight provider
-    if (priority == 1 && !weightProvider)
+    if (priority >= 1 && !weightProvider)
     {
         log()->error("{} - [Task name: '{}'] Please provide the associated weight. This is "
                      "necessary since the priority of the task is equal to 1",
@@ -202,7 +428,7 @@ bool QPInverseKinematics::addTask(std::shared_ptr<QPInverseKinematics::Task> tas
         return false;
     }
 
-    if (priority == 1 && weightProvider)
+    if (priority >= 1 && weightProvider)
     {
         if (weightProvider->getOutput().size() != task->size())
         {
@@ -251,10 +477,10 @@ bool QPInverseKinematics::setTaskWeight(
 
     auto taskWithPriority = tmp->second;
 
-    if (taskWithPriority.priority != 1)
+    if (taskWithPriority.priority < 1)
     {
         log()->error("{} - [Task name: '{}'] The weight can be set only to a task with priority "
-                     "equal to 1.",
+                     "greater or equal to 1.",
                      logPrefix,
                      taskName);
         return false;
@@ -307,6 +533,277 @@ QPInverseKinematics::getTaskWeightProvider(const std::string& taskName) const
     return taskWithPriority->second.weightProvider;
 }
 
+bool QPInverseKinematics::storeWarmStartData(const std::string& filePath) const
+{
+    constexpr auto logPrefix = "[QPInverseKinematics::storeWarmStartData]";
+
+    if (!m_pimpl->isValid)
+    {
+        log()->error("{} No valid solution is available. Please call advance() first.", logPrefix);
+        return false;
+    }
+
+    if (m_pimpl->isLexicographicEnabled)
+    {
+        log()->error("{} The warm-boot data can be stored only when the QP solver is used.",
+                     logPrefix);
+        return false;
+    }
+
+    std::ofstream file(filePath);
+    if (!file.is_open())
+    {
+        log()->error("{} Unable to open the file {}.", logPrefix, filePath);
+        return false;
+    }
+
+    const auto& primal = m_pimpl->solver.getSolution();
+    const auto& dual = m_pimpl->solver.getDualSolution();
+
+    file.precision(17);
+    file << m_pimpl->problemFingerprint() << '\n';
+    file << primal.size() << ' ' << dual.size() << '\n';
+    file << primal.transpose() << '\n';
+    file << dual.transpose() << '\n';
+
+    return file.good();
+}
+
+bool QPInverseKinematics::loadWarmStartData(const std::string& filePath)
+{
+    constexpr auto logPrefix = "[QPInverseKinematics::loadWarmStartData]";
+
+    if (!m_pimpl->isFinalized)
+    {
+        log()->error("{} Please call finalize() before loading the warm-boot data.", logPrefix);
+        return false;
+    }
+
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        log()->warn("{} Unable to open the file {}. The solver will cold start.",
+                    logPrefix,
+                    filePath);
+        return false;
+    }
+
+    std::size_t fingerprint{0};
+    Eigen::Index primalSize{0}, dualSize{0};
+    file >> fingerprint >> primalSize >> dualSize;
+
+    if (fingerprint != m_pimpl->problemFingerprint())
+    {
+        log()->warn("{} The file {} has been generated by a different problem. The solver will "
+                    "cold start.",
+                    logPrefix,
+                    filePath);
+        return false;
+    }
+
+    if (primalSize != m_pimpl->hessian.rows()
+        || dualSize != Eigen::Index(m_pimpl->numberOfConstraints))
+    {
+        log()->warn("{} The sizes stored in the file {} are not coherent with the problem. The "
+                    "solver will cold start.",
+                    logPrefix,
+                    filePath);
+        return false;
+    }
+
+    m_pimpl->warmStartPrimal.resize(primalSize);
+    m_pimpl->warmStartDual.resize(dualSize);
+    for (Eigen::Index i = 0; i < primalSize; i++)
+    {
+        file >> m_pimpl->warmStartPrimal[i];
+    }
+    for (Eigen::Index i = 0; i < dualSize; i++)
+    {
+        file >> m_pimpl->warmStartDual[i];
+    }
+
+    if (!file.good())
+    {
+        log()->warn("{} Unable to parse the file {}. The solver will cold start.",
+                    logPrefix,
+                    filePath);
+        return false;
+    }
+
+    m_pimpl->hasWarmStart = true;
+
+    return true;
+}
+
+bool QPInverseKinematics::setTaskEnabled(const std::string& taskName, bool isEnabled)
+{
+    constexpr auto logPrefix = "[QPInverseKinematics::setTaskEnabled]";
+
+    auto task = m_pimpl->tasks.find(taskName);
+    if (task == m_pimpl->tasks.end())
+    {
+        log()->error("{} The task named {} does not exist.", logPrefix, taskName);
+        return false;
+    }
+
+    task->second.isEnabled = isEnabled;
+
+    return true;
+}
+
+bool QPInverseKinematics::setTaskUpdateDecimation(const std::string& taskName,
+                                                  std::size_t decimation)
+{
+    constexpr auto logPrefix = "[QPInverseKinematics::setTaskUpdateDecimation]";
+
+    if (decimation == 0)
+    {
+        log()->error("{} The decimation must be strictly positive.", logPrefix);
+        return false;
+    }
+
+    auto task = m_pimpl->tasks.find(taskName);
+    if (task == m_pimpl->tasks.end())
+    {
+        log()->error("{} The task named {} does not exist.", logPrefix, taskName);
+        return false;
+    }
+
+    task->second.updateDecimation = decimation;
+
+    // the task is updated at the next call to advance() and the schedule restarts from there
+    task->second.updateCountdown = 0;
+
+    return true;
+}
+
+bool QPInverseKinematics::triggerTaskUpdate(const std::string& taskName)
+{
+    constexpr auto logPrefix = "[QPInverseKinematics::triggerTaskUpdate]";
+
+    auto task = m_pimpl->tasks.find(taskName);
+    if (task == m_pimpl->tasks.end())
+    {
+        log()->error("{} The task named {} does not exist.", logPrefix, taskName);
+        return false;
+    }
+
+    task->second.updateRequested = true;
+
+    return true;
+}
+
+bool QPInverseKinematics::setConcurrentTaskUpdateGroups(
+    const std::vector<std::vector<std::string>>& groups)
+{
+    constexpr auto logPrefix = "[QPInverseKinematics::setConcurrentTaskUpdateGroups]";
+
+    // an empty vector disables the concurrent update
+    if (groups.empty())
+    {
+        m_pimpl->parallelUpdater.setGroups({});
+        m_pimpl->useConcurrentUpdate = false;
+        return true;
+    }
+
+    std::unordered_map<std::string, bool> isTaskAssigned;
+    for (const auto& [name, task] : m_pimpl->tasks)
+    {
+        isTaskAssigned[name] = false;
+    }
+
+    // the first group runs on the calling thread and collects the tasks not listed by the user
+    std::vector<std::vector<System::ParallelTaskGroupUpdater::UpdateFunction>> updateGroups(1);
+
+    for (const auto& group : groups)
+    {
+        std::vector<System::ParallelTaskGroupUpdater::UpdateFunction> updateGroup;
+        for (const auto& name : group)
+        {
+            auto task = m_pimpl->tasks.find(name);
+            if (task == m_pimpl->tasks.end())
+            {
+                log()->error("{} Unable to find the task named {}.", logPrefix, name);
+                return false;
+            }
+
+            if (isTaskAssigned[name])
+            {
+                log()->error("{} The task named {} belongs to more than one group.",
+                             logPrefix,
+                             name);
+                return false;
+            }
+            isTaskAssigned[name] = true;
+
+            updateGroup.emplace_back([&taskWithPriority = task->second, name]() {
+                if (!taskWithPriority.shouldUpdate())
+                {
+                    return true;
+                }
+
+                if (!taskWithPriority.task->update())
+                {
+                    log()->error("[QPInverseKinematics::advance] Unable to update the task named "
+                                 "{}.",
+                                 name);
+                    return false;
+                }
+                assert(taskWithPriority.task->isValid() && "One of the task is not valid.");
+                return true;
+            });
+        }
+        updateGroups.emplace_back(std::move(updateGroup));
+    }
+
+    // the tasks not listed in any group are updated on the calling thread
+    for (auto& [name, task] : m_pimpl->tasks)
+    {
+        if (isTaskAssigned[name])
+        {
+            continue;
+        }
+
+        updateGroups.front().emplace_back([&taskWithPriority = task, name = name]() {
+            if (!taskWithPriority.shouldUpdate())
+            {
+                return true;
+            }
+
+            if (!taskWithPriority.task->update())
+            {
+                log()->error("[QPInverseKinematics::advance] Unable to update the task named {}.",
+                             name);
+                return false;
+            }
+            assert(taskWithPriority.task->isValid() && "One of the task is not valid.");
+            return true;
+        });
+    }
+
+    m_pimpl->parallelUpdater.setGroups(std::move(updateGroups));
+    m_pimpl->useConcurrentUpdate = true;
+
+    return true;
+}
+
+bool QPInverseKinematics::setExternalTaskUpdater(std::function<bool()> updater)
+{
+    // a nullptr restores the default per-task update loop
+    if (updater == nullptr)
+    {
+        m_pimpl->parallelUpdater.setGroups({});
+        m_pimpl->useConcurrentUpdate = false;
+        return true;
+    }
+
+    // a single group runs on the calling thread, no worker thread is spawned
+    m_pimpl->parallelUpdater.setGroups({{std::move(updater)}});
+    m_pimpl->useConcurrentUpdate = true;
+
+    return true;
+}
+
 bool QPInverseKinematics::finalize(const System::VariablesHandler& handler)
 {
     constexpr auto logPrefix = "[QPInverseKinematics::finalize]";
@@ -319,11 +816,22 @@ bool QPInverseKinematics::finalize(const System::VariablesHandler& handler)
 
     m_pimpl->isFinalized = false;
 
+    // register the profiler sections timing the phases of advance(). finalize() may be called
+    // several times, so the sections are registered only once
+    if (m_pimpl->taskUpdateSection == System::TimeProfiler::InvalidSectionIndex)
+    {
+        m_pimpl->taskUpdateSection = this->timeProfiler().registerSection("task-update");
+        m_pimpl->qpSolveSection = this->timeProfiler().registerSection("qp-solve");
+    }
+
     // clear the solver
     m_pimpl->solver.clearSolver();
 
     // set the some internal parameter of osqp-eigen
     m_pimpl->solver.settings()->setVerbosity(m_pimpl->isVerbose);
+    m_pimpl->solver.settings()->setRho(m_pimpl->osqpRho);
+    m_pimpl->solver.settings()->setSigma(m_pimpl->osqpSigma);
+    m_pimpl->solver.settings()->setScaling(m_pimpl->osqpScaling);
 
     // set the variable handler for all the tasks
     m_pimpl->numberOfConstraints = 0;
@@ -346,6 +854,48 @@ bool QPInverseKinematics::finalize(const System::VariablesHandler& handler)
         }
     }
 
+    // in the lexicographic mode the priorities are resolved with nullspace projections and the QP
+    // solver is not used
+    if (m_pimpl->isLexicographicEnabled)
+    {
+        std::map<std::size_t, std::vector<std::reference_wrapper<Impl::TaskWithPriority>>> levels;
+        for (auto& [name, task] : m_pimpl->tasks)
+        {
+            levels[task.priority].push_back(task);
+        }
+
+        m_pimpl->lexicographicLevels.clear();
+        for (auto& [priority, tasks] : levels)
+        {
+            auto& level = m_pimpl->lexicographicLevels.emplace_back();
+            level.tasks = std::move(tasks);
+            level.rows = 0;
+            for (const auto& task : level.tasks)
+            {
+                level.rows += task.get().task->size();
+            }
+
+            level.stackedA.resize(level.rows, handler.getNumberOfVariables());
+            level.stackedB.resize(level.rows);
+            level.projectedA.resize(level.rows, handler.getNumberOfVariables());
+        }
+
+        m_pimpl->lexicographicSolution.resize(handler.getNumberOfVariables());
+        m_pimpl->nullspaceProjector.resize(handler.getNumberOfVariables(),
+                                           handler.getNumberOfVariables());
+
+        if (!handler.getVariable(m_pimpl->robotVelocityVariable.name,
+                                 m_pimpl->robotVelocityVariable))
+        {
+            log()->error("{} Error while retrieving the robot velocity variable.", logPrefix);
+            return false;
+        }
+
+        m_pimpl->isFinalized = true;
+
+        return true;
+    }
+
     // resize the temporary matrix usefull to reduce dynamics allocation when advance() is called
     for (auto& cost : m_pimpl->costs)
     {
@@ -371,6 +921,16 @@ bool QPInverseKinematics::finalize(const System::VariablesHandler& handler)
     m_pimpl->upperBound.resize(m_pimpl->numberOfConstraints);
     m_pimpl->lowerBound.resize(m_pimpl->numberOfConstraints);
 
+    // allocate the persistent sparse structures with a fully populated pattern. The stacked task
+    // Jacobians are dense in the velocity variable, so the pattern never changes and advance()
+    // only refreshes the values
+    m_pimpl->hessianSparse
+        = Eigen::MatrixXd::Ones(handler.getNumberOfVariables(), handler.getNumberOfVariables())
+              .sparseView();
+    m_pimpl->constraintMatrixSparse
+        = Eigen::MatrixXd::Ones(m_pimpl->numberOfConstraints, handler.getNumberOfVariables())
+              .sparseView();
+
     if (!handler.getVariable(m_pimpl->robotVelocityVariable.name, m_pimpl->robotVelocityVariable))
     {
         log()->error("{} Error while retrieving the robot velocity variable.", logPrefix);
@@ -415,16 +975,63 @@ bool QPInverseKinematics::advance()
 
 
     // update of all the tasks
-    for (auto& [name, task] : m_pimpl->tasks)
     {
-        if (!task.task->update())
+        BLF_SCOPED_PROFILER(this->timeProfiler(), m_pimpl->taskUpdateSection);
+
+        if (m_pimpl->useConcurrentUpdate)
+        {
+            if (!m_pimpl->parallelUpdater.update())
+            {
+                log()->error("{} Unable to update one of the tasks.", logPrefix);
+                return false;
+            }
+        } else
+        {
+            for (auto& [name, task] : m_pimpl->tasks)
+            {
+                // the task may declare an update rate lower than the solver one. In that case the
+                // cached task matrices are reused
+                if (!task.shouldUpdate())
+                {
+                    continue;
+                }
+
+                if (!task.task->update())
+                {
+                    log()->error("{} Unable to update the task named {}.", logPrefix, name);
+                    return false;
+                }
+
+                // the outcome of isValid() should be the same of update. This test is required
+                assert(task.task->isValid() && "One of the task is not valid.");
+            }
+        }
+    }
+
+    // in the lexicographic mode the solution is computed analytically with nullspace projections
+    if (m_pimpl->isLexicographicEnabled)
+    {
+        if (!m_pimpl->solveLexicographic())
         {
-            log()->error("{} Unable to update the task named {}.", logPrefix, name);
+            log()->error("{} Unable to solve the lexicographic problem.", logPrefix);
             return false;
         }
 
-        // the outcome of isValid() should be the same of update. This test is required
-        assert(task.task->isValid() && "One of the task is not valid.");
+        constexpr std::size_t spatialVelocitySize = 6;
+        const std::size_t joints = m_pimpl->robotVelocityVariable.size - spatialVelocitySize;
+
+        m_pimpl->solution.jointVelocity
+            = m_pimpl->lexicographicSolution.segment(m_pimpl->robotVelocityVariable.offset
+                                                         + spatialVelocitySize,
+                                                     joints);
+
+        m_pimpl->solution.baseVelocity.coeffs()
+            = m_pimpl->lexicographicSolution.segment<spatialVelocitySize>(
+                m_pimpl->robotVelocityVariable.offset);
+
+        m_pimpl->isValid = true;
+
+        return true;
     }
 
     // Compute the gradient and the hessian
@@ -432,6 +1039,13 @@ bool QPInverseKinematics::advance()
     m_pimpl->gradient.setZero();
     for (auto& cost : m_pimpl->costs)
     {
+        // a disabled cost contributes to the problem with zero weight. Skipping it is equivalent
+        // and keeps the QP dimensions unchanged
+        if (!cost.get().isEnabled)
+        {
+            continue;
+        }
+
         Eigen::Ref<const Eigen::MatrixXd> A = cost.get().task->getA();
         Eigen::Ref<const Eigen::VectorXd> b = cost.get().task->getB();
 
@@ -459,6 +1073,21 @@ bool QPInverseKinematics::advance()
             return false;
         }
 
+        // a disabled constraint keeps its rows in the problem with zero coefficients and free
+        // bounds, so the number of constraints and the sparsity pattern stay fixed and the solver
+        // does not need to be re-initialized
+        if (!constraint.get().isEnabled)
+        {
+            m_pimpl->constraintMatrix.middleRows(index, constraint.get().task->size()).setZero();
+            m_pimpl->lowerBound.segment(index, constraint.get().task->size())
+                .setConstant(-OsqpEigen::INFTY);
+            m_pimpl->upperBound.segment(index, constraint.get().task->size())
+                .setConstant(OsqpEigen::INFTY);
+
+            index += constraint.get().task->size();
+            continue;
+        }
+
         Eigen::Ref<const Eigen::MatrixXd> A = constraint.get().task->getA();
         Eigen::Ref<const Eigen::VectorXd> b = constraint.get().task->getB();
 
@@ -479,6 +1108,12 @@ bool QPInverseKinematics::advance()
         index += constraint.get().task->size();
     }
 
+    // optionally dump the assembled instance for the offline settings tuning
+    if (!m_pimpl->problemRecordingFolder.empty())
+    {
+        m_pimpl->recordProblem();
+    }
+
     // update the solver
     if (!m_pimpl->isFirstIteration)
     {
@@ -495,10 +1130,30 @@ bool QPInverseKinematics::advance()
             return false;
         }
         m_pimpl->isFirstIteration = false;
+
+        // prime the solver with the primal/dual variables loaded from the warm-boot file so the
+        // first solve converges as fast as a steady-state one
+        if (m_pimpl->hasWarmStart)
+        {
+            if (!m_pimpl->solver.setPrimalVariable(m_pimpl->warmStartPrimal)
+                || !m_pimpl->solver.setDualVariable(m_pimpl->warmStartDual))
+            {
+                log()->warn("{} Unable to set the warm-boot primal/dual variables. The solver "
+                            "will cold start.",
+                            logPrefix);
+            }
+            m_pimpl->hasWarmStart = false;
+        }
     }
 
     // solve the QP
-    if (m_pimpl->solver.solveProblem() != OsqpEigen::ErrorExitFlag::NoError)
+    OsqpEigen::ErrorExitFlag exitFlag;
+    {
+        BLF_SCOPED_PROFILER(this->timeProfiler(), m_pimpl->qpSolveSection);
+        exitFlag = m_pimpl->solver.solveProblem();
+    }
+
+    if (exitFlag != OsqpEigen::ErrorExitFlag::NoError)
     {
         log()->error("{} Unable to to solve the problem.", logPrefix);
         return false;
@@ -584,6 +1239,28 @@ bool QPInverseKinematics::initialize(std::weak_ptr<const ParametersHandler::IPar
                     m_pimpl->isVerbose);
     }
 
+    if (!ptr->getParameter("enable_lexicographic_priorities", m_pimpl->isLexicographicEnabled))
+    {
+        log()->info("{} 'enable_lexicographic_priorities' not found. The following parameter will "
+                    "be used '{}'.",
+                    logPrefix,
+                    m_pimpl->isLexicographicEnabled);
+    }
+
+    // optional OSQP settings, e.g. the ones found offline by the osqp-settings-tuner utility. The
+    // defaults match the OSQP ones
+    ptr->getParameter("osqp_rho", m_pimpl->osqpRho);
+    ptr->getParameter("osqp_sigma", m_pimpl->osqpSigma);
+    ptr->getParameter("osqp_scaling", m_pimpl->osqpScaling);
+
+    if (ptr->getParameter("problem_recording_folder", m_pimpl->problemRecordingFolder)
+        && !m_pimpl->problemRecordingFolder.empty())
+    {
+        log()->info("{} The assembled QP instances will be recorded in the folder {}.",
+                    logPrefix,
+                    m_pimpl->problemRecordingFolder);
+    }
+
     m_pimpl->isInitialized = true;
 
     return true;
@@ -609,9 +1286,32 @@ std::string QPInverseKinematics::toString() const
 
 Eigen::Ref<const Eigen::VectorXd> QPInverseKinematics::getRawSolution() const
 {
+    if (m_pimpl->isLexicographicEnabled)
+    {
+        return m_pimpl->lexicographicSolution;
+    }
+
     return m_pimpl->solver.getSolution();
 }
 
+Eigen::Ref<const Eigen::VectorXd> QPInverseKinematics::getRawJointVelocitySolution() const
+{
+    constexpr std::size_t spatialVelocitySize = 6;
+    const std::size_t joints = m_pimpl->robotVelocityVariable.size - spatialVelocitySize;
+
+    return this->getRawSolution().segment(m_pimpl->robotVelocityVariable.offset
+                                              + spatialVelocitySize,
+                                          joints);
+}
+
+Eigen::Ref<const Eigen::VectorXd> QPInverseKinematics::getRawBaseVelocitySolution() const
+{
+    constexpr std::size_t spatialVelocitySize = 6;
+
+    return this->getRawSolution().segment(m_pimpl->robotVelocityVariable.offset,
+                                          spatialVelocitySize);
+}
+
 IntegrationBasedIKProblem
 QPInverseKinematics::build(std::weak_ptr<const ParametersHandler::IParametersHandler> handler,
                            std::shared_ptr<iDynTree::KinDynComputations> kinDyn)
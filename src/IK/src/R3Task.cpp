@@ -206,9 +206,12 @@ bool R3Task::update()
         return m_isValid;
     }
 
+    // fixed-size copy of the controller output evaluated once per update
+    const Eigen::Vector3d controllerOutput = getControllerState(m_R3Controller);
+
     if (m_DoFs == m_linearVelocitySize)
     {
-        m_b = getControllerState(m_R3Controller);
+        m_b = controllerOutput;
         iDynTree::toEigen(this->subA(m_robotVelocityVariable)) = m_jacobian.topRows<3>();
     } else
     {
@@ -220,7 +223,7 @@ bool R3Task::update()
         {
             if (m_mask[i])
             {
-                m_b(index) = getControllerState(m_R3Controller)(i);
+                m_b(index) = controllerOutput(i);
                 iDynTree::toEigen(this->subA(m_robotVelocityVariable)).row(index)
                     = m_jacobian.row(i);
                 index++;
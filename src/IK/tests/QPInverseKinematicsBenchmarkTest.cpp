@@ -0,0 +1,209 @@
+/**
+ * @file QPInverseKinematicsBenchmarkTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+// std
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// BipedalLocomotion
+#include <BipedalLocomotion/Conversions/ManifConversions.h>
+#include <BipedalLocomotion/IK/CoMTask.h>
+#include <BipedalLocomotion/IK/JointTrackingTask.h>
+#include <BipedalLocomotion/IK/QPInverseKinematics.h>
+#include <BipedalLocomotion/IK/SE3Task.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/System/VariablesHandler.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+#include <iDynTree/Core/EigenHelpers.h>
+#include <iDynTree/KinDynComputations.h>
+#include <iDynTree/Model/ModelTestUtils.h>
+
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion::IK;
+
+namespace
+{
+
+constexpr auto robotVelocity = "robotVelocity";
+
+std::shared_ptr<iDynTree::KinDynComputations> createKinDyn(std::size_t numberOfJoints)
+{
+    auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    REQUIRE(kinDyn->setFrameVelocityRepresentation(
+        iDynTree::FrameVelocityRepresentation::MIXED_REPRESENTATION));
+
+    const iDynTree::Model model = iDynTree::getRandomModel(numberOfJoints);
+    REQUIRE(kinDyn->loadRobotModel(model));
+
+    // set a repeatable robot state
+    std::default_random_engine generator;
+    generator.seed(42);
+    std::normal_distribution<double> distribution(0.0, 0.1);
+
+    const Eigen::Matrix4d basePose = Eigen::Matrix4d::Identity();
+    Eigen::VectorXd jointPositions(kinDyn->getNrOfDegreesOfFreedom());
+    for (int i = 0; i < jointPositions.size(); i++)
+    {
+        jointPositions[i] = distribution(generator);
+    }
+    const Eigen::Matrix<double, 6, 1> baseVelocity = Eigen::Matrix<double, 6, 1>::Zero();
+    const Eigen::VectorXd jointVelocities
+        = Eigen::VectorXd::Zero(kinDyn->getNrOfDegreesOfFreedom());
+    const Eigen::Vector3d gravity{0, 0, -9.81};
+
+    REQUIRE(kinDyn->setRobotState(basePose, jointPositions, baseVelocity, jointVelocities, gravity));
+
+    return kinDyn;
+}
+
+/**
+ * Build a representative task stack: an SE3 task and a CoM task as hard constraints plus a joint
+ * regularization task as weighted cost.
+ */
+std::shared_ptr<QPInverseKinematics>
+createSolver(std::shared_ptr<iDynTree::KinDynComputations> kinDyn,
+             const VariablesHandler& variablesHandler)
+{
+    constexpr double gain = 5.0;
+    const std::string frameName
+        = kinDyn->model().getFrameName(kinDyn->model().getNrOfFrames() - 1);
+
+    auto se3Handler = std::make_shared<StdImplementation>();
+    se3Handler->setParameter("robot_velocity_variable_name", robotVelocity);
+    se3Handler->setParameter("frame_name", frameName);
+    se3Handler->setParameter("kp_linear", gain);
+    se3Handler->setParameter("kp_angular", gain);
+
+    auto se3Task = std::make_shared<SE3Task>();
+    REQUIRE(se3Task->setKinDyn(kinDyn));
+    REQUIRE(se3Task->initialize(se3Handler));
+
+    auto comHandler = std::make_shared<StdImplementation>();
+    comHandler->setParameter("robot_velocity_variable_name", robotVelocity);
+    comHandler->setParameter("kp_linear", gain);
+
+    auto comTask = std::make_shared<CoMTask>();
+    REQUIRE(comTask->setKinDyn(kinDyn));
+    REQUIRE(comTask->initialize(comHandler));
+
+    auto regularizationHandler = std::make_shared<StdImplementation>();
+    regularizationHandler->setParameter("robot_velocity_variable_name", robotVelocity);
+    regularizationHandler->setParameter(
+        "kp",
+        std::vector<double>(kinDyn->getNrOfDegreesOfFreedom(), gain));
+
+    auto regularizationTask = std::make_shared<JointTrackingTask>();
+    REQUIRE(regularizationTask->setKinDyn(kinDyn));
+    REQUIRE(regularizationTask->initialize(regularizationHandler));
+
+    auto solverHandler = std::make_shared<StdImplementation>();
+    solverHandler->setParameter("robot_velocity_variable_name", robotVelocity);
+    solverHandler->setParameter("verbosity", false);
+
+    auto solver = std::make_shared<QPInverseKinematics>();
+    REQUIRE(solver->initialize(solverHandler));
+    REQUIRE(solver->addTask(se3Task, "se3_task", 0));
+    REQUIRE(solver->addTask(comTask, "com_task", 0));
+    REQUIRE(solver->addTask(regularizationTask,
+                            "regularization_task",
+                            1,
+                            Eigen::VectorXd::Ones(kinDyn->getNrOfDegreesOfFreedom())));
+
+    // set the set-points to the current robot configuration so the problem is always feasible
+    REQUIRE(se3Task->setSetPoint(
+        BipedalLocomotion::Conversions::toManifPose(kinDyn->getWorldTransform(frameName)),
+        manif::SE3d::Tangent::Zero()));
+    REQUIRE(comTask->setSetPoint(iDynTree::toEigen(kinDyn->getCenterOfMassPosition()),
+                                 Eigen::Vector3d::Zero()));
+    REQUIRE(regularizationTask->setSetPoint(
+        Eigen::VectorXd::Zero(kinDyn->getNrOfDegreesOfFreedom())));
+
+    REQUIRE(solver->finalize(variablesHandler));
+
+    return solver;
+}
+
+std::chrono::nanoseconds median(std::vector<std::chrono::nanoseconds> samples)
+{
+    const std::size_t index = samples.size() / 2;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+void runBenchmark(std::size_t numberOfJoints)
+{
+    constexpr int numberOfTicks = 200;
+
+    auto kinDyn = createKinDyn(numberOfJoints);
+
+    VariablesHandler variablesHandler;
+    REQUIRE(variablesHandler.addVariable(robotVelocity, kinDyn->getNrOfDegreesOfFreedom() + 6));
+
+    auto solver = createSolver(kinDyn, variablesHandler);
+
+    std::vector<std::chrono::nanoseconds> updateLatencies, advanceLatencies;
+    updateLatencies.reserve(numberOfTicks);
+    advanceLatencies.reserve(numberOfTicks);
+
+    for (int tick = 0; tick < numberOfTicks; tick++)
+    {
+        // task update phase measured in isolation
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& name : solver->getTaskNames())
+        {
+            REQUIRE(solver->getTask(name).lock()->update());
+        }
+        updateLatencies.push_back(std::chrono::steady_clock::now() - start);
+
+        // full advance(): task update + hessian/constraint assembly + OSQP solve + solution
+        // extraction
+        start = std::chrono::steady_clock::now();
+        REQUIRE(solver->advance());
+        advanceLatencies.push_back(std::chrono::steady_clock::now() - start);
+
+        REQUIRE(solver->isOutputValid());
+    }
+
+    const auto updateMedian = median(std::move(updateLatencies));
+    const auto advanceMedian = median(std::move(advanceLatencies));
+
+    // the assembly + solve + extraction phase is estimated as the difference between the two
+    // measurements since advance() internally performs the task update as well
+    BipedalLocomotion::log()->info("[benchmark_QPInverseKinematics] {} DoF: task update median = "
+                                   "{} us, advance() median = {} us, assembly+solve median = {} us",
+                                   numberOfJoints,
+                                   std::chrono::duration_cast<std::chrono::microseconds>(
+                                       updateMedian)
+                                       .count(),
+                                   std::chrono::duration_cast<std::chrono::microseconds>(
+                                       advanceMedian)
+                                       .count(),
+                                   std::chrono::duration_cast<std::chrono::microseconds>(
+                                       advanceMedian - updateMedian)
+                                       .count());
+}
+
+} // namespace
+
+TEST_CASE("QPInverseKinematics benchmark")
+{
+    for (const std::size_t numberOfJoints : {12, 23, 29, 53})
+    {
+        DYNAMIC_SECTION("Model with " << numberOfJoints << " joints")
+        {
+            runBenchmark(numberOfJoints);
+        }
+    }
+}
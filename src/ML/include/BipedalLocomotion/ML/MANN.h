@@ -82,6 +82,13 @@ struct MANNOutput
  * vol. 37, no. 4, pp. 1–11, 2018.](https://doi.org/10.1145/3197517.3201366) This class uses
  * `onnxruntime` to perform inference and it has been tested with an `onnx` model generated from
  * https://github.com/ami-iit/mann-pytorch
+ * @note In addition to the standard fp32 models, the class supports quantized models generated by
+ * the `blf-mann-quantizer` utility: an int8-quantized model keeps fp32 input and output and goes
+ * through the standard inference path, while a fp16 model exchanges half precision tensors that
+ * are automatically converted by the class.
+ * @note The instances of this class living in the same process share a single `onnxruntime`
+ * session (and therefore a single copy of the weights) when they load the very same model with
+ * the same session configuration. Each instance keeps its own input and output buffers.
  */
 class MANN : public BipedalLocomotion::System::Advanceable<MANNInput, MANNOutput>
 {
@@ -105,6 +112,10 @@ public:
      * |    `onnx_model_path`     |      `string`    |  Path to the `onnx` model that will be loaded to perform inference  |    Yes    |
      * |   `number_of_joints`     |       `int`      |         Number of robot joints considered in the model              |    Yes    |
      * | `projected_base_horizon` |       `int`      |    Number of samples of the base horizon considered in the model    |    Yes    |
+     * |   `number_of_threads`    |       `int`      | Number of threads used by `onnxruntime` to perform the inference. The default value is 1 |    No    |
+     * |       `batch_size`       |       `int`      | Number of samples evaluated by a single inference. The default value is 1 |    No    |
+     * |   `execution_provider`   |      `string`    | Execution provider used by `onnxruntime`. It can be `cpu`, `xnnpack`, `cuda` or `tensorrt`. If the requested provider is not available the class falls back to the default CPU execution. The default value is `cpu` |    No    |
+     * |     `gpu_device_id`      |       `int`      | Identifier of the GPU used by the `cuda` and `tensorrt` execution providers. The default value is 0 |    No    |
      * @return True in case of success, false otherwise.
      */
     bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> paramHandler) override;
@@ -113,11 +124,21 @@ public:
      * Set the input of the network
      * @param input the struct containing all the inputs of the network.
      * @return true if case of success, false otherwise.
+     * @note this function is equivalent to MANN::setInput(input, 0).
      */
     bool setInput(const MANNInput& input) override;
 
     /**
-     * Perform one step of the inference given the input set.
+     * Set the input of the network associated to a given sample of the batch.
+     * @param input the struct containing all the inputs of the network.
+     * @param batchIndex index of the sample in the batch. It must be lower than `batch_size`.
+     * @return true if case of success, false otherwise.
+     */
+    bool setInput(const MANNInput& input, std::size_t batchIndex);
+
+    /**
+     * Perform one step of the inference given the input set. All the samples of the batch are
+     * evaluated by a single call of the network.
      * @return true if case of success, false otherwise.
      */
     bool advance() override;
@@ -125,9 +146,17 @@ public:
     /**
      * Get the output of the network once advance has been called.
      * @return the output of the network.
+     * @note this function is equivalent to MANN::getOutput(0).
      */
     const MANNOutput& getOutput() const override;
 
+    /**
+     * Get the output of the network associated to a given sample of the batch.
+     * @param batchIndex index of the sample in the batch. It must be lower than `batch_size`.
+     * @return the output of the network.
+     */
+    const MANNOutput& getOutput(std::size_t batchIndex) const;
+
     /**
      * Check if the output of the network is valid.
      * @return true if it is valid, false otherwise.
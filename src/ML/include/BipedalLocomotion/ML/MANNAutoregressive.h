@@ -8,8 +8,9 @@
 #ifndef BIPEDAL_LOCOMOTION_ML_MANN_AUTOREGRESSIVE_H
 #define BIPEDAL_LOCOMOTION_ML_MANN_AUTOREGRESSIVE_H
 
+#include <array>
 #include <chrono>
-#include <deque>
+#include <cstddef>
 #include <memory>
 
 #include <Eigen/Dense>
@@ -96,21 +97,72 @@ public:
      */
     struct AutoregressiveState
     {
+        /** Length of 1 second of past trajectory stored in the autoregressive state. Since the
+         * original mocap data are collected at 50 Hz, and therefore the trajectory generation is
+         * assumed to proceed at 50 Hz, we need 50 datapoints to store the past second of
+         * trajectory. Along with the present datapoint, they sum up to 51! */
+        static constexpr std::size_t lengthOfPresentPlusPastTrajectory = 51;
+
+        /**
+         * PastTrajectory is a fixed-capacity circular buffer storing a past ground-projected
+         * trajectory. Differently from a std::deque, its storage is inline, so copying a snapshot
+         * of the autoregressive state is a flat copy without per-element allocations.
+         */
+        struct PastTrajectory
+        {
+            /** Elements of the trajectory. The buffer is circular, so the position of the oldest
+             * element is given by oldest. */
+            std::array<Eigen::Vector2d, lengthOfPresentPlusPastTrajectory> data;
+            std::size_t oldest{0}; /**< Index of the oldest element in data. */
+
+            /** Number of elements stored in the buffer. */
+            constexpr std::size_t size() const
+            {
+                return data.size();
+            }
+
+            /** Access the i-th element. The index 0 is associated to the oldest element. */
+            Eigen::Vector2d& operator[](std::size_t i)
+            {
+                return data[(oldest + i) % data.size()];
+            }
+
+            /** Access the i-th element. The index 0 is associated to the oldest element. */
+            const Eigen::Vector2d& operator[](std::size_t i) const
+            {
+                return data[(oldest + i) % data.size()];
+            }
+
+            /** Fill the buffer with a given datapoint. */
+            void fill(const Eigen::Vector2d& value)
+            {
+                data.fill(value);
+                oldest = 0;
+            }
+
+            /** Replace the oldest element with a new datapoint making it the newest one. */
+            void push(const Eigen::Vector2d& value)
+            {
+                data[oldest] = value;
+                oldest = (oldest + 1) % data.size();
+            }
+        };
+
         MANNInput previousMannInput; /**< Mann Input at the previous time instant */
         manif::SE2d I_H_FD; /**< SE(2) transformation of the facing direction respect to the
                                inertial frame*/
 
-        /** Past projected base position, Each element of the deque contains the x and y position
+        /** Past projected base position, Each element of the buffer contains the x and y position
          * projected into the ground. */
-        std::deque<Eigen::Vector2d> pastProjectedBasePositions;
+        PastTrajectory pastProjectedBasePositions;
 
-        /** Past projected facing direction, Each element of the deque contains the x and y
+        /** Past projected facing direction, Each element of the buffer contains the x and y
          * direction  projected into the ground. */
-        std::deque<Eigen::Vector2d> pastFacingDirection;
+        PastTrajectory pastFacingDirection;
 
-        /** Past projected base velocity, Each element of the deque contains the x and y velocity
+        /** Past projected base velocity, Each element of the buffer contains the x and y velocity
          * projected into the ground. */
-        std::deque<Eigen::Vector2d> pastProjectedBaseVelocity;
+        PastTrajectory pastProjectedBaseVelocity;
     };
 
     /**
@@ -131,6 +183,19 @@ public:
      */
     bool setRobotModel(const iDynTree::Model& model);
 
+    /**
+     * Set a MANN network shared with other MANNAutoregressive instances.
+     * @param mann pointer to an already initialized network whose `batch_size` is equal to the
+     * number of instances sharing it.
+     * @param batchIndex index of the sample of the batch associated to this instance.
+     * @return true in case of success, false otherwise.
+     * @note this function must be called before initialize(). When the network is shared, this
+     * class only writes its input sample and reads its output sample, while the owner of the
+     * network is in charge of calling MANN::advance() to perform the single batched inference for
+     * all the instances.
+     */
+    bool setSharedMANN(std::shared_ptr<MANN> mann, std::size_t batchIndex);
+
     /**
      * Initialize the network.
      * @param paramHandler pointer to the parameters handler.
@@ -143,6 +208,8 @@ public:
      * | `right_foot_frame_name`  | `string` |                                 Name of of the right foot frame in the model.                                 |    Yes    |
      * |  `left_foot_frame_name`  | `string` |                                  Name of of the left foot frame in the model.                                 |    Yes    |
      * |    `forward_direction`   | `string` | String cointaining 'x', 'y' or 'z' representing the foot link forward axis. Currently, only 'x' is supported. |    Yes    |
+     * | `asynchronous_inference` |  `bool`  | If true the network inference starts in a separate thread when setInput() is called and its result is collected by advance(). The default value is False. |    No    |
+     * | `joint_output_filter_settling_time` | `double` | 5% settling time of the first order low-pass filter applied in place to the joint positions and velocities produced by the network. It must be greater than 3 times the sampling time. If not present the filter is disabled. |    No    |
      * It is also required to define two groups `LEFT_FOOT` and `RIGHT_FOOT` that contains the following parameter
      * |    Parameter Name    |       Type       |                                                        Description                                                           | Mandatory |
      * |:--------------------:|:----------------:|:----------------------------------------------------------------------------------------------------------------------------:|:---------:|
@@ -165,12 +232,19 @@ public:
      * Set the input to the autoregressive model.
      * @param input input to the model
      * @return true in case of success, false otherwise.
+     * @note If `asynchronous_inference` is enabled, this function also starts the network
+     * inference in a separate thread. To overlap the inference with other computations (e.g. an
+     * MPC solve) call setInput() as soon as the new desired trajectories are available and
+     * postpone the call of advance().
      */
     bool setInput(const Input& input) override;
 
     /**
      * Perform one step of the autoregressive model
      * @return true in case of success, false otherwise.
+     * @note If `asynchronous_inference` is enabled, this function waits for the inference started
+     * by setInput() and then updates the autoregressive state, otherwise the network is evaluated
+     * here.
      */
     bool advance() override;
 
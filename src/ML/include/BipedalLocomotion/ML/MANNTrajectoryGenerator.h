@@ -9,6 +9,7 @@
 #define BIPEDAL_LOCOMOTION_ML_MANN_TRAJECTORY_GENERATOR_H
 
 #include <memory>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -110,6 +111,7 @@ public:
      * |  `left_foot_frame_name`  | `string` |                                  Name of of the left foot frame in the model.                                 |    Yes    |
      * |    `forward_direction`   | `string` | String cointaining 'x', 'y' or 'z' representing the foot link forward axis. Currently, only 'x' is supported. |    Yes    |
      * |    `slow_down_factor`    |   `int`  |      The `horizon` will be `horizon * slow_down_factor`. Same for the `sampling_time` (default value 1).      |    No     |
+     * |       `batch_size`       |   `int`  | Number of candidate trajectories evaluated by a single batched inference with setBatchedInput() and advanceBatched() (default value 1). |    No     |
      * It is also required to define two groups `LEFT_FOOT` and `RIGHT_FOOT` that contains the following parameter
      * |      Parameter Name      |        Type       |                                        Description                                             | Mandatory |
      * |:------------------------:|:-----------------:|:----------------------------------------------------------------------------------------------:|:---------:|
@@ -137,18 +139,51 @@ public:
      */
     bool advance() override;
 
+    /**
+     * Set the inputs associated to a batch of candidate trajectories.
+     * @param inputs vector of inputs, one for each candidate. Its size must be equal to the
+     * `batch_size` parameter.
+     * @return true in case of success, false otherwise.
+     * @note This function requires the `batch_size` parameter to be greater than one. Each
+     * candidate is reset from the merge point specified by its input, so several inputs can be
+     * evaluated in parallel starting from the same committed trajectory.
+     */
+    bool setBatchedInput(const std::vector<Input>& inputs);
+
+    /**
+     * Generate all the candidate trajectories set with setBatchedInput(). At each step of the
+     * horizon the candidates are evaluated with a single batched inference of the network.
+     * @return true in case of success, false otherwise.
+     * @note Differently from advance(), this function does not update the merge point states.
+     * Once a candidate is selected, its input should be committed with setInput() and advance()
+     * to generate the trajectory used as merge point for the next evaluation.
+     */
+    bool advanceBatched();
+
     /**
      * Check if the output is valid.
      * @return true if the output is valid, false otherwise.
      */
     bool isOutputValid() const override;
 
+    /**
+     * Check if the output of the batched evaluation is valid.
+     * @return true if the output is valid, false otherwise.
+     */
+    bool isBatchedOutputValid() const;
+
     /**
      * Get the output from trajectory.
      * @return the output of the system.
      */
     const Output& getOutput() const override;
 
+    /**
+     * Get the output of the batched evaluation, one for each candidate trajectory.
+     * @return the outputs of the system.
+     */
+    const std::vector<Output>& getBatchedOutput() const;
+
     /**
      * Set the initial state of the planner.
      * @param jointPositions position of the joints.
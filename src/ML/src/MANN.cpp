@@ -5,8 +5,15 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -21,6 +28,119 @@
 using namespace BipedalLocomotion::ML;
 using namespace BipedalLocomotion;
 
+namespace
+{
+
+/**
+ * Convert a single precision floating point number into a half precision one stored as IEEE 754
+ * binary16.
+ */
+std::uint16_t floatToHalf(const float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const std::uint16_t sign = (bits >> 16) & 0x8000;
+    bits &= 0x7fffffff;
+
+    // the number is not representable in half precision. Saturate to infinity or propagate the nan
+    if (bits >= 0x47800000)
+    {
+        return sign | ((bits > 0x7f800000) ? 0x7e00 : 0x7c00);
+    }
+
+    // the number is subnormal in half precision
+    if (bits < 0x38800000)
+    {
+        const std::uint32_t mantissa = (bits & 0x007fffff) | 0x00800000;
+        const int shift = 126 - static_cast<int>(bits >> 23);
+        return sign | static_cast<std::uint16_t>(shift < 24 ? mantissa >> shift : 0);
+    }
+
+    return sign | static_cast<std::uint16_t>(((bits - 0x38000000) + 0x00001000) >> 13);
+}
+
+/**
+ * Convert a half precision floating point number stored as IEEE 754 binary16 into a single
+ * precision one.
+ */
+/**
+ * Get the session associated to a given model path and session configuration. The sessions
+ * already created by this process are stored in a registry, so several MANN instances loading the
+ * very same model share a single session (and therefore a single copy of the weights) while
+ * keeping independent IoBindings. A session is destroyed when the last instance using it is
+ * destroyed.
+ */
+std::shared_ptr<Ort::Session> getOrCreateSession(const std::string& key,
+                                                 const std::string& modelPath,
+                                                 const Ort::SessionOptions& sessionOptions)
+{
+    // the environment must outlive the sessions, so it is shared by all the sessions created by
+    // this process
+    static Ort::Env env;
+    static std::mutex registryMutex;
+    static std::unordered_map<std::string, std::weak_ptr<Ort::Session>> registry;
+
+    const std::lock_guard<std::mutex> lock(registryMutex);
+
+    auto it = registry.find(key);
+    if (it != registry.end())
+    {
+        if (auto session = it->second.lock())
+        {
+            return session;
+        }
+    }
+
+    // Ort::Session's constructor is OS-dependent, wants wchar_t* on Windows and char* on other OSs
+    // Note: this only works with single-byte characters, such as ASCII or ISO-8859-1,
+    // see https://stackoverflow.com/questions/2573834/c-convert-string-or-char-to-wstring-or-wchar-t
+    std::basic_string<ORTCHAR_T> modelPathAsOrtString(modelPath.begin(), modelPath.end());
+
+    auto session
+        = std::make_shared<Ort::Session>(env, modelPathAsOrtString.c_str(), sessionOptions);
+    registry[key] = session;
+
+    return session;
+}
+
+float halfToFloat(const std::uint16_t value)
+{
+    const std::uint32_t sign = static_cast<std::uint32_t>(value & 0x8000) << 16;
+    const std::uint32_t exponent = (value >> 10) & 0x1f;
+    std::uint32_t mantissa = value & 0x3ff;
+
+    std::uint32_t bits;
+    if (exponent == 0x1f)
+    {
+        // infinity or nan
+        bits = sign | 0x7f800000 | (mantissa << 13);
+    } else if (exponent != 0)
+    {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa != 0)
+    {
+        // the number is subnormal in half precision but normal in single precision
+        int normalizationShift = 0;
+        while ((mantissa & 0x400) == 0)
+        {
+            mantissa <<= 1;
+            normalizationShift++;
+        }
+        bits = sign | static_cast<std::uint32_t>(113 - normalizationShift) << 23
+               | ((mantissa & 0x3ff) << 13);
+    } else
+    {
+        bits = sign;
+    }
+
+    float output;
+    std::memcpy(&output, &bits, sizeof(output));
+    return output;
+}
+
+} // namespace
+
 struct MANN::Impl
 {
     enum class FSM
@@ -32,6 +152,8 @@ struct MANN::Impl
     {
         BipedalLocomotion::System::VariablesHandler handler;
         Eigen::VectorXf rawData;
+        std::vector<std::uint16_t> rawDataHalf; /**< Buffer storing the data in half precision. It
+                                                   is used only if the model is stored in fp16. */
 
         Ort::Value tensor{nullptr};
         std::array<int64_t, 2> shape;
@@ -40,15 +162,25 @@ struct MANN::Impl
     DataStructured structuredInput;
     DataStructured structuredOutput;
 
-    MANNOutput output;
+    std::vector<MANNOutput> outputs; /**< One output for each sample in the batch. */
+
+    std::size_t batchSize{1}; /**< Number of samples evaluated by a single inference. */
+    std::size_t inputSize{0}; /**< Size of the input of a single sample. */
+    std::size_t outputSize{0}; /**< Size of the output of a single sample. */
 
     Ort::MemoryInfo memoryInfo;
 
-    Ort::Env env;
-    std::unique_ptr<Ort::Session> session;
+    std::shared_ptr<Ort::Session> session; /**< Session possibly shared with other instances
+                                              loading the same model. */
+    Ort::IoBinding ioBinding{nullptr}; /**< Binding between the network and the input and output
+                                          tensors. It must be declared after the session since it
+                                          has to be destroyed first. */
+
+    bool useFloat16{false}; /**< True if the model stores the input and the output in half
+                               precision. */
 
     Impl();
-    bool populateInput(const MANNInput& input);
+    bool populateInput(const MANNInput& input, std::size_t batchIndex);
 
     FSM state{FSM::NotInitialized};
 };
@@ -58,13 +190,16 @@ MANN::Impl::Impl()
 {
 }
 
-bool MANN::Impl::populateInput(const MANNInput& input)
+bool MANN::Impl::populateInput(const MANNInput& input, std::size_t batchIndex)
 {
     constexpr auto logPrefix = "[MANN::Impl::populateInput]";
 
+    // the samples are stored one after the other in the raw buffer
+    const std::size_t sampleOffset = batchIndex * this->inputSize;
+
     auto populateVectorData
-        = [&input, this, logPrefix](const std::string& variableName,
-                                    Eigen::Ref<const Eigen::VectorXd> data) -> bool {
+        = [&input, this, sampleOffset, logPrefix](const std::string& variableName,
+                                                  Eigen::Ref<const Eigen::VectorXd> data) -> bool {
         const auto& variable = this->structuredInput.handler.getVariable(variableName);
         if (data.size() != variable.size)
         {
@@ -77,13 +212,15 @@ bool MANN::Impl::populateInput(const MANNInput& input)
             return false;
         }
 
-        this->structuredInput.rawData.segment(variable.offset, variable.size) = data.cast<float>();
+        this->structuredInput.rawData.segment(sampleOffset + variable.offset, variable.size)
+            = data.cast<float>();
         return true;
     };
 
     auto populateProjectedData
         = [&input,
            this,
+           sampleOffset,
            logPrefix](const std::string& variableName,
                       Eigen::Ref<const Eigen::Matrix2Xd> data) -> bool {
         const auto& variable = this->structuredInput.handler.getVariable(variableName);
@@ -104,7 +241,7 @@ bool MANN::Impl::populateInput(const MANNInput& input)
         // [x1, x2, ..., xn;
         //  y1, y2, ..., yn]
         // becomes [x1, y1, x2, y2, ...., xn, yn]
-        this->structuredInput.rawData.segment(variable.offset, variable.size)
+        this->structuredInput.rawData.segment(sampleOffset + variable.offset, variable.size)
             = Eigen::Map<const Eigen::VectorXd>(data.data(), data.cols() * data.rows())
                   .cast<float>();
 
@@ -167,14 +304,109 @@ bool MANN::initialize(
         return false;
     }
 
-    // Ort::Session's constructor is OS-dependent, wants wchar_t* on Windows and char* on other OSs
-    // Note: this only works with single-byte characters, such as ASCII or ISO-8859-1,
-    // see https://stackoverflow.com/questions/2573834/c-convert-string-or-char-to-wstring-or-wchar-t
-    std::basic_string<ORTCHAR_T> networkModelPathAsOrtString(networkModelPath.begin(), networkModelPath.end());
+    int batchSize = 1;
+    if (!ptr->getParameter("batch_size", batchSize))
+    {
+        log()->info("{} The parameter 'batch_size' is not found. The following parameter will be "
+                    "used {}.",
+                    logPrefix,
+                    batchSize);
+    }
+    if (batchSize <= 0)
+    {
+        log()->error("{} The parameter 'batch_size' must be a positive number.", logPrefix);
+        return false;
+    }
+    m_pimpl->batchSize = batchSize;
+
+    int numberOfThreads = 1;
+    if (!ptr->getParameter("number_of_threads", numberOfThreads))
+    {
+        log()->info("{} The parameter 'number_of_threads' is not found. The following parameter "
+                    "will be used {}.",
+                    logPrefix,
+                    numberOfThreads);
+    }
+
+    std::string executionProvider = "cpu";
+    if (!ptr->getParameter("execution_provider", executionProvider))
+    {
+        log()->info("{} The parameter 'execution_provider' is not found. The following parameter "
+                    "will be used {}.",
+                    logPrefix,
+                    executionProvider);
+    }
 
-    m_pimpl->session = std::make_unique<Ort::Session>(m_pimpl->env,
-                                                      networkModelPathAsOrtString.c_str(),
-                                                      Ort::SessionOptions{nullptr});
+    int gpuDeviceId = 0;
+    if (!ptr->getParameter("gpu_device_id", gpuDeviceId)
+        && (executionProvider == "cuda" || executionProvider == "tensorrt"))
+    {
+        log()->info("{} The parameter 'gpu_device_id' is not found. The following parameter will "
+                    "be used {}.",
+                    logPrefix,
+                    gpuDeviceId);
+    }
+
+    // the memory arena is preallocated by onnxruntime and reused at every inference, while the
+    // intra-op threads are limited to avoid oversubscribing the cores running the control loop
+    Ort::SessionOptions sessionOptions;
+    sessionOptions.SetIntraOpNumThreads(numberOfThreads);
+    sessionOptions.EnableCpuMemArena();
+
+    // enable the requested execution provider. If onnxruntime has not been built with its
+    // support, the session falls back to the default CPU execution
+    try
+    {
+        if (executionProvider == "xnnpack")
+        {
+            sessionOptions.AppendExecutionProvider("XNNPACK",
+                                                   {{"intra_op_num_threads",
+                                                     std::to_string(numberOfThreads)}});
+
+            // XNNPACK manages its own thread pool, so the onnxruntime one is reduced to a single
+            // thread as recommended by the onnxruntime documentation
+            sessionOptions.SetIntraOpNumThreads(1);
+        } else if (executionProvider == "cuda")
+        {
+            OrtCUDAProviderOptions cudaOptions;
+            cudaOptions.device_id = gpuDeviceId;
+            sessionOptions.AppendExecutionProvider_CUDA(cudaOptions);
+        } else if (executionProvider == "tensorrt")
+        {
+            // the CUDA execution provider is appended after the TensorRT one so that the nodes
+            // not supported by TensorRT still run on the GPU
+            OrtTensorRTProviderOptions tensorRTOptions{};
+            tensorRTOptions.device_id = gpuDeviceId;
+            sessionOptions.AppendExecutionProvider_TensorRT(tensorRTOptions);
+
+            OrtCUDAProviderOptions cudaOptions;
+            cudaOptions.device_id = gpuDeviceId;
+            sessionOptions.AppendExecutionProvider_CUDA(cudaOptions);
+        } else if (executionProvider != "cpu")
+        {
+            log()->error("{} Unknown execution provider named '{}'. The supported providers are: "
+                         "'cpu', 'xnnpack', 'cuda', 'tensorrt'.",
+                         logPrefix,
+                         executionProvider);
+            return false;
+        }
+    } catch (const Ort::Exception& exception)
+    {
+        log()->warn("{} Unable to enable the '{}' execution provider: '{}'. The default CPU "
+                    "execution will be used.",
+                    logPrefix,
+                    executionProvider,
+                    exception.what());
+        executionProvider = "cpu";
+    }
+
+    // the key identifies the sessions that can be shared: two instances share a session if and
+    // only if they load the same model with the same session configuration
+    const std::string sessionKey = networkModelPath + "|" + executionProvider + "|"
+                                   + std::to_string(numberOfThreads) + "|"
+                                   + std::to_string(gpuDeviceId);
+
+    m_pimpl->session = ::getOrCreateSession(sessionKey, networkModelPath, sessionOptions);
 
     if (m_pimpl->session == nullptr)
     {
@@ -182,6 +414,29 @@ bool MANN::initialize(
         return false;
     }
 
+    // detect the precision of the model. An int8-quantized network keeps single precision
+    // interfaces (the quantize/dequantize nodes live inside the graph), so it goes through the
+    // standard path. A fp16 network exchanges half precision tensors that are converted by this
+    // class
+    const ONNXTensorElementDataType inputElementType
+        = m_pimpl->session->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetElementType();
+    const ONNXTensorElementDataType outputElementType
+        = m_pimpl->session->GetOutputTypeInfo(0).GetTensorTypeAndShapeInfo().GetElementType();
+
+    if (inputElementType != outputElementType
+        || (inputElementType != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT
+            && inputElementType != ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16))
+    {
+        log()->error("{} The model in: '{}' exchanges tensors that are neither fp32 nor fp16. "
+                     "Please notice that an int8-quantized model is expected to keep fp32 input "
+                     "and output.",
+                     logPrefix,
+                     networkModelPath);
+        return false;
+    }
+
+    m_pimpl->useFloat16 = (inputElementType == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16);
+
     // the input of the network is composed by
     const std::size_t inputSize = 2 * projectedBaseHorizon // position of the base on x and y
                                                            // coordinate in the horizon
@@ -193,18 +448,36 @@ bool MANN::initialize(
                                   + numberOfJoints // joints positions
                                   + numberOfJoints; // joints velocities
 
+    // create the tensor required by onnx. The samples of the batch are stored one after the other
+    // in the raw buffer. If the model is stored in half precision the tensor wraps a dedicated
+    // buffer populated from the single precision one
+    auto createTensor = [this](Impl::DataStructured& data, const std::size_t size) {
+        data.rawData.resize(m_pimpl->batchSize * size);
+        data.shape[0] = m_pimpl->batchSize; // batch
+        data.shape[1] = size;
+
+        if (!m_pimpl->useFloat16)
+        {
+            data.tensor = Ort::Value::CreateTensor<float>(m_pimpl->memoryInfo,
+                                                          data.rawData.data(),
+                                                          data.rawData.size(),
+                                                          data.shape.data(),
+                                                          data.shape.size());
+            return;
+        }
+
+        data.rawDataHalf.resize(m_pimpl->batchSize * size);
+        data.tensor = Ort::Value::CreateTensor(m_pimpl->memoryInfo,
+                                               data.rawDataHalf.data(),
+                                               data.rawDataHalf.size() * sizeof(std::uint16_t),
+                                               data.shape.data(),
+                                               data.shape.size(),
+                                               ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16);
+    };
+
     // resize the input
-    m_pimpl->structuredInput.rawData.resize(inputSize);
-    m_pimpl->structuredInput.shape[0] = 1; // batch
-    m_pimpl->structuredInput.shape[1] = inputSize;
-
-    // create tensor required by onnx
-    m_pimpl->structuredInput.tensor
-        = Ort::Value::CreateTensor<float>(m_pimpl->memoryInfo,
-                                          m_pimpl->structuredInput.rawData.data(),
-                                          m_pimpl->structuredInput.rawData.size(),
-                                          m_pimpl->structuredInput.shape.data(),
-                                          m_pimpl->structuredInput.shape.size());
+    m_pimpl->inputSize = inputSize;
+    createTensor(m_pimpl->structuredInput, inputSize);
 
     // populate variable handler related to the input
     // the serialization matters
@@ -229,17 +502,15 @@ bool MANN::initialize(
                                    + 3; // x y and omega component of the velocity
 
     // resize the output
-    m_pimpl->structuredOutput.rawData.resize(outputSize);
-    m_pimpl->structuredOutput.shape[0] = 1; // batch
-    m_pimpl->structuredOutput.shape[1] = outputSize;
-
-    // create tensor required by onnx
-    m_pimpl->structuredOutput.tensor
-        = Ort::Value::CreateTensor<float>(m_pimpl->memoryInfo,
-                                          m_pimpl->structuredOutput.rawData.data(),
-                                          m_pimpl->structuredOutput.rawData.size(),
-                                          m_pimpl->structuredOutput.shape.data(),
-                                          m_pimpl->structuredOutput.shape.size());
+    m_pimpl->outputSize = outputSize;
+    createTensor(m_pimpl->structuredOutput, outputSize);
+
+    // the tensors wrap preallocated buffers, so they can be bound to the network once for all and
+    // reused at every inference
+    m_pimpl->ioBinding = Ort::IoBinding(*m_pimpl->session);
+    m_pimpl->ioBinding.BindInput("input", m_pimpl->structuredInput.tensor);
+    m_pimpl->ioBinding.BindOutput("output", m_pimpl->structuredOutput.tensor);
+
     // populate variable handler related to the output
     // the serialization matters
     m_pimpl->structuredOutput.handler.addVariable("future_base_positions",
@@ -252,13 +523,32 @@ bool MANN::initialize(
     m_pimpl->structuredOutput.handler.addVariable("joint_velocities", numberOfJoints);
     m_pimpl->structuredOutput.handler.addVariable("base_velocity", 3);
 
-    // resize the output
-    m_pimpl->output.futureBasePositionTrajectory.resize(2, projectedBaseHorizon / 2);
-    m_pimpl->output.futureFacingDirectionTrajectory.resize(2, projectedBaseHorizon / 2);
-    m_pimpl->output.futureBaseVelocitiesTrajectory.resize(2, projectedBaseHorizon / 2);
-    m_pimpl->output.jointPositions.resize(numberOfJoints);
-    m_pimpl->output.jointVelocities.resize(numberOfJoints);
-    m_pimpl->output.projectedBaseVelocity = manif::SE2Tangentd::Zero();
+    // when a non CPU execution provider is used, the first inference may absorb a significant
+    // one-time latency (e.g. kernel compilation with CUDA or TensorRT). A warm-up inference on a
+    // zero input moves that latency inside initialize()
+    if (executionProvider != "cpu")
+    {
+        m_pimpl->structuredInput.rawData.setZero();
+        if (m_pimpl->useFloat16)
+        {
+            std::fill(m_pimpl->structuredInput.rawDataHalf.begin(),
+                      m_pimpl->structuredInput.rawDataHalf.end(),
+                      std::uint16_t(0));
+        }
+        m_pimpl->session->Run(Ort::RunOptions(), m_pimpl->ioBinding);
+    }
+
+    // resize the outputs, one for each sample of the batch
+    m_pimpl->outputs.resize(m_pimpl->batchSize);
+    for (MANNOutput& output : m_pimpl->outputs)
+    {
+        output.futureBasePositionTrajectory.resize(2, projectedBaseHorizon / 2);
+        output.futureFacingDirectionTrajectory.resize(2, projectedBaseHorizon / 2);
+        output.futureBaseVelocitiesTrajectory.resize(2, projectedBaseHorizon / 2);
+        output.jointPositions.resize(numberOfJoints);
+        output.jointVelocities.resize(numberOfJoints);
+        output.projectedBaseVelocity = manif::SE2Tangentd::Zero();
+    }
 
     m_pimpl->state = Impl::FSM::Initialized;
 
@@ -267,54 +557,96 @@ bool MANN::initialize(
 
 bool MANN::setInput(const MANNInput& input)
 {
+    return this->setInput(input, 0);
+}
+
+bool MANN::setInput(const MANNInput& input, std::size_t batchIndex)
+{
+    constexpr auto logPrefix = "[MANN::setInput]";
+
     if (m_pimpl->state != Impl::FSM::Initialized && m_pimpl->state != Impl::FSM::Running)
     {
-        log()->error("[MANN::setInput] The network is not initialized, please call initialize()");
+        log()->error("{} The network is not initialized, please call initialize()", logPrefix);
+        return false;
+    }
+
+    if (batchIndex >= m_pimpl->batchSize)
+    {
+        log()->error("{} Invalid batch index. Index: {}, batch size: {}.",
+                     logPrefix,
+                     batchIndex,
+                     m_pimpl->batchSize);
         return false;
     }
-    return m_pimpl->populateInput(input);
+
+    return m_pimpl->populateInput(input, batchIndex);
 }
 
 bool MANN::advance()
 {
-    auto unpackMatrix
-        = [this](const std::string& variableName, Eigen::Ref<Eigen::MatrixXd> matrix) {
-              const auto& variable = m_pimpl->structuredOutput.handler.getVariable(variableName);
-              assert(variable.isValid());
-
-              // the matrix has been already allocated
-              const std::size_t rows = matrix.rows();
-              const std::size_t cols = matrix.cols();
-
-              matrix = Eigen::Map<const Eigen::MatrixXf>(
-                  m_pimpl->structuredOutput.rawData.segment(variable.offset, variable.size).data(),
-                  rows,
-                  cols).cast<double>();
-
-              return;
-          };
-
-    const char* inputNames[] = {"input"};
-    const char* outputNames[] = {"output"};
-
-    m_pimpl->session->Run(Ort::RunOptions(),
-                          inputNames,
-                          &(m_pimpl->structuredInput.tensor),
-                          1,
-                          outputNames,
-                          &(m_pimpl->structuredOutput.tensor),
-                          1);
-
-    unpackMatrix("future_base_positions", m_pimpl->output.futureBasePositionTrajectory);
-    unpackMatrix("future_facing_directions", m_pimpl->output.futureFacingDirectionTrajectory);
-    unpackMatrix("future_base_velocities", m_pimpl->output.futureBaseVelocitiesTrajectory);
-    unpackMatrix("joint_positions", m_pimpl->output.jointPositions);
-    unpackMatrix("joint_velocities", m_pimpl->output.jointVelocities);
-
-    Eigen::Vector3d tempVector;
-    unpackMatrix("base_velocity", tempVector);
-    m_pimpl->output.projectedBaseVelocity
-        = manif::SE2Tangentd(tempVector(0), tempVector(1), tempVector(2));
+    auto unpackMatrix = [this](const std::string& variableName,
+                               const std::size_t sampleOffset,
+                               Eigen::Ref<Eigen::MatrixXd> matrix) {
+        const auto& variable = m_pimpl->structuredOutput.handler.getVariable(variableName);
+        assert(variable.isValid());
+
+        // the matrix has been already allocated
+        const std::size_t rows = matrix.rows();
+        const std::size_t cols = matrix.cols();
+
+        matrix = Eigen::Map<const Eigen::MatrixXf>(m_pimpl->structuredOutput.rawData
+                                                       .segment(sampleOffset + variable.offset,
+                                                                variable.size)
+                                                       .data(),
+                                                   rows,
+                                                   cols)
+                     .cast<double>();
+
+        return;
+    };
+
+    // if the model is stored in half precision the input must be converted before the inference
+    // and the output after it
+    if (m_pimpl->useFloat16)
+    {
+        for (std::size_t i = 0; i < m_pimpl->structuredInput.rawDataHalf.size(); i++)
+        {
+            m_pimpl->structuredInput.rawDataHalf[i]
+                = floatToHalf(m_pimpl->structuredInput.rawData[i]);
+        }
+    }
+
+    // the input and output tensors have been bound at initialization time
+    m_pimpl->session->Run(Ort::RunOptions(), m_pimpl->ioBinding);
+
+    if (m_pimpl->useFloat16)
+    {
+        for (std::size_t i = 0; i < m_pimpl->structuredOutput.rawDataHalf.size(); i++)
+        {
+            m_pimpl->structuredOutput.rawData[i]
+                = halfToFloat(m_pimpl->structuredOutput.rawDataHalf[i]);
+        }
+    }
+
+    // unpack all the samples of the batch
+    for (std::size_t batchIndex = 0; batchIndex < m_pimpl->batchSize; batchIndex++)
+    {
+        const std::size_t sampleOffset = batchIndex * m_pimpl->outputSize;
+        MANNOutput& output = m_pimpl->outputs[batchIndex];
+
+        unpackMatrix("future_base_positions", sampleOffset, output.futureBasePositionTrajectory);
+        unpackMatrix("future_facing_directions",
+                     sampleOffset,
+                     output.futureFacingDirectionTrajectory);
+        unpackMatrix("future_base_velocities", sampleOffset, output.futureBaseVelocitiesTrajectory);
+        unpackMatrix("joint_positions", sampleOffset, output.jointPositions);
+        unpackMatrix("joint_velocities", sampleOffset, output.jointVelocities);
+
+        Eigen::Vector3d tempVector;
+        unpackMatrix("base_velocity", sampleOffset, tempVector);
+        output.projectedBaseVelocity
+            = manif::SE2Tangentd(tempVector(0), tempVector(1), tempVector(2));
+    }
 
     m_pimpl->state = Impl::FSM::Running;
 
@@ -328,5 +660,11 @@ bool MANN::isOutputValid() const
 
 const MANNOutput& MANN::getOutput() const
 {
-    return m_pimpl->output;
+    return this->getOutput(0);
+}
+
+const MANNOutput& MANN::getOutput(std::size_t batchIndex) const
+{
+    assert(batchIndex < m_pimpl->outputs.size());
+    return m_pimpl->outputs[batchIndex];
 }
@@ -6,6 +6,8 @@
  */
 
 #include <chrono>
+#include <future>
+#include <utility>
 
 #include <BipedalLocomotion/Contacts/Contact.h>
 #include <BipedalLocomotion/ContinuousDynamicalSystem/ForwardEuler.h>
@@ -24,11 +26,30 @@ using namespace BipedalLocomotion;
 
 struct MANNAutoregressive::Impl
 {
-    MANN mann;
+    std::shared_ptr<MANN> mann;
+    std::size_t batchIndex{0}; /**< Index of the sample of the batch associated to this instance. */
+    bool isMANNShared{false}; /**< If true the network is shared with other instances and its
+                                 batched inference is driven by the owner of the network. */
     MANNInput mannInput;
     iDynTree::KinDynComputations kinDyn;
     MANNAutoregressiveOutput output;
 
+    bool asynchronousInference{false}; /**< If true the network inference runs in a separate thread
+                                          while the consumer uses the previous output. */
+    std::future<bool> inferenceResult; /**< Result of the in-flight asynchronous inference. */
+    MANNOutput mannOutputFront; /**< Network output consumed by the class. */
+    MANNOutput mannOutputBack; /**< Network output written by the inference. The front and the back
+                                  buffers are preallocated and swapped at every advance(). */
+
+    bool jointOutputFilterEnabled{false}; /**< If true a first order low-pass filter is applied in
+                                             place to the joint output of the network. */
+    double jointOutputFilterGain{0.0}; /**< Gain of the filter, i.e. 3 / settling_time * dT. It
+                                          implements the dynamics dx = 3 / settling_time * (u - x)
+                                          discretized with the forward Euler method, as done by
+                                          ContinuousDynamicalSystem::FirstOrderSmoother. */
+    Eigen::VectorXd jointOutputFilterPositions; /**< State of the joint positions filter. */
+    Eigen::VectorXd jointOutputFilterVelocities; /**< State of the joint velocities filter. */
+
     std::chrono::nanoseconds currentTime{std::chrono::nanoseconds::zero()};
     std::chrono::nanoseconds dT;
 
@@ -74,6 +95,9 @@ struct MANNAutoregressive::Impl
     Math::SchmittTrigger leftFootSchmittTrigger;
     Math::SchmittTrigger rightFootSchmittTrigger;
 
+    bool runInference();
+    bool discardPendingInference();
+
     void trajectoryBlending(Eigen::Ref<const Eigen::Matrix2Xd> mannOutputMatrix,
                             Eigen::Ref<const Eigen::Matrix2Xd> desiredMatrix,
                             const double& tau,
@@ -113,13 +137,68 @@ void MANNAutoregressive::Impl::updateContact(const double referenceHeight,
     contact.lastUpdateTime = this->currentTime;
 }
 
+bool MANNAutoregressive::Impl::runInference()
+{
+    // if the network is shared, the owner of the network performs a single batched inference for
+    // all the instances and this function only collects the sample associated to this instance
+    if (!this->isMANNShared && !this->mann->advance())
+    {
+        return false;
+    }
+
+    if (!this->mann->isOutputValid())
+    {
+        return false;
+    }
+
+    // copy the network output in the back buffer. The buffers have been preallocated at
+    // initialization time, so the copy does not allocate memory
+    this->mannOutputBack = this->mann->getOutput(this->batchIndex);
+
+    return true;
+}
+
+bool MANNAutoregressive::Impl::discardPendingInference()
+{
+    if (!this->inferenceResult.valid())
+    {
+        return true;
+    }
+
+    return this->inferenceResult.get();
+}
+
 MANNAutoregressive::MANNAutoregressive()
     : m_pimpl(std::make_unique<Impl>())
 {
+    m_pimpl->mann = std::make_shared<MANN>();
 }
 
 MANNAutoregressive::~MANNAutoregressive() = default;
 
+bool MANNAutoregressive::setSharedMANN(std::shared_ptr<MANN> mann, std::size_t batchIndex)
+{
+    constexpr auto logPrefix = "[MANNAutoregressive::setSharedMANN]";
+
+    if (m_pimpl->fsmState != Impl::FSM::Idle)
+    {
+        log()->error("{} The shared network must be set before calling initialize().", logPrefix);
+        return false;
+    }
+
+    if (mann == nullptr)
+    {
+        log()->error("{} Invalid pointer to the MANN network.", logPrefix);
+        return false;
+    }
+
+    m_pimpl->mann = mann;
+    m_pimpl->batchIndex = batchIndex;
+    m_pimpl->isMANNShared = true;
+
+    return true;
+}
+
 bool MANNAutoregressive::setRobotModel(const iDynTree::Model& model)
 {
     constexpr std::size_t twistSize = 6;
@@ -198,7 +277,13 @@ bool MANNAutoregressive::initialize(
             log()->error("{} Unable to get the number of corners.", logPrefix);
             return false;
         }
-        contact.corners.resize(numberOfCorners);
+        if (!contact.corners.resize(numberOfCorners))
+        {
+            log()->error("{} Unable to resize the corner container to {} corners.",
+                         logPrefix,
+                         numberOfCorners);
+            return false;
+        }
 
         // for each corner we need to get its position in the frame attached to the foot
         for (std::size_t j = 0; j < numberOfCorners; j++)
@@ -288,6 +373,49 @@ bool MANNAutoregressive::initialize(
     }
     m_pimpl->integrator.setIntegrationStep(m_pimpl->dT);
 
+    if (!ptr->getParameter("asynchronous_inference", m_pimpl->asynchronousInference))
+    {
+        log()->info("{} 'asynchronous_inference' not found. The following parameter will be used "
+                    "{}.",
+                    logPrefix,
+                    m_pimpl->asynchronousInference);
+    }
+
+    std::chrono::nanoseconds jointOutputFilterSettlingTime{std::chrono::nanoseconds::zero()};
+    if (ptr->getParameter("joint_output_filter_settling_time", jointOutputFilterSettlingTime))
+    {
+        if (jointOutputFilterSettlingTime <= std::chrono::nanoseconds::zero())
+        {
+            log()->error("{} The parameter 'joint_output_filter_settling_time' must be a positive "
+                         "number.",
+                         logPrefix);
+            return false;
+        }
+
+        // the filter implements the same dynamics of
+        // ContinuousDynamicalSystem::FirstOrderSmoother, i.e. dx = 3 / settling_time * (u - x),
+        // discretized with the forward Euler method
+        m_pimpl->jointOutputFilterGain
+            = 3.0 * std::chrono::duration<double>(m_pimpl->dT).count()
+              / std::chrono::duration<double>(jointOutputFilterSettlingTime).count();
+
+        if (m_pimpl->jointOutputFilterGain >= 1.0)
+        {
+            log()->error("{} The parameter 'joint_output_filter_settling_time' is too small "
+                         "compared to the sampling time. Please remember it must be greater than "
+                         "3 times the sampling time.",
+                         logPrefix);
+            return false;
+        }
+
+        m_pimpl->jointOutputFilterEnabled = true;
+    } else
+    {
+        log()->info("{} 'joint_output_filter_settling_time' not found. The joint output filter is "
+                    "disabled.",
+                    logPrefix);
+    }
+
     std::string forwardDirection;
     if (!ptr->getParameter("forward_direction", forwardDirection) || forwardDirection != "x")
     {
@@ -324,10 +452,32 @@ bool MANNAutoregressive::initialize(
         return false;
     }
 
-    // add the joint size in the handler
+    // add the joint size in the handler. If the network is shared with other instances it has
+    // been already initialized by its owner
     auto cloneHandler = mannParamHandler->clone();
-    cloneHandler->setParameter("number_of_joints", int(m_pimpl->kinDyn.getNrOfDegreesOfFreedom()));
-    ok = ok && m_pimpl->mann.initialize(cloneHandler);
+    const int numberOfJoints = int(m_pimpl->kinDyn.getNrOfDegreesOfFreedom());
+    cloneHandler->setParameter("number_of_joints", numberOfJoints);
+    if (!m_pimpl->isMANNShared)
+    {
+        ok = ok && m_pimpl->mann->initialize(cloneHandler);
+    }
+
+    // preallocate the double buffer used to hand the network output from the inference to the
+    // consumer
+    int projectedBaseHorizon;
+    ok = ok && cloneHandler->getParameter("projected_base_horizon", projectedBaseHorizon);
+    if (ok)
+    {
+        for (MANNOutput* buffer : {&m_pimpl->mannOutputFront, &m_pimpl->mannOutputBack})
+        {
+            buffer->futureBasePositionTrajectory.resize(2, projectedBaseHorizon / 2);
+            buffer->futureFacingDirectionTrajectory.resize(2, projectedBaseHorizon / 2);
+            buffer->futureBaseVelocitiesTrajectory.resize(2, projectedBaseHorizon / 2);
+            buffer->jointPositions.resize(numberOfJoints);
+            buffer->jointVelocities.resize(numberOfJoints);
+            buffer->projectedBaseVelocity = manif::SE2Tangentd::Zero();
+        }
+    }
 
     ok = ok && initializeSchmittTrigger(ptr, "LEFT_FOOT", m_pimpl->leftFootSchmittTrigger);
     ok = ok && initializeSchmittTrigger(ptr, "RIGHT_FOOT", m_pimpl->rightFootSchmittTrigger);
@@ -351,17 +501,9 @@ bool MANNAutoregressive::reset(const MANNInput& input,
 {
     AutoregressiveState state;
 
-    // 51 is the length of 1 second of past trajectory stored in the autoregressive state. Since the
-    // original mocap data are collected at 50 Hz, and therefore the trajectory generation is
-    // assumed to proceed at 50 Hz, we need 50 datapoints to store the past second of trajectory.
-    // Along with the present datapoint, they sum up to 51!
-    constexpr size_t lengthOfPresentPlusPastTrajectory = 51;
-    state.pastProjectedBasePositions
-        = std::deque<Eigen::Vector2d>{lengthOfPresentPlusPastTrajectory, Eigen::Vector2d{0.0, 0.0}};
-    state.pastProjectedBaseVelocity
-        = std::deque<Eigen::Vector2d>{lengthOfPresentPlusPastTrajectory, Eigen::Vector2d{0.0, 0.0}};
-    state.pastFacingDirection
-        = std::deque<Eigen::Vector2d>{lengthOfPresentPlusPastTrajectory, Eigen::Vector2d{1.0, 0.0}};
+    state.pastProjectedBasePositions.fill(Eigen::Vector2d{0.0, 0.0});
+    state.pastProjectedBaseVelocity.fill(Eigen::Vector2d{0.0, 0.0});
+    state.pastFacingDirection.fill(Eigen::Vector2d{1.0, 0.0});
     state.I_H_FD = manif::SE2d::Identity();
     state.previousMannInput = input;
 
@@ -424,10 +566,25 @@ bool MANNAutoregressive::reset(const MANNInput& input,
         return false;
     }
 
+    // a pending asynchronous inference refers to the previous trajectory. Wait for it and discard
+    // its result
+    if (!m_pimpl->discardPendingInference())
+    {
+        log()->warn("{} The pending inference failed. Its result is discarded.", logPrefix);
+    }
+
     m_pimpl->mannInput = input;
     m_pimpl->currentTime = time;
     m_pimpl->isRobotStopped = true;
 
+    // the filter state is reset to the current joint values so that the filtered trajectory
+    // starts from the actual configuration of the robot
+    if (m_pimpl->jointOutputFilterEnabled)
+    {
+        m_pimpl->jointOutputFilterPositions = input.jointPositions;
+        m_pimpl->jointOutputFilterVelocities = input.jointVelocities;
+    }
+
     if (!m_pimpl->kinDyn.setRobotState(basePosition.transform(),
                                        input.jointPositions,
                                        baseVelocity.coeffs(),
@@ -450,7 +607,7 @@ bool MANNAutoregressive::reset(const MANNInput& input,
         return false;
     }
 
-    if (!m_pimpl->mann.setInput(m_pimpl->mannInput))
+    if (!m_pimpl->mann->setInput(m_pimpl->mannInput, m_pimpl->batchIndex))
     {
         log()->error("{} Unable to set the inputs to MANN.", logPrefix);
         return false;
@@ -480,12 +637,19 @@ bool MANNAutoregressive::setInput(const Input& input)
         return true;
     }
 
-    // get the output
-    const auto& mannOutput = m_pimpl->mann.getOutput();
+    // if the user calls setInput twice without advancing, the inference triggered by the first
+    // call must complete before the input is overwritten
+    if (!m_pimpl->discardPendingInference())
+    {
+        log()->warn("{} The pending inference failed. Its result is discarded.", logPrefix);
+    }
+
+    // get the output of the network at the previous iteration
+    const auto& mannOutput = m_pimpl->mannOutputFront;
 
     // the joint positions and velocities are considered as new input
-    m_pimpl->mannInput.jointPositions = m_pimpl->mann.getOutput().jointPositions;
-    m_pimpl->mannInput.jointVelocities = m_pimpl->mann.getOutput().jointVelocities;
+    m_pimpl->mannInput.jointPositions = mannOutput.jointPositions;
+    m_pimpl->mannInput.jointVelocities = mannOutput.jointVelocities;
 
     // TODO here we assume that the x direction of the chest frame points forward. This may
     // cause issues on some robots (e.g., iCubV2.5)
@@ -507,19 +671,21 @@ bool MANNAutoregressive::setInput(const Input& input)
 
     const manif::SE2d current_FD_H_previous_FD = I_H_current_FD.inverse() * m_pimpl->state.I_H_FD;
 
-    auto updatePreviousInputWithTransform = [](std::deque<Eigen::Vector2d>& pastTrajectory,
-                                               const auto& transformation,
-                                               const Eigen::Vector2d& newDataPoint) {
-        // past trajectory is seen as first in first out queue
-        pastTrajectory.pop_front();
-        for (auto& pastPoint : pastTrajectory)
-        {
-            pastPoint = transformation.act(pastPoint);
-        }
-        pastTrajectory.push_back(newDataPoint);
-    };
-
-    auto performSubsampling = [](const std::deque<Eigen::Vector2d>& pastTrajectory,
+    auto updatePreviousInputWithTransform
+        = [](AutoregressiveState::PastTrajectory& pastTrajectory,
+             const auto& transformation,
+             const Eigen::Vector2d& newDataPoint) {
+              // the past trajectory is seen as a first in first out queue: the elements following
+              // the oldest one are expressed in the new frame, then the oldest element is
+              // overwritten by the new datapoint
+              for (std::size_t i = 1; i < pastTrajectory.size(); i++)
+              {
+                  pastTrajectory[i] = transformation.act(pastTrajectory[i]);
+              }
+              pastTrajectory.push(newDataPoint);
+          };
+
+    auto performSubsampling = [](const AutoregressiveState::PastTrajectory& pastTrajectory,
                                  Eigen::Ref<Eigen::Matrix2Xd> mannInput) -> void {
         const int sampleDelta = pastTrajectory.size() / (mannInput.cols() - 1);
 
@@ -562,7 +728,7 @@ bool MANNAutoregressive::setInput(const Input& input)
                                 1.3,
                                 m_pimpl->mannInput.baseVelocitiesTrajectory.rightCols<6>());
 
-    if (!m_pimpl->mann.setInput(m_pimpl->mannInput))
+    if (!m_pimpl->mann->setInput(m_pimpl->mannInput, m_pimpl->batchIndex))
     {
         log()->error("{} Unable to set the input to MANN network", logPrefix);
         return false;
@@ -587,6 +753,15 @@ bool MANNAutoregressive::setInput(const Input& input)
     m_pimpl->state.I_H_FD = I_H_current_FD;
     m_pimpl->state.previousMannInput = m_pimpl->mannInput;
 
+    // run the inference in a separate thread. The result is collected by the next call of
+    // advance(), so the consumer can overlap other computations (e.g. an MPC solve) with the
+    // network evaluation. If the network is shared the batched inference is driven by its owner
+    if (m_pimpl->asynchronousInference && !m_pimpl->isMANNShared)
+    {
+        m_pimpl->inferenceResult
+            = std::async(std::launch::async, [this]() { return m_pimpl->runInference(); });
+    }
+
     return true;
 }
 
@@ -622,15 +797,37 @@ bool MANNAutoregressive::advance()
         return false;
     }
 
-    // perform one iteration of MANN
-    if (!m_pimpl->mann.advance() || !m_pimpl->mann.isOutputValid())
+    // perform one iteration of MANN. If an asynchronous inference has been triggered by setInput
+    // we collect its result, otherwise the network is evaluated here
+    const bool inferenceOk = m_pimpl->inferenceResult.valid() ? m_pimpl->inferenceResult.get()
+                                                              : m_pimpl->runInference();
+    if (!inferenceOk)
     {
         log()->error("{} Unable to compute the output of the network.", logPrefix);
         return false;
     }
 
+    // the back buffer contains the latest network output, make it the front one
+    std::swap(m_pimpl->mannOutputFront, m_pimpl->mannOutputBack);
+
     // get the output of the network
-    const auto& mannOutput = m_pimpl->mann.getOutput();
+    auto& mannOutput = m_pimpl->mannOutputFront;
+
+    // the optional low-pass filter is fused in the inference epilogue: the filter state is
+    // updated in place on the network output, so the downstream kinematics and the published
+    // output already see the filtered joints without an additional pass over the buffers
+    if (m_pimpl->jointOutputFilterEnabled)
+    {
+        m_pimpl->jointOutputFilterPositions
+            += m_pimpl->jointOutputFilterGain
+               * (mannOutput.jointPositions - m_pimpl->jointOutputFilterPositions);
+        m_pimpl->jointOutputFilterVelocities
+            += m_pimpl->jointOutputFilterGain
+               * (mannOutput.jointVelocities - m_pimpl->jointOutputFilterVelocities);
+
+        mannOutput.jointPositions = m_pimpl->jointOutputFilterPositions;
+        mannOutput.jointVelocities = m_pimpl->jointOutputFilterVelocities;
+    }
 
     // Extract the new base orientation from the output
     // we reset the kinDynObject
@@ -666,7 +863,7 @@ bool MANNAutoregressive::advance()
     // The following function evaluate the position of the corners of a foot in the inertial frame
     auto evaluateFootCornersPosition
         = [this](int index,
-                 const std::vector<Contacts::Corner>& corners) -> std::vector<Eigen::Vector3d> {
+                 const Contacts::CornerArray& corners) -> std::vector<Eigen::Vector3d> {
         using namespace BipedalLocomotion::Conversions;
 
         std::vector<Eigen::Vector3d> footCorners;
@@ -5,6 +5,8 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <limits>
+
 #include <BipedalLocomotion/ML/MANNAutoregressiveInputBuilder.h>
 #include <BipedalLocomotion/Math/QuadraticBezierCurve.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
@@ -27,6 +29,18 @@ struct MANNAutoregressiveInputBuilder::Impl
 
     Eigen::Vector2d frontalDirection;
 
+    Eigen::RowVectorXd blendingFactors; /**< Interpolation factors, generated as linspace between
+                                           0 and 1, used to blend the facing direction with the
+                                           frontal one. */
+    Eigen::RowVectorXd complementaryBlendingFactors; /**< One minus the blending factors. */
+
+    /** Input considered by the latest advance(). They are initialized to nan so that the first
+     * advance() always computes the output. */
+    Eigen::Vector2d previousMotionDirection{
+        Eigen::Vector2d::Constant(std::numeric_limits<double>::quiet_NaN())};
+    Eigen::Vector2d previousFacingDirection{
+        Eigen::Vector2d::Constant(std::numeric_limits<double>::quiet_NaN())};
+
     double baseVelocityNorm;
     double ellipsoidForwardAxis;
     double ellipsoidSideAxis;
@@ -226,6 +240,11 @@ bool MANNAutoregressiveInputBuilder::initialize(
     m_pimpl->curve.initialPoint.setZero();
     m_pimpl->frontalDirection << 1, 0;
 
+    // the interpolation factors depend only on the number of knots, so they are computed once for
+    // all
+    m_pimpl->blendingFactors = Eigen::RowVectorXd::LinSpaced(m_pimpl->numberOfKnots, 0.0, 1.0);
+    m_pimpl->complementaryBlendingFactors = 1.0 - m_pimpl->blendingFactors.array();
+
     getOptionalParameter("forward_direction_threshold", m_pimpl->forwardDirectionThreshold);
     getOptionalParameter("side_direction_threshold", m_pimpl->sideDirectionThreshold);
 
@@ -243,6 +262,15 @@ bool MANNAutoregressiveInputBuilder::advance()
         return false;
     }
 
+    // the output depends only on the desired directions. If they did not change since the latest
+    // advance the output is still valid and there is no need to recompute it
+    if (m_pimpl->fsm == Impl::FSM::OutputValid
+        && m_pimpl->input.motionDirection == m_pimpl->previousMotionDirection
+        && m_pimpl->input.facingDirection == m_pimpl->previousFacingDirection)
+    {
+        return true;
+    }
+
     // first of all we invalidate the output
     m_pimpl->fsm = Impl::FSM::OutputInvalid;
 
@@ -304,23 +332,27 @@ bool MANNAutoregressiveInputBuilder::advance()
           - m_pimpl->output.desiredFutureBaseTrajectory.leftCols(m_pimpl->numberOfKnots - 1);
 
     // [BASE VELOCITY EVALUATION] Step 2
-    for (int i = 0; i < m_pimpl->numberOfKnots - 1; i++)
-    {
-        m_pimpl->output.desiredFutureBaseVelocities.col(i).normalize();
-        m_pimpl->output.desiredFutureBaseVelocities.col(i) *= m_pimpl->baseVelocityNorm;
-    }
+    // all the columns are rescaled in a single vectorized pass. A column whose norm is zero stays
+    // zero, as with normalize()
+    auto velocities
+        = m_pimpl->output.desiredFutureBaseVelocities.leftCols(m_pimpl->numberOfKnots - 1);
+    const Eigen::RowVectorXd velocityNorms = velocities.colwise().norm();
+    velocities.array().rowwise() *= (velocityNorms.array() > 0)
+                                        .select(m_pimpl->baseVelocityNorm
+                                                    / velocityNorms.array(),
+                                                0.0);
 
     // [BASE VELOCITY EVALUATION] Step 3
     m_pimpl->output.desiredFutureBaseVelocities.col(m_pimpl->numberOfKnots - 1)
         = m_pimpl->output.desiredFutureBaseVelocities.col(m_pimpl->numberOfKnots - 2);
 
-    const double h = 1.0 / static_cast<double>(m_pimpl->numberOfKnots - 1);
-    for (int i = 0; i < m_pimpl->numberOfKnots; i++)
-    {
-        const double t = i * h;
-        m_pimpl->output.desiredFutureFacingDirections.col(i)
-            = t * m_pimpl->frontalDirection + (1 - t) * m_pimpl->input.facingDirection;
-    }
+    // blend the facing direction towards the frontal one with two rank-1 updates
+    m_pimpl->output.desiredFutureFacingDirections.noalias()
+        = m_pimpl->frontalDirection * m_pimpl->blendingFactors
+          + m_pimpl->input.facingDirection * m_pimpl->complementaryBlendingFactors;
+
+    m_pimpl->previousMotionDirection = m_pimpl->input.motionDirection;
+    m_pimpl->previousFacingDirection = m_pimpl->input.facingDirection;
 
     m_pimpl->fsm = Impl::FSM::OutputValid;
 
@@ -7,6 +7,8 @@
 
 #include <BipedalLocomotion/Contacts/ContactList.h>
 #include <chrono>
+#include <memory>
+#include <vector>
 
 #include <BipedalLocomotion/ML/MANNAutoregressive.h>
 #include <BipedalLocomotion/ML/MANNTrajectoryGenerator.h>
@@ -45,11 +47,28 @@ struct MANNTrajectoryGenerator::Impl
     std::chrono::nanoseconds horizon;
     int projectedBaseHorizonSize;
 
-    bool updateContactList(const std::string& footName,
+    iDynTree::Model robotModel; /**< Model of the robot. It is stored to build the pool of
+                                   autoregressive models used by the batched evaluation. */
+
+    std::size_t batchSize{1}; /**< Number of candidate trajectories evaluated by a single batched
+                                 inference. */
+    std::shared_ptr<MANN> sharedMann; /**< Network shared among the pool of autoregressive models.
+                                         It is created only if the batch size is greater than 1. */
+    std::vector<std::unique_ptr<MANNAutoregressive>> batchedMann; /**< Pool of autoregressive
+                                                                     models, one for each candidate
+                                                                     trajectory. */
+    std::vector<MANNAutoregressiveInput> batchedInputs;
+    std::vector<Contacts::ContactListMap> batchedContactListMaps;
+    std::vector<MANNTrajectoryGeneratorOutput> batchedOutputs;
+    bool isBatchedOutputValid{false};
+
+    bool updateContactList(Contacts::ContactListMap& contactListMap,
+                           const std::string& footName,
                            const std::chrono::nanoseconds& currentTime,
                            const Contacts::EstimatedContact& estimatedContact);
 
-    bool resetContactList(const Contacts::EstimatedContact& estimatedContact,
+    bool resetContactList(Contacts::ContactListMap& contactListMap,
+                          const Contacts::EstimatedContact& estimatedContact,
                           const std::string& contactName);
 
     static double extactYawAngle(const Eigen::Ref<const Eigen::Matrix3d>& R);
@@ -74,7 +93,9 @@ double MANNTrajectoryGenerator::Impl::extactYawAngle(const Eigen::Ref<const Eige
 }
 
 bool MANNTrajectoryGenerator::Impl::resetContactList(
-    const Contacts::EstimatedContact& estimatedContact, const std::string& contactName)
+    Contacts::ContactListMap& contactListMap,
+    const Contacts::EstimatedContact& estimatedContact,
+    const std::string& contactName)
 {
     // if the contact is not active we do not have to add in the contact list
     if (!estimatedContact.isActive)
@@ -93,10 +114,11 @@ bool MANNTrajectoryGenerator::Impl::resetContactList(
     temp.pose.quat(Eigen::AngleAxis(yaw, Eigen::Vector3d::UnitZ()));
 
     temp.type = Contacts::ContactType::FULL;
-    return this->contactListMap[contactName].addContact(temp);
+    return contactListMap[contactName].addContact(temp);
 }
 
 bool MANNTrajectoryGenerator::Impl::updateContactList(
+    Contacts::ContactListMap& contactListMap,
     const std::string& footName,
     const std::chrono::nanoseconds& currentTime,
     const Contacts::EstimatedContact& estimatedContact)
@@ -173,6 +195,9 @@ MANNTrajectoryGenerator::~MANNTrajectoryGenerator() = default;
 
 bool MANNTrajectoryGenerator::setRobotModel(const iDynTree::Model& model)
 {
+    // the model is stored since it is required to build the pool of autoregressive models used by
+    // the batched evaluation
+    m_pimpl->robotModel = model;
     return m_pimpl->mann.setRobotModel(model);
 }
 
@@ -203,6 +228,16 @@ bool MANNTrajectoryGenerator::initialize(
     // this parameter is optional
     getParameter(paramHandler, "slow_down_factor", m_pimpl->slowDownFactor);
 
+    // this parameter is optional
+    int batchSize = 1;
+    getParameter(paramHandler, "batch_size", batchSize);
+    if (batchSize <= 0)
+    {
+        log()->error("{} The parameter 'batch_size' must be a positive number.", logPrefix);
+        return false;
+    }
+    m_pimpl->batchSize = batchSize;
+
     bool ok = getParameter(paramHandler, "time_horizon", m_pimpl->horizon);
     ok = ok && getParameter(paramHandler, "sampling_time", m_pimpl->dT);
     ok = ok
@@ -222,7 +257,66 @@ bool MANNTrajectoryGenerator::initialize(
     m_pimpl->output.angularMomentumTrajectory.resize(m_pimpl->horizon / m_pimpl->dT);
     m_pimpl->output.comTrajectory.resize(m_pimpl->horizon / m_pimpl->dT);
 
-    return m_pimpl->mann.initialize(paramHandler);
+    if (!m_pimpl->mann.initialize(paramHandler))
+    {
+        log()->error("{} Unable to initialize the autoregressive model.", logPrefix);
+        return false;
+    }
+
+    // when the batch size is greater than one, a network shared among a pool of autoregressive
+    // models evaluates all the candidate trajectories with a single batched inference per step.
+    // The trajectory committed with setInput() and advance() is still generated by the standard
+    // single sample network
+    if (m_pimpl->batchSize > 1)
+    {
+        auto ptr = paramHandler.lock();
+        auto mannHandler = ptr->getGroup("MANN").lock();
+        if (mannHandler == nullptr)
+        {
+            log()->error("{} Unable to find the group named 'MANN'.", logPrefix);
+            return false;
+        }
+
+        auto cloneHandler = mannHandler->clone();
+        cloneHandler->setParameter("number_of_joints", int(m_pimpl->robotModel.getNrOfDOFs()));
+        cloneHandler->setParameter("batch_size", int(m_pimpl->batchSize));
+
+        m_pimpl->sharedMann = std::make_shared<MANN>();
+        if (!m_pimpl->sharedMann->initialize(cloneHandler))
+        {
+            log()->error("{} Unable to initialize the shared network.", logPrefix);
+            return false;
+        }
+
+        for (std::size_t i = 0; i < m_pimpl->batchSize; i++)
+        {
+            auto autoregressive = std::make_unique<MANNAutoregressive>();
+            if (!autoregressive->setSharedMANN(m_pimpl->sharedMann, i)
+                || !autoregressive->setRobotModel(m_pimpl->robotModel)
+                || !autoregressive->initialize(paramHandler))
+            {
+                log()->error("{} Unable to initialize the autoregressive model associated to the "
+                             "sample number {} of the batch.",
+                             logPrefix,
+                             i);
+                return false;
+            }
+            m_pimpl->batchedMann.emplace_back(std::move(autoregressive));
+        }
+
+        m_pimpl->batchedInputs.resize(m_pimpl->batchSize);
+        m_pimpl->batchedContactListMaps.resize(m_pimpl->batchSize);
+        m_pimpl->batchedOutputs.resize(m_pimpl->batchSize);
+        for (MANNTrajectoryGeneratorOutput& output : m_pimpl->batchedOutputs)
+        {
+            output.basePoses.resize(m_pimpl->horizon / m_pimpl->dT);
+            output.jointPositions.resize(m_pimpl->horizon / m_pimpl->dT);
+            output.angularMomentumTrajectory.resize(m_pimpl->horizon / m_pimpl->dT);
+            output.comTrajectory.resize(m_pimpl->horizon / m_pimpl->dT);
+        }
+    }
+
+    return true;
 }
 
 void MANNTrajectoryGenerator::setInitialState(Eigen::Ref<const Eigen::VectorXd> jointPositions,
@@ -248,17 +342,9 @@ void MANNTrajectoryGenerator::setInitialState(Eigen::Ref<const Eigen::VectorXd>
     temp.rightFoot = rightFoot;
     temp.time = time;
 
-    // 51 is the length of 1 second of past trajectory stored in the autoregressive state. Since the
-    // original mocap data are collected at 50 Hz, and therefore the trajectory generation is
-    // assumed to proceed at 50 Hz, we need 50 datapoints to store the past second of trajectory.
-    // Along with the present datapoint, they sum up to 51!
-    constexpr size_t lengthOfPresentPlusPastTrajectory = 51;
-    temp.autoregressiveState.pastProjectedBasePositions
-        = std::deque<Eigen::Vector2d>{lengthOfPresentPlusPastTrajectory, Eigen::Vector2d{0.0, 0.0}};
-    temp.autoregressiveState.pastProjectedBaseVelocity
-        = std::deque<Eigen::Vector2d>{lengthOfPresentPlusPastTrajectory, Eigen::Vector2d{0.0, 0.0}};
-    temp.autoregressiveState.pastFacingDirection
-        = std::deque<Eigen::Vector2d>{lengthOfPresentPlusPastTrajectory, Eigen::Vector2d{1.0, 0.0}};
+    temp.autoregressiveState.pastProjectedBasePositions.fill(Eigen::Vector2d{0.0, 0.0});
+    temp.autoregressiveState.pastProjectedBaseVelocity.fill(Eigen::Vector2d{0.0, 0.0});
+    temp.autoregressiveState.pastFacingDirection.fill(Eigen::Vector2d{1.0, 0.0});
     temp.autoregressiveState.I_H_FD = manif::SE2d::Identity();
     temp.autoregressiveState.previousMannInput = temp.input;
     temp.leftFootSchmittTriggerState.state = leftFoot.isActive;
@@ -308,8 +394,89 @@ bool MANNTrajectoryGenerator::setInput(const Input& input)
     m_pimpl->contactListMap["right_foot"].clear();
 
     // add the first contact if needed
-    return m_pimpl->resetContactList(mergePointState.leftFoot, "left_foot")
-           && m_pimpl->resetContactList(mergePointState.rightFoot, "right_foot");
+    return m_pimpl->resetContactList(m_pimpl->contactListMap, mergePointState.leftFoot, "left_foot")
+           && m_pimpl->resetContactList(m_pimpl->contactListMap,
+                                        mergePointState.rightFoot,
+                                        "right_foot");
+}
+
+bool MANNTrajectoryGenerator::setBatchedInput(const std::vector<Input>& inputs)
+{
+    constexpr auto logPrefix = "[MANNTrajectoryGenerator::setBatchedInput]";
+
+    if (m_pimpl->batchSize <= 1)
+    {
+        log()->error("{} The batched evaluation is not enabled. Please set the parameter "
+                     "'batch_size' to a number greater than one.",
+                     logPrefix);
+        return false;
+    }
+
+    if (inputs.size() != m_pimpl->batchSize)
+    {
+        log()->error("{} The number of inputs is different from the batch size. Provided: {}, "
+                     "Expected: {}.",
+                     logPrefix,
+                     inputs.size(),
+                     m_pimpl->batchSize);
+        return false;
+    }
+
+    for (std::size_t i = 0; i < m_pimpl->batchSize; i++)
+    {
+        const Input& input = inputs[i];
+
+        if (input.mergePointIndex > m_pimpl->mergePointStates.size())
+        {
+            log()->error("{} The index of the merge point of the input number {} is greater than "
+                         "the entire trajectory. The trajectory lasts {}. I cannot attach a new "
+                         "trajectory at {}.",
+                         logPrefix,
+                         i,
+                         m_pimpl->horizon,
+                         input.mergePointIndex * m_pimpl->dT);
+            return false;
+        }
+
+        m_pimpl->batchedInputs[i] = input;
+
+        const auto& mergePointState = m_pimpl->mergePointStates[input.mergePointIndex];
+
+        if (!m_pimpl->batchedMann[i]->reset(mergePointState.input,
+                                            mergePointState.leftFoot,
+                                            mergePointState.leftFootSchmittTriggerState,
+                                            mergePointState.rightFoot,
+                                            mergePointState.rightFootSchmittTriggerState,
+                                            mergePointState.basePosition,
+                                            mergePointState.baseVelocity,
+                                            mergePointState.autoregressiveState,
+                                            mergePointState.time))
+        {
+            log()->error("{} Unable to reset the autoregressive model associated to the sample "
+                         "number {} of the batch.",
+                         logPrefix,
+                         i);
+            return false;
+        }
+
+        // clean the contact list map this will also create the two values in the dictionary
+        Contacts::ContactListMap& contactListMap = m_pimpl->batchedContactListMaps[i];
+        contactListMap["left_foot"].clear();
+        contactListMap["right_foot"].clear();
+
+        // add the first contact if needed
+        if (!m_pimpl->resetContactList(contactListMap, mergePointState.leftFoot, "left_foot")
+            || !m_pimpl->resetContactList(contactListMap, mergePointState.rightFoot, "right_foot"))
+        {
+            log()->error("{} Unable to reset the contact lists of the sample number {} of the "
+                         "batch.",
+                         logPrefix,
+                         i);
+            return false;
+        }
+    }
+
+    return true;
 }
 
 bool MANNTrajectoryGenerator::advance()
@@ -352,7 +519,10 @@ bool MANNTrajectoryGenerator::advance()
         m_pimpl->output.angularMomentumTrajectory[i] = MANNOutput.angularMomentum;
         m_pimpl->output.comTrajectory[i] = MANNOutput.comPosition;
 
-        if (!m_pimpl->updateContactList("left_foot", MANNOutput.currentTime, MANNOutput.leftFoot))
+        if (!m_pimpl->updateContactList(m_pimpl->contactListMap,
+                                        "left_foot",
+                                        MANNOutput.currentTime,
+                                        MANNOutput.leftFoot))
         {
             log()->error("{} Unable to update the contact list for the left_foot at iteration "
                          "number {}.",
@@ -361,7 +531,10 @@ bool MANNTrajectoryGenerator::advance()
             return false;
         }
 
-        if (!m_pimpl->updateContactList("right_foot", MANNOutput.currentTime, MANNOutput.rightFoot))
+        if (!m_pimpl->updateContactList(m_pimpl->contactListMap,
+                                        "right_foot",
+                                        MANNOutput.currentTime,
+                                        MANNOutput.rightFoot))
         {
             log()->error("{} Unable to update the contact list for the right_foot at iteration "
                          "number {}.",
@@ -379,12 +552,115 @@ bool MANNTrajectoryGenerator::advance()
     return true;
 }
 
+bool MANNTrajectoryGenerator::advanceBatched()
+{
+    constexpr auto logPrefix = "[MANNTrajectoryGenerator::advanceBatched]";
+
+    // invalidate the output
+    m_pimpl->isBatchedOutputValid = false;
+
+    if (m_pimpl->batchSize <= 1)
+    {
+        log()->error("{} The batched evaluation is not enabled. Please set the parameter "
+                     "'batch_size' to a number greater than one.",
+                     logPrefix);
+        return false;
+    }
+
+    for (int i = 0; i < m_pimpl->mergePointStates.size(); i++)
+    {
+        // write the input of each candidate in the associated sample of the shared network
+        for (std::size_t j = 0; j < m_pimpl->batchSize; j++)
+        {
+            if (!m_pimpl->batchedMann[j]->setInput(m_pimpl->batchedInputs[j]))
+            {
+                log()->error("{} Unable to set the input to the autoregressive model associated "
+                             "to the sample number {} of the batch.",
+                             logPrefix,
+                             j);
+                return false;
+            }
+        }
+
+        // evaluate all the candidates with a single batched inference
+        if (!m_pimpl->sharedMann->advance())
+        {
+            log()->error("{} Unable to perform the iteration number {} of the shared network.",
+                         logPrefix,
+                         i);
+            return false;
+        }
+
+        for (std::size_t j = 0; j < m_pimpl->batchSize; j++)
+        {
+            if (!m_pimpl->batchedMann[j]->advance())
+            {
+                log()->error("{} Unable to perform the iteration number {} of the autoregressive "
+                             "model associated to the sample number {} of the batch.",
+                             logPrefix,
+                             i,
+                             j);
+                return false;
+            }
+
+            const auto& MANNOutput = m_pimpl->batchedMann[j]->getOutput();
+
+            // populate the output associated to the candidate. Differently from advance(), the
+            // merge point states are not updated since only the trajectory committed with
+            // setInput() and advance() can be used as merge point for the next trajectory
+            MANNTrajectoryGeneratorOutput& output = m_pimpl->batchedOutputs[j];
+            output.basePoses[i] = MANNOutput.basePose;
+            output.jointPositions[i] = MANNOutput.jointsPosition;
+            output.angularMomentumTrajectory[i] = MANNOutput.angularMomentum;
+            output.comTrajectory[i] = MANNOutput.comPosition;
+
+            if (!m_pimpl->updateContactList(m_pimpl->batchedContactListMaps[j],
+                                            "left_foot",
+                                            MANNOutput.currentTime,
+                                            MANNOutput.leftFoot)
+                || !m_pimpl->updateContactList(m_pimpl->batchedContactListMaps[j],
+                                               "right_foot",
+                                               MANNOutput.currentTime,
+                                               MANNOutput.rightFoot))
+            {
+                log()->error("{} Unable to update the contact lists of the sample number {} of "
+                             "the batch at iteration number {}.",
+                             logPrefix,
+                             j,
+                             i);
+                return false;
+            }
+        }
+    }
+
+    // populate the phase list of each candidate
+    for (std::size_t j = 0; j < m_pimpl->batchSize; j++)
+    {
+        m_pimpl->batchedOutputs[j].phaseList.setLists(m_pimpl->batchedContactListMaps[j]);
+    }
+
+    m_pimpl->isBatchedOutputValid = true;
+
+    return true;
+}
+
 bool MANNTrajectoryGenerator::isOutputValid() const
 {
     return m_pimpl->isOutputValid;
 }
 
+bool MANNTrajectoryGenerator::isBatchedOutputValid() const
+{
+    return m_pimpl->isBatchedOutputValid;
+}
+
 const MANNTrajectoryGenerator::Output& MANNTrajectoryGenerator::getOutput() const
 {
     return m_pimpl->output;
 }
+
+const std::vector<MANNTrajectoryGenerator::Output>&
+MANNTrajectoryGenerator::getBatchedOutput() const
+{
+    return m_pimpl->batchedOutputs;
+}
@@ -0,0 +1,317 @@
+/**
+ * @file MANNBenchmarkTest.cpp
+ * @authors Paolo Maria Viceconte, Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <iDynTree/Model/Model.h>
+#include <iDynTree/ModelIO/ModelLoader.h>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/Contacts/Contact.h>
+#include <BipedalLocomotion/ML/MANN.h>
+#include <BipedalLocomotion/ML/MANNAutoregressive.h>
+#include <BipedalLocomotion/ML/MANNAutoregressiveInputBuilder.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+#include <FolderPath.h>
+
+using namespace BipedalLocomotion::ML;
+using namespace BipedalLocomotion::Contacts;
+using namespace BipedalLocomotion::ParametersHandler;
+
+// The global allocation operators are replaced to count the heap allocations performed by each
+// stage of the pipeline. The counter is sampled before and after every call, so the reported
+// number is the allocations per frame and not the total of the process.
+static std::atomic<std::int64_t> globalAllocationCounter{0};
+
+void* operator new(std::size_t size)
+{
+    globalAllocationCounter.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size > 0 ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+
+std::chrono::nanoseconds median(std::vector<std::chrono::nanoseconds> samples)
+{
+    const std::size_t index = samples.size() / 2;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+std::int64_t median(std::vector<std::int64_t> samples)
+{
+    const std::size_t index = samples.size() / 2;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+} // namespace
+
+TEST_CASE("MANN pipeline benchmark")
+{
+    using namespace std::chrono_literals;
+
+    constexpr std::size_t projectedBaseHorizon = 12;
+
+    auto jointsList
+        = std::vector<std::string>{"l_hip_pitch",      "l_hip_roll",       "l_hip_yaw",
+                                   "l_knee",           "l_ankle_pitch",    "l_ankle_roll",
+                                   "r_hip_pitch",      "r_hip_roll",       "r_hip_yaw",
+                                   "r_knee",           "r_ankle_pitch",    "r_ankle_roll",
+                                   "torso_pitch",      "torso_roll",       "torso_yaw",
+                                   "neck_pitch",       "neck_roll",        "neck_yaw",
+                                   "l_shoulder_pitch", "l_shoulder_roll",  "l_shoulder_yaw",
+                                   "l_elbow",          "r_shoulder_pitch", "r_shoulder_roll",
+                                   "r_shoulder_yaw",   "r_elbow"};
+
+    iDynTree::ModelLoader ml;
+    REQUIRE(ml.loadReducedModelFromFile(getRobotModelPath(), jointsList));
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("joints_list", jointsList);
+    handler->setParameter("root_link_frame_name", "root_link");
+    handler->setParameter("chest_link_frame_name", "chest");
+    handler->setParameter("left_foot_frame_name", "l_sole");
+    handler->setParameter("right_foot_frame_name", "r_sole");
+    handler->setParameter("sampling_time", 20ms);
+    handler->setParameter("forward_direction", "x");
+
+    auto leftFootGroup = std::make_shared<StdImplementation>();
+    leftFootGroup->setParameter("number_of_corners", 4);
+    leftFootGroup->setParameter("corner_0", std::vector<double>{+0.08, +0.03, 0.0});
+    leftFootGroup->setParameter("corner_1", std::vector<double>{+0.08, -0.03, 0.0});
+    leftFootGroup->setParameter("corner_2", std::vector<double>{-0.08, -0.03, 0.0});
+    leftFootGroup->setParameter("corner_3", std::vector<double>{-0.08, +0.03, 0.0});
+    leftFootGroup->setParameter("on_threshold", 0.01);
+    leftFootGroup->setParameter("off_threshold", 0.01);
+    leftFootGroup->setParameter("switch_on_after", 40ms);
+    leftFootGroup->setParameter("switch_off_after", 40ms);
+
+    auto rightFootGroup = std::make_shared<StdImplementation>();
+    rightFootGroup->setParameter("number_of_corners", 4);
+    rightFootGroup->setParameter("corner_0", std::vector<double>{+0.08, +0.03, 0.0});
+    rightFootGroup->setParameter("corner_1", std::vector<double>{+0.08, -0.03, 0.0});
+    rightFootGroup->setParameter("corner_2", std::vector<double>{-0.08, -0.03, 0.0});
+    rightFootGroup->setParameter("corner_3", std::vector<double>{-0.08, +0.03, 0.0});
+    rightFootGroup->setParameter("on_threshold", 0.01);
+    rightFootGroup->setParameter("off_threshold", 0.01);
+    rightFootGroup->setParameter("switch_on_after", 40ms);
+    rightFootGroup->setParameter("switch_off_after", 40ms);
+
+    auto mannGroup = std::make_shared<StdImplementation>();
+    mannGroup->setParameter("projected_base_horizon", int(projectedBaseHorizon));
+    mannGroup->setParameter("onnx_model_path", getMANNModelPath());
+
+    handler->setGroup("LEFT_FOOT", leftFootGroup);
+    handler->setGroup("RIGHT_FOOT", rightFootGroup);
+    handler->setGroup("MANN", mannGroup);
+
+    auto builderHandler = std::make_shared<StdImplementation>();
+    builderHandler->setParameter("base_vel_norm", 0.4);
+    builderHandler->setParameter("ellipsoid_forward_axis", 1.0);
+    builderHandler->setParameter("ellipsoid_side_axis", 0.9);
+    builderHandler->setParameter("ellipsoid_backward_axis", 0.6);
+    builderHandler->setParameter("ellipsoid_scaling_factor", 0.4);
+    builderHandler->setParameter("max_facing_direction_angle_forward", 0.9);
+    builderHandler->setParameter("max_facing_direction_angle_backward", 0.45);
+    builderHandler->setParameter("max_facing_direction_angle_side_opposite_sign", 0.26);
+    builderHandler->setParameter("max_facing_direction_angle_side_same_sign", 0.9);
+    builderHandler->setParameter("number_of_knots", 7);
+
+    MANNAutoregressiveInputBuilder builder;
+    REQUIRE(builder.initialize(builderHandler));
+
+    MANNAutoregressive autoregressive;
+    REQUIRE(autoregressive.setRobotModel(ml.model()));
+    REQUIRE(autoregressive.initialize(handler));
+
+    EstimatedContact leftFoot, rightFoot;
+    leftFoot.isActive = true;
+    leftFoot.name = "left_foot";
+    leftFoot.index = ml.model().getFrameIndex("l_sole");
+    leftFoot.switchTime = 0s;
+    leftFoot.pose = manif::SE3d(Eigen::Vector3d{0, 0.08, 0}, manif::SO3d::Identity());
+
+    rightFoot.isActive = true;
+    rightFoot.name = "right_foot";
+    rightFoot.index = ml.model().getFrameIndex("r_sole");
+    rightFoot.switchTime = 0s;
+    rightFoot.pose = manif::SE3d(Eigen::Vector3d{0, -0.08, 0}, manif::SO3d::Identity());
+
+    const manif::SE3d basePose = manif::SE3d(Eigen::Vector3d{0, 0, 0.7748},
+                                             Eigen::AngleAxis(0.0, Eigen::Vector3d::UnitY()));
+
+    Eigen::VectorXd jointPositions(26);
+    jointPositions << -0.10922017141063572, 0.05081325960010118, 0.06581966291990003,
+        -0.0898053099824925, -0.09324922528169599, -0.05110058859172172, -0.11021232812838086,
+        0.054291515925228385, 0.0735575862560208, -0.09509332143185895, -0.09833823347493076,
+        -0.05367281245082792, 0.1531558711397399, -0.001030634273454133, 0.0006584764419034815,
+        -0.0016821925351926288, -0.004284529460797688, 0.030389771690123243, -0.040592118429752494,
+        -0.1695472679986807, -0.20799422095574033, 0.045397975984119654, -0.03946672931050908,
+        -0.16795588539580256, -0.20911090583076936, 0.0419854257806720;
+
+    MANNInput initialInput;
+    initialInput.jointPositions = jointPositions;
+    initialInput.jointVelocities = Eigen::VectorXd::Zero(jointPositions.size());
+    initialInput.basePositionTrajectory = Eigen::MatrixXd::Zero(2, projectedBaseHorizon);
+    initialInput.baseVelocitiesTrajectory = Eigen::MatrixXd::Zero(2, projectedBaseHorizon);
+    initialInput.facingDirectionTrajectory.resize(2, projectedBaseHorizon);
+    for (std::size_t i = 0; i < projectedBaseHorizon; i++)
+    {
+        initialInput.facingDirectionTrajectory.col(i) << 1.0, 0.0;
+    }
+
+    REQUIRE(autoregressive.reset(initialInput,
+                                 leftFoot,
+                                 rightFoot,
+                                 basePose,
+                                 manif::SE3Tangentd::Zero()));
+
+    // scripted joystick trace: walk forward, then turn left while walking, finally walk sideways.
+    // The values are representative of the traces recorded during the teleoperation experiments
+    constexpr int numberOfFrames = 300;
+    auto joystickInputAtFrame = [](int frame) -> MANNDirectionalInput {
+        MANNDirectionalInput input;
+        if (frame < 100)
+        {
+            input.motionDirection << 1.0, 0.0;
+            input.facingDirection << 1.0, 0.0;
+        } else if (frame < 200)
+        {
+            input.motionDirection << 0.7, 0.7;
+            input.facingDirection << 0.9, 0.4;
+        } else
+        {
+            input.motionDirection << 0.0, 1.0;
+            input.facingDirection << 1.0, 0.0;
+        }
+        return input;
+    };
+
+    std::vector<std::chrono::nanoseconds> inputBuildLatencies, setInputLatencies, advanceLatencies;
+    std::vector<std::int64_t> allocationsPerFrame;
+    inputBuildLatencies.reserve(numberOfFrames);
+    setInputLatencies.reserve(numberOfFrames);
+    advanceLatencies.reserve(numberOfFrames);
+    allocationsPerFrame.reserve(numberOfFrames);
+
+    std::int64_t firstFrameAllocations = 0;
+
+    for (int frame = 0; frame < numberOfFrames; frame++)
+    {
+        const std::int64_t allocationsAtFrameStart
+            = globalAllocationCounter.load(std::memory_order_relaxed);
+
+        // stage 1: build the MANNAutoregressive input from the joystick values
+        auto start = std::chrono::steady_clock::now();
+        REQUIRE(builder.setInput(joystickInputAtFrame(frame)));
+        REQUIRE(builder.advance());
+        inputBuildLatencies.push_back(std::chrono::steady_clock::now() - start);
+
+        // stage 2: feed the autoregressive model
+        start = std::chrono::steady_clock::now();
+        REQUIRE(autoregressive.setInput(builder.getOutput()));
+        setInputLatencies.push_back(std::chrono::steady_clock::now() - start);
+
+        // stage 3: network inference and autoregressive update (legged odometry, contact
+        // detection)
+        start = std::chrono::steady_clock::now();
+        REQUIRE(autoregressive.advance());
+        advanceLatencies.push_back(std::chrono::steady_clock::now() - start);
+
+        const std::int64_t frameAllocations
+            = globalAllocationCounter.load(std::memory_order_relaxed) - allocationsAtFrameStart;
+
+        // the first frame pays the lazily allocated buffers, so it is reported separately
+        if (frame == 0)
+        {
+            firstFrameAllocations = frameAllocations;
+        } else
+        {
+            allocationsPerFrame.push_back(frameAllocations);
+        }
+    }
+
+    // measure the raw network inference on a standalone instance to isolate it from the
+    // autoregressive update
+    auto mannHandler = mannGroup->clone();
+    mannHandler->setParameter("number_of_joints", int(jointsList.size()));
+
+    MANN mann;
+    REQUIRE(mann.initialize(mannHandler));
+    REQUIRE(mann.setInput(initialInput));
+    REQUIRE(mann.advance()); // warm-up
+
+    constexpr int numberOfInferences = 100;
+    std::vector<std::chrono::nanoseconds> inferenceLatencies;
+    inferenceLatencies.reserve(numberOfInferences);
+    for (int i = 0; i < numberOfInferences; i++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        REQUIRE(mann.advance());
+        inferenceLatencies.push_back(std::chrono::steady_clock::now() - start);
+    }
+
+    auto toMicroseconds = [](const std::chrono::nanoseconds& value) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(value).count();
+    };
+
+    BipedalLocomotion::log()->info("[benchmark_MANN] {} frames. Median latencies: input build = "
+                                   "{} us, setInput = {} us, advance = {} us, raw inference = {} "
+                                   "us.",
+                                   numberOfFrames,
+                                   toMicroseconds(median(std::move(inputBuildLatencies))),
+                                   toMicroseconds(median(std::move(setInputLatencies))),
+                                   toMicroseconds(median(std::move(advanceLatencies))),
+                                   toMicroseconds(median(std::move(inferenceLatencies))));
+
+    BipedalLocomotion::log()->info("[benchmark_MANN] Heap allocations per frame: median = {}, "
+                                   "first frame = {}.",
+                                   median(std::move(allocationsPerFrame)),
+                                   firstFrameAllocations);
+}
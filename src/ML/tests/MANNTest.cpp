@@ -5,6 +5,7 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <filesystem>
 #include <memory>
 
 // Catch2
@@ -18,18 +19,9 @@
 using namespace BipedalLocomotion::ML;
 using namespace BipedalLocomotion::ParametersHandler;
 
-TEST_CASE("MANN")
+MANNInput createMANNInput()
 {
-    MANN mann;
-
-    auto handler = std::make_shared<StdImplementation>();
-    handler->setParameter("number_of_joints", 26);
-    handler->setParameter("projected_base_horizon", 12);
-    handler->setParameter("onnx_model_path", getMANNModelPath());
-
-    REQUIRE(mann.initialize(handler));
-
-    // set the input. The values are taken from a python test
+    // create the input. The values are taken from a python test
     MANNInput input;
     input.basePositionTrajectory.resize(2, 12);
     input.facingDirectionTrajectory.resize(2, 12);
@@ -97,7 +89,84 @@ TEST_CASE("MANN")
         -0.08404139429330826, 2.529428034093097e-05, 0.16792771220207214, -0.02287937013013993,
         -0.002927608219628366, 0.018047571904430328, -0.01034426546939903;
 
-    REQUIRE(mann.setInput(input));
+    return input;
+}
+
+TEST_CASE("MANN")
+{
+    MANN mann;
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("number_of_joints", 26);
+    handler->setParameter("projected_base_horizon", 12);
+    handler->setParameter("onnx_model_path", getMANNModelPath());
+
+    REQUIRE(mann.initialize(handler));
+
+    REQUIRE(mann.setInput(createMANNInput()));
     REQUIRE(mann.advance());
     REQUIRE(mann.isOutputValid());
 }
+
+TEST_CASE("MANN quantized model")
+{
+    // the quantized model is not shipped with the repository. It can be generated from the fp32
+    // one with the blf-mann-quantizer utility
+    if (!std::filesystem::exists(getMANNQuantizedModelPath()))
+    {
+        return;
+    }
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("number_of_joints", 26);
+    handler->setParameter("projected_base_horizon", 12);
+    handler->setParameter("onnx_model_path", getMANNModelPath());
+
+    MANN mann;
+    REQUIRE(mann.initialize(handler));
+
+    handler->setParameter("onnx_model_path", getMANNQuantizedModelPath());
+    MANN quantizedMann;
+    REQUIRE(quantizedMann.initialize(handler));
+
+    const MANNInput input = createMANNInput();
+
+    REQUIRE(mann.setInput(input));
+    REQUIRE(mann.advance());
+
+    REQUIRE(quantizedMann.setInput(input));
+    REQUIRE(quantizedMann.advance());
+    REQUIRE(quantizedMann.isOutputValid());
+
+    // the quantized network is not expected to reproduce the fp32 output exactly, however the
+    // drift must stay within bounds that do not affect the generated motion
+    constexpr double jointDriftBound = 1e-2; // radians
+    constexpr double trajectoryDriftBound = 1e-2; // meters or meters per second
+
+    const MANNOutput& output = mann.getOutput();
+    const MANNOutput& quantizedOutput = quantizedMann.getOutput();
+
+    REQUIRE((quantizedOutput.jointPositions - output.jointPositions).cwiseAbs().maxCoeff()
+            < jointDriftBound);
+    REQUIRE((quantizedOutput.jointVelocities - output.jointVelocities).cwiseAbs().maxCoeff()
+            < jointDriftBound);
+    REQUIRE((quantizedOutput.futureBasePositionTrajectory - output.futureBasePositionTrajectory)
+                .cwiseAbs()
+                .maxCoeff()
+            < trajectoryDriftBound);
+    REQUIRE((quantizedOutput.futureFacingDirectionTrajectory
+             - output.futureFacingDirectionTrajectory)
+                .cwiseAbs()
+                .maxCoeff()
+            < trajectoryDriftBound);
+    REQUIRE((quantizedOutput.futureBaseVelocitiesTrajectory
+             - output.futureBaseVelocitiesTrajectory)
+                .cwiseAbs()
+                .maxCoeff()
+            < trajectoryDriftBound);
+    REQUIRE((quantizedOutput.projectedBaseVelocity.coeffs()
+             - output.projectedBaseVelocity.coeffs())
+                .cwiseAbs()
+                .maxCoeff()
+            < trajectoryDriftBound);
+}
@@ -67,6 +67,10 @@ public:
     /**
      * Run the algorithm to compute the unique stabilizing solution of the continuous algebriac
      * Riccati equation.
+     * @note When a solution computed by a previous call is available, the solver first attempts a
+     * warm started Newton-Kleinman refinement seeded from it. If the matrices changed only
+     * slightly since the last solve (e.g. gain scheduling) few iterations are sufficient and the
+     * dense cold solve is skipped. The cold algorithm is automatically used as fallback.
      * @return True in case of success and false otherwise.
      */
     bool solve();
@@ -0,0 +1,327 @@
+/**
+ * @file ContactWrenchConeT.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_MATH_CONTACT_WRENCH_CONE_T_H
+#define BIPEDAL_LOCOMOTION_MATH_CONTACT_WRENCH_CONE_T_H
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <manif/manif.h>
+
+#include <BipedalLocomotion/Math/Wrench.h>
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace BipedalLocomotion
+{
+namespace Math
+{
+
+/**
+ * ContactWrenchConeT is the variant of ContactWrenchCone with the number of slices fixed at
+ * compile time. The constraint matrix and vector have a compile time size, and the
+ * trigonometric coefficients associated to the slices are computed only once per process and
+ * shared by all the instances: building the constraint for a given foot geometry reduces to
+ * filling a fixed size matrix from a precomputed table. Please refer to ContactWrenchCone for
+ * the meaning and the derivation of the constraint
+ * \f[
+ * A w \le b
+ * \f]
+ * where \f$w\f$ is the contact wrench expressed in body representation.
+ * @tparam Slices number of slices used to split 90 deg.
+ */
+template <int Slices> class ContactWrenchConeT
+{
+    static_assert(Slices > 0, "The number of slices must be a strictly positive number.");
+
+public:
+    static constexpr int frictionConeConstraints = 4 * Slices; /**< Number of rows of the
+                                                                   linearized friction cone */
+    static constexpr int copConstraints = 4; /**< Number of rows constraining the CoP inside the
+                                                 support area */
+    static constexpr int yawTorqueConstraints = 8; /**< Number of rows bounding the yaw torque */
+    static constexpr int rows
+        = frictionConeConstraints + copConstraints + yawTorqueConstraints; /**< Total number of
+                                                                               rows of the
+                                                                               constraint */
+
+    using MatrixType = Eigen::Matrix<double, rows, 6>; /**< Type of the matrix A */
+    using VectorType = Eigen::Matrix<double, rows, 1>; /**< Type of the vector b */
+
+    /**
+     * Build the constraint associated to a given foot geometry.
+     * @param staticFrictionCoefficient static friction coefficient.
+     * @param limitsX x coordinate of the foot limits w.r.t the frame attached to the surface.
+     * @param limitsY y coordinate of the foot limits w.r.t the frame attached to the surface.
+     * @return true in case of success/false otherwise.
+     */
+    bool setGeometry(const double staticFrictionCoefficient,
+                     const std::array<double, 2>& limitsX,
+                     const std::array<double, 2>& limitsY)
+    {
+        constexpr auto errorPrefix = "[ContactWrenchConeT::setGeometry]";
+        constexpr int wrenchSize = Wrench<double>::SizeAtCompileTime;
+
+        if (staticFrictionCoefficient <= 0)
+        {
+            log()->error("{} The static friction coefficient must be a strictly positive number.",
+                         errorPrefix);
+            return false;
+        }
+
+        m_A.setZero();
+        m_b.setZero();
+
+        // the trigonometric generation of the slices is performed only once per process, here
+        // the coefficients are simply copied in the matrix
+        const auto& coefficients = sliceCoefficients();
+        for (int i = 0; i < frictionConeConstraints; i++)
+        {
+            m_A(i, 0) = -coefficients[i].sign * coefficients[i].slope;
+            m_A(i, 1) = coefficients[i].sign;
+            m_A(i, 2) = -coefficients[i].sign * coefficients[i].offset * staticFrictionCoefficient;
+        }
+
+        // CoP constraints
+        auto ACoP = m_A.template middleRows<copConstraints>(frictionConeConstraints);
+        ACoP(0, 2) = limitsY[0];
+        ACoP(1, 2) = -limitsY[1];
+        ACoP(0, 3) = -1;
+        ACoP(1, 3) = 1;
+        ACoP(2, 2) = limitsX[0];
+        ACoP(3, 2) = -limitsX[1];
+        ACoP(2, 4) = 1;
+        ACoP(3, 4) = -1;
+
+        Eigen::Vector3d center;
+        center << (limitsX[0] + limitsX[1]) / 2.0, (limitsY[0] + limitsY[1]) / 2.0, 0;
+
+        const double halfRectangleLength = (std::abs(limitsX[0]) + std::abs(limitsX[1])) / 2.0;
+        const double halfRectangleWidth = (std::abs(limitsY[0]) + std::abs(limitsY[1])) / 2.0;
+
+        // please refer to the last 8 rows of the matrix U presented in
+        // https://scaron.info/publications/icra-2015.html
+        Eigen::Matrix<double, yawTorqueConstraints, wrenchSize> AYawTorque;
+        AYawTorque.row(0) << -halfRectangleWidth, -halfRectangleLength,
+            -(halfRectangleWidth + halfRectangleLength) * staticFrictionCoefficient,
+            staticFrictionCoefficient, staticFrictionCoefficient, -1;
+
+        AYawTorque.row(1) << -halfRectangleWidth, halfRectangleLength,
+            -(halfRectangleWidth + halfRectangleLength) * staticFrictionCoefficient,
+            staticFrictionCoefficient, -staticFrictionCoefficient, -1;
+
+        AYawTorque.row(2) << halfRectangleWidth, -halfRectangleLength,
+            -(halfRectangleWidth + halfRectangleLength) * staticFrictionCoefficient,
+            -staticFrictionCoefficient, staticFrictionCoefficient, -1;
+
+        AYawTorque.row(3) << halfRectangleWidth, halfRectangleLength,
+            -(halfRectangleWidth + halfRectangleLength) * staticFrictionCoefficient,
+            -staticFrictionCoefficient, -staticFrictionCoefficient, -1;
+
+        AYawTorque.row(4) << halfRectangleWidth, halfRectangleLength,
+            -(halfRectangleWidth + halfRectangleLength) * staticFrictionCoefficient,
+            staticFrictionCoefficient, staticFrictionCoefficient, 1;
+
+        AYawTorque.row(5) << halfRectangleWidth, -halfRectangleLength,
+            -(halfRectangleWidth + halfRectangleLength) * staticFrictionCoefficient,
+            staticFrictionCoefficient, -staticFrictionCoefficient, 1;
+
+        AYawTorque.row(6) << -halfRectangleWidth, halfRectangleLength,
+            -(halfRectangleWidth + halfRectangleLength) * staticFrictionCoefficient,
+            -staticFrictionCoefficient, staticFrictionCoefficient, 1;
+
+        AYawTorque.row(7) << -halfRectangleWidth, -halfRectangleLength,
+            -(halfRectangleWidth + halfRectangleLength) * staticFrictionCoefficient,
+            -staticFrictionCoefficient, -staticFrictionCoefficient, 1;
+
+        // AYawTorque expects a wrench expressed in the center of the contact surface. The
+        // following adjoint transform brings the wrench expressed in the frame attached to the
+        // contact surface in the center of the surface. The orientation of the two frames is
+        // identical and the translation is given by the 3d vector named center.
+        Eigen::Matrix<double, wrenchSize, wrenchSize> adjointTransform
+            = Eigen::Matrix<double, wrenchSize, wrenchSize>::Identity();
+        adjointTransform.bottomLeftCorner<3, 3>() = manif::skew(-center);
+
+        m_A.template bottomRows<yawTorqueConstraints>().noalias() = AYawTorque * adjointTransform;
+
+        m_isIntialized = true;
+
+        return true;
+    }
+
+    /**
+     * Initialize the Contact Wrench Cone class.
+     * @param handler pointer to the parameter handler.
+     * @note The following parameters are required:
+     * |         Parameter Name        |       Type       |                               Description                               | Mandatory |
+     * |:-----------------------------:|:----------------:|:-----------------------------------------------------------------------:|:---------:|
+     * | `static_friction_coefficient` |     `double`     |                       Static friction coefficient.                      |    Yes    |
+     * |        `foot_limits_x`        | `vector<double>` | x coordinate of the foot limits w.r.t the frame attached to the surface |    Yes    |
+     * |        `foot_limits_y`        | `vector<double>` | y coordinate of the foot limits w.r.t the frame attached to the surface |    Yes    |
+     * Differently from ContactWrenchCone, the number of slices is given by the template
+     * parameter.
+     * @return true in case of success/false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+    {
+        constexpr auto errorPrefix = "[ContactWrenchConeT::initialize]";
+
+        auto ptr = handler.lock();
+        if (ptr == nullptr)
+        {
+            log()->error("{} Invalid parameter handler.", errorPrefix);
+            return false;
+        }
+
+        double staticFrictionCoefficient = -1;
+        bool ok = ptr->getParameter("static_friction_coefficient", staticFrictionCoefficient);
+
+        std::vector<double> limitsX, limitsY;
+        ok = ok && ptr->getParameter("foot_limits_x", limitsX);
+        ok = ok && ptr->getParameter("foot_limits_y", limitsY);
+        ok = ok && (limitsX.size() == limitsY.size()) && (limitsX.size() == 2);
+
+        if (!ok)
+        {
+            log()->error("{} Unable to retrieve all the parameters.", errorPrefix);
+            return false;
+        }
+
+        return this->setGeometry(staticFrictionCoefficient,
+                                 {limitsX[0], limitsX[1]},
+                                 {limitsY[0], limitsY[1]});
+    }
+
+    /**
+     * Get the matrix A.
+     * @return the matrix A.
+     */
+    const MatrixType& getA() const
+    {
+        constexpr auto error = "[ContactWrenchConeT::getA] Please initialize the class before.";
+
+        if (!m_isIntialized)
+        {
+            log()->warn(error);
+            assert(m_isIntialized && error);
+        }
+
+        return m_A;
+    }
+
+    /**
+     * Get the vector B.
+     * @return the matrix B..
+     */
+    const VectorType& getB() const
+    {
+        constexpr auto error = "[ContactWrenchConeT::getB] Please initialize the class before.";
+
+        if (!m_isIntialized)
+        {
+            log()->warn(error);
+            assert(m_isIntialized && error);
+        }
+
+        return m_b;
+    }
+
+private:
+    /**
+     * Coefficients of a row of the linearized friction cone. The row is written as
+     * sign * [-slope, 1, -offset * mu] where mu is the static friction coefficient.
+     */
+    struct SliceCoefficients
+    {
+        double slope; /**< Angular coefficient of the segment approximating the slice */
+        double offset; /**< Offset of the segment approximating the slice */
+        double sign; /**< Sign of the inequality */
+    };
+
+    /**
+     * Get the coefficients associated to the slices. The table is computed at the first access
+     * and then shared by all the instances with the same number of slices.
+     */
+    static const std::array<SliceCoefficients, frictionConeConstraints>& sliceCoefficients()
+    {
+        static const std::array<SliceCoefficients, frictionConeConstraints> coefficients = []() {
+            std::array<SliceCoefficients, frictionConeConstraints> out;
+
+            // split the friction cone into slices. The generation mirrors the one implemented
+            // in LinearizedFrictionCone
+            constexpr double segmentAngle = M_PI / (2 * Slices);
+            constexpr int numberOfEquations = frictionConeConstraints;
+
+            std::array<double, numberOfEquations> angles, pointsX, pointsY;
+            for (int i = 0; i < numberOfEquations; i++)
+            {
+                angles[i] = i * segmentAngle;
+                pointsX[i] = std::cos(angles[i]);
+                pointsY[i] = std::sin(angles[i]);
+            }
+
+            for (int i = 0; i < numberOfEquations; i++)
+            {
+                const double firstPointX = pointsX[i];
+                const double firstPointY = pointsY[i];
+
+                const double secondPointX = pointsX[(i + 1) % numberOfEquations];
+                const double secondPointY = pointsY[(i + 1) % numberOfEquations];
+
+                out[i].slope = (secondPointY - firstPointY) / (secondPointX - firstPointX);
+                out[i].offset = firstPointY - out[i].slope * firstPointX;
+                out[i].sign
+                    = (angles[i] > M_PI || angles[(i + 1) % numberOfEquations] > M_PI) ? -1 : 1;
+            }
+
+            return out;
+        }();
+
+        return coefficients;
+    }
+
+    MatrixType m_A{MatrixType::Zero()}; /**< Matrix A */
+    VectorType m_b{VectorType::Zero()}; /**< Vector b */
+
+    bool m_isIntialized{false}; /**< True if the class has been correctly initialize */
+};
+
+/**
+ * The CommonContactWrenchCones namespace collects the cones precomputed for the foot
+ * geometries commonly used in the framework. Each instance is built at the first access and
+ * then shared, so retrieving one of them is a simple table lookup.
+ */
+namespace CommonContactWrenchCones
+{
+
+/**
+ * Cone associated to the rectangular ergoCub foot (foot_limits_x = (-0.1, 0.1) m,
+ * foot_limits_y = (-0.05, 0.05) m) with static friction coefficient equal to 0.3 and 4 slices.
+ */
+inline const ContactWrenchConeT<4>& ergoCubFoot()
+{
+    static const ContactWrenchConeT<4> cone = []() {
+        ContactWrenchConeT<4> temp;
+        temp.setGeometry(0.3, {-0.1, 0.1}, {-0.05, 0.05});
+        return temp;
+    }();
+
+    return cone;
+}
+
+} // namespace CommonContactWrenchCones
+
+} // namespace Math
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_MATH_CONTACT_WRENCH_CONE_T_H
@@ -8,6 +8,7 @@
 #ifndef BIPEDAL_LOCOMOTION_MATH_LINEARIZED_FRICTION_CONE_H
 #define BIPEDAL_LOCOMOTION_MATH_LINEARIZED_FRICTION_CONE_H
 
+#include <cstddef>
 #include <memory>
 
 #include <Eigen/Dense>
@@ -35,6 +36,15 @@ class LinearizedFrictionCone
     Eigen::MatrixXd m_A;
     Eigen::VectorXd m_b;
 
+    /** Third column of the matrix A computed for a unitary friction coefficient. The
+     * discretization of the cone depends on the friction coefficient only through this column,
+     * which scales linearly with it. */
+    Eigen::VectorXd m_normalCoefficients;
+
+    double m_staticFrictionCoefficient{0.0}; /**< Friction coefficient currently in use. */
+
+    std::size_t m_generation{0}; /**< Counter incremented every time the constraints change. */
+
     bool m_isIntialized{false}; /**< True if the class has been correctly initialize */
 
 public:
@@ -51,6 +61,33 @@ public:
      */
     bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
 
+    /**
+     * Update the friction coefficient without regenerating the cone discretization. The slices
+     * of the cone do not depend on the friction coefficient, which only scales the column of the
+     * matrix A multiplying the normal force. The update is performed in place (no reallocation)
+     * so it can be called online, e.g. when the friction coefficient is adapted from slip
+     * detection.
+     * @param staticFrictionCoefficient the new static friction coefficient. It must be strictly
+     * positive.
+     * @return true in case of success/false otherwise.
+     */
+    bool updateStaticFrictionCoefficient(const double staticFrictionCoefficient);
+
+    /**
+     * Get the friction coefficient currently in use.
+     * @return the static friction coefficient.
+     */
+    double getStaticFrictionCoefficient() const;
+
+    /**
+     * Get the generation of the constraints. The counter is incremented by initialize() and by
+     * updateStaticFrictionCoefficient(), so a consumer can compare the value with the one seen at
+     * the previous iteration and re-upload the constraints to the solver only when they actually
+     * changed.
+     * @return the generation counter. Zero is returned when the class has never been initialized.
+     */
+    std::size_t generation() const;
+
     /**
      * Get the matrix A.
      * @return the matrix A.
@@ -52,13 +52,56 @@ public:
      * @param controlPoint control point of the curve.
      * @param finalPoint final point of the curve.
      * @return a matrix containing the curve.
+     * @note The curve is sampled at the knots generated by initialize(). Since the Bernstein basis
+     * associated with the knots is precomputed, the evaluation reduces to a single matrix product.
      */
     Eigen::Ref<const Eigen::Matrix2Xd> evaluateCurve(Eigen::Ref<const Eigen::Vector2d> initialPoint,
                                                      Eigen::Ref<const Eigen::Vector2d> controlPoint,
                                                      Eigen::Ref<const Eigen::Vector2d> finalPoint);
 
+    /**
+     * Evaluate the curve given in initial, control and final points at user-provided knots.
+     * @param initialPoint initial point of the curve.
+     * @param controlPoint control point of the curve.
+     * @param finalPoint final point of the curve.
+     * @param knots vector containing the values of the parameter at which the curve is sampled.
+     * Each element is expected to belong to the interval [0, 1].
+     * @return a matrix containing the curve. Each column contains the point associated with the
+     * corresponding knot.
+     * @note All the points are computed in a single vectorized pass, so this overload should be
+     * preferred when the curve must be sampled at many knots per call.
+     */
+    Eigen::Ref<const Eigen::Matrix2Xd> evaluateCurve(Eigen::Ref<const Eigen::Vector2d> initialPoint,
+                                                     Eigen::Ref<const Eigen::Vector2d> controlPoint,
+                                                     Eigen::Ref<const Eigen::Vector2d> finalPoint,
+                                                     Eigen::Ref<const Eigen::VectorXd> knots);
+
+    /**
+     * Evaluate the curve given in initial, control and final points at user-provided knots storing
+     * the result in a preallocated matrix.
+     * @param initialPoint initial point of the curve.
+     * @param controlPoint control point of the curve.
+     * @param finalPoint final point of the curve.
+     * @param knots vector containing the values of the parameter at which the curve is sampled.
+     * Each element is expected to belong to the interval [0, 1].
+     * @param curve preallocated matrix where the curve is stored. Each column contains the point
+     * associated with the corresponding knot. The number of columns must be equal to the number of
+     * knots.
+     * @return true in case of success/false otherwise.
+     * @note Differently from the other overloads, this function does not allocate memory, so it is
+     * suitable for hard real-time loops.
+     */
+    bool evaluateCurve(Eigen::Ref<const Eigen::Vector2d> initialPoint,
+                       Eigen::Ref<const Eigen::Vector2d> controlPoint,
+                       Eigen::Ref<const Eigen::Vector2d> finalPoint,
+                       Eigen::Ref<const Eigen::VectorXd> knots,
+                       Eigen::Ref<Eigen::Matrix2Xd> curve);
+
 private:
     std::vector<double> m_knots; /**< Knots of the curve generated as linspace. */
+    Eigen::Matrix3Xd m_basis; /**< Bernstein basis evaluated at the knots. The i-th column contains
+                                 (1 - t_i)^2, 2 t_i (1 - t_i) and t_i^2. */
+    Eigen::Matrix3Xd m_tempBasis; /**< Bernstein basis evaluated at user-provided knots. */
     Eigen::Matrix2Xd m_curve; /**< Matrix containing the quadratic Bézier curve. */
 };
 
@@ -0,0 +1,197 @@
+/**
+ * @file SchmittTriggerBank.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_MATH_SCHMITT_TRIGGER_BANK_H
+#define BIPEDAL_LOCOMOTION_MATH_SCHMITT_TRIGGER_BANK_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/Math/SchmittTrigger.h>
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/System/Advanceable.h>
+
+namespace BipedalLocomotion
+{
+namespace Math
+{
+
+/**
+ * SchmittTriggerBankInput contains the input of the SchmittTriggerBank class.
+ */
+struct SchmittTriggerBankInput
+{
+    /** Current time instant */
+    std::chrono::nanoseconds time{std::chrono::nanoseconds::zero()};
+
+    /** Raw value of each channel considered as input by the bank */
+    Eigen::VectorXd rawValues;
+};
+
+/**
+ * SchmittTriggerBankOutput contains the output of the SchmittTriggerBank class. The time instants
+ * are stored in parallel arrays expressed in nanoseconds.
+ */
+struct SchmittTriggerBankOutput
+{
+    /** Current state of each channel */
+    Eigen::Array<bool, Eigen::Dynamic, 1> states;
+
+    /** Time instant at which each channel was toggled, expressed in nanoseconds */
+    Eigen::Array<std::int64_t, Eigen::Dynamic, 1> switchTimes;
+
+    /** Time instant at which the raw value of each channel transited from low to high or from
+     * high to low, expressed in nanoseconds */
+    Eigen::Array<std::int64_t, Eigen::Dynamic, 1> edgeTimes;
+};
+
+/**
+ * SchmittTriggerBank implements a set of SchmittTrigger sharing contiguous state arrays. All the
+ * channels are evaluated in a single branchless pass: the per-channel state logic is expressed
+ * with element-wise select/blend operations, avoiding the data dependent branches of the scalar
+ * trigger that are hard to predict on noisy signals. Each channel behaves exactly as a
+ * SchmittTrigger configured with the corresponding parameters.
+ */
+class SchmittTriggerBank
+    : public BipedalLocomotion::System::Advanceable<SchmittTriggerBankInput,
+                                                    SchmittTriggerBankOutput>
+{
+public:
+    // clang-format off
+    /**
+     * Initialize the SchmittTriggerBank block.
+     * @param handler pointer to the parameter handler.
+     * @note The following parameters are required
+     * |  Parameter Name   |          Type           |                                 Description                                  | Mandatory |
+     * |:-----------------:|:-----------------------:|:----------------------------------------------------------------------------:|:---------:|
+     * |  `on_thresholds`  |    `vector<double>`     |     High value threshold of each channel to initiate an ON state switch      |    Yes    |
+     * | `off_thresholds`  |    `vector<double>`     |      Low value threshold of each channel to initiate an OFF state switch     |    Yes    |
+     * | `switch_on_after` | `vector<chrono>`        | Time to wait before switching each channel to ON state from OFF state        |    Yes    |
+     * |`switch_off_after` | `vector<chrono>`        | Time to wait before switching each channel to OFF state from ON state        |    Yes    |
+     * All the vectors must contain one element per channel.
+     * @return true in case of success/false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler) override;
+    // clang-format on
+
+    /**
+     * Initialize the SchmittTriggerBank block.
+     * @param parameters parameters of each channel of the bank.
+     * @return true in case of success/false otherwise.
+     */
+    bool initialize(const std::vector<SchmittTrigger::Params>& parameters);
+
+    /**
+     * Set the state of all the channels of the bank.
+     * @param states desired state of each channel.
+     * @return True if the state is successfully set, false otherwise.
+     * @note As for SchmittTrigger::setState, this function should be called to reset the bank
+     * before the first advance() call or when the user intends to manually control the state.
+     */
+    bool setState(const std::vector<SchmittTriggerState>& states);
+
+    /**
+     * Get the number of channels of the bank.
+     * @return the number of channels.
+     */
+    std::size_t numberOfChannels() const;
+
+    /**
+     * Get the state of a single channel.
+     * @param channel index of the channel.
+     * @return the current state of the channel.
+     */
+    bool channelState(std::size_t channel) const;
+
+    /**
+     * Get the time instant at which a single channel was toggled.
+     * @param channel index of the channel.
+     * @return the switch time of the channel.
+     */
+    std::chrono::nanoseconds switchTime(std::size_t channel) const;
+
+    /**
+     * Get the time instant at which the raw value of a single channel crossed the threshold.
+     * @param channel index of the channel.
+     * @return the edge time of the channel.
+     */
+    std::chrono::nanoseconds edgeTime(std::size_t channel) const;
+
+    /**
+     * Perform one step of all the triggers of the bank.
+     * @return true in case of success, false otherwise.
+     */
+    bool advance() override;
+
+    /**
+     * Check if the output of the bank is valid.
+     * @return true in case of success, false otherwise.
+     */
+    bool isOutputValid() const override;
+
+    /**
+     * Get the output of the bank.
+     * @return a const reference to the output of the bank.
+     */
+    const SchmittTriggerBankOutput& getOutput() const override;
+
+    /**
+     * Set the input of the bank.
+     * @param input the input of the system. It contains the raw value of each channel and the
+     * current time instant.
+     * @return true in case of success, false otherwise.
+     */
+    bool setInput(const SchmittTriggerBankInput& input) override;
+
+private:
+    using BoolArray = Eigen::Array<bool, Eigen::Dynamic, 1>;
+    using TimeArray = Eigen::Array<std::int64_t, Eigen::Dynamic, 1>;
+
+    SchmittTriggerBankInput m_input; /**< Last input stored in the bank */
+    SchmittTriggerBankOutput m_output; /**< Output of the bank */
+
+    Eigen::ArrayXd m_onThreshold; /**< High value threshold of each channel */
+    Eigen::ArrayXd m_offThreshold; /**< Low value threshold of each channel */
+    TimeArray m_switchOnAfter; /**< Time to wait before switching each channel to ON */
+    TimeArray m_switchOffAfter; /**< Time to wait before switching each channel to OFF */
+
+    BoolArray m_state; /**< Current state of each channel */
+    TimeArray m_timer; /**< Internal timer of each channel */
+    TimeArray m_risingEdgeTimeInstant; /**< Rising edge time instant of each channel */
+    TimeArray m_fallingEdgeTimeInstant; /**< Falling edge time instant of each channel */
+    BoolArray m_risingDetected; /**< True if the rising edge of a channel is detected */
+    BoolArray m_fallingDetected; /**< True if the falling edge of a channel is detected */
+
+    /** Preallocated buffers used to evaluate the branchless pass */
+    BoolArray m_above;
+    BoolArray m_below;
+    BoolArray m_switched;
+    TimeArray m_risingEdgeCandidate;
+    TimeArray m_fallingEdgeCandidate;
+    TimeArray m_timerOff;
+    TimeArray m_timerOn;
+
+    enum class FSM
+    {
+        Idle,
+        Initialized,
+        Reset,
+        OutputInvalid,
+        OutputValid,
+    };
+
+    FSM m_fsm{FSM::Idle};
+};
+
+} // namespace Math
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_MATH_SCHMITT_TRIGGER_BANK_H
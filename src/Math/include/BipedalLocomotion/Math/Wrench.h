@@ -8,6 +8,8 @@
 #ifndef BIPEDAL_LOCOMOTION_MATH_WRENCH_H
 #define BIPEDAL_LOCOMOTION_MATH_WRENCH_H
 
+#include <cassert>
+
 #include <Eigen/Dense>
 
 #include <manif/SE3.h>
@@ -163,6 +165,63 @@ Wrench<Scalar> operator*(const manif::SO3<Scalar>& rotation, const Wrench<Scalar
     return ret;
 }
 
+/**
+ * Change the frame in which a batch of wrenches sharing the same transform is expressed.
+ * Each column of the matrices contains one wrench, with the force in the first three rows and the
+ * torque in the last three. The rotation and the skew matrix of the translation are materialized
+ * once and applied to the whole batch with 3xN block products, so re-expressing the wrenches of
+ * several contacts in a common frame does not pay the transform decomposition per wrench.
+ * @param transform a manif::SE3 object representing a homogeneous transformation that changes the
+ * coordinates of a vector expressed in the frame A into the coordinates in the frame B.
+ * @param wrenches 6xN matrix whose columns contain the wrenches expressed in the frame A.
+ * @param transformedWrenches 6xN matrix whose columns are filled with the wrenches expressed in
+ * the frame B. The matrix must be already resized to the proper dimension. It must not alias
+ * `wrenches`.
+ */
+template <class Scalar>
+void transformWrenches(const manif::SE3<Scalar>& transform,
+                       Eigen::Ref<const Eigen::Matrix<Scalar, 6, Eigen::Dynamic>> wrenches,
+                       Eigen::Ref<Eigen::Matrix<Scalar, 6, Eigen::Dynamic>> transformedWrenches)
+{
+    assert(wrenches.cols() == transformedWrenches.cols()
+           && "The input and output matrices must have the same number of columns.");
+
+    const Eigen::Matrix<Scalar, 3, 3> rotation = transform.rotation();
+    const Eigen::Matrix<Scalar, 3, 3> translationSkew = manif::skew(transform.translation());
+
+    transformedWrenches.template topRows<3>().noalias()
+        = rotation * wrenches.template topRows<3>();
+    transformedWrenches.template bottomRows<3>().noalias()
+        = rotation * wrenches.template bottomRows<3>();
+    transformedWrenches.template bottomRows<3>().noalias()
+        += translationSkew * transformedWrenches.template topRows<3>();
+}
+
+/**
+ * Change the frame in which a batch of wrenches sharing the same rotation is expressed.
+ * Each column of the matrices contains one wrench, with the force in the first three rows and the
+ * torque in the last three.
+ * @param rotation a manif::SO3 object representing a rotation that changes the coordinates of a
+ * vector expressed in the frame A into the coordinates in the frame B.
+ * @param wrenches 6xN matrix whose columns contain the wrenches expressed in the frame A.
+ * @param rotatedWrenches 6xN matrix whose columns are filled with the wrenches expressed in the
+ * frame B. The matrix must be already resized to the proper dimension.
+ */
+template <class Scalar>
+void transformWrenches(const manif::SO3<Scalar>& rotation,
+                       Eigen::Ref<const Eigen::Matrix<Scalar, 6, Eigen::Dynamic>> wrenches,
+                       Eigen::Ref<Eigen::Matrix<Scalar, 6, Eigen::Dynamic>> rotatedWrenches)
+{
+    assert(wrenches.cols() == rotatedWrenches.cols()
+           && "The input and output matrices must have the same number of columns.");
+
+    const Eigen::Matrix<Scalar, 3, 3> rotationMatrix = rotation.rotation();
+    rotatedWrenches.template topRows<3>().noalias()
+        = rotationMatrix * wrenches.template topRows<3>();
+    rotatedWrenches.template bottomRows<3>().noalias()
+        = rotationMatrix * wrenches.template bottomRows<3>();
+}
+
 /**
  * A wrench of double
  */
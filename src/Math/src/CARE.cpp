@@ -5,6 +5,7 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <complex>
 #include <iostream>
 #include <sstream>
 
@@ -32,10 +33,26 @@ struct CARE::Impl
     Eigen::MatrixXd identity;
     Eigen::MatrixXd solution;
 
+    // workspace of the warm started refinement
+    bool hasPreviousSolution{false};
+    Eigen::MatrixXd BRinvBt;
+    Eigen::MatrixXd closedLoop;
+    Eigen::MatrixXd residual;
+    Eigen::MatrixXd correction;
+    Eigen::MatrixXd newSolution;
+    Eigen::ComplexSchur<Eigen::MatrixXd> schur;
+    Eigen::MatrixXcd lyapunovRhs;
+    Eigen::MatrixXcd lyapunovSolution;
+    Eigen::VectorXcd substitutionRhs;
+
     void resizeInteralMatrices()
     {
         const std::size_t n = B.rows();
 
+        // a solution computed for a problem of different size cannot seed the warm start
+        if (solution.rows() != n || solution.cols() != n)
+            hasPreviousSolution = false;
+
         // resize the Hamiltonian matrix
         Z.resize(2 * n, 2 * n);
         ZOld.resize(2 * n, 2 * n);
@@ -45,6 +62,87 @@ struct CARE::Impl
         identity.setIdentity();
         lhs.resize(2 * n, n);
         rhs.resize(2 * n, n);
+
+        BRinvBt.resize(n, n);
+        closedLoop.resize(n, n);
+        residual.resize(n, n);
+        correction.resize(n, n);
+        newSolution.resize(n, n);
+        lyapunovRhs.resize(n, n);
+        lyapunovSolution.resize(n, n);
+        substitutionRhs.resize(n);
+    }
+
+    bool refineWithNewtonKleinman()
+    {
+        const std::size_t n = A.rows();
+
+        // seed the iteration with the previous (symmetrized) solution and freeze the associated
+        // closed loop matrix. A single Schur decomposition is then shared by all the iterations
+        newSolution = 0.5 * (solution + solution.transpose());
+        closedLoop = A - BRinvBt * newSolution;
+
+        schur.compute(closedLoop);
+        if (schur.info() != Eigen::Success)
+            return false;
+
+        const Eigen::MatrixXcd& T = schur.matrixT();
+        const Eigen::MatrixXcd& U = schur.matrixU();
+
+        for (std::size_t iteration = 0; iteration < maxIterations; iteration++)
+        {
+            // residual of the Riccati equation evaluated at the current iterate
+            residual = newSolution * A + A.transpose() * newSolution
+                       - newSolution * BRinvBt * newSolution + Q;
+
+            // a non stabilizing seed makes the iteration diverge. In this case the cold solver
+            // is the only option
+            if (!residual.allFinite())
+                return false;
+
+            if (residual.norm() < tolerance * (1.0 + Q.norm()))
+            {
+                solution = newSolution;
+
+                if (isVerbose)
+                {
+                    std::cout << "[CARE::solve] Warm started refinement converged in " << iteration
+                              << " iterations." << std::endl;
+                }
+
+                return true;
+            }
+
+            // defect correction: the update E solves the Lyapunov equation
+            // closedLoop' E + E closedLoop = -residual. Since closedLoop = U T U^H the equation
+            // reduces to a triangular one solved column by column via forward substitution
+            lyapunovRhs = U.adjoint() * (-residual) * U;
+            for (std::size_t k = 0; k < n; k++)
+            {
+                substitutionRhs = lyapunovRhs.col(k);
+                for (std::size_t i = 0; i < k; i++)
+                    substitutionRhs -= T(i, k) * lyapunovSolution.col(i);
+
+                // (T^H + T(k, k) I) y = rhs with T^H lower triangular
+                for (std::size_t i = 0; i < n; i++)
+                {
+                    std::complex<double> accumulator = substitutionRhs(i);
+                    for (std::size_t j = 0; j < i; j++)
+                        accumulator -= std::conj(T(j, i)) * lyapunovSolution(j, k);
+                    lyapunovSolution(i, k) = accumulator / (std::conj(T(i, i)) + T(k, k));
+                }
+            }
+
+            correction = (U * lyapunovSolution * U.adjoint()).real();
+            newSolution += 0.5 * (correction + correction.transpose());
+        }
+
+        if (isVerbose)
+            std::cout << "[CARE::solve] Warm started refinement did not converge. Falling back to "
+                         "the cold solver."
+                      << std::endl;
+
+        return false;
     }
 };
 
@@ -131,6 +229,14 @@ bool CARE::solve()
         return false;
     }
 
+    m_pimpl->BRinvBt = m_pimpl->B * R_cholesky.solve(m_pimpl->B.transpose());
+
+    // when a previous solution is available a warm started Newton-Kleinman refinement is
+    // attempted first. If the matrices changed only slightly since the last solve (e.g. gain
+    // scheduling) few iterations are sufficient and the cold solve is skipped
+    if (m_pimpl->hasPreviousSolution && m_pimpl->refineWithNewtonKleinman())
+        return true;
+
     // Z represents the Hamiltonian matrix.
     //       _                _
     //      | A   B inv(R) B'  |
@@ -138,7 +244,7 @@ bool CARE::solve()
     //      |_Q       -  A'   _|
 
     m_pimpl->Z.block(0, 0, n, n) = m_pimpl->A;
-    m_pimpl->Z.block(0, n, n, n) = m_pimpl->B * R_cholesky.solve(m_pimpl->B.transpose());
+    m_pimpl->Z.block(0, n, n, n) = m_pimpl->BRinvBt;
     m_pimpl->Z.block(n, 0, n, n) = m_pimpl->Q;
     m_pimpl->Z.block(n, n, n, n) = -m_pimpl->A.transpose();
 
@@ -188,6 +294,9 @@ bool CARE::solve()
         std::cout << "[CARE::solve] " << info.str() << std::endl;
     }
 
+    // a valid solution can seed the warm started refinement of the next solve
+    m_pimpl->hasPreviousSolution = relativeNorm < m_pimpl->tolerance;
+
     return relativeNorm < m_pimpl->tolerance;
 }
 
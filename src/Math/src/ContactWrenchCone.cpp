@@ -11,6 +11,7 @@
 #include <manif/manif.h>
 
 #include <BipedalLocomotion/Math/ContactWrenchCone.h>
+#include <BipedalLocomotion/Math/ContactWrenchConeT.h>
 #include <BipedalLocomotion/Math/LinearizedFrictionCone.h>
 #include <BipedalLocomotion/Math/Wrench.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
@@ -31,6 +32,35 @@ bool ContactWrenchCone::initialize(std::weak_ptr<const ParametersHandler::IParam
         return false;
     }
 
+    // when the number of slices matches one of the compile time instantiations, the constraint
+    // is assembled from the precomputed slice tables of ContactWrenchConeT instead of being
+    // regenerated with the trigonometric functions
+    auto initializeFromTemplate = [this, &handler](auto cone) -> bool {
+        if (!cone.initialize(handler))
+        {
+            return false;
+        }
+
+        m_A = cone.getA();
+        m_b = cone.getB();
+        m_isIntialized = true;
+        return true;
+    };
+
+    int numberOfSlices = -1;
+    if (ptr->getParameter("number_of_slices", numberOfSlices))
+    {
+        if (numberOfSlices == 2)
+        {
+            return initializeFromTemplate(ContactWrenchConeT<2>());
+        }
+
+        if (numberOfSlices == 4)
+        {
+            return initializeFromTemplate(ContactWrenchConeT<4>());
+        }
+    }
+
     double staticFrictionCoefficient = -1;
     bool ok =  ptr->getParameter("static_friction_coefficient", staticFrictionCoefficient);
     ok = ok && staticFrictionCoefficient > 0;
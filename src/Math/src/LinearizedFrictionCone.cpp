@@ -79,11 +79,59 @@ bool LinearizedFrictionCone::initialize(std::weak_ptr<const ParametersHandler::I
             -inequalityFactor * offset * staticFrictionCoefficient;
     }
 
+    // the friction coefficient scales only the third column of A. Caching the column computed for
+    // a unitary coefficient allows updateStaticFrictionCoefficient() to rescale the constraints
+    // in place
+    m_normalCoefficients = m_A.col(2) / staticFrictionCoefficient;
+    m_staticFrictionCoefficient = staticFrictionCoefficient;
+    m_generation++;
+
     m_isIntialized = true;
 
     return true;
 }
 
+bool LinearizedFrictionCone::updateStaticFrictionCoefficient(
+    const double staticFrictionCoefficient)
+{
+    constexpr auto errorPrefix = "[LinearizedFrictionCone::updateStaticFrictionCoefficient]";
+
+    if (!m_isIntialized)
+    {
+        log()->error("{} Please initialize the class before.", errorPrefix);
+        return false;
+    }
+
+    if (!(staticFrictionCoefficient > 0))
+    {
+        log()->error("{} The static friction coefficient must be strictly positive.", errorPrefix);
+        return false;
+    }
+
+    if (staticFrictionCoefficient == m_staticFrictionCoefficient)
+    {
+        return true;
+    }
+
+    // the geometry-dependent structure of the cone is invariant, only the column of A multiplying
+    // the normal force has to be rescaled
+    m_A.col(2).noalias() = m_normalCoefficients * staticFrictionCoefficient;
+    m_staticFrictionCoefficient = staticFrictionCoefficient;
+    m_generation++;
+
+    return true;
+}
+
+double LinearizedFrictionCone::getStaticFrictionCoefficient() const
+{
+    return m_staticFrictionCoefficient;
+}
+
+std::size_t LinearizedFrictionCone::generation() const
+{
+    return m_generation;
+}
+
 Eigen::Ref<const Eigen::MatrixXd> LinearizedFrictionCone::getA() const
 {
     constexpr auto error = "[LinearizedFrictionCone::getA] Please initialize the class before.";
@@ -10,6 +10,24 @@
 
 using namespace BipedalLocomotion::Math;
 
+namespace
+{
+
+/**
+ * Evaluate the Bernstein basis of a quadratic Bézier curve at the given knots. The i-th column of
+ * the basis contains (1 - t_i)^2, 2 t_i (1 - t_i) and t_i^2.
+ */
+void evaluateBernsteinBasis(Eigen::Ref<const Eigen::VectorXd> knots,
+                            Eigen::Ref<Eigen::Matrix3Xd> basis)
+{
+    const auto& t = knots.transpose().array();
+    basis.row(0) = (1 - t).square();
+    basis.row(1) = 2 * t * (1 - t);
+    basis.row(2) = t.square();
+}
+
+} // namespace
+
 bool QuadraticBezierCurve::initialize(
     std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
 {
@@ -47,6 +65,11 @@ bool QuadraticBezierCurve::initialize(
     m_knots = linspace(0, 1, steps);
     m_curve.resize(2, steps);
 
+    // the knots are fixed, so the associated Bernstein basis can be evaluated once for all
+    m_basis.resize(3, steps);
+    evaluateBernsteinBasis(Eigen::Map<const Eigen::VectorXd>(m_knots.data(), m_knots.size()),
+                           m_basis);
+
     return true;
 }
 
@@ -55,13 +78,54 @@ QuadraticBezierCurve::evaluateCurve(Eigen::Ref<const Eigen::Vector2d> initialPoi
                                     Eigen::Ref<const Eigen::Vector2d> controlPoint,
                                     Eigen::Ref<const Eigen::Vector2d> finalPoint)
 {
-    for (int i = 0; i < m_knots.size(); i++)
+    Eigen::Matrix<double, 2, 3> controlPoints;
+    controlPoints << initialPoint, controlPoint, finalPoint;
+
+    m_curve.noalias() = controlPoints * m_basis;
+
+    return m_curve;
+}
+
+Eigen::Ref<const Eigen::Matrix2Xd>
+QuadraticBezierCurve::evaluateCurve(Eigen::Ref<const Eigen::Vector2d> initialPoint,
+                                    Eigen::Ref<const Eigen::Vector2d> controlPoint,
+                                    Eigen::Ref<const Eigen::Vector2d> finalPoint,
+                                    Eigen::Ref<const Eigen::VectorXd> knots)
+{
+    m_curve.resize(2, knots.size());
+    this->evaluateCurve(initialPoint, controlPoint, finalPoint, knots, m_curve);
+
+    return m_curve;
+}
+
+bool QuadraticBezierCurve::evaluateCurve(Eigen::Ref<const Eigen::Vector2d> initialPoint,
+                                         Eigen::Ref<const Eigen::Vector2d> controlPoint,
+                                         Eigen::Ref<const Eigen::Vector2d> finalPoint,
+                                         Eigen::Ref<const Eigen::VectorXd> knots,
+                                         Eigen::Ref<Eigen::Matrix2Xd> curve)
+{
+    constexpr auto logPrefix = "[QuadraticBezierCurve::evaluateCurve]";
+
+    if (curve.cols() != knots.size())
     {
-        const double knot = m_knots[i];
-        m_curve.col(i).noalias() = (1 - knot) * (1 - knot) * initialPoint;
-        m_curve.col(i).noalias() += 2 * knot * (1 - knot) * controlPoint;
-        m_curve.col(i).noalias() += knot * knot * finalPoint;
+        log()->error("{} The number of columns of the curve matrix is expected to be equal to the "
+                     "number of knots. Number of columns: {}. Number of knots: {}.",
+                     logPrefix,
+                     curve.cols(),
+                     knots.size());
+        return false;
     }
 
-    return m_curve;
+    if (m_tempBasis.cols() != knots.size())
+    {
+        m_tempBasis.resize(3, knots.size());
+    }
+    evaluateBernsteinBasis(knots, m_tempBasis);
+
+    Eigen::Matrix<double, 2, 3> controlPoints;
+    controlPoints << initialPoint, controlPoint, finalPoint;
+
+    curve.noalias() = controlPoints * m_tempBasis;
+
+    return true;
 }
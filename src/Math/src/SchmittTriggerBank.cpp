@@ -0,0 +1,272 @@
+/**
+ * @file SchmittTriggerBank.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <vector>
+
+#include <BipedalLocomotion/Math/SchmittTriggerBank.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::Math;
+
+bool SchmittTriggerBank::initialize(
+    std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[SchmittTriggerBank::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} Invalid parameter handler.", logPrefix);
+        return false;
+    }
+
+    auto populateparameter
+        = [logPrefix, ptr](const std::string& paramName, auto& parameter) -> bool {
+        if (!ptr->getParameter(paramName, parameter))
+        {
+            log()->error("{} Unable to find the parameter '{}'", logPrefix, paramName);
+            return false;
+        }
+        return true;
+    };
+
+    std::vector<double> onThresholds;
+    std::vector<double> offThresholds;
+    std::vector<std::chrono::nanoseconds> switchOnAfter;
+    std::vector<std::chrono::nanoseconds> switchOffAfter;
+
+    bool ok = populateparameter("on_thresholds", onThresholds);
+    ok = ok && populateparameter("off_thresholds", offThresholds);
+    ok = ok && populateparameter("switch_on_after", switchOnAfter);
+    ok = ok && populateparameter("switch_off_after", switchOffAfter);
+    if (!ok)
+    {
+        return false;
+    }
+
+    if (onThresholds.size() != offThresholds.size()
+        || onThresholds.size() != switchOnAfter.size()
+        || onThresholds.size() != switchOffAfter.size())
+    {
+        log()->error("{} All the parameters must contain one element per channel.", logPrefix);
+        return false;
+    }
+
+    std::vector<SchmittTrigger::Params> parameters(onThresholds.size());
+    for (std::size_t i = 0; i < onThresholds.size(); i++)
+    {
+        parameters[i].onThreshold = onThresholds[i];
+        parameters[i].offThreshold = offThresholds[i];
+        parameters[i].switchOnAfter = switchOnAfter[i];
+        parameters[i].switchOffAfter = switchOffAfter[i];
+    }
+
+    return this->initialize(parameters);
+}
+
+bool SchmittTriggerBank::initialize(const std::vector<SchmittTrigger::Params>& parameters)
+{
+    constexpr auto logPrefix = "[SchmittTriggerBank::initialize]";
+
+    if (parameters.empty())
+    {
+        log()->error("{} At least one channel is required.", logPrefix);
+        return false;
+    }
+
+    const Eigen::Index channels = parameters.size();
+    m_onThreshold.resize(channels);
+    m_offThreshold.resize(channels);
+    m_switchOnAfter.resize(channels);
+    m_switchOffAfter.resize(channels);
+
+    for (Eigen::Index i = 0; i < channels; i++)
+    {
+        if (parameters[i].offThreshold > parameters[i].onThreshold)
+        {
+            log()->error("{} The ON threshold must be greater than the OFF threshold. Channel: "
+                         "{}.",
+                         logPrefix,
+                         i);
+            return false;
+        }
+
+        m_onThreshold(i) = parameters[i].onThreshold;
+        m_offThreshold(i) = parameters[i].offThreshold;
+        m_switchOnAfter(i) = parameters[i].switchOnAfter.count();
+        m_switchOffAfter(i) = parameters[i].switchOffAfter.count();
+    }
+
+    m_state.setConstant(channels, false);
+    m_timer.setZero(channels);
+    m_risingEdgeTimeInstant.setZero(channels);
+    m_fallingEdgeTimeInstant.setZero(channels);
+    m_risingDetected.setConstant(channels, false);
+    m_fallingDetected.setConstant(channels, false);
+
+    m_above.setConstant(channels, false);
+    m_below.setConstant(channels, false);
+    m_switched.setConstant(channels, false);
+    m_risingEdgeCandidate.setZero(channels);
+    m_fallingEdgeCandidate.setZero(channels);
+    m_timerOff.setZero(channels);
+    m_timerOn.setZero(channels);
+
+    m_output.states.setConstant(channels, false);
+    m_output.switchTimes.setZero(channels);
+    m_output.edgeTimes.setZero(channels);
+
+    m_input.rawValues.setZero(channels);
+
+    m_fsm = FSM::Initialized;
+
+    return true;
+}
+
+bool SchmittTriggerBank::setState(const std::vector<SchmittTriggerState>& states)
+{
+    constexpr auto logPrefix = "[SchmittTriggerBank::setState]";
+
+    if (m_fsm == FSM::Idle)
+    {
+        log()->error("{} Initialize the bank before resetting the state.", logPrefix);
+        return false;
+    }
+
+    if (static_cast<Eigen::Index>(states.size()) != m_state.size())
+    {
+        log()->error("{} Unexpected number of states. Expected: {}. Provided: {}.",
+                     logPrefix,
+                     m_state.size(),
+                     states.size());
+        return false;
+    }
+
+    for (std::size_t i = 0; i < states.size(); i++)
+    {
+        m_state(i) = states[i].state;
+        m_timer(i) = states[i].timer.count();
+        m_risingEdgeTimeInstant(i) = states[i].risingEdgeTimeInstant.count();
+        m_fallingEdgeTimeInstant(i) = states[i].fallingEdgeTimeInstant.count();
+        m_risingDetected(i) = states[i].risingDetected;
+        m_fallingDetected(i) = states[i].fallingDetected;
+        m_output.states(i) = states[i].state;
+        m_output.switchTimes(i) = states[i].switchTime.count();
+        m_output.edgeTimes(i) = states[i].edgeTime.count();
+    }
+
+    m_fsm = FSM::Reset;
+    return true;
+}
+
+bool SchmittTriggerBank::advance()
+{
+    if (m_fsm == FSM::Idle || m_fsm == FSM::Initialized)
+    {
+        log()->error("[SchmittTriggerBank::advance] Reset the state before using it the first "
+                     "time.");
+        return false;
+    }
+
+    m_fsm = FSM::OutputInvalid;
+
+    const std::int64_t time = m_input.time.count();
+
+    // threshold crossings evaluated for all the channels at once
+    m_above = m_input.rawValues.array() >= m_onThreshold;
+    m_below = m_input.rawValues.array() <= m_offThreshold;
+
+    // OFF path: latch the rising edge when the signal crosses the ON threshold and integrate the
+    // timer while it stays above
+    m_risingEdgeCandidate = (m_above && !m_risingDetected).select(time, m_risingEdgeTimeInstant);
+    m_timerOff = m_above.select(time - m_risingEdgeCandidate, m_timer);
+
+    // ON path: latch the falling edge when the signal crosses the OFF threshold and integrate the
+    // timer while it stays below
+    m_fallingEdgeCandidate = (m_below && !m_fallingDetected).select(time, m_fallingEdgeTimeInstant);
+    m_timerOn = m_below.select(time - m_fallingEdgeCandidate, m_timer);
+
+    // blend the two paths according to the current state of each channel. The edge detection
+    // flags of the inactive path are cleared as in the scalar trigger
+    m_risingDetected = !m_state && (m_risingDetected || m_above);
+    m_fallingDetected = m_state && (m_fallingDetected || m_below);
+
+    m_risingEdgeTimeInstant = m_state.select(m_risingEdgeTimeInstant, m_risingEdgeCandidate);
+    m_fallingEdgeTimeInstant = m_state.select(m_fallingEdgeCandidate, m_fallingEdgeTimeInstant);
+
+    // a channel switches when its timer exceeds the associated threshold
+    m_switched = m_state.select(m_below && (m_timerOn >= m_switchOffAfter),
+                                m_above && (m_timerOff >= m_switchOnAfter));
+
+    m_timer = m_switched.select(std::int64_t(0), m_state.select(m_timerOn, m_timerOff));
+    m_output.switchTimes = m_switched.select(time, m_output.switchTimes);
+    m_output.edgeTimes
+        = m_switched.select(m_state.select(m_fallingEdgeCandidate, m_risingEdgeCandidate),
+                            m_output.edgeTimes);
+
+    // a channel that switches toggles its state
+    m_state = m_state != m_switched;
+    m_output.states = m_state;
+
+    m_fsm = FSM::OutputValid;
+
+    return true;
+}
+
+bool SchmittTriggerBank::isOutputValid() const
+{
+    return m_fsm == FSM::OutputValid;
+}
+
+bool SchmittTriggerBank::setInput(const SchmittTriggerBankInput& input)
+{
+    constexpr auto logPrefix = "[SchmittTriggerBank::setInput]";
+
+    if (m_fsm == FSM::Idle)
+    {
+        log()->error("{} Initialize the bank before setting the input.", logPrefix);
+        return false;
+    }
+
+    if (input.rawValues.size() != m_state.size())
+    {
+        log()->error("{} Unexpected number of raw values. Expected: {}. Provided: {}.",
+                     logPrefix,
+                     m_state.size(),
+                     input.rawValues.size());
+        return false;
+    }
+
+    m_input = input;
+    return true;
+}
+
+const SchmittTriggerBankOutput& SchmittTriggerBank::getOutput() const
+{
+    return m_output;
+}
+
+std::size_t SchmittTriggerBank::numberOfChannels() const
+{
+    return m_state.size();
+}
+
+bool SchmittTriggerBank::channelState(std::size_t channel) const
+{
+    return m_state(channel);
+}
+
+std::chrono::nanoseconds SchmittTriggerBank::switchTime(std::size_t channel) const
+{
+    return std::chrono::nanoseconds(m_output.switchTimes(channel));
+}
+
+std::chrono::nanoseconds SchmittTriggerBank::edgeTime(std::size_t channel) const
+{
+    return std::chrono::nanoseconds(m_output.edgeTimes(channel));
+}
@@ -47,4 +47,27 @@ TEST_CASE("Algebraic Riccati Equation")
 
     constexpr double tolerance = 1e-5;
     REQUIRE(matlabSolution.isApprox(solution, tolerance));
+
+    // slightly perturb the dynamics as in a gain scheduling scenario. The solver refines the
+    // previous solution instead of running the cold dense solve
+    Eigen::Matrix3d APerturbed = A;
+    APerturbed(0, 1) = 1.01;
+    APerturbed(2, 2) = 0.98;
+
+    REQUIRE(care.setMatrices(APerturbed, b, Q, R));
+    REQUIRE(care.solve());
+    const Eigen::MatrixXd warmSolution = care.getSolution();
+
+    // the warm started solution must coincide with the one computed from scratch
+    CARE coldCare;
+    REQUIRE(coldCare.setMatrices(APerturbed, b, Q, R));
+    REQUIRE(coldCare.solve());
+
+    REQUIRE(warmSolution.isApprox(coldCare.getSolution(), tolerance));
+
+    // the solution must satisfy the Riccati equation
+    const Eigen::Matrix3d residual = warmSolution * APerturbed + APerturbed.transpose() * warmSolution
+                                     - warmSolution * b * R.inverse() * b.transpose() * warmSolution
+                                     + Q;
+    REQUIRE(residual.isZero(tolerance));
 }
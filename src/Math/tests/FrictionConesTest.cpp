@@ -9,6 +9,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <BipedalLocomotion/Math/ContactWrenchCone.h>
+#include <BipedalLocomotion/Math/ContactWrenchConeT.h>
 #include <BipedalLocomotion/Math/LinearizedFrictionCone.h>
 #include <BipedalLocomotion/Math/Wrench.h>
 #include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
@@ -39,6 +40,30 @@ TEST_CASE("Linearized Friction Cone")
 
     constexpr double tolerance = 1e-4;
     REQUIRE(matlabSolution.isApprox(cone.getA(), tolerance));
+
+    SECTION("In-place friction coefficient update")
+    {
+        const std::size_t generation = cone.generation();
+        REQUIRE(generation > 0);
+
+        // the update must match a full re-initialization with the new coefficient
+        constexpr double newFrictionCoefficient = 0.7;
+        REQUIRE(cone.updateStaticFrictionCoefficient(newFrictionCoefficient));
+        REQUIRE(cone.getStaticFrictionCoefficient() == newFrictionCoefficient);
+        REQUIRE(cone.generation() == generation + 1);
+
+        params->setParameter("static_friction_coefficient", newFrictionCoefficient);
+        LinearizedFrictionCone referenceCone;
+        REQUIRE(referenceCone.initialize(params));
+        REQUIRE(referenceCone.getA().isApprox(cone.getA(), tolerance));
+
+        // setting the same coefficient again must not change the generation
+        REQUIRE(cone.updateStaticFrictionCoefficient(newFrictionCoefficient));
+        REQUIRE(cone.generation() == generation + 1);
+
+        // an invalid coefficient is rejected
+        REQUIRE_FALSE(cone.updateStaticFrictionCoefficient(-1.0));
+    }
 }
 
 
@@ -146,3 +171,42 @@ TEST_CASE("Contact wrench Cone")
         REQUIRE((constraintValue.array() > 0.0).any());
     }
 }
+
+TEST_CASE("Contact wrench Cone (compile time slices)")
+{
+    auto params = std::make_shared<StdImplementation>();
+    std::vector<double> limitsX{-0.05, 0.1};
+    std::vector<double> limitsY{-0.02, 0.01};
+    params->setParameter("number_of_slices", 3);
+    params->setParameter("static_friction_coefficient", 0.3);
+    params->setParameter("foot_limits_x", limitsX);
+    params->setParameter("foot_limits_y", limitsY);
+
+    // with 3 slices the runtime class follows the generic trigonometric generation, hence it
+    // can be used as reference for the compile time variant
+    ContactWrenchCone runtimeCone;
+    REQUIRE(runtimeCone.initialize(params));
+
+    ContactWrenchConeT<3> cone;
+    REQUIRE(cone.initialize(params));
+
+    REQUIRE(cone.getA().rows() == runtimeCone.getA().rows());
+    REQUIRE(runtimeCone.getA().isApprox(cone.getA()));
+    REQUIRE(runtimeCone.getB().isApprox(cone.getB()));
+
+    SECTION("Set geometry")
+    {
+        ContactWrenchConeT<3> coneFromGeometry;
+        REQUIRE(coneFromGeometry.setGeometry(0.3,
+                                             {limitsX[0], limitsX[1]},
+                                             {limitsY[0], limitsY[1]}));
+        REQUIRE(coneFromGeometry.getA().isApprox(cone.getA()));
+    }
+
+    SECTION("Precomputed instances")
+    {
+        const auto& ergoCubCone = CommonContactWrenchCones::ergoCubFoot();
+        REQUIRE(ergoCubCone.getA().rows() == ContactWrenchConeT<4>::rows);
+        REQUIRE(ergoCubCone.getB().isZero());
+    }
+}
@@ -0,0 +1,121 @@
+/**
+ * @file SchmittTriggerBankTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/Math/SchmittTrigger.h>
+#include <BipedalLocomotion/Math/SchmittTriggerBank.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+using namespace BipedalLocomotion::Math;
+using namespace std::chrono_literals;
+
+TEST_CASE("Schmitt trigger bank - Invalid threshold")
+{
+    std::vector<SchmittTrigger::Params> params(2);
+    params[0].onThreshold = 0.5;
+    params[0].offThreshold = 0.1;
+    params[1].onThreshold = 0.0;
+    params[1].offThreshold = 0.1;
+
+    SchmittTriggerBank bank;
+    REQUIRE_FALSE(bank.initialize(params));
+}
+
+TEST_CASE("Schmitt trigger bank - Parameter handler")
+{
+    auto paramHandler = std::make_shared<BipedalLocomotion::ParametersHandler::StdImplementation>();
+    paramHandler->setParameter("on_thresholds", std::vector<double>{0.5, 0.4});
+    paramHandler->setParameter("off_thresholds", std::vector<double>{0.1, 0.2});
+    paramHandler->setParameter("switch_on_after", std::vector<std::chrono::nanoseconds>{10ms, 20ms});
+    paramHandler->setParameter("switch_off_after",
+                               std::vector<std::chrono::nanoseconds>{10ms, 20ms});
+
+    SchmittTriggerBank bank;
+    REQUIRE(bank.initialize(paramHandler));
+    REQUIRE(bank.numberOfChannels() == 2);
+
+    // the state must be set before the first advance
+    REQUIRE_FALSE(bank.advance());
+    REQUIRE(bank.setState(std::vector<SchmittTriggerState>(2)));
+
+    SchmittTriggerBankInput input;
+    input.time = 0s;
+    input.rawValues = Eigen::Vector2d::Zero();
+    REQUIRE(bank.setInput(input));
+    REQUIRE(bank.advance());
+    REQUIRE(bank.isOutputValid());
+}
+
+TEST_CASE("Schmitt trigger bank - Comparison with the scalar trigger")
+{
+    constexpr std::size_t channels = 8;
+    constexpr unsigned int steps = 5000;
+    constexpr std::chrono::nanoseconds dT = 1ms;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> thresholdDistribution(0.0, 1.0);
+    std::normal_distribution<double> noise(0.0, 0.8);
+
+    std::vector<SchmittTrigger::Params> params(channels);
+    for (std::size_t i = 0; i < channels; i++)
+    {
+        params[i].offThreshold = thresholdDistribution(generator);
+        params[i].onThreshold = params[i].offThreshold + thresholdDistribution(generator);
+        params[i].switchOnAfter = std::chrono::milliseconds(1 + i);
+        params[i].switchOffAfter = std::chrono::milliseconds(3 + i);
+    }
+
+    SchmittTriggerBank bank;
+    REQUIRE(bank.initialize(params));
+
+    std::vector<SchmittTrigger> triggers(channels);
+    const std::vector<SchmittTriggerState> initialStates(channels);
+    REQUIRE(bank.setState(initialStates));
+    for (std::size_t i = 0; i < channels; i++)
+    {
+        REQUIRE(triggers[i].initialize(params[i]));
+        REQUIRE(triggers[i].setState(initialStates[i]));
+    }
+
+    SchmittTriggerBankInput input;
+    input.rawValues.resize(channels);
+
+    std::chrono::nanoseconds time = 0s;
+    for (unsigned int step = 0; step < steps; step++, time += dT)
+    {
+        input.time = time;
+
+        // noisy signal oscillating around the thresholds
+        for (std::size_t i = 0; i < channels; i++)
+        {
+            const double rawValue
+                = 1.0 + noise(generator) + ((step / 500) % 2 == 0 ? 0.5 : -1.5);
+            input.rawValues(i) = rawValue;
+            REQUIRE(triggers[i].setInput({time, rawValue}));
+            REQUIRE(triggers[i].advance());
+        }
+
+        REQUIRE(bank.setInput(input));
+        REQUIRE(bank.advance());
+
+        // the bank must behave exactly as one scalar trigger per channel
+        for (std::size_t i = 0; i < channels; i++)
+        {
+            const auto& scalarState = triggers[i].getState();
+            REQUIRE(bank.channelState(i) == scalarState.state);
+            REQUIRE(bank.switchTime(i) == scalarState.switchTime);
+            REQUIRE(bank.edgeTime(i) == scalarState.edgeTime);
+        }
+    }
+}
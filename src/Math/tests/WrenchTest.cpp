@@ -56,4 +56,38 @@ TEST_CASE("Wrench test")
         REQUIRE(rotatedWrench.force().isApprox(rotation.rotation() * wrench.force()));
         REQUIRE(rotatedWrench.torque().isApprox(rotation.rotation() * wrench.torque()));
     }
+
+    SECTION("Apply transform to a batch of wrenches")
+    {
+        constexpr int samples = 10;
+        const manif::SE3d transform = manif::SE3d::Random();
+        const Eigen::Matrix<double, 6, Eigen::Dynamic> wrenches
+            = Eigen::Matrix<double, 6, Eigen::Dynamic>::Random(6, samples);
+        Eigen::Matrix<double, 6, Eigen::Dynamic> transformedWrenches(6, samples);
+
+        transformWrenches<double>(transform, wrenches, transformedWrenches);
+
+        for (int i = 0; i < samples; i++)
+        {
+            const Wrenchd expected = transform * Wrenchd(wrenches.col(i));
+            REQUIRE(transformedWrenches.col(i).isApprox(expected));
+        }
+    }
+
+    SECTION("Apply rotation to a batch of wrenches")
+    {
+        constexpr int samples = 10;
+        const manif::SO3d rotation = manif::SO3d::Random();
+        const Eigen::Matrix<double, 6, Eigen::Dynamic> wrenches
+            = Eigen::Matrix<double, 6, Eigen::Dynamic>::Random(6, samples);
+        Eigen::Matrix<double, 6, Eigen::Dynamic> rotatedWrenches(6, samples);
+
+        transformWrenches<double>(rotation, wrenches, rotatedWrenches);
+
+        for (int i = 0; i < samples; i++)
+        {
+            const Wrenchd expected = rotation * Wrenchd(wrenches.col(i));
+            REQUIRE(rotatedWrenches.col(i).isApprox(expected));
+        }
+    }
 }
@@ -58,6 +58,13 @@ class TomlImplementation : public IParametersHandler
      */
     std::shared_ptr<TomlImplementation> clonePrivate() const;
 
+    /**
+     * Build the fully-resolved table of the handler, i.e. the parameters stored in the main
+     * container plus the groups nested back as tables.
+     * @return the resolved table.
+     */
+    toml::table toTomlTable() const;
+
 public:
     /**
      * Constructor.
@@ -84,6 +91,20 @@ public:
      */
     bool setFromFile(const std::string& filename);
 
+    /**
+     * Set the handler from a file, using a compiled-config cache to speed up the process restart.
+     * If the cache snapshot exists and its stored modification time matches the one of the
+     * configuration file, the fully-resolved parameter tree is loaded from the snapshot with a
+     * single sequential read, skipping the parsing of the configuration tree. Otherwise the
+     * configuration file is parsed as in setFromFile() and the snapshot is (re)written.
+     * @param filename the name of the file that should be loaded.
+     * @param cacheFilename the name of the snapshot file. The file is created if it does not
+     * exist. A failure in writing the snapshot is not fatal: the handler is loaded anyhow and the
+     * cache is rebuilt at the next restart.
+     * @return true/false in case of success/failure.
+     */
+    bool setFromFileWithCache(const std::string& filename, const std::string& cacheFilename);
+
     /**
      * Get a parameter [int]
      * @param parameterName name of the parameter
@@ -6,7 +6,12 @@
  */
 
 #include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
 #include <string>
+#include <system_error>
 
 #include <BipedalLocomotion/ParametersHandler/TomlImplementation.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
@@ -207,6 +212,83 @@ bool TomlImplementation::setFromFile(const std::string& filename)
     return true;
 }
 
+bool TomlImplementation::setFromFileWithCache(const std::string& filename,
+                                              const std::string& cacheFilename)
+{
+    constexpr auto logPrefix = "[TomlImplementation::setFromFileWithCache]";
+
+    // the first line of the snapshot stores the modification time of the configuration file used
+    // to validate the cache
+    constexpr auto cacheHeaderTag = "# blf-toml-cache mtime=";
+
+    std::error_code errorCode;
+    const auto sourceWriteTime = std::filesystem::last_write_time(filename, errorCode);
+    if (errorCode)
+    {
+        // the modification time cannot be retrieved so the cache cannot be validated
+        return this->setFromFile(filename);
+    }
+    const std::int64_t sourceMtime = sourceWriteTime.time_since_epoch().count();
+
+    // try to load the snapshot
+    std::ifstream cacheFile(cacheFilename);
+    if (cacheFile.is_open())
+    {
+        std::string header;
+        std::getline(cacheFile, header);
+        if (header == cacheHeaderTag + std::to_string(sourceMtime))
+        {
+            // the snapshot is valid: load the fully-resolved tree with a single sequential read
+            std::ostringstream content;
+            content << cacheFile.rdbuf();
+#if TOML_EXCEPTIONS
+            try
+            {
+                this->set(toml::parse(content.str()));
+                return true;
+            } catch (const std::exception& e)
+            {
+                log()->warn("{} Unable to parse the snapshot named {}. The configuration file "
+                            "will be parsed. The following exception has been thrown {}.",
+                            logPrefix,
+                            cacheFilename,
+                            e.what());
+            }
+#else
+            auto config = toml::parse(content.str());
+            if (config)
+            {
+                this->set(config);
+                return true;
+            }
+            log()->warn("{} Unable to parse the snapshot named {}. The configuration file will "
+                        "be parsed.",
+                        logPrefix,
+                        cacheFilename);
+#endif
+        }
+    }
+
+    // cache miss: parse the configuration file and (re)write the snapshot
+    if (!this->setFromFile(filename))
+    {
+        return false;
+    }
+
+    std::ofstream snapshot(cacheFilename, std::ios::trunc);
+    if (!snapshot.is_open())
+    {
+        log()->warn("{} Unable to write the snapshot named {}. The cache will be rebuilt at the "
+                    "next restart.",
+                    logPrefix,
+                    cacheFilename);
+        return true;
+    }
+
+    snapshot << cacheHeaderTag << sourceMtime << std::endl << this->toTomlTable() << std::endl;
+    return true;
+}
+
 TomlImplementation::weak_ptr TomlImplementation::getGroup(const std::string& name) const
 {
     if (m_lists.find(name) != m_lists.end())
@@ -255,6 +337,16 @@ void TomlImplementation::clear()
     m_lists.clear();
 }
 
+toml::table TomlImplementation::toTomlTable() const
+{
+    toml::table table = m_container;
+    for (const auto& [key, group] : m_lists)
+    {
+        table.insert_or_assign(key, group->toTomlTable());
+    }
+    return table;
+}
+
 std::shared_ptr<TomlImplementation> TomlImplementation::clonePrivate() const
 {
     auto handler = std::make_shared<TomlImplementation>();
@@ -33,9 +33,14 @@ class YarpImplementation : public IParametersHandler
 {
 
     yarp::os::Bottle m_container; /**< Bottle object */
-    std::unordered_map<std::string, std::shared_ptr<YarpImplementation>> m_lists; /**< Map containing
-                                                                                     pointers to the
-                                                                                     (asked) groups */
+
+    /** Map containing pointers to the materialized groups. The map is mutable since the groups
+     * are materialized lazily on the first access */
+    mutable std::unordered_map<std::string, std::shared_ptr<YarpImplementation>> m_lists;
+
+    /** Raw content of the groups that have not been asked yet. A group is moved from this map to
+     * m_lists on the first access */
+    mutable std::unordered_map<std::string, yarp::os::Bottle> m_groupSources;
 
     /**
      * Private implementation of getParameter
@@ -62,6 +67,22 @@ class YarpImplementation : public IParametersHandler
      */
     std::shared_ptr<YarpImplementation> clonePrivate() const;
 
+    /**
+     * Set the handler from a bottle. The top level of the bottle is visited once: the scalar
+     * entries are stored in the main container while the raw content of the sub-groups is kept
+     * aside and materialized lazily on the first access, avoiding the recursive construction (and
+     * the related string round-trips) of handlers for groups that are never asked.
+     * @param bottle the bottle that should be loaded.
+     */
+    void setFromBottle(const yarp::os::Bottle& bottle);
+
+    /**
+     * Find a group given its name, materializing it from the raw content if required.
+     * @param name name of the group.
+     * @return a pointer to the group, nullptr if the group does not exist.
+     */
+    std::shared_ptr<YarpImplementation> findList(const std::string& name) const;
+
 
     /**
      * Convert a formatted string into a std::chrono::nanoseconds.
@@ -21,10 +21,10 @@ namespace ParametersHandler
 template <typename T>
 bool YarpImplementation::getParameterPrivate(const std::string& parameterName, T& parameter) const
 {
-    if (m_lists.find(parameterName) != m_lists.end()) // A list is called with the same name of the
-                                                      // parameter we are searching
+    // A list is called with the same name of the parameter we are searching
+    if (auto list = this->findList(parameterName); list != nullptr)
     {
-        return m_lists.at(parameterName)->getParameter(parameterName, parameter);
+        return list->getParameter(parameterName, parameter);
     } else
     {
         // a scalar element and a strings is retrieved using getElementFromSearchable() function
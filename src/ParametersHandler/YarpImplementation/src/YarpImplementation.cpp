@@ -343,18 +343,24 @@ void YarpImplementation::set(const yarp::os::Searchable& searchable)
     yarp::os::Bottle bot;
     bot.fromString(searchable.toString());
 
-    for (size_t i = 0; i < bot.size(); i++) // all sublists are included in a new object
+    this->setFromBottle(bot);
+}
+
+void YarpImplementation::setFromBottle(const yarp::os::Bottle& bottle)
+{
+    for (size_t i = 0; i < bottle.size(); i++) // all sublists are included in a new object
     {
-        yarp::os::Value& bb = bot.get(i);
+        const yarp::os::Value& bb = bottle.get(i);
 
-        yarp::os::Bottle* sub = bb.asList();
+        const yarp::os::Bottle* sub = bb.asList();
         if ((sub) && (sub->size() > 1))
         {
             std::string name = sub->get(0).toString();
-            yarp::os::Bottle* subSub = sub->get(1).asList();
+            const yarp::os::Bottle* subSub = sub->get(1).asList();
             if ((subSub) && (subSub->size() > 1))
             {
-                m_lists.emplace(name, std::make_shared<YarpImplementation>(*sub));
+                // the raw content of the group is kept aside and materialized on the first access
+                m_groupSources.emplace(std::move(name), *sub);
             } else
             {
                 m_container.add(bb);
@@ -367,6 +373,30 @@ void YarpImplementation::set(const yarp::os::Searchable& searchable)
     }
 }
 
+std::shared_ptr<YarpImplementation> YarpImplementation::findList(const std::string& name) const
+{
+    auto list = m_lists.find(name);
+    if (list != m_lists.end())
+    {
+        return list->second;
+    }
+
+    auto source = m_groupSources.find(name);
+    if (source == m_groupSources.end())
+    {
+        return nullptr;
+    }
+
+    // materialize the group on the first access. Only the top level of the group is visited, the
+    // sub-groups are in turn materialized lazily
+    auto group = std::make_shared<YarpImplementation>();
+    group->setFromBottle(source->second);
+    m_lists.emplace(name, group);
+    m_groupSources.erase(source);
+
+    return group;
+}
+
 bool YarpImplementation::setFromFile(const std::string& filename)
 {
     // load the configuration file
@@ -388,9 +418,10 @@ bool YarpImplementation::setFromFile(const std::string& filename)
 
 YarpImplementation::weak_ptr YarpImplementation::getGroup(const std::string& name) const
 {
-    if (m_lists.find(name) != m_lists.end())
+    auto group = this->findList(name);
+    if (group != nullptr)
     {
-        return m_lists.at(name);
+        return group;
     }
 
     return std::make_shared<YarpImplementation>();
@@ -426,6 +457,10 @@ std::string YarpImplementation::toString() const
     {
         output += " (" + group.second->toString() + ")";
     }
+    for (auto& group : m_groupSources)
+    {
+        output += " (" + group.second.toString() + ")";
+    }
     return output;
 }
 
@@ -436,13 +471,14 @@ bool YarpImplementation::isEmpty() const
     // This is the case for newly created groups, where the container has only the name of the group
     // itself.
     return ((m_container.size() == 0 || (m_container.size() == 1 && m_container.get(0).isString()))
-            && (m_lists.size() == 0));
+            && (m_lists.size() == 0) && (m_groupSources.size() == 0));
 }
 
 void YarpImplementation::clear()
 {
     m_container.clear();
     m_lists.clear();
+    m_groupSources.clear();
 }
 
 std::shared_ptr<YarpImplementation> YarpImplementation::clonePrivate() const
@@ -455,6 +491,9 @@ std::shared_ptr<YarpImplementation> YarpImplementation::clonePrivate() const
     for (const auto& [key, value] : m_lists)
         handler->m_lists[key] = value->clonePrivate();
 
+    // the groups that have not been materialized yet are cloned from the raw content
+    handler->m_groupSources = this->m_groupSources;
+
     return handler;
 }
 
@@ -0,0 +1,190 @@
+/**
+ * @file ParametersSchema.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_PARAMETERS_HANDLER_PARAMETERS_SCHEMA_H
+#define BIPEDAL_LOCOMOTION_PARAMETERS_HANDLER_PARAMETERS_SCHEMA_H
+
+#include <memory>
+#include <string>
+
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace BipedalLocomotion
+{
+namespace ParametersHandler
+{
+
+/**
+ * Descriptor of a mandatory parameter. If the parameter is missing the extraction fails.
+ * @note The descriptor stores a reference to the destination: it must not outlive the variable it
+ * refers to.
+ */
+template <typename T> struct RequiredParameter
+{
+    const char* name; /**< Name of the parameter */
+    T& destination; /**< Variable filled by extractParameters() */
+
+    constexpr RequiredParameter(const char* name, T& destination)
+        : name(name)
+        , destination(destination)
+    {
+    }
+};
+
+/**
+ * Descriptor of an optional parameter. If the parameter is missing the destination keeps its
+ * current content, i.e. the default value.
+ * @note The descriptor stores a reference to the destination: it must not outlive the variable it
+ * refers to.
+ */
+template <typename T> struct OptionalParameter
+{
+    const char* name; /**< Name of the parameter */
+    T& destination; /**< Variable filled by extractParameters(). It must be initialized with the
+                       default value */
+
+    constexpr OptionalParameter(const char* name, T& destination)
+        : name(name)
+        , destination(destination)
+    {
+    }
+};
+
+namespace detail
+{
+
+template <typename T>
+void extractParameter(const IParametersHandler& handler,
+                      const char* logPrefix,
+                      const RequiredParameter<T>& parameter,
+                      bool& ok)
+{
+    if (!handler.getParameter(parameter.name, parameter.destination))
+    {
+        log()->error("{} Unable to find the parameter named '{}'.", logPrefix, parameter.name);
+        ok = false;
+    }
+}
+
+template <typename T>
+void extractParameter(const IParametersHandler& handler,
+                      const char* logPrefix,
+                      const OptionalParameter<T>& parameter,
+                      bool& ok)
+{
+    if (!handler.getParameter(parameter.name, parameter.destination))
+    {
+        log()->info("{} The parameter '{}' is not found. The default value will be used.",
+                    logPrefix,
+                    parameter.name);
+    }
+}
+
+} // namespace detail
+
+/**
+ * Extract a set of parameters from the handler in a single pass. The schema of the class is
+ * declared once as a list of RequiredParameter and OptionalParameter descriptors and validated
+ * together: the handler is locked once, every parameter is visited exactly once and all the
+ * missing mandatory parameters are reported in the same call, instead of interleaving hand-written
+ * getParameter() calls and error logging in every initialize().
+ * \code{.cpp}
+ * bool Foo::initialize(std::weak_ptr<const IParametersHandler> handler)
+ * {
+ *     using namespace BipedalLocomotion::ParametersHandler;
+ *     return extractParameters(handler,
+ *                              "[Foo::initialize]",
+ *                              RequiredParameter("sampling_time", m_dT),
+ *                              RequiredParameter("name", m_name),
+ *                              OptionalParameter("verbosity", m_verbosity));
+ * }
+ * \endcode
+ * @param handler pointer to a parameter handler.
+ * @param logPrefix prefix used by the log messages, e.g. `[Foo::initialize]`.
+ * @param parameters list of RequiredParameter and OptionalParameter descriptors.
+ * @return true if the handler is valid and all the mandatory parameters have been found, false
+ * otherwise.
+ */
+template <typename... Parameters>
+bool extractParameters(std::weak_ptr<const IParametersHandler> handler,
+                       const char* logPrefix,
+                       Parameters&&... parameters)
+{
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} The parameters handler is not valid.", logPrefix);
+        return false;
+    }
+
+    bool ok = true;
+    (detail::extractParameter(*ptr, logPrefix, parameters, ok), ...);
+    return ok;
+}
+
+/**
+ * ParameterHandle memoizes a parameter that is re-read at runtime (e.g. the weights of
+ * MultiStateWeightProvider). The handle caches the last value successfully read from the handler:
+ * value() never touches the handler and refresh() performs the string-keyed lookup only when the
+ * caller decides that the parameter may have changed, keeping the lookup out of the control loop.
+ */
+template <typename T> class ParameterHandle
+{
+public:
+    ParameterHandle() = default;
+
+    /**
+     * Construct the handle.
+     * @param handler pointer to a parameter handler.
+     * @param name name of the parameter.
+     * @param defaultValue value returned by value() until the first successful refresh().
+     */
+    ParameterHandle(std::weak_ptr<const IParametersHandler> handler,
+                    const std::string& name,
+                    const T& defaultValue = T{})
+        : m_handler(handler)
+        , m_name(name)
+        , m_value(defaultValue)
+    {
+    }
+
+    /**
+     * Re-read the parameter from the handler. If the handler is not valid or the parameter is
+     * missing, the cached value is kept.
+     * @return true if the cached value has been updated, false otherwise.
+     */
+    bool refresh()
+    {
+        auto ptr = m_handler.lock();
+        if (ptr == nullptr)
+        {
+            return false;
+        }
+
+        return ptr->getParameter(m_name, m_value);
+    }
+
+    /**
+     * Get the cached value. The handler is not accessed.
+     * @return a const reference to the cached value.
+     */
+    const T& value() const
+    {
+        return m_value;
+    }
+
+private:
+    std::weak_ptr<const IParametersHandler> m_handler; /**< Handler the parameter belongs to */
+    std::string m_name; /**< Name of the parameter */
+    T m_value{}; /**< Cached value */
+};
+
+} // namespace ParametersHandler
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_PARAMETERS_HANDLER_PARAMETERS_SCHEMA_H
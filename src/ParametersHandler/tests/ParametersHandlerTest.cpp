@@ -17,6 +17,7 @@
 #include <BipedalLocomotion/GenericContainer/TemplateHelpers.h>
 #include <BipedalLocomotion/GenericContainer/Vector.h>
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/ParametersHandler/ParametersSchema.h>
 #include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
 
 using namespace BipedalLocomotion::ParametersHandler;
@@ -147,3 +148,66 @@ TEST_CASE("Get parameters")
         }
     }
 }
+
+TEST_CASE("Parameters schema")
+{
+    std::shared_ptr<StdImplementation> parameterHandler = std::make_shared<StdImplementation>();
+
+    parameterHandler->setParameter("answer_to_the_ultimate_question_of_life", 42);
+    parameterHandler->setParameter("pi", 3.14);
+    parameterHandler->setParameter("Fibonacci Numbers", std::vector<int>{1, 1, 2, 3, 5, 8, 13, 21});
+
+    SECTION("Bulk extraction")
+    {
+        int answer{0};
+        double pi{0};
+        std::vector<int> fibonacci;
+        std::string name = "default";
+
+        REQUIRE(extractParameters(parameterHandler,
+                                  "[Parameters schema]",
+                                  RequiredParameter("answer_to_the_ultimate_question_of_life",
+                                                    answer),
+                                  RequiredParameter("pi", pi),
+                                  RequiredParameter("Fibonacci Numbers", fibonacci),
+                                  OptionalParameter("name", name)));
+
+        REQUIRE(answer == 42);
+        REQUIRE(pi == 3.14);
+        REQUIRE(fibonacci == std::vector<int>{1, 1, 2, 3, 5, 8, 13, 21});
+
+        // the optional parameter is missing so the default value is kept
+        REQUIRE(name == "default");
+    }
+
+    SECTION("Missing mandatory parameter")
+    {
+        int answer{0};
+        double missing{0};
+
+        REQUIRE_FALSE(extractParameters(parameterHandler,
+                                        "[Parameters schema]",
+                                        RequiredParameter("answer_to_the_ultimate_question_of_life",
+                                                          answer),
+                                        RequiredParameter("missing_parameter", missing)));
+
+        // the parameters found before the failure are extracted anyhow
+        REQUIRE(answer == 42);
+    }
+
+    SECTION("Memoized handle")
+    {
+        ParameterHandle<double> handle(parameterHandler, "pi", 1.0);
+
+        // before the first refresh the default value is returned
+        REQUIRE(handle.value() == 1.0);
+
+        REQUIRE(handle.refresh());
+        REQUIRE(handle.value() == 3.14);
+
+        // the cached value is kept if the parameter disappears
+        parameterHandler->clear();
+        REQUIRE_FALSE(handle.refresh());
+        REQUIRE(handle.value() == 3.14);
+    }
+}
@@ -7,6 +7,8 @@
 
 // std
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 
 // Catch2
@@ -180,3 +182,56 @@ TEST_CASE("Get parameters")
         REQUIRE(parameterHandler->isEmpty());
     }
 }
+
+TEST_CASE("Set from file with cache")
+{
+    namespace fs = std::filesystem;
+
+    const fs::path configFile = fs::temp_directory_path() / "blf_toml_cache_test.toml";
+    const fs::path cacheFile = fs::temp_directory_path() / "blf_toml_cache_test.cache";
+    fs::remove(cacheFile);
+
+    {
+        std::ofstream file(configFile.string());
+        file << "answer_to_the_ultimate_question_of_life = 42" << std::endl
+             << "[group]" << std::endl
+             << "pi = 3.14" << std::endl;
+    }
+
+    // the first load parses the configuration file and writes the snapshot
+    auto parameterHandler = std::make_shared<TomlImplementation>();
+    REQUIRE(parameterHandler->setFromFileWithCache(configFile.string(), cacheFile.string()));
+    REQUIRE(fs::exists(cacheFile));
+
+    int element;
+    REQUIRE(parameterHandler->getParameter("answer_to_the_ultimate_question_of_life", element));
+    REQUIRE(element == 42);
+
+    // the second load resolves the parameters from the snapshot
+    auto cachedHandler = std::make_shared<TomlImplementation>();
+    REQUIRE(cachedHandler->setFromFileWithCache(configFile.string(), cacheFile.string()));
+    REQUIRE(cachedHandler->getParameter("answer_to_the_ultimate_question_of_life", element));
+    REQUIRE(element == 42);
+
+    double pi;
+    auto group = cachedHandler->getGroup("group").lock();
+    REQUIRE(group != nullptr);
+    REQUIRE(group->getParameter("pi", pi));
+    REQUIRE(pi == 3.14);
+
+    // editing the configuration file invalidates the snapshot
+    {
+        std::ofstream file(configFile.string());
+        file << "answer_to_the_ultimate_question_of_life = 24" << std::endl;
+    }
+    fs::last_write_time(configFile, fs::last_write_time(configFile) + std::chrono::seconds(1));
+
+    auto invalidatedHandler = std::make_shared<TomlImplementation>();
+    REQUIRE(invalidatedHandler->setFromFileWithCache(configFile.string(), cacheFile.string()));
+    REQUIRE(
+        invalidatedHandler->getParameter("answer_to_the_ultimate_question_of_life", element));
+    REQUIRE(element == 24);
+
+    fs::remove(configFile);
+    fs::remove(cacheFile);
+}
@@ -32,6 +32,8 @@ namespace Capture {
 *  |       `stream_ir`       |     `boolean`     |      flag to enable streaming IR images       |     No    |     false     |
 *  |       `stream_pcl`      |     `boolean`     |      flag to enable streaming pointcloud      |     No    |     false     |
 *  | `align_frames_to_color` |     `boolean`     |    flag to align other images to BGR images   |     No    |     false     |
+*  |   `use_async_capture`   |     `boolean`     | capture the frames through the librealsense callback API into a bounded queue, decoupling the acquisition from the consumer |     No    |     false     |
+*  |  `frame_queue_capacity` |       `int`       | capacity of the frame queue used by the asynchronous capture. Older framesets are dropped when the queue is full |     No    |       2       |
 */
 
 class RealSense : public BipedalLocomotion::RobotInterface::ICameraBridge,
@@ -78,6 +78,15 @@ public:
      * - "marker_length" marker length in m
      * - "camera_matrix" 9d vector representing the camera calbration matrix in row major order
      * - "distortion_coefficients" 5d vector containing camera distortion coefficients
+     * @note The following parameters are optional:
+     * - "use_tracked_roi" restrict the detection to a region of interest around the markers found
+     * in the previous frame, with a periodic full-frame rescan (default false)
+     * - "roi_margin" margin added around the tracked markers bounding box, as a fraction of its
+     * size (default 0.5)
+     * - "full_rescan_period" number of frames after which a full-frame detection is forced when
+     * the tracked region of interest is used (default 30)
+     * - "use_opencl" run the detection through the OpenCV transparent API (cv::UMat), dispatching
+     * it to the OpenCL device when one is available (default false)
      * @param[in] handlerWeak weak pointer to a ParametersHandler::IParametersHandler interface
      * @tparameter Derived particular implementation of the IParameterHandler
      * @return True in case of success, false otherwise.
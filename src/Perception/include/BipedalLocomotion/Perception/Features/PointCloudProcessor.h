@@ -11,12 +11,22 @@
 
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
+#include <pcl/features/normal_3d_omp.h>
 #include <pcl/filters/voxel_grid.h>
 #include <pcl/filters/statistical_outlier_removal.h>
 #include <pcl/kdtree/kdtree.h>
 #include <pcl/segmentation/extract_clusters.h>
 #include <pcl/common/transforms.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 namespace BipedalLocomotion {
 
 namespace Perception {
@@ -33,6 +43,10 @@ struct PCLProcessorParameters
     double spatialClusterTolerance{0.02}; /**< spatial distance in meters to consider the Euclidean clustering of points (L2 euclidean norm) */
     int minNrPointsInCluster{10}; /**< minimum number of points required to detect a cluster */
     int maxNrPointsInCluster{1000};  /**< maximum number of points allowed in a detected cluster */
+
+    int nrThreads{0}; /**< number of threads used by the parallel kernels. A non-positive value uses all the available cores */
+    double normalEstimationRadius{0.03}; /**< neighborhood search radius in meters used for the surface normal estimation */
+    std::vector<std::string> pipelineStages{"parallel_downsample"}; /**< ordered list of stages run by process(). Available stages: "downsample", "parallel_downsample", "remove_outliers" */
 };
 
 /**
@@ -42,6 +56,8 @@ struct PCLProcessorParameters
  * - Remove outliers
  * - Extract spatial clusters of point cloud
  * - Transform a point cloud
+ * - Estimate surface normals
+ * - Run a configurable pipeline of stages reusing preallocated clouds
  */
 template <class PointType>
 class PointCloudProcessor
@@ -90,16 +106,59 @@ public:
                    const Eigen::Affine3f& transform,
                    typename pcl::PointCloud<PointType>::Ptr outCloud);
 
+    /**
+     * Downsample the point cloud using a multi-threaded voxel grid filter.
+     * The input cloud is split across the configured number of threads ("nr_threads"),
+     * each thread accumulates the per-voxel centroids of its chunk and the partial
+     * results are then merged. The voxel accumulators are kept as members so that
+     * no memory is allocated when the method is called at every frame.
+     * Non-finite points are skipped. The fields of the output points other than the
+     * coordinates are copied from the first point falling in each voxel.
+     */
+    bool parallelDownsample(const typename pcl::PointCloud<PointType>::Ptr inCloud,
+                            typename pcl::PointCloud<PointType>::Ptr outCloud);
+
+    /**
+     * Estimate the surface normals of the point cloud using the OpenMP
+     * accelerated PCL normal estimation ("nr_threads" threads)
+     * See https://pointclouds.org/documentation/classpcl_1_1_normal_estimation_o_m_p.html
+     */
+    bool estimateNormals(const typename pcl::PointCloud<PointType>::Ptr inCloud,
+                         pcl::PointCloud<pcl::Normal>& normals);
+
+    /**
+     * Run the stages configured through the "pipeline_stages" parameter in order.
+     * The intermediate clouds are preallocated at initialization and reused
+     * across the calls, so no point cloud is allocated at runtime.
+     */
+    bool process(const typename pcl::PointCloud<PointType>::Ptr inCloud,
+                 typename pcl::PointCloud<PointType>::Ptr outCloud);
 
 private:
     bool checkInitialization();
     void updateInternalParameters();
+    unsigned int resolveNrThreads() const;
+    static std::int64_t voxelKey(const int ix, const int iy, const int iz);
+
+    /**
+     * Per-voxel running sum of the point coordinates together with the index of
+     * the first point falling into the voxel
+     */
+    struct VoxelAccumulator
+    {
+        Eigen::Vector3f sum{Eigen::Vector3f::Zero()};
+        std::size_t count{0};
+        std::size_t firstPointIndex{0};
+    };
 
     bool m_initialized{false};
     pcl::VoxelGrid<PointType> m_voxelGridFilter;
     pcl::StatisticalOutlierRemoval<PointType> m_outlierRemover;
     typename pcl::search::KdTree<PointType>::Ptr m_kdTree;
     pcl::EuclideanClusterExtraction<PointType> m_clusterExtractor;
+    pcl::NormalEstimationOMP<PointType, pcl::Normal> m_normalEstimator;
+    std::vector<std::unordered_map<std::int64_t, VoxelAccumulator>> m_voxelMaps; /**< one accumulator map per thread, reused across the frames */
+    std::array<typename pcl::PointCloud<PointType>::Ptr, 2> m_pipelineBuffers; /**< intermediate clouds of process(), allocated once at initialization */
     PCLProcessorParameters m_params;
 };
 
@@ -154,7 +213,40 @@ bool PointCloudProcessor<PointType>::initialize(std::weak_ptr<BipedalLocomotion:
                     "Using default name \"1000\".", logPrefix);
     }
 
+    if (!ptr->getParameter("nr_threads", m_params.nrThreads))
+    {
+        log()->warn("{} Parameter \"nr_threads\" not available in the configuration."
+                    "Using default name \"0\" (all the available cores).", logPrefix);
+    }
+
+    if (!ptr->getParameter("normal_estimation_radius", m_params.normalEstimationRadius))
+    {
+        log()->warn("{} Parameter \"normal_estimation_radius\" not available in the configuration."
+                    "Using default name \"0.03\".", logPrefix);
+    }
+
+    if (!ptr->getParameter("pipeline_stages", m_params.pipelineStages))
+    {
+        log()->warn("{} Parameter \"pipeline_stages\" not available in the configuration."
+                    "Using default name \"(parallel_downsample)\".", logPrefix);
+    }
+
+    for (const auto& stage : m_params.pipelineStages)
+    {
+        if (stage != "downsample" && stage != "parallel_downsample" && stage != "remove_outliers")
+        {
+            log()->error("{} Unknown pipeline stage \"{}\"."
+                         " Available stages are \"downsample\", \"parallel_downsample\""
+                         " and \"remove_outliers\".", logPrefix, stage);
+            return false;
+        }
+    }
+
     m_kdTree = pcl::make_shared< pcl::search::KdTree<PointType> >();
+    for (auto& buffer : m_pipelineBuffers)
+    {
+        buffer = pcl::make_shared<pcl::PointCloud<PointType>>();
+    }
     updateInternalParameters();
     m_initialized = true;
     return true;
@@ -174,6 +266,32 @@ void PointCloudProcessor<PointType>::updateInternalParameters()
     m_clusterExtractor.setClusterTolerance(m_params.spatialClusterTolerance);
     m_clusterExtractor.setMinClusterSize(m_params.minNrPointsInCluster);
     m_clusterExtractor.setMaxClusterSize(m_params.maxNrPointsInCluster);
+
+    // NormalEstimationOMP interprets 0 threads as automatic
+    m_normalEstimator.setNumberOfThreads(m_params.nrThreads > 0 ? m_params.nrThreads : 0);
+    m_normalEstimator.setRadiusSearch(m_params.normalEstimationRadius);
+}
+
+template <class PointType>
+unsigned int PointCloudProcessor<PointType>::resolveNrThreads() const
+{
+    if (m_params.nrThreads > 0)
+    {
+        return static_cast<unsigned int>(m_params.nrThreads);
+    }
+
+    const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 0 ? hardwareThreads : 1;
+}
+
+template <class PointType>
+std::int64_t PointCloudProcessor<PointType>::voxelKey(const int ix, const int iy, const int iz)
+{
+    // pack the voxel coordinates in a single 64 bit key (21 bits per axis)
+    constexpr std::int64_t offset = 1 << 20;
+    return ((static_cast<std::int64_t>(ix) + offset) << 42)
+           | ((static_cast<std::int64_t>(iy) + offset) << 21)
+           | (static_cast<std::int64_t>(iz) + offset);
 }
 
 template <class PointType>
@@ -355,6 +473,200 @@ bool PointCloudProcessor<PointType>::transform(const typename pcl::PointCloud<Po
     return true;
 }
 
+template <class PointType>
+bool PointCloudProcessor<PointType>::parallelDownsample(const typename pcl::PointCloud<PointType>::Ptr inCloud,
+                                                        typename pcl::PointCloud<PointType>::Ptr outCloud)
+{
+    if (!checkInitialization())
+    {
+        return false;
+    }
+
+    if (inCloud == nullptr || outCloud == nullptr)
+    {
+        log()->error("[PointCloudProcessor::parallelDownsample] Invalid pointer");
+        return false;
+    }
+
+    if (m_params.voxelSizeDownsampling[0] <= 0.0
+        || m_params.voxelSizeDownsampling[1] <= 0.0
+        || m_params.voxelSizeDownsampling[2] <= 0.0)
+    {
+        log()->error("[PointCloudProcessor::parallelDownsample] "
+                     "The voxel size must be strictly positive.");
+        return false;
+    }
+
+    const float invLeafX = static_cast<float>(1.0 / m_params.voxelSizeDownsampling[0]);
+    const float invLeafY = static_cast<float>(1.0 / m_params.voxelSizeDownsampling[1]);
+    const float invLeafZ = static_cast<float>(1.0 / m_params.voxelSizeDownsampling[2]);
+
+    const std::size_t nrPoints = inCloud->size();
+    const unsigned int nrThreads
+        = static_cast<unsigned int>(std::min<std::size_t>(resolveNrThreads(),
+                                                          std::max<std::size_t>(nrPoints, 1)));
+
+    // the per-thread maps are members to keep their buckets allocated across the frames
+    m_voxelMaps.resize(nrThreads);
+    for (auto& map : m_voxelMaps)
+    {
+        map.clear();
+    }
+
+    auto accumulateChunk = [this, &inCloud, invLeafX, invLeafY, invLeafZ](
+                               const std::size_t threadIdx,
+                               const std::size_t begin,
+                               const std::size_t end) {
+        auto& map = m_voxelMaps[threadIdx];
+        for (std::size_t idx = begin; idx < end; idx++)
+        {
+            const auto& point = (*inCloud)[idx];
+            if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z))
+            {
+                continue;
+            }
+
+            const int ix = static_cast<int>(std::floor(point.x * invLeafX));
+            const int iy = static_cast<int>(std::floor(point.y * invLeafY));
+            const int iz = static_cast<int>(std::floor(point.z * invLeafZ));
+
+            auto& accumulator = map[voxelKey(ix, iy, iz)];
+            if (accumulator.count == 0)
+            {
+                accumulator.firstPointIndex = idx;
+            }
+            accumulator.sum += Eigen::Vector3f(point.x, point.y, point.z);
+            accumulator.count++;
+        }
+    };
+
+    const std::size_t chunkSize = (nrPoints + nrThreads - 1) / nrThreads;
+    std::vector<std::thread> workers;
+    workers.reserve(nrThreads - 1);
+    for (unsigned int threadIdx = 1; threadIdx < nrThreads; threadIdx++)
+    {
+        const std::size_t begin = std::min<std::size_t>(threadIdx * chunkSize, nrPoints);
+        const std::size_t end = std::min<std::size_t>(begin + chunkSize, nrPoints);
+        workers.emplace_back(accumulateChunk, threadIdx, begin, end);
+    }
+    accumulateChunk(0, 0, std::min<std::size_t>(chunkSize, nrPoints));
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    // merge the partial accumulators into the first map
+    auto& mergedMap = m_voxelMaps.front();
+    for (std::size_t threadIdx = 1; threadIdx < m_voxelMaps.size(); threadIdx++)
+    {
+        for (const auto& [key, accumulator] : m_voxelMaps[threadIdx])
+        {
+            auto& merged = mergedMap[key];
+            if (merged.count == 0)
+            {
+                merged.firstPointIndex = accumulator.firstPointIndex;
+            }
+            merged.sum += accumulator.sum;
+            merged.count += accumulator.count;
+        }
+    }
+
+    outCloud->resize(mergedMap.size());
+    std::size_t outIdx = 0;
+    for (const auto& [key, accumulator] : mergedMap)
+    {
+        auto& point = (*outCloud)[outIdx];
+        point = (*inCloud)[accumulator.firstPointIndex];
+        const Eigen::Vector3f centroid = accumulator.sum / static_cast<float>(accumulator.count);
+        point.x = centroid(0);
+        point.y = centroid(1);
+        point.z = centroid(2);
+        outIdx++;
+    }
+    outCloud->width = outCloud->size();
+    outCloud->height = 1;
+    outCloud->is_dense = true;
+
+    return true;
+}
+
+template <class PointType>
+bool PointCloudProcessor<PointType>::estimateNormals(const typename pcl::PointCloud<PointType>::Ptr inCloud,
+                                                     pcl::PointCloud<pcl::Normal>& normals)
+{
+    if (!checkInitialization())
+    {
+        return false;
+    }
+
+    if (inCloud == nullptr)
+    {
+        log()->error("[PointCloudProcessor::estimateNormals] Invalid pointer");
+        return false;
+    }
+
+    if (inCloud->empty())
+    {
+        log()->error("[PointCloudProcessor::estimateNormals] Empty input point cloud.");
+        return false;
+    }
+
+    m_kdTree->setInputCloud(inCloud);
+    m_normalEstimator.setSearchMethod(m_kdTree);
+    m_normalEstimator.setInputCloud(inCloud);
+    m_normalEstimator.compute(normals);
+
+    return true;
+}
+
+template <class PointType>
+bool PointCloudProcessor<PointType>::process(const typename pcl::PointCloud<PointType>::Ptr inCloud,
+                                             typename pcl::PointCloud<PointType>::Ptr outCloud)
+{
+    if (!checkInitialization())
+    {
+        return false;
+    }
+
+    if (inCloud == nullptr || outCloud == nullptr)
+    {
+        log()->error("[PointCloudProcessor::process] Invalid pointer");
+        return false;
+    }
+
+    // ping-pong between the two preallocated buffers so that every stage reads the
+    // output of the previous one without allocating a new cloud
+    typename pcl::PointCloud<PointType>::Ptr current = inCloud;
+    for (const auto& stage : m_params.pipelineStages)
+    {
+        auto& next = (current == m_pipelineBuffers[0]) ? m_pipelineBuffers[1] : m_pipelineBuffers[0];
+
+        bool ok{false};
+        if (stage == "downsample")
+        {
+            ok = downsample(current, next);
+        } else if (stage == "parallel_downsample")
+        {
+            ok = parallelDownsample(current, next);
+        } else if (stage == "remove_outliers")
+        {
+            ok = removeOutliers(current, next);
+        }
+
+        if (!ok)
+        {
+            log()->error("[PointCloudProcessor::process] The stage \"{}\" failed.", stage);
+            return false;
+        }
+
+        current = next;
+    }
+
+    *outCloud = *current;
+    return true;
+}
+
 
 } // namespace Features
 } // namespace Perception
@@ -18,6 +18,10 @@ using namespace BipedalLocomotion::Conversions;
 #include <opencv2/aruco.hpp>
 #include <opencv2/calib3d.hpp>
 #include <opencv2/core/eigen.hpp>
+#include <opencv2/core/ocl.hpp>
+
+#include <algorithm>
+#include <limits>
 
 class ArucoDetector::Impl
 {
@@ -47,6 +51,89 @@ public:
 
     bool initialized{false}; /**< flag to check if detector was initialized properly */
 
+    bool useTrackedROI{false}; /**< flag to restrict the detection to a region of interest tracked
+                                  from the previous frame */
+    double roiMargin{0.5}; /**< margin added around the tracked markers bounding box, as a fraction
+                              of its size */
+    int fullRescanPeriod{30}; /**< number of frames after which a full-frame detection is forced */
+    int framesSinceFullScan{0}; /**< frames elapsed since the last full-frame detection */
+    cv::Rect trackedROI; /**< region of interest computed from the previously detected markers */
+
+    bool useOpenCL{false}; /**< flag to run the detection through the OpenCV transparent API */
+    cv::UMat currentUImg; /**< image uploaded to the OpenCL device */
+
+    /**
+     * Run the marker detection on a region of the current image. The detected corners are
+     * reported in full-image coordinates.
+     */
+    void detectMarkersInRegion(const cv::Rect& region)
+    {
+        if (useOpenCL)
+        {
+            // going through cv::UMat dispatches the detection to the OpenCL device when one is
+            // available (OpenCV transparent API)
+            currentImg(region).copyTo(currentUImg);
+            cv::aruco::detectMarkers(currentUImg,
+                                     dictionary,
+                                     currentDetectedMarkerCorners,
+                                     currentDetectedMarkerIds);
+        } else
+        {
+            cv::aruco::detectMarkers(currentImg(region),
+                                     dictionary,
+                                     currentDetectedMarkerCorners,
+                                     currentDetectedMarkerIds);
+        }
+
+        if (region.x != 0 || region.y != 0)
+        {
+            const cv::Point2f offset(static_cast<float>(region.x), static_cast<float>(region.y));
+            for (auto& corners : currentDetectedMarkerCorners)
+            {
+                for (auto& corner : corners)
+                {
+                    corner += offset;
+                }
+            }
+        }
+    }
+
+    /**
+     * Compute the region of interest around the currently detected markers, enlarged by the
+     * configured margin and clamped to the image size
+     */
+    cv::Rect computeTrackedRegion() const
+    {
+        if (currentDetectedMarkerCorners.empty())
+        {
+            return cv::Rect();
+        }
+
+        float minX = std::numeric_limits<float>::max();
+        float minY = std::numeric_limits<float>::max();
+        float maxX = std::numeric_limits<float>::lowest();
+        float maxY = std::numeric_limits<float>::lowest();
+        for (const auto& corners : currentDetectedMarkerCorners)
+        {
+            for (const auto& corner : corners)
+            {
+                minX = std::min(minX, corner.x);
+                minY = std::min(minY, corner.y);
+                maxX = std::max(maxX, corner.x);
+                maxY = std::max(maxY, corner.y);
+            }
+        }
+
+        const float marginX = (maxX - minX) * static_cast<float>(roiMargin);
+        const float marginY = (maxY - minY) * static_cast<float>(roiMargin);
+        const cv::Rect region(static_cast<int>(minX - marginX),
+                              static_cast<int>(minY - marginY),
+                              static_cast<int>(maxX - minX + 2 * marginX) + 1,
+                              static_cast<int>(maxY - minY + 2 * marginY) + 1);
+
+        return region & cv::Rect(0, 0, currentImg.cols, currentImg.rows);
+    }
+
     cv::Mat R; /**< placeholder rotation matrix as cv Mat object*/
     Eigen::Matrix3d Reig; /**< placeholder rotation matrix as Eigen object*/
     Eigen::Vector3d teig; /**< placeholder translation vector as Eigen object*/
@@ -163,6 +250,56 @@ bool ArucoDetector::initialize(std::weak_ptr<const IParametersHandler> handler)
     m_pimpl->distCoeff = cv::Mat(5, 1, CV_64F);
     cv::eigen2cv(distCoeffVec, m_pimpl->distCoeff);
 
+    if (!handle->getParameter("use_tracked_roi", m_pimpl->useTrackedROI))
+    {
+        log()->info("{} The parameter 'use_tracked_roi' is not found. The default one will be "
+                    "used {}.",
+                    printPrefix,
+                    m_pimpl->useTrackedROI);
+    }
+
+    if (!handle->getParameter("roi_margin", m_pimpl->roiMargin))
+    {
+        log()->info("{} The parameter 'roi_margin' is not found. The default one will be used {}.",
+                    printPrefix,
+                    m_pimpl->roiMargin);
+    }
+
+    if (m_pimpl->roiMargin < 0)
+    {
+        log()->error("{} The parameter 'roi_margin' cannot be negative.", printPrefix);
+        return false;
+    }
+
+    if (!handle->getParameter("full_rescan_period", m_pimpl->fullRescanPeriod))
+    {
+        log()->info("{} The parameter 'full_rescan_period' is not found. The default one will be "
+                    "used {}.",
+                    printPrefix,
+                    m_pimpl->fullRescanPeriod);
+    }
+
+    if (m_pimpl->fullRescanPeriod <= 0)
+    {
+        log()->error("{} The parameter 'full_rescan_period' must be a strictly positive number.",
+                     printPrefix);
+        return false;
+    }
+
+    if (!handle->getParameter("use_opencl", m_pimpl->useOpenCL))
+    {
+        log()->info("{} The parameter 'use_opencl' is not found. The default one will be used {}.",
+                    printPrefix,
+                    m_pimpl->useOpenCL);
+    }
+
+    if (m_pimpl->useOpenCL && !cv::ocl::haveOpenCL())
+    {
+        log()->warn("{} 'use_opencl' is set but no OpenCL device is available. The detection will "
+                    "transparently fall back to the CPU.",
+                    printPrefix);
+    }
+
     m_pimpl->initialized = true;
     return true;
 }
@@ -201,11 +338,23 @@ bool ArucoDetector::advance()
     }
 
     m_pimpl->resetBuffers();
-    std::vector<std::vector<cv::Point2f>> detectedmarkerCorners;
-    cv::aruco::detectMarkers(m_pimpl->currentImg,
-                             m_pimpl->dictionary,
-                             m_pimpl->currentDetectedMarkerCorners,
-                             m_pimpl->currentDetectedMarkerIds);
+
+    const cv::Rect fullFrame(0, 0, m_pimpl->currentImg.cols, m_pimpl->currentImg.rows);
+    const bool trackingActive = m_pimpl->useTrackedROI && !m_pimpl->trackedROI.empty()
+                                && m_pimpl->framesSinceFullScan < m_pimpl->fullRescanPeriod;
+
+    m_pimpl->detectMarkersInRegion(trackingActive ? (m_pimpl->trackedROI & fullFrame) : fullFrame);
+
+    bool fullFrameScanned = !trackingActive;
+    if (trackingActive && m_pimpl->currentDetectedMarkerIds.empty())
+    {
+        // the tracked region lost all the markers: fall back to a full-frame detection
+        m_pimpl->detectMarkersInRegion(fullFrame);
+        fullFrameScanned = true;
+    }
+
+    m_pimpl->framesSinceFullScan = fullFrameScanned ? 0 : m_pimpl->framesSinceFullScan + 1;
+    m_pimpl->trackedROI = m_pimpl->computeTrackedRegion();
 
     if (m_pimpl->currentDetectedMarkerIds.size() > 0)
     {
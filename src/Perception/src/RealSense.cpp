@@ -9,6 +9,7 @@
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 #include <librealsense2/rs.hpp>
+#include <atomic>
 #include <tuple>
 
 using namespace BipedalLocomotion::Perception::Capture;
@@ -19,6 +20,14 @@ struct RealSense::Impl
     bool startStream();
     void stopStream();
 
+    /**
+     * Fetch the latest frameset and run the depth-color alignment on it.
+     * In the synchronous mode the frameset is taken from the pipeline, while in the
+     * asynchronous mode it is taken from the bounded queue filled by the capture
+     * callback, dropping the older framesets still in the queue.
+     */
+    bool grabFrames();
+
     struct TextureRGB
     {
         int r, g, b;
@@ -49,6 +58,11 @@ struct RealSense::Impl
     rs2::config cfg;
     rs2::frameset frames;
 
+    bool useAsyncCapture{false};
+    int frameQueueCapacity{2};
+    std::atomic<int> warmupFramesToDrop{0};
+    rs2::frame_queue framesQueue; /**< bounded queue filled by the librealsense capture callback */
+
     rs2::pointcloud pointcloud;
     rs2::points points;
     rs2::frame colorFrame;
@@ -165,6 +179,27 @@ bool RealSense::initialize(
                     logPrefix);
     }
 
+    if (!ptr->getParameter("use_async_capture", m_pimpl->useAsyncCapture))
+    {
+        log()->warn("{} Parameter \"use_async_capture\" not available in the configuration."
+                    "Frames will be fetched synchronously.",
+                    logPrefix);
+    }
+
+    if (!ptr->getParameter("frame_queue_capacity", m_pimpl->frameQueueCapacity))
+    {
+        log()->warn("{} Parameter \"frame_queue_capacity\" not available in the configuration."
+                    "Using default name \"{}\".",
+                    logPrefix,
+                    m_pimpl->frameQueueCapacity);
+    }
+
+    if (m_pimpl->frameQueueCapacity < 1)
+    {
+        log()->error("{} Parameter \"frame_queue_capacity\" must be at least 1.", logPrefix);
+        return false;
+    }
+
     if (!m_pimpl->startStream())
     {
         return false;
@@ -242,10 +277,9 @@ bool RealSense::getColorImage(const std::string& camName,
               .rgbImgDimensions[m_pimpl->metadata.sensorsList.rgbCamerasList[0]]
               .second;
 
-    m_pimpl->frames = m_pimpl->pipe.wait_for_frames();
-    if (m_pimpl->doAlignToColor && m_pimpl->alignToColor != nullptr)
+    if (!m_pimpl->grabFrames())
     {
-        m_pimpl->frames = m_pimpl->alignToColor->process(m_pimpl->frames);
+        return false;
     }
     m_pimpl->colorFrame = m_pimpl->frames.get_color_frame();
     colorImg = cv::Mat(cv::Size(genericWidth, genericHeight),
@@ -280,10 +314,9 @@ bool RealSense::getDepthImage(const std::string& camName,
               .rgbdImgDimensions[m_pimpl->metadata.sensorsList.rgbdCamerasList[0]]
               .second;
 
-    m_pimpl->frames = m_pimpl->pipe.wait_for_frames();
-    if (m_pimpl->doAlignToColor && m_pimpl->alignToColor != nullptr)
+    if (!m_pimpl->grabFrames())
     {
-        m_pimpl->frames = m_pimpl->alignToColor->process(m_pimpl->frames);
+        return false;
     }
     m_pimpl->depthFrame = m_pimpl->frames.get_depth_frame();
 
@@ -319,10 +352,9 @@ bool RealSense::getColorizedDepthImage(const std::string& camName,
               .rgbdImgDimensions[m_pimpl->metadata.sensorsList.rgbdCamerasList[0]]
               .second;
 
-    m_pimpl->frames = m_pimpl->pipe.wait_for_frames();
-    if (m_pimpl->doAlignToColor && m_pimpl->alignToColor != nullptr)
+    if (!m_pimpl->grabFrames())
     {
-        m_pimpl->frames = m_pimpl->alignToColor->process(m_pimpl->frames);
+        return false;
     }
     m_pimpl->depthFrame = m_pimpl->frames.get_depth_frame().apply_filter(m_pimpl->color_map);
 
@@ -356,10 +388,9 @@ bool RealSense::getInfraredImage(const std::string& camName,
         = m_pimpl->metadata.bridgeOptions.rgbImgDimensions[m_pimpl->metadata.sensorsList.rgbCamerasList[0]]
               .second;
 
-    m_pimpl->frames = m_pimpl->pipe.wait_for_frames();
-    if (m_pimpl->doAlignToColor && m_pimpl->alignToColor != nullptr)
+    if (!m_pimpl->grabFrames())
     {
-        m_pimpl->frames = m_pimpl->alignToColor->process(m_pimpl->frames);
+        return false;
     }
     m_pimpl->irFrame = m_pimpl->frames.get_infrared_frame();
     irImage = cv::Mat(cv::Size(genericWidth, genericHeight),
@@ -392,10 +423,9 @@ bool RealSense::getPointCloud(const std::string& pclDevName,
     }
 
     // Wait for the next set of frames from the camera
-    m_pimpl->frames = m_pimpl->pipe.wait_for_frames();
-    if (m_pimpl->doAlignToColor && m_pimpl->alignToColor != nullptr)
+    if (!m_pimpl->grabFrames())
     {
-        m_pimpl->frames = m_pimpl->alignToColor->process(m_pimpl->frames);
+        return false;
     }
     m_pimpl->depthFrame = m_pimpl->frames.get_depth_frame();
 
@@ -455,7 +485,35 @@ bool RealSense::Impl::startStream()
 
     try
     {
-        pipe.start(cfg);
+        if (useAsyncCapture)
+        {
+            // the capture callback runs on a librealsense internal thread and only hands
+            // the reference-counted frameset over to the bounded queue. When the queue is
+            // full the oldest frameset is dropped, so a slow consumer never blocks the
+            // acquisition
+            framesQueue = rs2::frame_queue(static_cast<unsigned int>(frameQueueCapacity));
+            warmupFramesToDrop = 30;
+            pipe.start(cfg, [this](const rs2::frame& frame) {
+                auto frameset = frame.as<rs2::frameset>();
+                if (!frameset)
+                {
+                    return;
+                }
+
+                // Camera warmup - dropping several first frames to let auto-exposure
+                // stabilize
+                if (warmupFramesToDrop > 0)
+                {
+                    warmupFramesToDrop--;
+                    return;
+                }
+
+                framesQueue.enqueue(frameset);
+            });
+        } else
+        {
+            pipe.start(cfg);
+        }
     } catch (const rs2::error& e)
     {
         log()->error("[RealSenseCapture::Impl::startStream] Failed to start the pipeline: ({})",
@@ -463,17 +521,54 @@ bool RealSense::Impl::startStream()
         return false;
     }
 
-    // Camera warmup - dropping several first frames to let auto-exposure stabilize
-    for (int i = 0; i < 30; i++)
+    if (!useAsyncCapture)
     {
-        // Wait for all configured streams to produce a frame
-        frames = pipe.wait_for_frames();
+        // Camera warmup - dropping several first frames to let auto-exposure stabilize
+        for (int i = 0; i < 30; i++)
+        {
+            // Wait for all configured streams to produce a frame
+            frames = pipe.wait_for_frames();
+        }
     }
 
     isStreaming = true;
     return true;
 }
 
+bool RealSense::Impl::grabFrames()
+{
+    if (useAsyncCapture)
+    {
+        rs2::frameset frameset;
+        if (!framesQueue.try_wait_for_frame(&frameset))
+        {
+            log()->error("[RealSenseCapture::Impl::grabFrames] Timed out while waiting for a "
+                         "frameset from the capture callback.");
+            return false;
+        }
+
+        // drain the queue to always expose the most recent frameset
+        rs2::frameset newerFrameset;
+        while (framesQueue.poll_for_frame(&newerFrameset))
+        {
+            frameset = newerFrameset;
+        }
+
+        frames = frameset;
+    } else
+    {
+        frames = pipe.wait_for_frames();
+    }
+
+    if (doAlignToColor && alignToColor != nullptr)
+    {
+        // rs2::align keeps the alignment on the librealsense processing pipeline
+        frames = alignToColor->process(frames);
+    }
+
+    return true;
+}
+
 void RealSense::Impl::stopStream()
 {
     pipe.stop();
@@ -55,6 +55,19 @@ public:
      */
     bool buildConvexHull(Eigen::Ref<const Eigen::MatrixXd> points);
 
+    /**
+     * Update the convex hull given a new set of points. If the set of points is identical to the
+     * one used to build the current hull, the cached halfspace representation is reused and the
+     * hull is not recomputed. This is useful when the function is called periodically (e.g. in a
+     * constraint update loop) and the points change only from time to time.
+     * @note qhull does not support the removal of a point from an existing hull, consequently a
+     * change in the set of points triggers a rebuild of the hull.
+     * @param points a matrix of the points that describes the convex hull. Each point is stored as
+     * column of the matrix.
+     * @return true/false in case of success/failure.
+     */
+    bool updateConvexHull(Eigen::Ref<const Eigen::MatrixXd> points);
+
     /**
      * Return the \f$A\f$ constraint matrix, such that \f$ Ax \le b\f$ iff the point \f$x\f$ is in
      * the convex hull.
@@ -94,6 +94,16 @@ public:
      */
     bool setFinalConditions(Eigen::Ref<const Eigen::VectorXd> velocity);
 
+    /**
+     * Update the position of the last knot keeping the other knots and the boundary conditions
+     * unchanged.
+     * @param position position of the last knot in \$f\mathbb{R}^n\$f.
+     * @note This method can be used to adjust the target of an ongoing trajectory without
+     * rebuilding the entire spline. The coefficients are recomputed at the next evaluation.
+     * @return True in case of success, false otherwise.
+     */
+    bool updateLastKnot(Eigen::Ref<const Eigen::VectorXd> position) final;
+
     /**
      * Evaluate the spline at a given point
      * @param t instant time
@@ -115,6 +125,24 @@ public:
      */
     bool evaluatePoint(const std::chrono::nanoseconds& t, SplineState& state) final;
 
+    /**
+     * Evaluate the spline at a set of time instants
+     * @param time vector containing the time instants.
+     * @param position matrix containing the position at the given time instants, one column per
+     * instant.
+     * @param velocity matrix containing the velocity at the given time instants, one column per
+     * instant.
+     * @param acceleration matrix containing the acceleration at the given time instants, one
+     * column per instant.
+     * @note The knots are walked monotonically while evaluating the instants, so sampling an
+     * entire trajectory costs a single pass over the knots when the time instants are sorted.
+     * @return True in case of success, false otherwise.
+     */
+    bool evaluatePoints(const std::vector<std::chrono::nanoseconds>& time,
+                        Eigen::Ref<Eigen::MatrixXd> position,
+                        Eigen::Ref<Eigen::MatrixXd> velocity,
+                        Eigen::Ref<Eigen::MatrixXd> acceleration) final;
+
     /**
      * Get the state of the system.
      * @warning if the the time step of the advance is not set the user cannot use the advance
@@ -9,6 +9,9 @@
 #define BIPEDAL_LOCOMOTION_PLANNERS_SO3_PLANNER_H
 
 #include <chrono>
+#include <vector>
+
+#include <Eigen/Dense>
 #include <manif/SO3.h>
 
 #include <BipedalLocomotion/System/Source.h>
@@ -62,6 +65,15 @@ class SO3Planner : public System::Source<SO3PlannerState>
      * depends on the chosen Trivialization */
     manif::SO3d::Tangent m_distance{manif::SO3d::Tangent::Zero()};
 
+    /** Norm of the distance between the two rotations. It is precomputed when the rotations are
+     * set */
+    double m_distanceNorm{0.0};
+
+    /** Unit axis of the geodesic connecting the two rotations. It is precomputed when the
+     * rotations are set so that each evaluation of the trajectory requires one exponential map
+     * only */
+    Eigen::Vector3d m_distanceAxis{Eigen::Vector3d::UnitX()};
+
     std::chrono::nanoseconds m_T{std::chrono::nanoseconds::zero()}; /**< Trajectory duration in
                                                                        seconds */
 
@@ -148,6 +160,20 @@ public:
                        manif::SO3TangentBase<Derived>& velocity,
                        manif::SO3TangentBase<Derived>& acceleration);
 
+    /**
+     * Sample the trajectory at a set of equally spaced time instants.
+     * The axis of the geodesic connecting the two rotations is precomputed when the rotations are
+     * set, consequently each sample requires one exponential map only. This is useful to fill
+     * feedforward buffers where the trajectory is sampled densely.
+     * @param samplingTime time step between two consecutive samples.
+     * @param trajectory vector containing the state of the planner at each time instant. The
+     * vector is resized inside the function and the samples span the interval [0, T], where T is
+     * the duration passed to setRotations().
+     * @return True in case of success/false otherwise.
+     */
+    bool evaluateTrajectory(const std::chrono::nanoseconds& samplingTime,
+                            std::vector<SO3PlannerState>& trajectory);
+
     /**
      * Set the time step of the advance interface.
      * @warning if the the time step is not set the user cannot use the advance features.
@@ -142,6 +142,12 @@ bool SO3Planner<trivialization>::setRotations(const manif::SO3d& initialRotation
     m_T = duration;
     m_distance = this->computeDistance(initialRotation, finalRotation);
 
+    // precompute the axis-angle representation of the distance. It allows to evaluate the
+    // exponential map of the scaled distance without computing it from scratch at every sample
+    m_distanceNorm = m_distance.coeffs().norm();
+    m_distanceAxis = m_distanceNorm > 0 ? Eigen::Vector3d(m_distance.coeffs() / m_distanceNorm)
+                                        : Eigen::Vector3d::UnitX();
+
     // reset the advance current time
     m_advanceCurrentTime = std::chrono::nanoseconds::zero();
 
@@ -219,17 +225,20 @@ bool SO3Planner<trivialization>::evaluatePoint(const std::chrono::nanoseconds& t
                      polynomial.a3 * t3 + //
                      polynomial.a4 * t4 + //
                      polynomial.a5 * t5;
-    const manif::SO3d::Tangent displacementTangent = m_distance * s;
+    // the exponential of the displacement is evaluated from the axis-angle representation of the
+    // distance precomputed in setRotations, i.e. exp(distance * s) = AngleAxis(|distance| s, axis)
+    const manif::SO3d displacementExp(
+        Eigen::Quaterniond(Eigen::AngleAxisd(m_distanceNorm * s, m_distanceAxis)));
 
     if constexpr (trivialization == LieGroupTrivialization::Right)
     {
         // please read this as R(t) = exp(displacementTangent) * initialRotation
-        rotation = displacementTangent.exp() * m_initialRotation;
+        rotation = displacementExp * m_initialRotation;
     } else
     // Please read it as trivialization == LieGroupTrivialization::Left
     {
         // please read this as R(t) = initialRotation * exp(displacementTangent)
-        rotation = m_initialRotation * displacementTangent.exp();
+        rotation = m_initialRotation * displacementExp;
     }
 
     // compute velocity (it is expressed in body / inertial frame accordingly to the chosen
@@ -263,6 +272,43 @@ bool SO3Planner<trivialization>::evaluatePoint(const std::chrono::nanoseconds& t
     return this->evaluatePoint(time, state.rotation, state.velocity, state.acceleration);
 }
 
+template <LieGroupTrivialization trivialization>
+bool SO3Planner<trivialization>::evaluateTrajectory(const std::chrono::nanoseconds& samplingTime,
+                                                    std::vector<SO3PlannerState>& trajectory)
+{
+    constexpr auto logPrefix = "[SO3Planner::evaluateTrajectory]";
+
+    if (samplingTime <= std::chrono::nanoseconds::zero())
+    {
+        log()->error("{} The sampling time must be a strictly positive number.", logPrefix);
+        return false;
+    }
+
+    if (!this->computeCoefficients())
+    {
+        log()->error("{} Unable to compute the coefficients.", logPrefix);
+        return false;
+    }
+
+    // the trajectory is sampled in [0, T]. The vector is reallocated only if the number of
+    // samples changes
+    const std::size_t numberOfSamples = m_T / samplingTime + 1;
+    trajectory.resize(numberOfSamples);
+
+    for (std::size_t i = 0; i < numberOfSamples; i++)
+    {
+        if (!this->evaluatePoint(i * samplingTime, trajectory[i]))
+        {
+            log()->error("{} Unable to evaluate the trajectory at the sample number {}.",
+                         logPrefix,
+                         i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 template <LieGroupTrivialization trivialization>
 bool SO3Planner<trivialization>::setAdvanceTimeStep(const std::chrono::nanoseconds& dt)
 {
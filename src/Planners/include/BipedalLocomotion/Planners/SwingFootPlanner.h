@@ -10,6 +10,7 @@
 
 #include <chrono>
 #include <memory>
+#include <vector>
 
 #include <manif/manif.h>
 
@@ -76,12 +77,28 @@ class SwingFootPlanner : public System::Source<SwingFootPlannerState>
 
     bool m_isOutputValid{false}; /**< True if getOutput returns meaningful data */
 
+    bool m_useTrajectoryTable{false}; /**< If true the whole swing trajectory is precomputed at
+                                         take off and advance() reads the precomputed samples */
+    std::vector<SwingFootPlannerState> m_trajectoryTable; /**< Swing trajectory sampled at the
+                                                             planner sampling time */
+    /** Time associated to the first sample of the trajectory table */
+    std::chrono::nanoseconds m_tableStartTime{std::chrono::nanoseconds::zero()};
+    bool m_isTableValid{false}; /**< True if the trajectory table describes the ongoing swing */
+
     /**
      * Update the SE3 Trajectory.
      * @return True in case of success/false otherwise.
      */
     bool updateSE3Traj();
 
+    /**
+     * Sample the entire swing trajectory at the planner sampling time and store it in the
+     * trajectory table. When the table is valid, advance() degenerates to an index read. The table
+     * is invalidated when the ongoing trajectory is retargeted with setContactList().
+     * @return True in case of success/false otherwise.
+     */
+    bool populateTrajectoryTable();
+
     /**
      * Create a new SE3Trajectory considering the previous and next contact
      * @return True in case of success/false otherwise.
@@ -108,6 +125,7 @@ public:
      * |   `foot_take_off_velocity`   | `double` |                                         Take-off vertical velocity (default value 0.0)                                                                     |    No     |
      * | `foot_take_off_acceleration` | `double` |                                       Take-off vertical acceleration (default value 0.0)                                                                   |    No     |
      * |    `interpolation_method`    | `string` | Define the interpolation method for the trajectory of the position. Accepted parameters: `min_acceleration`, `min_jerk` (default value `min_acceleration`) |    No     |
+     * |    `use_trajectory_table`    |  `bool`  | If true the whole swing trajectory is sampled once at take off and advance() reads the precomputed samples. The splines are evaluated at every tick only after the ongoing trajectory is retargeted with setContactList() (default value `false`) |    No     |
      * @return True in case of success/false otherwise.
      */
     bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler) final;
@@ -133,6 +151,9 @@ public:
      *  online. This check is not done here since the SO3Planner will complain in case of issues.
      *   2. the impact time of the next contact must be the same as the one of the next contact in
      * the contact list stored in the class.
+     * If the next contact differs only in its position, the ongoing trajectory is retargeted
+     * incrementally: only the terminal constraint of the position splines is moved while the
+     * boundary conditions at the current time instant and the SO(3) trajectory are left untouched.
      */
     bool setContactList(const Contacts::ContactList& contactList);
 
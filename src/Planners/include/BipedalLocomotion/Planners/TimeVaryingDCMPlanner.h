@@ -57,6 +57,8 @@ public:
      * |    `vrp_rate_of_change_weight`    |  `double`  |                                               Weight associated to the rate of change of the VRP                                               |    Yes    |
      * |    `dcm_rate_of_change_weight`    |  `double`  |                                               Weight associated to the rate of change of the DCM                                               |    Yes    |
      * |    `use_external_dcm_reference`   |   `bool`   |  Set this option to true if you want provide an external DCM reference with TimeVaryingDCMPlanner::setDCMReference(). (Default value False)    |    No     |
+     * |           `warm_start`            |   `bool`   |  Set this option to true to warm start the solver with the time-shifted solution of the previous solve, when available. (Default value False)  |    No     |
+     * |        `use_function_cache`       |   `bool`   |  Set this option to true to share the CasADi functions among the planner instances having the same sampling time and gravity. (Default value False)  |    No     |
      * |            `gravity`              |  `double`  |  Value of the gravity acceleration. It should be a positive number (Default Math::StandardAccelerationOfGravitation )  |    No     |
      * @return true in case of success/false otherwise.
      */
@@ -64,6 +66,9 @@ public:
 
     /**
      * Compute the DCM trajectory.
+     * @note Once the problem is solved, only the per-sample optimal trajectories are kept in
+     * memory. The state at the current sample can be read with getOutput() and the trajectory is
+     * traversed on demand with advance().
      * @return true in case of success, false otherwise.
      */
      bool computeTrajectory() final;
@@ -157,6 +157,20 @@ public:
 
     bool advance() override;
 
+    /**
+     * Replan the footsteps over a new horizon reusing the configured planner instance.
+     *
+     * This method is meant for receding-horizon usage and it is equivalent to calling setInput()
+     * followed by advance(). The parameters passed to initialize() are not parsed again, the
+     * internal footstep containers are reused between two subsequent calls and, if the input does
+     * not provide the initial contacts, they are seeded with the contacts of the previous
+     * solution active at `input.t0`.
+     *
+     * @param input The planner input containing the new horizon and the new knots.
+     * @return True in case of success, false otherwise.
+     */
+    bool replan(const UnicyclePlannerInput& input);
+
 private:
     class Impl;
     std::unique_ptr<Impl> m_pImpl;
@@ -20,6 +20,14 @@ struct ConvexHullHelper::Impl
 {
     Eigen::VectorXd b;
     Eigen::MatrixXd A;
+
+    /** Set of points used to build the current hull. It is used by updateConvexHull() to detect
+        whether the hull is already up to date */
+    Eigen::MatrixXd points;
+
+    /** Working buffer required since qh_new_qhull expects a non const pointer to a double. It is
+        kept preallocated between two calls of buildConvexHull() */
+    Eigen::Matrix<coordT, Eigen::Dynamic, Eigen::Dynamic> pointsCoordinates;
 };
 
 ConvexHullHelper::ConvexHullHelper()
@@ -39,8 +47,9 @@ bool ConvexHullHelper::buildConvexHull(Eigen::Ref<const Eigen::MatrixXd> points)
     const std::size_t numberOfPoints = points.cols();
     const std::size_t numberOfCoordinates = points.rows();
 
-    // required since qh_new_qhull expects a non const pointer to a double
-    Eigen::Matrix<coordT, Eigen::Dynamic, Eigen::Dynamic> pointsCoordinates = points;
+    // required since qh_new_qhull expects a non const pointer to a double. The buffer is
+    // reallocated only if the number of points changes
+    m_pimpl->pointsCoordinates = points;
 
     facetT* facet = nullptr;
     vertexT* vertex = nullptr;
@@ -58,7 +67,7 @@ bool ConvexHullHelper::buildConvexHull(Eigen::Ref<const Eigen::MatrixXd> points)
     int exitCode = qh_new_qhull(qh,
                                 numberOfCoordinates,
                                 numberOfPoints,
-                                pointsCoordinates.data(),
+                                m_pimpl->pointsCoordinates.data(),
                                 false,
                                 flags,
                                 nullptr,
@@ -80,9 +89,13 @@ bool ConvexHullHelper::buildConvexHull(Eigen::Ref<const Eigen::MatrixXd> points)
         }
     }
 
-    // resize the matrix A and the vector b
-    m_pimpl->A.resize(numNonUpperDelaunay, numberOfCoordinates);
-    m_pimpl->b.resize(numNonUpperDelaunay);
+    // resize the matrix A and the vector b. The storage is reallocated only if the number of
+    // facets or of coordinates changes
+    if (m_pimpl->A.rows() != numNonUpperDelaunay || m_pimpl->A.cols() != numberOfCoordinates)
+    {
+        m_pimpl->A.resize(numNonUpperDelaunay, numberOfCoordinates);
+        m_pimpl->b.resize(numNonUpperDelaunay);
+    }
 
     int i = 0;
     FORALLfacets
@@ -126,9 +139,25 @@ bool ConvexHullHelper::buildConvexHull(Eigen::Ref<const Eigen::MatrixXd> points)
     }
 #endif
 
+    // store the set of points associated to the hull. It is used by updateConvexHull() to detect
+    // whether the hull is already up to date
+    m_pimpl->points = points;
+
     return true;
 }
 
+bool ConvexHullHelper::updateConvexHull(Eigen::Ref<const Eigen::MatrixXd> points)
+{
+    // if the set of points did not change the halfspace representation is already up to date
+    if (points.rows() == m_pimpl->points.rows() && points.cols() == m_pimpl->points.cols()
+        && points == m_pimpl->points)
+    {
+        return true;
+    }
+
+    return this->buildConvexHull(points);
+}
+
 Eigen::Ref<const Eigen::MatrixXd> ConvexHullHelper::getA() const
 {
     return m_pimpl->A;
@@ -6,10 +6,12 @@
  */
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <iostream>
+#include <vector>
 
-#include <Eigen/Sparse>
+#include <Eigen/Dense>
 
 #include <BipedalLocomotion/Planners/CubicSpline.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
@@ -46,16 +48,12 @@ struct CubicSpline::Impl
     };
 
     /**
-     * Description of a 3-rd order polynomial. It contains the coefficients, the initial/final knots
-     * and the duration of the sub-trajectory.
+     * Description of a 3-rd order polynomial. It contains the initial/final knots and the
+     * duration of the sub-trajectory. The coefficients are stored in the structure-of-arrays
+     * container owned by the Impl.
      */
     struct Polynomial
     {
-        Eigen::VectorXd a0;
-        Eigen::VectorXd a1;
-        Eigen::VectorXd a2;
-        Eigen::VectorXd a3;
-
         const Knot* initialPoint;
         const Knot* finalPoint;
 
@@ -68,6 +66,13 @@ struct CubicSpline::Impl
     std::vector<Knot> knots; /**< Collection of all the knots */
     std::vector<Polynomial> polynomials; /**< Collection of all the polynomials */
 
+    /** Polynomial coefficients stored as structure-of-arrays: coefficients[k] is a (dimension x
+     * number of polynomials) matrix whose p-th column contains the k-th order coefficient of the
+     * p-th polynomial. The coefficients of one polynomial are contiguous columns allocated by
+     * Eigen (hence aligned), so the evaluation of a sub-trajectory vectorizes across the
+     * dimensions. */
+    std::array<Eigen::MatrixXd, 4> coefficients;
+
     bool areCoefficientsComputed{false}; /**< If true the coefficients are computed and updated */
 
     SplineState currentTrajectory; /**< Current trajectory stored in the advance state */
@@ -118,30 +123,22 @@ struct CubicSpline::Impl
     bool setBoundaryVelocitiesAndAcceleration();
 
     /**
-     * addTripletCurrentKnot is a helper function to generate a triplet containing a 2x2 matrix.
-     * This matrix is used to compute the intermediate velocity and acceleration.
+     * currentKnotCoefficient is a helper function to generate the diagonal coefficient associated
+     * to a knot. This coefficient is used to compute the intermediate velocity.
      */
-    void addTripletCurrentKnot(const int& knotIndex,
-                               const int& rowOffset,
-                               const int& columnOffset,
-                               std::vector<Eigen::Triplet<double>>& tripletList);
+    double currentKnotCoefficient(const int& knotIndex) const;
 
     /**
-     * addTripletPreviousKnot is a helper function to generate a triplet containing a 2x2 matrix.
-     * This matrix is used to compute the intermediate velocity and acceleration.
+     * previousKnotCoefficient is a helper function to generate the sub-diagonal coefficient
+     * associated to a knot. This coefficient is used to compute the intermediate velocity.
      */
-    void addTripletPreviousKnot(const int& knotIndex,
-                                const int& rowOffset,
-                                const int& columnOffset,
-                                std::vector<Eigen::Triplet<double>>& tripletList);
+    double previousKnotCoefficient(const int& knotIndex) const;
+
     /**
-     * addTripletNextKnot is a helper function to generate a triplet containing a 2x2 matrix.
-     * This matrix is used to compute the intermediate velocity and acceleration.
+     * nextKnotCoefficient is a helper function to generate the super-diagonal coefficient
+     * associated to a knot. This coefficient is used to compute the intermediate velocity.
      */
-    void addTripletNextKnot(const int& knotIndex,
-                            const int& rowOffset,
-                            const int& columnOffset,
-                            std::vector<Eigen::Triplet<double>>& tripletList);
+    double nextKnotCoefficient(const int& knotIndex) const;
 
     /**
      * addKnownTermKnotPosition is a helper function to generate a 2-d vector,
@@ -310,6 +307,34 @@ bool CubicSpline::setKnots(const std::vector<Eigen::VectorXd>& position,
     return true;
 }
 
+bool CubicSpline::updateLastKnot(Eigen::Ref<const Eigen::VectorXd> position)
+{
+    constexpr auto logPrefix = "[CubicSpline::updateLastKnot]";
+
+    if (m_pimpl->knots.empty())
+    {
+        log()->error("{} Please set the knots before updating the last one.", logPrefix);
+        return false;
+    }
+
+    if (position.size() != m_pimpl->knots.back().position.size())
+    {
+        log()->error("{} The size of the position is different from the one expected. Expected: "
+                     "{}. Retrieved: {}.",
+                     logPrefix,
+                     m_pimpl->knots.back().position.size(),
+                     position.size());
+        return false;
+    }
+
+    m_pimpl->knots.back().position = position;
+
+    // Only the position of the last knot changed. The coefficients are outdated.
+    m_pimpl->areCoefficientsComputed = false;
+
+    return true;
+}
+
 void CubicSpline::Impl::resetKnot(const std::chrono::nanoseconds& timeInstant,
                                   Eigen::Ref<const Eigen::VectorXd> position,
                                   Knot& knot)
@@ -382,7 +407,14 @@ bool CubicSpline::Impl::computeCoefficients()
         this->computeIntermediateVelocities();
     }
 
-    // populate the coefficients of each polynomial
+    // allocate the structure-of-arrays coefficient storage and populate the coefficients of each
+    // polynomial
+    const Eigen::Index knotSize = knots.front().position.size();
+    for (auto& coefficient : coefficients)
+    {
+        coefficient.resize(knotSize, polynomials.size());
+    }
+
     for (auto& poly : polynomials)
     {
         this->setPolynomialCoefficients(poly);
@@ -454,57 +486,45 @@ bool CubicSpline::Impl::setBoundaryVelocitiesAndAcceleration()
     return true;
 }
 
-void CubicSpline::Impl::addTripletCurrentKnot(const int& knotIndex,
-                                              const int& rowOffset,
-                                              const int& columnOffset,
-                                              std::vector<Eigen::Triplet<double>>& tripletList)
+double CubicSpline::Impl::currentKnotCoefficient(const int& knotIndex) const
 {
     const auto& poly = polynomials[knotIndex];
     const auto& prevPoly = polynomials[knotIndex - 1];
 
-    // The following triplet represent this matrix
+    // The following coefficient represent this matrix
     //  /      /   1      1\ \
     //  |   4  |------ + --| |
     //  |      |T        T | |
     //  |      \ i - 1    i/ |
     //  \                    /
 
-    tripletList.emplace_back(rowOffset,
-                             columnOffset,
-                             4 * (1 / durationToSeconds(prevPoly.duration)
-                                    + 1 / durationToSeconds(poly.duration)));
+    return 4 * (1 / durationToSeconds(prevPoly.duration) + 1 / durationToSeconds(poly.duration));
 }
 
-void CubicSpline::Impl::addTripletPreviousKnot(const int& knotIndex,
-                                               const int& rowOffset,
-                                               const int& columnOffset,
-                                               std::vector<Eigen::Triplet<double>>& tripletList)
+double CubicSpline::Impl::previousKnotCoefficient(const int& knotIndex) const
 {
     const auto& poly = polynomials[knotIndex - 1];
 
-    // The following triplet represent this matrix
+    // The following coefficient represent this matrix
     // /     2     \
     // |  -------   |
     // |  T         |
     // \   i - 1    /
 
-    tripletList.emplace_back(rowOffset, columnOffset, 2 / durationToSeconds(poly.duration));
+    return 2 / durationToSeconds(poly.duration);
 }
 
-void CubicSpline::Impl::addTripletNextKnot(const int& knotIndex,
-                                           const int& rowOffset,
-                                           const int& columnOffset,
-                                           std::vector<Eigen::Triplet<double>>& tripletList)
+double CubicSpline::Impl::nextKnotCoefficient(const int& knotIndex) const
 {
     const auto& poly = polynomials[knotIndex];
 
-    // The following triplet represent this matrix
+    // The following coefficient represent this matrix
     // /    2    \
     // |   ---    |
     // |   T      |
     // \    i     /
 
-    tripletList.emplace_back(rowOffset, columnOffset, 2 / durationToSeconds(poly.duration));
+    return 2 / durationToSeconds(poly.duration);
 }
 
 void CubicSpline::Impl::addKnownTermKnotPosition(const std::size_t& knotIndex,
@@ -549,16 +569,20 @@ void CubicSpline::Impl::setPolynomialCoefficients(Polynomial& poly)
 {
     const double T = durationToSeconds(poly.duration);
 
+    // the coefficients are stored in the column of the structure-of-arrays container associated
+    // to the polynomial
+    const std::size_t index = &poly - polynomials.data();
+
     const auto& x0 = poly.initialPoint->position;
     const auto& dx0 = poly.initialPoint->velocity;
 
     const auto& xT = poly.finalPoint->position;
     const auto& dxT = poly.finalPoint->velocity;
 
-    poly.a0 = x0;
-    poly.a1 = dx0;
-    poly.a2 = -(3 * x0 - 3 * xT + 2 * T * dx0 + T * dxT) / (T * T);
-    poly.a3 = (2 * x0 - 2 * xT + T * dx0 + T * dxT) / (T * T * T);
+    coefficients[0].col(index) = x0;
+    coefficients[1].col(index) = dx0;
+    coefficients[2].col(index) = -(3 * x0 - 3 * xT + 2 * T * dx0 + T * dxT) / (T * T);
+    coefficients[3].col(index) = (2 * x0 - 2 * xT + T * dx0 + T * dxT) / (T * T * T);
 }
 
 void CubicSpline::Impl::computeIntermediateVelocities()
@@ -566,9 +590,6 @@ void CubicSpline::Impl::computeIntermediateVelocities()
     // here we assume that at least 3 points has been defined
     const std::size_t numberOfInteriorKnots = knots.size() - 2;
 
-    Eigen::SparseMatrix<double> A(numberOfInteriorKnots, numberOfInteriorKnots);
-    std::vector<Eigen::Triplet<double>> tripletsList;
-
     // Given a set of interior points the we can define a matrix A as
     //                          __                                        __
     //                         | x x 0 0 0 0 0 0 0 0 0 0 ... 0 0 0 0 0 0 0 |
@@ -587,52 +608,36 @@ void CubicSpline::Impl::computeIntermediateVelocities()
     //                         | 0 0 0 0 0 0 0 0 0 0 0 0 ... 0 0 0 0 0 x x |
     //                         |__                                       __|
     //
-    // where x represents a non zero number and 0 represents the number 0. The matrix A can be
-    // stored as a sparse matrix where the number of non zero entries for the extremum elements are
-    // 2 and the number of non zero elements for the interior (non extremum elements) are 3
+    // where x represents a non zero number and 0 represents the number 0. The matrix A is
+    // tridiagonal: the diagonal coefficients are associated to the current knot, the sub-diagonal
+    // coefficients to the previous knot and the super-diagonal coefficients to the next knot.
     // The matrix A is a square matrix whose number of columns (and rows) is equal to the
-    // number of interior knots of the spline times. If there is only an interior knot, A is a 1x1
+    // number of interior knots of the spline. If there is only an interior knot, A is a 1x1
     // dense matrix.
-    unsigned int numberOfExpectedTriplets = 1;
-    if (numberOfInteriorKnots > 1)
-    {
-        constexpr std::size_t numberOfExtremumElements = 2;
-        constexpr std::size_t numberOfNonExtremumElements = 4;
-        constexpr std::size_t numberOfExtremum = 2;
-        numberOfExpectedTriplets = numberOfNonExtremumElements //
-                                       * (numberOfInteriorKnots - numberOfExtremum)
-                                   + numberOfExtremum * numberOfExtremumElements;
-    }
-    tripletsList.reserve(numberOfExpectedTriplets);
-
-    for (int i = 0; i < numberOfInteriorKnots; i++)
+    //
+    // The system is solved with the Thomas algorithm. The factorization of A is computed once and
+    // shared among all the coordinates of the knots, so solving for each coordinate reduces to a
+    // forward and a backward substitution whose cost is linear in the number of interior knots.
+    Eigen::VectorXd invModifiedDiagonal(numberOfInteriorKnots);
+    Eigen::VectorXd lowerFactor(numberOfInteriorKnots);
+    Eigen::VectorXd upperCoefficient(numberOfInteriorKnots);
+
+    invModifiedDiagonal[0] = 1 / this->currentKnotCoefficient(1);
+    for (std::size_t i = 1; i < numberOfInteriorKnots; i++)
     {
         const int absoluteKnotIndex = i + 1;
 
-        // in this case there is only one interior knot A will be a 2
-        if (i == 0 && (i + 1) == numberOfInteriorKnots)
-        {
-            this->addTripletCurrentKnot(absoluteKnotIndex, 0, 0, tripletsList);
-        } else if (i == 0)
-        {
-            this->addTripletCurrentKnot(absoluteKnotIndex, i, 0, tripletsList);
-            this->addTripletNextKnot(absoluteKnotIndex, i, 1, tripletsList);
-        } else if (i + 1 == numberOfInteriorKnots)
-        {
-            this->addTripletPreviousKnot(absoluteKnotIndex, i, (i - 1), tripletsList);
-            this->addTripletCurrentKnot(absoluteKnotIndex, i, (i - 1) + 1, tripletsList);
-        } else
-        {
-            this->addTripletPreviousKnot(absoluteKnotIndex, i, (i - 1), tripletsList);
-            this->addTripletCurrentKnot(absoluteKnotIndex, i, (i - 1) + 1, tripletsList);
-            this->addTripletNextKnot(absoluteKnotIndex, i, (i - 1) + 1 + 1, tripletsList);
-        }
-    }
+        upperCoefficient[i - 1] = this->nextKnotCoefficient(absoluteKnotIndex - 1);
+        lowerFactor[i] = this->previousKnotCoefficient(absoluteKnotIndex) //
+                         * invModifiedDiagonal[i - 1];
 
-    A.setFromTriplets(tripletsList.begin(), tripletsList.end());
+        invModifiedDiagonal[i] = 1
+                                 / (this->currentKnotCoefficient(absoluteKnotIndex)
+                                    - lowerFactor[i] * upperCoefficient[i - 1]);
+    }
 
-    // compute first coordinate
-    Eigen::VectorXd b(A.rows());
+    // compute the solution for each coordinate
+    Eigen::VectorXd b(numberOfInteriorKnots);
     for (size_t j = 0; j < knots.front().position.size(); j++)
     {
         b.setZero();
@@ -659,21 +664,28 @@ void CubicSpline::Impl::computeIntermediateVelocities()
 
             else
             {
-                this->addKnownTermKnotPosition(absoluteKnotIndex, j, b.segment<2>(i));
+                this->addKnownTermKnotPosition(absoluteKnotIndex, j, b.segment<1>(i));
             }
         }
 
-        Eigen::SparseQR<Eigen::SparseMatrix<double>,
-                        Eigen::COLAMDOrdering<Eigen::SparseMatrix<double>::StorageIndex>>
-            qrDecomposition;
-        qrDecomposition.compute(A);
-        Eigen::VectorXd solution = qrDecomposition.solve(b);
+        // forward substitution
+        for (size_t i = 1; i < numberOfInteriorKnots; i++)
+        {
+            b[i] -= lowerFactor[i] * b[i - 1];
+        }
+
+        // backward substitution. The vector b is overwritten with the solution of the system
+        b[numberOfInteriorKnots - 1] *= invModifiedDiagonal[numberOfInteriorKnots - 1];
+        for (std::ptrdiff_t i = static_cast<std::ptrdiff_t>(numberOfInteriorKnots) - 2; i >= 0; i--)
+        {
+            b[i] = (b[i] - upperCoefficient[i] * b[i + 1]) * invModifiedDiagonal[i];
+        }
 
         for (size_t i = 0; i < numberOfInteriorKnots; i++)
         {
             const int absoluteKnotIndex = i + 1;
 
-            knots[absoluteKnotIndex].velocity[j] = solution[i];
+            knots[absoluteKnotIndex].velocity[j] = b[i];
         }
     }
 }
@@ -682,16 +694,17 @@ void CubicSpline::Impl::getPositionAtTime(const std::chrono::nanoseconds& t,
                                           const Polynomial& poly,
                                           Eigen::Ref<Eigen::VectorXd> position)
 {
-
     const double tS = durationToSeconds(t);
+    const std::size_t index = &poly - polynomials.data();
 
-    // improve the readability of the code
-    const auto& a0 = poly.a0;
-    const auto& a1 = poly.a1;
-    const auto& a2 = poly.a2;
-    const auto& a3 = poly.a3;
-
-    position = a0 + a1 * tS + a2 * std::pow(tS, 2) + a3 * std::pow(tS, 3);
+    // Horner evaluation on the contiguous coefficient columns. Every operation acts on the whole
+    // column, so the loop vectorizes across the dimensions of the spline.
+    position = coefficients[3].col(index);
+    for (int k = 2; k >= 0; k--)
+    {
+        position *= tS;
+        position += coefficients[k].col(index);
+    }
 }
 
 void CubicSpline::Impl::getVelocityAtTime(const std::chrono::nanoseconds& t,
@@ -699,24 +712,26 @@ void CubicSpline::Impl::getVelocityAtTime(const std::chrono::nanoseconds& t,
                                           Eigen::Ref<Eigen::VectorXd> velocity)
 {
     const double tS = durationToSeconds(t);
+    const std::size_t index = &poly - polynomials.data();
 
-    // improve the readability of the code
-    const auto& a1 = poly.a1;
-    const auto& a2 = poly.a2;
-    const auto& a3 = poly.a3;
-
-    velocity = a1 + 2 * a2 * tS + 3 * a3 * std::pow(tS, 2);
+    velocity = 3.0 * coefficients[3].col(index);
+    for (int k = 2; k >= 1; k--)
+    {
+        velocity *= tS;
+        velocity += k * coefficients[k].col(index);
+    }
 }
 
 void CubicSpline::Impl::getAccelerationAtTime(const std::chrono::nanoseconds& t,
                                               const Polynomial& poly,
                                               Eigen::Ref<Eigen::VectorXd> acceleration)
 {
-    // improve the readability of the code
-    const auto& a2 = poly.a2;
-    const auto& a3 = poly.a3;
+    const double tS = durationToSeconds(t);
+    const std::size_t index = &poly - polynomials.data();
 
-    acceleration = 2 * a2 + 2 * 3 * a3 * durationToSeconds(t);
+    acceleration = (3 * 2) * coefficients[3].col(index);
+    acceleration *= tS;
+    acceleration += 2.0 * coefficients[2].col(index);
 }
 
 bool CubicSpline::evaluatePoint(const std::chrono::nanoseconds& t,
@@ -782,6 +797,89 @@ bool CubicSpline::evaluatePoint(const std::chrono::nanoseconds& t, SplineState&
     return this->evaluatePoint(t, state.position, state.velocity, state.acceleration);
 }
 
+bool CubicSpline::evaluatePoints(const std::vector<std::chrono::nanoseconds>& time,
+                                 Eigen::Ref<Eigen::MatrixXd> position,
+                                 Eigen::Ref<Eigen::MatrixXd> velocity,
+                                 Eigen::Ref<Eigen::MatrixXd> acceleration)
+{
+    constexpr auto logPrefix = "[CubicSpline::evaluatePoints]";
+    if (!m_pimpl->areCoefficientsComputed)
+    {
+        if (!m_pimpl->computeCoefficients())
+        {
+            log()->error("{} Unable to compute the coefficients of the spline.", logPrefix);
+            return false;
+        }
+    }
+
+    const Eigen::Index knotSize = m_pimpl->knots.front().position.size();
+    const Eigen::Index numberOfInstants = static_cast<Eigen::Index>(time.size());
+    if (position.rows() != knotSize || position.cols() != numberOfInstants
+        || velocity.rows() != knotSize || velocity.cols() != numberOfInstants
+        || acceleration.rows() != knotSize || acceleration.cols() != numberOfInstants)
+    {
+        log()->error("{} The output matrices should have a column for each time instant and a row "
+                     "for each coordinate of the knots. Expected size: {} x {}.",
+                     logPrefix,
+                     knotSize,
+                     numberOfInstants);
+        return false;
+    }
+
+    // the polynomials are walked monotonically, so sampling an entire trajectory costs a single
+    // pass over the knots. The iterator is moved back to the first polynomial only if the time
+    // instants are not sorted.
+    auto poly = m_pimpl->polynomials.cbegin();
+    for (Eigen::Index i = 0; i < numberOfInstants; i++)
+    {
+        const std::chrono::nanoseconds& t = time[i];
+
+        if (t < m_pimpl->polynomials.front().initialPoint->timeInstant)
+        {
+            constexpr std::chrono::nanoseconds initialTime = std::chrono::nanoseconds::zero();
+
+            m_pimpl->getPositionAtTime(initialTime, m_pimpl->polynomials.front(), position.col(i));
+            m_pimpl->getVelocityAtTime(initialTime, m_pimpl->polynomials.front(), velocity.col(i));
+            m_pimpl->getAccelerationAtTime(initialTime,
+                                           m_pimpl->polynomials.front(),
+                                           acceleration.col(i));
+
+            continue;
+        }
+
+        if (t >= m_pimpl->polynomials.back().finalPoint->timeInstant)
+        {
+            const auto finalTime = m_pimpl->polynomials.back().finalPoint->timeInstant
+                                   - m_pimpl->polynomials.back().initialPoint->timeInstant;
+            m_pimpl->getPositionAtTime(finalTime, m_pimpl->polynomials.back(), position.col(i));
+            m_pimpl->getVelocityAtTime(finalTime, m_pimpl->polynomials.back(), velocity.col(i));
+            m_pimpl->getAccelerationAtTime(finalTime,
+                                           m_pimpl->polynomials.back(),
+                                           acceleration.col(i));
+
+            continue;
+        }
+
+        if (t < poly->initialPoint->timeInstant)
+        {
+            poly = m_pimpl->polynomials.cbegin();
+        }
+
+        while (t >= poly->finalPoint->timeInstant)
+        {
+            poly++;
+        }
+
+        m_pimpl->getPositionAtTime(t - poly->initialPoint->timeInstant, *poly, position.col(i));
+        m_pimpl->getVelocityAtTime(t - poly->initialPoint->timeInstant, *poly, velocity.col(i));
+        m_pimpl->getAccelerationAtTime(t - poly->initialPoint->timeInstant,
+                                       *poly,
+                                       acceleration.col(i));
+    }
+
+    return true;
+}
+
 bool CubicSpline::isOutputValid() const
 {
     // if the time step is different from zero and the user already set the knots the advance
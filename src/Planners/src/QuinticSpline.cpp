@@ -6,10 +6,12 @@
  */
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <iostream>
+#include <vector>
 
-#include <Eigen/Sparse>
+#include <Eigen/Dense>
 
 #include <BipedalLocomotion/Planners/QuinticSpline.h>
 using namespace BipedalLocomotion::Planners;
@@ -44,18 +46,12 @@ struct QuinticSpline::Impl
     };
 
     /**
-     * Description of a 5-th polynomial. It contains the coefficients, the initial/final knots and
-     * the duration of the sub-trajectory.
+     * Description of a 5-th polynomial. It contains the initial/final knots and the duration of
+     * the sub-trajectory. The coefficients are stored in the structure-of-arrays container owned
+     * by the Impl.
      */
     struct Polynomial
     {
-        Eigen::VectorXd a0;
-        Eigen::VectorXd a1;
-        Eigen::VectorXd a2;
-        Eigen::VectorXd a3;
-        Eigen::VectorXd a4;
-        Eigen::VectorXd a5;
-
         const Knot* initialPoint;
         const Knot* finalPoint;
 
@@ -68,6 +64,13 @@ struct QuinticSpline::Impl
     std::vector<Knot> knots; /**< Collection of all the knots */
     std::vector<Polynomial> polynomials; /**< Collection of all the polynomials */
 
+    /** Polynomial coefficients stored as structure-of-arrays: coefficients[k] is a (dimension x
+     * number of polynomials) matrix whose p-th column contains the k-th order coefficient of the
+     * p-th polynomial. The coefficients of one polynomial are contiguous columns allocated by
+     * Eigen (hence aligned), so the evaluation of a sub-trajectory vectorizes across the
+     * dimensions. */
+    std::array<Eigen::MatrixXd, 6> coefficients;
+
     bool areCoefficientsComputed{false}; /**< If true the coefficients are computed and updated */
 
     SplineState currentTrajectory; /**< Current trajectory stored in the advance state */
@@ -118,30 +121,22 @@ struct QuinticSpline::Impl
     bool setBoundaryVelocitiesAndAcceleration();
 
     /**
-     * addTripletCurrentKnot is a helper function to generate a triplet containing a 2x2 matrix.
-     * This matrix is used to compute the intermediate velocity and acceleration.
+     * currentKnotBlock is a helper function to generate the 2x2 diagonal block associated to a
+     * knot. This matrix is used to compute the intermediate velocity and acceleration.
      */
-    void addTripletCurrentKnot(const int& knotIndex,
-                               const int& rowOffset,
-                               const int& columnOffset,
-                               std::vector<Eigen::Triplet<double>>& tripletList);
+    Eigen::Matrix2d currentKnotBlock(const int& knotIndex) const;
 
     /**
-     * addTripletPreviousKnot is a helper function to generate a triplet containing a 2x2 matrix.
-     * This matrix is used to compute the intermediate velocity and acceleration.
+     * previousKnotBlock is a helper function to generate the 2x2 sub-diagonal block associated to
+     * a knot. This matrix is used to compute the intermediate velocity and acceleration.
      */
-    void addTripletPreviousKnot(const int& knotIndex,
-                                const int& rowOffset,
-                                const int& columnOffset,
-                                std::vector<Eigen::Triplet<double>>& tripletList);
+    Eigen::Matrix2d previousKnotBlock(const int& knotIndex) const;
+
     /**
-     * addTripletNextKnot is a helper function to generate a triplet containing a 2x2 matrix.
-     * This matrix is used to compute the intermediate velocity and acceleration.
+     * nextKnotBlock is a helper function to generate the 2x2 super-diagonal block associated to a
+     * knot. This matrix is used to compute the intermediate velocity and acceleration.
      */
-    void addTripletNextKnot(const int& knotIndex,
-                            const int& rowOffset,
-                            const int& columnOffset,
-                            std::vector<Eigen::Triplet<double>>& tripletList);
+    Eigen::Matrix2d nextKnotBlock(const int& knotIndex) const;
 
     /**
      * addKnownTermKnotPosition is a helper function to generate a 2-d vector,
@@ -296,6 +291,33 @@ bool QuinticSpline::setKnots(const std::vector<Eigen::VectorXd>& position,
     return true;
 }
 
+bool QuinticSpline::updateLastKnot(Eigen::Ref<const Eigen::VectorXd> position)
+{
+    if (m_pimpl->knots.empty())
+    {
+        std::cerr << "[QuinticSpline::updateLastKnot] Please set the knots before updating the "
+                     "last one."
+                  << std::endl;
+        return false;
+    }
+
+    if (position.size() != m_pimpl->knots.back().position.size())
+    {
+        std::cerr << "[QuinticSpline::updateLastKnot] The size of the position is different from "
+                     "the one expected. Expected: "
+                  << m_pimpl->knots.back().position.size() << " Retrieved: " << position.size()
+                  << "." << std::endl;
+        return false;
+    }
+
+    m_pimpl->knots.back().position = position;
+
+    // Only the position of the last knot changed. The coefficients are outdated.
+    m_pimpl->areCoefficientsComputed = false;
+
+    return true;
+}
+
 void QuinticSpline::Impl::resetKnot(const std::chrono::nanoseconds& timeInstant,
                                     Eigen::Ref<const Eigen::VectorXd> position,
                                     Knot& knot)
@@ -371,7 +393,14 @@ bool QuinticSpline::Impl::computeCoefficients()
         this->computeIntermediateVelocitiesAndAcceleration();
     }
 
-    // populate the coefficients of each polynomial
+    // allocate the structure-of-arrays coefficient storage and populate the coefficients of each
+    // polynomial
+    const Eigen::Index knotSize = knots.front().position.size();
+    for (auto& coefficient : coefficients)
+    {
+        coefficient.resize(knotSize, polynomials.size());
+    }
+
     for (auto& poly : polynomials)
     {
         this->setPolynomialCoefficients(poly);
@@ -437,10 +466,7 @@ bool QuinticSpline::Impl::setBoundaryVelocitiesAndAcceleration()
     return true;
 }
 
-void QuinticSpline::Impl::addTripletCurrentKnot(const int& knotIndex,
-                                                const int& rowOffset,
-                                                const int& columnOffset,
-                                                std::vector<Eigen::Triplet<double>>& tripletList)
+Eigen::Matrix2d QuinticSpline::Impl::currentKnotBlock(const int& knotIndex) const
 {
     const auto& poly = polynomials[knotIndex];
     const auto& prevPoly = polynomials[knotIndex - 1];
@@ -448,7 +474,7 @@ void QuinticSpline::Impl::addTripletCurrentKnot(const int& knotIndex,
     const double prevPolyDuration = durationToSeconds(prevPoly.duration);
     const double polyDuration = durationToSeconds(poly.duration);
 
-    // The following triplets represent this matrix
+    // The following block represents this matrix
     // /    /   1      1\          /   1      1\ \
     // | 12 |------ - --|      -3  |------ + --| |
     // |    | 2        2|          |T        T | |
@@ -462,34 +488,21 @@ void QuinticSpline::Impl::addTripletCurrentKnot(const int& knotIndex,
     // |    |T        T |         |T    T     |  |
     // \    \ i - 1    i/         \ i    i - 1/  /
 
-    tripletList.push_back(
-        {rowOffset,
-         columnOffset,
-         12 * ((1 / std::pow(prevPolyDuration, 2)) - (1 / std::pow(polyDuration, 2)))});
+    Eigen::Matrix2d block;
+    block(0, 0) = 12 * ((1 / std::pow(prevPolyDuration, 2)) - (1 / std::pow(polyDuration, 2)));
+    block(0, 1) = -3 * ((1 / prevPolyDuration) + (1 / polyDuration));
+    block(1, 0) = 16 * ((1 / std::pow(prevPolyDuration, 3)) + (1 / std::pow(polyDuration, 3)));
+    block(1, 1) = 3 * ((-1 / std::pow(prevPolyDuration, 2)) + (1 / std::pow(polyDuration, 2)));
 
-    tripletList.push_back(
-        {rowOffset, columnOffset + 1, -3 * ((1 / prevPolyDuration) + (1 / polyDuration))});
-
-    tripletList.push_back(
-        {rowOffset + 1,
-         columnOffset,
-         16 * ((1 / std::pow(prevPolyDuration, 3)) + (1 / std::pow(polyDuration, 3)))});
-
-    tripletList.push_back(
-        {rowOffset + 1,
-         columnOffset + 1,
-         3 * ((-1 / std::pow(prevPolyDuration, 2)) + (1 / std::pow(polyDuration, 2)))});
+    return block;
 }
 
-void QuinticSpline::Impl::addTripletPreviousKnot(const int& knotIndex,
-                                                 const int& rowOffset,
-                                                 const int& columnOffset,
-                                                 std::vector<Eigen::Triplet<double>>& tripletList)
+Eigen::Matrix2d QuinticSpline::Impl::previousKnotBlock(const int& knotIndex) const
 {
     const auto& poly = polynomials[knotIndex - 1];
     const double polyDuration = durationToSeconds(poly.duration);
 
-    // The following triplets represent this matrix
+    // The following block represents this matrix
     // /    8          1    \
     // | ------     ------  |
     // |  2                 |
@@ -503,21 +516,21 @@ void QuinticSpline::Impl::addTripletPreviousKnot(const int& knotIndex,
     // | T          T       |
     // \  i - 1      i - 1  /
 
-    tripletList.push_back({rowOffset, columnOffset, 8 / std::pow(polyDuration, 2)});
-    tripletList.push_back({rowOffset, columnOffset + 1, 1 / polyDuration});
-    tripletList.push_back({rowOffset + 1, columnOffset, 14 / std::pow(polyDuration, 3)});
-    tripletList.push_back({rowOffset + 1, columnOffset + 1, 2 / std::pow(polyDuration, 2)});
+    Eigen::Matrix2d block;
+    block(0, 0) = 8 / std::pow(polyDuration, 2);
+    block(0, 1) = 1 / polyDuration;
+    block(1, 0) = 14 / std::pow(polyDuration, 3);
+    block(1, 1) = 2 / std::pow(polyDuration, 2);
+
+    return block;
 }
 
-void QuinticSpline::Impl::addTripletNextKnot(const int& knotIndex,
-                                             const int& rowOffset,
-                                             const int& columnOffset,
-                                             std::vector<Eigen::Triplet<double>>& tripletList)
+Eigen::Matrix2d QuinticSpline::Impl::nextKnotBlock(const int& knotIndex) const
 {
     const auto& poly = polynomials[knotIndex];
     const double polyDuration = durationToSeconds(poly.duration);
 
-    // The following triplets represent this matrix
+    // The following block represents this matrix
     // /    8          1    \
     // | - ---        ---   |
     // |    2               |
@@ -531,10 +544,13 @@ void QuinticSpline::Impl::addTripletNextKnot(const int& knotIndex,
     // |  T            T    |
     // \   i            i   /
 
-    tripletList.push_back({rowOffset, columnOffset, -8 / std::pow(polyDuration, 2)});
-    tripletList.push_back({rowOffset, columnOffset + 1, 1 / polyDuration});
-    tripletList.push_back({rowOffset + 1, columnOffset, 14 / std::pow(polyDuration, 3)});
-    tripletList.push_back({rowOffset + 1, columnOffset + 1, -2 / std::pow(polyDuration, 2)});
+    Eigen::Matrix2d block;
+    block(0, 0) = -8 / std::pow(polyDuration, 2);
+    block(0, 1) = 1 / polyDuration;
+    block(1, 0) = 14 / std::pow(polyDuration, 3);
+    block(1, 1) = -2 / std::pow(polyDuration, 2);
+
+    return block;
 }
 
 void QuinticSpline::Impl::addKnownTermKnotPosition(const std::size_t& knotIndex,
@@ -603,6 +619,10 @@ void QuinticSpline::Impl::setPolynomialCoefficients(Polynomial& poly)
 {
     const double T = durationToSeconds(poly.duration);
 
+    // the coefficients are stored in the column of the structure-of-arrays container associated
+    // to the polynomial
+    const std::size_t index = &poly - polynomials.data();
+
     const auto& x0 = poly.initialPoint->position;
     const auto& dx0 = poly.initialPoint->velocity;
     const auto& ddx0 = poly.initialPoint->acceleration;
@@ -611,21 +631,24 @@ void QuinticSpline::Impl::setPolynomialCoefficients(Polynomial& poly)
     const auto& dxT = poly.finalPoint->velocity;
     const auto& ddxT = poly.finalPoint->acceleration;
 
-    poly.a0 = x0;
-    poly.a1 = dx0;
-    poly.a2 = ddx0 / 2.0;
-    poly.a3 = 1.0 / (T * T * T)
-              * (x0 * 2.0E+1 - xT * 2.0E+1 + T * dx0 * 1.2E+1 + T * dxT * 8.0 + (T * T) * ddx0 * 3.0
-                 - (T * T) * ddxT)
-              * (-1.0 / 2.0);
-    poly.a4 = (1.0 / (T * T * T * T)
-               * (x0 * 3.0E+1 - xT * 3.0E+1 + T * dx0 * 1.6E+1 + T * dxT * 1.4E+1
-                  + (T * T) * ddx0 * 3.0 - (T * T) * ddxT * 2.0))
-              / 2.0;
-    poly.a5 = 1.0 / (T * T * T * T * T)
-              * (x0 * 1.2E+1 - xT * 1.2E+1 + T * dx0 * 6.0 + T * dxT * 6.0 + (T * T) * ddx0
-                 - (T * T) * ddxT)
-              * (-1.0 / 2.0);
+    coefficients[0].col(index) = x0;
+    coefficients[1].col(index) = dx0;
+    coefficients[2].col(index) = ddx0 / 2.0;
+    coefficients[3].col(index)
+        = 1.0 / (T * T * T)
+          * (x0 * 2.0E+1 - xT * 2.0E+1 + T * dx0 * 1.2E+1 + T * dxT * 8.0 + (T * T) * ddx0 * 3.0
+             - (T * T) * ddxT)
+          * (-1.0 / 2.0);
+    coefficients[4].col(index)
+        = (1.0 / (T * T * T * T)
+           * (x0 * 3.0E+1 - xT * 3.0E+1 + T * dx0 * 1.6E+1 + T * dxT * 1.4E+1
+              + (T * T) * ddx0 * 3.0 - (T * T) * ddxT * 2.0))
+          / 2.0;
+    coefficients[5].col(index)
+        = 1.0 / (T * T * T * T * T)
+          * (x0 * 1.2E+1 - xT * 1.2E+1 + T * dx0 * 6.0 + T * dxT * 6.0 + (T * T) * ddx0
+             - (T * T) * ddxT)
+          * (-1.0 / 2.0);
 }
 
 void QuinticSpline::Impl::computeIntermediateVelocitiesAndAcceleration()
@@ -633,9 +656,6 @@ void QuinticSpline::Impl::computeIntermediateVelocitiesAndAcceleration()
     // here we assume that at least 3 points has been defined
     const std::size_t numberOfInteriorKnots = knots.size() - 2;
 
-    Eigen::SparseMatrix<double> A(2 * numberOfInteriorKnots, 2 * numberOfInteriorKnots);
-    std::vector<Eigen::Triplet<double>> tripletsList;
-
     // Given a set of interior points the we can define a matrix A as
     //                          __                                        __
     //                         | x x x x 0 0 0 0 0 0 0 0 ... 0 0 0 0 0 0 0 |
@@ -655,52 +675,38 @@ void QuinticSpline::Impl::computeIntermediateVelocitiesAndAcceleration()
     //                         | 0 0 0 0 0 0 0 0 0 0 0 0 ... 0 0 x x x x x |
     //                         |__                                       __|
     //
-    // where x represents a non zero number and 0 represents the number 0. The matrix A can be
-    // stored as a sparse matrix where the number of non zero entries for the extremum elements are
-    // 4 * 2 and the number of non zero elements for the interior (non extremum elements) are 6
-    // * 2. The matrix A is a square matrix whose number of columns (and rows) is equal to the
-    // number of interior knots of the spline times 2. If there is only an interior knot, A is a 2x2
-    // dense matrix.
-    std::size_t numberOfExpectedTriplets = 4;
-    if (numberOfInteriorKnots > 1)
-    {
-        constexpr std::size_t numberOfExtremumElements = 4;
-        constexpr std::size_t numberOfNonExtremumElements = 6;
-        constexpr std::size_t numberOfExtremum = 2;
-        numberOfExpectedTriplets = 2 * (numberOfNonExtremumElements * (numberOfInteriorKnots
-                                                                       - numberOfExtremum)
-                                        + numberOfExtremum * numberOfExtremumElements);
-    }
-    tripletsList.reserve(numberOfExpectedTriplets);
-
-    for (int i = 0; i < numberOfInteriorKnots; i++)
+    // where x represents a non zero number and 0 represents the number 0. The matrix A is block
+    // tridiagonal with 2x2 blocks: the diagonal blocks are associated to the current knot, the
+    // sub-diagonal blocks to the previous knot and the super-diagonal blocks to the next knot.
+    // The matrix A is a square matrix whose number of columns (and rows) is equal to the number of
+    // interior knots of the spline times 2. If there is only an interior knot, A is a 2x2 dense
+    // matrix.
+    //
+    // The system is solved with a block Thomas algorithm. The factorization of A is computed once
+    // and shared among all the coordinates of the knots, so solving for each coordinate reduces
+    // to a forward and a backward substitution whose cost is linear in the number of interior
+    // knots.
+    std::vector<Eigen::Matrix2d> invModifiedDiagonal(numberOfInteriorKnots);
+    std::vector<Eigen::Matrix2d> lowerFactor(numberOfInteriorKnots);
+    std::vector<Eigen::Matrix2d> upperBlock(numberOfInteriorKnots);
+
+    invModifiedDiagonal[0] = this->currentKnotBlock(1).inverse();
+    for (std::size_t i = 1; i < numberOfInteriorKnots; i++)
     {
         const int absoluteKnotIndex = i + 1;
 
-        // in this case there is only one interior knot A will be a 2
-        if (i == 0 && (i + 1) == numberOfInteriorKnots)
-        {
-            this->addTripletCurrentKnot(absoluteKnotIndex, 0, 0, tripletsList);
-        } else if (i == 0)
-        {
-            this->addTripletCurrentKnot(absoluteKnotIndex, i * 2, 0, tripletsList);
-            this->addTripletNextKnot(absoluteKnotIndex, i * 2, 2, tripletsList);
-        } else if (i + 1 == numberOfInteriorKnots)
-        {
-            this->addTripletPreviousKnot(absoluteKnotIndex, i * 2, 2 * (i - 1), tripletsList);
-            this->addTripletCurrentKnot(absoluteKnotIndex, i * 2, 2 * (i - 1) + 2, tripletsList);
-        } else
-        {
-            this->addTripletPreviousKnot(absoluteKnotIndex, i * 2, 2 * (i - 1), tripletsList);
-            this->addTripletCurrentKnot(absoluteKnotIndex, i * 2, 2 * (i - 1) + 2, tripletsList);
-            this->addTripletNextKnot(absoluteKnotIndex, i * 2, 2 * (i - 1) + 2 + 2, tripletsList);
-        }
-    }
+        upperBlock[i - 1] = this->nextKnotBlock(absoluteKnotIndex - 1);
+        lowerFactor[i].noalias() = this->previousKnotBlock(absoluteKnotIndex) //
+                                   * invModifiedDiagonal[i - 1];
 
-    A.setFromTriplets(tripletsList.begin(), tripletsList.end());
+        const Eigen::Matrix2d modifiedDiagonal
+            = this->currentKnotBlock(absoluteKnotIndex) - lowerFactor[i] * upperBlock[i - 1];
+        invModifiedDiagonal[i] = modifiedDiagonal.inverse();
+    }
 
-    // compute first coordinate
-    Eigen::VectorXd b(A.rows());
+    // compute the solution for each coordinate
+    Eigen::VectorXd b(2 * numberOfInteriorKnots);
+    Eigen::Vector2d temp;
     for (size_t j = 0; j < knots.front().position.size(); j++)
     {
         b.setZero();
@@ -731,18 +737,32 @@ void QuinticSpline::Impl::computeIntermediateVelocitiesAndAcceleration()
             }
         }
 
-        Eigen::SparseQR<Eigen::SparseMatrix<double>,
-                        Eigen::COLAMDOrdering<Eigen::SparseMatrix<double>::StorageIndex>>
-            qrDecomposition;
-        qrDecomposition.compute(A);
-        Eigen::VectorXd solution = qrDecomposition.solve(b);
+        // forward substitution
+        for (size_t i = 1; i < numberOfInteriorKnots; i++)
+        {
+            temp.noalias() = lowerFactor[i] * b.segment<2>((i - 1) * 2);
+            b.segment<2>(i * 2) -= temp;
+        }
+
+        // backward substitution. The vector b is overwritten with the solution of the system
+        temp.noalias() = invModifiedDiagonal[numberOfInteriorKnots - 1]
+                         * b.segment<2>((numberOfInteriorKnots - 1) * 2);
+        b.segment<2>((numberOfInteriorKnots - 1) * 2) = temp;
+        for (std::ptrdiff_t i = static_cast<std::ptrdiff_t>(numberOfInteriorKnots) - 2; i >= 0; i--)
+        {
+            temp.noalias() = upperBlock[i] * b.segment<2>((i + 1) * 2);
+            b.segment<2>(i * 2) -= temp;
+
+            temp.noalias() = invModifiedDiagonal[i] * b.segment<2>(i * 2);
+            b.segment<2>(i * 2) = temp;
+        }
 
         for (size_t i = 0; i < numberOfInteriorKnots; i++)
         {
             const int absoluteKnotIndex = i + 1;
 
-            knots[absoluteKnotIndex].velocity[j] = solution[i * 2];
-            knots[absoluteKnotIndex].acceleration[j] = solution[i * 2 + 1];
+            knots[absoluteKnotIndex].velocity[j] = b[i * 2];
+            knots[absoluteKnotIndex].acceleration[j] = b[i * 2 + 1];
         }
     }
 }
@@ -751,66 +771,47 @@ void QuinticSpline::Impl::getPositionAtTime(const std::chrono::nanoseconds& t,
                                             const Polynomial& poly,
                                             Eigen::Ref<Eigen::VectorXd> position)
 {
-    // improve the readability of the code
-
     const double tS = durationToSeconds(t);
+    const std::size_t index = &poly - polynomials.data();
 
-    const auto& a0 = poly.a0;
-    const auto& a1 = poly.a1;
-    const auto& a2 = poly.a2;
-    const auto& a3 = poly.a3;
-    const auto& a4 = poly.a4;
-    const auto& a5 = poly.a5;
-
-    position = a0
-             + a1 * tS
-             + a2 * std::pow(tS, 2)
-             + a3 * std::pow(tS, 3)
-             + a4 * std::pow(tS, 4)
-             + a5 * std::pow(tS, 5);
+    // Horner evaluation on the contiguous coefficient columns. Every operation acts on the whole
+    // column, so the loop vectorizes across the dimensions of the spline.
+    position = coefficients[5].col(index);
+    for (int k = 4; k >= 0; k--)
+    {
+        position *= tS;
+        position += coefficients[k].col(index);
+    }
 }
 
 void QuinticSpline::Impl::getVelocityAtTime(const std::chrono::nanoseconds& t,
                                             const Polynomial& poly,
                                             Eigen::Ref<Eigen::VectorXd> velocity)
 {
-    // improve the readability of the code
-
     const double tS = durationToSeconds(t);
+    const std::size_t index = &poly - polynomials.data();
 
-    const auto& a0 = poly.a0;
-    const auto& a1 = poly.a1;
-    const auto& a2 = poly.a2;
-    const auto& a3 = poly.a3;
-    const auto& a4 = poly.a4;
-    const auto& a5 = poly.a5;
-
-    velocity = a1
-             + 2 * a2 * tS
-             + 3 * a3 * std::pow(tS, 2)
-             + 4 * a4 * std::pow(tS, 3)
-             + 5 * a5 * std::pow(tS, 4);
+    velocity = 5.0 * coefficients[5].col(index);
+    for (int k = 4; k >= 1; k--)
+    {
+        velocity *= tS;
+        velocity += k * coefficients[k].col(index);
+    }
 }
 
 void QuinticSpline::Impl::getAccelerationAtTime(const std::chrono::nanoseconds& t,
                                                 const Polynomial& poly,
                                                 Eigen::Ref<Eigen::VectorXd> acceleration)
 {
-    // improve the readability of the code
-
     const double tS = durationToSeconds(t);
+    const std::size_t index = &poly - polynomials.data();
 
-    const auto& a0 = poly.a0;
-    const auto& a1 = poly.a1;
-    const auto& a2 = poly.a2;
-    const auto& a3 = poly.a3;
-    const auto& a4 = poly.a4;
-    const auto& a5 = poly.a5;
-
-    acceleration = 2 * a2
-                 + 2 * 3 * a3 * tS
-                 + 3 * 4 * a4 * std::pow(tS, 2)
-                 + 4 * 5 * a5 * std::pow(tS, 3);
+    acceleration = (5 * 4) * coefficients[5].col(index);
+    for (int k = 4; k >= 2; k--)
+    {
+        acceleration *= tS;
+        acceleration += (k * (k - 1)) * coefficients[k].col(index);
+    }
 }
 
 bool QuinticSpline::evaluatePoint(const std::chrono::nanoseconds& t,
@@ -875,6 +876,81 @@ bool QuinticSpline::evaluatePoint(const std::chrono::nanoseconds& t, SplineState
     return this->evaluatePoint(t, state.position, state.velocity, state.acceleration);
 }
 
+bool QuinticSpline::evaluatePoints(const std::vector<std::chrono::nanoseconds>& time,
+                                   Eigen::Ref<Eigen::MatrixXd> position,
+                                   Eigen::Ref<Eigen::MatrixXd> velocity,
+                                   Eigen::Ref<Eigen::MatrixXd> acceleration)
+{
+    if (!m_pimpl->areCoefficientsComputed)
+    {
+        if (!m_pimpl->computeCoefficients())
+        {
+            std::cerr << "[QuinticSpline::evaluatePoints] Unable to compute the coefficients of "
+                         "the spline."
+                      << std::endl;
+            return false;
+        }
+    }
+
+    const Eigen::Index knotSize = m_pimpl->knots.front().position.size();
+    const Eigen::Index numberOfInstants = static_cast<Eigen::Index>(time.size());
+    if (position.rows() != knotSize || position.cols() != numberOfInstants
+        || velocity.rows() != knotSize || velocity.cols() != numberOfInstants
+        || acceleration.rows() != knotSize || acceleration.cols() != numberOfInstants)
+    {
+        std::cerr << "[QuinticSpline::evaluatePoints] The output matrices should have a column "
+                     "for each time instant and a row for each coordinate of the knots. Expected "
+                     "size: "
+                  << knotSize << " x " << numberOfInstants << "." << std::endl;
+        return false;
+    }
+
+    // the polynomials are walked monotonically, so sampling an entire trajectory costs a single
+    // pass over the knots. The iterator is moved back to the first polynomial only if the time
+    // instants are not sorted.
+    auto poly = m_pimpl->polynomials.cbegin();
+    for (Eigen::Index i = 0; i < numberOfInstants; i++)
+    {
+        const std::chrono::nanoseconds& t = time[i];
+
+        if (t < m_pimpl->polynomials.front().initialPoint->timeInstant)
+        {
+            position.col(i) = m_pimpl->knots.front().position;
+            velocity.col(i) = m_pimpl->knots.front().velocity;
+            acceleration.col(i) = m_pimpl->knots.front().acceleration;
+
+            continue;
+        }
+
+        if (t >= m_pimpl->polynomials.back().finalPoint->timeInstant)
+        {
+            position.col(i) = m_pimpl->knots.back().position;
+            velocity.col(i) = m_pimpl->knots.back().velocity;
+            acceleration.col(i) = m_pimpl->knots.back().acceleration;
+
+            continue;
+        }
+
+        if (t < poly->initialPoint->timeInstant)
+        {
+            poly = m_pimpl->polynomials.cbegin();
+        }
+
+        while (t >= poly->finalPoint->timeInstant)
+        {
+            poly++;
+        }
+
+        m_pimpl->getPositionAtTime(t - poly->initialPoint->timeInstant, *poly, position.col(i));
+        m_pimpl->getVelocityAtTime(t - poly->initialPoint->timeInstant, *poly, velocity.col(i));
+        m_pimpl->getAccelerationAtTime(t - poly->initialPoint->timeInstant,
+                                       *poly,
+                                       acceleration.col(i));
+    }
+
+    return true;
+}
+
 bool QuinticSpline::isOutputValid() const
 {
     // if the time step is different from zero and the user already set the knots the advance
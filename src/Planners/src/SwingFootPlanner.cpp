@@ -11,6 +11,7 @@
 #include <BipedalLocomotion/Planners/SwingFootPlanner.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iterator>
 
@@ -77,6 +78,11 @@ bool SwingFootPlanner::initialize(std::weak_ptr<const IParametersHandler> handle
                     m_footLandingAcceleration);
     }
 
+    if (!ptr->getParameter("use_trajectory_table", m_useTrajectoryTable))
+    {
+        log()->info("{} Using default use_trajectory_table={}.", logPrefix, m_useTrajectoryTable);
+    }
+
     // check the parameters passed to the planner
     const bool ok = (m_dT > std::chrono::nanoseconds::zero())
                     && ((m_footApexTime > 0) && (m_footApexTime < 1));
@@ -222,15 +228,41 @@ bool SwingFootPlanner::setContactList(const ContactList& contactList)
             return false;
         }
 
+        // if the next contact changed only in its position, the trajectory can be retargeted
+        // incrementally: the boundary conditions at the current time instant are kept fixed and
+        // only the terminal constraint of the position splines is moved. The SO(3) trajectory does
+        // not need to be recomputed since the final orientation and the timings are unchanged.
+        const bool onlyPositionChanged
+            = (newNextContactAtCurrentTime->pose.quat().coeffs()
+               == nextContactAtCurrentTime->pose.quat().coeffs())
+              && (newNextContactAtCurrentTime->activationTime
+                  == nextContactAtCurrentTime->activationTime);
+
         // update the contact list and the pointer
         m_contactList = contactList;
         m_currentContactPtr = m_contactList.getPresentContact(m_currentTrajectoryTime);
-        if (!this->createSE3Traj(m_state.mixedVelocity.lin().head<2>(),
-                                 m_state.mixedAcceleration.lin().head<2>(),
-                                 m_state.mixedVelocity.lin().tail<1>(),
-                                 m_state.mixedAcceleration.lin().tail<1>(),
-                                 m_state.mixedVelocity.ang(),
-                                 m_state.mixedAcceleration.ang()))
+
+        // the precomputed samples no longer describe the ongoing swing. From now on the splines
+        // are evaluated at every tick
+        m_isTableValid = false;
+
+        if (onlyPositionChanged)
+        {
+            const auto nextContactPtr = std::next(m_currentContactPtr, 1);
+            if (!m_planarPlanner->updateLastKnot(nextContactPtr->pose.translation().head<2>())
+                || !m_heightPlanner->updateLastKnot(nextContactPtr->pose.translation().tail<1>()))
+            {
+                log()->error("{} Unable to update the terminal constraint of the position "
+                             "splines.",
+                             logPrefix);
+                return false;
+            }
+        } else if (!this->createSE3Traj(m_state.mixedVelocity.lin().head<2>(),
+                                        m_state.mixedAcceleration.lin().head<2>(),
+                                        m_state.mixedVelocity.lin().tail<1>(),
+                                        m_state.mixedAcceleration.lin().tail<1>(),
+                                        m_state.mixedVelocity.ang(),
+                                        m_state.mixedAcceleration.ang()))
         {
             log()->error("{} Unable to create the new SE(3) trajectory.", logPrefix);
             return false;
@@ -410,6 +442,54 @@ bool SwingFootPlanner::updateSE3Traj()
     return true;
 }
 
+bool SwingFootPlanner::populateTrajectoryTable()
+{
+    constexpr auto logPrefix = "[SwingFootPlanner::populateTrajectoryTable]";
+
+    m_isTableValid = false;
+
+    const auto nextContactPtr = std::next(m_currentContactPtr, 1);
+    if (nextContactPtr == m_contactList.cend())
+    {
+        log()->error("{} Invalid next contact. Time {}.", logPrefix, m_currentTrajectoryTime);
+        return false;
+    }
+
+    // when no adaptation occurs the whole swing is determined at take off, so the splines and the
+    // SO(3) planner are sampled once here and advance() reads the table until a retarget occurs
+    const auto savedState = m_state;
+    const auto savedTime = m_currentTrajectoryTime;
+
+    m_tableStartTime = savedTime;
+    const std::size_t samples
+        = (nextContactPtr->activationTime - m_tableStartTime) / m_dT + 1;
+
+    m_trajectoryTable.clear();
+    m_trajectoryTable.reserve(samples);
+
+    for (std::size_t i = 0; i < samples; i++)
+    {
+        m_currentTrajectoryTime = m_tableStartTime + i * m_dT;
+        if (!this->updateSE3Traj())
+        {
+            log()->error("{} Unable to sample the SE(3) trajectory at time t = {}.",
+                         logPrefix,
+                         m_currentTrajectoryTime);
+            m_state = savedState;
+            m_currentTrajectoryTime = savedTime;
+            m_trajectoryTable.clear();
+            return false;
+        }
+        m_trajectoryTable.push_back(m_state);
+    }
+
+    m_state = savedState;
+    m_currentTrajectoryTime = savedTime;
+    m_isTableValid = true;
+
+    return true;
+}
+
 bool SwingFootPlanner::advance()
 {
     constexpr auto logPrefix = "[SwingFootPlanner::advance]";
@@ -480,7 +560,17 @@ bool SwingFootPlanner::advance()
             return false;
         }
 
-        if (!this->updateSE3Traj())
+        if (m_useTrajectoryTable && !this->populateTrajectoryTable())
+        {
+            log()->warn("{} Unable to precompute the swing trajectory table. The splines will be "
+                        "evaluated at every tick.",
+                        logPrefix);
+        }
+
+        if (m_isTableValid)
+        {
+            m_state = m_trajectoryTable.front();
+        } else if (!this->updateSE3Traj())
         {
             log()->error("{} Unable to update the SE(3) trajectory.", logPrefix);
             return false;
@@ -494,7 +584,15 @@ bool SwingFootPlanner::advance()
     if (!m_state.isInContact && m_currentTrajectoryTime > m_currentContactPtr->deactivationTime
         && m_currentTrajectoryTime <= std::next(m_currentContactPtr, 1)->activationTime)
     {
-        if (!this->updateSE3Traj())
+        if (m_isTableValid)
+        {
+            // steady-state tick: the state is read from the precomputed table
+            const std::size_t index
+                = std::min(static_cast<std::size_t>((m_currentTrajectoryTime - m_tableStartTime)
+                                                    / m_dT),
+                           m_trajectoryTable.size() - 1);
+            m_state = m_trajectoryTable[index];
+        } else if (!this->updateSE3Traj())
         {
             log()->error("{} Unable to update the SE(3) trajectory.", logPrefix);
             return false;
@@ -514,6 +612,7 @@ bool SwingFootPlanner::advance()
         m_state.mixedVelocity.setZero();
         m_state.mixedAcceleration.setZero();
         m_state.isInContact = true;
+        m_isTableValid = false;
 
         m_isOutputValid = true;
         return true;
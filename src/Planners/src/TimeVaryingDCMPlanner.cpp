@@ -7,12 +7,16 @@
 
 #include <casadi/casadi.hpp>
 
+#include <BipedalLocomotion/Conversions/CasadiConversions.h>
 #include <BipedalLocomotion/Math/Constants.h>
 #include <BipedalLocomotion/Planners/ConvexHullHelper.h>
 #include <BipedalLocomotion/Planners/QuinticSpline.h>
 #include <BipedalLocomotion/Planners/TimeVaryingDCMPlanner.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
+#include <algorithm>
 #include <chrono>
+#include <mutex>
+#include <unordered_map>
 
 using namespace BipedalLocomotion::Planners;
 using namespace BipedalLocomotion::Contacts;
@@ -89,7 +93,9 @@ struct TimeVaryingDCMPlanner::Impl
     struct OptimizationSolution
     {
         std::unique_ptr<casadi::OptiSol> solution; /**< Pointer to the solution of the optimization
-                                                      problem */
+                                                      problem. It is released as soon as the
+                                                      optimal trajectories are extracted to avoid
+                                                      keeping the whole NLP in memory */
         casadi::DM dcm; /**< Optimal DCM trajectory */
         casadi::DM omega; /**< Optimal omega trajectory */
         casadi::DM vrp; /**< Optimal VRP trajectory */
@@ -125,6 +131,13 @@ struct TimeVaryingDCMPlanner::Impl
         bool useExternalDCMReference{false}; /**< If true an external DCM reference is expected by
                                                 the planner */
 
+        bool warmStart{false}; /**< If true the solver is warm started with the time-shifted
+                                  solution of the previous solve */
+
+        bool useFunctionCache{false}; /**< If true the CasADi functions are shared among the
+                                         planner instances having the same sampling time and
+                                         gravity */
+
         double gravity{BipedalLocomotion::Math::StandardAccelerationOfGravitation}; /**< Gravity */
     };
     OptimizationSettings optiSettings; /**< Settings */
@@ -137,6 +150,12 @@ struct TimeVaryingDCMPlanner::Impl
 
     InitialValue initialValue; /**< Initial value for the optimizer */
 
+    bool hasPreviousSolution{false}; /**< True if optiSolution contains the result of a previous
+                                        solve */
+
+    /** Begin time of the horizon associated to the solution stored in optiSolution */
+    std::chrono::nanoseconds previousBeginTime{std::chrono::nanoseconds::zero()};
+
     /**
      * Get the eCMP from VRP and omega
      */
@@ -295,10 +314,81 @@ struct TimeVaryingDCMPlanner::Impl
      */
     void setupCasADiFunctions()
     {
+        if (this->optiSettings.useFunctionCache)
+        {
+            // the functions depend only on the sampling time and on the gravity. Planner instances
+            // sharing the same discretization can reuse them
+            static std::mutex functionCacheMutex;
+            static std::unordered_map<std::string, OptimizationFunctions> functionCache;
+
+            const std::string key
+                = std::to_string(this->optiSettings.plannerSamplingTime.count()) + "_"
+                  + std::to_string(this->optiSettings.gravity);
+
+            const std::lock_guard<std::mutex> lock(functionCacheMutex);
+            auto cachedFunctions = functionCache.find(key);
+            if (cachedFunctions == functionCache.end())
+            {
+                cachedFunctions
+                    = functionCache.emplace(key, OptimizationFunctions{getDynamics(), getECMP()})
+                          .first;
+            }
+            optiFunctions = cachedFunctions->second;
+            return;
+        }
+
         optiFunctions.ecmp = getECMP();
         optiFunctions.dcmDynamics = getDynamics();
     }
 
+    /**
+     * Set the initial guess of the solver to the solution computed at the previous solve. The
+     * previous trajectory is shifted in time to match the beginning of the new horizon.
+     * @param beginTime begin time of the new horizon.
+     * @return true if the previous solution has been used as initial guess, false if it is not
+     * compatible with the new horizon.
+     */
+    bool setWarmStart(const std::chrono::nanoseconds& beginTime)
+    {
+        using Sl = casadi::Slice;
+
+        // the previous solution can be reused only if the new horizon begins an integer number of
+        // samples after the previous one
+        const auto timeShift = beginTime - this->previousBeginTime;
+        if (timeShift < std::chrono::nanoseconds::zero()
+            || timeShift % this->optiSettings.plannerSamplingTime
+                   != std::chrono::nanoseconds::zero())
+        {
+            return false;
+        }
+
+        const casadi_int sampleShift = timeShift / this->optiSettings.plannerSamplingTime;
+
+        // shift the previous trajectory in time. The samples beyond the end of the previous
+        // horizon are kept equal to the last one
+        auto shift = [sampleShift](const casadi::DM& previous, casadi_int columns) {
+            casadi::DM guess = casadi::DM::zeros(previous.rows(), columns);
+            for (casadi_int i = 0; i < columns; i++)
+            {
+                guess(Sl(), i) = previous(Sl(), std::min(i + sampleShift, previous.columns() - 1));
+            }
+            return guess;
+        };
+
+        this->opti.set_initial(this->optiVariables.dcm,
+                               shift(this->optiSolution.dcm, this->optiVariables.dcm.columns()));
+        this->opti.set_initial(this->optiVariables.vrp,
+                               shift(this->optiSolution.vrp, this->optiVariables.vrp.columns()));
+        this->opti.set_initial(this->optiVariables.omega,
+                               shift(this->optiSolution.omega,
+                                     this->optiVariables.omega.columns()));
+        this->opti.set_initial(this->optiVariables.omegaDot,
+                               shift(this->optiSolution.omegaDot,
+                                     this->optiVariables.omegaDot.columns()));
+
+        return true;
+    }
+
     bool computeConstraintElementsECMP(const ContactPhase& contactPhase,
                                        casadi::DM& ecmpConstraintA,
                                        casadi::DM& ecmpConstraintB)
@@ -343,7 +433,7 @@ struct TimeVaryingDCMPlanner::Impl
                 columnIndex++;
             }
         }
-        this->convexHullHelper.buildConvexHull(points);
+        this->convexHullHelper.updateConvexHull(points);
 
         // TODO PLEASE OPTIMIZE ME
         // please check https://github.com/casadi/casadi/issues/2563 and
@@ -504,13 +594,9 @@ struct TimeVaryingDCMPlanner::Impl
 
         // set the initial conditions
         this->opti.set_value(this->optiParameters.dcmInitialPosition,
-                             casadi::DM(std::vector<double>(initialState.dcmPosition.data(),
-                                                            initialState.dcmPosition.data()
-                                                                + this->dcmVectorSize)));
+                             Conversions::toCasadiDM(initialState.dcmPosition));
         this->opti.set_value(this->optiParameters.dcmInitialVelocity,
-                             casadi::DM(std::vector<double>(initialState.dcmVelocity.data(),
-                                                            initialState.dcmVelocity.data()
-                                                                + this->dcmVectorSize)));
+                             Conversions::toCasadiDM(initialState.dcmVelocity));
         this->opti.set_value(this->optiParameters.omegaInitialValue, initialState.omega);
 
         this->computeVRPConstraint(contactPhaseList);
@@ -555,6 +641,15 @@ struct TimeVaryingDCMPlanner::Impl
         this->initialValue.omega = sqrt(this->optiSettings.gravity / this->initialValue.dcm(2, Sl()));
         this->opti.set_value(this->optiParameters.dcmRefererenceTraj, this->initialValue.dcm);
 
+        // if the user asked for it, warm start the solver with the time-shifted solution of the
+        // previous solve. If the previous solution is not compatible with the new horizon the
+        // regularization trajectory is used as initial guess
+        if (this->optiSettings.warmStart && this->hasPreviousSolution
+            && this->setWarmStart(contactPhaseList.cbegin()->beginTime))
+        {
+            return true;
+        }
+
         this->opti.set_initial(this->optiVariables.dcm, this->initialValue.dcm);
         this->opti.set_initial(this->optiVariables.vrp, this->initialValue.dcm(Sl(), Sl(0, -1)));
         this->opti.set_initial(this->optiVariables.omega, this->initialValue.omega);
@@ -566,19 +661,23 @@ struct TimeVaryingDCMPlanner::Impl
 
     void prepareSolution()
     {
-        using Sl = casadi::Slice;
+        // the DM buffers are dense and column-major, consequently the state associated to the
+        // current sample can be read in place without materializing a copy of the trajectory
+        using Map = Eigen::Map<const Eigen::MatrixXd>;
 
-        std::memcpy(this->trajectory.dcmPosition.data(),
-                    optiSolution.dcm(Sl(), this->trajectoryIndex).ptr(),
-                    sizeof(double) * this->dcmVectorSize);
+        this->trajectory.dcmPosition = Map(this->optiSolution.dcm.ptr(),
+                                           this->optiSolution.dcm.rows(),
+                                           this->optiSolution.dcm.columns())
+                                           .col(this->trajectoryIndex);
 
-        std::memcpy(this->trajectory.vrpPosition.data(),
-                    optiSolution.vrp(Sl(), this->trajectoryIndex).ptr(),
-                    sizeof(double) * this->dcmVectorSize);
+        this->trajectory.vrpPosition = Map(this->optiSolution.vrp.ptr(),
+                                           this->optiSolution.vrp.rows(),
+                                           this->optiSolution.vrp.columns())
+                                           .col(this->trajectoryIndex);
 
-        trajectory.omega = static_cast<double>(optiSolution.omega(0, this->trajectoryIndex));
+        trajectory.omega = this->optiSolution.omega.ptr()[this->trajectoryIndex];
 
-        trajectory.omegaDot = static_cast<double>(optiSolution.omegaDot(0, this->trajectoryIndex));
+        trajectory.omegaDot = this->optiSolution.omegaDot.ptr()[this->trajectoryIndex];
 
         trajectory.dcmVelocity = (trajectory.omega - trajectory.omegaDot / trajectory.omega)
                                  * (trajectory.dcmPosition - trajectory.vrpPosition);
@@ -687,6 +786,23 @@ bool TimeVaryingDCMPlanner::initialize(std::weak_ptr<const ParametersHandler::IP
                     m_pimpl->optiSettings.useExternalDCMReference);
     }
 
+    // if this option is chosen the solver is warm started with the solution of the previous solve
+    if (!ptr->getParameter("warm_start", m_pimpl->optiSettings.warmStart))
+    {
+        log()->info("{} warm_start not found. The following parameter will be used {}.",
+                    logPrefix,
+                    m_pimpl->optiSettings.warmStart);
+    }
+
+    // if this option is chosen the casadi functions are shared among the planner instances having
+    // the same sampling time and gravity
+    if (!ptr->getParameter("use_function_cache", m_pimpl->optiSettings.useFunctionCache))
+    {
+        log()->info("{} use_function_cache not found. The following parameter will be used {}.",
+                    logPrefix,
+                    m_pimpl->optiSettings.useFunctionCache);
+    }
+
     if (ptr->getParameter("gravity", m_pimpl->optiSettings.gravity))
     {
         if (m_pimpl->optiSettings.gravity <= 0)
@@ -767,6 +883,17 @@ bool TimeVaryingDCMPlanner::computeTrajectory()
     m_pimpl->optiSolution.omega = m_pimpl->optiSolution.solution->value(m_pimpl->optiVariables.omega);
     m_pimpl->optiSolution.omegaDot = m_pimpl->optiSolution.solution->value(m_pimpl->optiVariables.omegaDot);
 
+    // once the optimal trajectories are extracted, the solver and the opti stack are no longer
+    // required: the consumers read the states on demand through getOutput()/advance() from the
+    // per-sample solution buffers. Releasing the NLP here avoids keeping it in memory for the
+    // whole life of the trajectory
+    m_pimpl->optiSolution.solution.reset();
+    m_pimpl->clear();
+
+    // store the begin time of the horizon. It may be used to warm start the next solve
+    m_pimpl->hasPreviousSolution = true;
+    m_pimpl->previousBeginTime = initialTrajectoryTime;
+
     // reinitialize the trajectory
     m_pimpl->trajectoryIndex = 0;
 
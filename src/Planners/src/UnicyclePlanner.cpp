@@ -107,6 +107,7 @@ public:
     std::shared_ptr<::FootPrint> left;
     std::shared_ptr<::FootPrint> right;
     std::unique_ptr<::UnicyclePlanner> planner;
+    std::unique_ptr<::UnicycleGenerator> generator;
 };
 
 Planners::UnicyclePlanner::UnicyclePlanner()
@@ -356,6 +357,19 @@ bool Planners::UnicyclePlanner::initialize(
         return false;
     }
 
+    // =======================================
+    // UnicycleGenerator creation and settings
+    // =======================================
+
+    // The generator is created and configured once and reused at every call of advance()
+    m_pImpl->generator = std::make_unique<::UnicycleGenerator>();
+    m_pImpl->generator->setSwitchOverSwingRatio(m_pImpl->gait.stancePhaseRatio);
+    m_pImpl->generator->setPauseConditions(m_pImpl->duration.max, m_pImpl->duration.nominal);
+
+    // The last step will have an infinite deactivation time, the following option
+    // is necessary for the generator but it does not affect the advanceable output
+    m_pImpl->generator->setTerminalHalfSwitchTime(1.0);
+
     return true;
 }
 
@@ -474,19 +488,28 @@ bool Planners::UnicyclePlanner::advance()
         m_pImpl->output = std::nullopt;
     };
 
-    // Cleanup first
-    cleanup();
+    // Invalidate the previous output
+    m_pImpl->output = std::nullopt;
 
     // ==================================
     // Plan contacts with UnicyclePlanner
     // ==================================
 
-    // Initialize the left FootPrint
-    m_pImpl->left = std::make_shared<FootPrint>();
+    // Initialize the left FootPrint. The container is reused between two subsequent calls to
+    // avoid paying its construction cost in a replanning loop
+    if (!m_pImpl->left)
+    {
+        m_pImpl->left = std::make_shared<FootPrint>();
+    }
+    m_pImpl->left->clearSteps();
     m_pImpl->left->setFootName(m_pImpl->names.left);
 
     // Initialize the right FootPrint
-    m_pImpl->right = std::make_shared<FootPrint>();
+    if (!m_pImpl->right)
+    {
+        m_pImpl->right = std::make_shared<FootPrint>();
+    }
+    m_pImpl->right->clearSteps();
     m_pImpl->right->setFootName(m_pImpl->names.right);
 
     // Convert manif to iDynTree
@@ -558,14 +581,8 @@ bool Planners::UnicyclePlanner::advance()
     // Compute step timings with UnicycleGenerator
     // ===========================================
 
-    // Create and configure the generator
-    auto generator = UnicycleGenerator();
-    generator.setSwitchOverSwingRatio(m_pImpl->gait.stancePhaseRatio);
-    generator.setPauseConditions(m_pImpl->duration.max, m_pImpl->duration.nominal);
-
-    // The last step will have an infinite deactivation time, the following option
-    // is necessary for the generator but it does not affect the advanceable output
-    generator.setTerminalHalfSwitchTime(1.0);
+    // The generator has been created and configured during initialize()
+    auto& generator = *m_pImpl->generator;
 
     // Due to how the generator works, the start time must be bigger than last impact time
     const double startLeft = m_pImpl->left->getSteps().front().impactTime;
@@ -707,3 +724,50 @@ bool Planners::UnicyclePlanner::advance()
 
     return true;
 }
+
+bool Planners::UnicyclePlanner::replan(const UnicyclePlannerInput& input)
+{
+    constexpr auto logPrefix = "[UnicyclePlanner::replan]";
+
+    UnicyclePlannerInput seededInput = input;
+
+    // If the caller did not provide the initial contacts, seed them with the contacts of the
+    // previous solution active at the beginning of the new horizon
+    if (m_pImpl->output)
+    {
+        using namespace std::chrono_literals;
+        const auto t0 = std::chrono::duration_cast<std::chrono::nanoseconds>(input.t0 * 1s);
+
+        if (!seededInput.initialLeftContact)
+        {
+            const auto contact = m_pImpl->output->left.getPresentContact(t0);
+            if (contact != m_pImpl->output->left.cend())
+            {
+                seededInput.initialLeftContact = *contact;
+            }
+        }
+
+        if (!seededInput.initialRightContact)
+        {
+            const auto contact = m_pImpl->output->right.getPresentContact(t0);
+            if (contact != m_pImpl->output->right.cend())
+            {
+                seededInput.initialRightContact = *contact;
+            }
+        }
+    }
+
+    if (!this->setInput(seededInput))
+    {
+        log()->error("{} Failed to set the input of the planner.", logPrefix);
+        return false;
+    }
+
+    if (!this->advance())
+    {
+        log()->error("{} Failed to compute the new footsteps.", logPrefix);
+        return false;
+    }
+
+    return true;
+}
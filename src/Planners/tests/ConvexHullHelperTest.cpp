@@ -60,4 +60,19 @@ TEST_CASE("Convex Hull helper")
     Eigen::VectorXd pointOutsideConvexHull(3);
     pointOutsideConvexHull.setZero();
     REQUIRE_FALSE(helper.doesPointBelongToConvexHull(pointOutsideConvexHull));
+
+    // updating the hull with the same set of points must keep the halfspace representation
+    // unchanged
+    const Eigen::MatrixXd A = helper.getA();
+    const Eigen::VectorXd b = helper.getB();
+    REQUIRE(helper.updateConvexHull(p));
+    REQUIRE(helper.getA().isApprox(A));
+    REQUIRE(helper.getB().isApprox(b));
+
+    // updating the hull with a different set of points must rebuild it
+    Eigen::MatrixXd enlargedPoints(3, 9);
+    enlargedPoints.leftCols(8) = p;
+    enlargedPoints.col(8) = pointOutsideConvexHull;
+    REQUIRE(helper.updateConvexHull(enlargedPoints));
+    REQUIRE(helper.doesPointBelongToConvexHull(pointOutsideConvexHull));
 }
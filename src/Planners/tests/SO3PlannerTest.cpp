@@ -148,6 +148,31 @@ TEST_CASE("SO3 planner")
         REQUIRE(acceleration.isApprox(manif::SO3d::Tangent::Zero(), tolerance));
     }
 
+    SECTION("Right - Trivialized [Inertial] Sampled trajectory")
+    {
+        SO3PlannerInertial planner;
+        REQUIRE(planner.setInitialConditions(manif::SO3d::Tangent::Zero(),
+                                             manif::SO3d::Tangent::Zero()));
+        REQUIRE(
+            planner.setFinalConditions(manif::SO3d::Tangent::Zero(), manif::SO3d::Tangent::Zero()));
+        REQUIRE(planner.setRotations(initialTranform, finalTranform, T));
+
+        std::vector<SO3PlannerState> trajectory;
+        REQUIRE(planner.evaluateTrajectory(dT, trajectory));
+        REQUIRE(trajectory.size() == samples + 1);
+
+        // each sample of the trajectory must coincide with the point-wise evaluation
+        manif::SO3d rotation;
+        manif::SO3d::Tangent velocity, acceleration;
+        for (std::size_t i = 0; i < trajectory.size(); i++)
+        {
+            REQUIRE(planner.evaluatePoint(i * dT, rotation, velocity, acceleration));
+            REQUIRE(trajectory[i].rotation.isApprox(rotation, tolerance));
+            REQUIRE(trajectory[i].velocity.isApprox(velocity, tolerance));
+            REQUIRE(trajectory[i].acceleration.isApprox(acceleration, tolerance));
+        }
+    }
+
     SECTION("Right - Trivialized [Inertial] Projected Initial velocity")
     {
         SO3PlannerInertial planner;
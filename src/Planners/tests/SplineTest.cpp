@@ -141,6 +141,36 @@ TEST_CASE("Quintic spline")
             REQUIRE(spline.advance());
         }
     }
+
+    SECTION("Batch evaluation")
+    {
+        // the time instants are sampled outside the time interval of the spline on purpose to
+        // check the extrapolation capabilities of evaluatePoints
+        std::vector<std::chrono::nanoseconds> timeInstants;
+        for (std::size_t i = 0; i < pointsToCheckNumber; i++)
+        {
+            timeInstants.push_back(dTCheckPoints * i + initTime - 100ms);
+        }
+
+        Eigen::MatrixXd positions(4, pointsToCheckNumber);
+        Eigen::MatrixXd velocities(4, pointsToCheckNumber);
+        Eigen::MatrixXd accelerations(4, pointsToCheckNumber);
+
+        REQUIRE(spline.evaluatePoints(timeInstants, positions, velocities, accelerations));
+
+        for (std::size_t i = 0; i < pointsToCheckNumber; i++)
+        {
+            REQUIRE(spline.evaluatePoint(timeInstants[i], position, velocity, acceleration));
+
+            REQUIRE(position.isApprox(positions.col(i), 1e-10));
+            REQUIRE(velocity.isApprox(velocities.col(i), 1e-10));
+            REQUIRE(acceleration.isApprox(accelerations.col(i), 1e-10));
+        }
+
+        // the output matrices with a wrong number of columns are not accepted
+        Eigen::MatrixXd wrongSize(4, pointsToCheckNumber - 1);
+        REQUIRE_FALSE(spline.evaluatePoints(timeInstants, wrongSize, velocities, accelerations));
+    }
 }
 
 
@@ -240,4 +270,34 @@ TEST_CASE("Cubic spline")
             REQUIRE(spline.advance());
         }
     }
+
+    SECTION("Batch evaluation")
+    {
+        // the time instants are sampled outside the time interval of the spline on purpose to
+        // check the extrapolation capabilities of evaluatePoints
+        std::vector<std::chrono::nanoseconds> timeInstants;
+        for (std::size_t i = 0; i < pointsToCheckNumber; i++)
+        {
+            timeInstants.push_back(dTCheckPoints * i + initTime - 100ms);
+        }
+
+        Eigen::MatrixXd positions(4, pointsToCheckNumber);
+        Eigen::MatrixXd velocities(4, pointsToCheckNumber);
+        Eigen::MatrixXd accelerations(4, pointsToCheckNumber);
+
+        REQUIRE(spline.evaluatePoints(timeInstants, positions, velocities, accelerations));
+
+        for (std::size_t i = 0; i < pointsToCheckNumber; i++)
+        {
+            REQUIRE(spline.evaluatePoint(timeInstants[i], position, velocity, acceleration));
+
+            REQUIRE(position.isApprox(positions.col(i), 1e-10));
+            REQUIRE(velocity.isApprox(velocities.col(i), 1e-10));
+            REQUIRE(acceleration.isApprox(accelerations.col(i), 1e-10));
+        }
+
+        // the output matrices with a wrong number of columns are not accepted
+        Eigen::MatrixXd wrongSize(4, pointsToCheckNumber - 1);
+        REQUIRE_FALSE(spline.evaluatePoints(timeInstants, wrongSize, velocities, accelerations));
+    }
 }
@@ -135,6 +135,33 @@ TEST_CASE("Swing foot planner")
         std::cout << "];" << std::endl;
     }
 
+    SECTION("Trajectory table")
+    {
+        // with the trajectory table enabled the planner precomputes the whole swing at take off.
+        // The output must coincide with the one obtained evaluating the splines at every tick
+        handler->setParameter("use_trajectory_table", true);
+        SwingFootPlanner tablePlanner;
+        REQUIRE(tablePlanner.initialize(handler));
+        REQUIRE(tablePlanner.setContactList(contactList));
+
+        for (std::chrono::nanoseconds time = contactList.firstContact()->activationTime;
+             time < contactList.lastContact()->deactivationTime;
+             time += dT)
+        {
+            REQUIRE(planner.advance());
+            REQUIRE(tablePlanner.advance());
+            REQUIRE(tablePlanner.isOutputValid());
+
+            REQUIRE(tablePlanner.getOutput().transform.translation().isApprox(
+                planner.getOutput().transform.translation(), 1e-10));
+            REQUIRE(tablePlanner.getOutput().transform.quat().isApprox( //
+                planner.getOutput().transform.quat(), 1e-10));
+            REQUIRE(tablePlanner.getOutput().mixedVelocity.coeffs().isApprox(
+                planner.getOutput().mixedVelocity.coeffs(), 1e-10));
+            REQUIRE(tablePlanner.getOutput().isInContact == planner.getOutput().isInContact);
+        }
+    }
+
     SECTION("Modifying during contact")
     {
         std::cout << "pos_modified_during_stance = [";
@@ -160,6 +187,43 @@ TEST_CASE("Swing foot planner")
         std::cout << "];" << std::endl;
     }
 
+    SECTION("Retargeting the position during swinging")
+    {
+        // the third contact is moved keeping its orientation and timings unchanged. In this case
+        // the planner retargets the ongoing trajectory incrementally at every adjustment
+        ContactList retargetedContactList = createOriginalContactList();
+
+        for (std::chrono::nanoseconds time = contactList.firstContact()->activationTime;
+             time < 1s + 900ms;
+             time += dT)
+        {
+            // the foothold is adjusted at every sampling instant of the swing phase
+            if (time >= 1s + 600ms && time < 1s + 750ms)
+            {
+                PlannedContact adjustedContact
+                    = *retargetedContactList.getPresentContact(2s);
+                adjustedContact.pose
+                    = manif::SE3d(adjustedContact.pose.translation()
+                                      + Eigen::Vector3d(1e-3, 1e-3, 0),
+                                  adjustedContact.pose.quat());
+                REQUIRE(retargetedContactList
+                            .editContact(retargetedContactList.getPresentContact(2s),
+                                         adjustedContact));
+                REQUIRE(planner.setContactList(retargetedContactList));
+            }
+
+            // advance the planner
+            REQUIRE(planner.advance());
+            REQUIRE(planner.isOutputValid());
+        }
+
+        // at touch down the foot must be on the adjusted foothold
+        REQUIRE(planner.getOutput()
+                    .transform.translation()
+                    .isApprox(retargetedContactList.getPresentContact(2s)->pose.translation(),
+                              1e-10));
+    }
+
     SECTION("Modifying during swinging")
     {
         std::cout << "pos_modified_during_swinging = [";
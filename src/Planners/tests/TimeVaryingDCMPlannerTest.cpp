@@ -106,4 +106,23 @@ TEST_CASE("TimeVaryingDCMPlanner")
     {
         REQUIRE(planner.advance());
     }
+
+    // enable the warm start and the function cache and solve the problem twice. The second solve
+    // is fed with the solution of the first one
+    handler->setParameter("warm_start", true);
+    handler->setParameter("use_function_cache", true);
+
+    TimeVaryingDCMPlanner warmStartedPlanner;
+    REQUIRE(warmStartedPlanner.initialize(handler));
+    REQUIRE(warmStartedPlanner.setContactPhaseList(phaseList));
+    warmStartedPlanner.setInitialState(initialState);
+    REQUIRE(warmStartedPlanner.computeTrajectory());
+
+    REQUIRE(warmStartedPlanner.setContactPhaseList(phaseList));
+    REQUIRE(warmStartedPlanner.computeTrajectory());
+
+    for (std::size_t i = 0; i < numberOfIterations; i++)
+    {
+        REQUIRE(warmStartedPlanner.advance());
+    }
 }
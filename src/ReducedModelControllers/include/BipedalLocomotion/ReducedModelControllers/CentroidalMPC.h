@@ -8,6 +8,7 @@
 #ifndef BIPEDAL_LOCOMOTION_REDUCE_MODEL_CONTROLLERS_CENTROIDAL_MPC_H
 #define BIPEDAL_LOCOMOTION_REDUCE_MODEL_CONTROLLERS_CENTROIDAL_MPC_H
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <optional>
@@ -25,13 +26,23 @@ namespace ReducedModelControllers
 {
 
 /**
- * CentroidalMPCOutput contains the output of the CentroidalMPC class
+ * CentroidalMPCOutput contains the output of the CentroidalMPC class.
+ * @note All the containers are sized at CentroidalMPC::initialize() time and updated in place at
+ * every CentroidalMPC::advance() call, so the addresses of the trajectories and of the contact
+ * entries remain stable across ticks and downstream consumers can hold Eigen::Map views on them.
+ * The only exception is `nextPlannedContact`, whose entries appear and disappear when a contact
+ * enters or leaves the horizon.
  */
 struct CentroidalMPCOutput
 {
     std::map<std::string, Contacts::DiscreteGeometryContact> contacts;
     std::map<std::string, Contacts::PlannedContact> nextPlannedContact;
     std::vector<Eigen::Vector3d> comTrajectory;
+    std::vector<Eigen::Vector3d> angularMomentumTrajectory;
+    std::chrono::nanoseconds solverTimestamp{std::chrono::nanoseconds::zero()}; /**< Time, given by
+                                  BipedalLocomotion::clock(), at which the solution was computed.
+                                  When the asynchronous mode is enabled it allows the consumer to
+                                  evaluate the age of the solution returned by advance(). */
 };
 
 /**
@@ -47,6 +58,11 @@ struct CentroidalMPCOutput
  * Sorrentino, S. Traversaro and D. Pucci, "Online Non-linear Centroidal MPC for Humanoid Robot
  * Locomotion with Step Adjustment," 2022 International Conference on Robotics and Automation
  * (ICRA), Philadelphia, PA, USA, 2022, pp. 10412-10419, doi: 10.1109/ICRA46639.2022.9811670.
+ * @note The horizon length and the contact configuration are fixed at initialize() time and baked
+ * into the casadi transcription (and, when `is_jit_enabled` is set, into the code-generated C
+ * controller), so the per-knot computations are already specialized for the configured dimensions.
+ * For this reason the class is intentionally not parameterized on the horizon length at compile
+ * time: the C++ side only moves fixed 3xN blocks whose cost is negligible compared to the solve.
  */
 class CentroidalMPC : public System::Source<CentroidalMPCOutput>
 {
@@ -76,12 +92,20 @@ public:
      * |  `force_rate_of_change_weight`  | `vector<double>` |                               Weight associated to the rate of change of the contact forces. The higher the weight, the more the contact forces will be smooth.                              |    Yes    |
      * |    `angular_momentum_weight`    |     `double`     |                                 Weight associated to the angular momentum. The higher the weight, the more the angular momentum will follow the desired one.                                 |    Yes    |
      * | `contact_force_symmetry_weight` |     `double`     |                 Weight associated to the symmetry of the contact forces. The higher the weight, the more the contact forces associated to the same contact will be symmetric                 |    Yes    |
+     * |         `solver_name`           |     `string`     |                             Nonlinear solver used by the MPC. It can be `ipopt` or `sqpmethod` (default `ipopt`).                            |     No    |
+     * |          `qp_solver`            |     `string`     |   QP solver used when `solver_name` is `sqpmethod`. The sparse backends (`osqp`, or `qpoases` in its sparse variant) exploit the block-banded structure of the multiple-shooting transcription (default `qrqp`).   |     No    |
+     * |        `is_rti_enabled`         |      `bool`      |     True to enable the real-time iteration scheme. A single SQP step (i.e. a single QP solve) is performed per advance(). It requires `solver_name` equal to `sqpmethod` and it is effective when combined with the warm start (default `false`).     |     No    |
      * |         `linear_solver`         |     `string`     |                             Linear solver used by ipopt. Please check https://coin-or.github.io/Ipopt/#PREREQUISITES for the available solvers (default `mumps`).                            |    Yes    |
      * |        `ipopt_tolerance`        |     `double`     |                        Determines the convergence tolerance for the algorithm (default value is \f$10^{-8}\f$ (https://coin-or.github.io/Ipopt/OPTIONS.html#OPT_tol).                        |     No    |
      * |      `ipopt_max_iteration`      |       `int`      |                                                            The maximum number of iterations of ipopt (The default value is 3000).                                                            |     No    |
      * |        `solver_verbosity`       |       `int`      |                                                Verbosity of the solver. The higher the value, the higher the verbosity (Default value is `0`)                                                |     No    |
      * |     `is_warm_start_enabled`     |      `bool`      |                                 True if the user wants to warm start the CoM, angular momentum, and contact location with the nominal value (Default `false`)                                |     No    |
+     * | `is_previous_solution_warm_start_enabled` | `bool` |  True if the solver should be warm started with the previous solution shifted by one knot. It requires `is_warm_start_enabled` set to true. An explicit guess provided with setInitialGuess() takes precedence (Default `false`)  |     No    |
      * |         `is_cse_enabled`        |      `bool`      | True if the Common subexpression elimination casadi option is enabled. This option is supported only by casadi 3.6.0 https://github.com/casadi/casadi/releases/tag/3.6.3  (Default `false` ) |     No    |
+     * |         `is_jit_enabled`        |      `bool`      |   True if the controller should be compiled into a C shared object with the casadi just-in-time compiler. The compiled controller is cached on disk and reloaded at the next initialization with the same horizon and contact configuration (Default `false`)   |     No    |
+     * |     `is_async_mode_enabled`     |      `bool`      |  True if the NLP is solved in a dedicated background thread. In this case advance() enqueues the current state and immediately returns the most recent completed solution without blocking. The solution timestamp is available in CentroidalMPCOutput::solverTimestamp (Default `false`)  |     No    |
+     * |       `codegen_directory`       |     `string`     |                                                              Directory where the code-generated controller is cached (Default `.`)                                                           |     No    |
+     * |   `force_move_blocking_sizes`   |   `vector<int>`  |  Sizes of the knot groups over which the contact forces are held constant (move blocking). The entries must be strictly positive and sum to the number of knots of the horizon, e.g. `(1, 1, 2, 4, 4, 8)` for a 20-knot horizon keeps a fine resolution near the current time and a coarse one later. Since only the first interval is applied, the closed-loop difference is negligible while the decision vector shrinks accordingly. If empty the forces are optimized at every knot (Default: empty)  |     No    |
      *
      * Moreover for each contact \f$i\f$ where \f$ 0 \le i \le \f$ `number_of_maximum_contacts-1` it is required to define a group `CONTACT_<i>` that contains the following parameters
      * |       Parameter Name       |        Type      |                                                          Description                                                             | Mandatory |
@@ -104,6 +128,22 @@ public:
      */
     bool setContactPhaseList(const Contacts::ContactPhaseList& contactPhaseList);
 
+    /**
+     * Update the timing of a single contact without pushing a whole new contact phase list.
+     * @param name name of the contact to edit.
+     * @param newActivationTime new activation time of the contact.
+     * @param newDeactivationTime new deactivation time of the contact.
+     * @return True in case of success, false otherwise.
+     * @note The edited contact is the one active (or first scheduled) at `newActivationTime` in
+     * the list provided with setContactPhaseList(). Only the knot masks and the time-varying
+     * parameters associated to the edited contact are recomputed, skipping the full horizon
+     * rebuild performed by setContactPhaseList(). Use this function for timing-only re-plans; if
+     * the contact location changes, call setContactPhaseList().
+     */
+    bool updateContactTiming(const std::string& name,
+                             const std::chrono::nanoseconds& newActivationTime,
+                             const std::chrono::nanoseconds& newDeactivationTime);
+
     /**
      * Set the state of the centroidal dynamics.
      * @param com position of the CoM expressed in the inertial frame.
@@ -149,6 +189,22 @@ public:
     bool setReferenceTrajectory(const std::vector<Eigen::Vector3d>& com,
                                 const std::vector<Eigen::Vector3d>& angularMomentum);
 
+    /**
+     * Set the initial guess used to warm start the solver at the next advance() call.
+     * @param com trajectory of the CoM used as initial guess. The vector must contain at least
+     * `floor(time_horizon / sampling_time) + 1` elements.
+     * @param angularMomentum trajectory of the centroidal angular momentum used as initial guess.
+     * The vector must contain at least `floor(time_horizon / sampling_time) + 1` elements.
+     * @return True in case of success, false otherwise.
+     * @note This function can be called only if `is_warm_start_enabled` is set to true in the
+     * initialization. The guess provided by this function overrides the one automatically computed
+     * from the reference trajectory.
+     * @warning Only the primal variables are warm started. The dual variables are not exposed by
+     * the casadi::Opti function interface.
+     */
+    bool setInitialGuess(const std::vector<Eigen::Vector3d>& com,
+                         const std::vector<Eigen::Vector3d>& angularMomentum);
+
     /**
      * Get the output of the controller
      * @return a const reference of the output of the controller.
@@ -4,8 +4,13 @@
  * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
  * distributed under the terms of the BSD-3-Clause license.
  */
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <filesystem>
+#include <functional>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 #include <casadi/casadi.hpp>
@@ -15,6 +20,7 @@
 #include <BipedalLocomotion/Math/Constants.h>
 #include <BipedalLocomotion/Math/LinearizedFrictionCone.h>
 #include <BipedalLocomotion/ReducedModelControllers/CentroidalMPC.h>
+#include <BipedalLocomotion/System/Clock.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 using namespace BipedalLocomotion::ReducedModelControllers;
@@ -190,13 +196,31 @@ struct CentroidalMPC::Impl
                                         (https://coin-or.github.io/Ipopt/OPTIONS.html#OPT_tol) */
         int ipoptMaxIteration{3000}; /**< Maximum number of iteration */
 
+        std::string solverName{"ipopt"}; /**< Name of the nonlinear solver. It can be `ipopt` or
+                                              `sqpmethod`. */
+        std::string qpSolver{"qrqp"}; /**< QP solver used by `sqpmethod`. */
+        bool isRtiEnabled{false}; /**< True if the real-time iteration scheme is enabled. In this
+                                       case `sqpmethod` performs a single SQP step per advance(). */
+
         int horizon; /**<Number of samples used in the horizon */
         std::chrono::nanoseconds samplingTime; /**< Sampling time of the planner */
         std::chrono::nanoseconds timeHorizon; /**< Duration of the horizon */
         bool isWarmStartEnabled{false}; /**< True if the user wants to warm start the CoM, angular
                                            momentum and contact. */
+        bool isPreviousSolutionWarmStartEnabled{false}; /**< True if the solver is warm started
+                                           with the previous solution shifted by one knot. */
         bool isCseEnabled{false}; /**< True if the Common subexpression elimination casadi option is
                                        enabled. */
+        bool isJitEnabled{false}; /**< True if the controller is compiled into a C shared object
+                                       with the casadi just-in-time compiler. */
+        bool isAsyncModeEnabled{false}; /**< True if the NLP is solved in a dedicated background
+                                       thread and advance() returns the latest completed
+                                       solution. */
+        std::string codegenDirectory{"."}; /**< Directory where the code-generated controller is
+                                                cached. */
+        std::vector<int> forceMoveBlockingSizes; /**< Sizes of the knot groups over which the
+                                                      contact forces are held constant. If empty
+                                                      the forces are optimized at every knot. */
     };
 
     OptimizationSettings optiSettings; /**< Settings */
@@ -232,7 +256,10 @@ struct CentroidalMPC::Impl
     };
     struct ControllerInputs
     {
-        std::map<std::string, ContactsInputs> contacts;
+        /** Contact inputs stored in a flat vector indexed by the contact index resolved at
+         * initialization time. The order matches the iteration order of the contacts map in the
+         * output. */
+        std::vector<ContactsInputs> contacts;
 
         casadi::DM* comReference;
         casadi::DM* angularMomentumReference;
@@ -246,13 +273,19 @@ struct CentroidalMPC::Impl
 
     struct InitialGuess
     {
-        std::map<std::string, casadi::DM*> contactsLocation;
+        /** Contact location guesses indexed by the contact index resolved at initialization
+         * time. */
+        std::vector<casadi::DM*> contactsLocation;
 
         casadi::DM* com;
         casadi::DM* angularMomentum;
     };
     InitialGuess initialGuess;
 
+    /** Name-to-index registry resolved once at initialization time so that the per-tick updates
+     * do not perform any string hashing on the contact containers. */
+    std::unordered_map<std::string, std::size_t> contactIndexMap;
+
     std::vector<casadi::DM> vectorizedOptiInputs;
 
     struct Weights
@@ -273,6 +306,9 @@ struct CentroidalMPC::Impl
 
     std::unordered_map<std::string, ContactBoundingBox> contactBoundingBoxes;
 
+    /** Contact bounding boxes indexed by the contact index resolved at initialization time. */
+    std::vector<ContactBoundingBox> contactBoundingBoxByIndex;
+
     bool loadContactCorners(std::shared_ptr<const ParametersHandler::IParametersHandler> ptr,
                             DiscreteGeometryContact& contact)
     {
@@ -284,7 +320,13 @@ struct CentroidalMPC::Impl
             log()->error("{} Unable to get the number of corners.");
             return false;
         }
-        contact.corners.resize(numberOfCorners);
+        if (!contact.corners.resize(numberOfCorners))
+        {
+            log()->error("{} Unable to resize the corner container to {} corners.",
+                         errorPrefix,
+                         numberOfCorners);
+            return false;
+        }
 
         for (std::size_t j = 0; j < numberOfCorners; j++)
         {
@@ -407,12 +449,91 @@ struct CentroidalMPC::Impl
         // initialize the friction cone
         ok = ok && frictionCone.initialize(ptr);
 
+        getOptionalParameter(ptr, "solver_name", this->optiSettings.solverName);
+        if (this->optiSettings.solverName != "ipopt"
+            && this->optiSettings.solverName != "sqpmethod")
+        {
+            log()->error("{} The 'solver_name' parameter must be 'ipopt' or 'sqpmethod'. "
+                         "Provided: '{}'.",
+                         logPrefix,
+                         this->optiSettings.solverName);
+            return false;
+        }
+        getOptionalParameter(ptr, "qp_solver", this->optiSettings.qpSolver);
+        getOptionalParameter(ptr, "is_rti_enabled", this->optiSettings.isRtiEnabled);
+        if (this->optiSettings.isRtiEnabled && this->optiSettings.solverName != "sqpmethod")
+        {
+            log()->warn("{} The real-time iteration scheme requires 'solver_name' equal to "
+                        "'sqpmethod'. The RTI mode will be disabled.",
+                        logPrefix);
+            this->optiSettings.isRtiEnabled = false;
+        }
         getOptionalParameter(ptr, "linear_solver", this->optiSettings.ipoptLinearSolver);
         getOptionalParameter(ptr, "ipopt_tolerance", this->optiSettings.ipoptTolerance);
         getOptionalParameter(ptr, "ipopt_max_iteration", this->optiSettings.ipoptMaxIteration);
         getOptionalParameter(ptr, "solver_verbosity", this->optiSettings.solverVerbosity);
         getOptionalParameter(ptr, "is_warm_start_enabled", this->optiSettings.isWarmStartEnabled);
+        getOptionalParameter(ptr,
+                             "is_previous_solution_warm_start_enabled",
+                             this->optiSettings.isPreviousSolutionWarmStartEnabled);
+        if (this->optiSettings.isPreviousSolutionWarmStartEnabled
+            && !this->optiSettings.isWarmStartEnabled)
+        {
+            log()->warn("{} 'is_previous_solution_warm_start_enabled' requires "
+                        "'is_warm_start_enabled'. The previous solution warm start will be "
+                        "disabled.",
+                        logPrefix);
+            this->optiSettings.isPreviousSolutionWarmStartEnabled = false;
+        }
         getOptionalParameter(ptr, "is_cse_enabled", this->optiSettings.isCseEnabled);
+        getOptionalParameter(ptr, "is_jit_enabled", this->optiSettings.isJitEnabled);
+        getOptionalParameter(ptr, "is_async_mode_enabled", this->optiSettings.isAsyncModeEnabled);
+        if (this->optiSettings.isAsyncModeEnabled
+            && this->optiSettings.isPreviousSolutionWarmStartEnabled)
+        {
+            log()->warn("{} The previous solution warm start is not supported when the "
+                        "asynchronous mode is enabled. It will be disabled.",
+                        logPrefix);
+            this->optiSettings.isPreviousSolutionWarmStartEnabled = false;
+        }
+        getOptionalParameter(ptr, "codegen_directory", this->optiSettings.codegenDirectory);
+
+        // move blocking keeps the contact forces constant over groups of knots, shrinking the
+        // decision vector. Since only the first interval is applied, a fine resolution is needed
+        // only at the beginning of the horizon.
+        if (ptr->getParameter("force_move_blocking_sizes",
+                              this->optiSettings.forceMoveBlockingSizes)
+            && !this->optiSettings.forceMoveBlockingSizes.empty())
+        {
+            int totalKnots = 0;
+            for (const int groupSize : this->optiSettings.forceMoveBlockingSizes)
+            {
+                if (groupSize <= 0)
+                {
+                    log()->error("{} The entries of 'force_move_blocking_sizes' must be strictly "
+                                 "positive.",
+                                 logPrefix);
+                    return false;
+                }
+                totalKnots += groupSize;
+            }
+
+            if (totalKnots != this->optiSettings.horizon)
+            {
+                log()->error("{} The entries of 'force_move_blocking_sizes' must sum to the "
+                             "number of knots of the horizon. Expected: {}. Provided: {}.",
+                             logPrefix,
+                             this->optiSettings.horizon,
+                             totalKnots);
+                return false;
+            }
+
+            log()->info("{} Move blocking enabled. The contact forces are described by {} moves "
+                        "over {} knots.",
+                        logPrefix,
+                        this->optiSettings.forceMoveBlockingSizes.size(),
+                        this->optiSettings.horizon);
+        }
 
         return ok;
     }
@@ -521,8 +642,9 @@ struct CentroidalMPC::Impl
         constexpr int vector3Size = 3;
         const int stateHorizon = this->optiSettings.horizon + 1;
 
-        // resize the CoM Trajectory
+        // resize the CoM and angular momentum trajectories
         this->output.comTrajectory.resize(stateHorizon);
+        this->output.angularMomentumTrajectory.resize(stateHorizon);
 
         // In case of no warmstart the variables are:
         // - centroidalVariables = 7: external force + external torque + com current + dcom current
@@ -587,43 +709,58 @@ struct CentroidalMPC::Impl
             this->initialGuess.angularMomentum = &this->vectorizedOptiInputs.back();
         }
 
+        // build the index-based contact registry. The name-to-index resolution is performed once
+        // here so that the per-tick updates work on flat vectors without hashing
+        this->contactIndexMap.clear();
+        this->controllerInputs.contacts.resize(this->output.contacts.size());
+        this->contactBoundingBoxByIndex.resize(this->output.contacts.size());
+        if (this->optiSettings.isWarmStartEnabled)
+        {
+            this->initialGuess.contactsLocation.resize(this->output.contacts.size());
+        }
+
+        std::size_t contactIndex = 0;
         for (const auto& [key, contact] : this->output.contacts)
         {
+            this->contactIndexMap[key] = contactIndex;
+            this->contactBoundingBoxByIndex[contactIndex] = this->contactBoundingBoxes.at(key);
+
+            auto& contactInputs = this->controllerInputs.contacts[contactIndex];
+
             // The current position of the contact
             this->vectorizedOptiInputs.push_back(casadi::DM::zeros(vector3Size));
-            this->controllerInputs.contacts[key].currentPosition
-                = &this->vectorizedOptiInputs.back();
+            contactInputs.currentPosition = &this->vectorizedOptiInputs.back();
 
             // The nominal contact position is a parameter that regularize the solution
             this->vectorizedOptiInputs.push_back(casadi::DM::zeros(vector3Size, stateHorizon));
-            this->controllerInputs.contacts[key].nominalPosition
-                = &this->vectorizedOptiInputs.back();
+            contactInputs.nominalPosition = &this->vectorizedOptiInputs.back();
 
             // The orientation is stored as a vectorized version of the rotation matrix
             this->vectorizedOptiInputs.push_back(casadi::DM::zeros(9, this->optiSettings.horizon));
-            this->controllerInputs.contacts[key].orientation = &this->vectorizedOptiInputs.back();
+            contactInputs.orientation = &this->vectorizedOptiInputs.back();
 
             // Maximum admissible contact force. It is expressed in the contact body frame
             this->vectorizedOptiInputs.push_back(casadi::DM::zeros(1, this->optiSettings.horizon));
-            this->controllerInputs.contacts[key].isEnabled = &this->vectorizedOptiInputs.back();
+            contactInputs.isEnabled = &this->vectorizedOptiInputs.back();
 
             // Upper limit of the position of the contact. It is expressed in the contact body frame
             this->vectorizedOptiInputs.push_back(
                 casadi::DM::zeros(vector3Size, this->optiSettings.horizon));
-            this->controllerInputs.contacts[key].upperLimitPosition
-                = &this->vectorizedOptiInputs.back();
+            contactInputs.upperLimitPosition = &this->vectorizedOptiInputs.back();
 
             // Lower limit of the position of the contact. It is expressed in the contact body frame
             this->vectorizedOptiInputs.push_back(
                 casadi::DM::zeros(vector3Size, this->optiSettings.horizon));
-            this->controllerInputs.contacts[key].lowerLimitPosition
-                = &this->vectorizedOptiInputs.back();
+            contactInputs.lowerLimitPosition = &this->vectorizedOptiInputs.back();
 
             if (this->optiSettings.isWarmStartEnabled)
             {
                 this->vectorizedOptiInputs.push_back(casadi::DM::zeros(vector3Size, stateHorizon));
-                this->initialGuess.contactsLocation[key] = &this->vectorizedOptiInputs.back();
+                this->initialGuess.contactsLocation[contactIndex]
+                    = &this->vectorizedOptiInputs.back();
             }
+
+            contactIndex++;
         }
 
         assert(vectorizedOptiInputsSize == this->vectorizedOptiInputs.size());
@@ -677,12 +814,35 @@ struct CentroidalMPC::Impl
 
             for (int j = 0; j < contact.corners.size(); j++)
             {
-                c.corners[j].force = this->opti.variable(vector3Size, this->optiSettings.horizon);
+                if (this->optiSettings.forceMoveBlockingSizes.empty())
+                {
+                    c.corners[j].force
+                        = this->opti.variable(vector3Size, this->optiSettings.horizon);
+                } else
+                {
+                    // one decision variable per move, repeated over the knots of its group. The
+                    // constraints and the cost operate on the expanded full-horizon expression, so
+                    // the rest of the transcription is unaffected
+                    using Sl = casadi::Slice;
+                    const casadi::MX moves = this->opti.variable( //
+                        vector3Size,
+                        this->optiSettings.forceMoveBlockingSizes.size());
+
+                    std::vector<casadi::MX> knots;
+                    knots.reserve(this->optiSettings.forceMoveBlockingSizes.size());
+                    for (int move = 0; move < this->optiSettings.forceMoveBlockingSizes.size();
+                         move++)
+                    {
+                        knots.push_back(
+                            casadi::MX::repmat(moves(Sl(), move),
+                                               1,
+                                               this->optiSettings.forceMoveBlockingSizes[move]));
+                    }
+                    c.corners[j].force = casadi::MX::horzcat(knots);
+                }
 
                 c.corners[j].position
-                    = casadi::DM(std::vector<double>(contact.corners[j].position.data(),
-                                                     contact.corners[j].position.data()
-                                                         + contact.corners[j].position.size()));
+                    = BipedalLocomotion::Conversions::toCasadiDM(contact.corners[j].position);
             }
         }
 
@@ -704,26 +864,165 @@ struct CentroidalMPC::Impl
     void setupOptiOptions()
     {
         casadi::Dict casadiOptions;
-        casadi::Dict ipoptOptions;
+        casadi::Dict solverOptions;
 
-        if (this->optiSettings.solverVerbosity != 0)
+        if (this->optiSettings.solverName == "ipopt")
         {
-            casadi_int ipoptVerbosity = static_cast<long long>(optiSettings.solverVerbosity - 1);
-            ipoptOptions["print_level"] = ipoptVerbosity;
-            casadiOptions["print_time"] = true;
+            if (this->optiSettings.solverVerbosity != 0)
+            {
+                casadi_int ipoptVerbosity
+                    = static_cast<long long>(optiSettings.solverVerbosity - 1);
+                solverOptions["print_level"] = ipoptVerbosity;
+                casadiOptions["print_time"] = true;
+            } else
+            {
+                solverOptions["print_level"] = 0;
+                casadiOptions["print_time"] = false;
+            }
+
+            solverOptions["max_iter"] = this->optiSettings.ipoptMaxIteration;
+            solverOptions["tol"] = this->optiSettings.ipoptTolerance;
+            solverOptions["linear_solver"] = this->optiSettings.ipoptLinearSolver;
         } else
         {
-            ipoptOptions["print_level"] = 0;
-            casadiOptions["print_time"] = false;
+            // sqpmethod. In the real-time iteration scheme a single SQP step (i.e. a single QP) is
+            // performed per advance(). The scheme relies on the warm start to keep the
+            // linearization point close to the optimum.
+            solverOptions["max_iter"] = this->optiSettings.isRtiEnabled
+                                            ? 1
+                                            : this->optiSettings.ipoptMaxIteration;
+            solverOptions["qpsol"] = this->optiSettings.qpSolver;
+            solverOptions["print_iteration"] = this->optiSettings.solverVerbosity != 0;
+            solverOptions["print_header"] = this->optiSettings.solverVerbosity != 0;
+            solverOptions["print_time"] = this->optiSettings.solverVerbosity != 0;
+            casadiOptions["print_time"] = this->optiSettings.solverVerbosity != 0;
+
+            // the multiple-shooting transcription has a block-banded KKT structure over the
+            // horizon stages. The sparse QP backends exploit it directly, while the dense ones
+            // would treat the problem as a monolithic matrix.
+            casadi::Dict qpSolverOptions;
+            if (this->optiSettings.qpSolver == "qrqp")
+            {
+                qpSolverOptions["print_iter"] = false;
+                qpSolverOptions["print_header"] = false;
+                qpSolverOptions["print_info"] = false;
+            } else if (this->optiSettings.qpSolver == "osqp")
+            {
+                qpSolverOptions["warm_start_primal"] = true;
+                qpSolverOptions["osqp"] = casadi::Dict{{"verbose", false}};
+            } else if (this->optiSettings.qpSolver == "qpoases")
+            {
+                // enable the sparse variant of qpoases so the banded structure is preserved
+                qpSolverOptions["sparse"] = true;
+                qpSolverOptions["printLevel"] = "none";
+            }
+            solverOptions["qpsol_options"] = qpSolverOptions;
+
+            // with a single SQP step the solver does not reach the standard convergence criterion
+            if (this->optiSettings.isRtiEnabled)
+            {
+                casadiOptions["error_on_fail"] = false;
+            }
         }
 
-        ipoptOptions["max_iter"] = this->optiSettings.ipoptMaxIteration;
-        ipoptOptions["tol"] = this->optiSettings.ipoptTolerance;
-        ipoptOptions["linear_solver"] = this->optiSettings.ipoptLinearSolver;
         casadiOptions["expand"] = true;
-        casadiOptions["error_on_fail"] = true;
+        if (casadiOptions.find("error_on_fail") == casadiOptions.end())
+        {
+            casadiOptions["error_on_fail"] = true;
+        }
+
+        if (this->optiSettings.isJitEnabled)
+        {
+            // compile the function evaluations (cost, constraints and derivatives) into a C
+            // shared object. The generated files are kept on disk so that the serialized
+            // controller can be reloaded without recompiling.
+            casadiOptions["jit"] = true;
+            casadiOptions["jit_cleanup"] = false;
+            casadiOptions["jit_temp_suffix"] = false;
+            casadiOptions["jit_serialize"] = "link";
+            casadiOptions["jit_options"] = casadi::Dict{{"flags", "-O3"}, {"verbose", false}};
+        }
 
-        this->opti.solver("ipopt", casadiOptions, ipoptOptions);
+        this->opti.solver(this->optiSettings.solverName, casadiOptions, solverOptions);
+    }
+
+    /**
+     * Compute a tag that uniquely identifies the optimization problem built by
+     * createController(). Two CentroidalMPC instances initialized with the same horizon, contact
+     * configuration and solver settings share the same tag and therefore the same cached
+     * controller.
+     */
+    std::string controllerCacheTag() const
+    {
+        std::string description = std::to_string(this->optiSettings.horizon) + "_"
+                                  + std::to_string(this->optiSettings.samplingTime.count()) + "_"
+                                  + std::to_string(this->optiSettings.isWarmStartEnabled) + "_"
+                                  + std::to_string(this->optiSettings.isCseEnabled) + "_"
+                                  + this->optiSettings.solverName + "_"
+                                  + std::to_string(this->optiSettings.isRtiEnabled);
+
+        for (const int groupSize : this->optiSettings.forceMoveBlockingSizes)
+        {
+            description += "_mb" + std::to_string(groupSize);
+        }
+
+        for (const auto& [key, contact] : this->output.contacts)
+        {
+            description += "_" + key + "_" + std::to_string(contact.corners.size());
+        }
+
+        return "centroidal_mpc_" + std::to_string(std::hash<std::string>{}(description));
+    }
+
+    /**
+     * Build the controller function. If the just-in-time compilation is enabled, the function is
+     * cached on disk and reloaded in the subsequent initializations, skipping both the opti
+     * transcription and the C compilation.
+     */
+    casadi::Function createControllerWithCache()
+    {
+        constexpr auto logPrefix = "[CentroidalMPC::Impl::createControllerWithCache]";
+
+        if (!this->optiSettings.isJitEnabled)
+        {
+            return this->createController();
+        }
+
+        namespace fs = std::filesystem;
+        const fs::path cacheFile = fs::path(this->optiSettings.codegenDirectory)
+                                   / (this->controllerCacheTag() + ".casadi");
+
+        if (fs::exists(cacheFile))
+        {
+            try
+            {
+                log()->info("{} Loading the code-generated controller from {}.",
+                            logPrefix,
+                            cacheFile.string());
+                return casadi::Function::load(cacheFile.string());
+            } catch (const std::exception& e)
+            {
+                log()->warn("{} Unable to load the cached controller. The controller will be "
+                            "regenerated. The following exception has been thrown {}.",
+                            logPrefix,
+                            e.what());
+            }
+        }
+
+        casadi::Function function = this->createController();
+        try
+        {
+            function.save(cacheFile.string());
+        } catch (const std::exception& e)
+        {
+            log()->warn("{} Unable to cache the controller in {}. The following exception has "
+                        "been thrown {}.",
+                        logPrefix,
+                        cacheFile.string(),
+                        e.what());
+        }
+
+        return function;
     }
 
     casadi::Function createController()
@@ -964,6 +1263,7 @@ struct CentroidalMPC::Impl
         }
 
         concatenateOutput(this->optiVariables.com, "com");
+        concatenateOutput(this->optiVariables.angularMomentum, "angular_momentum");
 
         casadi::Dict toFunctionOptions;
         if (casadiVersionIsAtLeast360())
@@ -974,6 +1274,353 @@ struct CentroidalMPC::Impl
         return this->opti
             .to_function("controller", input, output, inputName, outputName, toFunctionOptions);
     }
+
+    /**
+     * Extract the solution computed by the controller function and store it in the output struct.
+     */
+    bool extractSolution(const std::vector<casadi::DM>& controllerOutput,
+                         const Contacts::ContactPhaseList& phaseList,
+                         const std::chrono::nanoseconds& time,
+                         CentroidalMPCOutput& mpcOutput)
+    {
+        constexpr auto errorPrefix = "[CentroidalMPC::Impl::extractSolution]";
+
+        auto it = controllerOutput.begin();
+        std::size_t contactIndex = 0;
+        for (auto& [key, contact] : mpcOutput.contacts)
+        {
+            // this is required for toEigen
+            using namespace BipedalLocomotion::Conversions;
+
+            int index = toEigen(*it).size();
+            const int size = toEigen(*it).size();
+            for (int i = 0; i < size; i++)
+            {
+                if (toEigen(*it)(i) > 0.5)
+                {
+                    if (i == 0)
+                    {
+                        break;
+                    } else if (toEigen(*it)(i - 1) < 0.5)
+                    {
+                        index = i;
+                        break;
+                    }
+                }
+            }
+
+            double isEnabled = toEigen(*it)(0);
+            std::advance(it, 1);
+            contact.pose.translation(toEigen(*it).leftCols<1>());
+
+            // if the previous solution warm start is enabled, the contact location solution
+            // shifted by one knot is used as initial guess for the next tick
+            if (this->optiSettings.isPreviousSolutionWarmStartEnabled)
+            {
+                auto guess = toEigen(*(this->initialGuess.contactsLocation[contactIndex]));
+                const auto solution = toEigen(*it);
+                guess.leftCols(solution.cols() - 1) = solution.rightCols(solution.cols() - 1);
+                guess.rightCols<1>() = solution.rightCols<1>();
+            }
+
+            if (index < size)
+            {
+                // the entry is created only the first time the contact is planned. In steady
+                // state the node is updated in place so the map does not allocate at every tick
+                // and the addresses returned by getOutput() remain stable.
+                auto& nextPlannedContact = mpcOutput.nextPlannedContact[key];
+                nextPlannedContact.name = key;
+                nextPlannedContact.pose.translation(toEigen(*it).col(index));
+            } else
+            {
+                mpcOutput.nextPlannedContact.erase(key);
+            }
+
+            std::advance(it, 1);
+            contact.pose.quat(Eigen::Quaterniond(
+                Eigen::Map<const Eigen::Matrix3d>(toEigen(*it).leftCols<1>().data())));
+
+            if (index < size)
+            {
+                mpcOutput.nextPlannedContact[key].pose.quat(Eigen::Quaterniond(
+                    Eigen::Map<const Eigen::Matrix3d>(toEigen(*it).leftCols<1>().data())));
+
+                const std::chrono::nanoseconds nextPlannedContactTime
+                    = time + this->optiSettings.samplingTime * index;
+
+                auto nextPlannedContact
+                    = phaseList.lists().at(key).getPresentContact(nextPlannedContactTime);
+                if (nextPlannedContact == phaseList.lists().at(key).end())
+                {
+                    log()->error("{} Unable to get the next planned contact.", errorPrefix);
+                    return false;
+                }
+
+                auto& contact = mpcOutput.nextPlannedContact[key];
+                contact.activationTime = nextPlannedContact->activationTime;
+                contact.deactivationTime = nextPlannedContact->deactivationTime;
+                contact.index = nextPlannedContact->index;
+                contact.type = nextPlannedContact->type;
+            }
+
+            std::advance(it, 1);
+
+            for (auto& corner : contact.corners)
+            {
+                // isEnabled == 1 means that the contact is active
+                if (isEnabled > 0.5)
+                {
+                    corner.force = toEigen(*it).leftCols<1>();
+                } else
+                {
+                    corner.force.setZero();
+                }
+                std::advance(it, 1);
+            }
+
+            contactIndex++;
+        }
+
+        {
+            using namespace BipedalLocomotion::Conversions;
+
+            const auto comSolution = toEigen(*it);
+            for (int i = 0; i < mpcOutput.comTrajectory.size(); i++)
+            {
+                mpcOutput.comTrajectory[i] = comSolution.col(i);
+            }
+
+            // if the previous solution warm start is enabled, the state solution shifted by one
+            // knot is used as initial guess for the next tick
+            if (this->optiSettings.isPreviousSolutionWarmStartEnabled)
+            {
+                auto comGuess = toEigen(*(this->initialGuess.com));
+                comGuess.leftCols(comSolution.cols() - 1)
+                    = comSolution.rightCols(comSolution.cols() - 1);
+                comGuess.rightCols<1>() = comSolution.rightCols<1>();
+            }
+
+            std::advance(it, 1);
+            const auto angularMomentumSolution = toEigen(*it);
+            for (int i = 0; i < mpcOutput.angularMomentumTrajectory.size(); i++)
+            {
+                mpcOutput.angularMomentumTrajectory[i] = angularMomentumSolution.col(i);
+            }
+
+            if (this->optiSettings.isPreviousSolutionWarmStartEnabled)
+            {
+                auto angularMomentumGuess = toEigen(*(this->initialGuess.angularMomentum));
+                angularMomentumGuess.leftCols(angularMomentumSolution.cols() - 1)
+                    = angularMomentumSolution.rightCols(angularMomentumSolution.cols() - 1);
+                angularMomentumGuess.rightCols<1>() = angularMomentumSolution.rightCols<1>();
+            }
+        }
+
+        mpcOutput.solverTimestamp = BipedalLocomotion::clock().now();
+
+        return true;
+    }
+
+    /**
+     * Wait-free single-producer/single-consumer slot that always exposes the latest published
+     * element. The producer and the consumer own one slot each and a third slot is exchanged
+     * atomically, so neither side ever blocks.
+     */
+    template <typename T> struct LatestValueMailbox
+    {
+        static constexpr int newDataFlag = 4; /**< Bit or-ed to the slot index when the producer
+                                                   publishes a new element. */
+        std::array<T, 3> slots;
+        std::atomic<int> mailbox{2};
+        int producerSlot{0};
+        int consumerSlot{1};
+
+        T& producerData()
+        {
+            return slots[producerSlot];
+        }
+
+        void publish()
+        {
+            producerSlot = mailbox.exchange(producerSlot | newDataFlag, //
+                                            std::memory_order_acq_rel)
+                           & (newDataFlag - 1);
+        }
+
+        /**
+         * Take the latest published element if any. The returned pointer is owned by the consumer
+         * until the next call to take().
+         */
+        T* take()
+        {
+            if ((mailbox.load(std::memory_order_acquire) & newDataFlag) == 0)
+            {
+                return nullptr;
+            }
+            consumerSlot = mailbox.exchange(consumerSlot, std::memory_order_acq_rel)
+                           & (newDataFlag - 1);
+            return &slots[consumerSlot];
+        }
+    };
+
+    /**
+     * Input snapshot consumed by the solver thread when the asynchronous mode is enabled.
+     */
+    struct AsyncInput
+    {
+        std::vector<casadi::DM> inputs;
+        Contacts::ContactPhaseList contactPhaseList;
+        std::chrono::nanoseconds currentTime;
+    };
+
+    struct AsyncSolver
+    {
+        std::thread thread;
+        std::atomic<bool> isRunning{false};
+        LatestValueMailbox<AsyncInput> inputMailbox;
+        LatestValueMailbox<CentroidalMPCOutput> outputMailbox;
+    };
+    AsyncSolver asyncSolver;
+
+    void solverLoop()
+    {
+        constexpr auto logPrefix = "[CentroidalMPC::Impl::solverLoop]";
+        constexpr std::chrono::microseconds idleSleep{100};
+
+        while (this->asyncSolver.isRunning.load(std::memory_order_acquire))
+        {
+            AsyncInput* input = this->asyncSolver.inputMailbox.take();
+            if (input == nullptr)
+            {
+                BipedalLocomotion::clock().sleepFor(idleSleep);
+                continue;
+            }
+
+            std::vector<casadi::DM> controllerOutput;
+            try
+            {
+                controllerOutput = this->controller(input->inputs);
+            } catch (const std::exception& e)
+            {
+                log()->error("{} Unable to solve the problem. The following exception has been "
+                             "thrown {}.",
+                             logPrefix,
+                             e.what());
+                continue;
+            }
+
+            CentroidalMPCOutput& solution = this->asyncSolver.outputMailbox.producerData();
+            if (!this->extractSolution(controllerOutput,
+                                       input->contactPhaseList,
+                                       input->currentTime,
+                                       solution))
+            {
+                continue;
+            }
+            this->asyncSolver.outputMailbox.publish();
+        }
+    }
+
+    /**
+     * Recompute the knot masks and the time-varying parameters associated to a single contact
+     * from the stored contact phase list. It is the per-contact counterpart of the horizon
+     * rebuild performed by setContactPhaseList().
+     */
+    bool fillContactKnots(const std::size_t contactIndex, const std::string& name)
+    {
+        constexpr auto errorPrefix = "[CentroidalMPC::Impl::fillContactKnots]";
+        using namespace BipedalLocomotion::Conversions;
+
+        auto& contactInputs = this->controllerInputs.contacts[contactIndex];
+
+        // reset the time-varying parameters of the edited contact only
+        const Eigen::Matrix3d identity = Eigen::Matrix3d::Identity();
+        toEigen(*contactInputs.currentPosition).setZero();
+        toEigen(*contactInputs.orientation).colwise()
+            = Eigen::Map<const Eigen::VectorXd>(identity.data(), identity.size());
+        toEigen(*contactInputs.isEnabled).setZero();
+        toEigen(*contactInputs.nominalPosition).setZero();
+
+        const std::chrono::nanoseconds absoluteTimeHorizon
+            = this->currentTime + this->optiSettings.timeHorizon;
+
+        auto initialPhase = this->contactPhaseList.getPresentPhase(this->currentTime);
+        if (initialPhase == this->contactPhaseList.end())
+        {
+            log()->error("{} Unable to find the contact phase related to the current time.",
+                         errorPrefix);
+            return false;
+        }
+
+        auto finalPhase = this->contactPhaseList.getPresentPhase(absoluteTimeHorizon);
+        if (finalPhase == this->contactPhaseList.end())
+        {
+            finalPhase = std::prev(this->contactPhaseList.end());
+        }
+
+        int index = 0;
+        for (auto it = initialPhase; it != std::next(finalPhase); std::advance(it, 1))
+        {
+            const std::chrono::nanoseconds tInitial = std::max(this->currentTime, it->beginTime);
+            const std::chrono::nanoseconds tFinal = std::min(absoluteTimeHorizon, it->endTime);
+
+            const int numberOfSamples = (tFinal - tInitial) / this->optiSettings.samplingTime;
+
+            auto contact = it->activeContacts.find(name);
+            if (contact != it->activeContacts.end())
+            {
+                toEigen(*contactInputs.nominalPosition)
+                    .middleCols(index, numberOfSamples + 1)
+                    .colwise()
+                    = contact->second->pose.translation();
+
+                const Eigen::Matrix3d orientation
+                    = contact->second->pose.quat().toRotationMatrix();
+                toEigen(*contactInputs.orientation).middleCols(index, numberOfSamples).colwise()
+                    = Eigen::Map<const Eigen::VectorXd>(orientation.data(), orientation.size());
+
+                constexpr double isEnabled = 1;
+                toEigen(*contactInputs.isEnabled)
+                    .middleCols(index, numberOfSamples)
+                    .setConstant(isEnabled);
+            }
+
+            index += numberOfSamples;
+        }
+
+        toEigen(*contactInputs.currentPosition)
+            = toEigen(*contactInputs.nominalPosition).leftCols<1>();
+
+        if (this->optiSettings.isWarmStartEnabled)
+        {
+            toEigen(*(this->initialGuess.contactsLocation[contactIndex]))
+                = toEigen(*contactInputs.nominalPosition);
+        }
+
+        return true;
+    }
+
+    void startAsyncSolver()
+    {
+        // the output slots must contain the preallocated contact structure so that
+        // extractSolution() can iterate over the contacts
+        for (auto& slot : this->asyncSolver.outputMailbox.slots)
+        {
+            slot = this->output;
+        }
+
+        this->asyncSolver.isRunning.store(true, std::memory_order_release);
+        this->asyncSolver.thread = std::thread([this]() { this->solverLoop(); });
+    }
+
+    void stopAsyncSolver()
+    {
+        this->asyncSolver.isRunning.store(false, std::memory_order_release);
+        if (this->asyncSolver.thread.joinable())
+        {
+            this->asyncSolver.thread.join();
+        }
+    }
 };
 
 bool CentroidalMPC::initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
@@ -994,13 +1641,22 @@ bool CentroidalMPC::initialize(std::weak_ptr<const ParametersHandler::IParameter
     }
 
     m_pimpl->resizeControllerInputs();
-    m_pimpl->controller = m_pimpl->createController();
+    m_pimpl->controller = m_pimpl->createControllerWithCache();
+
+    if (m_pimpl->optiSettings.isAsyncModeEnabled)
+    {
+        m_pimpl->startAsyncSolver();
+    }
+
     m_pimpl->fsm = Impl::FSM::Initialized;
 
     return true;
 }
 
-CentroidalMPC::~CentroidalMPC() = default;
+CentroidalMPC::~CentroidalMPC()
+{
+    m_pimpl->stopAsyncSolver();
+}
 
 CentroidalMPC::CentroidalMPC()
 {
@@ -1031,6 +1687,41 @@ bool CentroidalMPC::advance()
         return false;
     }
 
+    if (m_pimpl->optiSettings.isAsyncModeEnabled)
+    {
+        // enqueue the current state in the solver thread mailbox. The copy of the inputs is
+        // performed element-wise so that, after the first ticks, the slot matrices are already
+        // allocated with the correct dimensions.
+        auto& snapshot = m_pimpl->asyncSolver.inputMailbox.producerData();
+        if (snapshot.inputs.size() != m_pimpl->vectorizedOptiInputs.size())
+        {
+            snapshot.inputs = m_pimpl->vectorizedOptiInputs;
+        } else
+        {
+            using namespace BipedalLocomotion::Conversions;
+            for (std::size_t i = 0; i < snapshot.inputs.size(); i++)
+            {
+                toEigen(snapshot.inputs[i]) = toEigen(m_pimpl->vectorizedOptiInputs[i]);
+            }
+        }
+        snapshot.contactPhaseList = m_pimpl->contactPhaseList;
+        snapshot.currentTime = m_pimpl->currentTime;
+        m_pimpl->asyncSolver.inputMailbox.publish();
+
+        // return the most recent completed solution, if any
+        CentroidalMPCOutput* solution = m_pimpl->asyncSolver.outputMailbox.take();
+        if (solution != nullptr)
+        {
+            m_pimpl->output = *solution;
+            m_pimpl->fsm = Impl::FSM::OutputValid;
+        }
+
+        // advance the time
+        m_pimpl->currentTime += m_pimpl->optiSettings.samplingTime;
+
+        return true;
+    }
+
     // invalidate the output
     m_pimpl->fsm = Impl::FSM::OutputInvalid;
 
@@ -1048,88 +1739,14 @@ bool CentroidalMPC::advance()
     }
 
     // get the solution
-    auto it = controllerOutput.begin();
-    m_pimpl->output.nextPlannedContact.clear();
-    for (auto& [key, contact] : m_pimpl->output.contacts)
+    if (!m_pimpl->extractSolution(controllerOutput,
+                                  m_pimpl->contactPhaseList,
+                                  m_pimpl->currentTime,
+                                  m_pimpl->output))
     {
-        // this is required for toEigen
-        using namespace BipedalLocomotion::Conversions;
-
-        int index = toEigen(*it).size();
-        const int size = toEigen(*it).size();
-        for (int i = 0; i < size; i++)
-        {
-            if (toEigen(*it)(i) > 0.5)
-            {
-                if (i == 0)
-                {
-                    break;
-                } else if (toEigen(*it)(i - 1) < 0.5)
-                {
-                    index = i;
-                    break;
-                }
-            }
-        }
-
-        double isEnabled = toEigen(*it)(0);
-        std::advance(it, 1);
-        contact.pose.translation(toEigen(*it).leftCols<1>());
-
-        if (index < size)
-        {
-            m_pimpl->output.nextPlannedContact[key].name = key;
-            m_pimpl->output.nextPlannedContact[key].pose.translation(toEigen(*it).col(index));
-        }
-
-        std::advance(it, 1);
-        contact.pose.quat(Eigen::Quaterniond(
-            Eigen::Map<const Eigen::Matrix3d>(toEigen(*it).leftCols<1>().data())));
-
-        if (index < size)
-        {
-            m_pimpl->output.nextPlannedContact[key].pose.quat(Eigen::Quaterniond(
-                Eigen::Map<const Eigen::Matrix3d>(toEigen(*it).leftCols<1>().data())));
-
-            const std::chrono::nanoseconds nextPlannedContactTime
-                = m_pimpl->currentTime + m_pimpl->optiSettings.samplingTime * index;
-
-            auto nextPlannedContact = m_pimpl->contactPhaseList.lists().at(key).getPresentContact(
-                nextPlannedContactTime);
-            if (nextPlannedContact == m_pimpl->contactPhaseList.lists().at(key).end())
-            {
-                log()->error("[CentroidalMPC::advance] Unable to get the next planned contact");
-                return false;
-            }
-
-            auto& contact = m_pimpl->output.nextPlannedContact[key];
-            contact.activationTime = nextPlannedContact->activationTime;
-            contact.deactivationTime = nextPlannedContact->deactivationTime;
-            contact.index = nextPlannedContact->index;
-            contact.type = nextPlannedContact->type;
-        }
-
-        std::advance(it, 1);
-
-        for (auto& corner : contact.corners)
-        {
-            // isEnabled == 1 means that the contact is active
-            if (isEnabled > 0.5)
-            {
-                corner.force = toEigen(*it).leftCols<1>();
-            } else
-            {
-                corner.force.setZero();
-            }
-            std::advance(it, 1);
-        }
+        return false;
     }
 
-    for (int i = 0; i < m_pimpl->output.comTrajectory.size(); i++)
-    {
-        using namespace BipedalLocomotion::Conversions;
-        m_pimpl->output.comTrajectory[i] = toEigen(*it).col(i);
-    }
     // advance the time
     m_pimpl->currentTime += m_pimpl->optiSettings.samplingTime;
 
@@ -1184,8 +1801,12 @@ bool CentroidalMPC::setReferenceTrajectory(const std::vector<Eigen::Vector3d>& c
             = Eigen::Map<const Eigen::Vector3d>(angularMomentum[i].data());
     }
 
-    // if the warmstart is enabled then the reference is used also as warmstart
-    if (m_pimpl->optiSettings.isWarmStartEnabled)
+    // if the warmstart is enabled then the reference is used also as warmstart. When the previous
+    // solution warm start is enabled and a solution is available, the shifted solution computed in
+    // advance() is kept instead.
+    if (m_pimpl->optiSettings.isWarmStartEnabled
+        && !(m_pimpl->optiSettings.isPreviousSolutionWarmStartEnabled
+             && m_pimpl->fsm == Impl::FSM::OutputValid))
     {
         using namespace BipedalLocomotion::Conversions;
         toEigen(*(m_pimpl->initialGuess.com)) = toEigen(*(m_pimpl->controllerInputs.comReference));
@@ -1196,6 +1817,50 @@ bool CentroidalMPC::setReferenceTrajectory(const std::vector<Eigen::Vector3d>& c
     return true;
 }
 
+bool CentroidalMPC::setInitialGuess(const std::vector<Eigen::Vector3d>& com,
+                                    const std::vector<Eigen::Vector3d>& angularMomentum)
+{
+    constexpr auto errorPrefix = "[CentroidalMPC::setInitialGuess]";
+    assert(m_pimpl);
+
+    const int stateHorizon = m_pimpl->optiSettings.horizon + 1;
+
+    if (m_pimpl->fsm == Impl::FSM::Idle)
+    {
+        log()->error("{} The controller is not initialized please call initialize() method.",
+                     errorPrefix);
+        return false;
+    }
+
+    if (!m_pimpl->optiSettings.isWarmStartEnabled)
+    {
+        log()->error("{} The warm start is not enabled. Please set 'is_warm_start_enabled' to "
+                     "true in the initialization.",
+                     errorPrefix);
+        return false;
+    }
+
+    if (com.size() < stateHorizon || angularMomentum.size() < stateHorizon)
+    {
+        log()->error("{} The CoM and the angular momentum trajectories should have at least {} "
+                     "elements. Provided sizes: CoM {}, angular momentum {}.",
+                     errorPrefix,
+                     stateHorizon,
+                     com.size(),
+                     angularMomentum.size());
+        return false;
+    }
+
+    for (int i = 0; i < stateHorizon; i++)
+    {
+        using namespace BipedalLocomotion::Conversions;
+        toEigen(*(m_pimpl->initialGuess.com)).col(i) = com[i];
+        toEigen(*(m_pimpl->initialGuess.angularMomentum)).col(i) = angularMomentum[i];
+    }
+
+    return true;
+}
+
 bool CentroidalMPC::setState(Eigen::Ref<const Eigen::Vector3d> com,
                              Eigen::Ref<const Eigen::Vector3d> dcom,
                              Eigen::Ref<const Eigen::Vector3d> angularMomentum)
@@ -1235,6 +1900,75 @@ bool CentroidalMPC::setState(Eigen::Ref<const Eigen::Vector3d> com,
     return true;
 }
 
+bool CentroidalMPC::updateContactTiming(const std::string& name,
+                                        const std::chrono::nanoseconds& newActivationTime,
+                                        const std::chrono::nanoseconds& newDeactivationTime)
+{
+    constexpr auto errorPrefix = "[CentroidalMPC::updateContactTiming]";
+    assert(m_pimpl);
+
+    if (m_pimpl->fsm == Impl::FSM::Idle)
+    {
+        log()->error("{} The controller is not initialized please call initialize() method.",
+                     errorPrefix);
+        return false;
+    }
+
+    auto contactIndex = m_pimpl->contactIndexMap.find(name);
+    if (contactIndex == m_pimpl->contactIndexMap.end())
+    {
+        log()->error("{} Unable to find a contact named {}.", errorPrefix, name);
+        return false;
+    }
+
+    auto lists = m_pimpl->contactPhaseList.lists();
+    auto list = lists.find(name);
+    if (list == lists.end())
+    {
+        log()->error("{} The contact phase list does not contain a list named {}.",
+                     errorPrefix,
+                     name);
+        return false;
+    }
+
+    // the edited contact is the one whose activation time is the closest to the new one. For
+    // timing-only re-plans the adjustment is small so this resolves to the intended step.
+    auto contactToEdit = list->second.cend();
+    std::chrono::nanoseconds smallestDistance = std::chrono::nanoseconds::max();
+    for (auto it = list->second.cbegin(); it != list->second.cend(); std::advance(it, 1))
+    {
+        const std::chrono::nanoseconds distance = it->activationTime > newActivationTime
+                                                      ? it->activationTime - newActivationTime
+                                                      : newActivationTime - it->activationTime;
+        if (distance < smallestDistance)
+        {
+            smallestDistance = distance;
+            contactToEdit = it;
+        }
+    }
+
+    if (contactToEdit == list->second.cend())
+    {
+        log()->error("{} The contact list named {} is empty.", errorPrefix, name);
+        return false;
+    }
+
+    Contacts::PlannedContact editedContact = *contactToEdit;
+    editedContact.activationTime = newActivationTime;
+    editedContact.deactivationTime = newDeactivationTime;
+
+    if (!list->second.editContact(contactToEdit, editedContact))
+    {
+        log()->error("{} Unable to edit the timing of the contact named {}.", errorPrefix, name);
+        return false;
+    }
+
+    m_pimpl->contactPhaseList.setLists(lists);
+
+    // only the knot masks and the time-varying parameters of the edited contact are recomputed
+    return m_pimpl->fillContactKnots(contactIndex->second, name);
+}
+
 bool CentroidalMPC::setContactPhaseList(const Contacts::ContactPhaseList& contactPhaseList)
 {
     constexpr auto errorPrefix = "[CentroidalMPC::setContactPhaseList]";
@@ -1261,29 +1995,29 @@ bool CentroidalMPC::setContactPhaseList(const Contacts::ContactPhaseList& contac
     auto& inputs = m_pimpl->controllerInputs;
 
     // clear previous data
-    for (const auto& [key, contact] : m_pimpl->output.contacts)
+    for (auto& contact : inputs.contacts)
     {
         using namespace BipedalLocomotion::Conversions;
 
         // initialize the current contact pose to zero. If the contact is active the current
         // position will be set later on
-        toEigen(*inputs.contacts[key].currentPosition).setZero();
+        toEigen(*contact.currentPosition).setZero();
 
         // initialize all the orientation to the identity
-        toEigen(*inputs.contacts[key].orientation).colwise()
+        toEigen(*contact.orientation).colwise()
             = Eigen::Map<const Eigen::VectorXd>(identity.data(), identity.cols() * identity.rows());
 
         // Upper limit of the position of the contact. It is expressed in the contact body frame
-        toEigen(*inputs.contacts[key].upperLimitPosition).setZero();
+        toEigen(*contact.upperLimitPosition).setZero();
 
         // Lower limit of the position of the contact. It is expressed in the contact body frame
-        toEigen(*inputs.contacts[key].lowerLimitPosition).setZero();
+        toEigen(*contact.lowerLimitPosition).setZero();
 
         // Maximum admissible contact force. It is expressed in the contact body frame
-        toEigen(*inputs.contacts[key].isEnabled).setZero();
+        toEigen(*contact.isEnabled).setZero();
 
         // The nominal contact position is a parameter that regularize the solution
-        toEigen(*inputs.contacts[key].nominalPosition).setZero();
+        toEigen(*contact.nominalPosition).setZero();
     }
 
     const std::chrono::nanoseconds absoluteTimeHorizon
@@ -1319,25 +2053,26 @@ bool CentroidalMPC::setContactPhaseList(const Contacts::ContactPhaseList& contac
         {
             using namespace BipedalLocomotion::Conversions;
 
-            auto inputContact = inputs.contacts.find(key);
-            if (inputContact == inputs.contacts.end())
+            auto inputContactIndex = m_pimpl->contactIndexMap.find(key);
+            if (inputContactIndex == m_pimpl->contactIndexMap.end())
             {
                 log()->error("{} Unable to find the input contact named {}.", errorPrefix, key);
                 return false;
             }
+            auto& inputContact = inputs.contacts[inputContactIndex->second];
 
-            toEigen(*(inputContact->second.nominalPosition))
+            toEigen(*(inputContact.nominalPosition))
                 .middleCols(index, numberOfSamples + 1)
                 .colwise()
                 = contact->pose.translation();
 
             // this is required to reshape the matrix into a vector
             const Eigen::Matrix3d orientation = contact->pose.quat().toRotationMatrix();
-            toEigen(*(inputContact->second.orientation)).middleCols(index, numberOfSamples).colwise()
+            toEigen(*(inputContact.orientation)).middleCols(index, numberOfSamples).colwise()
                 = Eigen::Map<const Eigen::VectorXd>(orientation.data(), orientation.size());
 
             constexpr double isEnabled = 1;
-            toEigen(*(inputContact->second.isEnabled))
+            toEigen(*(inputContact.isEnabled))
                 .middleCols(index, numberOfSamples)
                 .setConstant(isEnabled);
         }
@@ -1348,27 +2083,29 @@ bool CentroidalMPC::setContactPhaseList(const Contacts::ContactPhaseList& contac
     assert(index == m_pimpl->optiSettings.horizon);
 
     // set the current contact position to for the active contact only
-    for (auto& [key, contact] : inputs.contacts)
+    for (std::size_t i = 0; i < inputs.contacts.size(); i++)
     {
         using namespace BipedalLocomotion::Conversions;
 
+        auto& contact = inputs.contacts[i];
         toEigen(*contact.currentPosition) = toEigen(*contact.nominalPosition).leftCols<1>();
 
         // if warmstart is enabled the contact location is used as warmstart to initialize the
         // problem
         if (m_pimpl->optiSettings.isWarmStartEnabled)
         {
-            toEigen(*(m_pimpl->initialGuess.contactsLocation[key]))
+            toEigen(*(m_pimpl->initialGuess.contactsLocation[i]))
                 = toEigen(*contact.nominalPosition);
         }
     }
 
     // TODO this part can be improved. For instance you do not need to fill the vectors every time.
-    for (auto& [key, contact] : inputs.contacts)
+    for (std::size_t i = 0; i < inputs.contacts.size(); i++)
     {
         using namespace BipedalLocomotion::Conversions;
 
-        const auto& boundingBox = m_pimpl->contactBoundingBoxes.at(key);
+        auto& contact = inputs.contacts[i];
+        const auto& boundingBox = m_pimpl->contactBoundingBoxByIndex[i];
         toEigen(*contact.upperLimitPosition).colwise() = boundingBox.upperLimit;
         toEigen(*contact.lowerLimitPosition).colwise() = boundingBox.lowerLimit;
     }
@@ -0,0 +1,213 @@
+/**
+ * @file CentroidalMPCBenchmarkTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/Contacts/ContactPhaseList.h>
+#include <BipedalLocomotion/Math/Wrench.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/ReducedModelControllers/CentroidalMPC.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::ReducedModelControllers;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+constexpr std::chrono::nanoseconds dT = 100ms;
+
+std::shared_ptr<IParametersHandler> createMPCParameterHandler()
+{
+    std::shared_ptr<IParametersHandler> handler = std::make_shared<StdImplementation>();
+    handler->setParameter("sampling_time", dT);
+    handler->setParameter("time_horizon", 1s + 250ms);
+    handler->setParameter("number_of_maximum_contacts", 2);
+    handler->setParameter("number_of_slices", 1);
+    handler->setParameter("static_friction_coefficient", 0.33);
+    handler->setParameter("solver_verbosity", 0);
+    handler->setParameter("linear_solver", "mumps");
+    handler->setParameter("is_warm_start_enabled", true);
+
+    const std::vector<std::string> contactNames{"left_foot", "right_foot"};
+    for (int i = 0; i < contactNames.size(); i++)
+    {
+        auto contactHandler = std::make_shared<StdImplementation>();
+        contactHandler->setParameter("number_of_corners", 4);
+        contactHandler->setParameter("contact_name", contactNames[i]);
+        contactHandler->setParameter("corner_0", std::vector<double>{0.1, 0.05, 0});
+        contactHandler->setParameter("corner_1", std::vector<double>{0.1, -0.05, 0});
+        contactHandler->setParameter("corner_2", std::vector<double>{-0.1, -0.05, 0});
+        contactHandler->setParameter("corner_3", std::vector<double>{-0.1, 0.05, 0});
+        contactHandler->setParameter("bounding_box_lower_limit", std::vector<double>{0, 0, 0});
+        contactHandler->setParameter("bounding_box_upper_limit", std::vector<double>{0, 0, 0});
+        handler->setGroup("CONTACT_" + std::to_string(i), contactHandler);
+    }
+
+    handler->setParameter("com_weight", std::vector<double>{1, 1, 1000});
+    handler->setParameter("contact_position_weight", 1e3);
+    handler->setParameter("force_rate_of_change_weight", std::vector<double>{10, 10, 10});
+    handler->setParameter("angular_momentum_weight", 1e5);
+    handler->setParameter("contact_force_symmetry_weight", 10.0);
+
+    return handler;
+}
+
+/**
+ * Build a phase list with both feet in contact for the whole duration.
+ */
+BipedalLocomotion::Contacts::ContactPhaseList createDoubleSupportScenario()
+{
+    BipedalLocomotion::Contacts::ContactListMap contactListMap;
+
+    manif::SE3d leftTransform(Eigen::Vector3d{0, 0.08, 0}, manif::SO3d::Identity());
+    contactListMap["left_foot"].addContact(leftTransform, 0s, 120s);
+
+    manif::SE3d rightTransform(Eigen::Vector3d{0, -0.08, 0}, manif::SO3d::Identity());
+    contactListMap["right_foot"].addContact(rightTransform, 0s, 120s);
+
+    BipedalLocomotion::Contacts::ContactPhaseList phaseList;
+    phaseList.setLists(contactListMap);
+    return phaseList;
+}
+
+/**
+ * Build a phase list with alternated single support phases so that the controller experiences
+ * contact switches inside the horizon.
+ */
+BipedalLocomotion::Contacts::ContactPhaseList createWalkingScenario()
+{
+    BipedalLocomotion::Contacts::ContactListMap contactListMap;
+
+    Eigen::Vector3d leftPosition{0, 0.08, 0};
+    manif::SE3d leftTransform(leftPosition, manif::SO3d::Identity());
+    contactListMap["left_foot"].addContact(leftTransform, 0s, 1s);
+    for (int i = 0; i < 15; i++)
+    {
+        leftPosition(0) += 0.05;
+        leftTransform.translation(leftPosition);
+        contactListMap["left_foot"].addContact(leftTransform, 2s + i * 4s, 5s + i * 4s);
+    }
+
+    Eigen::Vector3d rightPosition{0, -0.08, 0};
+    manif::SE3d rightTransform(rightPosition, manif::SO3d::Identity());
+    contactListMap["right_foot"].addContact(rightTransform, 0s, 3s);
+    for (int i = 0; i < 15; i++)
+    {
+        rightPosition(0) += 0.05;
+        rightTransform.translation(rightPosition);
+        contactListMap["right_foot"].addContact(rightTransform, 4s + i * 4s, 7s + i * 4s);
+    }
+
+    BipedalLocomotion::Contacts::ContactPhaseList phaseList;
+    phaseList.setLists(contactListMap);
+    return phaseList;
+}
+
+struct LatencyStatistics
+{
+    std::chrono::nanoseconds p50;
+    std::chrono::nanoseconds p95;
+    std::chrono::nanoseconds p99;
+};
+
+LatencyStatistics computeStatistics(std::vector<std::chrono::nanoseconds> latencies)
+{
+    auto percentile = [&latencies](double fraction) {
+        const std::size_t index = std::min<std::size_t>(latencies.size() - 1,
+                                                        fraction * latencies.size());
+        std::nth_element(latencies.begin(), latencies.begin() + index, latencies.end());
+        return latencies[index];
+    };
+
+    return {percentile(0.50), percentile(0.95), percentile(0.99)};
+}
+
+/**
+ * Run the MPC for the given number of ticks and collect the advance() latency distribution.
+ * @param disturbance external force applied to the CoM from tick 20 on to trigger re-planning.
+ */
+void runScenario(const std::string& scenarioName,
+                 const BipedalLocomotion::Contacts::ContactPhaseList& phaseList,
+                 const Eigen::Vector3d& disturbance,
+                 int numberOfTicks)
+{
+    CentroidalMPC mpc;
+    REQUIRE(mpc.initialize(createMPCParameterHandler()));
+    REQUIRE(mpc.setContactPhaseList(phaseList));
+
+    const int stateHorizon = 13;
+    Eigen::Vector3d com{0, 0, 0.53};
+    const Eigen::Vector3d dcom = Eigen::Vector3d::Zero();
+    const Eigen::Vector3d angularMomentum = Eigen::Vector3d::Zero();
+
+    std::vector<Eigen::Vector3d> comReference(numberOfTicks + stateHorizon, com);
+    std::vector<Eigen::Vector3d> angularMomentumReference(numberOfTicks + stateHorizon,
+                                                          Eigen::Vector3d::Zero());
+
+    std::vector<std::chrono::nanoseconds> latencies;
+    latencies.reserve(numberOfTicks);
+
+    BipedalLocomotion::Math::Wrenchd externalWrench = BipedalLocomotion::Math::Wrenchd::Zero();
+
+    for (int tick = 0; tick < numberOfTicks; tick++)
+    {
+        if (tick >= 20)
+        {
+            externalWrench.force() = disturbance;
+        }
+
+        REQUIRE(mpc.setState(com, dcom, angularMomentum, externalWrench));
+        REQUIRE(mpc.setReferenceTrajectory({comReference.begin() + tick, comReference.end()},
+                                           {angularMomentumReference.begin() + tick,
+                                            angularMomentumReference.end()}));
+
+        const auto start = std::chrono::steady_clock::now();
+        REQUIRE(mpc.advance());
+        const auto end = std::chrono::steady_clock::now();
+        latencies.push_back(end - start);
+
+        REQUIRE(mpc.isOutputValid());
+    }
+
+    const LatencyStatistics stats = computeStatistics(std::move(latencies));
+    BipedalLocomotion::log()->info("[benchmark_CentroidalMPC] {}: advance() latency p50 = {} us, "
+                                   "p95 = {} us, p99 = {} us",
+                                   scenarioName,
+                                   std::chrono::duration_cast<std::chrono::microseconds>(stats.p50)
+                                       .count(),
+                                   std::chrono::duration_cast<std::chrono::microseconds>(stats.p95)
+                                       .count(),
+                                   std::chrono::duration_cast<std::chrono::microseconds>(stats.p99)
+                                       .count());
+}
+
+} // namespace
+
+TEST_CASE("CentroidalMPC benchmark - steady double support")
+{
+    runScenario("steady double support", createDoubleSupportScenario(), Eigen::Vector3d::Zero(), 40);
+}
+
+TEST_CASE("CentroidalMPC benchmark - single support switches")
+{
+    runScenario("single support switches", createWalkingScenario(), Eigen::Vector3d::Zero(), 40);
+}
+
+TEST_CASE("CentroidalMPC benchmark - disturbance re-planning")
+{
+    runScenario("disturbance re-planning",
+                createWalkingScenario(),
+                Eigen::Vector3d{15.0, 0.0, 0.0},
+                40);
+}
@@ -139,6 +139,20 @@ TEST_CASE("CentroidalMPC")
 
     REQUIRE(mpc.initialize(handler));
 
+    // the move blocking knot groups must sum to the number of knots of the horizon (12 in this
+    // test)
+    {
+        CentroidalMPC mpcMoveBlocking;
+        handler->setParameter("force_move_blocking_sizes", std::vector<int>{1, 1, 2, 4});
+        REQUIRE_FALSE(mpcMoveBlocking.initialize(handler));
+
+        handler->setParameter("force_move_blocking_sizes", std::vector<int>{1, 1, 2, 4, 4});
+        REQUIRE(mpcMoveBlocking.initialize(handler));
+
+        // restore the dense transcription for the rest of the test
+        handler->setParameter("force_move_blocking_sizes", std::vector<int>{});
+    }
+
     BipedalLocomotion::Contacts::ContactPhaseList phaseList;
     BipedalLocomotion::Contacts::ContactListMap contactListMap;
 
@@ -138,6 +138,44 @@ public:
                        cv::Mat& depthImg,
                        std::optional<std::reference_wrapper<double>> receiveTimeInSeconds = {}) final;
 
+    /**
+     * Get a zero-copy view of the color image of the camera.
+     * The returned matrix is a header over the internal image buffer: no pixel is copied and no
+     * color conversion is applied, so the pixel order is the one delivered by the YARP interface
+     * (RGB for the frame grabber cameras).
+     * @param[in] camName name of the camera
+     * @param[out] colorImg view of the internal image buffer
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @param[in] pyramidLevel number of pyrDown halvings applied before returning the image. When
+     * it is greater than zero the image is downscaled into a preallocated pyramid and the returned
+     * matrix is a view of the pyramid buffer.
+     * @warning The view aliases memory owned by the bridge and remains valid only until the next
+     * read of the same camera. Clone the matrix if the data must outlive the next call.
+     * @return true/false in case of success/failure
+     */
+    bool getColorImageView(const std::string& camName,
+                           cv::Mat& colorImg,
+                           std::optional<std::reference_wrapper<double>> receiveTimeInSeconds = {},
+                           const std::size_t pyramidLevel = 0);
+
+    /**
+     * Get a zero-copy view of the depth image of the camera.
+     * The returned matrix is a header over the internal image buffer: no pixel is copied.
+     * @param[in] camName name of the camera
+     * @param[out] depthImg view of the internal depth buffer (CV_32FC1)
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @param[in] pyramidLevel number of pyrDown halvings applied before returning the image. When
+     * it is greater than zero the image is downscaled into a preallocated pyramid and the returned
+     * matrix is a view of the pyramid buffer.
+     * @warning The view aliases memory owned by the bridge and remains valid only until the next
+     * read of the same camera. Clone the matrix if the data must outlive the next call.
+     * @return true/false in case of success/failure
+     */
+    bool getDepthImageView(const std::string& camName,
+                           cv::Mat& depthImg,
+                           std::optional<std::reference_wrapper<double>> receiveTimeInSeconds = {},
+                           const std::size_t pyramidLevel = 0);
+
 private:
     /** Private implementation */
     struct Impl;
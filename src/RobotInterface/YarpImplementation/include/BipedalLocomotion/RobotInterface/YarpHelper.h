@@ -9,8 +9,11 @@
 #define BIPEDAL_LOCOMOTION_ROBOT_INTERFACE_YARP_HELPER_H
 
 // std
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 // YARP
 #include <yarp/dev/PolyDriver.h>
@@ -180,6 +183,26 @@ PolyDriverDescriptor constructMultipleAnalogSensorsRemapper(
 PolyDriverDescriptor constructRDGBSensorClient(
     std::weak_ptr<const BipedalLocomotion::ParametersHandler::IParametersHandler> handler);
 
+/**
+ * Helper function that opens several independent PolyDriver devices concurrently. Each remote
+ * device open costs network round-trips, so opening the devices sequentially makes the bring-up
+ * time grow with the number of devices; this function runs one builder per thread so that the
+ * bring-up is bounded by the slowest single device.
+ * @param builders a list of callables, each building one device. The usual construct functions of
+ * this file can be passed after binding their parameter handler, e.g. with a lambda.
+ * @param timeout time budget for the whole bring-up. When the budget expires the devices still
+ * opening are reported as failed and abandoned without blocking the caller; their builders keep
+ * running on a detached thread until completion so that the associated resources are released.
+ * A zero timeout (the default) waits for all the devices without a budget.
+ * @note the failures are aggregated in a single error message listing the indices of the builders
+ * that failed or timed out.
+ * @return A vector containing one PolyDriverDescriptor per builder, in the same order. The
+ * descriptors of the devices that failed to open or timed out are invalid.
+ */
+std::vector<PolyDriverDescriptor> constructPolyDriversInParallel(
+    const std::vector<std::function<PolyDriverDescriptor()>>& builders,
+    const std::chrono::nanoseconds& timeout = std::chrono::nanoseconds::zero());
+
 } // namespace RobotInterface
 } // namespace BipedalLocomotion
 
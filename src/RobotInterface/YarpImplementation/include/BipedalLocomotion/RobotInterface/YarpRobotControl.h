@@ -49,6 +49,7 @@ public:
      * |:--------------------------------------:|:--------:|:--------------------------------------------------------------------------------------------:|:---------:|
      * |            `reading_timeout`           |   `int`  |    Timeout used while reading from the YARP interfaces in microseconds. (Positive Number)    |     No    |
      * |         `max_reading_attempts`         |   `int`  |      Max number of attempts used for reading from the YARP interfaces. (Positive Number)     |     No    |
+     * |        `write_warning_threshold`       | `double` | A warning is printed when a group reference write takes longer than this threshold [seconds] |     No    |
      * |         `positioning_duration`         | `double` | Duration of the trajectory generated when the joint is controlled in position mode [seconds] |    Yes    |
      * |         `positioning_tolerance`        | `double` |                    Max Admissible error for position control joint [rad]                     |    Yes    |
      * | `position_direct_max_admissible_error` | `double` |                 Max admissible error for position direct control joint [rad]                 |    Yes    |
@@ -92,6 +93,45 @@ public:
      */
     bool setControlMode(const IRobotControl::ControlMode& mode) final;
 
+    /**
+     * State of the asynchronous control mode switch started with setControlModeAsync().
+     */
+    enum class ControlModeSwitchState
+    {
+        Idle, /**< No asynchronous switch has been requested yet. */
+        Running, /**< The switch is executing on the background thread. */
+        Succeeded, /**< The last asynchronous switch completed successfully. */
+        Failed /**< The last asynchronous switch failed. */
+    };
+
+    /**
+     * Set the control mode without blocking the calling thread. The bulk mode switch RPC is
+     * executed on a background thread, the progress can be polled with
+     * getControlModeSwitchState().
+     * @param controlModes vector containing the control mode for each joint.
+     * @return True if the switch has been started (or the robot is already in the desired modes),
+     * false if another switch is still running.
+     * @warning Do not call setReferences() or setControlMode() until
+     * getControlModeSwitchState() reports that the switch completed.
+     */
+    bool setControlModeAsync(const std::vector<IRobotControl::ControlMode>& controlModes);
+
+    /**
+     * Set the same control mode for all the joints without blocking the calling thread.
+     * @param controlMode a control mode for all the joints.
+     * @return True if the switch has been started (or the robot is already in the desired mode),
+     * false if another switch is still running.
+     * @warning Do not call setReferences() or setControlMode() until
+     * getControlModeSwitchState() reports that the switch completed.
+     */
+    bool setControlModeAsync(const IRobotControl::ControlMode& mode);
+
+    /**
+     * Get the state of the asynchronous control mode switch.
+     * @return the current ControlModeSwitchState.
+     */
+    ControlModeSwitchState getControlModeSwitchState() const;
+
     /**
      * Set the desired reference.
      * @param jointValues desired joint values.
@@ -101,6 +141,13 @@ public:
      * control in rad/s. If the robot is controlled in torques, the desired joint values are
      * expressed in Nm. If the robot is controlled in PWM, the desired joint values are
      * between -100 and 100.
+     * @note The joint encoders are read only if at least one joint is controlled in Position or
+     * PositionDirect, since the position feedback is used only by those control modes. When the
+     * references are streamed in Torque, Current, PWM or Velocity the references are scattered
+     * into preallocated buffers and forwarded to the control board without blocking reads.
+     * @note When more than one control mode is active, the group writes are dispatched
+     * concurrently on persistent worker threads and the function returns when all of them
+     * completed, so the wall time is the slowest write and not the sum.
      * @warning At the current stage only revolute joints are supported.
      */
     bool setReferences(Eigen::Ref<const Eigen::VectorXd> jointValues,
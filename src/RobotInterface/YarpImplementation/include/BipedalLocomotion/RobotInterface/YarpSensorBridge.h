@@ -51,6 +51,14 @@ namespace RobotInterface
  * |     Group                  |         Parameter               | Type              |                   Description                   |
  * |:--------------------------:|:-------------------------------:|:-----------------:|:---------------------------------------------- :|
  * |                            |check_for_nan                    | boolean           |flag to activate checking for NANs in the incoming measurement buffers, not applicable for images|
+ * |                            |use_acquisition_thread           | boolean           |This parameter is **optional**. Flag to activate the internal acquisition thread that continuously reads the sensors into a lock-free buffer so that advance() becomes a constant time buffer flip (default false)|
+ * |                            |acquisition_thread_period        | chrono::nanoseconds |This parameter is **optional**. Period of the internal acquisition thread (default 1ms). Used only if use_acquisition_thread is true|
+ * |                            |read_period_inertials            | chrono::nanoseconds |This parameter is **optional**. Declared period of the inertial streams. advance() skips the interface reads until the period has elapsed, the buffers keep the previously read values. If not provided the stream is read at every advance() call|
+ * |                            |read_period_cartesian_wrenches   | chrono::nanoseconds |This parameter is **optional**. Declared period of the cartesian wrench streams. See read_period_inertials|
+ * |                            |read_period_forcetorque_sensors  | chrono::nanoseconds |This parameter is **optional**. Declared period of the six axis FT streams. See read_period_inertials|
+ * |                            |read_period_temperatures         | chrono::nanoseconds |This parameter is **optional**. Declared period of the temperature streams. See read_period_inertials|
+ * |                            |motor_currents_change_epsilon    | double            |This parameter is **optional**. Minimum absolute change of the motor currents (infinity norm, in ampere) incrementing the generation counter returned by getMotorCurrentsGeneration() (default 0.0)|
+ * |                            |temperatures_change_epsilon      | double            |This parameter is **optional**. Minimum absolute change of the temperature measurements (infinity norm, in degrees) incrementing the generation counter returned by getTemperaturesGeneration() (default 0.0)|
  * |                            |stream_joint_states              | boolean           |Flag to activate the attachment to remapped control boards for joint states reading     |
  * |                            |stream_inertials                 | boolean           |Flag to activate the attachment to IMU sensor devices       |
  * |                            |stream_cartesian_wrenches        | boolean           |Flag to activate the attachment to Cartesian wrench related devices       |
@@ -104,6 +112,11 @@ public:
 
     /**
      * @brief Advance the internal state. This may change the value retrievable from get().
+     * @note When the acquisition thread is enabled, advance() does not touch the YARP interfaces.
+     * It performs a constant time flip of the lock-free buffer and returns the freshest coherent
+     * sample published by the acquisition thread, whose age is available through
+     * getSnapshotAgeInSeconds(). In this mode the measurements must be accessed through
+     * readSnapshot(), since the per-sensor getters read buffers owned by the acquisition thread.
      * @return True if the advance is successful.
      */
     bool advance() final;
@@ -120,6 +133,78 @@ public:
      */
     std::vector<std::string> getFailedSensorReads() const;
 
+    /**
+     * Read all the configured sensor streams in a single pass over the YARP interfaces and fill
+     * the snapshot with a coherent timestamp. This is equivalent to calling advance() followed by
+     * every single-stream getter, without the per-call validity checks and copies.
+     * @param[out] snapshot preallocated snapshot filled with the measurements.
+     * @note The snapshot buffers can be preallocated once with SensorSnapshot::resize() using the
+     * meta data returned by getOutput(). The sensors that failed to be read are available through
+     * getFailedSensorReads().
+     * @note When the acquisition thread is enabled, the snapshot is the freshest coherent sample
+     * published through the lock-free buffer and the YARP interfaces are not accessed by the
+     * calling thread.
+     * @return true/false in case of success/failure
+     */
+    bool readSnapshot(SensorSnapshot& snapshot) final;
+
+    /**
+     * Get the age of the latest snapshot, i.e. the time elapsed since its measurements were
+     * received. When the acquisition thread is enabled, this allows the consumer to compensate for
+     * the staleness of the sample returned by the buffer flip.
+     * @return the age in seconds, or infinity if no snapshot has been taken yet.
+     */
+    double getSnapshotAgeInSeconds() const;
+
+    /**
+     * Get the timestamps associated to the latest read of a sensor stream.
+     * The hardware timestamp is the one reported by the device driver, while the received
+     * timestamp is the time at which the bridge read the measurement. The latest encoder
+     * timestamp of the remapped control board is exposed under the stream name "control_board".
+     * @param[in] streamName name of the sensor, or "control_board" for the encoder stream
+     * @param[out] hardwareTimeInSeconds device-side timestamp of the latest measurement. It is
+     * negative when the underlying interface does not provide one (e.g. analog and generic
+     * sensors).
+     * @param[out] receivedTimeInSeconds time at which the latest measurement was received
+     * @return true/false in case of success/failure
+     */
+    bool getStreamTimestamps(const std::string& streamName,
+                             double& hardwareTimeInSeconds,
+                             double& receivedTimeInSeconds) const;
+
+    /**
+     * Get the accumulated hardware-to-receive latency histogram of a sensor stream.
+     * The histogram is updated at every read of the streams whose interfaces report a device-side
+     * timestamp, and allows to attribute the sensor-to-consumer latency at runtime.
+     * @param[in] streamName name of the sensor, or "control_board" for the encoder stream
+     * @param[out] latencyCounts number of samples accumulated in each bin. The last bin
+     * accumulates all the samples exceeding the histogram range.
+     * @param[out] binWidthInSeconds width of each histogram bin
+     * @return true/false in case of success/failure
+     */
+    bool getStreamLatencyHistogram(const std::string& streamName,
+                                   std::vector<std::size_t>& latencyCounts,
+                                   double& binWidthInSeconds) const;
+
+    /**
+     * Get the generation counter of the motor currents stream.
+     * The counter is incremented whenever the latest motor currents differ from the previously
+     * published ones by more than the motor_currents_change_epsilon parameter, so a consumer can
+     * skip processing the stream when the counter did not change since its last query.
+     * @return the generation counter. It is zero until the first measurement is read.
+     */
+    std::size_t getMotorCurrentsGeneration() const;
+
+    /**
+     * Get the generation counter of the temperature stream.
+     * The counter is incremented whenever the latest temperature measurements differ from the
+     * previously published ones by more than the temperatures_change_epsilon parameter, so a
+     * consumer can skip processing the stream when the counter did not change since its last
+     * query.
+     * @return the generation counter. It is zero until the first measurement is read.
+     */
+    std::size_t getTemperaturesGeneration() const;
+
     /**
      * @brief Get the object.
      * @return a const reference of the requested object.
@@ -287,6 +372,78 @@ public:
     bool getJointAccelerations(Eigen::Ref<Eigen::VectorXd> jointAccelerations,
                                OptionalDoubleRef receiveTimeInSeconds = {}) final;
 
+    /**
+     * Register a named subset of the joints available through the bridge.
+     * The indices mapping the subset to the full joints list are computed once at registration
+     * time, so that reading the subset measurements does not perform any per-call joint name
+     * lookup.
+     * @param[in] subsetName unique name identifying the subset
+     * @param[in] jointsList list of the joints belonging to the subset, in the desired output order
+     * @param[out] subsetHandle handle to be used to read the subset measurements
+     * @return true/false in case of success/failure
+     */
+    bool registerJointSubset(const std::string& subsetName,
+                             const std::vector<std::string>& jointsList,
+                             JointSubsetHandle& subsetHandle) final;
+
+    /**
+     * Get the handle of a joint subset previously registered with registerJointSubset()
+     * @param[in] subsetName name of the subset
+     * @param[out] subsetHandle handle associated to the subset
+     * @return true/false in case of success/failure
+     */
+    bool getJointSubsetHandle(const std::string& subsetName, JointSubsetHandle& subsetHandle) final;
+
+    /**
+     * Get the positions in radians of a registered joint subset
+     * @param[in] subsetHandle handle obtained from registerJointSubset()
+     * @param[out] jointPositions subset joints' position in radians, ordered as the registered list
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @warning the user must pass an argument "jointPositions" resized to the subset size
+     * @return true/false in case of success/failure
+     */
+    bool getJointPositions(const JointSubsetHandle subsetHandle,
+                           Eigen::Ref<Eigen::VectorXd> jointPositions,
+                           OptionalDoubleRef receiveTimeInSeconds = {}) final;
+
+    /**
+     * Get the velocities in rad/s of a registered joint subset
+     * @param[in] subsetHandle handle obtained from registerJointSubset()
+     * @param[out] jointVelocities subset joints' velocities in radians per second, ordered as the
+     * registered list
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @warning the user must pass an argument "jointVelocities" resized to the subset size
+     * @return true/false in case of success/failure
+     */
+    bool getJointVelocities(const JointSubsetHandle subsetHandle,
+                            Eigen::Ref<Eigen::VectorXd> jointVelocities,
+                            OptionalDoubleRef receiveTimeInSeconds = {}) final;
+
+    /**
+     * Get the accelerations in rad/s^2 of a registered joint subset
+     * @param[in] subsetHandle handle obtained from registerJointSubset()
+     * @param[out] jointAccelerations subset joints' accelerations in radians per second squared,
+     * ordered as the registered list
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @warning the user must pass an argument "jointAccelerations" resized to the subset size
+     * @return true/false in case of success/failure
+     */
+    bool getJointAccelerations(const JointSubsetHandle subsetHandle,
+                               Eigen::Ref<Eigen::VectorXd> jointAccelerations,
+                               OptionalDoubleRef receiveTimeInSeconds = {}) final;
+
+    /**
+     * Get the torques in Nm of a registered joint subset
+     * @param[in] subsetHandle handle obtained from registerJointSubset()
+     * @param[out] jointTorques subset joints' torque in Nm, ordered as the registered list
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @warning the user must pass an argument "jointTorques" resized to the subset size
+     * @return true/false in case of success/failure
+     */
+    bool getJointTorques(const JointSubsetHandle subsetHandle,
+                         Eigen::Ref<Eigen::VectorXd> jointTorques,
+                         OptionalDoubleRef receiveTimeInSeconds = {}) final;
+
     /**
      * Get IMU measurement
      * The serialization of measurments is as follows,
@@ -359,6 +516,25 @@ public:
                                           Eigen::Ref<Vector6d> ftMeasurement,
                                           OptionalDoubleRef receiveTimeInSeconds = {}) final;
 
+    /**
+     * Get all the six axis force torque measurements stacked in a single contiguous vector.
+     * The wrenches are stored one after the other following the order of the list returned by
+     * getSixAxisForceTorqueSensorsList(), so that the serialization is fixed at configuration
+     * time and the downstream math can operate on one contiguous block.
+     * @param[out] ftMeasurements stacked FT measurements of size 6 * number of FT sensors
+     * @param[out] validityMask one flag per FT sensor, following the same order of the stacked
+     * vector, set to false when no measurement has been received yet from the sensor. The
+     * associated segment of the stacked vector is zeroed.
+     * @param[out] receiveTimeInSeconds time at which the most recent of the stacked measurements
+     * was received
+     * @warning the user must pass an argument "ftMeasurements" resized to 6 times the number of
+     * configured FT sensors
+     * @return true/false in case of success/failure
+     */
+    bool getSixAxisForceTorqueMeasurementsStacked(Eigen::Ref<Eigen::VectorXd> ftMeasurements,
+                                                  std::vector<bool>& validityMask,
+                                                  OptionalDoubleRef receiveTimeInSeconds = {});
+
     /**
      * Get three axis force-torque measurement containing normal force (N) and tangential moments
      * (Nm)
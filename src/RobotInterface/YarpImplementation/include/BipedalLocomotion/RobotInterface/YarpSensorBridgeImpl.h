@@ -11,6 +11,7 @@
 #include <BipedalLocomotion/GenericContainer/Vector.h>
 #include <BipedalLocomotion/RobotInterface/YarpSensorBridge.h>
 #include <BipedalLocomotion/System/Clock.h>
+#include <BipedalLocomotion/System/LockFreeSharedResource.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 // YARP os
@@ -43,8 +44,11 @@
 
 // std
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <set>
+#include <thread>
 
 namespace BipedalLocomotion
 {
@@ -137,11 +141,29 @@ struct YarpSensorBridge::Impl
         Eigen::VectorXd pidPositionErrorsUnordered;
         Eigen::VectorXd motorPWMsUnordered;
 
+        Eigen::VectorXd encoderTimestampsUnordered; /**< per-joint encoder timestamps reported by
+                                                       the device driver */
+
         double receivedTimeInSeconds;
+        double hardwareTimeInSeconds{-1.0}; /**< latest per-joint encoder timestamp reported by
+                                               the device driver */
     };
 
     ControlBoardRemapperMeasures controlBoardRemapperMeasures;
 
+    /**
+     * Joint-selection view registered through YarpSensorBridge::registerJointSubset. The gather
+     * indices map every subset joint to its position in the configured joints list and are
+     * computed once at registration time.
+     */
+    struct JointSubset
+    {
+        std::string name; /**< unique name of the subset */
+        Eigen::VectorXi gatherIndices; /**< index of every subset joint in the full joints list */
+    };
+
+    std::vector<JointSubset> jointSubsets; /**< registered joint subsets, indexed by handle */
+
     /**< map of IMU sensors attached through generic sensor interfaces */
     std::unordered_map<std::string, yarp::dev::IGenericSensor*> analogIMUInterface;
 
@@ -182,6 +204,238 @@ struct YarpSensorBridge::Impl
     bool checkForNAN{false}; /**< flag to enable search for NANs in the incoming measurement buffers
                               */
 
+    /**
+     * Declared read period for each sensor stream. A non-positive period means that the stream is
+     * read at every readAllSensors() call.
+     */
+    struct StreamReadPeriods
+    {
+        std::chrono::nanoseconds inertials{std::chrono::nanoseconds::zero()};
+        std::chrono::nanoseconds cartesianWrenches{std::chrono::nanoseconds::zero()};
+        std::chrono::nanoseconds forceTorqueSensors{std::chrono::nanoseconds::zero()};
+        std::chrono::nanoseconds temperatures{std::chrono::nanoseconds::zero()};
+    };
+
+    StreamReadPeriods readPeriods; /**< read period declared for each sensor stream */
+
+    /**
+     * Time instant at which each sensor stream has been read for the last time
+     */
+    struct StreamReadInstants
+    {
+        double inertials{-1.0};
+        double cartesianWrenches{-1.0};
+        double forceTorqueSensors{-1.0};
+        double temperatures{-1.0};
+    };
+
+    StreamReadInstants lastReadInstants; /**< last read instant of each sensor stream [seconds] */
+
+    /**
+     * Change detector of a slow sensor stream. The generation counter is incremented whenever the
+     * latest measurement differs from the last published one by more than the configured epsilon
+     * (infinity norm), so consumers can skip processing streams that did not change.
+     */
+    struct StreamChangeDetector
+    {
+        double epsilon{0.0}; /**< minimum absolute change triggering a new generation */
+        std::size_t generation{0}; /**< counter incremented at every detected change */
+        Eigen::VectorXd lastPublishedValues; /**< values published at the last detected change */
+
+        void update(const Eigen::VectorXd& values)
+        {
+            if (values.size() == 0)
+            {
+                return;
+            }
+
+            if (lastPublishedValues.size() != values.size())
+            {
+                // first measurement of the stream
+                lastPublishedValues = values;
+                generation++;
+                return;
+            }
+
+            if ((values - lastPublishedValues).lpNorm<Eigen::Infinity>() > epsilon)
+            {
+                lastPublishedValues = values;
+                generation++;
+            }
+        }
+    };
+
+    StreamChangeDetector motorCurrentsChangeDetector; /**< change detector of the motor currents
+                                                         stream */
+    StreamChangeDetector temperaturesChangeDetector; /**< change detector of the temperature
+                                                        stream */
+
+    Eigen::VectorXd temperatureChangeBuffer; /**< scratch buffer stacking the temperature
+                                                measurements for the change detector */
+
+    /**
+     * Stack the latest temperature measurements following the configured list order and update
+     * the associated change detector
+     */
+    void updateTemperaturesChangeDetector()
+    {
+        const auto& temperatureSensorsList = metaData.sensorsList.temperatureSensorsList;
+        temperatureChangeBuffer.resize(temperatureSensorsList.size());
+        for (std::size_t idx = 0; idx < temperatureSensorsList.size(); idx++)
+        {
+            const auto iter = temperatureMeasures.find(temperatureSensorsList[idx]);
+            temperatureChangeBuffer[idx]
+                = (iter != temperatureMeasures.end() && iter->second.first.size() > 0)
+                      ? iter->second.first[0]
+                      : 0.0;
+        }
+
+        temperaturesChangeDetector.update(temperatureChangeBuffer);
+    }
+
+    /**
+     * Pair of timestamps associated to the latest read of a sensor stream. The hardware timestamp
+     * is the one reported by the device driver and is negative when the underlying interface does
+     * not provide one.
+     */
+    struct StreamTimestamps
+    {
+        double hardwareTimeInSeconds{-1.0}; /**< device-side timestamp of the measurement */
+        double receivedTimeInSeconds{-1.0}; /**< time at which the measurement was received */
+    };
+
+    /**< timestamps of the latest read of each stream, keyed by the sensor name. The remapped
+     * control board stream is stored under the name "control_board" */
+    std::unordered_map<std::string, StreamTimestamps> streamTimestamps;
+
+    /**
+     * Accumulating histogram of the latency between the hardware timestamp and the receive time
+     * of a sensor stream. The last bin accumulates all the samples exceeding the histogram range.
+     */
+    struct LatencyHistogram
+    {
+        static constexpr double binWidthInSeconds{0.5e-3}; /**< width of each histogram bin */
+
+        std::vector<std::size_t> counts = std::vector<std::size_t>(20, 0); /**< per-bin number of
+                                                                              accumulated samples */
+
+        void record(const double latencyInSeconds)
+        {
+            std::size_t bin{0};
+            if (latencyInSeconds > 0.0)
+            {
+                bin = std::min(static_cast<std::size_t>(latencyInSeconds / binWidthInSeconds),
+                               counts.size() - 1);
+            }
+            counts[bin]++;
+        }
+    };
+
+    /**< hardware-to-receive latency histogram of each stream, keyed as streamTimestamps */
+    std::unordered_map<std::string, LatencyHistogram> latencyHistograms;
+
+    /**
+     * Store the timestamps of the latest read of a stream and, when the hardware timestamp is
+     * available, accumulate the hardware-to-receive latency in the stream histogram
+     */
+    void updateStreamTimestamps(const std::string& streamName,
+                                const double hardwareTimeInSeconds,
+                                const double receivedTimeInSeconds)
+    {
+        auto& stamps = streamTimestamps[streamName];
+        stamps.hardwareTimeInSeconds = hardwareTimeInSeconds;
+        stamps.receivedTimeInSeconds = receivedTimeInSeconds;
+
+        if (hardwareTimeInSeconds >= 0.0)
+        {
+            latencyHistograms[streamName].record(receivedTimeInSeconds - hardwareTimeInSeconds);
+        }
+    }
+
+    /**
+     * Check if the declared period of a stream has elapsed since its last read. If it has, the
+     * last read instant is updated and the stream must be read again. Streams with a non-positive
+     * period are always due.
+     */
+    bool streamReadDue(const std::chrono::nanoseconds& period, double& lastReadInSeconds)
+    {
+        if (period <= std::chrono::nanoseconds::zero())
+        {
+            return true;
+        }
+
+        const double now = yarp::os::Time::now();
+        if (lastReadInSeconds >= 0.0
+            && now - lastReadInSeconds < std::chrono::duration<double>(period).count())
+        {
+            return false;
+        }
+
+        lastReadInSeconds = now;
+        return true;
+    }
+
+    /**
+     * Coherent sample published by the acquisition thread through the lock-free buffer
+     */
+    struct AsyncSample
+    {
+        SensorSnapshot snapshot; /**< flattened measurements read in a single pass */
+        std::vector<std::string> failedReads; /**< sensors that failed during the pass */
+    };
+
+    bool useAcquisitionThread{false}; /**< flag to enable the internal acquisition thread */
+    std::chrono::nanoseconds acquisitionPeriod{std::chrono::milliseconds(1)}; /**< period of the
+                                    acquisition thread */
+    System::SharedResource<AsyncSample>::Ptr asyncSampleResource{
+        System::LockFreeSharedResource<AsyncSample>::create()}; /**< lock-free buffer connecting the
+                                    acquisition thread to advance() */
+    AsyncSample asyncSample; /**< latest sample flipped out of the lock-free buffer */
+    double lastSnapshotTimeInSeconds{-1.0}; /**< receive time of the latest snapshot taken either
+                                    synchronously or by the acquisition thread */
+    std::atomic<bool> acquisitionThreadRunning{false}; /**< flag keeping the acquisition thread
+                                    alive */
+    std::thread acquisitionThread; /**< thread continuously reading the sensors into the lock-free
+                                    buffer */
+
+    /**
+     * Flip the lock-free buffer and store the freshest coherent sample published by the
+     * acquisition thread. This is a constant time operation that never blocks on the YARP
+     * interfaces.
+     * @return true if the acquisition thread has published at least one sample.
+     */
+    bool flipAsyncSample()
+    {
+        asyncSample = asyncSampleResource->get();
+        failedSensorReads = asyncSample.failedReads;
+
+        if (asyncSample.snapshot.timeInSeconds <= 0.0)
+        {
+            // the acquisition thread has not completed its first pass yet
+            return false;
+        }
+
+        lastSnapshotTimeInSeconds = asyncSample.snapshot.timeInSeconds;
+        return true;
+    }
+
+    /**
+     * Stop the acquisition thread and wait for its completion
+     */
+    void stopAcquisitionThread()
+    {
+        acquisitionThreadRunning = false;
+        if (acquisitionThread.joinable())
+        {
+            acquisitionThread.join();
+        }
+    }
+
+    ~Impl()
+    {
+        stopAcquisitionThread();
+    }
+
     using SubConfigLoader = bool (YarpSensorBridge::Impl::*)(
         std::weak_ptr<const BipedalLocomotion::ParametersHandler::IParametersHandler>,
         SensorBridgeMetaData&);
@@ -203,6 +457,42 @@ struct YarpSensorBridge::Impl
         return true;
     }
 
+    /**
+     * Copy the entries of a full joint-ordered vector selected by a registered joint subset into
+     * a contiguous output vector in a single indexed sweep
+     */
+    bool gatherJointSubset(std::string_view logPrefix,
+                           const std::size_t subsetHandle,
+                           const Eigen::VectorXd& fullVector,
+                           Eigen::Ref<Eigen::VectorXd> subsetVector)
+    {
+        if (subsetHandle >= jointSubsets.size())
+        {
+            log()->error("{} The handle {} is not associated to any registered joint subset.",
+                         logPrefix,
+                         subsetHandle);
+            return false;
+        }
+
+        const Eigen::VectorXi& gatherIndices = jointSubsets[subsetHandle].gatherIndices;
+        if (subsetVector.size() != gatherIndices.size())
+        {
+            log()->error("{} The size of the output vector ({}) does not match the size of the "
+                         "registered joint subset ({}).",
+                         logPrefix,
+                         subsetVector.size(),
+                         gatherIndices.size());
+            return false;
+        }
+
+        for (Eigen::Index idx = 0; idx < gatherIndices.size(); idx++)
+        {
+            subsetVector[idx] = fullVector[gatherIndices[idx]];
+        }
+
+        return true;
+    }
+
     /**
      * Utility function to check for nan in vector
      */
@@ -1072,6 +1362,8 @@ struct YarpSensorBridge::Impl
                 metaData.bridgeOptions.nrJoints);
             controlBoardRemapperMeasures.jointTorquesUnordered.resize(
                 metaData.bridgeOptions.nrJoints);
+            controlBoardRemapperMeasures.encoderTimestampsUnordered.resize(
+                metaData.bridgeOptions.nrJoints);
 
             // zero buffers
             controlBoardRemapperMeasures.remappedJointPermutationMatrix.setIdentity();
@@ -1079,6 +1371,7 @@ struct YarpSensorBridge::Impl
             controlBoardRemapperMeasures.jointVelocities.setZero();
             controlBoardRemapperMeasures.jointAccelerations.setZero();
             controlBoardRemapperMeasures.jointTorques.setZero();
+            controlBoardRemapperMeasures.encoderTimestampsUnordered.setZero();
         }
 
         if (metaData.bridgeOptions.isPWMControlEnabled)
@@ -1382,8 +1675,12 @@ struct YarpSensorBridge::Impl
             sensorMeasure[8] = deg2rad(sensorMeasure[8]);
         }
 
+        const double receivedTimeInSeconds = yarp::os::Time::now();
         measurementMap[sensorName].first = sensorMeasure;
-        measurementMap[sensorName].second = yarp::os::Time::now();
+        measurementMap[sensorName].second = receivedTimeInSeconds;
+
+        // analog and generic sensor interfaces do not expose a device-side timestamp
+        updateStreamTimestamps(sensorName, -1.0, receivedTimeInSeconds);
         return true;
     }
 
@@ -1464,6 +1761,8 @@ struct YarpSensorBridge::Impl
         measurementMap[sensorName].first = sensorMeasure;
         measurementMap[sensorName].second = BipedalLocomotion::clock().now().count();
 
+        updateStreamTimestamps(sensorName, txTimeStamp, yarp::os::Time::now());
+
         return true;
     }
 
@@ -1512,6 +1811,9 @@ struct YarpSensorBridge::Impl
         }
 
         controlBoardRemapperMeasures.receivedTimeInSeconds = yarp::os::Time::now();
+        updateStreamTimestamps("control_board",
+                               controlBoardRemapperMeasures.hardwareTimeInSeconds,
+                               controlBoardRemapperMeasures.receivedTimeInSeconds);
 
         return true;
     }
@@ -1528,8 +1830,9 @@ struct YarpSensorBridge::Impl
         if (controlBoardRemapperInterfaces.encoders)
         {
             ok = ok
-                 && controlBoardRemapperInterfaces.encoders->getEncoders(
-                     controlBoardRemapperMeasures.jointPositionsUnordered.data());
+                 && controlBoardRemapperInterfaces.encoders->getEncodersTimed(
+                     controlBoardRemapperMeasures.jointPositionsUnordered.data(),
+                     controlBoardRemapperMeasures.encoderTimestampsUnordered.data());
             ok = ok
                  && controlBoardRemapperInterfaces.encoders->getEncoderSpeeds(
                      controlBoardRemapperMeasures.jointVelocitiesUnordered.data());
@@ -1576,6 +1879,11 @@ struct YarpSensorBridge::Impl
                 controlBoardRemapperMeasures.jointAccelerations.noalias()
                     = controlBoardRemapperMeasures.remappedJointPermutationMatrix
                       * controlBoardRemapperMeasures.jointAccelerationsUnordered * M_PI / 180;
+
+                // the joints may be updated at different instants by the underlying boards: the
+                // latest per-joint timestamp is taken as hardware timestamp of the stream
+                controlBoardRemapperMeasures.hardwareTimeInSeconds
+                    = controlBoardRemapperMeasures.encoderTimestampsUnordered.maxCoeff();
             } else
             {
                 log()->error("{} Unable to read from IEncodersTimed interface, use previous "
@@ -1701,6 +2009,8 @@ struct YarpSensorBridge::Impl
                 controlBoardRemapperMeasures.motorCurrents.noalias()
                     = controlBoardRemapperMeasures.remappedJointPermutationMatrix
                       * controlBoardRemapperMeasures.motorCurrentsUnordered;
+
+                motorCurrentsChangeDetector.update(controlBoardRemapperMeasures.motorCurrents);
             } else
             {
                 log()->error("{} Unable to read from ICurrentControl interface, use previous "
@@ -1991,77 +2301,248 @@ struct YarpSensorBridge::Impl
                                  checkForNAN);
     }
 
-    bool readAllSensors(std::vector<std::string>& failedReadAllSensors)
+    /**
+     * Copy one column per sensor from a stamped measurement map into the snapshot buffer,
+     * following the order of the configured sensor list.
+     */
+    template <typename Derived>
+    bool populateSnapshotColumns(const std::vector<std::string>& sensorNames,
+                                 const std::unordered_map<std::string, StampedYARPVector>& measures,
+                                 Eigen::MatrixBase<Derived>& snapshotBuffer,
+                                 std::vector<std::string>& failedSensorReads)
     {
-        failedReadAllSensors.clear();
-        std::vector<std::string> failedReads;
+        bool ok{true};
+        for (std::size_t i = 0; i < sensorNames.size(); i++)
+        {
+            auto iter = measures.find(sensorNames[i]);
+            if (iter == measures.end()
+                || static_cast<Eigen::Index>(iter->second.first.size()) != snapshotBuffer.rows())
+            {
+                failedSensorReads.emplace_back(sensorNames[i]);
+                ok = false;
+                continue;
+            }
+            snapshotBuffer.col(i) = yarp::eigen::toEigen(iter->second.first);
+        }
+        return ok;
+    }
 
-        if (readControlBoardInterface(checkForNAN))
+    /**
+     * Flatten the internal stamped measurement buffers into a coherent snapshot. The YARP
+     * interfaces are not accessed, so readAllSensors() must have been called beforehand by the
+     * same thread.
+     */
+    bool fillSnapshot(SensorSnapshot& snapshot, std::vector<std::string>& failedSensorReads)
+    {
+        // this is a no-op when the snapshot has been preallocated by the caller
+        snapshot.resize(metaData);
+
+        const auto& options = metaData.bridgeOptions;
+        const auto& lists = metaData.sensorsList;
+
+        // the whole snapshot shares a single timestamp. When the control board is available the
+        // timestamp associated to its measurements is used
+        snapshot.timeInSeconds = options.isJointSensorsEnabled
+                                     ? controlBoardRemapperMeasures.receivedTimeInSeconds
+                                     : yarp::os::Time::now();
+
+        if (options.isJointSensorsEnabled)
         {
-            failedReadAllSensors.emplace_back(std::string("RemoteControlBoardRemapper"));
+            snapshot.jointPositions = controlBoardRemapperMeasures.jointPositions;
+            snapshot.jointVelocities = controlBoardRemapperMeasures.jointVelocities;
+            snapshot.jointAccelerations = controlBoardRemapperMeasures.jointAccelerations;
+            snapshot.jointTorques = controlBoardRemapperMeasures.jointTorques;
+        }
+
+        if (options.isMotorSensorsEnabled)
+        {
+            snapshot.motorPositions = controlBoardRemapperMeasures.motorPositions;
+            snapshot.motorVelocities = controlBoardRemapperMeasures.motorVelocities;
+            snapshot.motorAccelerations = controlBoardRemapperMeasures.motorAccelerations;
+            snapshot.motorCurrents = controlBoardRemapperMeasures.motorCurrents;
+        }
+
+        if (options.isPWMControlEnabled)
+        {
+            snapshot.motorPWMs = controlBoardRemapperMeasures.motorPWMs;
         }
 
-        if (!readAllIMUs(failedReads))
+        if (options.isPIDsEnabled)
         {
-            failedReadAllSensors.insert(failedReadAllSensors.end(),
-                                        failedReads.begin(),
-                                        failedReads.end());
+            snapshot.pidPositions = controlBoardRemapperMeasures.pidPositions;
+            snapshot.pidPositionErrors = controlBoardRemapperMeasures.pidPositionErrors;
         }
 
-        if (!readAllCartesianWrenches(failedReads))
+        bool ok{true};
+        if (options.isIMUEnabled)
+        {
+            ok = populateSnapshotColumns(lists.IMUsList,
+                                         IMUMeasures,
+                                         snapshot.imuMeasurements,
+                                         failedSensorReads)
+                 && ok;
+        }
+
+        if (options.isLinearAccelerometerEnabled)
+        {
+            ok = populateSnapshotColumns(lists.linearAccelerometersList,
+                                         accelerometerMeasures,
+                                         snapshot.linearAccelerometerMeasurements,
+                                         failedSensorReads)
+                 && ok;
+        }
+
+        if (options.isGyroscopeEnabled)
         {
-            failedReadAllSensors.insert(failedReadAllSensors.end(),
-                                        failedReads.begin(),
-                                        failedReads.end());
+            ok = populateSnapshotColumns(lists.gyroscopesList,
+                                         gyroMeasures,
+                                         snapshot.gyroscopeMeasurements,
+                                         failedSensorReads)
+                 && ok;
         }
 
-        if (!readAllMASLinearAccelerometers(failedReads))
+        if (options.isOrientationSensorEnabled)
         {
-            failedReadAllSensors.insert(failedReadAllSensors.end(),
-                                        failedReads.begin(),
-                                        failedReads.end());
+            ok = populateSnapshotColumns(lists.orientationSensorsList,
+                                         orientationMeasures,
+                                         snapshot.orientationSensorMeasurements,
+                                         failedSensorReads)
+                 && ok;
         }
 
-        if (!readAllMASGyroscopes(failedReads))
+        if (options.isMagnetometerEnabled)
         {
-            failedReadAllSensors.insert(failedReadAllSensors.end(),
-                                        failedReads.begin(),
-                                        failedReads.end());
+            ok = populateSnapshotColumns(lists.magnetometersList,
+                                         magnetometerMeasures,
+                                         snapshot.magnetometerMeasurements,
+                                         failedSensorReads)
+                 && ok;
         }
 
-        if (!readAllMASOrientationSensors(failedReads))
+        if (options.isSixAxisForceTorqueSensorEnabled)
+        {
+            ok = populateSnapshotColumns(lists.sixAxisForceTorqueSensorsList,
+                                         FTMeasures,
+                                         snapshot.sixAxisForceTorqueMeasurements,
+                                         failedSensorReads)
+                 && ok;
+        }
+
+        if (options.isCartesianWrenchEnabled)
+        {
+            ok = populateSnapshotColumns(lists.cartesianWrenchesList,
+                                         cartesianWrenchMeasures,
+                                         snapshot.cartesianWrenchMeasurements,
+                                         failedSensorReads)
+                 && ok;
+        }
+
+        if (options.isTemperatureSensorEnabled)
+        {
+            for (std::size_t i = 0; i < lists.temperatureSensorsList.size(); i++)
+            {
+                auto iter = temperatureMeasures.find(lists.temperatureSensorsList[i]);
+                if (iter == temperatureMeasures.end() || iter->second.first.size() == 0)
+                {
+                    failedSensorReads.emplace_back(lists.temperatureSensorsList[i]);
+                    ok = false;
+                    continue;
+                }
+                // assuming the vector has only one value
+                snapshot.temperatureMeasurements(i) = iter->second.first(0);
+            }
+        }
+
+        return ok;
+    }
+
+    bool readAllSensors(std::vector<std::string>& failedReadAllSensors)
+    {
+        failedReadAllSensors.clear();
+        std::vector<std::string> failedReads;
+
+        if (readControlBoardInterface(checkForNAN))
         {
-            failedReadAllSensors.insert(failedReadAllSensors.end(),
-                                        failedReads.begin(),
-                                        failedReads.end());
+            failedReadAllSensors.emplace_back(std::string("RemoteControlBoardRemapper"));
         }
 
-        if (!readAllMASMagnetometers(failedReads))
+        // the streams with a declared read period are skipped until the period has elapsed. The
+        // measurement buffers keep the previously read values
+        if (streamReadDue(readPeriods.inertials, lastReadInstants.inertials))
         {
-            failedReadAllSensors.insert(failedReadAllSensors.end(),
-                                        failedReads.begin(),
-                                        failedReads.end());
+            if (!readAllIMUs(failedReads))
+            {
+                failedReadAllSensors.insert(failedReadAllSensors.end(),
+                                            failedReads.begin(),
+                                            failedReads.end());
+            }
+
+            if (!readAllMASLinearAccelerometers(failedReads))
+            {
+                failedReadAllSensors.insert(failedReadAllSensors.end(),
+                                            failedReads.begin(),
+                                            failedReads.end());
+            }
+
+            if (!readAllMASGyroscopes(failedReads))
+            {
+                failedReadAllSensors.insert(failedReadAllSensors.end(),
+                                            failedReads.begin(),
+                                            failedReads.end());
+            }
+
+            if (!readAllMASOrientationSensors(failedReads))
+            {
+                failedReadAllSensors.insert(failedReadAllSensors.end(),
+                                            failedReads.begin(),
+                                            failedReads.end());
+            }
+
+            if (!readAllMASMagnetometers(failedReads))
+            {
+                failedReadAllSensors.insert(failedReadAllSensors.end(),
+                                            failedReads.begin(),
+                                            failedReads.end());
+            }
         }
 
-        if (!readAllMASSixAxisForceTorqueSensors(failedReads))
+        if (streamReadDue(readPeriods.cartesianWrenches, lastReadInstants.cartesianWrenches))
         {
-            failedReadAllSensors.insert(failedReadAllSensors.end(),
-                                        failedReads.begin(),
-                                        failedReads.end());
+            if (!readAllCartesianWrenches(failedReads))
+            {
+                failedReadAllSensors.insert(failedReadAllSensors.end(),
+                                            failedReads.begin(),
+                                            failedReads.end());
+            }
         }
 
-        if (!readAllAnalogSixAxisForceTorqueSensors(failedReads))
+        if (streamReadDue(readPeriods.forceTorqueSensors, lastReadInstants.forceTorqueSensors))
         {
-            failedReadAllSensors.insert(failedReadAllSensors.end(),
-                                        failedReads.begin(),
-                                        failedReads.end());
+            if (!readAllMASSixAxisForceTorqueSensors(failedReads))
+            {
+                failedReadAllSensors.insert(failedReadAllSensors.end(),
+                                            failedReads.begin(),
+                                            failedReads.end());
+            }
+
+            if (!readAllAnalogSixAxisForceTorqueSensors(failedReads))
+            {
+                failedReadAllSensors.insert(failedReadAllSensors.end(),
+                                            failedReads.begin(),
+                                            failedReads.end());
+            }
         }
 
-        if (!readAllMASTemperatures(failedReads))
+        if (streamReadDue(readPeriods.temperatures, lastReadInstants.temperatures))
         {
-            failedReadAllSensors.insert(failedReadAllSensors.end(),
-                                        failedReads.begin(),
-                                        failedReads.end());
+            if (!readAllMASTemperatures(failedReads))
+            {
+                failedReadAllSensors.insert(failedReadAllSensors.end(),
+                                            failedReads.begin(),
+                                            failedReads.end());
+            }
+
+            updateTemperaturesChangeDetector();
         }
 
         return true;
@@ -158,6 +158,35 @@ struct YarpCameraBridge::Impl
     std::unordered_map<std::string, StampedYARPFlexImage> flexImages;
     std::unordered_map<std::string, StampedYARPImage<yarp::sig::PixelRgb>> rgbImages;
 
+    /** Preallocated per-camera pyramids used by the downscale-on-read option of the image views */
+    std::unordered_map<std::string, std::vector<cv::Mat>> colorPyramids;
+    std::unordered_map<std::string, std::vector<cv::Mat>> depthPyramids;
+
+    /**
+     * Downscale the full resolution image into the preallocated pyramid applying pyrDown
+     * pyramidLevel times. Only the pyramid buffers are written, no other allocation is performed
+     * once the pyramid has been built.
+     */
+    static const cv::Mat& downscaleIntoPyramid(const cv::Mat& fullResolution,
+                                               const std::size_t pyramidLevel,
+                                               std::vector<cv::Mat>& pyramid)
+    {
+        if (pyramid.size() < pyramidLevel)
+        {
+            pyramid.resize(pyramidLevel);
+        }
+
+        const cv::Mat* source = &fullResolution;
+        for (std::size_t i = 0; i < pyramidLevel; i++)
+        {
+            // cv::pyrDown reuses the destination allocation when the size matches
+            cv::pyrDown(*source, pyramid[i]);
+            source = &pyramid[i];
+        }
+
+        return pyramid[pyramidLevel - 1];
+    }
+
     /**
      * Check if sensor is available in the relevant sensor map
      */
@@ -727,3 +756,137 @@ bool YarpCameraBridge::getDepthImage(
 
     return true;
 }
+
+bool YarpCameraBridge::getColorImageView(
+    const std::string& camName,
+    cv::Mat& colorImg,
+    std::optional<std::reference_wrapper<double>> receiveTimeInSeconds,
+    const std::size_t pyramidLevel)
+{
+    constexpr auto prefix = "[YarpCameraBridge::getColorImageView]";
+    if (!m_pimpl->checkValid(prefix))
+    {
+        return false;
+    }
+
+    // check if the camera name is a standard camera or a depth camera
+    auto rgbImage = m_pimpl->rgbImages.find(camName);
+    if (rgbImage != m_pimpl->rgbImages.end())
+    {
+        if (!rgbImage->second.readCameraImage(camName,
+                                              m_pimpl->wholeBodyFrameGrabberInterface.at(camName)))
+        {
+            log()->error("{} {} could not read image.", prefix, camName);
+            return false;
+        }
+
+        // header over the internal buffer, no pixel is copied and no color conversion is applied
+        auto& yarpImage = rgbImage->second.image;
+        colorImg = cv::Mat(yarpImage.height(),
+                           yarpImage.width(),
+                           yarp::cv::type_code<yarp::sig::PixelRgb>::value,
+                           yarpImage.getRawImage(),
+                           yarpImage.getRowSize());
+        receiveTimeInSeconds = rgbImage->second.time;
+    } else
+    {
+        auto flexImage = m_pimpl->flexImages.find(camName);
+        if (flexImage == m_pimpl->flexImages.end())
+        {
+            log()->error("{} Unable to find the camera named {}.", prefix, camName);
+            return false;
+        }
+
+        if (!flexImage->second.readCameraImage(camName,
+                                               m_pimpl->wholeBodyRGBDInterface.at(camName)))
+        {
+            log()->error("{} {} could not read image.", prefix, camName);
+            return false;
+        }
+
+        auto& yarpImage = flexImage->second.image;
+        if (yarpImage.getPixelCode() != VOCAB_PIXEL_BGR
+            && yarpImage.getPixelCode() != VOCAB_PIXEL_RGB)
+        {
+            log()->error("{} Unable to wrap the yarp image for the camera named: {}. Only "
+                         "VOCAB_PIXEL_BGR and VOCAB_PIXEL_RGB are supported.",
+                         prefix,
+                         camName);
+            return false;
+        }
+
+        // header over the internal buffer, no pixel is copied and no color conversion is applied
+        colorImg = cv::Mat(yarpImage.height(),
+                           yarpImage.width(),
+                           yarp::cv::type_code<yarp::sig::PixelBgr>::value,
+                           yarpImage.getRawImage(),
+                           yarpImage.getRowSize());
+        receiveTimeInSeconds = flexImage->second.time;
+    }
+
+    if (colorImg.rows <= 0 || colorImg.cols <= 0)
+    {
+        log()->error("{} {} image with invalid size.", prefix, camName);
+        return false;
+    }
+
+    if (pyramidLevel > 0)
+    {
+        colorImg = Impl::downscaleIntoPyramid(colorImg, //
+                                              pyramidLevel,
+                                              m_pimpl->colorPyramids[camName]);
+    }
+
+    return true;
+}
+
+bool YarpCameraBridge::getDepthImageView(
+    const std::string& camName,
+    cv::Mat& depthImg,
+    std::optional<std::reference_wrapper<double>> receiveTimeInSeconds,
+    const std::size_t pyramidLevel)
+{
+    constexpr auto prefix = "[YarpCameraBridge::getDepthImageView]";
+    if (!m_pimpl->checkValid(prefix))
+    {
+        return false;
+    }
+
+    auto depthImage = m_pimpl->depthImages.find(camName);
+    if (depthImage == m_pimpl->depthImages.end())
+    {
+        log()->error("{} Unable to find the camera named {}.", prefix, camName);
+        return false;
+    }
+
+    if (!depthImage->second.readCameraImage(camName,
+                                            m_pimpl->wholeBodyRGBDInterface.at(camName)))
+    {
+        log()->error("{} {} could not read image.", prefix, camName);
+        return false;
+    }
+
+    // header over the internal buffer, no pixel is copied
+    auto& yarpImage = depthImage->second.image;
+    depthImg = cv::Mat(yarpImage.height(),
+                       yarpImage.width(),
+                       yarp::cv::type_code<yarp::sig::PixelFloat>::value,
+                       yarpImage.getRawImage(),
+                       yarpImage.getRowSize());
+    receiveTimeInSeconds = depthImage->second.time;
+
+    if (depthImg.rows <= 0 || depthImg.cols <= 0)
+    {
+        log()->error("{} {} image with invalid size.", prefix, camName);
+        return false;
+    }
+
+    if (pyramidLevel > 0)
+    {
+        depthImg = Impl::downscaleIntoPyramid(depthImg, //
+                                              pyramidLevel,
+                                              m_pimpl->depthPyramids[camName]);
+    }
+
+    return true;
+}
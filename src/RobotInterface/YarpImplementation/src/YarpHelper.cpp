@@ -5,6 +5,11 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <chrono>
+#include <future>
+#include <sstream>
+#include <thread>
+
 #include <BipedalLocomotion/RobotInterface/YarpHelper.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
@@ -385,3 +390,84 @@ PolyDriverDescriptor BipedalLocomotion::RobotInterface::constructRDGBSensorClien
 
     return device;
 }
+
+std::vector<PolyDriverDescriptor> BipedalLocomotion::RobotInterface::constructPolyDriversInParallel(
+    const std::vector<std::function<PolyDriverDescriptor()>>& builders,
+    const std::chrono::nanoseconds& timeout)
+{
+    constexpr auto errorPrefix = "[RobotInterface::constructPolyDriversInParallel]";
+
+    std::vector<PolyDriverDescriptor> devices(builders.size());
+
+    // launch every builder on its own thread so that the bring-up time is bounded by the slowest
+    // single device instead of the sum of all the devices
+    std::vector<std::future<PolyDriverDescriptor>> futures(builders.size());
+    for (std::size_t i = 0; i < builders.size(); i++)
+    {
+        if (builders[i])
+        {
+            futures[i] = std::async(std::launch::async, builders[i]);
+        }
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    std::vector<std::size_t> failedDevices;
+    std::vector<std::size_t> timedOutDevices;
+    for (std::size_t i = 0; i < builders.size(); i++)
+    {
+        if (!futures[i].valid())
+        {
+            failedDevices.push_back(i);
+            continue;
+        }
+
+        if (timeout > std::chrono::nanoseconds::zero()
+            && futures[i].wait_until(deadline) != std::future_status::ready)
+        {
+            timedOutDevices.push_back(i);
+
+            // the open cannot be interrupted. The future is drained by a detached thread so that
+            // the caller is not blocked beyond the budget and the device is released on completion
+            std::thread([future = std::move(futures[i])]() mutable { future.get(); }).detach();
+            continue;
+        }
+
+        devices[i] = futures[i].get();
+        if (!devices[i].isValid())
+        {
+            failedDevices.push_back(i);
+        }
+    }
+
+    // aggregate the failures in a single report
+    if (!failedDevices.empty() || !timedOutDevices.empty())
+    {
+        auto listIndices = [](const std::vector<std::size_t>& indices) -> std::string {
+            std::ostringstream stream;
+            for (std::size_t i = 0; i < indices.size(); i++)
+            {
+                stream << (i == 0 ? "" : ", ") << indices[i];
+            }
+            return stream.str();
+        };
+
+        if (!failedDevices.empty())
+        {
+            log()->error("{} Unable to open the devices associated to the builders with index: "
+                         "{}.",
+                         errorPrefix,
+                         listIndices(failedDevices));
+        }
+
+        if (!timedOutDevices.empty())
+        {
+            log()->error("{} The devices associated to the builders with index: {} did not open "
+                         "within the given time budget.",
+                         errorPrefix,
+                         listIndices(timedOutDevices));
+        }
+    }
+
+    return devices;
+}
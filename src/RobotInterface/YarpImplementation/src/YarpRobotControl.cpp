@@ -5,6 +5,7 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <atomic>
 #include <cmath>
 #include <thread>
 #include <unordered_map>
@@ -22,6 +23,7 @@
 #include <yarp/os/Time.h>
 
 #include <BipedalLocomotion/RobotInterface/YarpRobotControl.h>
+#include <BipedalLocomotion/System/ParallelTaskGroupUpdater.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 using namespace BipedalLocomotion::RobotInterface;
@@ -71,6 +73,37 @@ struct YarpRobotControl::Impl
     JointsControlValuesAndMode desiredJointValuesAndMode; /**< Struct containing the information
                                                              regarding the desired joint value and
                                                              the control mode */
+    bool positionFeedbackRequired{true}; /**< True if at least one joint is controlled in Position
+                                            or PositionDirect. When it is false, setReferences()
+                                            streams the references without reading the encoders. */
+
+    System::ParallelTaskGroupUpdater referenceDispatcher; /**< Dispatches the per-control-mode
+                                            group writes concurrently on persistent worker threads.
+                                            With a single active control mode everything runs on
+                                            the calling thread. */
+    Eigen::VectorXd stagedJointValues; /**< Full joint vector staged in setReferences() and
+                                          scattered by the dispatch groups. */
+    std::unordered_map<IRobotControl::ControlMode, double> lastWriteDurations; /**< Duration of the
+                                            last group write for each active control mode
+                                            [seconds]. */
+    double writeWarningThreshold{0.0}; /**< A warning is printed when a group write takes longer
+                                          than this threshold [seconds]. Disabled if
+                                          non-positive. */
+
+    std::thread modeSwitchThread; /**< Thread executing the asynchronous control mode switch. */
+    std::atomic<YarpRobotControl::ControlModeSwitchState> modeSwitchState{
+        YarpRobotControl::ControlModeSwitchState::Idle}; /**< State of the asynchronous control
+                                                            mode switch. */
+    std::vector<IRobotControl::ControlMode> pendingControlModes; /**< Target modes of the pending
+                                                                    asynchronous switch. */
+
+    ~Impl()
+    {
+        if (this->modeSwitchThread.joinable())
+        {
+            this->modeSwitchThread.join();
+        }
+    }
     std::vector<double> positionControlRefSpeeds; /**< Vector containing the ref speed in
                                                      deg/seconds for the position control joints. */
 
@@ -118,6 +151,36 @@ struct YarpRobotControl::Impl
         }
     }
 
+    static const char* ControlModeToString(const IRobotControl::ControlMode& controlMode)
+    {
+        switch (controlMode)
+        {
+        case IRobotControl::ControlMode::Position:
+            return "Position";
+
+        case IRobotControl::ControlMode::PositionDirect:
+            return "PositionDirect";
+
+        case IRobotControl::ControlMode::Velocity:
+            return "Velocity";
+
+        case IRobotControl::ControlMode::Torque:
+            return "Torque";
+
+        case IRobotControl::ControlMode::PWM:
+            return "PWM";
+
+        case IRobotControl::ControlMode::Current:
+            return "Current";
+
+        case IRobotControl::ControlMode::Idle:
+            return "Idle";
+
+        default:
+            return "Unknown";
+        }
+    }
+
     static yarp::conf::vocab32_t
     ControlModeToYarpControlMode(const IRobotControl::ControlMode& controlMode)
     {
@@ -226,6 +289,129 @@ struct YarpRobotControl::Impl
         this->positionControlRefSpeeds.resize(
             this->desiredJointValuesAndMode.index[IRobotControl::ControlMode::Position].size());
 
+        this->updatePositionFeedbackRequired();
+        this->rebuildDispatchGroups();
+
+        return true;
+    }
+
+    /**
+     * Update the positionFeedbackRequired flag. The encoders are read in setReferences() only if
+     * the position feedback is actually used, i.e. at least one joint is controlled in Position or
+     * PositionDirect. This avoids a blocking read on the control thread when the references are
+     * streamed in Torque, Current, PWM or Velocity.
+     */
+    void updatePositionFeedbackRequired()
+    {
+        this->positionFeedbackRequired
+            = !this->desiredJointValuesAndMode.index[IRobotControl::ControlMode::Position].empty()
+              || !this->desiredJointValuesAndMode.index[IRobotControl::ControlMode::PositionDirect]
+                      .empty();
+    }
+
+    /**
+     * Rebuild the groups run by the reference dispatcher, one for each active control mode. The
+     * worker threads are created here, so setReferences() never spawns threads in the control
+     * loop. When at most one control mode is active no worker is created and the write runs on
+     * the calling thread.
+     */
+    void rebuildDispatchGroups()
+    {
+        std::vector<std::vector<System::ParallelTaskGroupUpdater::UpdateFunction>> groups;
+        this->lastWriteDurations.clear();
+
+        for (const auto& [mode, indeces] : this->desiredJointValuesAndMode.index)
+        {
+            if (indeces.empty() || mode == IRobotControl::ControlMode::Idle
+                || mode == IRobotControl::ControlMode::Unknown)
+            {
+                continue;
+            }
+
+            // all the entries are inserted here, so writing distinct values from different
+            // threads in dispatchGroup() does not modify the map structure
+            this->lastWriteDurations[mode] = 0.0;
+
+            const auto controlMode = mode;
+            groups.push_back({[this, controlMode]() { return this->dispatchGroup(controlMode); }});
+        }
+
+        this->referenceDispatcher.setGroups(std::move(groups));
+    }
+
+    /**
+     * Scatter the staged joint values belonging to the given control mode into the preallocated
+     * buffer and forward them to the YARP interface. This function may run on a worker thread.
+     */
+    bool dispatchGroup(const IRobotControl::ControlMode& mode)
+    {
+        constexpr auto errorPrefix = "[YarpRobotControl::Impl::dispatchGroup]";
+
+        const auto& indeces = this->desiredJointValuesAndMode.index.at(mode);
+
+        if (mode == IRobotControl::ControlMode::Position)
+        {
+            for (int i = 0; i < indeces.size(); i++)
+            {
+                const auto jointError = std::abs(this->stagedJointValues[indeces[i]]
+                                                 - this->positionFeedback[indeces[i]]);
+
+                constexpr double scaling = 180 / M_PI;
+                constexpr double minVelocityInDegPerSeconds = 3.0;
+                this->positionControlRefSpeeds[i]
+                    = std::max(minVelocityInDegPerSeconds,
+                               scaling * (jointError / this->positioningDuration));
+            }
+
+            if (!this->positionInterface->setRefSpeeds(indeces.size(),
+                                                       indeces.data(),
+                                                       this->positionControlRefSpeeds.data()))
+            {
+                log()->error("{} Unable to set the reference speed for the position control "
+                             "joints.",
+                             errorPrefix);
+                return false;
+            }
+
+            this->startPositionControlInstant = yarp::os::Time::now();
+        }
+
+        // Yarp wants the quantities in degrees
+        double scaling = 180 / M_PI;
+        // if the control mode is torque or PWM it is not required to change the unit of
+        // measurement
+        if (mode == ControlMode::Torque || mode == ControlMode::PWM
+            || mode == ControlMode::Current)
+            scaling = 1;
+
+        // scatter from the full joint vector into the preallocated per-mode buffer using the
+        // index table precomputed when the control modes were set
+        auto& desiredValues = this->desiredJointValuesAndMode.value.at(mode);
+        for (int i = 0; i < indeces.size(); i++)
+            desiredValues[i] = scaling * this->stagedJointValues[indeces[i]];
+
+        const double dispatchStartInstant = yarp::os::Time::now();
+
+        if (!this->control(mode, indeces.size(), indeces.data(), desiredValues.data()))
+        {
+            log()->error("{} Unable to set the desired joint values for the joints controlled in "
+                         "{}.",
+                         errorPrefix,
+                         ControlModeToString(mode));
+            return false;
+        }
+
+        const double duration = yarp::os::Time::now() - dispatchStartInstant;
+        this->lastWriteDurations.at(mode) = duration;
+
+        if (this->writeWarningThreshold > 0 && duration > this->writeWarningThreshold)
+        {
+            log()->warn("{} The write for the joints controlled in {} took {} s.",
+                        errorPrefix,
+                        ControlModeToString(mode),
+                        duration);
+        }
+
         return true;
     }
 
@@ -336,6 +522,7 @@ struct YarpRobotControl::Impl
 
         // resize vector
         this->positionFeedback.resize(this->actuatedDOFs);
+        this->stagedJointValues.resize(this->actuatedDOFs);
         this->controlModes.resize(this->actuatedDOFs);
         this->controlModesYarp.resize(this->actuatedDOFs);
         this->axesName.resize(this->actuatedDOFs);
@@ -380,6 +567,9 @@ struct YarpRobotControl::Impl
         this->positionControlRefSpeeds.resize(
             this->desiredJointValuesAndMode.index[IRobotControl::ControlMode::Position].size());
 
+        this->updatePositionFeedbackRequired();
+        this->rebuildDispatchGroups();
+
         return true;
     }
 
@@ -411,8 +601,15 @@ struct YarpRobotControl::Impl
         return worstError;
     }
 
-    std::function<bool(const int, const int*, const double*)>
-    control(const IRobotControl::ControlMode& mode)
+    /**
+     * Forward the group of references to the YARP interface associated to the control mode. The
+     * dispatch is a plain switch so that no std::function temporary is constructed on the
+     * streaming path.
+     */
+    bool control(const IRobotControl::ControlMode& mode,
+                 const int nJoints,
+                 const int* joints,
+                 const double* refs)
     {
         assert(mode != IRobotControl::ControlMode::Unknown);
         assert(mode != IRobotControl::ControlMode::Idle);
@@ -420,139 +617,101 @@ struct YarpRobotControl::Impl
         switch (mode)
         {
         case IRobotControl::ControlMode::Position:
-            return [&](const int nJoints, const int* joints, const double* refs) -> bool {
-                return this->positionInterface->positionMove(nJoints, joints, refs);
-            };
+            return this->positionInterface->positionMove(nJoints, joints, refs);
 
         case IRobotControl::ControlMode::PositionDirect:
-            return [&](const int nJoints, const int* joints, const double* refs) -> bool {
-                return this->positionDirectInterface->setPositions(nJoints, joints, refs);
-            };
+            return this->positionDirectInterface->setPositions(nJoints, joints, refs);
 
         case IRobotControl::ControlMode::Velocity:
-            return [&](const int nJoints, const int* joints, const double* refs) -> bool {
-                return this->velocityInterface->velocityMove(nJoints, joints, refs);
-            };
+            return this->velocityInterface->velocityMove(nJoints, joints, refs);
 
         case IRobotControl::ControlMode::Torque:
-            return [&](const int nJoints, const int* joints, const double* refs) -> bool {
-                return this->torqueInterface->setRefTorques(nJoints, joints, refs);
-            };
+            return this->torqueInterface->setRefTorques(nJoints, joints, refs);
 
         case IRobotControl::ControlMode::Current:
-            return [&](const int nJoints, const int* joints, const double* refs) -> bool {
-                return this->currentInterface->setRefCurrents(nJoints, joints, refs);
-            };
+            return this->currentInterface->setRefCurrents(nJoints, joints, refs);
 
-        case IRobotControl::ControlMode::PWM:
-            return [&](const int nJoints, const int* joints, const double* refs) -> bool {
-                bool ok = true;
-                for (int i = 0; i < nJoints; i++)
-                {
-                    ok = ok && this->pwmInterface->setRefDutyCycle(joints[i], refs[i]);
-                }
-                return ok;
-            };
+        case IRobotControl::ControlMode::PWM: {
+            bool ok = true;
+            for (int i = 0; i < nJoints; i++)
+            {
+                ok = ok && this->pwmInterface->setRefDutyCycle(joints[i], refs[i]);
+            }
+            return ok;
+        }
 
         default:
-            return nullptr;
+            return false;
         }
 
-        return nullptr;
+        return false;
     }
 
     bool setReferences(Eigen::Ref<const Eigen::VectorXd> jointValues)
     {
         constexpr auto errorPrefix = "[YarpRobotControl::Impl::setReferences]";
 
-        if(!this->getJointPos())
-        {
-            log()->error("{} Unable to get the joint position.", errorPrefix);
-            return  false;
-        }
-
-        const auto worstError = this->getWorstPositionDirectError(jointValues,
-                                                                  this->positionFeedback);
-
-        if (worstError.second > this->positionDirectMaxAdmissibleError)
+        // the dispatch groups are rebuilt by the control mode switch, so streaming references
+        // while an asynchronous switch is running is not allowed
+        if (this->modeSwitchState.load() == YarpRobotControl::ControlModeSwitchState::Running)
         {
-            log()->error("{} The worst error between the current and the desired position of the "
-                         "joint named '{}' is greater than {} deg. Error = {} deg.",
-                         errorPrefix,
-                         this->axesName[worstError.first],
-                         180 / M_PI * this->positionDirectMaxAdmissibleError,
-                         180 / M_PI * worstError.second);
+            log()->error("{} An asynchronous control mode switch is still running.", errorPrefix);
             return false;
         }
 
-        for (const auto& [mode, indeces] : this->desiredJointValuesAndMode.index)
+        // the position feedback is used only by the Position and PositionDirect control modes.
+        // When the references are streamed in Torque, Current, PWM or Velocity the (possibly
+        // blocking) encoder read is skipped entirely
+        if (this->positionFeedbackRequired)
         {
-            // if indeces vector is empty no joint is controlled with this specific control mode
-            if (indeces.empty())
-                continue;
+            if (!this->getJointPos())
+            {
+                log()->error("{} Unable to get the joint position.", errorPrefix);
+                return false;
+            }
 
-            if (mode == IRobotControl::ControlMode::Idle)
-                continue;
+            const auto worstError = this->getWorstPositionDirectError(jointValues,
+                                                                      this->positionFeedback);
 
-            else if (mode == IRobotControl::ControlMode::Unknown)
+            if (worstError.second > this->positionDirectMaxAdmissibleError)
             {
-                std::string joints = "";
-                for (const auto& index : indeces)
-                    joints += " '" + this->axesName[index] + "'";
-
-                log()->error("{} The following joints does not have a specified control "
-                             "mode:{}. Please set a feasible control mode.",
+                log()->error("{} The worst error between the current and the desired position of "
+                             "the joint named '{}' is greater than {} deg. Error = {} deg.",
                              errorPrefix,
-                             joints);
+                             this->axesName[worstError.first],
+                             180 / M_PI * this->positionDirectMaxAdmissibleError,
+                             180 / M_PI * worstError.second);
                 return false;
-
-            } else if (mode == IRobotControl::ControlMode::Position)
-            {
-                for (int i = 0; i < indeces.size(); i++)
-                {
-                    const auto jointError = std::abs(jointValues[indeces[i]]
-                                                     - this->positionFeedback[indeces[i]]);
-
-                    constexpr double scaling = 180 / M_PI;
-                    constexpr double minVelocityInDegPerSeconds = 3.0;
-                    this->positionControlRefSpeeds[i]
-                        = std::max(minVelocityInDegPerSeconds,
-                                   scaling * (jointError / this->positioningDuration));
-                }
-
-                if (!this->positionInterface->setRefSpeeds(indeces.size(),
-                                                           indeces.data(),
-                                                           this->positionControlRefSpeeds.data()))
-                {
-                    log()->error("{} Unable to set the reference speed for the position control "
-                                 "joints.",
-                                 errorPrefix);
-                    return false;
-                }
-
-                this->startPositionControlInstant = yarp::os::Time::now();
             }
+        }
 
-            // Yarp wants the quantities in degrees
-            double scaling = 180 / M_PI;
-            // if the control mode is torque or PWM it is not required to change the unit of
-            // measurement
-            if (mode == ControlMode::Torque || mode == ControlMode::PWM
-                || mode == ControlMode::Current)
-                scaling = 1;
+        const auto& unknownIndeces
+            = this->desiredJointValuesAndMode.index[IRobotControl::ControlMode::Unknown];
+        if (!unknownIndeces.empty())
+        {
+            std::string joints = "";
+            for (const auto& index : unknownIndeces)
+                joints += " '" + this->axesName[index] + "'";
 
-            for (int i = 0; i < indeces.size(); i++)
-                this->desiredJointValuesAndMode.value[mode][i] = scaling * jointValues[indeces[i]];
+            log()->error("{} The following joints does not have a specified control "
+                         "mode:{}. Please set a feasible control mode.",
+                         errorPrefix,
+                         joints);
+            return false;
+        }
 
-            if (!this->control(mode)(indeces.size(),
-                                     indeces.data(),
-                                     this->desiredJointValuesAndMode.value[mode].data()))
+        // stage the full joint vector so that the dispatch groups can scatter from it also when
+        // they run on the worker threads. The buffer is preallocated, no memory is allocated here
+        this->stagedJointValues = jointValues;
 
-            {
-                log()->error("{} Unable to set the desired joint values.", errorPrefix);
-                return false;
-            }
+        // the group writes run concurrently, one per active control mode, and update() returns
+        // when all of them completed. The wall time is the slowest write, not the sum
+        if (!this->referenceDispatcher.update())
+        {
+            log()->error("{} Unable to set the desired joint values.", errorPrefix);
+            return false;
         }
+
         return true;
     }
 };
@@ -609,6 +768,17 @@ bool YarpRobotControl::initialize(std::weak_ptr<ParametersHandler::IParametersHa
         m_pimpl->maxReadingAttempts = temp;
     }
 
+    if (ptr->getParameter("write_warning_threshold", m_pimpl->writeWarningThreshold))
+    {
+        // the threshold has to be a positive number
+        if (m_pimpl->writeWarningThreshold < 0)
+        {
+            log()->error("{} 'write_warning_threshold' parameter has to be a positive number.",
+                         errorPrefix);
+            return false;
+        }
+    }
+
     // mandatory parameters
     bool ok = ptr->getParameter("positioning_duration", m_pimpl->positioningDuration)
               && (m_pimpl->positioningDuration > 0);
@@ -623,6 +793,13 @@ bool YarpRobotControl::initialize(std::weak_ptr<ParametersHandler::IParametersHa
 
 bool YarpRobotControl::setControlMode(const std::vector<IRobotControl::ControlMode>& controlModes)
 {
+    if (m_pimpl->modeSwitchState.load() == ControlModeSwitchState::Running)
+    {
+        log()->error("[YarpRobotControl::setControlMode] An asynchronous control mode switch is "
+                     "still running.");
+        return false;
+    }
+
     if (controlModes != m_pimpl->controlModes)
     {
         m_pimpl->controlModes = controlModes;
@@ -638,6 +815,13 @@ bool YarpRobotControl::setControlMode(const std::vector<IRobotControl::ControlMo
 
 bool YarpRobotControl::setControlMode(const IRobotControl::ControlMode& mode)
 {
+    if (m_pimpl->modeSwitchState.load() == ControlModeSwitchState::Running)
+    {
+        log()->error("[YarpRobotControl::setControlMode] An asynchronous control mode switch is "
+                     "still running.");
+        return false;
+    }
+
     // check if all the joints are controlled in the desired control mode
     if (!std::all_of(m_pimpl->controlModes.begin(),
                      m_pimpl->controlModes.end(),
@@ -653,6 +837,53 @@ bool YarpRobotControl::setControlMode(const IRobotControl::ControlMode& mode)
     return true;
 }
 
+bool YarpRobotControl::setControlModeAsync(
+    const std::vector<IRobotControl::ControlMode>& controlModes)
+{
+    constexpr auto errorPrefix = "[YarpRobotControl::setControlModeAsync]";
+
+    if (m_pimpl->modeSwitchState.load() == ControlModeSwitchState::Running)
+    {
+        log()->error("{} A control mode switch is already in progress.", errorPrefix);
+        return false;
+    }
+
+    // join the thread of a previously completed switch
+    if (m_pimpl->modeSwitchThread.joinable())
+    {
+        m_pimpl->modeSwitchThread.join();
+    }
+
+    // nothing to do if the robot is already controlled in the desired modes
+    if (controlModes == m_pimpl->controlModes)
+    {
+        m_pimpl->modeSwitchState = ControlModeSwitchState::Succeeded;
+        return true;
+    }
+
+    m_pimpl->pendingControlModes = controlModes;
+    m_pimpl->modeSwitchState = ControlModeSwitchState::Running;
+    m_pimpl->modeSwitchThread = std::thread([impl = m_pimpl.get()] {
+        impl->controlModes = impl->pendingControlModes;
+        const bool ok = impl->setControlModes(impl->controlModes);
+        impl->modeSwitchState = ok ? ControlModeSwitchState::Succeeded
+                                   : ControlModeSwitchState::Failed;
+    });
+
+    return true;
+}
+
+bool YarpRobotControl::setControlModeAsync(const IRobotControl::ControlMode& mode)
+{
+    const std::vector<IRobotControl::ControlMode> controlModes(m_pimpl->actuatedDOFs, mode);
+    return this->setControlModeAsync(controlModes);
+}
+
+YarpRobotControl::ControlModeSwitchState YarpRobotControl::getControlModeSwitchState() const
+{
+    return m_pimpl->modeSwitchState.load();
+}
+
 bool YarpRobotControl::setReferences(Eigen::Ref<const Eigen::VectorXd> jointValues,
                                      const std::vector<IRobotControl::ControlMode>& controlModes)
 {
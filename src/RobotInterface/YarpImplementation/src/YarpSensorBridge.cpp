@@ -10,6 +10,8 @@
 
 #include <yarp/eigen/Eigen.h>
 
+#include <limits>
+
 using namespace BipedalLocomotion::RobotInterface;
 using namespace BipedalLocomotion::GenericContainer;
 using namespace BipedalLocomotion::ParametersHandler;
@@ -38,6 +40,35 @@ bool YarpSensorBridge::initialize(std::weak_ptr<const IParametersHandler> handle
         return false;
     }
 
+    if (!ptr->getParameter("use_acquisition_thread", m_pimpl->useAcquisitionThread))
+    {
+        log()->info("{} The parameter 'use_acquisition_thread' is not found. The default one will "
+                    "be used {}.",
+                    logPrefix,
+                    m_pimpl->useAcquisitionThread);
+    }
+
+    if (!ptr->getParameter("acquisition_thread_period", m_pimpl->acquisitionPeriod))
+    {
+        log()->info("{} The parameter 'acquisition_thread_period' is not found. The default one "
+                    "will be used {} ns.",
+                    logPrefix,
+                    m_pimpl->acquisitionPeriod.count());
+    }
+
+    // optional per-stream read periods. A stream without a declared period is read at every
+    // advance() call
+    ptr->getParameter("read_period_inertials", m_pimpl->readPeriods.inertials);
+    ptr->getParameter("read_period_cartesian_wrenches", m_pimpl->readPeriods.cartesianWrenches);
+    ptr->getParameter("read_period_forcetorque_sensors", m_pimpl->readPeriods.forceTorqueSensors);
+    ptr->getParameter("read_period_temperatures", m_pimpl->readPeriods.temperatures);
+
+    // optional change detection thresholds. With the default threshold any variation of the
+    // stream increments the associated generation counter
+    ptr->getParameter("motor_currents_change_epsilon",
+                      m_pimpl->motorCurrentsChangeDetector.epsilon);
+    ptr->getParameter("temperatures_change_epsilon", m_pimpl->temperaturesChangeDetector.epsilon);
+
     bool ret{true};
     ret = m_pimpl->subConfigLoader("stream_joint_states",
                                    "RemoteControlBoardRemapper",
@@ -176,6 +207,30 @@ bool YarpSensorBridge::setDriversList(const yarp::dev::PolyDriverList& deviceDri
         return false;
     }
     m_pimpl->driversAttached = true;
+
+    if (m_pimpl->useAcquisitionThread && !m_pimpl->acquisitionThread.joinable())
+    {
+        // the acquisition thread continuously polls the YARP interfaces and publishes a coherent
+        // sample through the lock-free buffer. advance() becomes a constant time buffer flip, so
+        // an occasional driver hiccup delays the acquisition thread but never the control loop
+        m_pimpl->acquisitionThreadRunning = true;
+        m_pimpl->acquisitionThread = std::thread([impl = m_pimpl.get()] {
+            YarpSensorBridge::Impl::AsyncSample sample;
+            while (impl->acquisitionThreadRunning)
+            {
+                const auto wakeUpTime = BipedalLocomotion::clock().now() + impl->acquisitionPeriod;
+
+                impl->readAllSensors(sample.failedReads);
+                impl->fillSnapshot(sample.snapshot, sample.failedReads);
+                impl->asyncSampleResource->set(sample);
+
+                BipedalLocomotion::clock().sleepUntil(wakeUpTime);
+            }
+        });
+
+        log()->info("{} Sensor acquisition thread started.", logPrefix);
+    }
+
     return true;
 }
 
@@ -189,6 +244,13 @@ bool YarpSensorBridge::advance()
         return false;
     }
 
+    if (m_pimpl->useAcquisitionThread)
+    {
+        // constant time flip of the lock-free buffer filled by the acquisition thread. The age of
+        // the retrieved sample is available through getSnapshotAgeInSeconds()
+        return m_pimpl->flipAsyncSample();
+    }
+
     return m_pimpl->readAllSensors(m_pimpl->failedSensorReads);
 }
 
@@ -202,6 +264,101 @@ std::vector<std::string> YarpSensorBridge::getFailedSensorReads() const
     return m_pimpl->failedSensorReads;
 }
 
+bool YarpSensorBridge::readSnapshot(SensorSnapshot& snapshot)
+{
+    constexpr auto logPrefix = "[YarpSensorBridge::readSnapshot]";
+    if (!m_pimpl->checkValid(logPrefix))
+    {
+        log()->error("{} Please initialize and set drivers list before running readSnapshot().",
+                     logPrefix);
+        return false;
+    }
+
+    if (m_pimpl->useAcquisitionThread)
+    {
+        // constant time flip of the lock-free buffer filled by the acquisition thread. The YARP
+        // interfaces are not accessed by the calling thread
+        if (!m_pimpl->flipAsyncSample())
+        {
+            log()->error("{} The acquisition thread has not published any sample yet.", logPrefix);
+            return false;
+        }
+
+        snapshot = m_pimpl->asyncSample.snapshot;
+        return m_pimpl->failedSensorReads.empty();
+    }
+
+    // single pass over all the configured YARP interfaces
+    m_pimpl->readAllSensors(m_pimpl->failedSensorReads);
+
+    const bool ok = m_pimpl->fillSnapshot(snapshot, m_pimpl->failedSensorReads);
+    m_pimpl->lastSnapshotTimeInSeconds = snapshot.timeInSeconds;
+
+    if (!ok)
+    {
+        log()->error("{} Unable to read one or more of the configured sensor streams.", logPrefix);
+    }
+
+    return ok;
+}
+
+double YarpSensorBridge::getSnapshotAgeInSeconds() const
+{
+    if (m_pimpl->lastSnapshotTimeInSeconds < 0.0)
+    {
+        // no snapshot has been taken yet
+        return std::numeric_limits<double>::infinity();
+    }
+
+    return yarp::os::Time::now() - m_pimpl->lastSnapshotTimeInSeconds;
+}
+
+bool YarpSensorBridge::getStreamTimestamps(const std::string& streamName,
+                                           double& hardwareTimeInSeconds,
+                                           double& receivedTimeInSeconds) const
+{
+    const auto iter = m_pimpl->streamTimestamps.find(streamName);
+    if (iter == m_pimpl->streamTimestamps.end())
+    {
+        log()->error("[YarpSensorBridge::getStreamTimestamps] No stream named '{}' has been read "
+                     "yet.",
+                     streamName);
+        return false;
+    }
+
+    hardwareTimeInSeconds = iter->second.hardwareTimeInSeconds;
+    receivedTimeInSeconds = iter->second.receivedTimeInSeconds;
+    return true;
+}
+
+bool YarpSensorBridge::getStreamLatencyHistogram(const std::string& streamName,
+                                                 std::vector<std::size_t>& latencyCounts,
+                                                 double& binWidthInSeconds) const
+{
+    const auto iter = m_pimpl->latencyHistograms.find(streamName);
+    if (iter == m_pimpl->latencyHistograms.end())
+    {
+        log()->error("[YarpSensorBridge::getStreamLatencyHistogram] No latency sample has been "
+                     "accumulated for a stream named '{}'.",
+                     streamName);
+        return false;
+    }
+
+    latencyCounts = iter->second.counts;
+    binWidthInSeconds = YarpSensorBridge::Impl::LatencyHistogram::binWidthInSeconds;
+    return true;
+}
+
+std::size_t YarpSensorBridge::getMotorCurrentsGeneration() const
+{
+    return m_pimpl->motorCurrentsChangeDetector.generation;
+}
+
+std::size_t YarpSensorBridge::getTemperaturesGeneration() const
+{
+    return m_pimpl->temperaturesChangeDetector.generation;
+}
+
 const SensorBridgeMetaData& YarpSensorBridge::getOutput() const
 {
     return m_pimpl->metaData;
@@ -482,6 +639,187 @@ bool YarpSensorBridge::getJointAccelerations(Eigen::Ref<Eigen::VectorXd> jointAc
     return true;
 }
 
+bool YarpSensorBridge::registerJointSubset(const std::string& subsetName,
+                                           const std::vector<std::string>& jointsList,
+                                           JointSubsetHandle& subsetHandle)
+{
+    constexpr auto logPrefix = "[YarpSensorBridge::registerJointSubset]";
+
+    if (!m_pimpl->metaData.bridgeOptions.isJointSensorsEnabled)
+    {
+        log()->error("{} The joint sensors are not enabled. Unable to register a joint subset.",
+                     logPrefix);
+        return false;
+    }
+
+    for (const auto& subset : m_pimpl->jointSubsets)
+    {
+        if (subset.name == subsetName)
+        {
+            log()->error("{} A joint subset named '{}' is already registered.",
+                         logPrefix,
+                         subsetName);
+            return false;
+        }
+    }
+
+    const auto& fullJointsList = m_pimpl->metaData.sensorsList.jointsList;
+    YarpSensorBridge::Impl::JointSubset subset;
+    subset.name = subsetName;
+    subset.gatherIndices.resize(jointsList.size());
+    for (std::size_t idx = 0; idx < jointsList.size(); idx++)
+    {
+        const auto iter = std::find(fullJointsList.begin(), fullJointsList.end(), jointsList[idx]);
+        if (iter == fullJointsList.end())
+        {
+            log()->error("{} {} could not be found in the configured list of joints.",
+                         logPrefix,
+                         jointsList[idx]);
+            return false;
+        }
+
+        subset.gatherIndices[idx] = static_cast<int>(std::distance(fullJointsList.begin(), iter));
+    }
+
+    m_pimpl->jointSubsets.emplace_back(std::move(subset));
+    subsetHandle = m_pimpl->jointSubsets.size() - 1;
+    return true;
+}
+
+bool YarpSensorBridge::getJointSubsetHandle(const std::string& subsetName,
+                                            JointSubsetHandle& subsetHandle)
+{
+    for (std::size_t handle = 0; handle < m_pimpl->jointSubsets.size(); handle++)
+    {
+        if (m_pimpl->jointSubsets[handle].name == subsetName)
+        {
+            subsetHandle = handle;
+            return true;
+        }
+    }
+
+    log()->error("[YarpSensorBridge::getJointSubsetHandle] No joint subset named '{}' has been "
+                 "registered.",
+                 subsetName);
+    return false;
+}
+
+bool YarpSensorBridge::getJointPositions(const JointSubsetHandle subsetHandle,
+                                         Eigen::Ref<Eigen::VectorXd> jointPositions,
+                                         OptionalDoubleRef receiveTimeInSeconds)
+{
+    constexpr auto logPrefix = "[YarpSensorBridge::getJointPositions]";
+    if (!m_pimpl->checkControlBoardSensor(logPrefix,
+                                          m_pimpl->controlBoardRemapperInterfaces.encoders,
+                                          m_pimpl->metaData.bridgeOptions.isJointSensorsEnabled,
+                                          m_pimpl->controlBoardRemapperMeasures.jointPositions))
+    {
+        return false;
+    }
+
+    if (!m_pimpl->gatherJointSubset(logPrefix,
+                                    subsetHandle,
+                                    m_pimpl->controlBoardRemapperMeasures.jointPositions,
+                                    jointPositions))
+    {
+        return false;
+    }
+
+    if (receiveTimeInSeconds)
+    {
+        receiveTimeInSeconds.value().get()
+            = m_pimpl->controlBoardRemapperMeasures.receivedTimeInSeconds;
+    }
+    return true;
+}
+
+bool YarpSensorBridge::getJointVelocities(const JointSubsetHandle subsetHandle,
+                                          Eigen::Ref<Eigen::VectorXd> jointVelocities,
+                                          OptionalDoubleRef receiveTimeInSeconds)
+{
+    constexpr auto logPrefix = "[YarpSensorBridge::getJointVelocities]";
+    if (!m_pimpl->checkControlBoardSensor(logPrefix,
+                                          m_pimpl->controlBoardRemapperInterfaces.encoders,
+                                          m_pimpl->metaData.bridgeOptions.isJointSensorsEnabled,
+                                          m_pimpl->controlBoardRemapperMeasures.jointVelocities))
+    {
+        return false;
+    }
+
+    if (!m_pimpl->gatherJointSubset(logPrefix,
+                                    subsetHandle,
+                                    m_pimpl->controlBoardRemapperMeasures.jointVelocities,
+                                    jointVelocities))
+    {
+        return false;
+    }
+
+    if (receiveTimeInSeconds)
+    {
+        receiveTimeInSeconds.value().get()
+            = m_pimpl->controlBoardRemapperMeasures.receivedTimeInSeconds;
+    }
+    return true;
+}
+
+bool YarpSensorBridge::getJointAccelerations(const JointSubsetHandle subsetHandle,
+                                             Eigen::Ref<Eigen::VectorXd> jointAccelerations,
+                                             OptionalDoubleRef receiveTimeInSeconds)
+{
+    constexpr auto logPrefix = "[YarpSensorBridge::getJointAccelerations]";
+    if (!m_pimpl->checkControlBoardSensor(logPrefix,
+                                          m_pimpl->controlBoardRemapperInterfaces.encoders,
+                                          m_pimpl->metaData.bridgeOptions.isJointSensorsEnabled,
+                                          m_pimpl->controlBoardRemapperMeasures.jointAccelerations))
+    {
+        return false;
+    }
+
+    if (!m_pimpl->gatherJointSubset(logPrefix,
+                                    subsetHandle,
+                                    m_pimpl->controlBoardRemapperMeasures.jointAccelerations,
+                                    jointAccelerations))
+    {
+        return false;
+    }
+
+    if (receiveTimeInSeconds)
+    {
+        receiveTimeInSeconds.value().get()
+            = m_pimpl->controlBoardRemapperMeasures.receivedTimeInSeconds;
+    }
+    return true;
+}
+
+bool YarpSensorBridge::getJointTorques(const JointSubsetHandle subsetHandle,
+                                       Eigen::Ref<Eigen::VectorXd> jointTorques,
+                                       OptionalDoubleRef receiveTimeInSeconds)
+{
+    constexpr auto logPrefix = "[YarpSensorBridge::getJointTorques]";
+    if (!m_pimpl->checkControlBoardSensor(logPrefix,
+                                          m_pimpl->controlBoardRemapperInterfaces.torques,
+                                          m_pimpl->metaData.bridgeOptions.isJointSensorsEnabled,
+                                          m_pimpl->controlBoardRemapperMeasures.jointTorques))
+    {
+        return false;
+    }
+
+    if (!m_pimpl->gatherJointSubset(logPrefix,
+                                    subsetHandle,
+                                    m_pimpl->controlBoardRemapperMeasures.jointTorques,
+                                    jointTorques))
+    {
+        return false;
+    }
+
+    if (receiveTimeInSeconds)
+    {
+        receiveTimeInSeconds.value().get()
+            = m_pimpl->controlBoardRemapperMeasures.receivedTimeInSeconds;
+    }
+    return true;
+}
+
 bool YarpSensorBridge::getIMUMeasurement(const std::string& imuName,
                                          Eigen::Ref<Vector12d> imuMeasurement,
                                          OptionalDoubleRef receiveTimeInSeconds)
@@ -596,6 +934,55 @@ bool YarpSensorBridge::getSixAxisForceTorqueMeasurement(const std::string& ftNam
     return true;
 }
 
+bool YarpSensorBridge::getSixAxisForceTorqueMeasurementsStacked(
+    Eigen::Ref<Eigen::VectorXd> ftMeasurements,
+    std::vector<bool>& validityMask,
+    OptionalDoubleRef receiveTimeInSeconds)
+{
+    constexpr auto logPrefix = "[YarpSensorBridge::getSixAxisForceTorqueMeasurementsStacked]";
+
+    if (!m_pimpl->checkValid(logPrefix))
+    {
+        return false;
+    }
+
+    const auto& ftSensorsList = m_pimpl->metaData.sensorsList.sixAxisForceTorqueSensorsList;
+    if (ftMeasurements.size() != static_cast<Eigen::Index>(6 * ftSensorsList.size()))
+    {
+        log()->error("{} The size of the output vector ({}) does not match the expected size "
+                     "({}).",
+                     logPrefix,
+                     ftMeasurements.size(),
+                     6 * ftSensorsList.size());
+        return false;
+    }
+
+    validityMask.assign(ftSensorsList.size(), false);
+
+    double latestTimeInSeconds{-1.0};
+    for (std::size_t idx = 0; idx < ftSensorsList.size(); idx++)
+    {
+        const auto iter = m_pimpl->FTMeasures.find(ftSensorsList[idx]);
+        if (iter == m_pimpl->FTMeasures.end())
+        {
+            // no measurement has been received yet from this sensor
+            ftMeasurements.segment<6>(6 * idx).setZero();
+            continue;
+        }
+
+        ftMeasurements.segment<6>(6 * idx) = yarp::eigen::toEigen(iter->second.first);
+        validityMask[idx] = true;
+        latestTimeInSeconds = std::max(latestTimeInSeconds, iter->second.second);
+    }
+
+    if (receiveTimeInSeconds)
+    {
+        receiveTimeInSeconds.value().get() = latestTimeInSeconds;
+    }
+
+    return true;
+}
+
 bool YarpSensorBridge::getCartesianWrench(const std::string& cartesianWrenchName,
                                           Eigen::Ref<Vector6d> cartesianWrenchMeasurement,
                                           OptionalDoubleRef receiveTimeInSeconds)
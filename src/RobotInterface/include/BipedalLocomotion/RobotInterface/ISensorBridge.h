@@ -84,6 +84,95 @@ struct SensorBridgeMetaData
     SensorBridgeOptions bridgeOptions;
 };
 
+/**
+ * Flat-layout snapshot of all the sensor streams configured in a sensor bridge.
+ * Every multi-sensor stream is stored as a matrix with one column per sensor, ordered as the
+ * associated list in SensorLists. The whole snapshot shares a single timestamp taken when the
+ * measurements were read. The buffers can be preallocated once with resize() so that filling the
+ * snapshot does not perform any dynamic memory allocation.
+ */
+struct SensorSnapshot
+{
+    double timeInSeconds{0.0}; /**< time at which the snapshot was taken */
+
+    Eigen::VectorXd jointPositions; /**< joint positions in rad */
+    Eigen::VectorXd jointVelocities; /**< joint velocities in rad/s */
+    Eigen::VectorXd jointAccelerations; /**< joint accelerations in rad/s^2 */
+    Eigen::VectorXd jointTorques; /**< joint torques in Nm */
+
+    Eigen::VectorXd motorPositions; /**< motor positions in rad */
+    Eigen::VectorXd motorVelocities; /**< motor velocities in rad/s */
+    Eigen::VectorXd motorAccelerations; /**< motor accelerations in rad/s^2 */
+    Eigen::VectorXd motorCurrents; /**< motor currents in ampere */
+    Eigen::VectorXd motorPWMs; /**< motor PWMs */
+
+    Eigen::VectorXd pidPositions; /**< pid positions in rad */
+    Eigen::VectorXd pidPositionErrors; /**< pid position errors in rad */
+
+    Eigen::Matrix<double, 12, Eigen::Dynamic> imuMeasurements; /**< one IMU measurement
+                                                                  (rpy acc omega mag) per column */
+    Eigen::Matrix3Xd linearAccelerometerMeasurements; /**< one measurement in m/s^2 per column */
+    Eigen::Matrix3Xd gyroscopeMeasurements; /**< one measurement in rad/s per column */
+    Eigen::Matrix3Xd orientationSensorMeasurements; /**< one rpy measurement in rad per column */
+    Eigen::Matrix3Xd magnetometerMeasurements; /**< one measurement in tesla per column */
+
+    Eigen::Matrix<double, 6, Eigen::Dynamic> sixAxisForceTorqueMeasurements; /**< one wrench
+                                                                                per column */
+    Eigen::Matrix<double, 6, Eigen::Dynamic> cartesianWrenchMeasurements; /**< one wrench per
+                                                                             column */
+
+    Eigen::VectorXd temperatureMeasurements; /**< one temperature measurement per sensor */
+
+    /**
+     * Resize the buffers according to the streams enabled in the bridge meta data. Disabled
+     * streams are resized to zero. Calling this method with an unchanged meta data is a no-op, so
+     * it can be invoked safely before every read.
+     * @param metaData meta data of the bridge that will fill the snapshot.
+     */
+    void resize(const SensorBridgeMetaData& metaData)
+    {
+        const auto& options = metaData.bridgeOptions;
+        const auto& lists = metaData.sensorsList;
+
+        const Eigen::Index joints = options.isJointSensorsEnabled ? options.nrJoints : 0;
+        jointPositions.resize(joints);
+        jointVelocities.resize(joints);
+        jointAccelerations.resize(joints);
+        jointTorques.resize(joints);
+
+        const Eigen::Index motors = options.isMotorSensorsEnabled ? options.nrJoints : 0;
+        motorPositions.resize(motors);
+        motorVelocities.resize(motors);
+        motorAccelerations.resize(motors);
+        motorCurrents.resize(motors);
+        motorPWMs.resize(options.isPWMControlEnabled ? options.nrJoints : 0);
+
+        const Eigen::Index pids = options.isPIDsEnabled ? options.nrJoints : 0;
+        pidPositions.resize(pids);
+        pidPositionErrors.resize(pids);
+
+        imuMeasurements.resize(12, options.isIMUEnabled ? lists.IMUsList.size() : 0);
+        linearAccelerometerMeasurements
+            .resize(3, options.isLinearAccelerometerEnabled ? lists.linearAccelerometersList.size() : 0);
+        gyroscopeMeasurements.resize(3, options.isGyroscopeEnabled ? lists.gyroscopesList.size() : 0);
+        orientationSensorMeasurements
+            .resize(3, options.isOrientationSensorEnabled ? lists.orientationSensorsList.size() : 0);
+        magnetometerMeasurements
+            .resize(3, options.isMagnetometerEnabled ? lists.magnetometersList.size() : 0);
+
+        sixAxisForceTorqueMeasurements
+            .resize(6,
+                    options.isSixAxisForceTorqueSensorEnabled
+                        ? lists.sixAxisForceTorqueSensorsList.size()
+                        : 0);
+        cartesianWrenchMeasurements
+            .resize(6, options.isCartesianWrenchEnabled ? lists.cartesianWrenchesList.size() : 0);
+
+        temperatureMeasurements
+            .resize(options.isTemperatureSensorEnabled ? lists.temperatureSensorsList.size() : 0);
+    }
+};
+
 /**
  * Sensor bridge interface.
  */
@@ -98,6 +187,8 @@ public:
 
     using OptionalDoubleRef = std::optional<std::reference_wrapper<double>>;
 
+    using JointSubsetHandle = std::size_t; /**< handle identifying a registered joint subset */
+
     using Vector12d = Eigen::Matrix<double, 12, 1>;
     using Vector6d = Eigen::Matrix<double, 6, 1>;
 
@@ -292,6 +383,104 @@ public:
         return false;
     };
 
+    /**
+     * Register a named subset of the joints available through the bridge.
+     * The indices mapping the subset to the full joints list are computed once at registration
+     * time, so that reading the subset measurements does not perform any per-call joint name
+     * lookup.
+     * @param[in] subsetName unique name identifying the subset
+     * @param[in] jointsList list of the joints belonging to the subset, in the desired output order
+     * @param[out] subsetHandle handle to be used to read the subset measurements
+     * @return true/false in case of success/failure
+     */
+    virtual bool registerJointSubset(const std::string& subsetName,
+                                     const std::vector<std::string>& jointsList,
+                                     JointSubsetHandle& subsetHandle)
+    {
+        return false;
+    };
+
+    /**
+     * Get the handle of a joint subset previously registered with registerJointSubset()
+     * @param[in] subsetName name of the subset
+     * @param[out] subsetHandle handle associated to the subset
+     * @return true/false in case of success/failure
+     */
+    virtual bool getJointSubsetHandle(const std::string& subsetName, JointSubsetHandle& subsetHandle)
+    {
+        return false;
+    };
+
+    /**
+     * Get the positions in radians of a registered joint subset.
+     * The output is filled in a single indexed sweep through the gather indices computed at
+     * registration time.
+     * @param[in] subsetHandle handle obtained from registerJointSubset()
+     * @param[out] jointPositions subset joints' position in radians, ordered as the registered list
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @warning the user must pass an argument "jointPositions" resized to the subset size
+     * @return true/false in case of success/failure
+     */
+    virtual bool getJointPositions(const JointSubsetHandle subsetHandle,
+                                   Eigen::Ref<Eigen::VectorXd> jointPositions,
+                                   OptionalDoubleRef receiveTimeInSeconds = {})
+    {
+        return false;
+    };
+
+    /**
+     * Get the velocities in rad/s of a registered joint subset.
+     * The output is filled in a single indexed sweep through the gather indices computed at
+     * registration time.
+     * @param[in] subsetHandle handle obtained from registerJointSubset()
+     * @param[out] jointVelocities subset joints' velocities in radians per second, ordered as the
+     * registered list
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @warning the user must pass an argument "jointVelocities" resized to the subset size
+     * @return true/false in case of success/failure
+     */
+    virtual bool getJointVelocities(const JointSubsetHandle subsetHandle,
+                                    Eigen::Ref<Eigen::VectorXd> jointVelocities,
+                                    OptionalDoubleRef receiveTimeInSeconds = {})
+    {
+        return false;
+    };
+
+    /**
+     * Get the accelerations in rad/s^2 of a registered joint subset.
+     * The output is filled in a single indexed sweep through the gather indices computed at
+     * registration time.
+     * @param[in] subsetHandle handle obtained from registerJointSubset()
+     * @param[out] jointAccelerations subset joints' accelerations in radians per second squared,
+     * ordered as the registered list
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @warning the user must pass an argument "jointAccelerations" resized to the subset size
+     * @return true/false in case of success/failure
+     */
+    virtual bool getJointAccelerations(const JointSubsetHandle subsetHandle,
+                                       Eigen::Ref<Eigen::VectorXd> jointAccelerations,
+                                       OptionalDoubleRef receiveTimeInSeconds = {})
+    {
+        return false;
+    };
+
+    /**
+     * Get the torques in Nm of a registered joint subset.
+     * The output is filled in a single indexed sweep through the gather indices computed at
+     * registration time.
+     * @param[in] subsetHandle handle obtained from registerJointSubset()
+     * @param[out] jointTorques subset joints' torque in Nm, ordered as the registered list
+     * @param[out] receiveTimeInSeconds time at which the measurement was received
+     * @warning the user must pass an argument "jointTorques" resized to the subset size
+     * @return true/false in case of success/failure
+     */
+    virtual bool getJointTorques(const JointSubsetHandle subsetHandle,
+                                 Eigen::Ref<Eigen::VectorXd> jointTorques,
+                                 OptionalDoubleRef receiveTimeInSeconds = {})
+    {
+        return false;
+    };
+
     /**
      * Get IMU measurement
      * The serialization of measurments is as follows,
@@ -425,6 +614,19 @@ public:
         return false;
     };
 
+    /**
+     * Read all the configured sensor streams in a single pass and fill the snapshot with a
+     * coherent timestamp.
+     * @param[out] snapshot preallocated snapshot filled with the measurements.
+     * @note The snapshot buffers can be preallocated with SensorSnapshot::resize(). Disabled
+     * streams are left empty.
+     * @return true/false in case of success/failure
+     */
+    virtual bool readSnapshot(SensorSnapshot& snapshot)
+    {
+        return false;
+    };
+
     /**
      * Destructor
      */
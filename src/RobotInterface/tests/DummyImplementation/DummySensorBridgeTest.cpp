@@ -53,3 +53,34 @@ TEST_CASE("Test Sensor Bridge Interface")
     REQUIRE(acc(2) == -9.8);
     REQUIRE(accRecvTime == 10.0);
 }
+
+TEST_CASE("Test Sensor Snapshot")
+{
+    SensorBridgeMetaData metaData;
+    metaData.bridgeOptions.isJointSensorsEnabled = true;
+    metaData.bridgeOptions.nrJoints = 23;
+    metaData.bridgeOptions.isLinearAccelerometerEnabled = true;
+    metaData.sensorsList.linearAccelerometersList = {"dummy"};
+    metaData.bridgeOptions.isSixAxisForceTorqueSensorEnabled = true;
+    metaData.sensorsList.sixAxisForceTorqueSensorsList = {"l_foot", "r_foot"};
+
+    SensorSnapshot snapshot;
+    snapshot.resize(metaData);
+
+    // the enabled streams are sized according to the meta data
+    REQUIRE(snapshot.jointPositions.size() == 23);
+    REQUIRE(snapshot.jointVelocities.size() == 23);
+    REQUIRE(snapshot.linearAccelerometerMeasurements.cols() == 1);
+    REQUIRE(snapshot.sixAxisForceTorqueMeasurements.rows() == 6);
+    REQUIRE(snapshot.sixAxisForceTorqueMeasurements.cols() == 2);
+
+    // the disabled streams are left empty
+    REQUIRE(snapshot.motorPositions.size() == 0);
+    REQUIRE(snapshot.imuMeasurements.cols() == 0);
+    REQUIRE(snapshot.gyroscopeMeasurements.cols() == 0);
+    REQUIRE(snapshot.temperatureMeasurements.size() == 0);
+
+    // the default implementation of the interface does not provide the snapshot
+    std::shared_ptr<DummySensorBridge> dummyBridge = std::make_shared<DummySensorBridge>();
+    REQUIRE_FALSE(dummyBridge->readSnapshot(snapshot));
+}
@@ -0,0 +1,505 @@
+/**
+ * @file YarpRobotInterfaceBenchmarkTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+// YARP
+#include <yarp/dev/Drivers.h>
+#include <yarp/dev/IAxisInfo.h>
+#include <yarp/dev/IEncodersTimed.h>
+#include <yarp/dev/ITorqueControl.h>
+#include <yarp/dev/PolyDriver.h>
+#include <yarp/dev/PolyDriverList.h>
+#include <yarp/os/Property.h>
+#include <yarp/os/Time.h>
+
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/RobotInterface/YarpRobotControl.h>
+#include <BipedalLocomotion/RobotInterface/YarpSensorBridge.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::RobotInterface;
+
+namespace
+{
+
+/**
+ * Minimal motion control device whose encoder reads can be stalled or forced to fail on demand.
+ * It is used to verify that the worst case behavior of the bridge is bounded when a driver
+ * misbehaves, as it happens on flaky CAN hardware.
+ */
+class StallableMotionControl : public yarp::dev::DeviceDriver,
+                               public yarp::dev::IAxisInfo,
+                               public yarp::dev::IEncodersTimed,
+                               public yarp::dev::ITorqueControl
+{
+public:
+    static constexpr int numberOfJoints = 4;
+
+    /** Duration of the stall injected in every encoder read */
+    static std::atomic<int>& stallMilliseconds()
+    {
+        static std::atomic<int> duration{0};
+        return duration;
+    }
+
+    /** When true every encoder read fails, emulating a driver timeout */
+    static std::atomic<bool>& failReads()
+    {
+        static std::atomic<bool> fail{false};
+        return fail;
+    }
+
+    bool open(yarp::os::Searchable&) override
+    {
+        return true;
+    }
+
+    bool close() override
+    {
+        return true;
+    }
+
+    // IAxisInfo
+    bool getAxisName(int axis, std::string& name) override
+    {
+        name = "joint_" + std::to_string(axis);
+        return true;
+    }
+
+    bool getJointType(int axis, yarp::dev::JointTypeEnum& type) override
+    {
+        type = yarp::dev::VOCAB_JOINTTYPE_REVOLUTE;
+        return true;
+    }
+
+    // IEncoders
+    bool getAxes(int* ax) override
+    {
+        *ax = numberOfJoints;
+        return true;
+    }
+
+    bool resetEncoder(int) override
+    {
+        return true;
+    }
+
+    bool resetEncoders() override
+    {
+        return true;
+    }
+
+    bool setEncoder(int, double) override
+    {
+        return true;
+    }
+
+    bool setEncoders(const double*) override
+    {
+        return true;
+    }
+
+    bool getEncoder(int, double* v) override
+    {
+        *v = 0.0;
+        return true;
+    }
+
+    bool getEncoders(double* encs) override
+    {
+        std::fill(encs, encs + numberOfJoints, 0.0);
+        return true;
+    }
+
+    bool getEncoderSpeed(int, double* sp) override
+    {
+        *sp = 0.0;
+        return true;
+    }
+
+    bool getEncoderSpeeds(double* spds) override
+    {
+        std::fill(spds, spds + numberOfJoints, 0.0);
+        return true;
+    }
+
+    bool getEncoderAcceleration(int, double* acc) override
+    {
+        *acc = 0.0;
+        return true;
+    }
+
+    bool getEncoderAccelerations(double* accs) override
+    {
+        std::fill(accs, accs + numberOfJoints, 0.0);
+        return true;
+    }
+
+    // IEncodersTimed
+    bool getEncodersTimed(double* encs, double* time) override
+    {
+        const int stall = stallMilliseconds().load();
+        if (stall > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(stall));
+        }
+
+        if (failReads().load())
+        {
+            return false;
+        }
+
+        std::fill(encs, encs + numberOfJoints, 0.0);
+        std::fill(time, time + numberOfJoints, yarp::os::Time::now());
+        return true;
+    }
+
+    bool getEncoderTimed(int, double* encs, double* time) override
+    {
+        *encs = 0.0;
+        *time = yarp::os::Time::now();
+        return true;
+    }
+
+    // ITorqueControl
+    bool getRefTorques(double* t) override
+    {
+        std::fill(t, t + numberOfJoints, 0.0);
+        return true;
+    }
+
+    bool getRefTorque(int, double* t) override
+    {
+        *t = 0.0;
+        return true;
+    }
+
+    bool setRefTorques(const double*) override
+    {
+        return true;
+    }
+
+    bool setRefTorque(int, double) override
+    {
+        return true;
+    }
+
+    bool setRefTorques(const int, const int*, const double*) override
+    {
+        return true;
+    }
+
+    bool getTorque(int, double* t) override
+    {
+        *t = 0.0;
+        return true;
+    }
+
+    bool getTorques(double* t) override
+    {
+        std::fill(t, t + numberOfJoints, 0.0);
+        return true;
+    }
+
+    bool getTorqueRange(int, double* min, double* max) override
+    {
+        *min = -1.0;
+        *max = 1.0;
+        return true;
+    }
+
+    bool getTorqueRanges(double* min, double* max) override
+    {
+        std::fill(min, min + numberOfJoints, -1.0);
+        std::fill(max, max + numberOfJoints, 1.0);
+        return true;
+    }
+};
+
+void registerStallableMotionControl()
+{
+    static bool registered = false;
+    if (!registered)
+    {
+        yarp::dev::Drivers::factory().add(
+            new yarp::dev::DriverCreatorOf<StallableMotionControl>("stallableMotionControl",
+                                                                   "",
+                                                                   "StallableMotionControl"));
+        registered = true;
+    }
+}
+
+std::shared_ptr<StdImplementation> makeBridgeConfig(const bool useAcquisitionThread)
+{
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("check_for_nan", false);
+    handler->setParameter("stream_joint_states", true);
+    handler->setParameter("use_acquisition_thread", useAcquisitionThread);
+
+    // the joints list is optional: the order of the joints stored in the device is used
+    auto controlBoardGroup = std::make_shared<StdImplementation>();
+    handler->setGroup("RemoteControlBoardRemapper", controlBoardGroup);
+
+    return handler;
+}
+
+double percentile(std::vector<double> samples, const double fraction)
+{
+    REQUIRE_FALSE(samples.empty());
+    std::sort(samples.begin(), samples.end());
+    const auto index = static_cast<std::size_t>(fraction * (samples.size() - 1));
+    return samples[index];
+}
+
+} // namespace
+
+TEST_CASE("YarpSensorBridge benchmark")
+{
+    registerStallableMotionControl();
+
+    yarp::os::Property options;
+    options.put("device", "stallableMotionControl");
+
+    auto driver = std::make_shared<yarp::dev::PolyDriver>();
+    REQUIRE(driver->open(options));
+
+    StallableMotionControl::stallMilliseconds() = 0;
+    StallableMotionControl::failReads() = false;
+
+    YarpSensorBridge bridge;
+    REQUIRE(bridge.initialize(makeBridgeConfig(false)));
+
+    yarp::dev::PolyDriverList driversList;
+    driversList.push(driver.get(), "stallableMotionControl");
+    REQUIRE(bridge.setDriversList(driversList));
+
+    constexpr std::size_t iterations = 1000;
+    std::vector<double> advanceDurations, snapshotDurations;
+    advanceDurations.reserve(iterations);
+    snapshotDurations.reserve(iterations);
+
+    SensorSnapshot snapshot;
+    for (std::size_t i = 0; i < iterations; i++)
+    {
+        double start = yarp::os::Time::now();
+        REQUIRE(bridge.advance());
+        advanceDurations.push_back(yarp::os::Time::now() - start);
+
+        start = yarp::os::Time::now();
+        REQUIRE(bridge.readSnapshot(snapshot));
+        snapshotDurations.push_back(yarp::os::Time::now() - start);
+    }
+
+    // the worst case of an healthy driver should stay well below a control period
+    log()->info("[YarpSensorBridge benchmark] advance() latency [s]: mean {}, p99 {}, p99.9 {}, "
+                "max {}.",
+                std::accumulate(advanceDurations.begin(), advanceDurations.end(), 0.0)
+                    / advanceDurations.size(),
+                percentile(advanceDurations, 0.99),
+                percentile(advanceDurations, 0.999),
+                *std::max_element(advanceDurations.begin(), advanceDurations.end()));
+    log()->info("[YarpSensorBridge benchmark] readSnapshot() latency [s]: mean {}, p99 {}, "
+                "p99.9 {}, max {}.",
+                std::accumulate(snapshotDurations.begin(), snapshotDurations.end(), 0.0)
+                    / snapshotDurations.size(),
+                percentile(snapshotDurations, 0.99),
+                percentile(snapshotDurations, 0.999),
+                *std::max_element(snapshotDurations.begin(), snapshotDurations.end()));
+
+    // the encoder stream must expose a valid (hardware, received) timestamp pair
+    double hardwareTime{-1.0}, receivedTime{-1.0};
+    REQUIRE(bridge.getStreamTimestamps("control_board", hardwareTime, receivedTime));
+    REQUIRE(hardwareTime >= 0.0);
+    REQUIRE(receivedTime >= hardwareTime);
+
+    std::vector<std::size_t> latencyCounts;
+    double binWidth{0.0};
+    REQUIRE(bridge.getStreamLatencyHistogram("control_board", latencyCounts, binWidth));
+    REQUIRE(binWidth > 0.0);
+    std::size_t accumulatedSamples = 0;
+    for (const auto& count : latencyCounts)
+    {
+        accumulatedSamples += count;
+    }
+    REQUIRE(accumulatedSamples >= iterations);
+}
+
+TEST_CASE("YarpSensorBridge driver stall injection")
+{
+    registerStallableMotionControl();
+
+    yarp::os::Property options;
+    options.put("device", "stallableMotionControl");
+
+    constexpr int stallMilliseconds = 50;
+    constexpr double stallSeconds = stallMilliseconds * 1e-3;
+
+    SECTION("Synchronous advance is bounded by the injected stall")
+    {
+        auto driver = std::make_shared<yarp::dev::PolyDriver>();
+        REQUIRE(driver->open(options));
+
+        StallableMotionControl::stallMilliseconds() = 0;
+        StallableMotionControl::failReads() = false;
+
+        YarpSensorBridge bridge;
+        REQUIRE(bridge.initialize(makeBridgeConfig(false)));
+
+        yarp::dev::PolyDriverList driversList;
+        driversList.push(driver.get(), "stallableMotionControl");
+        REQUIRE(bridge.setDriversList(driversList));
+
+        StallableMotionControl::stallMilliseconds() = stallMilliseconds;
+
+        const double start = yarp::os::Time::now();
+        REQUIRE(bridge.advance());
+        const double elapsed = yarp::os::Time::now() - start;
+
+        // the stall propagates to the caller in synchronous mode and stays bounded
+        REQUIRE(elapsed >= 0.9 * stallSeconds);
+        REQUIRE(elapsed < stallSeconds + 1.0);
+
+        StallableMotionControl::stallMilliseconds() = 0;
+    }
+
+    SECTION("Acquisition thread decouples the consumer from a stalled driver")
+    {
+        auto driver = std::make_shared<yarp::dev::PolyDriver>();
+        REQUIRE(driver->open(options));
+
+        StallableMotionControl::stallMilliseconds() = 0;
+        StallableMotionControl::failReads() = false;
+
+        YarpSensorBridge bridge;
+        REQUIRE(bridge.initialize(makeBridgeConfig(true)));
+
+        yarp::dev::PolyDriverList driversList;
+        driversList.push(driver.get(), "stallableMotionControl");
+        REQUIRE(bridge.setDriversList(driversList));
+
+        // wait until the acquisition thread publishes the first sample
+        SensorSnapshot snapshot;
+        const double waitStart = yarp::os::Time::now();
+        bool sampleAvailable = false;
+        while (!sampleAvailable && (yarp::os::Time::now() - waitStart < 5.0))
+        {
+            sampleAvailable = bridge.advance() && bridge.readSnapshot(snapshot);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(sampleAvailable);
+
+        // stall the driver and verify that the consumer side flip stays constant time
+        StallableMotionControl::stallMilliseconds() = stallMilliseconds;
+
+        double maxFlipDuration = 0.0;
+        for (std::size_t i = 0; i < 50; i++)
+        {
+            const double start = yarp::os::Time::now();
+            REQUIRE(bridge.advance());
+            REQUIRE(bridge.readSnapshot(snapshot));
+            maxFlipDuration = std::max(maxFlipDuration, yarp::os::Time::now() - start);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+
+        // the consumer must never be blocked for the duration of the driver stall
+        REQUIRE(maxFlipDuration < 0.5 * stallSeconds);
+
+        StallableMotionControl::stallMilliseconds() = 0;
+    }
+
+    SECTION("The bridge recovers from driver read failures")
+    {
+        auto driver = std::make_shared<yarp::dev::PolyDriver>();
+        REQUIRE(driver->open(options));
+
+        StallableMotionControl::stallMilliseconds() = 0;
+        StallableMotionControl::failReads() = false;
+
+        YarpSensorBridge bridge;
+        REQUIRE(bridge.initialize(makeBridgeConfig(false)));
+
+        yarp::dev::PolyDriverList driversList;
+        driversList.push(driver.get(), "stallableMotionControl");
+        REQUIRE(bridge.setDriversList(driversList));
+
+        REQUIRE(bridge.advance());
+
+        // emulate a driver timeout: the bridge must keep the previous measurement and not hang
+        StallableMotionControl::failReads() = true;
+        const double start = yarp::os::Time::now();
+        REQUIRE(bridge.advance());
+        REQUIRE(yarp::os::Time::now() - start < 1.0);
+
+        // once the driver recovers the measurements are streamed again
+        StallableMotionControl::failReads() = false;
+        REQUIRE(bridge.advance());
+
+        Eigen::VectorXd jointPositions(StallableMotionControl::numberOfJoints);
+        REQUIRE(bridge.getJointPositions(jointPositions));
+    }
+}
+
+TEST_CASE("YarpRobotControl write latency benchmark")
+{
+    yarp::os::Property options;
+    options.put("device", "fakeMotionControl");
+    yarp::os::Property& general = options.addGroup("GENERAL");
+    general.put("Joints", 4);
+
+    auto driver = std::make_shared<yarp::dev::PolyDriver>();
+    if (!driver->open(options))
+    {
+        // the fakeMotionControl plugin is not available in this installation
+        log()->warn("[YarpRobotControl write latency benchmark] Unable to open the "
+                    "fakeMotionControl device. Skipping the benchmark.");
+        return;
+    }
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("positioning_duration", 1.0);
+    handler->setParameter("positioning_tolerance", 0.5);
+    handler->setParameter("position_direct_max_admissible_error", 1.0);
+
+    YarpRobotControl robotControl;
+    REQUIRE(robotControl.initialize(handler));
+    REQUIRE(robotControl.setDriver(driver));
+    REQUIRE(robotControl.setControlMode(IRobotControl::ControlMode::PositionDirect));
+
+    constexpr std::size_t iterations = 200;
+    std::vector<double> writeDurations;
+    writeDurations.reserve(iterations);
+
+    Eigen::VectorXd references = Eigen::VectorXd::Zero(4);
+    for (std::size_t i = 0; i < iterations; i++)
+    {
+        const double start = yarp::os::Time::now();
+        REQUIRE(robotControl.setReferences(references, IRobotControl::ControlMode::PositionDirect));
+        writeDurations.push_back(yarp::os::Time::now() - start);
+    }
+
+    log()->info("[YarpRobotControl write latency benchmark] setReferences() latency [s]: mean {}, "
+                "p99 {}, p99.9 {}, max {}.",
+                std::accumulate(writeDurations.begin(), writeDurations.end(), 0.0)
+                    / writeDurations.size(),
+                percentile(writeDurations, 0.99),
+                percentile(writeDurations, 0.999),
+                *std::max_element(writeDurations.begin(), writeDurations.end()));
+}
@@ -8,6 +8,8 @@
 #ifndef BIPEDAL_LOCOMOTION_SIMPLIFIED_MODEL_CONTROLLERS_COM_ZMP_CONTROLLER_H
 #define BIPEDAL_LOCOMOTION_SIMPLIFIED_MODEL_CONTROLLERS_COM_ZMP_CONTROLLER_H
 
+#include <array>
+#include <cstdint>
 #include <memory>
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
@@ -60,18 +62,48 @@ using CoMZMPControllerOutput = Eigen::Vector2d;
 class CoMZMPController : public System::Advanceable<CoMZMPControllerInput, CoMZMPControllerOutput>
 {
 public:
+    /**
+     * Support phase used to select the active set of gains. The gains of each phase are
+     * precomputed at initialization time, so switching phase at run time only swaps the index of
+     * the active entry of the gain table.
+     */
+    enum class SupportPhase : std::size_t
+    {
+        DoubleSupport = 0,
+        SingleSupport = 1
+    };
+
     /**
      * Initialize the controller.
      * @param handler pointer to the parameter handler.
      * @note the following parameters are required by the class
-     * |  Parameter Name  |        Type      |                                         Description                                                   | Mandatory |
-     * |:----------------:|:----------------:|:-----------------------------------------------------------------------------------------------------:|:---------:|
-     * |    `com_gain`    | `vector<double>` | 2D-vector containing the gains of the CoM written in a frame rigidly attached to the simplified model |    Yes    |
-     * |    `zmp_gain`    | `vector<double>` | 2D-vector containing the gains of the ZMP written in a frame rigidly attached to the simplified model |    Yes    |
+     * |       Parameter Name        |        Type      |                                         Description                                                   | Mandatory |
+     * |:---------------------------:|:----------------:|:-----------------------------------------------------------------------------------------------------:|:---------:|
+     * |         `com_gain`          | `vector<double>` | 2D-vector containing the gains of the CoM written in a frame rigidly attached to the simplified model |    Yes    |
+     * |         `zmp_gain`          | `vector<double>` | 2D-vector containing the gains of the ZMP written in a frame rigidly attached to the simplified model |    Yes    |
+     * | `single_support_com_gain`   | `vector<double>` | 2D-vector containing the CoM gains used during the single support phase. If not provided, `com_gain` is used in every phase |    No    |
+     * | `single_support_zmp_gain`   | `vector<double>` | 2D-vector containing the ZMP gains used during the single support phase. If not provided, `zmp_gain` is used in every phase |    No    |
      * @return true in case of success/false otherwise.
      */
      bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler) override;
 
+     /**
+      * Set the support phase. The method selects the set of gains associated to the given phase
+      * from the table precomputed by initialize(), so it can be called in the control loop without
+      * any extra computation.
+      * @param phase the current support phase.
+      */
+     void setSupportPhase(const SupportPhase& phase);
+
+     /**
+      * Get the generation of the active gain set. The generation is incremented every time the
+      * gains change, i.e. by initialize() and by setSupportPhase() when the phase differs from the
+      * active one. A consumer caching quantities that depend on the gains can use it to detect a
+      * gain swap.
+      * @return the current gain generation.
+      */
+     std::uint64_t gainGeneration() const;
+
      /**
       * Get the the controller output.
       * @return The velocity of the CoM.
@@ -134,10 +166,71 @@ public:
                       Eigen::Ref<const Eigen::Vector2d> ZMPPosition,
                       const double angle);
 
+     /**
+      * Evaluate the control law on a batch of states and references sharing the same yaw angle.
+      * Each column of the matrices contains one sample of the horizon. The gains, rotated once in
+      * the inertial frame, are applied to the whole batch with a single matrix-matrix product, so
+      * a preview controller can evaluate a 50-point horizon without calling advance() in a loop.
+      * @param desiredCoMVelocity 2xN matrix whose columns contain the desired CoM velocities.
+      * @param desiredCoMPosition 2xN matrix whose columns contain the desired CoM positions.
+      * @param desiredZMPPosition 2xN matrix whose columns contain the desired ZMP positions.
+      * @param CoMPosition 2xN matrix whose columns contain the CoM positions.
+      * @param ZMPPosition 2xN matrix whose columns contain the ZMP positions.
+      * @param angle the yaw angle (in radians) shared by all the samples.
+      * @param output 2xN matrix whose columns are filled with the CoM velocities computed by the
+      * control law. The matrix must be already resized to the proper dimension.
+      * @return true in case of success, false otherwise.
+      * @note This method does not modify the state of the advanceable block, i.e. the output of
+      * getOutput() is not affected.
+      */
+     bool computeBatch(Eigen::Ref<const Eigen::Matrix2Xd> desiredCoMVelocity,
+                       Eigen::Ref<const Eigen::Matrix2Xd> desiredCoMPosition,
+                       Eigen::Ref<const Eigen::Matrix2Xd> desiredZMPPosition,
+                       Eigen::Ref<const Eigen::Matrix2Xd> CoMPosition,
+                       Eigen::Ref<const Eigen::Matrix2Xd> ZMPPosition,
+                       const double angle,
+                       Eigen::Ref<Eigen::Matrix2Xd> output);
+
+     /**
+      * Evaluate the control law on a batch of states and references with one yaw angle per
+      * sample. Each column of the matrices contains one sample of the horizon. The per-sample
+      * rotations are applied component-wise on the rows of the error matrices, so the whole batch
+      * is still evaluated with vectorized operations instead of a loop of small-vector math.
+      * @param desiredCoMVelocity 2xN matrix whose columns contain the desired CoM velocities.
+      * @param desiredCoMPosition 2xN matrix whose columns contain the desired CoM positions.
+      * @param desiredZMPPosition 2xN matrix whose columns contain the desired ZMP positions.
+      * @param CoMPosition 2xN matrix whose columns contain the CoM positions.
+      * @param ZMPPosition 2xN matrix whose columns contain the ZMP positions.
+      * @param angle N-vector containing the yaw angle (in radians) of each sample.
+      * @param output 2xN matrix whose columns are filled with the CoM velocities computed by the
+      * control law. The matrix must be already resized to the proper dimension.
+      * @return true in case of success, false otherwise.
+      * @note This method does not modify the state of the advanceable block, i.e. the output of
+      * getOutput() is not affected.
+      */
+     bool computeBatch(Eigen::Ref<const Eigen::Matrix2Xd> desiredCoMVelocity,
+                       Eigen::Ref<const Eigen::Matrix2Xd> desiredCoMPosition,
+                       Eigen::Ref<const Eigen::Matrix2Xd> desiredZMPPosition,
+                       Eigen::Ref<const Eigen::Matrix2Xd> CoMPosition,
+                       Eigen::Ref<const Eigen::Matrix2Xd> ZMPPosition,
+                       Eigen::Ref<const Eigen::VectorXd> angle,
+                       Eigen::Ref<Eigen::Matrix2Xd> output);
+
  private:
+     /** Set of gains associated to one support phase. The diagonal matrices are precomputed at
+      * initialization time so that the control loop runs fixed-size matrix products only. */
+     struct PhaseGains
+     {
+         Eigen::Vector2d CoMGain{Eigen::Vector2d::Zero()};
+         Eigen::Vector2d ZMPGain{Eigen::Vector2d::Zero()};
+         Eigen::Matrix2d CoMGainMatrix{Eigen::Matrix2d::Zero()};
+         Eigen::Matrix2d ZMPGainMatrix{Eigen::Matrix2d::Zero()};
+     };
+
      manif::SO2d m_I_R_B{manif::SO2d::Identity()};
-     Eigen::Vector2d m_CoMGain{Eigen::Vector2d::Zero()};
-     Eigen::Vector2d m_ZMPGain{Eigen::Vector2d::Zero()};
+     std::array<PhaseGains, 2> m_gainTable; /**< Gain table indexed by the support phase. */
+     std::size_t m_activePhase{static_cast<std::size_t>(SupportPhase::DoubleSupport)};
+     std::uint64_t m_gainGeneration{0}; /**< Incremented every time the active gains change. */
 
      Eigen::Vector2d m_controllerOutput{Eigen::Vector2d::Zero()};
 
@@ -28,8 +28,11 @@ bool CoMZMPController::initialize(std::weak_ptr<const ParametersHandler::IParame
         return false;
     }
 
-    bool ok = ptr->getParameter("com_gain", m_CoMGain);
-    ok = ok && ptr->getParameter("zmp_gain", m_ZMPGain);
+    auto& doubleSupport = m_gainTable[static_cast<std::size_t>(SupportPhase::DoubleSupport)];
+    auto& singleSupport = m_gainTable[static_cast<std::size_t>(SupportPhase::SingleSupport)];
+
+    bool ok = ptr->getParameter("com_gain", doubleSupport.CoMGain);
+    ok = ok && ptr->getParameter("zmp_gain", doubleSupport.ZMPGain);
 
     if (!ok)
     {
@@ -37,11 +40,51 @@ bool CoMZMPController::initialize(std::weak_ptr<const ParametersHandler::IParame
         return false;
     }
 
+    // if the single support gains are not provided, the same gains are used in every phase
+    singleSupport = doubleSupport;
+    if (ptr->getParameter("single_support_com_gain", singleSupport.CoMGain)
+        != ptr->getParameter("single_support_zmp_gain", singleSupport.ZMPGain))
+    {
+        log()->error("{} The parameters 'single_support_com_gain' and 'single_support_zmp_gain' "
+                     "must be provided together.",
+                     logPrefix);
+        return false;
+    }
+
+    // precompute the diagonal gain matrices so that the control loop runs fixed-size matrix
+    // products only
+    for (auto& gains : m_gainTable)
+    {
+        gains.CoMGainMatrix = gains.CoMGain.asDiagonal();
+        gains.ZMPGainMatrix = gains.ZMPGain.asDiagonal();
+    }
+
+    m_activePhase = static_cast<std::size_t>(SupportPhase::DoubleSupport);
+    m_gainGeneration++;
+
     m_isInitalized = true;
 
     return true;
 }
 
+void CoMZMPController::setSupportPhase(const SupportPhase& phase)
+{
+    const auto index = static_cast<std::size_t>(phase);
+    if (index == m_activePhase)
+    {
+        return;
+    }
+
+    m_activePhase = index;
+    m_gainGeneration++;
+    m_isOutputValid = false;
+}
+
+std::uint64_t CoMZMPController::gainGeneration() const
+{
+    return m_gainGeneration;
+}
+
 const CoMZMPController::Output& CoMZMPController::getOutput() const
 {
     return m_controllerOutput;
@@ -64,22 +107,132 @@ bool CoMZMPController::advance()
     if (m_isOutputValid)
         return true;
 
+    const PhaseGains& gains = m_gainTable[m_activePhase];
+
     // feed forward
     m_controllerOutput = m_desiredCoMVelocity;
 
     // CoM Controller
     m_controllerOutput.noalias() += m_I_R_B.act(
-        m_CoMGain.asDiagonal() * m_I_R_B.inverse().act(m_desiredCoMPosition - m_CoMPosition));
+        gains.CoMGainMatrix * m_I_R_B.inverse().act(m_desiredCoMPosition - m_CoMPosition));
 
     // ZMP Controller
     m_controllerOutput.noalias() += m_I_R_B.act(
-        m_ZMPGain.asDiagonal() * m_I_R_B.inverse().act(m_ZMPPosition - m_desiredZMPPosition));
+        gains.ZMPGainMatrix * m_I_R_B.inverse().act(m_ZMPPosition - m_desiredZMPPosition));
 
     m_isOutputValid = true;
 
     return true;
 }
 
+bool CoMZMPController::computeBatch(Eigen::Ref<const Eigen::Matrix2Xd> desiredCoMVelocity,
+                                    Eigen::Ref<const Eigen::Matrix2Xd> desiredCoMPosition,
+                                    Eigen::Ref<const Eigen::Matrix2Xd> desiredZMPPosition,
+                                    Eigen::Ref<const Eigen::Matrix2Xd> CoMPosition,
+                                    Eigen::Ref<const Eigen::Matrix2Xd> ZMPPosition,
+                                    const double angle,
+                                    Eigen::Ref<Eigen::Matrix2Xd> output)
+{
+    constexpr auto logPrefix = "[CoMZMPController::computeBatch]";
+
+    if (!m_isInitalized)
+    {
+        log()->error("{} The controller is not initialized. Please call the 'initialize()' "
+                     "method",
+                     logPrefix);
+        return false;
+    }
+
+    const Eigen::Index samples = output.cols();
+    if (desiredCoMVelocity.cols() != samples || desiredCoMPosition.cols() != samples
+        || desiredZMPPosition.cols() != samples || CoMPosition.cols() != samples
+        || ZMPPosition.cols() != samples)
+    {
+        log()->error("{} All the matrices must have the same number of columns.", logPrefix);
+        return false;
+    }
+
+    // rotate the gains once in the inertial frame so that the whole batch is evaluated with two
+    // matrix-matrix products
+    const PhaseGains& gains = m_gainTable[m_activePhase];
+    const Eigen::Matrix2d I_R_B = manif::SO2d(angle).rotation();
+    const Eigen::Matrix2d CoMGainInertial = I_R_B * gains.CoMGainMatrix * I_R_B.transpose();
+    const Eigen::Matrix2d ZMPGainInertial = I_R_B * gains.ZMPGainMatrix * I_R_B.transpose();
+
+    // feed forward
+    output = desiredCoMVelocity;
+
+    // CoM Controller
+    output.noalias() += CoMGainInertial * (desiredCoMPosition - CoMPosition);
+
+    // ZMP Controller
+    output.noalias() += ZMPGainInertial * (ZMPPosition - desiredZMPPosition);
+
+    return true;
+}
+
+bool CoMZMPController::computeBatch(Eigen::Ref<const Eigen::Matrix2Xd> desiredCoMVelocity,
+                                    Eigen::Ref<const Eigen::Matrix2Xd> desiredCoMPosition,
+                                    Eigen::Ref<const Eigen::Matrix2Xd> desiredZMPPosition,
+                                    Eigen::Ref<const Eigen::Matrix2Xd> CoMPosition,
+                                    Eigen::Ref<const Eigen::Matrix2Xd> ZMPPosition,
+                                    Eigen::Ref<const Eigen::VectorXd> angle,
+                                    Eigen::Ref<Eigen::Matrix2Xd> output)
+{
+    constexpr auto logPrefix = "[CoMZMPController::computeBatch]";
+
+    if (!m_isInitalized)
+    {
+        log()->error("{} The controller is not initialized. Please call the 'initialize()' "
+                     "method",
+                     logPrefix);
+        return false;
+    }
+
+    const Eigen::Index samples = output.cols();
+    if (desiredCoMVelocity.cols() != samples || desiredCoMPosition.cols() != samples
+        || desiredZMPPosition.cols() != samples || CoMPosition.cols() != samples
+        || ZMPPosition.cols() != samples || angle.size() != samples)
+    {
+        log()->error("{} All the matrices must have the same number of columns.", logPrefix);
+        return false;
+    }
+
+    const Eigen::ArrayXd cos = angle.array().cos();
+    const Eigen::ArrayXd sin = angle.array().sin();
+
+    // rotate an error in the body frame, apply the diagonal gain and rotate the result back in
+    // the inertial frame. All the operations act on the rows of the error matrix, so the batch is
+    // evaluated without looping over the columns.
+    auto applyGain = [&cos, &sin](const Eigen::Vector2d& gain,
+                                  const Eigen::Matrix2Xd& error) -> Eigen::Matrix2Xd {
+        // B_e = I_R_B^T * I_e
+        const Eigen::ArrayXd errorBodyX = cos * error.row(0).transpose().array()
+                                          + sin * error.row(1).transpose().array();
+        const Eigen::ArrayXd errorBodyY = -sin * error.row(0).transpose().array()
+                                          + cos * error.row(1).transpose().array();
+
+        // I_u = I_R_B * K * B_e
+        Eigen::Matrix2Xd out(2, error.cols());
+        out.row(0) = (cos * gain(0) * errorBodyX - sin * gain(1) * errorBodyY).transpose();
+        out.row(1) = (sin * gain(0) * errorBodyX + cos * gain(1) * errorBodyY).transpose();
+        return out;
+    };
+
+    const PhaseGains& gains = m_gainTable[m_activePhase];
+
+    // feed forward
+    output = desiredCoMVelocity;
+
+    // CoM Controller
+    output += applyGain(gains.CoMGain, desiredCoMPosition - CoMPosition);
+
+    // ZMP Controller
+    output += applyGain(gains.ZMPGain, ZMPPosition - desiredZMPPosition);
+
+    return true;
+}
+
 bool CoMZMPController::setInput(const Input& input)
 {
     this->setFeedback(input.CoMPosition, input.ZMPPosition, input.angle);
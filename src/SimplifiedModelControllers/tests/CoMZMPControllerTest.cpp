@@ -64,3 +64,141 @@ TEST_CASE("Controller")
 
     expectedOutput.isApprox(controller.getOutput());
 }
+
+TEST_CASE("Controller - gain schedule")
+{
+    std::array<double, 2> k_zmp{3, 4};
+    std::array<double, 2> k_com{1, 2};
+    std::array<double, 2> k_zmp_ss{5, 6};
+    std::array<double, 2> k_com_ss{7, 8};
+
+    CoMZMPController::Input input;
+    input.desiredCoMVelocity.setZero();
+    input.desiredCoMPosition << 0.01, 0;
+    input.desiredZMPPosition << 0.01, 0;
+    input.CoMPosition << -0.02, 0.03;
+    input.ZMPPosition << 0.04, -0.01;
+    input.angle = 0;
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("zmp_gain", k_zmp);
+    handler->setParameter("com_gain", k_com);
+    handler->setParameter("single_support_zmp_gain", k_zmp_ss);
+    handler->setParameter("single_support_com_gain", k_com_ss);
+
+    CoMZMPController controller;
+    REQUIRE(controller.initialize(handler));
+
+    // swapping to the active phase must not change the generation
+    const auto generation = controller.gainGeneration();
+    controller.setSupportPhase(CoMZMPController::SupportPhase::DoubleSupport);
+    REQUIRE(controller.gainGeneration() == generation);
+
+    controller.setSupportPhase(CoMZMPController::SupportPhase::SingleSupport);
+    REQUIRE(controller.gainGeneration() == generation + 1);
+
+    controller.setInput(input);
+    REQUIRE(controller.advance());
+
+    Eigen::Vector2d expectedOutput = input.desiredCoMVelocity;
+    expectedOutput.noalias()
+        += toEigen(k_com_ss).asDiagonal() * (input.desiredCoMPosition - input.CoMPosition);
+    expectedOutput.noalias()
+        += toEigen(k_zmp_ss).asDiagonal() * (input.ZMPPosition - input.desiredZMPPosition);
+
+    REQUIRE(expectedOutput.isApprox(controller.getOutput()));
+
+    // providing only one of the two single support gains is an error
+    auto invalidHandler = std::make_shared<StdImplementation>();
+    invalidHandler->setParameter("zmp_gain", k_zmp);
+    invalidHandler->setParameter("com_gain", k_com);
+    invalidHandler->setParameter("single_support_com_gain", k_com_ss);
+
+    CoMZMPController invalidController;
+    REQUIRE_FALSE(invalidController.initialize(invalidHandler));
+}
+
+TEST_CASE("Controller - batched evaluation")
+{
+    std::array<double, 2> k_zmp{3, 4};
+    std::array<double, 2> k_com{1, 2};
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("zmp_gain", k_zmp);
+    handler->setParameter("com_gain", k_com);
+
+    CoMZMPController controller;
+    REQUIRE(controller.initialize(handler));
+
+    constexpr int samples = 50;
+    const Eigen::Matrix2Xd desiredCoMVelocity = Eigen::Matrix2Xd::Random(2, samples);
+    const Eigen::Matrix2Xd desiredCoMPosition = Eigen::Matrix2Xd::Random(2, samples);
+    const Eigen::Matrix2Xd desiredZMPPosition = Eigen::Matrix2Xd::Random(2, samples);
+    const Eigen::Matrix2Xd CoMPosition = Eigen::Matrix2Xd::Random(2, samples);
+    const Eigen::Matrix2Xd ZMPPosition = Eigen::Matrix2Xd::Random(2, samples);
+    const Eigen::VectorXd angle = Eigen::VectorXd::Random(samples);
+
+    // evaluate the same control law sample by sample with the scalar path
+    auto scalarOutput = [&](const int i, const double sampleAngle) -> Eigen::Vector2d {
+        CoMZMPController::Input input;
+        input.desiredCoMVelocity = desiredCoMVelocity.col(i);
+        input.desiredCoMPosition = desiredCoMPosition.col(i);
+        input.desiredZMPPosition = desiredZMPPosition.col(i);
+        input.CoMPosition = CoMPosition.col(i);
+        input.ZMPPosition = ZMPPosition.col(i);
+        input.angle = sampleAngle;
+
+        REQUIRE(controller.setInput(input));
+        REQUIRE(controller.advance());
+        return controller.getOutput();
+    };
+
+    constexpr double tolerance = 1e-10;
+
+    SECTION("Shared yaw angle")
+    {
+        constexpr double sharedAngle = 0.3;
+        Eigen::Matrix2Xd output(2, samples);
+        REQUIRE(controller.computeBatch(desiredCoMVelocity,
+                                        desiredCoMPosition,
+                                        desiredZMPPosition,
+                                        CoMPosition,
+                                        ZMPPosition,
+                                        sharedAngle,
+                                        output));
+
+        for (int i = 0; i < samples; i++)
+        {
+            REQUIRE(output.col(i).isApprox(scalarOutput(i, sharedAngle), tolerance));
+        }
+    }
+
+    SECTION("Per-sample yaw angle")
+    {
+        Eigen::Matrix2Xd output(2, samples);
+        REQUIRE(controller.computeBatch(desiredCoMVelocity,
+                                        desiredCoMPosition,
+                                        desiredZMPPosition,
+                                        CoMPosition,
+                                        ZMPPosition,
+                                        angle,
+                                        output));
+
+        for (int i = 0; i < samples; i++)
+        {
+            REQUIRE(output.col(i).isApprox(scalarOutput(i, angle(i)), tolerance));
+        }
+    }
+
+    SECTION("Size mismatch")
+    {
+        Eigen::Matrix2Xd output(2, samples - 1);
+        REQUIRE_FALSE(controller.computeBatch(desiredCoMVelocity,
+                                              desiredCoMPosition,
+                                              desiredZMPPosition,
+                                              CoMPosition,
+                                              ZMPPosition,
+                                              angle,
+                                              output));
+    }
+}
@@ -13,6 +13,7 @@
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 #include <BipedalLocomotion/System/InputPort.h>
 #include <BipedalLocomotion/System/OutputPort.h>
+#include <BipedalLocomotion/System/TimeProfiler.h>
 
 namespace BipedalLocomotion
 {
@@ -66,6 +67,26 @@ public:
      * @return True if the close is successfull.
      */
     virtual bool close();
+
+    /**
+     * @brief Get the profiler associated to the advanceable.
+     * The profiler contains the timing of the internal phases of advance() (e.g. "task-update" or
+     * "qp-solve" for the QP based solvers). The sections are populated only if the framework is
+     * compiled with the FRAMEWORK_ENABLE_PROFILER option, otherwise the profiler is empty.
+     * @return a const reference to the profiler.
+     */
+    const TimeProfiler& timeProfiler() const;
+
+protected:
+    /**
+     * @brief Get the profiler associated to the advanceable. The concrete classes should register
+     * their sections at configuration time and time them with the BLF_SCOPED_PROFILER macro.
+     * @return a reference to the profiler.
+     */
+    TimeProfiler& timeProfiler();
+
+private:
+    TimeProfiler m_profiler; /**< Profiler measuring the internal phases of advance(). */
 };
 
 namespace BipedalLocomotion
@@ -85,6 +106,17 @@ bool Advanceable<_Input, _Output>::initialize(
     return true;
 }
 
+template <class _Input, class _Output>
+const TimeProfiler& Advanceable<_Input, _Output>::timeProfiler() const
+{
+    return m_profiler;
+}
+
+template <class _Input, class _Output> TimeProfiler& Advanceable<_Input, _Output>::timeProfiler()
+{
+    return m_profiler;
+}
+
 } // namespace System
 } // namespace BipedalLocomotion
 
@@ -0,0 +1,426 @@
+/**
+ * @file AdvanceableExecutor.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_ADVANCEABLE_EXECUTOR_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_ADVANCEABLE_EXECUTOR_H
+
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/System/AdvanceableRunner.h>
+#include <BipedalLocomotion/System/Barrier.h>
+#include <BipedalLocomotion/System/Clock.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * AdvanceableExecutor schedules a set of AdvanceableRunner as periodic tasks on a fixed pool of
+ * worker threads. It is an alternative to spawning one dedicated thread per runner with
+ * AdvanceableRunner::run(): when a process hosts more runners than physical cores and several of
+ * them idle most of their period (e.g. logging adapters or low-rate planners), a pool sized to
+ * the number of cores avoids the oversubscription and the related context-switch overhead.
+ * The tasks live in a shared queue ordered by deadline and any idle worker picks the next ready
+ * task, so a low-rate runner does not hold a core while idling.
+ * @note The runners added to the executor must outlive it. Each runner is executed by one worker
+ * at a time, however subsequent iterations of the same runner may run on different workers: the
+ * advanceables must not rely on thread-local state.
+ */
+class AdvanceableExecutor
+{
+public:
+    /**
+     * Information associated to a task scheduled by the executor.
+     */
+    struct TaskInfo
+    {
+        std::string name{}; /**< Name associated to the runner */
+        unsigned int deadlineMiss{0}; /**< Number of deadline miss */
+    };
+
+    AdvanceableExecutor() = default;
+
+    ~AdvanceableExecutor()
+    {
+        this->stop();
+    }
+
+    AdvanceableExecutor(const AdvanceableExecutor&) = delete;
+    AdvanceableExecutor& operator=(const AdvanceableExecutor&) = delete;
+
+    // clang-format off
+    /**
+     * Initialize the AdvanceableExecutor class
+     * @param handler pointer to a parameter handler
+     * @note The following parameters are required
+     * |   Parameter Name    |  Type |                                               Description                                                | Mandatory |
+     * |:-------------------:|:-----:|:--------------------------------------------------------------------------------------------------------:|:---------:|
+     * | `number_of_workers` | `int` | Number of worker threads of the pool. If not set the hardware concurrency of the machine is used. |     No    |
+     * @return true in case of success, false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
+    // clang-format on
+
+    /**
+     * Add a runner to the executor. The runner is scheduled as a periodic task with the period set
+     * by its `sampling_time` parameter.
+     * @param runner a valid AdvanceableRunner. The runner must outlive the executor.
+     * @return true in case of success, false otherwise.
+     */
+    template <class _Advanceable> bool addRunner(AdvanceableRunner<_Advanceable>& runner);
+
+    /**
+     * Run the executor. The function spawns the worker pool and schedules all the added runners.
+     * @param barrier is an optional parameter that can be used to synchronize the startup of the
+     * executor with other AdvanceableRunner (or AdvanceableExecutor) spawned by the process. The
+     * barrier is waited once by one of the workers before the first task is stepped, so a single
+     * thread can start several synchronized executors and runners sequentially.
+     * @return true in case of success, false otherwise.
+     */
+    bool run(std::optional<std::reference_wrapper<Barrier>> barrier = {});
+
+    /**
+     * Stop the executor. The function joins the workers and closes all the advanceables contained
+     * in the scheduled runners.
+     */
+    void stop();
+
+    /**
+     * Check if the AdvanceableExecutor is running
+     * @return true if the workers are running, false otherwise.
+     */
+    bool isRunning() const;
+
+    /**
+     * Get some info of the tasks scheduled by the executor.
+     * @return A copy of the TaskInfo structs, one for each added runner.
+     */
+    std::vector<TaskInfo> getInfo();
+
+private:
+    /**
+     * Periodic task scheduled on the worker pool.
+     */
+    struct Task
+    {
+        std::function<bool()> step; /**< One iteration of the runner */
+        std::function<bool()> close; /**< Close the advanceable contained in the runner */
+        std::chrono::nanoseconds period{std::chrono::nanoseconds::zero()}; /**< Period */
+        std::chrono::nanoseconds wakeUpTime{std::chrono::nanoseconds::zero()}; /**< Next deadline */
+        std::size_t infoIndex{0}; /**< Index of the associated TaskInfo */
+    };
+
+    /**
+     * Comparator used to order the ready queue by the closest deadline.
+     */
+    struct TaskComparator
+    {
+        bool operator()(const std::shared_ptr<Task>& a, const std::shared_ptr<Task>& b) const
+        {
+            return a->wakeUpTime > b->wakeUpTime;
+        }
+    };
+
+    /**
+     * Main function of the workers. Each worker picks the task with the closest deadline, sleeps
+     * until the deadline and runs one iteration of the associated runner.
+     */
+    void workerLoop();
+
+    bool m_isInitialized{false}; /**< True if the executor is initialized */
+    std::size_t m_numberOfWorkers{0}; /**< Number of workers of the pool */
+    std::atomic<bool> m_isRunning{false}; /**< If True the executor is running */
+
+    std::optional<std::reference_wrapper<Barrier>> m_startupBarrier; /**< Optional barrier waited
+                                                                          by one of the workers
+                                                                          before the first task is
+                                                                          stepped */
+    bool m_startupDone{false}; /**< True once a worker has performed the startup, i.e., waited on
+                                    the optional barrier and scheduled the tasks. Protected by
+                                    m_mutex */
+
+    std::vector<std::shared_ptr<Task>> m_tasks; /**< Tasks added to the executor */
+    std::priority_queue<std::shared_ptr<Task>, std::vector<std::shared_ptr<Task>>, TaskComparator>
+        m_readyQueue; /**< Queue of the scheduled tasks ordered by the closest deadline */
+    std::mutex m_mutex; /**< Mutex used to protect the ready queue */
+    std::condition_variable m_condition; /**< Condition variable associated to the ready queue */
+    std::vector<std::thread> m_workers; /**< Worker threads */
+
+    std::mutex m_infoMutex; /**< Mutex used to protect the information structs */
+    std::vector<TaskInfo> m_info; /**< Information structs, one for each added runner */
+};
+
+inline bool AdvanceableExecutor::initialize(
+    std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto errorPrefix = "[AdvanceableExecutor::initialize]";
+
+    if (m_isInitialized)
+    {
+        log()->error("{} AdvanceableExecutor is already initialized.", errorPrefix);
+        return false;
+    }
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} The parameters handler is not valid.", errorPrefix);
+        return false;
+    }
+
+    int numberOfWorkers = static_cast<int>(std::thread::hardware_concurrency());
+    if (!ptr->getParameter("number_of_workers", numberOfWorkers))
+    {
+        log()->info("{} number_of_workers parameter not found. The following parameter will be "
+                    "used: {}.",
+                    errorPrefix,
+                    numberOfWorkers);
+    }
+
+    if (numberOfWorkers <= 0)
+    {
+        log()->error("{} The number of workers must be a positive number.", errorPrefix);
+        return false;
+    }
+
+    m_numberOfWorkers = static_cast<std::size_t>(numberOfWorkers);
+    m_isInitialized = true;
+    return true;
+}
+
+template <class _Advanceable>
+bool AdvanceableExecutor::addRunner(AdvanceableRunner<_Advanceable>& runner)
+{
+    constexpr auto logPrefix = "[AdvanceableExecutor::addRunner]";
+
+    if (!m_isInitialized)
+    {
+        log()->error("{} AdvanceableExecutor is not initialized.", logPrefix);
+        return false;
+    }
+
+    if (m_isRunning)
+    {
+        log()->error("{} It is not possible to add a runner while the executor is running.",
+                     logPrefix);
+        return false;
+    }
+
+    if (!runner.isValid())
+    {
+        log()->error("{} The runner is not valid. Please initialize it and set the advanceable "
+                     "and the shared resources.",
+                     logPrefix);
+        return false;
+    }
+
+    auto task = std::make_shared<Task>();
+    task->step = [&runner]() -> bool { return runner.step(); };
+    task->close = [&runner]() -> bool { return runner.close(); };
+    task->period = runner.getPeriod();
+    task->infoIndex = m_info.size();
+
+    m_info.push_back({runner.getInfo().name, 0});
+    m_tasks.push_back(std::move(task));
+
+    return true;
+}
+
+inline bool AdvanceableExecutor::run(std::optional<std::reference_wrapper<Barrier>> barrier)
+{
+    constexpr auto logPrefix = "[AdvanceableExecutor::run]";
+
+    if (!m_isInitialized)
+    {
+        log()->error("{} AdvanceableExecutor is not initialized.", logPrefix);
+        return false;
+    }
+
+    if (m_isRunning)
+    {
+        log()->error("{} The executor is already running.", logPrefix);
+        return false;
+    }
+
+    if (m_tasks.empty())
+    {
+        log()->error("{} No runner has been added to the executor.", logPrefix);
+        return false;
+    }
+
+    m_isRunning = true;
+
+    // the optional barrier is waited by one of the workers (see workerLoop), so the calling
+    // thread is free to start other synchronized executors and runners
+    m_startupBarrier = barrier;
+    m_startupDone = false;
+
+    for (std::size_t i = 0; i < m_numberOfWorkers; i++)
+    {
+        m_workers.emplace_back([this]() { this->workerLoop(); });
+    }
+
+    return true;
+}
+
+inline void AdvanceableExecutor::workerLoop()
+{
+    constexpr auto logPrefix = "[AdvanceableExecutor::workerLoop]";
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // the first worker performs the startup: it waits on the optional barrier and schedules all
+    // the tasks. The other workers block on the condition variable until the queue is filled
+    if (!m_startupDone)
+    {
+        m_startupDone = true;
+        lock.unlock();
+
+        if (m_startupBarrier.has_value())
+        {
+            log()->debug("{} The executor is waiting for the other threads.", logPrefix);
+
+            // the wait is periodically interrupted so that stop() is honored even if the other
+            // participants never reach the barrier
+            while (m_isRunning
+                   && !m_startupBarrier.value().get().waitFor(std::chrono::milliseconds(100)))
+            {
+            }
+        }
+
+        // schedule all the tasks starting from the current time
+        const auto time = BipedalLocomotion::clock().now();
+        lock.lock();
+        for (auto& task : m_tasks)
+        {
+            task->wakeUpTime = time + task->period;
+            m_readyQueue.push(task);
+        }
+        m_condition.notify_all();
+    }
+
+    while (m_isRunning)
+    {
+        if (m_readyQueue.empty())
+        {
+            m_condition.wait(lock, [this]() { return !m_isRunning || !m_readyQueue.empty(); });
+            continue;
+        }
+
+        const auto time = BipedalLocomotion::clock().now();
+        if (m_readyQueue.top()->wakeUpTime > time)
+        {
+            // wait until the closest deadline. The wait is interrupted if an earlier task is
+            // pushed in the queue or the executor is stopped
+            m_condition.wait_for(lock, m_readyQueue.top()->wakeUpTime - time);
+            continue;
+        }
+
+        auto task = m_readyQueue.top();
+        m_readyQueue.pop();
+
+        // advance the deadline before running the task, as done by AdvanceableRunner::run()
+        task->wakeUpTime += task->period;
+
+        lock.unlock();
+
+        const bool stepOk = task->step();
+
+        // check if the deadline is missed
+        if (task->wakeUpTime < BipedalLocomotion::clock().now())
+        {
+            std::lock_guard<std::mutex> guard(m_infoMutex);
+            m_info[task->infoIndex].deadlineMiss++;
+        }
+
+        lock.lock();
+
+        if (!stepOk)
+        {
+            // the error has been already printed by the step function. Here we stop the executor
+            log()->error("{} Unable to step the task named '{}'. The executor will be stopped.",
+                         logPrefix,
+                         m_info[task->infoIndex].name);
+            m_isRunning = false;
+            m_condition.notify_all();
+            continue;
+        }
+
+        m_readyQueue.push(std::move(task));
+        m_condition.notify_one();
+    }
+}
+
+inline void AdvanceableExecutor::stop()
+{
+    constexpr auto logPrefix = "[AdvanceableExecutor::stop]";
+
+    // m_isRunning is an atomic<bool> the mutex is not required here
+    m_isRunning = false;
+    m_condition.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+
+    // empty the ready queue
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        while (!m_readyQueue.empty())
+        {
+            m_readyQueue.pop();
+        }
+    }
+
+    // close all the advanceables contained in the scheduled runners
+    for (const auto& task : m_tasks)
+    {
+        if (task->close != nullptr && !task->close())
+        {
+            std::lock_guard<std::mutex> guard(m_infoMutex);
+            log()->error("{} Unable to close the task named '{}'.",
+                         logPrefix,
+                         m_info[task->infoIndex].name);
+        }
+    }
+    m_tasks.clear();
+}
+
+inline bool AdvanceableExecutor::isRunning() const
+{
+    // m_isRunning is an atomic<bool> the mutex is not required here
+    return m_isRunning;
+}
+
+inline std::vector<AdvanceableExecutor::TaskInfo> AdvanceableExecutor::getInfo()
+{
+    std::lock_guard<std::mutex> guard(m_infoMutex);
+    return m_info;
+}
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_ADVANCEABLE_EXECUTOR_H
@@ -14,13 +14,16 @@
 #include <BipedalLocomotion/System/Barrier.h>
 #include <BipedalLocomotion/System/Clock.h>
 #include <BipedalLocomotion/System/SharedResource.h>
+#include <BipedalLocomotion/System/ThreadUtilities.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace BipedalLocomotion
 {
@@ -53,6 +56,14 @@ private:
     std::chrono::nanoseconds m_dT{std::chrono::nanoseconds::zero()}; /**< Period of the runner */
     std::atomic<bool> m_isRunning{false}; /**> If True the runner is running */
     int m_maximumNumberOfAcceptedDeadlineMiss{-1}; /**< Maximum number of accepted deadline miss */
+    int m_threadPriority{-1}; /**< SCHED_FIFO priority of the thread. If negative the scheduling
+                                 policy is not changed */
+    std::vector<int> m_threadAffinity; /**< CPUs the thread is pinned to. If empty the affinity is
+                                          not changed */
+    bool m_isEventDriven{false}; /**< If true the runner blocks on the input shared resource
+                                    instead of waking up periodically */
+    std::chrono::nanoseconds m_maximumLatency{std::chrono::nanoseconds::zero()}; /**< Upper bound
+                                    of the waiting time of the event-driven mode */
 
     std::unique_ptr<_Advanceable> m_advanceable; /**< Advanceable contained in the runner */
     typename SharedResource<Input>::Ptr m_input; /**< Input shared resource */
@@ -77,6 +88,15 @@ public:
      * |:------------------------------------------:|:--------:|:---------------------------------------------------------------------------------------------:|:---------:|
      * |               `sampling_time`              | `double` |            Strictly positive number representing the sampling time in seconds                 |    Yes    |
      * | `maximum_number_of_accepted_deadline_miss` |  `int`   | Number of accepted deadline miss. if negative the check is not considered. Default value `-1` |     No    |
+     * |             `thread_priority`              |  `int`   |  SCHED_FIFO priority of the spawned thread. If negative the scheduling policy is not changed. Default value `-1` |     No    |
+     * |             `thread_affinity`              | `vector<int>` |        Indices of the CPUs the spawned thread is pinned to. If empty the affinity is not changed. Default value `[]`        |     No    |
+     * |         `enable_event_driven_mode`         |  `bool`  | If true the thread spawned by AdvanceableRunner::run() blocks on the input shared resource and advances the advanceable when new data is published, instead of waking up every `sampling_time`. This cuts the idle wakeups of consumers running slower than their producer. Default value `false` |     No    |
+     * |             `maximum_latency`              | `double` | Upper bound of the waiting time of the event-driven mode in seconds. The advanceable is stepped at least once every `maximum_latency` even if the producer is silent, and stop() is honored within the same bound. If not provided `sampling_time` is used. It must be strictly positive |     No    |
+     * @note The thread spawned by AdvanceableRunner::run() is named after the `name` parameter and
+     * configured accordingly to `thread_priority` and `thread_affinity`. A failure in applying the
+     * requested configuration (e.g. missing permissions) is not fatal: a warning is printed and
+     * the thread keeps running with the default settings. The number of experienced deadline
+     * misses can be retrieved at runtime with AdvanceableRunner::getInfo().
      * @return true in case of success, false otherwise.
      */
     bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
@@ -109,11 +129,41 @@ public:
      */
     Info getInfo();
 
+    /**
+     * Check if the runner is ready to run, i.e. it has been initialized and the advanceable and
+     * the shared resources have been set.
+     * @return true if the runner is valid, false otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * Perform one iteration of the runner: read the input resource, advance the advanceable and
+     * publish the output resource. This function is used by AdvanceableExecutor to schedule the
+     * runner on a worker pool instead of a dedicated thread spawned by AdvanceableRunner::run().
+     * @return true in case of success, false otherwise.
+     */
+    bool step();
+
+    /**
+     * Close the advanceable contained in the runner. It must be called once the runner is not
+     * stepped anymore. AdvanceableRunner::run() calls it automatically when the thread terminates.
+     * @return true in case of success, false otherwise.
+     */
+    bool close();
+
+    /**
+     * Get the period of the runner.
+     * @return the period set with the `sampling_time` parameter.
+     */
+    const std::chrono::nanoseconds& getPeriod() const;
+
     /**
      * Run the advanceable runner. The function create a periodic thread running with a period of
      * m_dT seconds.
      * @param barrier is an optional parameter that can be used to synchronize the startup of all
-     * the AdvanceableRunner spawned by the process.
+     * the AdvanceableRunner spawned by the process. The wait is performed by the spawned thread
+     * before the first advance(), so a single thread can start several synchronized runners
+     * sequentially.
      * @return a thread of containing the running process. If the runner was not correctly
      * initialized the thread is invalid.
      */
@@ -174,6 +224,45 @@ bool AdvanceableRunner<_Advanceable>::initialize(
                     m_maximumNumberOfAcceptedDeadlineMiss);
     }
 
+    if (!ptr->getParameter("thread_priority", m_threadPriority))
+    {
+        log()->info("{} thread_priority parameter not found. The scheduling policy of the thread "
+                    "will not be changed.",
+                    errorPrefix);
+    }
+
+    if (!ptr->getParameter("thread_affinity", m_threadAffinity))
+    {
+        log()->info("{} thread_affinity parameter not found. The affinity of the thread will not "
+                    "be changed.",
+                    errorPrefix);
+    }
+
+    if (!ptr->getParameter("enable_event_driven_mode", m_isEventDriven))
+    {
+        log()->info("{} enable_event_driven_mode parameter not found. The runner will wake up "
+                    "periodically.",
+                    errorPrefix);
+    }
+
+    if (m_isEventDriven)
+    {
+        m_maximumLatency = m_dT;
+        if (!ptr->getParameter("maximum_latency", m_maximumLatency))
+        {
+            log()->info("{} maximum_latency parameter not found. The sampling time will be used: "
+                        "{}.",
+                        errorPrefix,
+                        m_maximumLatency);
+        }
+
+        if (m_maximumLatency <= std::chrono::nanoseconds::zero())
+        {
+            log()->error("{} The maximum latency must be strictly positive.", errorPrefix);
+            return false;
+        }
+    }
+
     m_isInitialized = true;
     return true;
 }
@@ -226,6 +315,53 @@ bool AdvanceableRunner<_Advanceable>::setOutputResource(
     return true;
 }
 
+template <class _Advanceable> bool AdvanceableRunner<_Advanceable>::isValid() const
+{
+    return m_isInitialized && m_advanceable != nullptr && m_input != nullptr
+           && m_output != nullptr;
+}
+
+template <class _Advanceable> bool AdvanceableRunner<_Advanceable>::step()
+{
+    constexpr auto logPrefix = "[AdvanceableRunner::step]";
+    assert(this->isValid() && "[AdvanceableRunner::step] The runner is not valid.");
+
+    if (!m_advanceable->setInput(m_input->get()))
+    {
+        log()->error("{} - {} Unable to set the input to the advanceable.", logPrefix, m_info.name);
+        return false;
+    }
+
+    if (!m_advanceable->advance())
+    {
+        log()->error("{} - {} Unable to advance the advanceable.", logPrefix, m_info.name);
+        return false;
+    }
+    assert(m_advanceable->isOutputValid());
+
+    m_output->set(m_advanceable->getOutput());
+    return true;
+}
+
+template <class _Advanceable> bool AdvanceableRunner<_Advanceable>::close()
+{
+    constexpr auto logPrefix = "[AdvanceableRunner::close]";
+
+    if (m_advanceable == nullptr)
+    {
+        log()->error("{} - {} The advanceable is not valid.", logPrefix, m_info.name);
+        return false;
+    }
+
+    return m_advanceable->close();
+}
+
+template <class _Advanceable>
+const std::chrono::nanoseconds& AdvanceableRunner<_Advanceable>::getPeriod() const
+{
+    return m_dT;
+}
+
 template <class _Advanceable>
 std::thread
 AdvanceableRunner<_Advanceable>::run(std::optional<std::reference_wrapper<Barrier>> barrier)
@@ -273,26 +409,75 @@ AdvanceableRunner<_Advanceable>::run(std::optional<std::reference_wrapper<Barrie
 
     // run the thread
     m_isRunning = true;
-    auto function = [&]() -> bool {
+    auto function = [this, barrier]() -> bool {
         constexpr auto logPrefix = "[AdvanceableRunner::run]";
-        auto time = BipedalLocomotion::clock().now();
+
+        // configure the thread. A failure is not fatal: the runner keeps working with the default
+        // settings
+        if (!setNameOfCallingThread(m_info.name))
+        {
+            log()->warn("{} - {} Unable to set the name of the thread.", logPrefix, m_info.name);
+        }
+
+        if (m_threadPriority >= 0 && !setRealTimePriorityOfCallingThread(m_threadPriority))
+        {
+            log()->warn("{} - {} Unable to set the SCHED_FIFO priority to {}. Please check the "
+                        "permissions of the user (e.g. the rtprio limit).",
+                        logPrefix,
+                        m_info.name,
+                        m_threadPriority);
+        }
+
+        if (!m_threadAffinity.empty() && !setAffinityOfCallingThread(m_threadAffinity))
+        {
+            log()->warn("{} - {} Unable to set the affinity of the thread.",
+                        logPrefix,
+                        m_info.name);
+        }
+
+        // if a barrier is passed, the runner thread waits for the other participants before the
+        // first advance(). Waiting here (and not on the thread calling run()) allows a single
+        // thread to start several synchronized runners sequentially
+        if (barrier.has_value())
+        {
+            log()->debug("{} - {} This thread is waiting for the other threads.",
+                         logPrefix,
+                         m_info.name);
+            barrier.value().get().wait();
+        }
+
+        auto time = BipedalLocomotion::clockNow();
         auto oldTime = time;
         auto wakeUpTime = time;
+        std::uint64_t inputGeneration = this->m_input->generation();
 
         // the main periodic function
         while (this->m_isRunning)
         {
-            // detect if a clock has been reset
-            oldTime = time;
-            time = BipedalLocomotion::clock().now();
-            // if the current time is lower than old time, the timer has been reset.
-            if ((time - oldTime).count() < 1e-12)
+            if (!m_isEventDriven)
             {
-                wakeUpTime = time;
-            }
+                // detect if a clock has been reset
+                oldTime = time;
+                time = BipedalLocomotion::clockNow();
+                // if the current time is lower than old time, the timer has been reset.
+                if ((time - oldTime).count() < 1e-12)
+                {
+                    wakeUpTime = time;
+                }
 
-            // advance the wake-up time
-            wakeUpTime += m_dT;
+                // advance the wake-up time
+                wakeUpTime += m_dT;
+            } else
+            {
+                // block until the producer publishes new data or the latency bound expires. The
+                // advanceable is stepped in both cases, so the output is refreshed at least once
+                // every m_maximumLatency and stop() is honored within the same bound
+                this->m_input->waitForNewData(inputGeneration, m_maximumLatency);
+                if (!this->m_isRunning)
+                {
+                    break;
+                }
+            }
 
             if (!this->m_advanceable->setInput(this->m_input->get()))
             {
@@ -315,8 +500,15 @@ AdvanceableRunner<_Advanceable>::run(std::optional<std::reference_wrapper<Barrie
             // set the output
             this->m_output->set(this->m_advanceable->getOutput());
 
+            // in the event-driven mode there is no fixed deadline: the next iteration starts by
+            // blocking on the input again
+            if (m_isEventDriven)
+            {
+                continue;
+            }
+
             // check if the deadline is missed
-            if (wakeUpTime < BipedalLocomotion::clock().now())
+            if (wakeUpTime < BipedalLocomotion::clockNow())
             {
                 unsigned int deadlineMiss = 0;
 
@@ -363,15 +555,6 @@ AdvanceableRunner<_Advanceable>::run(std::optional<std::reference_wrapper<Barrie
         return this->m_advanceable->close();
     };
 
-    // if the barrier is passed the run method, synchronization is performed
-    if (barrier.has_value())
-    {
-        log()->debug("{} - {} This thread is waiting for the other threads.",
-                     logPrefix,
-                     m_info.name);
-        barrier.value().get().wait();
-    }
-
     return std::thread(function);
 }
 
@@ -8,6 +8,8 @@
 #ifndef BIPEDAL_LOCOMOTION_SYSTEM_BARRIER_H
 #define BIPEDAL_LOCOMOTION_SYSTEM_BARRIER_H
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <mutex>
@@ -18,7 +20,12 @@ namespace System
 {
 /**
  * Barrier provides a thread-coordination mechanism that allows an expected number of threads to
- * block until the expected number of threads arrive at the barrier.
+ * block until the expected number of threads arrive at the barrier. The barrier is cyclic: once a
+ * phase completes, the counter is automatically rearmed, so the same object can be reused to keep
+ * several threads in lockstep tick after tick. A thread reaching the barrier first spins on an
+ * atomic generation counter for a short while before falling back to a condition variable. The
+ * spinning phase keeps the wake-up spread between the released threads small, while the sleeping
+ * fallback avoids burning CPU when the other threads are late.
  */
 class Barrier
 {
@@ -34,12 +41,44 @@ public:
      */
     void wait();
 
+    /**
+     * Blocks this thread at the phase synchronization point until its phase completion step is run
+     * or the timeout expires.
+     * @param timeout maximum time the thread waits for the other threads.
+     * @return true if the phase completed, false if the timeout expired. On timeout the thread
+     * removes itself from the current phase, so the barrier remains usable by the other threads.
+     */
+    bool waitFor(const std::chrono::nanoseconds& timeout);
+
+    /**
+     * Get the wake-up spread measured during the most recent phase completion, i.e., the time
+     * elapsed between the phase completion and the moment the slowest thread left the barrier.
+     * @return the release spread. The value is updated while the threads of the current phase are
+     * still leaving the barrier, so it should be read when no thread is inside the barrier.
+     */
+    std::chrono::nanoseconds releaseSpread() const;
+
 private:
+    /**
+     * Complete the current phase: rearm the counter, advance the generation and wake the sleeping
+     * threads.
+     */
+    void completePhase();
+
+    /**
+     * Record the time at which this thread left the barrier and update the release spread.
+     */
+    void recordRelease();
+
     std::mutex m_mutex;
     std::condition_variable m_cond;
-    std::size_t m_initialCount;
-    std::size_t m_count;
-    std::size_t m_generation;
+    const std::size_t m_initialCount;
+    std::atomic<std::size_t> m_count;
+    std::atomic<std::size_t> m_generation{0};
+    std::atomic<std::chrono::nanoseconds::rep> m_releaseBegin{0}; /**< Time of the last phase
+                                                                     completion (ns) */
+    std::atomic<std::chrono::nanoseconds::rep> m_releaseSpread{0}; /**< Wake-up spread of the last
+                                                                      phase completion (ns) */
 };
 } // namespace System
 } // namespace BipedalLocomotion
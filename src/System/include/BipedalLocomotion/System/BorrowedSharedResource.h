@@ -0,0 +1,220 @@
+/**
+ * @file BorrowedSharedResource.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_BORROWED_SHARED_RESOURCE_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_BORROWED_SHARED_RESOURCE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * BorrowedSharedResource is a zero-copy alternative to SharedResource. SharedResource exchanges
+ * data by value: set() copies the object in and get() copies it out, which for large payloads
+ * (e.g. joint-state vectors plus contact wrench arrays) costs two copies per AdvanceableRunner
+ * hop, thousands of times a second. BorrowedSharedResource removes both copies: the producer
+ * writes in place into a slot taken from an internal pool and publishes it, while the consumers
+ * borrow a const view of the last published slot. A borrowed slot is never recycled by the
+ * producer, so the view stays valid and immutable for as long as the consumer holds it. Each
+ * publication increments a generation counter that the consumers can use to detect new data.
+ *
+ * The intended usage between two advanceables is to exchange the lightweight
+ * BorrowedSharedResource::Borrowed view through the ports (copying a view costs a shared_ptr copy
+ * and an integer), while the heavy payload is written and read in place
+ * \code{.cpp}
+ * auto wire = BipedalLocomotion::System::BorrowedSharedResource<HeavyStruct>::create();
+ *
+ * // producer side
+ * HeavyStruct& slot = wire->prepare();
+ * fill(slot);
+ * wire->publish();
+ *
+ * // consumer side
+ * auto view = wire->borrow();
+ * if (view.isValid() && view.generation() != lastGeneration)
+ * {
+ *     lastGeneration = view.generation();
+ *     consume(view.get());
+ * }
+ * \endcode
+ * @warning prepare() and publish() must be called by a single producer thread. borrow() can be
+ * called by any number of consumer threads.
+ * @note If all the slots of the pool are borrowed when prepare() is called, the pool grows by one
+ * slot. With long-lived consumers the pool settles to the steady-state number of slots after the
+ * first iterations and prepare() does not allocate anymore.
+ */
+template <class T> class BorrowedSharedResource
+{
+public:
+    using Ptr = std::shared_ptr<BorrowedSharedResource<T>>;
+
+    /**
+     * Const view of a published slot. The view keeps the slot alive: the producer does not
+     * recycle a slot while at least one view references it.
+     */
+    class Borrowed
+    {
+    public:
+        Borrowed() = default;
+
+        /**
+         * Access the borrowed object.
+         * @return a const reference to the published slot.
+         * @warning The view must be valid.
+         */
+        const T& get() const
+        {
+            return *m_slot;
+        }
+
+        /**
+         * Get the generation counter associated to the view. The counter increases at every
+         * publication, so it can be used to detect whether new data has been published since the
+         * previous borrow.
+         * @return the generation counter.
+         */
+        std::uint64_t generation() const
+        {
+            return m_generation;
+        }
+
+        /**
+         * Determines the validity of the view.
+         * @return true if the view references a published slot, false otherwise (i.e. nothing has
+         * been published yet).
+         */
+        bool isValid() const
+        {
+            return m_slot != nullptr;
+        }
+
+    private:
+        friend class BorrowedSharedResource<T>;
+
+        Borrowed(std::shared_ptr<const T> slot, std::uint64_t generation)
+            : m_slot(std::move(slot))
+            , m_generation(generation)
+        {
+        }
+
+        std::shared_ptr<const T> m_slot; /**< Published slot */
+        std::uint64_t m_generation{0}; /**< Generation counter at the time of the borrow */
+    };
+
+    /**
+     * Get a writable slot from the pool. The producer fills the slot in place and makes it
+     * visible to the consumers with publish(). Consecutive calls to prepare() without publish()
+     * return the same slot.
+     * @return a reference to the slot.
+     */
+    T& prepare();
+
+    /**
+     * Publish the slot returned by the last call to prepare() and increment the generation
+     * counter.
+     */
+    void publish();
+
+    /**
+     * Borrow a const view of the last published slot without copying the payload.
+     * @return the view. If nothing has been published yet the view is not valid.
+     */
+    Borrowed borrow() const;
+
+    /**
+     * Method used to create a borrowed shared resource.
+     * @param numberOfSlots initial number of slots of the pool.
+     * @return a pointer of a borrowed shared resource.
+     */
+    static Ptr create(std::size_t numberOfSlots = 3);
+
+private:
+    explicit BorrowedSharedResource(std::size_t numberOfSlots);
+
+    std::vector<std::shared_ptr<T>> m_pool; /**< Pool of slots. Accessed by the producer only */
+    std::shared_ptr<T> m_prepared; /**< Slot currently filled by the producer */
+    std::shared_ptr<const T> m_published; /**< Last published slot. Accessed with the
+                                             std::atomic_load/std::atomic_store free functions */
+    std::atomic<std::uint64_t> m_generation{0}; /**< Generation counter */
+};
+
+template <class T>
+BorrowedSharedResource<T>::BorrowedSharedResource(std::size_t numberOfSlots)
+{
+    // at least two slots are required: one published and one being prepared
+    if (numberOfSlots < 2)
+    {
+        numberOfSlots = 2;
+    }
+
+    m_pool.reserve(numberOfSlots);
+    for (std::size_t i = 0; i < numberOfSlots; i++)
+    {
+        m_pool.push_back(std::make_shared<T>());
+    }
+}
+
+template <class T> T& BorrowedSharedResource<T>::prepare()
+{
+    if (m_prepared != nullptr)
+    {
+        return *m_prepared;
+    }
+
+    // a slot is free when only the pool references it, i.e. it is neither published nor borrowed
+    for (const auto& slot : m_pool)
+    {
+        if (slot.use_count() == 1)
+        {
+            m_prepared = slot;
+            return *m_prepared;
+        }
+    }
+
+    // all the slots are borrowed: grow the pool
+    m_pool.push_back(std::make_shared<T>());
+    m_prepared = m_pool.back();
+    return *m_prepared;
+}
+
+template <class T> void BorrowedSharedResource<T>::publish()
+{
+    if (m_prepared == nullptr)
+    {
+        return;
+    }
+
+    std::atomic_store(&m_published, std::shared_ptr<const T>(std::move(m_prepared)));
+    m_generation.fetch_add(1, std::memory_order_release);
+    m_prepared = nullptr;
+}
+
+template <class T>
+typename BorrowedSharedResource<T>::Borrowed BorrowedSharedResource<T>::borrow() const
+{
+    // the generation is loaded before the slot so that the view is never newer than its counter
+    const std::uint64_t generation = m_generation.load(std::memory_order_acquire);
+    return Borrowed(std::atomic_load(&m_published), generation);
+}
+
+template <class T>
+typename BorrowedSharedResource<T>::Ptr BorrowedSharedResource<T>::create(std::size_t numberOfSlots)
+{
+    return std::shared_ptr<BorrowedSharedResource<T>>(new BorrowedSharedResource<T>(numberOfSlots));
+}
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_BORROWED_SHARED_RESOURCE_H
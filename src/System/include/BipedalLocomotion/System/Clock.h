@@ -9,6 +9,8 @@
 #define BIPEDAL_LOCOMOTION_SYSTEM_CLOCK_H
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 
 #include <BipedalLocomotion/System/IClock.h>
@@ -22,6 +24,76 @@ namespace BipedalLocomotion
  */
 System::IClock& clock();
 
+namespace System
+{
+namespace Internal
+{
+/**
+ * Thread-local handle caching the resolution of the clock singleton. Since the clock factory
+ * cannot change after the first call to clock(), the cached handle stays valid for the entire
+ * lifetime of the thread.
+ */
+struct ClockHandle
+{
+    IClock* clock{nullptr}; /**< The clock singleton */
+    bool isStdClock{false}; /**< True if the configured clock is the default StdClock */
+};
+
+/**
+ * Get the clock handle of the calling thread. The first call resolves the singleton through
+ * ClockBuilder, the following ones only read the thread-local cache.
+ */
+inline const ClockHandle& localClockHandle()
+{
+    thread_local const ClockHandle handle = [] {
+        ClockHandle h;
+        h.clock = &::BipedalLocomotion::clock();
+        h.isStdClock = dynamic_cast<StdClock*>(h.clock) != nullptr;
+        return h;
+    }();
+    return handle;
+}
+} // namespace Internal
+} // namespace System
+
+/**
+ * Get the current time of the clock singleton avoiding the virtual dispatch when the configured
+ * clock is the default StdClock. In that case the call inlines to a plain
+ * std::chrono::system_clock read, so it can be used in hot loops (e.g. the timing guards of the
+ * AdvanceableRunner) without paying the ClockBuilder resolution at every tick. If a custom clock
+ * has been configured, the call is equivalent to clock().now().
+ */
+inline std::chrono::nanoseconds clockNow()
+{
+    const auto& handle = System::Internal::localClockHandle();
+    if (handle.isStdClock)
+    {
+        // this must match StdClock::now()
+        return std::chrono::system_clock::now().time_since_epoch();
+    }
+    return handle.clock->now();
+}
+
+/**
+ * Get the current time of the clock singleton as a raw nanosecond counter. This is meant for
+ * instrumentation code that only stores or subtracts timestamps and does not need a
+ * std::chrono::duration in the hot path. The value is the count() of the duration returned by
+ * clockNow(), so differences of two ticks are directly nanoseconds.
+ */
+inline std::int64_t clockNowTicks()
+{
+    const auto& handle = System::Internal::localClockHandle();
+    if (handle.isStdClock)
+    {
+        // the cast is a compile-time ratio conversion (a no-op where the system clock already
+        // ticks in nanoseconds)
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+    return handle.clock->now().count();
+}
+
 namespace System
 {
 
@@ -0,0 +1,157 @@
+/**
+ * @file EigenWorkspace.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_EIGEN_WORKSPACE_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_EIGEN_WORKSPACE_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * EigenWorkspace is an arena-backed pool of dynamic-size Eigen matrices and vectors designed for
+ * the temporaries of an advanceable block. Nearly every Impl struct hand-rolls preallocated Eigen
+ * members to avoid hot-path allocation, and new contributions routinely regress this: the
+ * workspace centralizes the pattern. The arena is reserved once at configuration time; in the hot
+ * path matrix() and vector() check out a chunk of the arena and return an Eigen::Map over it,
+ * without touching the heap. reset(), called at the beginning of every cycle (typically at the top
+ * of advance()), returns all the chunks at once.
+ * \code{.cpp}
+ * // configuration time
+ * m_workspace.reserve(1024);
+ *
+ * // hot path
+ * m_workspace.reset();
+ * auto jacobian = m_workspace.matrix(6, numberOfJoints);
+ * auto residual = m_workspace.vector(numberOfJoints);
+ * \endcode
+ * If a checkout exceeds the capacity, the requested chunk is served from an overflow block (this
+ * allocates, and a warning is printed once); at the next reset() the arena grows to the peak
+ * requirement, so the steady state does not allocate even when the initial reservation was too
+ * small.
+ * @note The workspace is not thread-safe and the returned maps are invalidated by reset() and by
+ * the destruction of the workspace.
+ */
+class EigenWorkspace
+{
+public:
+    /**
+     * Reserve the arena.
+     * @param capacity number of doubles that can be checked out between two calls to reset().
+     * @return true in case of success, false if the workspace has outstanding checkouts.
+     */
+    bool reserve(std::size_t capacity);
+
+    /**
+     * Check out a dynamic-size matrix from the arena.
+     * @param rows number of rows.
+     * @param cols number of columns.
+     * @return an Eigen::Map over the checked out chunk. The content is not initialized.
+     */
+    Eigen::Map<Eigen::MatrixXd> matrix(Eigen::Index rows, Eigen::Index cols);
+
+    /**
+     * Check out a dynamic-size vector from the arena.
+     * @param size number of elements.
+     * @return an Eigen::Map over the checked out chunk. The content is not initialized.
+     */
+    Eigen::Map<Eigen::VectorXd> vector(Eigen::Index size);
+
+    /**
+     * Return all the checked out chunks to the arena, invalidating the maps returned by matrix()
+     * and vector(). If an overflow occurred since the last reset, the arena grows to the peak
+     * requirement.
+     */
+    void reset();
+
+    /**
+     * Get the capacity of the arena.
+     * @return the number of doubles that can be checked out between two calls to reset().
+     */
+    std::size_t capacity() const;
+
+    /**
+     * Get the number of doubles currently checked out.
+     * @return the number of checked out doubles.
+     */
+    std::size_t used() const;
+
+private:
+    /**
+     * Check out a chunk of the given size.
+     * @param size number of doubles.
+     * @return a pointer to the chunk.
+     */
+    double* checkout(std::size_t size);
+
+    std::vector<double> m_arena; /**< Preallocated arena */
+    std::size_t m_used{0}; /**< Number of doubles checked out from the arena */
+    std::vector<std::unique_ptr<double[]>> m_overflow; /**< Blocks allocated when the arena is
+                                                          exhausted. They are released at the next
+                                                          reset() */
+    std::size_t m_overflowSize{0}; /**< Number of doubles checked out from the overflow blocks */
+    bool m_overflowWarningPrinted{false}; /**< True if the overflow warning has been already
+                                             printed */
+};
+
+/**
+ * ScopedEigenMallocGuard forbids Eigen heap allocations in the enclosing scope, turning a hot-path
+ * allocation (e.g. a temporary created by a dynamic-size expression in advance()) into an
+ * eigen_assert failure that aborts the process. The guard is active only when the framework is
+ * configured with the FRAMEWORK_ENABLE_MALLOC_GUARD CMake option (which defines
+ * EIGEN_RUNTIME_NO_MALLOC); otherwise it compiles to a no-op, so it can be left in place in
+ * production code and enabled in CI.
+ * \code{.cpp}
+ * bool Foo::advance()
+ * {
+ *     ScopedEigenMallocGuard guard;
+ *     ...
+ * }
+ * \endcode
+ * @warning The Eigen no-malloc flag is global to the process: nested guards are supported (the
+ * previous state is restored on destruction) but the guard must not be used across threads.
+ */
+class ScopedEigenMallocGuard
+{
+public:
+    ScopedEigenMallocGuard()
+    {
+#ifdef BLF_MALLOC_GUARD_ENABLED
+        m_previous = Eigen::internal::is_malloc_allowed();
+        Eigen::internal::set_is_malloc_allowed(false);
+#endif
+    }
+
+    ~ScopedEigenMallocGuard()
+    {
+#ifdef BLF_MALLOC_GUARD_ENABLED
+        Eigen::internal::set_is_malloc_allowed(m_previous);
+#endif
+    }
+
+    ScopedEigenMallocGuard(const ScopedEigenMallocGuard&) = delete;
+    ScopedEigenMallocGuard(ScopedEigenMallocGuard&&) = delete;
+    ScopedEigenMallocGuard& operator=(const ScopedEigenMallocGuard&) = delete;
+    ScopedEigenMallocGuard& operator=(ScopedEigenMallocGuard&&) = delete;
+
+private:
+#ifdef BLF_MALLOC_GUARD_ENABLED
+    bool m_previous{true}; /**< State of the no-malloc flag before the construction of the guard */
+#endif
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_EIGEN_WORKSPACE_H
@@ -8,11 +8,17 @@
 #ifndef BIPEDAL_LOCOMOTION_SYSTEM_FACTORY
 #define BIPEDAL_LOCOMOTION_SYSTEM_FACTORY
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include <BipedalLocomotion/TextLogging/Logger.h>
 
 namespace BipedalLocomotion
 {
@@ -21,7 +27,8 @@ namespace System
 
 /**
  * Factory implements the factory design patter for constructing a an object of a given Type given
- * its id.
+ * its id. The registered builders are stored in a flat table sorted by the FNV-1a hash of the
+ * idKey, so the creation of an instance boils down to a binary search that does not allocate.
  */
 template <typename _Type> class Factory
 {
@@ -30,15 +37,106 @@ public:
     using Builder = typename std::add_pointer<std::shared_ptr<Type>()>::type; /**< Pointer to the
                                                                                  Type builder */
 
+    /**
+     * Compute the FNV-1a 64-bit hash of an idKey. Being constexpr, the hash of a literal can be
+     * evaluated at compile time, i.e., Factory::hash("MyTask") does not cost anything at runtime.
+     * @param idKey the string representing the type of the Type.
+     * @return the 64-bit hash of the idKey.
+     */
+    static constexpr std::uint64_t hash(std::string_view idKey)
+    {
+        constexpr std::uint64_t offsetBasis = 0xcbf29ce484222325ull;
+        constexpr std::uint64_t prime = 0x100000001b3ull;
+
+        std::uint64_t value = offsetBasis;
+        for (const char character : idKey)
+        {
+            value ^= static_cast<std::uint64_t>(static_cast<unsigned char>(character));
+            value *= prime;
+        }
+        return value;
+    }
+
 private:
     /**
-     * Get the map containing a map of idKey and the associated Builder function.
-     * @return an unordered_map of idKey and pointer to create the Type
+     * Entry of the factory table. The entries are sorted by key so that createInstance can resolve
+     * a Builder with a binary search.
      */
-    static std::unordered_map<std::string, Builder>& getMapFactory()
+    struct Entry
     {
-        static std::unordered_map<std::string, Builder> m_mapFactory;
-        return m_mapFactory;
+        std::uint64_t key; /**< FNV-1a hash of the idKey */
+        std::string idKey; /**< Stringify version of the class type */
+        Builder builder; /**< Pointer to the function that creates the Type */
+    };
+
+    /**
+     * Get the table containing the registered Builder functions sorted by hashed idKey.
+     * @return a vector of Entry sorted by key.
+     */
+    static std::vector<Entry>& getFactoryTable()
+    {
+        static std::vector<Entry> factoryTable;
+        return factoryTable;
+    }
+
+    /**
+     * Find the Entry associated to a given hashed idKey.
+     * @param key the hashed idKey.
+     * @return a pointer to the Entry. If the key is not registered, or if the hash is shared by
+     * several registered idKeys, the pointer will be a nullptr.
+     */
+    static const Entry* findEntry(std::uint64_t key)
+    {
+        const auto& table = getFactoryTable();
+        const auto it = std::lower_bound(table.begin(),
+                                         table.end(),
+                                         key,
+                                         [](const Entry& entry, std::uint64_t value) {
+                                             return entry.key < value;
+                                         });
+        if (it == table.end() || it->key != key)
+        {
+            return nullptr;
+        }
+
+        const auto next = std::next(it);
+        if (next != table.end() && next->key == key)
+        {
+            log()->error("[Factory::findEntry] The hash {} is shared by the idKeys '{}' and '{}'. "
+                         "Use the idKey overload of createInstance to disambiguate.",
+                         key,
+                         it->idKey,
+                         next->idKey);
+            return nullptr;
+        }
+        return &(*it);
+    }
+
+    /**
+     * Find the Entry associated to a given idKey. The hash is used to locate the candidates with a
+     * binary search, the idKey stored in the Entry disambiguates hash collisions.
+     * @param key the hashed idKey.
+     * @param idKey the string representing the type of the Type.
+     * @return a pointer to the Entry. If the idKey is not registered, the pointer will be a
+     * nullptr.
+     */
+    static const Entry* findEntry(std::uint64_t key, std::string_view idKey)
+    {
+        const auto& table = getFactoryTable();
+        auto it = std::lower_bound(table.begin(),
+                                   table.end(),
+                                   key,
+                                   [](const Entry& entry, std::uint64_t value) {
+                                       return entry.key < value;
+                                   });
+        for (; it != table.end() && it->key == key; ++it)
+        {
+            if (it->idKey == idKey)
+            {
+                return &(*it);
+            }
+        }
+        return nullptr;
     }
 
 public:
@@ -51,10 +149,53 @@ public:
      */
     static std::string registerBuilder(std::string idKey, Builder classBuilder)
     {
-        getMapFactory().insert(std::pair<std::string, Builder>(idKey, classBuilder));
+        const std::uint64_t key = hash(idKey);
+        auto& table = getFactoryTable();
+        auto it = std::lower_bound(table.begin(),
+                                   table.end(),
+                                   key,
+                                   [](const Entry& entry, std::uint64_t value) {
+                                       return entry.key < value;
+                                   });
+
+        // scan the (almost always empty or single-element) run of entries sharing the hash
+        for (; it != table.end() && it->key == key; ++it)
+        {
+            // mimic std::unordered_map::insert, i.e., an already registered idKey is not
+            // overwritten
+            if (it->idKey == idKey)
+            {
+                return idKey;
+            }
+
+            log()->warn("[Factory::registerBuilder] The idKeys '{}' and '{}' share the hash {}. "
+                        "Lookups by idKey remain correct, lookups by hash are ambiguous for these "
+                        "entries.",
+                        it->idKey,
+                        idKey,
+                        key);
+        }
+
+        table.insert(it, Entry{key, idKey, classBuilder});
         return idKey;
     }
 
+    /**
+     * Create an instance of a Type given the hash of its id.
+     * @param key the hash of the idKey, e.g., computed at compile time with Factory::hash.
+     * @return a pointer to the Type. In case of issues, the pointer will be a nullptr.
+     */
+    static std::shared_ptr<Type> createInstance(std::uint64_t key)
+    {
+        const Entry* entry = findEntry(key);
+        if (entry == nullptr || entry->builder == nullptr)
+        {
+            return std::shared_ptr<Type>();
+        }
+
+        return entry->builder();
+    }
+
     /**
      * Create an instance of a Type given its id.
      * @param idKey the string representing the type of the Type. i.e., the stringify version of the
@@ -63,18 +204,47 @@ public:
      */
     static std::shared_ptr<Type> createInstance(const std::string& idKey)
     {
-        auto it = getMapFactory().find(idKey);
-        if (it == getMapFactory().end())
+        const Entry* entry = findEntry(hash(idKey), idKey);
+        if (entry == nullptr || entry->builder == nullptr)
         {
             return std::shared_ptr<Type>();
         }
 
-        if (it->second == nullptr)
+        return entry->builder();
+    }
+
+    /**
+     * Create several instances of a Type given the hashes of their ids.
+     * @param keys the hashes of the idKeys.
+     * @return a vector of pointers to the Type. If a key is not registered, the associated pointer
+     * will be a nullptr.
+     */
+    static std::vector<std::shared_ptr<Type>> createInstances(const std::vector<std::uint64_t>& keys)
+    {
+        std::vector<std::shared_ptr<Type>> instances;
+        instances.reserve(keys.size());
+        for (const std::uint64_t key : keys)
         {
-            return std::shared_ptr<Type>();
+            instances.push_back(createInstance(key));
         }
+        return instances;
+    }
 
-        return it->second();
+    /**
+     * Create several instances of a Type given their ids.
+     * @param idKeys the strings representing the types of the Type.
+     * @return a vector of pointers to the Type. If an idKey is not registered, the associated
+     * pointer will be a nullptr.
+     */
+    static std::vector<std::shared_ptr<Type>> createInstances(const std::vector<std::string>& idKeys)
+    {
+        std::vector<std::shared_ptr<Type>> instances;
+        instances.reserve(idKeys.size());
+        for (const std::string& idKey : idKeys)
+        {
+            instances.push_back(createInstance(idKey));
+        }
+        return instances;
     }
 
     virtual ~Factory() = default;
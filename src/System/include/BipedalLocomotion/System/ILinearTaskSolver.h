@@ -8,6 +8,7 @@
 #ifndef BIPEDAL_LOCOMOTION_SYSTEM_ILINEAR_TASK_SOLVER_H
 #define BIPEDAL_LOCOMOTION_SYSTEM_ILINEAR_TASK_SOLVER_H
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -112,6 +113,55 @@ public:
      */
     virtual std::vector<std::string> getTaskNames() const = 0;
 
+    /**
+     * Set the update decimation associated to an already existing task. A task with decimation
+     * equal to `d` is updated once every `d` calls to advance(), while the cached task matrices
+     * are reused in between. This is useful for tasks whose content changes at a rate lower than
+     * the solver one (e.g. regularization tasks).
+     * @param taskName name associated to the task.
+     * @param decimation number of calls to advance() between two consecutive updates of the task.
+     * The value must be strictly positive. 1 (the default for every task) means that the task is
+     * updated at every call to advance().
+     * @note This method is optional. The default implementation does not support update-rate
+     * scheduling and always returns false.
+     * @return true if the decimation has been updated.
+     */
+    virtual bool setTaskUpdateDecimation(const std::string& taskName, std::size_t decimation)
+    {
+        return false;
+    }
+
+    /**
+     * Mark an already existing task as dirty. The task is updated at the next call to advance()
+     * regardless of its update decimation, and its schedule restarts from there. Call this method
+     * when the task setpoint changes between two scheduled updates.
+     * @param taskName name associated to the task.
+     * @note This method is optional. The default implementation does not support update-rate
+     * scheduling and always returns false.
+     * @return true if the task has been marked as dirty.
+     */
+    virtual bool triggerTaskUpdate(const std::string& taskName)
+    {
+        return false;
+    }
+
+    /**
+     * Replace the solver per-task update loop with a user provided function. This is useful when
+     * the task list is frozen and the tasks are updated through a compile-time composed stack (see
+     * StaticTaskStack), avoiding the virtual dispatch of LinearTask::update().
+     * @param updater function updating ALL the tasks added to the solver. Passing a nullptr
+     * restores the default update loop.
+     * @note This method is optional. The default implementation does not support an external
+     * updater and always returns false.
+     * @warning The external updater bypasses the per-task update-rate scheduling (see
+     * setTaskUpdateDecimation).
+     * @return true if the updater has been set.
+     */
+    virtual bool setExternalTaskUpdater(std::function<bool()> updater)
+    {
+        return false;
+    }
+
     /**
      * Finalize the Solver.
      * @param handler parameter handler.
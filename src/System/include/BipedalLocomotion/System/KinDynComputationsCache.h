@@ -0,0 +1,117 @@
+/**
+ * @file KinDynComputationsCache.h
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_KIN_DYN_COMPUTATIONS_CACHE_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_KIN_DYN_COMPUTATIONS_CACHE_H
+
+#include <memory>
+
+#include <Eigen/Dense>
+
+#include <iDynTree/KinDynComputations.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * KinDynComputationsCache is a memoizing layer on top of iDynTree::KinDynComputations. Several
+ * tasks (and several solvers, e.g. an IK and a TSID instance running in the same control loop)
+ * often query the same quantities from the same KinDynComputations object within one tick.
+ * KinDynComputationsCache computes each quantity once per robot state generation and serves the
+ * cached value to every other consumer. The user is responsible for calling
+ * advanceStateGeneration() every time the robot state stored in the KinDynComputations object is
+ * updated, typically once per control loop right after
+ * iDynTree::KinDynComputations::setRobotState().
+ * @warning The class is not thread-safe. All the consumers must query the cache from the same
+ * thread (or the user must guarantee mutual exclusion).
+ */
+class KinDynComputationsCache
+{
+public:
+    /**
+     * Constructor.
+     */
+    KinDynComputationsCache();
+
+    /**
+     * Destructor.
+     */
+    ~KinDynComputationsCache();
+
+    /**
+     * Set the kinDynComputations object.
+     * @param kinDyn pointer to a kinDynComputations object.
+     * @return True in case of success, false otherwise.
+     */
+    bool setKinDyn(std::shared_ptr<iDynTree::KinDynComputations> kinDyn);
+
+    /**
+     * Get the kinDynComputations object wrapped by the cache.
+     * @return a pointer to the kinDynComputations object.
+     */
+    std::shared_ptr<iDynTree::KinDynComputations> kinDyn() const;
+
+    /**
+     * Invalidate all the cached quantities. Call this method every time the robot state stored in
+     * the KinDynComputations object changes.
+     */
+    void advanceStateGeneration();
+
+    /**
+     * Get the center of mass position.
+     * @return a const reference to the center of mass position.
+     */
+    const Eigen::Vector3d& getCenterOfMassPosition();
+
+    /**
+     * Get the center of mass velocity.
+     * @return a const reference to the center of mass velocity.
+     */
+    const Eigen::Vector3d& getCenterOfMassVelocity();
+
+    /**
+     * Get the center of mass bias acceleration.
+     * @return a const reference to the center of mass bias acceleration.
+     */
+    const Eigen::Vector3d& getCenterOfMassBiasAcc();
+
+    /**
+     * Get the center of mass jacobian expressed in MIXED representation.
+     * @param comJacobian matrix that will contain the jacobian. It must be a 3 x (6 + DoFs) matrix.
+     * @return True in case of success, false otherwise.
+     */
+    bool getCenterOfMassJacobian(Eigen::MatrixXd& comJacobian);
+
+    /**
+     * Get the free floating mass matrix.
+     * @param massMatrix matrix that will contain the mass matrix. It must be a (6 + DoFs) x
+     * (6 + DoFs) matrix.
+     * @return True in case of success, false otherwise.
+     */
+    bool getFreeFloatingMassMatrix(Eigen::MatrixXd& massMatrix);
+
+    /**
+     * Get the free floating jacobian of a given frame expressed in MIXED representation.
+     * @param frameIndex index of the frame.
+     * @param jacobian matrix that will contain the jacobian. It must be a 6 x (6 + DoFs) matrix.
+     * @return True in case of success, false otherwise.
+     */
+    bool getFrameFreeFloatingJacobian(const iDynTree::FrameIndex& frameIndex,
+                                      Eigen::MatrixXd& jacobian);
+
+private:
+    /** Private implementation */
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_KIN_DYN_COMPUTATIONS_CACHE_H
@@ -0,0 +1,115 @@
+/**
+ * @file KinDynComputationsPool.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_KIN_DYN_COMPUTATIONS_POOL_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_KIN_DYN_COMPUTATIONS_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <Eigen/Dense>
+
+#include <iDynTree/KinDynComputations.h>
+#include <iDynTree/Model/Model.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * KinDynComputationsPool owns a set of iDynTree::KinDynComputations objects loaded with the same
+ * model and kept on the same robot state. Several components (e.g. the IK and TSID tasks, the
+ * legged odometry, the sub-model wrappers of the robot dynamics estimator) query forward
+ * kinematics over the same joint configuration within one tick, and
+ * iDynTree::KinDynComputations is not thread-safe, so concurrent consumers usually end up
+ * recomputing the same quantities on private objects that they also have to keep in sync by hand.
+ * The pool centralizes this pattern: freeze() copies the robot state into every slot and
+ * increments a generation counter, then each consumer thread queries its own slot without any
+ * locking. The slots are not touched by the pool between two freeze() calls, hence the state they
+ * expose is immutable until the next freeze.
+ * @warning Each slot must be queried by at most one thread at a time: the queries are read-only
+ * from the caller point of view but they update the internal caches of the slot.
+ */
+class KinDynComputationsPool
+{
+public:
+    /**
+     * Constructor.
+     */
+    KinDynComputationsPool();
+
+    /**
+     * Destructor.
+     */
+    ~KinDynComputationsPool();
+
+    /**
+     * Initialize the pool loading the model into the given number of slots.
+     * @param model the model shared by all the slots.
+     * @param numberOfSlots number of KinDynComputations objects owned by the pool, typically one
+     * per consumer thread.
+     * @return True in case of success, false otherwise.
+     */
+    bool initialize(const iDynTree::Model& model, std::size_t numberOfSlots);
+
+    /**
+     * Copy the robot state stored in the source KinDynComputations object into every slot and
+     * advance the state generation. The frame velocity representation of the source is propagated
+     * to the slots as well.
+     * @param source the KinDynComputations object holding the reference robot state.
+     * @return True in case of success, false otherwise.
+     */
+    bool freeze(iDynTree::KinDynComputations& source);
+
+    /**
+     * Set the robot state of every slot and advance the state generation.
+     * @param worldTBase homogeneous transformation of the base with respect to the world frame.
+     * @param jointPositions vector of joint positions.
+     * @param baseVelocity base velocity expressed in the representation of the slots.
+     * @param jointVelocities vector of joint velocities.
+     * @param gravity gravity vector expressed in the world frame.
+     * @return True in case of success, false otherwise.
+     */
+    bool freeze(const Eigen::Matrix4d& worldTBase,
+                Eigen::Ref<const Eigen::VectorXd> jointPositions,
+                Eigen::Ref<const Eigen::Matrix<double, 6, 1>> baseVelocity,
+                Eigen::Ref<const Eigen::VectorXd> jointVelocities,
+                Eigen::Ref<const Eigen::Vector3d> gravity);
+
+    /**
+     * Get the number of slots owned by the pool.
+     * @return the number of slots.
+     */
+    std::size_t size() const;
+
+    /**
+     * Get one slot of the pool.
+     * @param index index of the slot. It must be lower than size().
+     * @return a pointer to the KinDynComputations object, or nullptr if the index is not valid.
+     */
+    std::shared_ptr<iDynTree::KinDynComputations> slot(std::size_t index) const;
+
+    /**
+     * Get the generation of the robot state currently stored in the slots. The generation is
+     * incremented by every successful freeze() call, so a consumer can detect whether the
+     * quantities it computed from its slot are still up to date.
+     * @return the current state generation. It is equal to 0 until the first freeze().
+     */
+    std::uint64_t generation() const;
+
+private:
+    /** Private implementation */
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_KIN_DYN_COMPUTATIONS_POOL_H
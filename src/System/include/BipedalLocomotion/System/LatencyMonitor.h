@@ -0,0 +1,161 @@
+/**
+ * @file LatencyMonitor.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_LATENCY_MONITOR_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_LATENCY_MONITOR_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <BipedalLocomotion/System/Stamped.h>
+#include <BipedalLocomotion/System/TimeProfiler.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * LatencyMonitor measures the per-hop latency and jitter of Stamped samples travelling through an
+ * AdvanceableRunner pipeline (e.g. sensor bridge -> estimator -> solver -> robot control). Each
+ * hop is registered once at configuration time; the consumer then records every received sample
+ * and the monitor stores, in preallocated ring buffers, the latency (time elapsed between the
+ * acquisition stamp and the arrival at the consumer) and the inter-arrival period of consecutive
+ * samples, whose spread is the jitter of the hop. A sample whose stamp is identical to the
+ * previous one is ignored, so the consumer can poll a SharedResource faster than the producer
+ * without polluting the statistics. The recorded samples can be dumped on demand as aggregate
+ * statistics or as raw durations to build histograms.
+ * @note Like TimeProfiler, the monitor is not thread-safe: each consumer thread is expected to own
+ * its monitor.
+ */
+class LatencyMonitor
+{
+public:
+    /**
+     * Index returned by registerHop() and getHopIndex() when the hop is not valid.
+     */
+    static constexpr std::ptrdiff_t InvalidHopIndex = TimeProfiler::InvalidSectionIndex;
+
+    /**
+     * Register a new hop. The ring buffers associated to the hop are allocated here, the following
+     * calls to record() do not allocate memory.
+     * @param name name of the hop.
+     * @param capacity number of samples stored in the ring buffers. When a buffer is full the
+     * oldest sample is overwritten.
+     * @return the index associated to the hop in case of success, InvalidHopIndex if the name is
+     * already taken or the capacity is equal to zero.
+     */
+    std::ptrdiff_t registerHop(const std::string& name, std::size_t capacity = 1024);
+
+    /**
+     * Get the index associated to an already registered hop.
+     * @param name name of the hop.
+     * @return the index of the hop, InvalidHopIndex if the hop does not exist.
+     */
+    std::ptrdiff_t getHopIndex(const std::string& name) const;
+
+    /**
+     * Record the arrival of a sample given its acquisition time. The arrival time is taken from
+     * BipedalLocomotion::clock().
+     * @param hopIndex index of the hop returned by registerHop(). If the index is not valid
+     * nothing is recorded.
+     * @param acquisitionTime acquisition time of the sample, expressed in the
+     * BipedalLocomotion::clock() domain.
+     */
+    void record(std::ptrdiff_t hopIndex, const std::chrono::nanoseconds& acquisitionTime);
+
+    /**
+     * Record the arrival of a stamped sample.
+     * @param hopIndex index of the hop returned by registerHop(). If the index is not valid
+     * nothing is recorded.
+     * @param sample the received sample.
+     */
+    template <typename T> void record(std::ptrdiff_t hopIndex, const Stamped<T>& sample)
+    {
+        this->record(hopIndex, sample.time);
+    }
+
+    /**
+     * Get the aggregate latency statistics associated to a hop.
+     * @param name name of the hop.
+     * @param statistics statistics of the hop.
+     * @return true in case of success, false if the hop does not exist.
+     */
+    bool getLatencyStatistics(const std::string& name,
+                              TimeProfiler::SectionStatistics& statistics) const;
+
+    /**
+     * Get the aggregate inter-arrival statistics associated to a hop. The spread between the
+     * minimum and the maximum inter-arrival period is the jitter of the hop.
+     * @param name name of the hop.
+     * @param statistics statistics of the hop.
+     * @return true in case of success, false if the hop does not exist.
+     */
+    bool getInterArrivalStatistics(const std::string& name,
+                                   TimeProfiler::SectionStatistics& statistics) const;
+
+    /**
+     * Get the raw latencies stored in the ring buffer of a hop, ordered from the oldest to the
+     * most recent. This can be used to build histograms of the hop latency.
+     * @param name name of the hop.
+     * @param samples vector filled with the stored latencies.
+     * @return true in case of success, false if the hop does not exist.
+     */
+    bool getLatencySamples(const std::string& name,
+                           std::vector<std::chrono::nanoseconds>& samples) const;
+
+    /**
+     * Get the raw inter-arrival periods stored in the ring buffer of a hop, ordered from the
+     * oldest to the most recent.
+     * @param name name of the hop.
+     * @param samples vector filled with the stored periods.
+     * @return true in case of success, false if the hop does not exist.
+     */
+    bool getInterArrivalSamples(const std::string& name,
+                                std::vector<std::chrono::nanoseconds>& samples) const;
+
+    /**
+     * Remove all the samples stored in the ring buffers. The registered hops are kept.
+     */
+    void clearSamples();
+
+    /**
+     * Return a string containing the latency and inter-arrival statistics of all the registered
+     * hops.
+     * @return a string containing the description of the monitor.
+     */
+    std::string toString() const;
+
+private:
+    /**
+     * Internal state of a hop.
+     */
+    struct Hop
+    {
+        std::chrono::nanoseconds lastAcquisitionTime{std::chrono::nanoseconds::zero()}; /**< Stamp
+                                                                                  of the last
+                                                                                  recorded
+                                                                                  sample */
+        std::chrono::nanoseconds lastArrivalTime{std::chrono::nanoseconds::zero()}; /**< Arrival
+                                                                                  time of the last
+                                                                                  recorded
+                                                                                  sample */
+        bool hasSample{false}; /**< True if at least a sample has been recorded */
+    };
+
+    TimeProfiler m_latency; /**< Profiler storing the latencies, one section per hop */
+    TimeProfiler m_interArrival; /**< Profiler storing the inter-arrival periods, one section per
+                                    hop */
+    std::vector<Hop> m_hops; /**< Internal state of the hops */
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_LATENCY_MONITOR_H
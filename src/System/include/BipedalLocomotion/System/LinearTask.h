@@ -8,8 +8,10 @@
 #ifndef BIPEDAL_LOCOMOTION_SYSTEM_LINEAR_TASK_H
 #define BIPEDAL_LOCOMOTION_SYSTEM_LINEAR_TASK_H
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -82,6 +84,26 @@ public:
      */
     virtual bool update();
 
+    /**
+     * ColumnBlock describes a contiguous set of columns of the task matrix.
+     */
+    struct ColumnBlock
+    {
+        std::ptrdiff_t offset{0}; /**< Index of the first column of the block. */
+        std::ptrdiff_t size{0}; /**< Number of columns of the block. */
+    };
+
+    /**
+     * Get the structural non-zero column blocks of the task matrix. A solver can exploit this
+     * information to keep its sparse matrices sparse: the entries of the task matrix outside the
+     * returned blocks are structurally zero. The default implementation returns a single block
+     * covering all the columns, i.e. a dense task.
+     * @return the list of the structural non-zero column blocks.
+     * @warning A task overriding this method must guarantee that update() never writes a non-zero
+     * value outside the declared blocks.
+     */
+    virtual std::vector<ColumnBlock> structuralColumnBlocks() const;
+
     /**
      * Get the matrix A.
      * @return a const reference to the matrix A.
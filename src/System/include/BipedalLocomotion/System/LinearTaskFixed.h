@@ -0,0 +1,86 @@
+/**
+ * @file LinearTaskFixed.h
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_LINEAR_TASK_FIXED_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_LINEAR_TASK_FIXED_H
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/System/LinearTask.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * LinearTaskFixed is a mixin that specializes a LinearTask (or any class derived from it) whose
+ * number of rows is known at compile time. The task matrix and vector are still stored in the
+ * dynamic LinearTask::m_A and LinearTask::m_b, so the task remains fully compatible with
+ * ILinearTaskSolver, but the protected accessors fixedA() and fixedB() expose them with a
+ * compile-time number of rows. Writing the update() body through these views lets Eigen unroll and
+ * vectorize the row-wise kernels instead of emitting dynamically-sized loops.
+ * @tparam Rows number of rows of the task, i.e. the value returned by size().
+ * @tparam Base class the task derives from. It must be LinearTask or a class derived from it
+ * (e.g. IK::IKLinearTask or TSID::TSIDLinearTask).
+ * @note The number of columns is left dynamic since it depends on the number of variables handled
+ * by the VariablesHandler, which is known only at run time.
+ */
+template <int Rows, typename Base = LinearTask> class LinearTaskFixed : public Base
+{
+    static_assert(std::is_base_of_v<LinearTask, Base>,
+                  "LinearTaskFixed can specialize only classes derived from LinearTask.");
+    static_assert(Rows > 0, "The number of rows of the task must be positive.");
+
+public:
+    static constexpr int RowsAtCompileTime = Rows; /**< Number of rows of the task. */
+
+    /** Matrix with a compile-time number of rows and a run-time number of columns. */
+    using FixedMatrix = Eigen::Matrix<double, Rows, Eigen::Dynamic>;
+
+    /** Vector with a compile-time number of rows. */
+    using FixedVector = Eigen::Matrix<double, Rows, 1>;
+
+    /**
+     * Get the size of the task, i.e. the number of rows of the vector b.
+     * @return the size of the task.
+     */
+    std::size_t size() const final
+    {
+        return Rows;
+    }
+
+protected:
+    /**
+     * Get the task matrix with a compile-time number of rows.
+     * @return a reference to the matrix A with Rows rows.
+     */
+    Eigen::Ref<FixedMatrix> fixedA()
+    {
+        assert(this->m_A.rows() == Rows && "The task matrix has an unexpected number of rows.");
+        return Eigen::Ref<FixedMatrix>(this->m_A);
+    }
+
+    /**
+     * Get the task vector with a compile-time number of rows.
+     * @return a reference to the vector b with Rows rows.
+     */
+    Eigen::Ref<FixedVector> fixedB()
+    {
+        assert(this->m_b.size() == Rows && "The task vector has an unexpected number of rows.");
+        return Eigen::Ref<FixedVector>(this->m_b);
+    }
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_LINEAR_TASK_FIXED_H
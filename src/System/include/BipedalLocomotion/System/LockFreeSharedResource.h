@@ -0,0 +1,104 @@
+/**
+ * @file LockFreeSharedResource.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_LOCK_FREE_SHARED_RESOURCE_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_LOCK_FREE_SHARED_RESOURCE_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include <BipedalLocomotion/System/SharedResource.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * LockFreeSharedResource is a single-producer single-consumer specialization of SharedResource.
+ * It implements a triple buffer: the producer and the consumer own one preallocated slot each and
+ * exchange it with the middle one with a single atomic operation, so neither set() nor get() ever
+ * blocks and no priority inversion can occur between the two threads. The consumer always reads
+ * the most recent value published by the producer, intermediate values may be skipped as in
+ * SharedResource.
+ * @warning The implementation is thread safe if and only if at most one thread calls set() and at
+ * most one thread calls get(). This is the case of the wire connecting two AdvanceableRunner
+ * objects. If several producers or consumers are involved, please use the default SharedResource.
+ */
+template <class T> class LockFreeSharedResource : public SharedResource<T>
+{
+    static constexpr unsigned int indexMask = 0b011; /**< Mask extracting the slot index. */
+    static constexpr unsigned int dirtyFlag = 0b100; /**< Flag set when the middle slot contains a
+                                                        value not read by the consumer yet. */
+
+    mutable std::array<T, 3> m_buffers; /**< Preallocated slots exchanged by the two threads. */
+
+    /** Index of the middle slot, possibly combined with dirtyFlag. It is the only state shared by
+     * the two threads. */
+    mutable std::atomic<unsigned int> m_middle{1};
+
+    unsigned int m_back{0}; /**< Slot owned by the producer. */
+    mutable unsigned int m_front{2}; /**< Slot owned by the consumer. */
+
+    LockFreeSharedResource() = default;
+
+public:
+    using Ptr = std::shared_ptr<LockFreeSharedResource<T>>;
+
+    /**
+     * Set the resource. It must be called by the producer thread only.
+     */
+    void set(const T& resource) final;
+
+    /**
+     * Get the resource. It must be called by the consumer thread only.
+     * @return the copy of the latest object published with set().
+     */
+    T get() const final;
+
+    /**
+     * Method used to create a lock-free shared resource.
+     * @return a pointer of a shared resource.
+     */
+    static typename SharedResource<T>::Ptr create();
+};
+
+template <class T> void LockFreeSharedResource<T>::set(const T& resource)
+{
+    m_buffers[m_back] = resource;
+
+    // publish the back slot as the new middle one and take the previous middle slot as new back.
+    // The dirty flag informs the consumer that the middle slot contains a fresh value
+    m_back = m_middle.exchange(m_back | dirtyFlag, std::memory_order_acq_rel) & indexMask;
+
+    // when no thread is blocked in waitForNewData() this costs two atomic operations only, so the
+    // publication path stays wait-free
+    this->notifyNewData();
+}
+
+template <class T> T LockFreeSharedResource<T>::get() const
+{
+    // the dirty flag is cleared only by this thread, so if it is observed the exchange is
+    // guaranteed to return a fresh slot (possibly even fresher than the observed one)
+    if ((m_middle.load(std::memory_order_acquire) & dirtyFlag) != 0)
+    {
+        m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & indexMask;
+    }
+
+    return m_buffers[m_front];
+}
+
+template <class T> typename SharedResource<T>::Ptr LockFreeSharedResource<T>::create()
+{
+    return std::shared_ptr<LockFreeSharedResource<T>>(new LockFreeSharedResource<T>());
+}
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_LOCK_FREE_SHARED_RESOURCE_H
@@ -0,0 +1,189 @@
+/**
+ * @file ParallelTaskGroupUpdater.h
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_PARALLEL_TASK_GROUP_UPDATER_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_PARALLEL_TASK_GROUP_UPDATER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * ParallelTaskGroupUpdater runs groups of update functions concurrently. The functions belonging
+ * to the same group are executed serially on the same thread, while different groups run in
+ * parallel. The first group is executed on the calling thread, the others on persistent worker
+ * threads, so update() does not spawn threads in the control loop.
+ * @note It is the caller's responsibility to guarantee that functions placed in different groups
+ * do not access the same non-thread-safe resource (e.g. the same iDynTree::KinDynComputations
+ * object).
+ */
+class ParallelTaskGroupUpdater
+{
+public:
+    using UpdateFunction = std::function<bool()>;
+
+    ParallelTaskGroupUpdater() = default;
+
+    ~ParallelTaskGroupUpdater()
+    {
+        this->stop();
+    }
+
+    ParallelTaskGroupUpdater(const ParallelTaskGroupUpdater&) = delete;
+    ParallelTaskGroupUpdater& operator=(const ParallelTaskGroupUpdater&) = delete;
+
+    /**
+     * Set the groups of update functions. Worker threads are (re)created here, one for each group
+     * after the first.
+     * @param groups list of groups. Each group is a list of update functions executed serially.
+     */
+    void setGroups(std::vector<std::vector<UpdateFunction>> groups)
+    {
+        this->stop();
+
+        m_groups = std::move(groups);
+        if (m_groups.size() < 2)
+        {
+            return;
+        }
+
+        m_isRunning = true;
+        m_generation = 0;
+        for (std::size_t i = 1; i < m_groups.size(); i++)
+        {
+            m_workers.emplace_back([this, i]() { this->workerLoop(i); });
+        }
+    }
+
+    /**
+     * Run all the groups and wait for their completion.
+     * @return True if all the update functions returned true, false otherwise.
+     */
+    bool update()
+    {
+        if (m_groups.empty())
+        {
+            return true;
+        }
+
+        bool ok = true;
+
+        if (m_workers.empty())
+        {
+            for (const auto& group : m_groups)
+            {
+                ok = this->runGroup(group) && ok;
+            }
+            return ok;
+        }
+
+        // wake up the workers
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pendingWorkers = m_workers.size();
+            m_workersOutcome = true;
+            m_generation++;
+        }
+        m_startCondition.notify_all();
+
+        // the first group runs on the calling thread
+        ok = this->runGroup(m_groups.front());
+
+        // wait for the workers
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCondition.wait(lock, [this]() { return m_pendingWorkers == 0; });
+
+        return ok && m_workersOutcome;
+    }
+
+private:
+    void stop()
+    {
+        if (m_workers.empty())
+        {
+            m_groups.clear();
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_isRunning = false;
+        }
+        m_startCondition.notify_all();
+        for (auto& worker : m_workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+        m_workers.clear();
+        m_groups.clear();
+    }
+
+    bool runGroup(const std::vector<UpdateFunction>& group)
+    {
+        bool ok = true;
+        for (const auto& function : group)
+        {
+            ok = function() && ok;
+        }
+        return ok;
+    }
+
+    void workerLoop(std::size_t groupIndex)
+    {
+        std::uint64_t lastGeneration = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_startCondition.wait(lock, [this, lastGeneration]() {
+                    return !m_isRunning || m_generation != lastGeneration;
+                });
+                if (!m_isRunning)
+                {
+                    return;
+                }
+                lastGeneration = m_generation;
+            }
+
+            const bool ok = this->runGroup(m_groups[groupIndex]);
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_workersOutcome = m_workersOutcome && ok;
+                m_pendingWorkers--;
+            }
+            m_doneCondition.notify_one();
+        }
+    }
+
+    std::vector<std::vector<UpdateFunction>> m_groups; /**< Groups of update functions */
+    std::vector<std::thread> m_workers; /**< Persistent worker threads */
+
+    std::mutex m_mutex;
+    std::condition_variable m_startCondition;
+    std::condition_variable m_doneCondition;
+    std::uint64_t m_generation{0}; /**< Increased at every update() to wake up the workers */
+    std::size_t m_pendingWorkers{0};
+    bool m_workersOutcome{true};
+    bool m_isRunning{false};
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_PARALLEL_TASK_GROUP_UPDATER_H
@@ -0,0 +1,271 @@
+/**
+ * @file RecordingSharedResource.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_RECORDING_SHARED_RESOURCE_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_RECORDING_SHARED_RESOURCE_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <BipedalLocomotion/System/Clock.h>
+#include <BipedalLocomotion/System/SharedResource.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * Magic sequence identifying a shared resource log file. It is written at the beginning of the
+ * file and checked by SharedResourceLogReader.
+ */
+constexpr char SharedResourceLogMagic[8] = {'b', 'l', 'f', 'S', 'R', 'v', '0', '1'};
+
+/**
+ * RecordingSharedResource is a SharedResource decorator that appends every value published with
+ * set() to a binary log file together with the publication time expressed in the
+ * BipedalLocomotion::clock() domain. Replacing the plain SharedResource connecting two
+ * AdvanceableRunner objects with a RecordingSharedResource records all the traffic flowing on that
+ * wire without touching the advanceables. The log can then be replayed deterministically with
+ * SharedResourceLogReader, e.g. to profile a subset of the pipeline offline at maximum speed.
+ * @note The payload is serialized with a user-provided function, so the class does not constrain
+ * the exchanged type. Each record is stored as the timestamp (8 bytes), the payload size (8 bytes)
+ * and the payload itself. The integers are stored in the host byte order, hence the log is meant
+ * to be replayed on the same architecture that recorded it.
+ */
+template <class T> class RecordingSharedResource : public SharedResource<T>
+{
+public:
+    /**
+     * Function serializing the exchanged value into a byte buffer. The buffer is cleared by the
+     * caller before the invocation.
+     */
+    using Serializer = std::function<void(const T&, std::vector<char>&)>;
+
+private:
+    std::ofstream m_file; /**< The binary log file */
+    Serializer m_serializer; /**< The user-provided payload serializer */
+    std::vector<char> m_buffer; /**< Preallocated serialization buffer */
+    std::mutex m_fileMutex; /**< The mutex protecting the file and the buffer */
+
+    RecordingSharedResource(const std::string& filename, Serializer serializer)
+        : m_file(filename, std::ios::binary)
+        , m_serializer(std::move(serializer))
+    {
+        if (m_file.is_open())
+        {
+            m_file.write(SharedResourceLogMagic, sizeof(SharedResourceLogMagic));
+        }
+    }
+
+public:
+    using Ptr = std::shared_ptr<RecordingSharedResource<T>>;
+
+    /**
+     * Set the resource and append it to the log file.
+     */
+    void set(const T& resource) final;
+
+    /**
+     * Method used to create a recording shared resource.
+     * @param filename path of the binary log file. The file is truncated if it already exists.
+     * @param serializer function serializing the exchanged value into a byte buffer.
+     * @return a pointer of a shared resource. nullptr if the file cannot be opened or the
+     * serializer is not valid.
+     */
+    static typename SharedResource<T>::Ptr create(const std::string& filename,
+                                                  Serializer serializer);
+};
+
+template <class T> void RecordingSharedResource<T>::set(const T& resource)
+{
+    SharedResource<T>::set(resource);
+
+    const std::int64_t time = BipedalLocomotion::clock().now().count();
+
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+    m_buffer.clear();
+    m_serializer(resource, m_buffer);
+
+    const std::uint64_t payloadSize = m_buffer.size();
+    m_file.write(reinterpret_cast<const char*>(&time), sizeof(time));
+    m_file.write(reinterpret_cast<const char*>(&payloadSize), sizeof(payloadSize));
+    m_file.write(m_buffer.data(), payloadSize);
+}
+
+template <class T>
+typename SharedResource<T>::Ptr RecordingSharedResource<T>::create(const std::string& filename,
+                                                                   Serializer serializer)
+{
+    constexpr auto logPrefix = "[RecordingSharedResource::create]";
+
+    if (!serializer)
+    {
+        log()->error("{} The serializer is not valid.", logPrefix);
+        return nullptr;
+    }
+
+    auto resource = std::shared_ptr<RecordingSharedResource<T>>(
+        new RecordingSharedResource<T>(filename, std::move(serializer)));
+
+    if (!resource->m_file.is_open())
+    {
+        log()->error("{} Unable to open the file named: {}.", logPrefix, filename);
+        return nullptr;
+    }
+
+    return resource;
+}
+
+/**
+ * SharedResourceLogReader reads a log produced by RecordingSharedResource. The records can be
+ * consumed one by one with read(), so a harness can drive any subset of a pipeline
+ * deterministically and at maximum speed, or pushed all at once into a SharedResource with
+ * replayInto(). The record timestamps allow the harness to reproduce the original timing if
+ * needed.
+ */
+template <class T> class SharedResourceLogReader
+{
+public:
+    /**
+     * Function deserializing the byte buffer into the exchanged value. It must return true in
+     * case of success.
+     */
+    using Deserializer = std::function<bool(const std::vector<char>&, T&)>;
+
+private:
+    std::ifstream m_file; /**< The binary log file */
+    Deserializer m_deserializer; /**< The user-provided payload deserializer */
+    std::vector<char> m_buffer; /**< Preallocated deserialization buffer */
+    bool m_isValid{false}; /**< True if the file has been opened and the magic sequence matches */
+
+public:
+    /**
+     * Constructor.
+     * @param filename path of the binary log file.
+     * @param deserializer function deserializing the byte buffer into the exchanged value.
+     */
+    SharedResourceLogReader(const std::string& filename, Deserializer deserializer)
+        : m_file(filename, std::ios::binary)
+        , m_deserializer(std::move(deserializer))
+    {
+        constexpr auto logPrefix = "[SharedResourceLogReader::SharedResourceLogReader]";
+
+        if (!m_file.is_open())
+        {
+            log()->error("{} Unable to open the file named: {}.", logPrefix, filename);
+            return;
+        }
+
+        if (!m_deserializer)
+        {
+            log()->error("{} The deserializer is not valid.", logPrefix);
+            return;
+        }
+
+        char magic[sizeof(SharedResourceLogMagic)];
+        if (!m_file.read(magic, sizeof(magic))
+            || std::memcmp(magic, SharedResourceLogMagic, sizeof(magic)) != 0)
+        {
+            log()->error("{} The file named: {} is not a shared resource log.",
+                         logPrefix,
+                         filename);
+            return;
+        }
+
+        m_isValid = true;
+    }
+
+    /**
+     * Check if the reader is valid.
+     * @return true if the file has been opened and recognized as a shared resource log.
+     */
+    bool isValid() const
+    {
+        return m_isValid;
+    }
+
+    /**
+     * Read the next record of the log.
+     * @param time the publication time of the record expressed in the clock domain of the
+     * recording process.
+     * @param value the deserialized payload.
+     * @return true in case of success, false if the end of the log has been reached or the record
+     * is corrupted.
+     */
+    bool read(std::chrono::nanoseconds& time, T& value)
+    {
+        constexpr auto logPrefix = "[SharedResourceLogReader::read]";
+
+        if (!m_isValid)
+        {
+            return false;
+        }
+
+        std::int64_t timeCount;
+        std::uint64_t payloadSize;
+        if (!m_file.read(reinterpret_cast<char*>(&timeCount), sizeof(timeCount)))
+        {
+            // end of the log
+            return false;
+        }
+
+        if (!m_file.read(reinterpret_cast<char*>(&payloadSize), sizeof(payloadSize)))
+        {
+            log()->error("{} The log is truncated.", logPrefix);
+            return false;
+        }
+
+        m_buffer.resize(payloadSize);
+        if (!m_file.read(m_buffer.data(), payloadSize))
+        {
+            log()->error("{} The log is truncated.", logPrefix);
+            return false;
+        }
+
+        if (!m_deserializer(m_buffer, value))
+        {
+            log()->error("{} Unable to deserialize the record.", logPrefix);
+            return false;
+        }
+
+        time = std::chrono::nanoseconds(timeCount);
+        return true;
+    }
+
+    /**
+     * Push all the remaining records of the log into the given shared resource at maximum speed.
+     * @param resource the destination shared resource.
+     * @return the number of records pushed.
+     */
+    std::size_t replayInto(SharedResource<T>& resource)
+    {
+        std::size_t records = 0;
+        std::chrono::nanoseconds time;
+        T value;
+        while (this->read(time, value))
+        {
+            resource.set(value);
+            records++;
+        }
+
+        return records;
+    }
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_RECORDING_SHARED_RESOURCE_H
@@ -8,6 +8,10 @@
 #ifndef BIPEDAL_LOCOMOTION_SYSTEM_SHARED_RESOURCE_H
 #define BIPEDAL_LOCOMOTION_SYSTEM_SHARED_RESOURCE_H
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 
@@ -22,27 +26,84 @@ namespace System
  * shared resource is to use the SharedResource::create() static method. If want a visual
  * interpretation of shared resource you may imagine it as the wire connecting two blocks running in
  * two separate threads. The implementation of SharedResource is thread safe.
+ * @note This implementation guards the resource with a mutex, so it supports any number of
+ * producers and consumers. If the connection has a single producer and a single consumer and the
+ * lock contention is a concern, consider LockFreeSharedResource.
+ * @note Every call to set() increments a generation counter. A consumer can block until a new
+ * value is published with waitForNewData(), enabling event-driven scheduling instead of periodic
+ * polling (see AdvanceableRunner).
  */
 template <class T> class SharedResource
 {
     T m_resource; /**< The resource */
     mutable std::mutex m_mutex; /**< The mutex used to protect the resource */
 
+    std::atomic<std::uint64_t> m_generation{0}; /**< Counter incremented at every set() */
+    mutable std::atomic<std::size_t> m_waiters{0}; /**< Number of threads blocked in
+                                                      waitForNewData() */
+    mutable std::mutex m_waitMutex; /**< The mutex associated to the condition variable */
+    mutable std::condition_variable m_newDataCondition; /**< Condition notified at every set() */
+
+protected:
     SharedResource() = default;
 
+    /**
+     * Increment the generation counter and wake up the threads blocked in waitForNewData(). It
+     * must be called by the subclasses overriding set() after the new value has been published.
+     * When no thread is waiting the cost is limited to two atomic operations, so the lock-free
+     * publication paths are not penalized.
+     */
+    void notifyNewData()
+    {
+        m_generation.fetch_add(1, std::memory_order_release);
+
+        if (m_waiters.load(std::memory_order_acquire) == 0)
+        {
+            return;
+        }
+
+        // the empty critical section guarantees that a waiter that observed a stale generation is
+        // already blocked in the condition variable and will receive the notification
+        {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+        }
+        m_newDataCondition.notify_all();
+    }
+
 public:
     using Ptr = std::shared_ptr<SharedResource<T>>;
 
+    /**
+     * Destructor.
+     */
+    virtual ~SharedResource() = default;
+
     /**
      * Set the resource
      */
-    inline void set(const T& resource);
+    virtual void set(const T& resource);
 
     /**
      * Get the resource.
      * @return the copy of the object inside the shared resource.
      */
-    inline T get() const;
+    virtual T get() const;
+
+    /**
+     * Get the generation counter, i.e. the number of values published with set() so far.
+     * @return the generation counter.
+     */
+    std::uint64_t generation() const;
+
+    /**
+     * Block the calling thread until a value newer than the observed generation is published or
+     * the timeout expires.
+     * @param observedGeneration the generation already consumed by the caller. It is updated with
+     * the current generation before returning, so it can be passed unchanged to the next call.
+     * @param timeout maximum waiting time measured with the system steady clock.
+     * @return true if a new value has been published, false if the timeout expired.
+     */
+    bool waitForNewData(std::uint64_t& observedGeneration, const std::chrono::nanoseconds& timeout) const;
 
     /**
      * Method used to create a shared resource.
@@ -53,8 +114,11 @@ public:
 
 template <class T> void SharedResource<T>::set(const T& resource)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_resource = resource;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_resource = resource;
+    }
+    this->notifyNewData();
 }
 
 template <class T> T SharedResource<T>::get() const
@@ -63,6 +127,30 @@ template <class T> T SharedResource<T>::get() const
     return m_resource;
 }
 
+template <class T> std::uint64_t SharedResource<T>::generation() const
+{
+    return m_generation.load(std::memory_order_acquire);
+}
+
+template <class T>
+bool SharedResource<T>::waitForNewData(std::uint64_t& observedGeneration,
+                                       const std::chrono::nanoseconds& timeout) const
+{
+    const auto hasNewData
+        = [&] { return m_generation.load(std::memory_order_acquire) != observedGeneration; };
+
+    bool newData;
+    {
+        m_waiters.fetch_add(1, std::memory_order_release);
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        newData = m_newDataCondition.wait_for(lock, timeout, hasNewData);
+        m_waiters.fetch_sub(1, std::memory_order_release);
+    }
+
+    observedGeneration = m_generation.load(std::memory_order_acquire);
+    return newData;
+}
+
 template <class T> typename SharedResource<T>::Ptr SharedResource<T>::create()
 {
     return std::shared_ptr<SharedResource<T>>(new SharedResource<T>());
@@ -0,0 +1,69 @@
+/**
+ * @file Stamped.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_STAMPED_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_STAMPED_H
+
+#include <chrono>
+#include <type_traits>
+#include <utility>
+
+#include <BipedalLocomotion/System/Clock.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * Stamped associates an acquisition timestamp to a value exchanged between advanceables. The
+ * timestamp is expressed in the clock domain of BipedalLocomotion::clock(), so samples stamped in
+ * different threads of the same process are directly comparable. Using Stamped as the Input/Output
+ * type of an advanceable (and consequently as the payload of the SharedResource connecting two
+ * AdvanceableRunner) makes the end-to-end latency of a pipeline measurable without per-type
+ * patches: the producer stamps the sample once at acquisition and every consumer can compare the
+ * stamp against the current clock (see LatencyMonitor).
+ */
+template <typename T> struct Stamped
+{
+    using Value = T;
+
+    T value{}; /**< The payload */
+    std::chrono::nanoseconds time{std::chrono::nanoseconds::zero()}; /**< Acquisition time
+                                                                        expressed in the
+                                                                        BipedalLocomotion::clock()
+                                                                        domain */
+
+    Stamped() = default;
+
+    /**
+     * Constructor.
+     * @param value the payload.
+     * @param time the acquisition time.
+     */
+    Stamped(const T& value, const std::chrono::nanoseconds& time)
+        : value(value)
+        , time(time)
+    {
+    }
+};
+
+/**
+ * Build a Stamped object whose acquisition time is the current time of
+ * BipedalLocomotion::clock().
+ * @param value the payload.
+ * @return the stamped value.
+ */
+template <typename T> Stamped<std::decay_t<T>> stampNow(T&& value)
+{
+    return Stamped<std::decay_t<T>>(std::forward<T>(value), BipedalLocomotion::clock().now());
+}
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_STAMPED_H
@@ -0,0 +1,156 @@
+/**
+ * @file StaticTaskStack.h
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_STATIC_TASK_STACK_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_STATIC_TASK_STACK_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/System/LinearTask.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * StaticTaskStack is a task stack composed at compile time. The concrete task types are listed as
+ * template arguments, so the update loop is expanded by the compiler into a sequence of direct
+ * (non virtual) calls that can be inlined and vectorized across task boundaries. It is meant for
+ * deployments where the task list is frozen: the tasks are still registered in an
+ * ILinearTaskSolver with addToSolver() (the solver continues to own the QP assembly), while the
+ * solver per-task virtual update loop is replaced by the devirtualized one through
+ * setExternalTaskUpdater():
+ * \code{.cpp}
+ * StaticTaskStack<IK::SE3Task, IK::CoMTask, IK::JointTrackingTask> stack;
+ * ... // initialize the tasks, e.g. stack.task<0>()->initialize(...)
+ * stack.addToSolver(ik, {{{"se3_task", 0}, {"com_task", 0}, {"joint_tracking_task", 1, weight}}});
+ * ik.setExternalTaskUpdater(stack.updateFunction());
+ * \endcode
+ * @warning The stack must contain every task added to the solver, since the external updater
+ * replaces the solver update loop entirely.
+ */
+template <typename... Tasks> class StaticTaskStack
+{
+    static_assert(sizeof...(Tasks) > 0, "The stack must contain at least one task.");
+    static_assert((std::is_base_of_v<LinearTask, Tasks> && ...),
+                  "All the tasks of the stack must inherit from LinearTask.");
+
+public:
+    static constexpr std::size_t NumberOfTasks = sizeof...(Tasks); /**< Number of tasks. */
+
+    /**
+     * Registration data associated to a task, used by addToSolver().
+     */
+    struct TaskRegistration
+    {
+        std::string name; /**< Unique name associated to the task. */
+        std::size_t priority{0}; /**< Priority associated to the task. */
+        Eigen::VectorXd weight{}; /**< Weight associated to the task. If empty no weight is passed
+                                     to the solver (required when the priority is 0). */
+    };
+
+    /**
+     * Constructor. All the tasks are default constructed.
+     */
+    StaticTaskStack()
+        : m_tasks(std::make_shared<Tasks>()...)
+    {
+    }
+
+    /**
+     * Get the I-th task of the stack.
+     * @return a shared pointer to the concrete task.
+     */
+    template <std::size_t I> const auto& task() const
+    {
+        return std::get<I>(m_tasks);
+    }
+
+    /**
+     * Update the content of all the tasks. The calls are statically dispatched, so the compiler is
+     * free to inline them.
+     * @return true if all the tasks have been updated.
+     */
+    bool update()
+    {
+        return this->updateAll(std::index_sequence_for<Tasks...>{});
+    }
+
+    /**
+     * Get a function running update(). It can be passed to
+     * ILinearTaskSolver::setExternalTaskUpdater() to replace the solver per-task virtual update
+     * loop.
+     * @return a function updating all the tasks of the stack.
+     */
+    std::function<bool()> updateFunction()
+    {
+        return [this]() { return this->update(); };
+    }
+
+    /**
+     * Add all the tasks of the stack to a solver.
+     * @param solver solver implementing the ILinearTaskSolver interface.
+     * @param registrations name, priority and optional weight of each task, in the same order as
+     * the template arguments.
+     * @return true if all the tasks have been added to the solver.
+     */
+    template <class Solver>
+    bool addToSolver(Solver& solver,
+                     const std::array<TaskRegistration, NumberOfTasks>& registrations)
+    {
+        return this->addAll(solver, registrations, std::index_sequence_for<Tasks...>{});
+    }
+
+private:
+    template <std::size_t... I> bool updateAll(std::index_sequence<I...>)
+    {
+        bool ok = true;
+        // the call is qualified with the concrete task type, so it is resolved at compile time
+        ((ok = std::get<I>(m_tasks)->Tasks::update() && ok), ...);
+        return ok;
+    }
+
+    template <class Solver, std::size_t... I>
+    bool addAll(Solver& solver,
+                const std::array<TaskRegistration, NumberOfTasks>& registrations,
+                std::index_sequence<I...>)
+    {
+        bool ok = true;
+        ((ok = this->addOne(solver, std::get<I>(m_tasks), registrations[I]) && ok), ...);
+        return ok;
+    }
+
+    template <class Solver, typename Task>
+    bool addOne(Solver& solver,
+                const std::shared_ptr<Task>& task,
+                const TaskRegistration& registration)
+    {
+        if (registration.weight.size() == 0)
+        {
+            return solver.addTask(task, registration.name, registration.priority);
+        }
+
+        return solver.addTask(task, registration.name, registration.priority, registration.weight);
+    }
+
+    std::tuple<std::shared_ptr<Tasks>...> m_tasks; /**< Concrete tasks of the stack. */
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_STATIC_TASK_STACK_H
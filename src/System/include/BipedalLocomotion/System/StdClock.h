@@ -10,6 +10,7 @@
 
 #include <BipedalLocomotion/System/IClock.h>
 
+#include <atomic>
 #include <chrono>
 
 namespace BipedalLocomotion
@@ -29,6 +30,19 @@ namespace System
  * auto end = BipedalLocomotion::clock().now();
  * std::chrono::duration<double, std::milli> elapsed = end-start;
  * \endcode
+ *
+ * The sleep functions implement an optional hybrid strategy: the thread sleeps until a guard
+ * interval before the deadline and then spins on the clock for the remaining time. This reduces
+ * the wake-up jitter of the kernel (in general between 50 µs and 150 µs) to a few µs at the cost
+ * of burning CPU cycles during the guard interval. The guard interval can be set through the
+ * StdClockFactory, for instance
+ * \code{.cpp}
+ * using namespace std::chrono_literals;
+ * BipedalLocomotion::System::ClockBuilder::setFactory(
+ *     std::make_shared<BipedalLocomotion::System::StdClockFactory>(500us));
+ * \endcode
+ * By default the guard interval is zero and the sleep functions entirely rely on
+ * std::this_thread::sleep_for().
  */
 class StdClock final : public IClock
 {
@@ -44,14 +58,16 @@ public:
     /**
      * Blocks the execution of the current thread for at least the specified sleepDuration.
      * @param time duration to sleep
-     * @note std::this_tread::sleep_for() function is used.
+     * @note std::this_tread::sleep_for() function is used. If the sleep guard interval is
+     * different from zero the hybrid sleep strategy is applied.
      */
     void sleepFor(const std::chrono::nanoseconds& sleepDuration) final;
 
     /**
      * Blocks the execution of the current thread until specified sleepTime has been reached.
      * @param time to block until
-     * @note sleepTime is the duration since epoch
+     * @note sleepTime is the duration since epoch. If the sleep guard interval is different from
+     * zero the hybrid sleep strategy is applied.
      */
     void sleepUntil(const std::chrono::nanoseconds& sleepTime) final;
 
@@ -60,16 +76,39 @@ public:
      * threads to run.
      */
     void yield() final;
+
+    /**
+     * Set the guard interval of the hybrid sleep strategy. The sleep functions sleep until the
+     * guard interval before the deadline and then spin on the clock for the remaining time.
+     * @param guardInterval guard interval. If zero (default) the spin phase is disabled.
+     */
+    void setSleepGuardInterval(const std::chrono::nanoseconds& guardInterval);
+
+private:
+    std::atomic<std::chrono::nanoseconds> m_sleepGuardInterval{
+        std::chrono::nanoseconds::zero()}; /**< Guard interval of the hybrid sleep strategy */
 };
 
 class StdClockFactory final : public ClockFactory
 {
 public:
+    /**
+     * Construct the factory.
+     * @param sleepGuardInterval guard interval of the hybrid sleep strategy applied by the clock.
+     * If zero (default) the sleep functions entirely rely on std::this_thread::sleep_for().
+     */
+    StdClockFactory(
+        const std::chrono::nanoseconds& sleepGuardInterval = std::chrono::nanoseconds::zero());
+
     /**
      * Create the std clock as a singleton
      * @return the reference to a System::StdClock
      */
     IClock& createClock() final;
+
+private:
+    std::chrono::nanoseconds m_sleepGuardInterval; /**< Guard interval of the hybrid sleep
+                                                      strategy */
 };
 
 } // namespace System
@@ -0,0 +1,48 @@
+/**
+ * @file ThreadUtilities.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_THREAD_UTILITIES_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_THREAD_UTILITIES_H
+
+#include <string>
+#include <vector>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * Set the name of the calling thread. The name is visible in the system tools (e.g. htop, gdb).
+ * @param name desired name. On Linux the kernel truncates it to 15 characters.
+ * @return true in case of success, false otherwise. On platforms where the feature is not
+ * supported the function returns false.
+ */
+bool setNameOfCallingThread(const std::string& name);
+
+/**
+ * Enable the SCHED_FIFO real-time scheduling policy for the calling thread.
+ * @param priority desired priority. It must be in the range given by the scheduler (on Linux from
+ * 1 to 99).
+ * @return true in case of success, false otherwise. Please notice that raising the priority
+ * usually requires appropriate permissions (e.g. the rtprio limit on Linux). On platforms where
+ * the feature is not supported the function returns false.
+ */
+bool setRealTimePriorityOfCallingThread(int priority);
+
+/**
+ * Pin the calling thread to a given set of CPUs.
+ * @param cpus indices of the CPUs the thread is allowed to run on. It must not be empty.
+ * @return true in case of success, false otherwise. On platforms where the feature is not
+ * supported the function returns false.
+ */
+bool setAffinityOfCallingThread(const std::vector<int>& cpus);
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_THREAD_UTILITIES_H
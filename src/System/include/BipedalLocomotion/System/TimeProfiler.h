@@ -0,0 +1,212 @@
+/**
+ * @file TimeProfiler.h
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_TIME_PROFILER_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_TIME_PROFILER_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * TimeProfiler is a lightweight profiler designed to time the internal phases of an advanceable
+ * block (e.g. the task update and the QP solve of a solver). Each phase is represented by a named
+ * section that must be registered once, at configuration time, with
+ * TimeProfiler::registerSection(). The duration of a section is measured with the RAII helper
+ * TimeProfiler::ScopedTimer (or with the BLF_SCOPED_PROFILER macro) and stored in a preallocated
+ * ring buffer, so the hot path performs no memory allocation and no locking. The recorded samples
+ * can be retrieved as aggregate statistics or as raw durations to build histograms.
+ * @note The profiler is not thread-safe. Each advanceable block owns its profiler and the sections
+ * are expected to be timed from the thread calling advance().
+ */
+class TimeProfiler
+{
+public:
+    /**
+     * Index returned by registerSection() and getSectionIndex() when the section is not valid.
+     */
+    static constexpr std::ptrdiff_t InvalidSectionIndex = -1;
+
+    /**
+     * Aggregate statistics associated to a section.
+     */
+    struct SectionStatistics
+    {
+        std::string name; /**< Name of the section. */
+        std::chrono::nanoseconds latest{std::chrono::nanoseconds::zero()}; /**< Most recent
+                                                                              duration. */
+        std::chrono::nanoseconds min{std::chrono::nanoseconds::zero()}; /**< Minimum duration among
+                                                                           the stored samples. */
+        std::chrono::nanoseconds max{std::chrono::nanoseconds::zero()}; /**< Maximum duration among
+                                                                           the stored samples. */
+        std::chrono::nanoseconds average{std::chrono::nanoseconds::zero()}; /**< Average duration
+                                                                               of the stored
+                                                                               samples. */
+        std::size_t samples{0}; /**< Number of samples currently stored in the ring buffer. */
+    };
+
+    /**
+     * ScopedTimer is an RAII object that measures the time elapsed between its construction and
+     * its destruction and records it in the associated section of the profiler.
+     */
+    class ScopedTimer
+    {
+    public:
+        /**
+         * Constructor. The timer starts.
+         * @param profiler profiler where the duration is recorded.
+         * @param sectionIndex index of the section returned by TimeProfiler::registerSection(). If
+         * the index is not valid nothing is recorded.
+         */
+        ScopedTimer(TimeProfiler& profiler, std::ptrdiff_t sectionIndex)
+            : m_profiler(profiler)
+            , m_sectionIndex(sectionIndex)
+            , m_start(std::chrono::steady_clock::now())
+        {
+        }
+
+        /**
+         * Destructor. The timer stops and the duration is recorded.
+         */
+        ~ScopedTimer()
+        {
+            this->m_profiler.record(m_sectionIndex, std::chrono::steady_clock::now() - m_start);
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer(ScopedTimer&&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(ScopedTimer&&) = delete;
+
+    private:
+        TimeProfiler& m_profiler; /**< Profiler where the duration is recorded. */
+        std::ptrdiff_t m_sectionIndex; /**< Index of the associated section. */
+        std::chrono::steady_clock::time_point m_start; /**< Time point of the construction. */
+    };
+
+    /**
+     * Register a new section. The ring buffer associated to the section is allocated here, the
+     * following calls to record() do not allocate memory.
+     * @param name name of the section.
+     * @param capacity number of samples stored in the ring buffer. When the buffer is full the
+     * oldest sample is overwritten.
+     * @return the index associated to the section in case of success, InvalidSectionIndex if the
+     * name is already taken or the capacity is equal to zero.
+     */
+    std::ptrdiff_t registerSection(const std::string& name, std::size_t capacity = 1024);
+
+    /**
+     * Get the index associated to an already registered section.
+     * @param name name of the section.
+     * @return the index of the section, InvalidSectionIndex if the section does not exist.
+     */
+    std::ptrdiff_t getSectionIndex(const std::string& name) const;
+
+    /**
+     * Get the names of the registered sections.
+     * @return a vector containing the names of the sections.
+     */
+    std::vector<std::string> getSectionNames() const;
+
+    /**
+     * Get the aggregate statistics associated to a section.
+     * @param name name of the section.
+     * @param statistics statistics of the section.
+     * @return true in case of success, false if the section does not exist.
+     */
+    bool getSectionStatistics(const std::string& name, SectionStatistics& statistics) const;
+
+    /**
+     * Get the raw durations stored in the ring buffer of a section, ordered from the oldest to the
+     * most recent. This can be used to build histograms of the section duration.
+     * @param name name of the section.
+     * @param samples vector filled with the stored durations.
+     * @return true in case of success, false if the section does not exist.
+     */
+    bool getSectionSamples(const std::string& name,
+                           std::vector<std::chrono::nanoseconds>& samples) const;
+
+    /**
+     * Record a duration in a section. This method is automatically called by ScopedTimer.
+     * @param sectionIndex index of the section returned by registerSection(). If the index is not
+     * valid nothing is recorded.
+     * @param duration duration to record.
+     */
+    void record(std::ptrdiff_t sectionIndex, const std::chrono::nanoseconds& duration)
+    {
+        if (sectionIndex < 0 || static_cast<std::size_t>(sectionIndex) >= m_sections.size())
+        {
+            return;
+        }
+
+        Section& section = m_sections[sectionIndex];
+        section.buffer[section.head] = duration;
+        section.head = (section.head + 1) % section.buffer.size();
+        if (section.count < section.buffer.size())
+        {
+            section.count++;
+        }
+    }
+
+    /**
+     * Remove all the samples stored in the ring buffers. The registered sections are kept.
+     */
+    void clearSamples();
+
+    /**
+     * Return a string containing the statistics of all the registered sections.
+     * @return a string containing the description of the profiler.
+     */
+    std::string toString() const;
+
+private:
+    /**
+     * Internal description of a section.
+     */
+    struct Section
+    {
+        std::string name; /**< Name of the section. */
+        std::vector<std::chrono::nanoseconds> buffer; /**< Preallocated ring buffer. */
+        std::size_t head{0}; /**< Index of the next sample to overwrite. */
+        std::size_t count{0}; /**< Number of valid samples in the buffer. */
+    };
+
+    std::vector<Section> m_sections; /**< Registered sections. */
+    std::unordered_map<std::string, std::size_t> m_indices; /**< Map from the section name to its
+                                                               index in m_sections. */
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+/**
+ * BLF_SCOPED_PROFILER instantiates a TimeProfiler::ScopedTimer measuring the current scope. The
+ * macro expands to nothing when BLF_PROFILER_ENABLED is not defined (the default), so the
+ * instrumentation can be entirely removed at compile time. The profiler can be enabled with the
+ * FRAMEWORK_ENABLE_PROFILER CMake option.
+ */
+#ifdef BLF_PROFILER_ENABLED
+#define BLF_PROFILER_CONCAT_IMPL(x, y) x##y
+#define BLF_PROFILER_CONCAT(x, y) BLF_PROFILER_CONCAT_IMPL(x, y)
+#define BLF_SCOPED_PROFILER(profiler, sectionIndex)                                 \
+    ::BipedalLocomotion::System::TimeProfiler::ScopedTimer                          \
+        BLF_PROFILER_CONCAT(blfScopedTimer, __LINE__)(profiler, sectionIndex)
+#else
+#define BLF_SCOPED_PROFILER(profiler, sectionIndex) \
+    do                                              \
+    {                                               \
+    } while (false)
+#endif
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_TIME_PROFILER_H
@@ -12,6 +12,7 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 
@@ -51,12 +52,38 @@ public:
         friend class VariablesHandler;
     };
 
+    /**
+     * VariableHandle is an interned reference to a variable stored in the handler. The handle is
+     * resolved once, with VariablesHandler::getVariableHandle(), and the associated description is
+     * then retrieved with a plain bounds-checked array access, avoiding the string hashing
+     * performed by the name based getters. It is useful when a variable must be accessed
+     * repeatedly in a hot loop.
+     * @warning A handle is invalidated when the handler is cleared or re-initialized.
+     */
+    struct VariableHandle
+    {
+        static constexpr std::ptrdiff_t InvalidIndex{-1};
+        std::ptrdiff_t index{InvalidIndex}; /**< Index of the variable in the handler. */
+
+        /**
+         * Check if the handle is valid.
+         * @return true if the handle refers to a variable.
+         */
+        bool isValid() const;
+    };
+
 private:
-    std::unordered_map<std::string, VariableDescription> m_variables; /**< Map containing the name
-                                                                         of a variable and its
-                                                                         index range */
+    std::vector<VariableDescription> m_variables; /**< Descriptions of the variables stored in
+                                                     insertion order. */
+    std::unordered_map<std::string, std::size_t> m_variablesNameMap; /**< Map containing the name
+                                                                        of a variable and its index
+                                                                        in m_variables */
     std::size_t m_numberOfVariables{0}; /**< Total number of Variable seen as scalar */
 
+    std::vector<std::pair<std::size_t, std::size_t>> m_couplings; /**< Pairs of indices of coupled
+                                                                     variables declared with
+                                                                     declareVariablesCoupling() */
+
     /**
      * An invalid variable
      */
@@ -121,6 +148,49 @@ public:
      */
     bool getVariable(const std::string& name, VariableDescription& description) const noexcept;
 
+    /**
+     * Get the handle associated to a variable. The handle can be used to retrieve the variable
+     * description without any string lookup.
+     * @param name of the variable
+     * @return the handle associated to the variable. If the variable does not exist an invalid
+     * handle is returned.
+     */
+    VariableHandle getVariableHandle(const std::string& name) const noexcept;
+
+    /**
+     * Get a variable from the list given its handle. This is a bounds-checked array access, no
+     * string hashing is involved.
+     * @param handle handle of the variable returned by getVariableHandle()
+     * @return the variable description associated to the handle. If the handle is not valid an
+     * invalid description is returned.
+     */
+    const VariableDescription& getVariable(const VariableHandle& handle) const noexcept;
+
+    /**
+     * Declare a coupling between two variables. The couplings describe which variables appear
+     * together in the constraints or in the cost of the optimization problem (e.g. the joint
+     * accelerations and the contact wrenches coupled by the dynamics constraint). They are
+     * exploited by optimizeOrdering() to place coupled variables close to each other.
+     * @param firstVariable name of the first variable.
+     * @param secondVariable name of the second variable.
+     * @note both variables must be already added to the handler.
+     * @return true/false in case of success/failure
+     */
+    bool declareVariablesCoupling(const std::string& firstVariable,
+                                  const std::string& secondVariable) noexcept;
+
+    /**
+     * Reorder the variables so that coupled variables are close to each other, reducing the
+     * bandwidth of the matrices assembled on top of the handler layout (e.g. the KKT matrix of a
+     * QP). The permutation is computed with the reverse Cuthill-McKee algorithm on the coupling
+     * graph declared through declareVariablesCoupling() and is applied by reassigning the variable
+     * offsets, so it is completely transparent to the code using the offset based API.
+     * @warning This method should be called after all the variables have been added and before
+     * any offset is read, since the previously read offsets are invalidated.
+     * @return true/false in case of success/failure
+     */
+    bool optimizeOrdering() noexcept;
+
     /**
      * Get the number of variables
      * @return the total number of variables
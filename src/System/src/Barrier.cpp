@@ -5,36 +5,150 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <mutex>
 
 #include <BipedalLocomotion/System/Barrier.h>
+#include <BipedalLocomotion/System/Clock.h>
 
 using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion;
+
+namespace
+{
+/** Time spent spinning on the generation counter before falling back to the condition variable */
+constexpr std::chrono::microseconds spinBudget{100};
+} // namespace
 
 Barrier::Barrier(const std::size_t counter)
     : m_initialCount(counter)
     , m_count(counter)
-    , m_generation(0)
 {
 }
 
+void Barrier::completePhase()
+{
+    // the generation is advanced while holding the mutex so that a thread sleeping on the
+    // condition variable cannot miss the notification
+    {
+        std::lock_guard lock{m_mutex};
+        m_count.store(m_initialCount, std::memory_order_relaxed);
+        m_releaseBegin.store(clock().now().count(), std::memory_order_relaxed);
+        m_releaseSpread.store(0, std::memory_order_relaxed);
+        m_generation.fetch_add(1, std::memory_order_release);
+    }
+    m_cond.notify_all();
+}
+
+void Barrier::recordRelease()
+{
+    const std::chrono::nanoseconds::rep spread
+        = clock().now().count() - m_releaseBegin.load(std::memory_order_relaxed);
+
+    std::chrono::nanoseconds::rep current = m_releaseSpread.load(std::memory_order_relaxed);
+    while (spread > current
+           && !m_releaseSpread.compare_exchange_weak(current, spread, std::memory_order_relaxed))
+    {
+    }
+}
+
+std::chrono::nanoseconds Barrier::releaseSpread() const
+{
+    return std::chrono::nanoseconds(m_releaseSpread.load(std::memory_order_relaxed));
+}
+
 void Barrier::wait()
 {
-    std::unique_lock lock{m_mutex};
-    const auto tempGeneration = m_generation;
-    if ((--m_count) == 1)
+    const std::size_t generation = m_generation.load(std::memory_order_acquire);
+
+    if (m_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
     {
-        // all threads reached the barrier, so we can consider them synchronized
-        m_generation++;
+        // all the threads reached the barrier, so we can consider them synchronized
+        this->completePhase();
+        this->recordRelease();
+        return;
+    }
 
-        // reset the counter
-        m_count = m_initialCount;
+    // spin on the generation counter to keep the wake-up spread between the threads small
+    const std::chrono::nanoseconds spinDeadline = clock().now() + spinBudget;
+    while (clock().now() < spinDeadline)
+    {
+        if (m_generation.load(std::memory_order_acquire) != generation)
+        {
+            this->recordRelease();
+            return;
+        }
+    }
+
+    // the other threads are late, stop burning CPU and sleep on the condition variable
+    {
+        std::unique_lock lock{m_mutex};
+        m_cond.wait(lock, [this, generation] {
+            return m_generation.load(std::memory_order_acquire) != generation;
+        });
+    }
+    this->recordRelease();
+}
+
+bool Barrier::waitFor(const std::chrono::nanoseconds& timeout)
+{
+    const std::chrono::nanoseconds deadline = clock().now() + timeout;
+    const std::size_t generation = m_generation.load(std::memory_order_acquire);
+
+    if (m_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // all the threads reached the barrier, so we can consider them synchronized
+        this->completePhase();
+        this->recordRelease();
+        return true;
+    }
 
-        // notify the other threads
-        m_cond.notify_all();
-    } else
+    // spin on the generation counter to keep the wake-up spread between the threads small
+    const std::chrono::nanoseconds spinDeadline = std::min(deadline, clock().now() + spinBudget);
+    while (clock().now() < spinDeadline)
     {
-        // waiting for the other threads
-        m_cond.wait(lock, [this, tempGeneration] { return tempGeneration != m_generation; });
+        if (m_generation.load(std::memory_order_acquire) != generation)
+        {
+            this->recordRelease();
+            return true;
+        }
     }
+
+    std::unique_lock lock{m_mutex};
+    const bool completed = m_cond.wait_for(lock, deadline - clock().now(), [this, generation] {
+        return m_generation.load(std::memory_order_acquire) != generation;
+    });
+
+    if (completed)
+    {
+        lock.unlock();
+        this->recordRelease();
+        return true;
+    }
+
+    // the timeout expired: give the token back so that the barrier remains usable by the other
+    // threads. The compare and exchange guarantees that the token is restored only if the phase
+    // completion is not already in flight, i.e., if the counter did not reach zero
+    std::size_t current = m_count.load(std::memory_order_relaxed);
+    while (current != 0)
+    {
+        if (m_count.compare_exchange_weak(current,
+                                          current + 1,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed))
+        {
+            return false;
+        }
+    }
+
+    // the counter reached zero, so the last thread is completing the phase. This thread has been
+    // counted, hence it must leave the barrier as synchronized
+    m_cond.wait(lock, [this, generation] {
+        return m_generation.load(std::memory_order_acquire) != generation;
+    });
+    lock.unlock();
+    this->recordRelease();
+    return true;
 }
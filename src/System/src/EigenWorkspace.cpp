@@ -0,0 +1,90 @@
+/**
+ * @file EigenWorkspace.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+
+#include <BipedalLocomotion/System/EigenWorkspace.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::System;
+
+bool EigenWorkspace::reserve(std::size_t capacity)
+{
+    constexpr auto logPrefix = "[EigenWorkspace::reserve]";
+
+    if (m_used != 0 || m_overflowSize != 0)
+    {
+        log()->error("{} Unable to reserve the arena while there are outstanding checkouts. "
+                     "Please call reset() first.",
+                     logPrefix);
+        return false;
+    }
+
+    m_arena.resize(std::max(capacity, m_arena.size()));
+    return true;
+}
+
+Eigen::Map<Eigen::MatrixXd> EigenWorkspace::matrix(Eigen::Index rows, Eigen::Index cols)
+{
+    double* data = this->checkout(static_cast<std::size_t>(rows) * static_cast<std::size_t>(cols));
+    return Eigen::Map<Eigen::MatrixXd>(data, rows, cols);
+}
+
+Eigen::Map<Eigen::VectorXd> EigenWorkspace::vector(Eigen::Index size)
+{
+    double* data = this->checkout(static_cast<std::size_t>(size));
+    return Eigen::Map<Eigen::VectorXd>(data, size);
+}
+
+double* EigenWorkspace::checkout(std::size_t size)
+{
+    constexpr auto logPrefix = "[EigenWorkspace::checkout]";
+
+    if (m_used + size <= m_arena.size())
+    {
+        double* data = m_arena.data() + m_used;
+        m_used += size;
+        return data;
+    }
+
+    // the arena is exhausted: the chunk is served from an overflow block. The arena grows to the
+    // peak requirement at the next reset()
+    if (!m_overflowWarningPrinted)
+    {
+        log()->warn("{} The arena capacity ({}) has been exceeded. Please consider reserving a "
+                    "bigger workspace to avoid hot-path allocations.",
+                    logPrefix,
+                    m_arena.size());
+        m_overflowWarningPrinted = true;
+    }
+
+    m_overflow.push_back(std::make_unique<double[]>(size));
+    m_overflowSize += size;
+    return m_overflow.back().get();
+}
+
+void EigenWorkspace::reset()
+{
+    if (!m_overflow.empty())
+    {
+        m_arena.resize(m_used + m_overflowSize);
+        m_overflow.clear();
+        m_overflowSize = 0;
+    }
+
+    m_used = 0;
+}
+
+std::size_t EigenWorkspace::capacity() const
+{
+    return m_arena.size();
+}
+
+std::size_t EigenWorkspace::used() const
+{
+    return m_used + m_overflowSize;
+}
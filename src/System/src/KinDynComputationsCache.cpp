@@ -0,0 +1,187 @@
+/**
+ * @file KinDynComputationsCache.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <iDynTree/Core/EigenHelpers.h>
+
+#include <BipedalLocomotion/System/KinDynComputationsCache.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion;
+
+struct KinDynComputationsCache::Impl
+{
+    /** A cached quantity together with the state generation at which it has been computed. */
+    template <typename T> struct Entry
+    {
+        T value;
+        std::uint64_t generation{0};
+        bool isValid{false}; /**< True if the entry has been computed at least once. */
+
+        /** True if the entry is up to date with the given state generation. */
+        bool isFresh(std::uint64_t currentGeneration) const
+        {
+            return this->isValid && (this->generation == currentGeneration);
+        }
+    };
+
+    std::shared_ptr<iDynTree::KinDynComputations> kinDyn;
+    std::uint64_t generation{1}; /**< Robot state generation counter. It starts from 1 so that the
+                                    default constructed entries are stale. */
+
+    Entry<Eigen::Vector3d> comPosition;
+    Entry<Eigen::Vector3d> comVelocity;
+    Entry<Eigen::Vector3d> comBiasAcc;
+    Entry<Eigen::MatrixXd> comJacobian;
+    Entry<Eigen::MatrixXd> massMatrix;
+    std::unordered_map<iDynTree::FrameIndex, Entry<Eigen::MatrixXd>> frameJacobians;
+};
+
+KinDynComputationsCache::KinDynComputationsCache()
+    : m_pimpl(std::make_unique<Impl>())
+{
+}
+
+KinDynComputationsCache::~KinDynComputationsCache() = default;
+
+bool KinDynComputationsCache::setKinDyn(std::shared_ptr<iDynTree::KinDynComputations> kinDyn)
+{
+    constexpr auto logPrefix = "[KinDynComputationsCache::setKinDyn]";
+
+    if ((kinDyn == nullptr) || (!kinDyn->isValid()))
+    {
+        log()->error("{} Invalid kinDyn object.", logPrefix);
+        return false;
+    }
+
+    m_pimpl->kinDyn = kinDyn;
+
+    const std::size_t generalizedVelocitySize = kinDyn->getNrOfDegreesOfFreedom() + 6;
+    m_pimpl->comJacobian.value.resize(3, generalizedVelocitySize);
+    m_pimpl->massMatrix.value.resize(generalizedVelocitySize, generalizedVelocitySize);
+    m_pimpl->frameJacobians.clear();
+
+    this->advanceStateGeneration();
+
+    return true;
+}
+
+std::shared_ptr<iDynTree::KinDynComputations> KinDynComputationsCache::kinDyn() const
+{
+    return m_pimpl->kinDyn;
+}
+
+void KinDynComputationsCache::advanceStateGeneration()
+{
+    m_pimpl->generation++;
+}
+
+const Eigen::Vector3d& KinDynComputationsCache::getCenterOfMassPosition()
+{
+    auto& entry = m_pimpl->comPosition;
+    if (!entry.isFresh(m_pimpl->generation))
+    {
+        entry.value = iDynTree::toEigen(m_pimpl->kinDyn->getCenterOfMassPosition());
+        entry.generation = m_pimpl->generation;
+        entry.isValid = true;
+    }
+
+    return entry.value;
+}
+
+const Eigen::Vector3d& KinDynComputationsCache::getCenterOfMassVelocity()
+{
+    auto& entry = m_pimpl->comVelocity;
+    if (!entry.isFresh(m_pimpl->generation))
+    {
+        entry.value = iDynTree::toEigen(m_pimpl->kinDyn->getCenterOfMassVelocity());
+        entry.generation = m_pimpl->generation;
+        entry.isValid = true;
+    }
+
+    return entry.value;
+}
+
+const Eigen::Vector3d& KinDynComputationsCache::getCenterOfMassBiasAcc()
+{
+    auto& entry = m_pimpl->comBiasAcc;
+    if (!entry.isFresh(m_pimpl->generation))
+    {
+        entry.value = iDynTree::toEigen(m_pimpl->kinDyn->getCenterOfMassBiasAcc());
+        entry.generation = m_pimpl->generation;
+        entry.isValid = true;
+    }
+
+    return entry.value;
+}
+
+bool KinDynComputationsCache::getCenterOfMassJacobian(Eigen::MatrixXd& comJacobian)
+{
+    constexpr auto logPrefix = "[KinDynComputationsCache::getCenterOfMassJacobian]";
+
+    auto& entry = m_pimpl->comJacobian;
+    if (!entry.isFresh(m_pimpl->generation))
+    {
+        if (!m_pimpl->kinDyn->getCenterOfMassJacobian(entry.value))
+        {
+            log()->error("{} Unable to get the center of mass jacobian.", logPrefix);
+            return false;
+        }
+        entry.generation = m_pimpl->generation;
+        entry.isValid = true;
+    }
+
+    comJacobian = entry.value;
+    return true;
+}
+
+bool KinDynComputationsCache::getFreeFloatingMassMatrix(Eigen::MatrixXd& massMatrix)
+{
+    constexpr auto logPrefix = "[KinDynComputationsCache::getFreeFloatingMassMatrix]";
+
+    auto& entry = m_pimpl->massMatrix;
+    if (!entry.isFresh(m_pimpl->generation))
+    {
+        if (!m_pimpl->kinDyn->getFreeFloatingMassMatrix(entry.value))
+        {
+            log()->error("{} Unable to get the mass matrix.", logPrefix);
+            return false;
+        }
+        entry.generation = m_pimpl->generation;
+        entry.isValid = true;
+    }
+
+    massMatrix = entry.value;
+    return true;
+}
+
+bool KinDynComputationsCache::getFrameFreeFloatingJacobian(const iDynTree::FrameIndex& frameIndex,
+                                                           Eigen::MatrixXd& jacobian)
+{
+    constexpr auto logPrefix = "[KinDynComputationsCache::getFrameFreeFloatingJacobian]";
+
+    auto& entry = m_pimpl->frameJacobians[frameIndex];
+    if (!entry.isFresh(m_pimpl->generation))
+    {
+        entry.value.resize(6, m_pimpl->kinDyn->getNrOfDegreesOfFreedom() + 6);
+        if (!m_pimpl->kinDyn->getFrameFreeFloatingJacobian(frameIndex, entry.value))
+        {
+            log()->error("{} Unable to get the jacobian of the frame with index {}.",
+                         logPrefix,
+                         frameIndex);
+            return false;
+        }
+        entry.generation = m_pimpl->generation;
+        entry.isValid = true;
+    }
+
+    jacobian = entry.value;
+    return true;
+}
@@ -0,0 +1,159 @@
+/**
+ * @file KinDynComputationsPool.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <vector>
+
+#include <BipedalLocomotion/System/KinDynComputationsPool.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion;
+
+struct KinDynComputationsPool::Impl
+{
+    std::vector<std::shared_ptr<iDynTree::KinDynComputations>> slots;
+    std::uint64_t generation{0}; /**< Robot state generation. It is equal to 0 until the first
+                                    freeze() call. */
+
+    /** Buffers used by freeze() to transfer the robot state from the source to the slots. */
+    Eigen::Matrix4d worldTBase;
+    Eigen::VectorXd jointPositions;
+    Eigen::Matrix<double, 6, 1> baseVelocity;
+    Eigen::VectorXd jointVelocities;
+    Eigen::Vector3d gravity;
+};
+
+KinDynComputationsPool::KinDynComputationsPool()
+    : m_pimpl(std::make_unique<Impl>())
+{
+}
+
+KinDynComputationsPool::~KinDynComputationsPool() = default;
+
+bool KinDynComputationsPool::initialize(const iDynTree::Model& model, std::size_t numberOfSlots)
+{
+    constexpr auto logPrefix = "[KinDynComputationsPool::initialize]";
+
+    if (numberOfSlots == 0)
+    {
+        log()->error("{} The number of slots must be strictly positive.", logPrefix);
+        return false;
+    }
+
+    m_pimpl->slots.clear();
+    m_pimpl->slots.reserve(numberOfSlots);
+    for (std::size_t index = 0; index < numberOfSlots; index++)
+    {
+        auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+        if (!kinDyn->loadRobotModel(model))
+        {
+            log()->error("{} Unable to load the model in the slot number {}.", logPrefix, index);
+            m_pimpl->slots.clear();
+            return false;
+        }
+        m_pimpl->slots.push_back(std::move(kinDyn));
+    }
+
+    m_pimpl->jointPositions.resize(model.getNrOfDOFs());
+    m_pimpl->jointVelocities.resize(model.getNrOfDOFs());
+    m_pimpl->generation = 0;
+
+    return true;
+}
+
+bool KinDynComputationsPool::freeze(iDynTree::KinDynComputations& source)
+{
+    constexpr auto logPrefix = "[KinDynComputationsPool::freeze]";
+
+    if (m_pimpl->slots.empty())
+    {
+        log()->error("{} The pool is not initialized. Please call initialize().", logPrefix);
+        return false;
+    }
+
+    if (source.getNrOfDegreesOfFreedom() != m_pimpl->slots.front()->getNrOfDegreesOfFreedom())
+    {
+        log()->error("{} The source object and the slots do not share the same number of degrees "
+                     "of freedom.",
+                     logPrefix);
+        return false;
+    }
+
+    if (!source.getRobotState(m_pimpl->worldTBase,
+                              m_pimpl->jointPositions,
+                              m_pimpl->baseVelocity,
+                              m_pimpl->jointVelocities,
+                              m_pimpl->gravity))
+    {
+        log()->error("{} Unable to get the robot state from the source object.", logPrefix);
+        return false;
+    }
+
+    const auto representation = source.getFrameVelocityRepresentation();
+    for (auto& slot : m_pimpl->slots)
+    {
+        if (!slot->setFrameVelocityRepresentation(representation))
+        {
+            log()->error("{} Unable to set the frame velocity representation of a slot.",
+                         logPrefix);
+            return false;
+        }
+    }
+
+    return this->freeze(m_pimpl->worldTBase,
+                        m_pimpl->jointPositions,
+                        m_pimpl->baseVelocity,
+                        m_pimpl->jointVelocities,
+                        m_pimpl->gravity);
+}
+
+bool KinDynComputationsPool::freeze(const Eigen::Matrix4d& worldTBase,
+                                    Eigen::Ref<const Eigen::VectorXd> jointPositions,
+                                    Eigen::Ref<const Eigen::Matrix<double, 6, 1>> baseVelocity,
+                                    Eigen::Ref<const Eigen::VectorXd> jointVelocities,
+                                    Eigen::Ref<const Eigen::Vector3d> gravity)
+{
+    constexpr auto logPrefix = "[KinDynComputationsPool::freeze]";
+
+    if (m_pimpl->slots.empty())
+    {
+        log()->error("{} The pool is not initialized. Please call initialize().", logPrefix);
+        return false;
+    }
+
+    for (auto& slot : m_pimpl->slots)
+    {
+        if (!slot->setRobotState(worldTBase, jointPositions, baseVelocity, jointVelocities, gravity))
+        {
+            log()->error("{} Unable to set the robot state of a slot.", logPrefix);
+            return false;
+        }
+    }
+
+    m_pimpl->generation++;
+    return true;
+}
+
+std::size_t KinDynComputationsPool::size() const
+{
+    return m_pimpl->slots.size();
+}
+
+std::shared_ptr<iDynTree::KinDynComputations> KinDynComputationsPool::slot(std::size_t index) const
+{
+    if (index >= m_pimpl->slots.size())
+    {
+        return nullptr;
+    }
+
+    return m_pimpl->slots[index];
+}
+
+std::uint64_t KinDynComputationsPool::generation() const
+{
+    return m_pimpl->generation;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file LatencyMonitor.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cassert>
+#include <sstream>
+
+#include <BipedalLocomotion/System/Clock.h>
+#include <BipedalLocomotion/System/LatencyMonitor.h>
+
+using namespace BipedalLocomotion::System;
+
+std::ptrdiff_t LatencyMonitor::registerHop(const std::string& name, std::size_t capacity)
+{
+    const std::ptrdiff_t latencyIndex = m_latency.registerSection(name, capacity);
+    if (latencyIndex == TimeProfiler::InvalidSectionIndex)
+    {
+        return InvalidHopIndex;
+    }
+
+    // the indices of the two profilers are kept aligned
+    const std::ptrdiff_t interArrivalIndex = m_interArrival.registerSection(name, capacity);
+    assert(latencyIndex == interArrivalIndex);
+    static_cast<void>(interArrivalIndex);
+
+    m_hops.emplace_back();
+    return latencyIndex;
+}
+
+std::ptrdiff_t LatencyMonitor::getHopIndex(const std::string& name) const
+{
+    return m_latency.getSectionIndex(name);
+}
+
+void LatencyMonitor::record(std::ptrdiff_t hopIndex,
+                            const std::chrono::nanoseconds& acquisitionTime)
+{
+    if (hopIndex < 0 || static_cast<std::size_t>(hopIndex) >= m_hops.size())
+    {
+        return;
+    }
+
+    Hop& hop = m_hops[hopIndex];
+
+    // the consumer may poll the shared resource faster than the producer. A sample already
+    // recorded is ignored
+    if (hop.hasSample && acquisitionTime == hop.lastAcquisitionTime)
+    {
+        return;
+    }
+
+    const std::chrono::nanoseconds arrivalTime = BipedalLocomotion::clock().now();
+    m_latency.record(hopIndex, arrivalTime - acquisitionTime);
+
+    if (hop.hasSample)
+    {
+        m_interArrival.record(hopIndex, arrivalTime - hop.lastArrivalTime);
+    }
+
+    hop.lastAcquisitionTime = acquisitionTime;
+    hop.lastArrivalTime = arrivalTime;
+    hop.hasSample = true;
+}
+
+bool LatencyMonitor::getLatencyStatistics(const std::string& name,
+                                          TimeProfiler::SectionStatistics& statistics) const
+{
+    return m_latency.getSectionStatistics(name, statistics);
+}
+
+bool LatencyMonitor::getInterArrivalStatistics(const std::string& name,
+                                               TimeProfiler::SectionStatistics& statistics) const
+{
+    return m_interArrival.getSectionStatistics(name, statistics);
+}
+
+bool LatencyMonitor::getLatencySamples(const std::string& name,
+                                       std::vector<std::chrono::nanoseconds>& samples) const
+{
+    return m_latency.getSectionSamples(name, samples);
+}
+
+bool LatencyMonitor::getInterArrivalSamples(const std::string& name,
+                                            std::vector<std::chrono::nanoseconds>& samples) const
+{
+    return m_interArrival.getSectionSamples(name, samples);
+}
+
+void LatencyMonitor::clearSamples()
+{
+    m_latency.clearSamples();
+    m_interArrival.clearSamples();
+
+    for (Hop& hop : m_hops)
+    {
+        hop = Hop();
+    }
+}
+
+std::string LatencyMonitor::toString() const
+{
+    std::ostringstream stream;
+    stream << "Latency: " << m_latency.toString() //
+           << " Inter-arrival: " << m_interArrival.toString();
+    return stream.str();
+}
@@ -43,6 +43,12 @@ bool LinearTask::update()
     return true;
 }
 
+std::vector<LinearTask::ColumnBlock> LinearTask::structuralColumnBlocks() const
+{
+    // by default the task is considered dense
+    return {{0, m_A.cols()}};
+}
+
 Eigen::Ref<const Eigen::MatrixXd> LinearTask::getA() const
 {
     return m_A;
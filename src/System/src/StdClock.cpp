@@ -19,12 +19,27 @@ std::chrono::nanoseconds StdClock::now()
 
 void StdClock::sleepFor(const std::chrono::nanoseconds& sleepDuration)
 {
-    std::this_thread::sleep_for(sleepDuration);
+    this->sleepUntil(std::chrono::system_clock::now().time_since_epoch() + sleepDuration);
 }
 
 void StdClock::sleepUntil(const std::chrono::nanoseconds& time)
 {
-    std::this_thread::sleep_for(time - std::chrono::system_clock::now().time_since_epoch());
+    const std::chrono::nanoseconds guardInterval = m_sleepGuardInterval.load();
+
+    // sleep until the guard interval before the deadline. The kernel wake-up jitter is absorbed
+    // by the spin phase below
+    std::this_thread::sleep_for(time - guardInterval
+                                - std::chrono::system_clock::now().time_since_epoch());
+
+    if (guardInterval == std::chrono::nanoseconds::zero())
+    {
+        return;
+    }
+
+    // spin on the clock for the remaining time
+    while (std::chrono::system_clock::now().time_since_epoch() < time)
+    {
+    }
 }
 
 void StdClock::yield()
@@ -32,9 +47,27 @@ void StdClock::yield()
     std::this_thread::yield();
 }
 
+void StdClock::setSleepGuardInterval(const std::chrono::nanoseconds& guardInterval)
+{
+    m_sleepGuardInterval = guardInterval;
+}
+
+StdClockFactory::StdClockFactory(const std::chrono::nanoseconds& sleepGuardInterval)
+    : m_sleepGuardInterval(sleepGuardInterval)
+{
+}
+
 IClock& StdClockFactory::createClock()
 {
     // Create the singleton. Meyers' implementation. It is automatically threadsafe
     static StdClock clock;
+
+    // the guard interval is forwarded to the clock only when the singleton is created
+    static const bool sleepGuardIntervalApplied = [this]() -> bool {
+        clock.setSleepGuardInterval(m_sleepGuardInterval);
+        return true;
+    }();
+    static_cast<void>(sleepGuardIntervalApplied);
+
     return clock;
 }
@@ -0,0 +1,71 @@
+/**
+ * @file ThreadUtilities.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <BipedalLocomotion/System/ThreadUtilities.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace BipedalLocomotion;
+
+bool System::setNameOfCallingThread(const std::string& name)
+{
+#if defined(__linux__)
+    // the Linux kernel limits the thread name to 15 characters plus the null terminator
+    constexpr std::size_t maximumLength = 15;
+    return pthread_setname_np(pthread_self(), name.substr(0, maximumLength).c_str()) == 0;
+#elif defined(__APPLE__)
+    constexpr std::size_t maximumLength = 63;
+    return pthread_setname_np(name.substr(0, maximumLength).c_str()) == 0;
+#else
+    log()->warn("[System::setNameOfCallingThread] Feature not supported on this platform.");
+    return false;
+#endif
+}
+
+bool System::setRealTimePriorityOfCallingThread(int priority)
+{
+#if defined(__linux__) || defined(__APPLE__)
+    sched_param param{};
+    param.sched_priority = priority;
+    return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+#else
+    log()->warn("[System::setRealTimePriorityOfCallingThread] Feature not supported on this "
+                "platform.");
+    return false;
+#endif
+}
+
+bool System::setAffinityOfCallingThread(const std::vector<int>& cpus)
+{
+    if (cpus.empty())
+    {
+        log()->error("[System::setAffinityOfCallingThread] The list of CPUs is empty.");
+        return false;
+    }
+
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (const int cpu : cpus)
+    {
+        if (cpu < 0)
+        {
+            log()->error("[System::setAffinityOfCallingThread] Invalid CPU index: {}.", cpu);
+            return false;
+        }
+        CPU_SET(cpu, &cpuSet);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+    log()->warn("[System::setAffinityOfCallingThread] Feature not supported on this platform.");
+    return false;
+#endif
+}
@@ -0,0 +1,162 @@
+/**
+ * @file TimeProfiler.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <numeric>
+#include <sstream>
+
+#include <BipedalLocomotion/System/TimeProfiler.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::System;
+
+std::ptrdiff_t TimeProfiler::registerSection(const std::string& name, std::size_t capacity)
+{
+    constexpr auto logPrefix = "[TimeProfiler::registerSection]";
+
+    if (capacity == 0)
+    {
+        log()->error("{} The capacity of the section named {} must be strictly positive.",
+                     logPrefix,
+                     name);
+        return InvalidSectionIndex;
+    }
+
+    if (m_indices.find(name) != m_indices.end())
+    {
+        log()->error("{} The section named {} already exists.", logPrefix, name);
+        return InvalidSectionIndex;
+    }
+
+    Section section;
+    section.name = name;
+    section.buffer.resize(capacity, std::chrono::nanoseconds::zero());
+
+    m_indices[name] = m_sections.size();
+    m_sections.push_back(std::move(section));
+
+    return m_sections.size() - 1;
+}
+
+std::ptrdiff_t TimeProfiler::getSectionIndex(const std::string& name) const
+{
+    const auto it = m_indices.find(name);
+    if (it == m_indices.end())
+    {
+        return InvalidSectionIndex;
+    }
+
+    return it->second;
+}
+
+std::vector<std::string> TimeProfiler::getSectionNames() const
+{
+    std::vector<std::string> names(m_sections.size());
+    for (std::size_t i = 0; i < m_sections.size(); i++)
+    {
+        names[i] = m_sections[i].name;
+    }
+
+    return names;
+}
+
+bool TimeProfiler::getSectionStatistics(const std::string& name,
+                                        SectionStatistics& statistics) const
+{
+    const auto index = this->getSectionIndex(name);
+    if (index == InvalidSectionIndex)
+    {
+        log()->error("[TimeProfiler::getSectionStatistics] The section named {} does not exist.",
+                     name);
+        return false;
+    }
+
+    const Section& section = m_sections[index];
+
+    statistics.name = section.name;
+    statistics.samples = section.count;
+    statistics.latest = std::chrono::nanoseconds::zero();
+    statistics.min = std::chrono::nanoseconds::zero();
+    statistics.max = std::chrono::nanoseconds::zero();
+    statistics.average = std::chrono::nanoseconds::zero();
+
+    if (section.count == 0)
+    {
+        return true;
+    }
+
+    const std::size_t latestIndex
+        = (section.head + section.buffer.size() - 1) % section.buffer.size();
+    statistics.latest = section.buffer[latestIndex];
+
+    statistics.min = statistics.latest;
+    statistics.max = statistics.latest;
+    std::chrono::nanoseconds sum = std::chrono::nanoseconds::zero();
+    for (std::size_t i = 0; i < section.count; i++)
+    {
+        const std::chrono::nanoseconds& sample = section.buffer[i];
+        statistics.min = std::min(statistics.min, sample);
+        statistics.max = std::max(statistics.max, sample);
+        sum += sample;
+    }
+    statistics.average = sum / section.count;
+
+    return true;
+}
+
+bool TimeProfiler::getSectionSamples(const std::string& name,
+                                     std::vector<std::chrono::nanoseconds>& samples) const
+{
+    const auto index = this->getSectionIndex(name);
+    if (index == InvalidSectionIndex)
+    {
+        log()->error("[TimeProfiler::getSectionSamples] The section named {} does not exist.",
+                     name);
+        return false;
+    }
+
+    const Section& section = m_sections[index];
+
+    samples.resize(section.count);
+
+    // when the buffer is full the oldest sample is the one pointed by head, otherwise the buffer
+    // has not wrapped yet and the oldest sample is the first one
+    const std::size_t oldest = (section.count == section.buffer.size()) ? section.head : 0;
+    for (std::size_t i = 0; i < section.count; i++)
+    {
+        samples[i] = section.buffer[(oldest + i) % section.buffer.size()];
+    }
+
+    return true;
+}
+
+void TimeProfiler::clearSamples()
+{
+    for (auto& section : m_sections)
+    {
+        section.head = 0;
+        section.count = 0;
+    }
+}
+
+std::string TimeProfiler::toString() const
+{
+    std::ostringstream oss;
+    oss << "====== TimeProfiler ======" << std::endl;
+    SectionStatistics statistics;
+    for (const auto& section : m_sections)
+    {
+        this->getSectionStatistics(section.name, statistics);
+        oss << section.name << ": latest "
+            << std::chrono::duration<double, std::milli>(statistics.latest).count() << " ms, min "
+            << std::chrono::duration<double, std::milli>(statistics.min).count() << " ms, max "
+            << std::chrono::duration<double, std::milli>(statistics.max).count() << " ms, average "
+            << std::chrono::duration<double, std::milli>(statistics.average).count() << " ms over "
+            << statistics.samples << " samples." << std::endl;
+    }
+
+    return oss.str();
+}
@@ -7,7 +7,9 @@
 
 #include <BipedalLocomotion/System/VariablesHandler.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
+#include <algorithm>
 #include <cstddef>
+#include <deque>
 
 using namespace BipedalLocomotion::System;
 using namespace BipedalLocomotion::ParametersHandler;
@@ -25,6 +27,11 @@ VariablesHandler::VariableDescription VariablesHandler::VariableDescription::Inv
     return tmp;
 }
 
+bool VariablesHandler::VariableHandle::isValid() const
+{
+    return index >= 0;
+}
+
 std::ptrdiff_t VariablesHandler::VariableDescription::getElementIndex(const std::string& name) const
 {
     // find the element index associated to the given name
@@ -163,7 +170,7 @@ bool VariablesHandler::addVariable(const std::string& name,
                                    const std::vector<std::string>& elementsName) noexcept
 {
     // if the variable already exist cannot be added again.
-    if (m_variables.find(name) != m_variables.end())
+    if (m_variablesNameMap.find(name) != m_variablesNameMap.end())
     {
         log()->error("[VariableHandler::addVariable] The variable named {} already exists.", name);
         return false;
@@ -197,7 +204,8 @@ bool VariablesHandler::addVariable(const std::string& name,
         }
     }
 
-    m_variables.emplace(name, description);
+    m_variablesNameMap.emplace(name, m_variables.size());
+    m_variables.push_back(std::move(description));
     m_numberOfVariables += size;
 
     return true;
@@ -206,13 +214,13 @@ bool VariablesHandler::addVariable(const std::string& name,
 const VariablesHandler::VariableDescription&
 VariablesHandler::getVariable(const std::string& name) const noexcept
 {
-    auto variable = m_variables.find(name);
+    auto variable = m_variablesNameMap.find(name);
 
     // if the variable is present its IndexRange is returned otherwise an
     // invalid IndexRange is provided to the user
 
-    if (variable != m_variables.end())
-        return variable->second;
+    if (variable != m_variablesNameMap.end())
+        return m_variables[variable->second];
     else
         return m_invalidVariable;
 }
@@ -223,6 +231,152 @@ bool VariablesHandler::getVariable(const std::string& name, //
     return (description = this->getVariable(name)).isValid();
 }
 
+VariablesHandler::VariableHandle
+VariablesHandler::getVariableHandle(const std::string& name) const noexcept
+{
+    VariableHandle handle;
+
+    auto variable = m_variablesNameMap.find(name);
+    if (variable != m_variablesNameMap.end())
+    {
+        handle.index = variable->second;
+    }
+
+    return handle;
+}
+
+const VariablesHandler::VariableDescription&
+VariablesHandler::getVariable(const VariableHandle& handle) const noexcept
+{
+    // the bounds are checked so that a stale handle (e.g. resolved before the handler was
+    // re-initialized) returns an invalid description instead of accessing out of range memory
+    if (handle.index < 0 || static_cast<std::size_t>(handle.index) >= m_variables.size())
+    {
+        return m_invalidVariable;
+    }
+
+    return m_variables[handle.index];
+}
+
+bool VariablesHandler::declareVariablesCoupling(const std::string& firstVariable,
+                                                const std::string& secondVariable) noexcept
+{
+    constexpr auto logPrefix = "[VariablesHandler::declareVariablesCoupling]";
+
+    const auto first = m_variablesNameMap.find(firstVariable);
+    if (first == m_variablesNameMap.end())
+    {
+        log()->error("{} Unable to find the variable named {}.", logPrefix, firstVariable);
+        return false;
+    }
+
+    const auto second = m_variablesNameMap.find(secondVariable);
+    if (second == m_variablesNameMap.end())
+    {
+        log()->error("{} Unable to find the variable named {}.", logPrefix, secondVariable);
+        return false;
+    }
+
+    // a variable is trivially coupled with itself
+    if (first->second == second->second)
+    {
+        return true;
+    }
+
+    m_couplings.emplace_back(first->second, second->second);
+    return true;
+}
+
+bool VariablesHandler::optimizeOrdering() noexcept
+{
+    const std::size_t numberOfVariables = m_variables.size();
+    if (numberOfVariables == 0)
+    {
+        return true;
+    }
+
+    // build the adjacency lists of the coupling graph
+    std::vector<std::vector<std::size_t>> adjacency(numberOfVariables);
+    for (const auto& [first, second] : m_couplings)
+    {
+        adjacency[first].push_back(second);
+        adjacency[second].push_back(first);
+    }
+    for (auto& neighbors : adjacency)
+    {
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    }
+
+    // reverse Cuthill-McKee: breadth first visit started from a minimum degree variable, exploring
+    // the neighbors by increasing degree. The reversed visit order keeps the coupled variables
+    // close to each other and reduces the bandwidth of the matrices built on the layout
+    const auto byIncreasingDegree = [&adjacency](std::size_t i, std::size_t j) {
+        if (adjacency[i].size() != adjacency[j].size())
+        {
+            return adjacency[i].size() < adjacency[j].size();
+        }
+        return i < j;
+    };
+
+    std::vector<std::size_t> order;
+    order.reserve(numberOfVariables);
+    std::vector<bool> visited(numberOfVariables, false);
+    std::deque<std::size_t> queue;
+
+    for (std::size_t component = 0; component < numberOfVariables; component++)
+    {
+        // find the unvisited variable with the minimum degree to start the visit of the component
+        std::size_t start = numberOfVariables;
+        for (std::size_t i = 0; i < numberOfVariables; i++)
+        {
+            if (!visited[i] && (start == numberOfVariables || byIncreasingDegree(i, start)))
+            {
+                start = i;
+            }
+        }
+
+        if (start == numberOfVariables)
+        {
+            break;
+        }
+
+        visited[start] = true;
+        queue.push_back(start);
+        while (!queue.empty())
+        {
+            const std::size_t current = queue.front();
+            queue.pop_front();
+            order.push_back(current);
+
+            std::vector<std::size_t> unvisitedNeighbors;
+            for (const auto& neighbor : adjacency[current])
+            {
+                if (!visited[neighbor])
+                {
+                    visited[neighbor] = true;
+                    unvisitedNeighbors.push_back(neighbor);
+                }
+            }
+            std::sort(unvisitedNeighbors.begin(), unvisitedNeighbors.end(), byIncreasingDegree);
+            queue.insert(queue.end(), unvisitedNeighbors.begin(), unvisitedNeighbors.end());
+        }
+    }
+
+    std::reverse(order.begin(), order.end());
+
+    // reassign the offsets following the permuted order. The descriptions are not moved, so the
+    // name based getters and the previously resolved handles remain valid
+    std::ptrdiff_t offset = 0;
+    for (const auto& index : order)
+    {
+        m_variables[index].offset = offset;
+        offset += m_variables[index].size;
+    }
+
+    return true;
+}
+
 const std::size_t& VariablesHandler::getNumberOfVariables() const noexcept
 {
     return m_numberOfVariables;
@@ -231,9 +385,9 @@ const std::size_t& VariablesHandler::getNumberOfVariables() const noexcept
 std::string VariablesHandler::toString() const noexcept
 {
     std::string out;
-    for (const auto& [key, variable] : m_variables)
+    for (const auto& variable : m_variables)
     {
-        out += key + " size: " + std::to_string(variable.size)
+        out += variable.name + " size: " + std::to_string(variable.size)
                + ", offset: " + std::to_string(variable.offset) + " elements name:";
         for (const auto& name : variable.m_elementsName)
         {
@@ -248,4 +402,6 @@ void VariablesHandler::clear() noexcept
 {
     m_numberOfVariables = 0;
     m_variables.clear();
+    m_variablesNameMap.clear();
+    m_couplings.clear();
 }
@@ -0,0 +1,167 @@
+/**
+ * @file AdvanceableExecutorTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright This software may be modified and distributed under the terms of the GNU Lesser
+ * General Public License v2.1 or any later version.
+ */
+
+#include <chrono>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/System/AdvanceableExecutor.h>
+#include <BipedalLocomotion/System/AdvanceableRunner.h>
+#include <BipedalLocomotion/System/Barrier.h>
+#include <BipedalLocomotion/System/SharedResource.h>
+#include <BipedalLocomotion/System/Source.h>
+
+using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace std::chrono_literals;
+
+class DummyBlock : public Source<bool>
+{
+    bool m_output{false};
+    std::size_t m_i{0};
+
+public:
+    const Output& getOutput() const override
+    {
+        return m_output;
+    }
+
+    bool advance() override
+    {
+        m_i++;
+        if (m_i == 10)
+        {
+            m_output = true;
+        }
+
+        return true;
+    }
+
+    bool isOutputValid() const override
+    {
+        return true;
+    }
+};
+
+TEST_CASE("Test AdvanceableExecutor")
+{
+    std::shared_ptr param = std::make_shared<StdImplementation>();
+    param->setParameter("sampling_time", 1ms);
+    param->setParameter("name", "Runner");
+
+    std::unique_ptr<DummyBlock> block0 = std::make_unique<DummyBlock>();
+    std::unique_ptr<DummyBlock> block1 = std::make_unique<DummyBlock>();
+
+    auto input0 = SharedResource<DummyBlock::Input>::create();
+    auto output0 = SharedResource<DummyBlock::Output>::create();
+
+    auto input1 = SharedResource<DummyBlock::Input>::create();
+    auto output1 = SharedResource<DummyBlock::Output>::create();
+
+    AdvanceableRunner<DummyBlock> runner0;
+    REQUIRE(runner0.initialize(param));
+    REQUIRE(runner0.setInputResource(input0));
+    REQUIRE(runner0.setOutputResource(output0));
+    REQUIRE(runner0.setAdvanceable(std::move(block0)));
+
+    AdvanceableRunner<DummyBlock> runner1;
+    REQUIRE(runner1.initialize(param));
+    REQUIRE(runner1.setInputResource(input1));
+    REQUIRE(runner1.setOutputResource(output1));
+    REQUIRE(runner1.setAdvanceable(std::move(block1)));
+
+    // two runners are scheduled on a pool of two workers
+    std::shared_ptr executorParam = std::make_shared<StdImplementation>();
+    executorParam->setParameter("number_of_workers", 2);
+
+    AdvanceableExecutor executor;
+    REQUIRE(executor.initialize(executorParam));
+    REQUIRE(executor.addRunner(runner0));
+    REQUIRE(executor.addRunner(runner1));
+
+    REQUIRE(executor.run());
+    REQUIRE(executor.isRunning());
+
+    while (!output0->get() || !output1->get())
+    {
+        BipedalLocomotion::clock().sleepFor(10ms);
+    }
+
+    executor.stop();
+    REQUIRE_FALSE(executor.isRunning());
+
+    // print some information
+    for (const auto& info : executor.getInfo())
+    {
+        BipedalLocomotion::log()->info("{} : Number of deadline miss {}",
+                                       info.name,
+                                       info.deadlineMiss);
+    }
+
+    REQUIRE(output0->get());
+    REQUIRE(output1->get());
+}
+
+TEST_CASE("Test AdvanceableExecutor with synchronization")
+{
+    std::shared_ptr param = std::make_shared<StdImplementation>();
+    param->setParameter("sampling_time", 1ms);
+    param->setParameter("name", "Runner");
+
+    std::unique_ptr<DummyBlock> block0 = std::make_unique<DummyBlock>();
+    std::unique_ptr<DummyBlock> block1 = std::make_unique<DummyBlock>();
+
+    auto input0 = SharedResource<DummyBlock::Input>::create();
+    auto output0 = SharedResource<DummyBlock::Output>::create();
+
+    auto input1 = SharedResource<DummyBlock::Input>::create();
+    auto output1 = SharedResource<DummyBlock::Output>::create();
+
+    AdvanceableRunner<DummyBlock> runner0;
+    REQUIRE(runner0.initialize(param));
+    REQUIRE(runner0.setInputResource(input0));
+    REQUIRE(runner0.setOutputResource(output0));
+    REQUIRE(runner0.setAdvanceable(std::move(block0)));
+
+    AdvanceableRunner<DummyBlock> runner1;
+    REQUIRE(runner1.initialize(param));
+    REQUIRE(runner1.setInputResource(input1));
+    REQUIRE(runner1.setOutputResource(output1));
+    REQUIRE(runner1.setAdvanceable(std::move(block1)));
+
+    std::shared_ptr executorParam = std::make_shared<StdImplementation>();
+    executorParam->setParameter("number_of_workers", 1);
+
+    AdvanceableExecutor executor0;
+    REQUIRE(executor0.initialize(executorParam));
+    REQUIRE(executor0.addRunner(runner0));
+
+    AdvanceableExecutor executor1;
+    REQUIRE(executor1.initialize(executorParam));
+    REQUIRE(executor1.addRunner(runner1));
+
+    // both run() calls are issued by this thread. The barrier is waited by the workers, so the
+    // first call must not block waiting for the second executor
+    Barrier barrier(2);
+    REQUIRE(executor0.run(barrier));
+    REQUIRE(executor1.run(barrier));
+
+    while (!output0->get() || !output1->get())
+    {
+        BipedalLocomotion::clock().sleepFor(10ms);
+    }
+
+    executor0.stop();
+    executor1.stop();
+    REQUIRE_FALSE(executor0.isRunning());
+    REQUIRE_FALSE(executor1.isRunning());
+
+    REQUIRE(output0->get());
+    REQUIRE(output1->get());
+}
@@ -6,6 +6,7 @@
  */
 
 #include <chrono>
+#include <cstdint>
 
 // Catch2
 #include <catch2/catch_test_macros.hpp>
@@ -117,6 +118,47 @@ TEST_CASE("Test Block")
         }
     }
 
+    SECTION("Event driven")
+    {
+        std::shared_ptr eventParam = std::make_shared<StdImplementation>();
+        eventParam->setParameter("sampling_time", 1ms);
+        eventParam->setParameter("name", "EventRunner");
+        eventParam->setParameter("enable_event_driven_mode", true);
+        eventParam->setParameter("maximum_latency", 500ms);
+
+        auto block = std::make_unique<DummyBlock>();
+        auto input = SharedResource<DummyBlock::Input>::create();
+        auto output = SharedResource<DummyBlock::Output>::create();
+
+        // without producers the generation does not change and the wait times out
+        std::uint64_t generation = input->generation();
+        REQUIRE_FALSE(input->waitForNewData(generation, 10ms));
+
+        AdvanceableRunner<DummyBlock> runner;
+        REQUIRE(runner.initialize(eventParam));
+        REQUIRE(runner.setInputResource(input));
+        REQUIRE(runner.setOutputResource(output));
+        REQUIRE(runner.setAdvanceable(std::move(block)));
+
+        auto thread = runner.run();
+
+        // every publication wakes up the runner
+        while (!output->get())
+        {
+            input->set(DummyBlock::Input{});
+            BipedalLocomotion::clock().sleepFor(1ms);
+        }
+
+        runner.stop();
+        REQUIRE(output->get());
+
+        if (thread.joinable())
+        {
+            thread.join();
+            thread = std::thread();
+        }
+    }
+
     SECTION("With synchronization")
     {
         constexpr std::size_t numberOfRunners = 2;
@@ -0,0 +1,88 @@
+/**
+ * @file BarrierTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/Barrier.h>
+
+using namespace BipedalLocomotion::System;
+using namespace std::chrono_literals;
+
+TEST_CASE("Barrier")
+{
+    constexpr std::size_t numberOfThreads = 4;
+
+    SECTION("Startup synchronization")
+    {
+        Barrier barrier(numberOfThreads);
+        std::atomic<std::size_t> released{0};
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < numberOfThreads - 1; i++)
+        {
+            threads.emplace_back([&] {
+                barrier.wait();
+                released++;
+            });
+        }
+
+        // the barrier releases the threads only when the expected number of threads arrives
+        std::this_thread::sleep_for(10ms);
+        REQUIRE(released == 0);
+
+        barrier.wait();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        REQUIRE(released == numberOfThreads - 1);
+        REQUIRE(barrier.releaseSpread() >= 0ns);
+    }
+
+    SECTION("Cyclic use")
+    {
+        constexpr std::size_t numberOfTicks = 100;
+
+        Barrier barrier(2);
+        std::atomic<std::size_t> ticks{0};
+
+        std::thread thread([&] {
+            for (std::size_t i = 0; i < numberOfTicks; i++)
+            {
+                barrier.wait();
+                ticks++;
+            }
+        });
+
+        for (std::size_t i = 0; i < numberOfTicks; i++)
+        {
+            barrier.wait();
+        }
+
+        thread.join();
+        REQUIRE(ticks == numberOfTicks);
+    }
+
+    SECTION("Timeout")
+    {
+        Barrier barrier(2);
+
+        // no other thread reaches the barrier, so the wait times out
+        REQUIRE(!barrier.waitFor(1ms));
+
+        // the thread that timed out gave its token back, so the barrier is still usable
+        std::thread thread([&] { barrier.wait(); });
+        REQUIRE(barrier.waitFor(1s));
+        thread.join();
+    }
+}
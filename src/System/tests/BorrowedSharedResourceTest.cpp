@@ -0,0 +1,102 @@
+/**
+ * @file BorrowedSharedResourceTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/BorrowedSharedResource.h>
+
+using namespace BipedalLocomotion::System;
+
+TEST_CASE("BorrowedSharedResource")
+{
+    SECTION("Single thread")
+    {
+        auto resource = BorrowedSharedResource<int>::create();
+
+        // before the first publication the view is not valid
+        REQUIRE_FALSE(resource->borrow().isValid());
+
+        resource->prepare() = 42;
+        resource->publish();
+
+        auto view = resource->borrow();
+        REQUIRE(view.isValid());
+        REQUIRE(view.get() == 42);
+        REQUIRE(view.generation() == 1);
+
+        // the consumer always observes the most recent publication
+        resource->prepare() = 1;
+        resource->publish();
+        resource->prepare() = 2;
+        resource->publish();
+
+        view = resource->borrow();
+        REQUIRE(view.get() == 2);
+        REQUIRE(view.generation() == 3);
+
+        // a borrowed slot is not modified by subsequent publications
+        resource->prepare() = 3;
+        resource->publish();
+        REQUIRE(view.get() == 2);
+        REQUIRE(resource->borrow().get() == 3);
+    }
+
+    SECTION("Single producer single consumer")
+    {
+        // each publication fills the payload with a single repeated value. If a slot were
+        // recycled while borrowed, the consumer would observe a partially overwritten payload
+        using Payload = std::array<int, 128>;
+
+        constexpr int numberOfValues = 50000;
+
+        auto resource = BorrowedSharedResource<Payload>::create();
+        std::atomic<bool> producerDone{false};
+
+        std::thread producer([&]() {
+            for (int i = 1; i <= numberOfValues; i++)
+            {
+                resource->prepare().fill(i);
+                resource->publish();
+            }
+            producerDone = true;
+        });
+
+        bool isCoherent = true;
+        bool isMonotonic = true;
+        std::uint64_t previousGeneration = 0;
+        int lastValue = 0;
+        while (!producerDone || lastValue != numberOfValues)
+        {
+            const auto view = resource->borrow();
+            if (!view.isValid())
+            {
+                continue;
+            }
+
+            isMonotonic = isMonotonic && (view.generation() >= previousGeneration);
+            previousGeneration = view.generation();
+
+            const Payload& payload = view.get();
+            for (const int element : payload)
+            {
+                isCoherent = isCoherent && (element == payload.front());
+            }
+            lastValue = payload.front();
+        }
+
+        producer.join();
+
+        REQUIRE(isCoherent);
+        REQUIRE(isMonotonic);
+        REQUIRE(lastValue == numberOfValues);
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file ClockTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <memory>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/Clock.h>
+
+using namespace BipedalLocomotion::System;
+
+namespace
+{
+
+/**
+ * Clock returning a fixed time. It is used to check that the fast path keeps routing through the
+ * virtual interface when a custom clock is configured.
+ */
+class FixedClock final : public IClock
+{
+public:
+    static constexpr std::chrono::nanoseconds fixedTime{42};
+
+    std::chrono::nanoseconds now() final
+    {
+        return fixedTime;
+    }
+
+    void sleepFor(const std::chrono::nanoseconds& sleepDuration) final
+    {
+    }
+
+    void sleepUntil(const std::chrono::nanoseconds& time) final
+    {
+    }
+
+    void yield() final
+    {
+    }
+};
+
+class FixedClockFactory final : public ClockFactory
+{
+public:
+    IClock& createClock() final
+    {
+        static FixedClock clock;
+        return clock;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Test Clock")
+{
+    // the factory can be set since the clock singleton has not been created yet
+    REQUIRE(ClockBuilder::setFactory(std::make_shared<FixedClockFactory>()));
+
+    // once the clock has been created the factory cannot change anymore
+    REQUIRE(BipedalLocomotion::clock().now() == FixedClock::fixedTime);
+    REQUIRE_FALSE(ClockBuilder::setFactory(std::make_shared<StdClockFactory>()));
+
+    // the fast path must route through the virtual interface since the configured clock is not
+    // the StdClock
+    REQUIRE(BipedalLocomotion::clockNow() == FixedClock::fixedTime);
+    REQUIRE(BipedalLocomotion::clockNowTicks() == FixedClock::fixedTime.count());
+}
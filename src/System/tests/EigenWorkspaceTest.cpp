@@ -0,0 +1,71 @@
+/**
+ * @file EigenWorkspaceTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/EigenWorkspace.h>
+
+using namespace BipedalLocomotion::System;
+
+TEST_CASE("EigenWorkspace")
+{
+    EigenWorkspace workspace;
+    REQUIRE(workspace.reserve(64));
+    REQUIRE(workspace.capacity() == 64);
+
+    SECTION("Checkout and reset")
+    {
+        auto matrix = workspace.matrix(4, 6);
+        auto vector = workspace.vector(10);
+        REQUIRE(workspace.used() == 4 * 6 + 10);
+
+        // the chunks do not overlap
+        matrix.setConstant(1.0);
+        vector.setConstant(2.0);
+        REQUIRE(matrix.isApproxToConstant(1.0));
+        REQUIRE(vector.isApproxToConstant(2.0));
+
+        // reserving while there are outstanding checkouts is not allowed
+        REQUIRE_FALSE(workspace.reserve(128));
+
+        workspace.reset();
+        REQUIRE(workspace.used() == 0);
+
+        // after the reset the same memory is checked out again
+        auto otherMatrix = workspace.matrix(4, 6);
+        REQUIRE(otherMatrix.data() == matrix.data());
+    }
+
+    SECTION("Overflow")
+    {
+        // the request exceeds the capacity: it is served from an overflow block
+        auto matrix = workspace.matrix(10, 10);
+        matrix.setIdentity();
+        REQUIRE(matrix.isIdentity());
+        REQUIRE(workspace.used() == 100);
+
+        // at the next reset the arena grows to the peak requirement
+        workspace.reset();
+        REQUIRE(workspace.capacity() >= 100);
+
+        // the steady state does not overflow anymore
+        auto otherMatrix = workspace.matrix(10, 10);
+        REQUIRE(workspace.used() == 100);
+        workspace.reset();
+    }
+
+    SECTION("Malloc guard")
+    {
+        // the guard compiles to a no-op when FRAMEWORK_ENABLE_MALLOC_GUARD is not set
+        ScopedEigenMallocGuard guard;
+        auto matrix = workspace.matrix(4, 4);
+        matrix.setZero();
+        REQUIRE(matrix.isZero());
+        workspace.reset();
+    }
+}
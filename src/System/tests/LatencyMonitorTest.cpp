@@ -0,0 +1,76 @@
+/**
+ * @file LatencyMonitorTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/Clock.h>
+#include <BipedalLocomotion/System/LatencyMonitor.h>
+#include <BipedalLocomotion/System/Stamped.h>
+
+using namespace BipedalLocomotion::System;
+using namespace std::chrono_literals;
+
+TEST_CASE("Stamped")
+{
+    const auto before = BipedalLocomotion::clock().now();
+    const Stamped<double> sample = stampNow(3.14);
+    const auto after = BipedalLocomotion::clock().now();
+
+    REQUIRE(sample.value == 3.14);
+    REQUIRE(sample.time >= before);
+    REQUIRE(sample.time <= after);
+}
+
+TEST_CASE("LatencyMonitor")
+{
+    LatencyMonitor monitor;
+
+    const auto hop = monitor.registerHop("estimator");
+    REQUIRE(hop != LatencyMonitor::InvalidHopIndex);
+    REQUIRE(monitor.getHopIndex("estimator") == hop);
+
+    // registering twice the same hop is not allowed
+    REQUIRE(monitor.registerHop("estimator") == LatencyMonitor::InvalidHopIndex);
+
+    // record some samples produced in the past
+    constexpr std::size_t numberOfSamples = 10;
+    for (std::size_t i = 0; i < numberOfSamples; i++)
+    {
+        const Stamped<int> sample(static_cast<int>(i), BipedalLocomotion::clock().now() - 1ms);
+        monitor.record(hop, sample);
+
+        // recording the same sample twice must not pollute the statistics
+        monitor.record(hop, sample);
+
+        BipedalLocomotion::clock().sleepFor(1ms);
+    }
+
+    TimeProfiler::SectionStatistics latency;
+    REQUIRE(monitor.getLatencyStatistics("estimator", latency));
+    REQUIRE(latency.samples == numberOfSamples);
+
+    // each sample was stamped 1 ms before being recorded
+    REQUIRE(latency.min >= 1ms);
+
+    // the first sample has no predecessor so the inter-arrival statistics have one sample less
+    TimeProfiler::SectionStatistics interArrival;
+    REQUIRE(monitor.getInterArrivalStatistics("estimator", interArrival));
+    REQUIRE(interArrival.samples == numberOfSamples - 1);
+    REQUIRE(interArrival.min >= 1ms);
+
+    // the raw samples can be retrieved to build histograms
+    std::vector<std::chrono::nanoseconds> samples;
+    REQUIRE(monitor.getLatencySamples("estimator", samples));
+    REQUIRE(samples.size() == numberOfSamples);
+
+    monitor.clearSamples();
+    REQUIRE(monitor.getLatencyStatistics("estimator", latency));
+    REQUIRE(latency.samples == 0);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file LockFreeSharedResourceTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <atomic>
+#include <thread>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/LockFreeSharedResource.h>
+
+using namespace BipedalLocomotion::System;
+
+TEST_CASE("LockFreeSharedResource")
+{
+    SECTION("Single thread")
+    {
+        auto resource = LockFreeSharedResource<int>::create();
+
+        // before the first set() the default constructed value is returned
+        REQUIRE(resource->get() == 0);
+
+        resource->set(42);
+        REQUIRE(resource->get() == 42);
+
+        // the consumer always reads the most recent value
+        resource->set(1);
+        resource->set(2);
+        REQUIRE(resource->get() == 2);
+
+        // reading twice returns the same value
+        REQUIRE(resource->get() == 2);
+    }
+
+    SECTION("Single producer single consumer")
+    {
+        constexpr int numberOfValues = 100000;
+
+        auto resource = LockFreeSharedResource<int>::create();
+        std::atomic<bool> producerDone{false};
+
+        std::thread producer([&]() {
+            for (int i = 1; i <= numberOfValues; i++)
+            {
+                resource->set(i);
+            }
+            producerDone = true;
+        });
+
+        // the consumer must observe a monotonically non decreasing sequence and eventually the
+        // last published value
+        int previousValue = 0;
+        bool isMonotonic = true;
+        while (!producerDone || previousValue != numberOfValues)
+        {
+            const int value = resource->get();
+            isMonotonic = isMonotonic && (value >= previousValue);
+            previousValue = value;
+        }
+
+        producer.join();
+
+        REQUIRE(isMonotonic);
+        REQUIRE(previousValue == numberOfValues);
+    }
+}
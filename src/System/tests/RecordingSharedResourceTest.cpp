@@ -0,0 +1,100 @@
+/**
+ * @file RecordingSharedResourceTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/RecordingSharedResource.h>
+#include <BipedalLocomotion/System/SharedResource.h>
+
+using namespace BipedalLocomotion::System;
+
+TEST_CASE("Test RecordingSharedResource")
+{
+    const std::string logFile = "recording_shared_resource_test.bin";
+
+    auto serializer = [](const std::vector<double>& value, std::vector<char>& buffer) {
+        buffer.resize(value.size() * sizeof(double));
+        std::memcpy(buffer.data(), value.data(), buffer.size());
+    };
+
+    auto deserializer = [](const std::vector<char>& buffer, std::vector<double>& value) {
+        if (buffer.size() % sizeof(double) != 0)
+        {
+            return false;
+        }
+        value.resize(buffer.size() / sizeof(double));
+        std::memcpy(value.data(), buffer.data(), buffer.size());
+        return true;
+    };
+
+    const std::vector<std::vector<double>> samples{{1.0, 2.0, 3.0}, {4.0, 5.0}, {6.0}};
+
+    // record the traffic. The scope guarantees that the file is flushed before reading it back
+    {
+        auto resource = RecordingSharedResource<std::vector<double>>::create(logFile, serializer);
+        REQUIRE(resource != nullptr);
+
+        for (const auto& sample : samples)
+        {
+            resource->set(sample);
+
+            // the resource still behaves as a plain SharedResource
+            REQUIRE(resource->get() == sample);
+        }
+    }
+
+    SECTION("Read the records one by one")
+    {
+        SharedResourceLogReader<std::vector<double>> reader(logFile, deserializer);
+        REQUIRE(reader.isValid());
+
+        std::chrono::nanoseconds previousTime = std::chrono::nanoseconds::min();
+        std::chrono::nanoseconds time;
+        std::vector<double> value;
+        for (const auto& sample : samples)
+        {
+            REQUIRE(reader.read(time, value));
+            REQUIRE(value == sample);
+
+            // the publication times are monotonically non decreasing
+            REQUIRE(time >= previousTime);
+            previousTime = time;
+        }
+
+        // the end of the log has been reached
+        REQUIRE_FALSE(reader.read(time, value));
+    }
+
+    SECTION("Replay the log into a shared resource")
+    {
+        SharedResourceLogReader<std::vector<double>> reader(logFile, deserializer);
+        REQUIRE(reader.isValid());
+
+        auto destination = SharedResource<std::vector<double>>::create();
+        REQUIRE(reader.replayInto(*destination) == samples.size());
+        REQUIRE(destination->get() == samples.back());
+    }
+
+    SECTION("Invalid inputs")
+    {
+        // a null serializer is rejected
+        REQUIRE(RecordingSharedResource<std::vector<double>>::create(logFile, nullptr) == nullptr);
+
+        // a file that is not a shared resource log is rejected
+        SharedResourceLogReader<std::vector<double>> reader("not_existing_file.bin", deserializer);
+        REQUIRE_FALSE(reader.isValid());
+    }
+
+    std::remove(logFile.c_str());
+}
@@ -0,0 +1,108 @@
+/**
+ * @file TimeProfilerTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+// Catch2
+#include <catch2/catch.hpp>
+
+#include <BipedalLocomotion/System/TimeProfiler.h>
+
+using namespace BipedalLocomotion::System;
+
+TEST_CASE("TimeProfiler")
+{
+    using namespace std::chrono_literals;
+
+    TimeProfiler profiler;
+
+    SECTION("Register section")
+    {
+        const auto index = profiler.registerSection("task-update");
+        REQUIRE(index != TimeProfiler::InvalidSectionIndex);
+        REQUIRE(profiler.getSectionIndex("task-update") == index);
+
+        // the name must be unique
+        REQUIRE(profiler.registerSection("task-update") == TimeProfiler::InvalidSectionIndex);
+
+        // the capacity must be strictly positive
+        REQUIRE(profiler.registerSection("qp-solve", 0) == TimeProfiler::InvalidSectionIndex);
+
+        // a section that does not exist
+        REQUIRE(profiler.getSectionIndex("qp-solve") == TimeProfiler::InvalidSectionIndex);
+    }
+
+    SECTION("Record and statistics")
+    {
+        const auto index = profiler.registerSection("qp-solve");
+        REQUIRE(index != TimeProfiler::InvalidSectionIndex);
+
+        profiler.record(index, 1ms);
+        profiler.record(index, 3ms);
+        profiler.record(index, 2ms);
+
+        TimeProfiler::SectionStatistics statistics;
+        REQUIRE(profiler.getSectionStatistics("qp-solve", statistics));
+        REQUIRE(statistics.samples == 3);
+        REQUIRE(statistics.latest == 2ms);
+        REQUIRE(statistics.min == 1ms);
+        REQUIRE(statistics.max == 3ms);
+        REQUIRE(statistics.average == 2ms);
+
+        std::vector<std::chrono::nanoseconds> samples;
+        REQUIRE(profiler.getSectionSamples("qp-solve", samples));
+        REQUIRE(samples == std::vector<std::chrono::nanoseconds>{1ms, 3ms, 2ms});
+
+        profiler.clearSamples();
+        REQUIRE(profiler.getSectionStatistics("qp-solve", statistics));
+        REQUIRE(statistics.samples == 0);
+    }
+
+    SECTION("Ring buffer wrap around")
+    {
+        constexpr std::size_t capacity = 4;
+        const auto index = profiler.registerSection("task-update", capacity);
+        REQUIRE(index != TimeProfiler::InvalidSectionIndex);
+
+        for (std::size_t i = 1; i <= 6; i++)
+        {
+            profiler.record(index, std::chrono::milliseconds(i));
+        }
+
+        // the two oldest samples have been overwritten
+        TimeProfiler::SectionStatistics statistics;
+        REQUIRE(profiler.getSectionStatistics("task-update", statistics));
+        REQUIRE(statistics.samples == capacity);
+        REQUIRE(statistics.latest == 6ms);
+        REQUIRE(statistics.min == 3ms);
+        REQUIRE(statistics.max == 6ms);
+
+        std::vector<std::chrono::nanoseconds> samples;
+        REQUIRE(profiler.getSectionSamples("task-update", samples));
+        REQUIRE(samples == std::vector<std::chrono::nanoseconds>{3ms, 4ms, 5ms, 6ms});
+    }
+
+    SECTION("Scoped timer")
+    {
+        const auto index = profiler.registerSection("scope");
+        REQUIRE(index != TimeProfiler::InvalidSectionIndex);
+
+        {
+            TimeProfiler::ScopedTimer timer(profiler, index);
+        }
+
+        TimeProfiler::SectionStatistics statistics;
+        REQUIRE(profiler.getSectionStatistics("scope", statistics));
+        REQUIRE(statistics.samples == 1);
+        REQUIRE(statistics.latest >= std::chrono::nanoseconds::zero());
+
+        // a timer associated to an invalid section does not record anything
+        {
+            TimeProfiler::ScopedTimer timer(profiler, TimeProfiler::InvalidSectionIndex);
+        }
+        REQUIRE(profiler.getSectionStatistics("scope", statistics));
+        REQUIRE(statistics.samples == 1);
+    }
+}
@@ -46,6 +46,79 @@ TEST_CASE("Test Variable Handler")
         REQUIRE(variable3.getElementIndex("bar") == variable1Size + variable2Size + 1);
     }
 
+    SECTION("Optimize ordering")
+    {
+        constexpr std::size_t variable1Size = 6;
+        constexpr std::size_t variable2Size = 12;
+        constexpr std::size_t variable3Size = 6;
+        constexpr std::size_t variable4Size = 12;
+
+        REQUIRE(handler.addVariable("variable_1", variable1Size));
+        REQUIRE(handler.addVariable("variable_2", variable2Size));
+        REQUIRE(handler.addVariable("variable_3", variable3Size));
+        REQUIRE(handler.addVariable("variable_4", variable4Size));
+
+        // the coupling can be declared only between existing variables
+        REQUIRE_FALSE(handler.declareVariablesCoupling("variable_1", "variable_5"));
+
+        // variable_1 is coupled with variable_3 and variable_2 with variable_4
+        REQUIRE(handler.declareVariablesCoupling("variable_1", "variable_3"));
+        REQUIRE(handler.declareVariablesCoupling("variable_2", "variable_4"));
+
+        REQUIRE(handler.optimizeOrdering());
+
+        // the offsets still describe a partition of the full optimization vector
+        const std::size_t totalSize
+            = variable1Size + variable2Size + variable3Size + variable4Size;
+        REQUIRE(handler.getNumberOfVariables() == totalSize);
+
+        std::vector<bool> covered(totalSize, false);
+        for (const auto& name : {"variable_1", "variable_2", "variable_3", "variable_4"})
+        {
+            const auto& variable = handler.getVariable(name);
+            REQUIRE(variable.isValid());
+            for (std::ptrdiff_t i = 0; i < variable.size; i++)
+            {
+                REQUIRE_FALSE(covered[variable.offset + i]);
+                covered[variable.offset + i] = true;
+            }
+        }
+
+        // coupled variables are placed next to each other
+        auto areAdjacent = [&handler](const std::string& first, const std::string& second) {
+            const auto& v1 = handler.getVariable(first);
+            const auto& v2 = handler.getVariable(second);
+            return (v1.offset + v1.size == v2.offset) || (v2.offset + v2.size == v1.offset);
+        };
+        REQUIRE(areAdjacent("variable_1", "variable_3"));
+        REQUIRE(areAdjacent("variable_2", "variable_4"));
+    }
+
+    SECTION("Variable handle")
+    {
+        constexpr std::size_t variable1Size = 42;
+        constexpr std::size_t variable2Size = 35;
+
+        REQUIRE(handler.addVariable("variable_1", variable1Size));
+        REQUIRE(handler.addVariable("variable_2", variable2Size));
+
+        // the handle is resolved once and the following accesses do not involve any string lookup
+        const auto handle = handler.getVariableHandle("variable_2");
+        REQUIRE(handle.isValid());
+        REQUIRE(handler.getVariable(handle).offset == variable1Size);
+        REQUIRE(handler.getVariable(handle).size == variable2Size);
+        REQUIRE(handler.getVariable(handle).name == "variable_2");
+
+        // a handle associated to a variable that does not exist is not valid
+        const auto invalidHandle = handler.getVariableHandle("variable_3");
+        REQUIRE_FALSE(invalidHandle.isValid());
+        REQUIRE_FALSE(handler.getVariable(invalidHandle).isValid());
+
+        // a handle is invalidated when the handler is cleared
+        handler.clear();
+        REQUIRE_FALSE(handler.getVariable(handle).isValid());
+    }
+
     SECTION("Add variables - ParametersHandler")
     {
         using namespace BipedalLocomotion::ParametersHandler;
@@ -12,6 +12,7 @@
 
 #include <manif/manif.h>
 
+#include <BipedalLocomotion/System/KinDynComputationsCache.h>
 #include <BipedalLocomotion/TSID/TSIDLinearTask.h>
 
 #include <iDynTree/KinDynComputations.h>
@@ -57,6 +58,10 @@ class CoMTask : public TSIDLinearTask
     std::shared_ptr<iDynTree::KinDynComputations> m_kinDyn; /**< Pointer to a KinDynComputations
                                                                object */
 
+    std::shared_ptr<System::KinDynComputationsCache> m_kinDynCache; /**< Optional memoizing layer
+                                                                       shared among several tasks
+                                                                       and solvers. */
+
     /** Mask used to select the DoFs controlled by the task */
     std::array<bool, m_linearVelocitySize> m_mask{true, true, true};
     std::size_t m_DoFs{m_linearVelocitySize}; /**< DoFs associated to the task */
@@ -87,6 +92,18 @@ public:
      */
     bool setKinDyn(std::shared_ptr<iDynTree::KinDynComputations> kinDyn);
 
+    /**
+     * Set a shared kinDynComputations cache. When set, the task reads the center of mass
+     * quantities from the cache instead of recomputing them, so each quantity is evaluated once
+     * per tick even if several tasks (or several solvers, e.g. an IK and a TSID instance) consume
+     * them.
+     * @param kinDynCache pointer to a KinDynComputationsCache object.
+     * @note The kinDynComputations object wrapped by the cache replaces the one set with
+     * setKinDyn().
+     * @return True in case of success, false otherwise.
+     */
+    bool setKinDynCache(std::shared_ptr<System::KinDynComputationsCache> kinDynCache);
+
     /**
      * Set the set of variables required by the task. The variables are stored in the
      * System::VariablesHandler.
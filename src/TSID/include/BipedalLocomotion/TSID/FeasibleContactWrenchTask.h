@@ -8,12 +8,14 @@
 #ifndef BIPEDAL_LOCOMOTION_TSID_FEASIBLE_CONTACT_WRENCH_TASK_H
 #define BIPEDAL_LOCOMOTION_TSID_FEASIBLE_CONTACT_WRENCH_TASK_H
 
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include <manif/manif.h>
 
 #include <BipedalLocomotion/TSID/TSIDLinearTask.h>
-#include <BipedalLocomotion/Math/ContactWrenchCone.h>
 
 
 #include <iDynTree/KinDynComputations.h>
@@ -43,11 +45,27 @@ class FeasibleContactWrenchTask : public TSIDLinearTask
 
     ContactWrench m_contactWrench;
 
-    BipedalLocomotion::Math::ContactWrenchCone m_cone;
+    /**
+     * Constraint blocks associated to a contact geometry. The cone discretization is performed
+     * once, when the geometry is registered, and the blocks are swapped in O(1) at contact switch.
+     */
+    struct CachedGeometry
+    {
+        iDynTree::FrameIndex frameIndex; /**< Frame used to express the contact wrench */
+        Eigen::MatrixXd AinBodyCoordinate; /**< Matrix A written in body frame (cone constraints
+                                              plus the normal force feasibility rows) */
+        Eigen::VectorXd b; /**< Vector b associated to AinBodyCoordinate */
+    };
+
+    std::unordered_map<std::string, CachedGeometry> m_geometries; /**< Cache of the registered
+                                                                     contact geometries */
+    std::string m_activeGeometryName; /**< Name of the geometry currently used by the task */
 
     bool m_isInitialized{false}; /**< True if the task has been initialized. */
     bool m_isValid{false}; /**< True if the task is valid. */
 
+    std::size_t m_boundsGeneration{0}; /**< Counter incremented every time the vector b changes. */
+
     Eigen::MatrixXd m_AinBodyCoordinate; /**< Matrix A written in body frame */
 
     std::shared_ptr<iDynTree::KinDynComputations> m_kinDyn; /**< Pointer to a KinDynComputations
@@ -100,6 +118,43 @@ public:
      */
     void setContactActive(bool isActive);
 
+    /**
+     * Register an additional contact geometry in the task cache. The friction cone is discretized
+     * once, when this method is called, and the associated constraint blocks are stored keyed on
+     * the given name. The geometry registered by initialize() is stored under the contact frame
+     * name.
+     * @param geometryName name used to identify the geometry, e.g. the frame name possibly
+     * combined with the cone discretization.
+     * @param paramHandler pointer to the parameters handler. The required parameters are
+     * `frame_name` along with the parameters needed by Math::ContactWrenchCone (`number_of_slices`,
+     * `static_friction_coefficient`, `foot_limits_x` and `foot_limits_y`).
+     * @note All the registered geometries must share the cone discretization (i.e. the number of
+     * rows of the constraint) since the task size is fixed once finalize() is called.
+     * @return True in case of success, false otherwise.
+     */
+    bool addContactGeometry(const std::string& geometryName,
+                            std::weak_ptr<const ParametersHandler::IParametersHandler> paramHandler);
+
+    /**
+     * Select one of the registered contact geometries. The cached constraint blocks are swapped in
+     * without re-discretizing the cone, so this method can be safely called in the touchdown tick.
+     * The contact active state set with setContactActive() is preserved.
+     * @param geometryName name of a geometry registered with addContactGeometry() or by
+     * initialize().
+     * @return True in case of success, false otherwise.
+     */
+    bool setContactGeometry(const std::string& geometryName);
+
+    /**
+     * Get the generation of the task bounds. The counter is incremented every time the vector b
+     * changes (i.e. by setVariablesHandler(), setContactActive() and setContactGeometry()), while
+     * update() leaves it untouched since only the matrix A depends on the robot state. A solver
+     * can compare the value with the one seen at the previous iteration and re-upload the bounds
+     * only when they actually changed.
+     * @return the generation counter of the vector b.
+     */
+    std::size_t boundsGeneration() const;
+
     /**
      * Get the size of the task. (I.e the number of rows of the vector b)
      * @return the size of the task.
@@ -114,6 +114,14 @@ public:
      */
     bool update() override;
 
+    /**
+     * Get the structural non-zero column blocks of the task matrix. The joint dynamics couples
+     * only the robot acceleration, the joint torques and the contact wrench variables, each
+     * through one frame jacobian, so the columns outside those variables are structurally zero.
+     * @return the list of the structural non-zero column blocks.
+     */
+    std::vector<System::LinearTask::ColumnBlock> structuralColumnBlocks() const override;
+
     /**
      * Get the size of the task. (I.e the number of rows of the vector b)
      * @return the size of the task.
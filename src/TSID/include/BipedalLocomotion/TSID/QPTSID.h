@@ -143,12 +143,122 @@ public:
      * |    `joint_torques_variable_name`      |     `string`     |         Name of the variable contained in `VariablesHandler` describing the robot torque           |    Yes    |
      * |  `contact_wrench_variables_name`     | `vector<string>` |        List of the variables associated to the contact wrenches in the `VariablesHandler`          |    Yes    |
      * |             `verbosity`              |      `bool`      |                        Verbosity of the solver. Default value `false`                              |     No    |
+     * |    `eliminate_wrench_variables`      |      `bool`      | If true the contact wrench variables are eliminated from the QP. The task named `wrench_elimination_task_name` is solved in closed form for the wrenches (minimum-norm distribution) and the result is substituted into the remaining tasks, shrinking the QP accordingly. The wrenches returned by getOutput() are reconstructed from the distribution. Default value `false` |     No    |
+     * |    `wrench_elimination_task_name`    |     `string`     | Name of the equality constraint task (typically the base dynamics) solved in closed form for the wrenches. Required when `eliminate_wrench_variables` is true |     No    |
+     * |              `osqp_rho`              |     `double`     |               ADMM rho step of the OSQP solver. Default value `0.1` (the OSQP default)             |     No    |
+     * |             `osqp_sigma`             |     `double`     |             ADMM sigma step of the OSQP solver. Default value `1e-6` (the OSQP default)            |     No    |
+     * |            `osqp_scaling`            |      `int`       |        Number of scaling iterations of the OSQP solver. Default value `10` (the OSQP default)      |     No    |
+     * |      `problem_recording_folder`      |     `string`     | If not empty, every assembled QP instance is dumped in the given folder. The instances can be replayed offline by the osqp-settings-tuner utility to find the best solver settings. Default value empty (recording disabled) |     No    |
      * Where the generalized robot acceleration is a vector containing the base acceleration
      * (expressed in mixed representation) and the joint accelerations,
+     * @note initialize() can be called again with an updated handler to switch the wrench
+     * variable elimination mode. If the problem has already been finalized it is rebuilt
+     * internally, so the user does not need to call finalize() again.
+     * @note When the elimination is enabled getRawSolution() returns the reduced solution, i.e.
+     * the full variable vector without the wrench entries.
      * @return True in case of success, false otherwise.
      */
     bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler) override;
 
+    /**
+     * Store the warm-boot data (primal and dual variables of the last solve) in the given file.
+     * The data is keyed by a fingerprint of the problem (variables and task stack), so a file
+     * generated by a different problem is rejected when loaded.
+     * @param filePath path of the file.
+     * @note Call this method while shutting down, when a valid solution is available. The
+     * underlying OSQP API does not expose the factorization, so the file contains only the
+     * primal/dual variables: on the next startup the setup cost is still paid once, but the first
+     * solve converges as fast as a steady-state one.
+     * @return true in case of success, false otherwise.
+     */
+    bool storeWarmStartData(const std::string& filePath) const;
+
+    /**
+     * Load the warm-boot data stored with storeWarmStartData(). The primal and dual variables are
+     * fed to the solver before the first solve.
+     * @param filePath path of the file.
+     * @note Call this method after finalize(). If the file does not exist or belongs to a
+     * different problem the method returns false and the solver cold starts.
+     * @return true in case of success, false otherwise.
+     */
+    bool loadWarmStartData(const std::string& filePath);
+
+    /**
+     * Build a model-based primal seed for the solve following a contact switch. The solver
+     * automatically warm starts from the previous primal, but after a contact switch that point is
+     * infeasible and osqp spends iterations recovering from it. This method projects the previous
+     * solution through the contact change: the accelerations and the torques are kept, the
+     * wrenches of the contacts that broke are zeroed, and the wrenches of the new contacts are
+     * placed at the center of the friction cone, i.e. a pure normal force.
+     * @param activatedContactWrenchVariables names of the wrench variables associated to the
+     * contacts that just touched down.
+     * @param deactivatedContactWrenchVariables names of the wrench variables associated to the
+     * contacts that just broke.
+     * @param normalForce normal force used to seed the new contacts, typically the robot weight
+     * divided by the number of active contacts. The force is expressed in the same frame as the
+     * wrench variable.
+     * @note Call this method right before the advance() following the contact switch. The seed is
+     * consumed by a single solve.
+     * @note This method cannot be used when the wrench variable elimination is enabled, since the
+     * wrenches are not decision variables of the reduced problem.
+     * @return true in case of success, false otherwise.
+     */
+    bool warmStartContactSwitch(const std::vector<std::string>& activatedContactWrenchVariables,
+                                const std::vector<std::string>& deactivatedContactWrenchVariables,
+                                double normalForce);
+
+    /**
+     * Split the update of the tasks in groups executed concurrently when advance() is called.
+     * @param groups vector of groups. Each group is a vector of task names. The tasks belonging to
+     * the same group are updated serially on the same thread, while different groups are updated in
+     * parallel. The tasks not listed in any group are updated on the calling thread.
+     * @note This feature is opt-in. If this method is not called (or is called with an empty
+     * vector) all the tasks are updated serially as usual.
+     * @note This method should be called after ALL the tasks have been added with addTask().
+     * @warning The tasks belonging to different groups must not share non-thread-safe resources. In
+     * particular iDynTree::KinDynComputations is not thread-safe, so tasks sharing the same
+     * KinDynComputations object must belong to the same group.
+     * @return true in case of success, false otherwise.
+     */
+    bool setConcurrentTaskUpdateGroups(const std::vector<std::vector<std::string>>& groups);
+
+    /**
+     * Replace the per-task update loop with a user provided function. This is useful when the
+     * task list is frozen and the tasks are updated through a compile-time composed stack (see
+     * System::StaticTaskStack), avoiding the virtual dispatch of LinearTask::update().
+     * @param updater function updating ALL the tasks added to the solver. Passing a nullptr
+     * restores the default update loop.
+     * @note This method and setConcurrentTaskUpdateGroups() are mutually exclusive: the last one
+     * called wins.
+     * @warning The external updater bypasses the per-task update-rate scheduling (see
+     * setTaskUpdateDecimation).
+     * @return true in case of success, false otherwise.
+     */
+    bool setExternalTaskUpdater(std::function<bool()> updater) override;
+
+    /**
+     * Set the update decimation associated to an already existing task. A task with decimation
+     * equal to `d` is updated once every `d` calls to advance(), while the cached task matrices
+     * are reused in between. This is useful for tasks whose content changes at a rate lower than
+     * the solver one (e.g. TSID::VariableRegularizationTask or a posture task whose setpoint is
+     * refreshed by a slow planner).
+     * @param taskName name associated to the task.
+     * @param decimation number of calls to advance() between two consecutive updates of the task.
+     * The value must be strictly positive. 1 (the default for every task) means that the task is
+     * updated at every call to advance().
+     * @return true in case of success, false otherwise.
+     */
+    bool setTaskUpdateDecimation(const std::string& taskName, std::size_t decimation) override;
+
+    /**
+     * Mark an already existing task as dirty. The task is updated at the next call to advance()
+     * regardless of its update decimation, and its schedule restarts from there. Call this method
+     * when the task setpoint changes between two scheduled updates.
+     * @param taskName name associated to the task.
+     * @return true in case of success, false otherwise.
+     */
+    bool triggerTaskUpdate(const std::string& taskName) override;
+
     /**
      * Finalize the TSID.
      * @param handler parameter handler.
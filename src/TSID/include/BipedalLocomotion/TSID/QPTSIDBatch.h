@@ -0,0 +1,130 @@
+/**
+ * @file QPTSIDBatch.h
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_TSID_QP_TSID_BATCH_H
+#define BIPEDAL_LOCOMOTION_TSID_QP_TSID_BATCH_H
+
+#include <memory>
+#include <string>
+
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/System/VariablesHandler.h>
+#include <BipedalLocomotion/TSID/QPTSID.h>
+
+namespace BipedalLocomotion
+{
+
+namespace TSID
+{
+
+/**
+ * QPTSIDBatch is a facade that owns several QPTSID instances sharing the same problem structure,
+ * e.g. several copies of the same robot evaluated in parallel by a sampling based predictive
+ * controller. All the instances are initialized from the same parameter handler and finalized from
+ * the same variables handler, so the variable layout, the constraint stack and the solver settings
+ * are guaranteed to be identical. advance() solves all the instances with a parallel-for over a
+ * pool of persistent worker threads, one instance per thread.
+ * The user is expected to build the task stack of each instance independently, since the tasks
+ * wrap per-robot resources (e.g. an iDynTree::KinDynComputations object, which is not
+ * thread-safe):
+ * \code{.cpp}
+ * QPTSIDBatch batch;
+ * batch.initialize(handler); // contains number_of_instances and the QPTSID parameters
+ * for (std::size_t i = 0; i < batch.size(); i++)
+ * {
+ *     auto tsid = batch.instance(i).lock();
+ *     tsid->addTask(..., "base_dynamics_task", 0);
+ *     ...
+ * }
+ * batch.finalize(variablesHandler);
+ * \endcode
+ * @note Each instance keeps its own osqp workspace, since the factorization depends on the
+ * instance data.
+ */
+class QPTSIDBatch
+{
+    /**
+     * Private implementation
+     */
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+
+public:
+    /**
+     * Constructor.
+     */
+    QPTSIDBatch();
+
+    /**
+     * Destructor.
+     */
+    ~QPTSIDBatch();
+
+    /**
+     * Initialize the batch.
+     * @param handler pointer to the IParametersHandler interface.
+     * @note the following parameters are required by the class
+     * |     Parameter Name     | Type  |                          Description                          | Mandatory |
+     * |:----------------------:|:-----:|:-------------------------------------------------------------:|:---------:|
+     * | `number_of_instances`  | `int` | Number of QPTSID instances. It must be strictly positive      |    Yes    |
+     * The remaining parameters are forwarded to QPTSID::initialize() of every instance.
+     * @return True in case of success, false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
+
+    /**
+     * Get the number of instances.
+     * @return the number of QPTSID instances owned by the batch.
+     */
+    std::size_t size() const;
+
+    /**
+     * Get one of the instances, e.g. to build its task stack or to set a task setpoint.
+     * @param index index of the instance.
+     * @return a weak pointer to the instance. If the index is not valid the pointer is not
+     * lockable.
+     */
+    std::weak_ptr<QPTSID> instance(std::size_t index) const;
+
+    /**
+     * Finalize all the instances from the same variables handler.
+     * @param handler parameter handler.
+     * @note You should call this method after you add ALL the tasks to ALL the instances.
+     * @return true in case of success, false otherwise.
+     */
+    bool finalize(const System::VariablesHandler& handler);
+
+    /**
+     * Solve all the instances. The solves run concurrently on the worker threads, the first
+     * instance is solved on the calling thread.
+     * @return true if all the instances have been solved, false otherwise.
+     */
+    bool advance();
+
+    /**
+     * Get the outcome of one of the instances.
+     * @param index index of the instance.
+     * @return the state of the associated TSID. If the index is not valid an empty state is
+     * returned.
+     */
+    const TSIDState& getOutput(std::size_t index) const;
+
+    /**
+     * Return true if all the instances contain a valid output.
+     */
+    bool isOutputValid() const;
+
+    /**
+     * Return the description of the batch.
+     */
+    std::string toString() const;
+};
+
+} // namespace TSID
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_TSID_QP_TSID_BATCH_H
@@ -209,6 +209,18 @@ bool BaseDynamicsTask::update()
     return m_isValid;
 }
 
+std::vector<System::LinearTask::ColumnBlock> BaseDynamicsTask::structuralColumnBlocks() const
+{
+    std::vector<System::LinearTask::ColumnBlock> blocks;
+    blocks.push_back({m_robotAccelerationVariable.offset, m_robotAccelerationVariable.size});
+    for (const auto& contactWrench : m_contactWrenches)
+    {
+        blocks.push_back({contactWrench.variable.offset, contactWrench.variable.size});
+    }
+
+    return blocks;
+}
+
 std::size_t BaseDynamicsTask::size() const
 {
     return m_spatialVelocitySize;
@@ -28,6 +28,19 @@ bool CoMTask::setKinDyn(std::shared_ptr<iDynTree::KinDynComputations> kinDyn)
     return true;
 }
 
+bool CoMTask::setKinDynCache(std::shared_ptr<System::KinDynComputationsCache> kinDynCache)
+{
+    if (kinDynCache == nullptr || kinDynCache->kinDyn() == nullptr)
+    {
+        log()->error("[CoMTask::setKinDynCache] Invalid kinDynCache object.");
+        return false;
+    }
+
+    m_kinDynCache = kinDynCache;
+    m_kinDyn = kinDynCache->kinDyn();
+    return true;
+}
+
 bool CoMTask::setVariablesHandler(const System::VariablesHandler& variablesHandler)
 {
     if (!m_isInitialized)
@@ -172,15 +185,25 @@ bool CoMTask::update()
 
     m_isValid = false;
 
-    // set the state
-    m_R3Controller.setState(toEigen(m_kinDyn->getCenterOfMassPosition()),
-                            toEigen(m_kinDyn->getCenterOfMassVelocity()));
+    // set the state. If the cache is available the center of mass quantities are evaluated at
+    // most once per state generation even if several tasks consume them
+    if (m_kinDynCache != nullptr)
+    {
+        m_R3Controller.setState(m_kinDynCache->getCenterOfMassPosition(),
+                                m_kinDynCache->getCenterOfMassVelocity());
+    } else
+    {
+        m_R3Controller.setState(toEigen(m_kinDyn->getCenterOfMassPosition()),
+                                toEigen(m_kinDyn->getCenterOfMassVelocity()));
+    }
 
     // update the controller
     m_R3Controller.computeControlLaw();
 
     Eigen::Vector3d bFullDof = m_R3Controller.getControl().coeffs()
-        - iDynTree::toEigen(m_kinDyn->getCenterOfMassBiasAcc());
+        - ((m_kinDynCache != nullptr)
+               ? m_kinDynCache->getCenterOfMassBiasAcc()
+               : Eigen::Vector3d(iDynTree::toEigen(m_kinDyn->getCenterOfMassBiasAcc())));
 
     // if we want to control all 3 DoF we avoid to lose performances
     if (m_DoFs == m_linearVelocitySize)
@@ -188,7 +211,15 @@ bool CoMTask::update()
         m_b = bFullDof;
 
         // get the CoM jacobian
-        if (!m_kinDyn->getCenterOfMassJacobian(this->subA(m_robotAccelerationVariable)))
+        if (m_kinDynCache != nullptr)
+        {
+            if (!m_kinDynCache->getCenterOfMassJacobian(m_jacobian))
+            {
+                log()->error("[CoMTask::update] Unable to get the jacobian.");
+                return m_isValid;
+            }
+            toEigen(this->subA(m_robotAccelerationVariable)) = m_jacobian;
+        } else if (!m_kinDyn->getCenterOfMassJacobian(this->subA(m_robotAccelerationVariable)))
         {
             log()->error("[CoMTask::update] Unable to get the jacobian.");
             return m_isValid;
@@ -196,7 +227,10 @@ bool CoMTask::update()
     } else
     {
         // get the CoM jacobian
-        if (!m_kinDyn->getCenterOfMassJacobian(m_jacobian))
+        const bool ok = (m_kinDynCache != nullptr)
+                            ? m_kinDynCache->getCenterOfMassJacobian(m_jacobian)
+                            : m_kinDyn->getCenterOfMassJacobian(m_jacobian);
+        if (!ok)
         {
             log()->error("[CoMTask::update] Unable to get the jacobian.");
             return m_isValid;
@@ -5,6 +5,7 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <BipedalLocomotion/Math/ContactWrenchCone.h>
 #include <BipedalLocomotion/Math/Wrench.h>
 #include <BipedalLocomotion/TSID/FeasibleContactWrenchTask.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
@@ -56,33 +57,25 @@ bool FeasibleContactWrenchTask::setVariablesHandler(const System::VariablesHandl
         return false;
     }
 
-    // the additional constrains refer to the normal force
-    constexpr std::size_t normalForceFeasibilityConstraints = 2;
-    const auto rowsOfConeMatrix = m_cone.getA().rows();
+    // the constraint blocks are precomputed by addContactGeometry() and stored in the cache
+    const auto& geometry = m_geometries.at(m_activeGeometryName);
 
     // resize the matrices
-    m_A.resize(normalForceFeasibilityConstraints + rowsOfConeMatrix,
-               variablesHandler.getNumberOfVariables());
+    m_A.resize(geometry.AinBodyCoordinate.rows(), variablesHandler.getNumberOfVariables());
     m_A.setZero();
-    m_b.resize(normalForceFeasibilityConstraints + rowsOfConeMatrix);
 
-    // the vector b will contains the cone vector plus the constraint related to the contact normal
+    // the vector b contains the cone vector plus the constraint related to the contact normal
     // force
     // 0 <= fz <= max_normal_force
     // [0 0 -1 0 0 0 ] * [fx fy fz taux tauy tauz]' <= 0
     // [0 0 1 0 0 0 ] * [fx fy fz taux tauy tauz]' <= max_normal_force
     // if the task is enabled max_normal_force is equal to the max double. If the task is disabled
     // max_normal_force is equal to 0
-    m_b.head(rowsOfConeMatrix) = m_cone.getB();
-    m_b.tail<2>()(0) = 0;
-    m_b.tail<2>()(1) = std::numeric_limits<double>::max();
+    m_b = geometry.b;
+    m_boundsGeneration++;
 
-    // the matrix A in body coordinate is fixed
-    m_AinBodyCoordinate.resize(normalForceFeasibilityConstraints + rowsOfConeMatrix,
-                               BipedalLocomotion::Math::Wrenchd::SizeAtCompileTime);
-    m_AinBodyCoordinate.topRows(rowsOfConeMatrix) = m_cone.getA();
-    m_AinBodyCoordinate.bottomRows<2>() << 0, 0, -1, 0, 0, 0,
-                                           0, 0,  1, 0, 0, 0;
+    // the matrix A in body coordinate is fixed (given the active geometry)
+    m_AinBodyCoordinate = geometry.AinBodyCoordinate;
 
     return true;
 }
@@ -130,12 +123,15 @@ bool FeasibleContactWrenchTask::initialize(std::weak_ptr<const IParametersHandle
         return false;
     }
 
-    // initialize the cone
-    if (!m_cone.initialize(paramHandler))
+    // discretize the cone and cache the associated geometry under the contact frame name.
+    // Additional geometries can be registered with addContactGeometry() and swapped in O(1) with
+    // setContactGeometry()
+    if (!this->addContactGeometry(frameName, paramHandler))
     {
-        log()->error("{} Unable to initialize the cone.", errorPrefix);
+        log()->error("{} Unable to register the contact geometry.", errorPrefix);
         return false;
     }
+    m_activeGeometryName = frameName;
 
     // set the description
     m_description = "Feasible contact wrench - Frame: " + frameName + ".";
@@ -190,15 +186,134 @@ bool FeasibleContactWrenchTask::update()
 
 void FeasibleContactWrenchTask::setContactActive(bool isActive)
 {
-    if (isActive)
+    // the last element of the vector b can be used to disable / enable the task
+    const double maxNormalForce = isActive ? std::numeric_limits<double>::max() : 0.0;
+
+    if (m_b.tail<1>()(0) != maxNormalForce)
+    {
+        m_b.tail<1>()(0) = maxNormalForce;
+        m_boundsGeneration++;
+    }
+}
+
+bool FeasibleContactWrenchTask::addContactGeometry(
+    const std::string& geometryName,
+    std::weak_ptr<const IParametersHandler> paramHandler)
+{
+    constexpr auto errorPrefix = "[FeasibleContactWrenchTask::addContactGeometry]";
+
+    if (m_kinDyn == nullptr || !m_kinDyn->isValid())
     {
-        // the last element of the vector b can be used to disable / enable the task
-        m_b.tail<1>()(0) = std::numeric_limits<double>::max();
-    } else
+        log()->error("{} KinDynComputations object is not valid.", errorPrefix);
+        return false;
+    }
+
+    if (m_geometries.find(geometryName) != m_geometries.end())
     {
-        // the last element of the vector b can be used to disable / enable the task
-        m_b.tail<1>()(0) = 0;
+        log()->error("{} A geometry named {} already exists.", errorPrefix, geometryName);
+        return false;
+    }
+
+    auto ptr = paramHandler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} The parameter handler is not valid.", errorPrefix);
+        return false;
+    }
+
+    CachedGeometry geometry;
+    std::string frameName;
+    if (!ptr->getParameter("frame_name", frameName)
+        || (geometry.frameIndex = m_kinDyn->model().getFrameIndex(frameName))
+               == iDynTree::FRAME_INVALID_INDEX)
+    {
+        log()->error("{} Error while retrieving the frame associated to the geometry named {}.",
+                     errorPrefix,
+                     geometryName);
+        return false;
+    }
+
+    // discretize the cone. This is the expensive operation the cache saves at contact switch
+    BipedalLocomotion::Math::ContactWrenchCone cone;
+    if (!cone.initialize(paramHandler))
+    {
+        log()->error("{} Unable to initialize the cone for the geometry named {}.",
+                     errorPrefix,
+                     geometryName);
+        return false;
     }
+
+    // the additional constrains refer to the normal force
+    constexpr std::size_t normalForceFeasibilityConstraints = 2;
+    const auto rowsOfConeMatrix = cone.getA().rows();
+
+    if (!m_geometries.empty()
+        && Eigen::Index(normalForceFeasibilityConstraints) + rowsOfConeMatrix
+               != m_geometries.cbegin()->second.AinBodyCoordinate.rows())
+    {
+        log()->error("{} The cone discretization of the geometry named {} is not compatible with "
+                     "the already registered geometries. The size of the task cannot change.",
+                     errorPrefix,
+                     geometryName);
+        return false;
+    }
+
+    geometry.AinBodyCoordinate.resize(normalForceFeasibilityConstraints + rowsOfConeMatrix,
+                                      BipedalLocomotion::Math::Wrenchd::SizeAtCompileTime);
+    geometry.AinBodyCoordinate.topRows(rowsOfConeMatrix) = cone.getA();
+    geometry.AinBodyCoordinate.bottomRows<2>() << 0, 0, -1, 0, 0, 0,
+                                                  0, 0,  1, 0, 0, 0;
+
+    geometry.b.resize(normalForceFeasibilityConstraints + rowsOfConeMatrix);
+    geometry.b.head(rowsOfConeMatrix) = cone.getB();
+    geometry.b.tail<2>()(0) = 0;
+    geometry.b.tail<2>()(1) = std::numeric_limits<double>::max();
+
+    m_geometries.emplace(geometryName, std::move(geometry));
+
+    return true;
+}
+
+bool FeasibleContactWrenchTask::setContactGeometry(const std::string& geometryName)
+{
+    constexpr auto errorPrefix = "[FeasibleContactWrenchTask::setContactGeometry]";
+
+    auto geometry = m_geometries.find(geometryName);
+    if (geometry == m_geometries.end())
+    {
+        log()->error("{} No geometry named {} has been registered. Please call "
+                     "addContactGeometry().",
+                     errorPrefix,
+                     geometryName);
+        return false;
+    }
+
+    if (geometryName == m_activeGeometryName)
+    {
+        return true;
+    }
+
+    m_contactWrench.frameIndex = geometry->second.frameIndex;
+    m_AinBodyCoordinate = geometry->second.AinBodyCoordinate;
+
+    // the last element of b encodes the contact active state set with setContactActive() and must
+    // survive the switch
+    if (m_b.size() == geometry->second.b.size())
+    {
+        const double maxNormalForce = m_b.tail<1>()(0);
+        m_b = geometry->second.b;
+        m_b.tail<1>()(0) = maxNormalForce;
+        m_boundsGeneration++;
+    }
+
+    m_activeGeometryName = geometryName;
+
+    return true;
+}
+
+std::size_t FeasibleContactWrenchTask::boundsGeneration() const
+{
+    return m_boundsGeneration;
 }
 
 std::size_t FeasibleContactWrenchTask::size() const
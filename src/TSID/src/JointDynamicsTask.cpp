@@ -232,6 +232,19 @@ bool JointDynamicsTask::update()
     return m_isValid;
 }
 
+std::vector<System::LinearTask::ColumnBlock> JointDynamicsTask::structuralColumnBlocks() const
+{
+    std::vector<System::LinearTask::ColumnBlock> blocks;
+    blocks.push_back({m_robotAccelerationVariable.offset, m_robotAccelerationVariable.size});
+    blocks.push_back({m_jointsTorqueVariable.offset, m_jointsTorqueVariable.size});
+    for (const auto& contactWrench : m_contactWrenches)
+    {
+        blocks.push_back({contactWrench.variable.offset, contactWrench.variable.size});
+    }
+
+    return blocks;
+}
+
 std::size_t JointDynamicsTask::size() const
 {
     constexpr auto errorMessage = "[JointTrackingTask::size] Please call setKinDyn method before. "
@@ -9,58 +9,144 @@
 #include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
 #include <BipedalLocomotion/TSID/JointDynamicsTask.h>
 #include <BipedalLocomotion/TSID/QPFixedBaseTSID.h>
-#include <BipedalLocomotion/TSID/SE3Task.h>
+#include <BipedalLocomotion/TSID/TSIDLinearTask.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
+#include <iDynTree/Core/EigenHelpers.h>
+
 using namespace BipedalLocomotion;
 using namespace BipedalLocomotion::TSID;
 using namespace BipedalLocomotion::ParametersHandler;
 
-struct QPFixedBaseTSID::Impl
+namespace
 {
-    std::string baseLink;
-    std::shared_ptr<JointDynamicsTask> dynamicsTask;
-    std::shared_ptr<SE3Task> baseSE3Task;
-    const std::string baseContactWrenchVariableName{"base_contact_wrench"};
-    bool isKinDynSet{false};
 
-    bool createBaseSE3Task(std::shared_ptr<const IParametersHandler> handler)
+/**
+ * BaseAccelerationLockTask constrains the first six components of the robot acceleration variable
+ * to zero. Since the base of the robot is fixed, the jacobian of the base link is a constant
+ * selection matrix and its derivative is identically zero, hence the task is equivalent to a
+ * zero-acceleration SE3Task on the base link while no jacobian needs to be evaluated at every
+ * update.
+ */
+class BaseAccelerationLockTask : public TSIDLinearTask
+{
+    System::VariablesHandler::VariableDescription m_robotAccelerationVariable; /**< Variable
+                                                                                  describing the
+                                                                                  robot acceleration
+                                                                                  (base + joint) */
+    std::string m_robotAccelerationVariableName;
+
+    static constexpr std::size_t m_spatialVelocitySize{6}; /**< Size of the spatial velocity vector.
+                                                            */
+
+    bool m_isValid{false}; /**< True if the task is valid. */
+
+public:
+    bool
+    initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> paramHandler) override
     {
-        constexpr auto logPrefix = "[QPFixedBaseTSID::createBaseSE3Task]";
+        constexpr auto logPrefix = "[BaseAccelerationLockTask::initialize]";
 
-        auto baseSE3ParameterHandler = std::make_shared<StdImplementation>();
-        std::string robotAccelerationVariableName;
-        if (!handler->getParameter("robot_acceleration_variable_name",
-                                   robotAccelerationVariableName))
+        auto ptr = paramHandler.lock();
+        if (ptr == nullptr)
         {
-            log()->error("{} Unable to get the parameter 'robot_acceleration_variable_name'",
+            log()->error("{} The parameter handler is not valid.", logPrefix);
+            return false;
+        }
+
+        if (!ptr->getParameter("robot_acceleration_variable_name",
+                               m_robotAccelerationVariableName))
+        {
+            log()->error("{} Unable to get the parameter 'robot_acceleration_variable_name'.",
                          logPrefix);
             return false;
         }
-        baseSE3ParameterHandler->setParameter("robot_acceleration_variable_name",
-                                              robotAccelerationVariableName);
-
-        // This task is to consider the robot fixed base, so the controller gains are set to 0.
-        // Read it a zero acceleration task
-        baseSE3ParameterHandler->setParameter("kp_linear", 0.0);
-        baseSE3ParameterHandler->setParameter("kd_linear", 0.0);
-        baseSE3ParameterHandler->setParameter("kp_angular", 0.0);
-        baseSE3ParameterHandler->setParameter("kd_angular", 0.0);
-        baseSE3ParameterHandler->setParameter("frame_name", baseLink);
-
-        if (!baseSE3Task->initialize(baseSE3ParameterHandler))
+
+        m_description = "Base acceleration lock task";
+
+        return true;
+    }
+
+    bool setVariablesHandler(const System::VariablesHandler& variablesHandler) override
+    {
+        constexpr auto logPrefix = "[BaseAccelerationLockTask::setVariablesHandler]";
+
+        if (!variablesHandler.getVariable(m_robotAccelerationVariableName,
+                                          m_robotAccelerationVariable))
+        {
+            log()->error("{} Unable to get the variable named {}.",
+                         logPrefix,
+                         m_robotAccelerationVariableName);
+            return false;
+        }
+
+        if (m_robotAccelerationVariable.size < m_spatialVelocitySize)
         {
-            log()->error("{} Error initializing se3task on the base", logPrefix);
+            log()->error("{} The variable named {} must contain at least the base spatial "
+                         "acceleration. Expected minimum size: {}. Given size: {}.",
+                         logPrefix,
+                         m_robotAccelerationVariableName,
+                         m_spatialVelocitySize,
+                         m_robotAccelerationVariable.size);
             return false;
         }
 
-        baseSE3Task->setSetPoint(manif::SE3d::Identity(),
-                                 manif::SE3d::Tangent::Zero(),
-                                 manif::SE3d::Tangent::Zero());
+        // the task matrix is constant. It selects the base components of the robot acceleration
+        //      _                 _
+        // A = |  I_{6x6}  0_{6xn} |
+        //     |_                 _|
+        m_A.resize(m_spatialVelocitySize, variablesHandler.getNumberOfVariables());
+        m_A.setZero();
+        m_b = Eigen::VectorXd::Zero(m_spatialVelocitySize);
+
+        iDynTree::toEigen(this->subA(m_robotAccelerationVariable))
+            .leftCols<m_spatialVelocitySize>()
+            .diagonal()
+            .setConstant(1.0);
+
+        m_isValid = true;
 
         return true;
     }
 
+    bool update() override
+    {
+        // the task is constant. Nothing to do here
+        return m_isValid;
+    }
+
+    std::vector<System::LinearTask::ColumnBlock> structuralColumnBlocks() const override
+    {
+        return {{m_robotAccelerationVariable.offset,
+                 static_cast<std::ptrdiff_t>(m_spatialVelocitySize)}};
+    }
+
+    std::size_t size() const override
+    {
+        return m_spatialVelocitySize;
+    }
+
+    Type type() const override
+    {
+        return Type::equality;
+    }
+
+    bool isValid() const override
+    {
+        return m_isValid;
+    }
+};
+
+} // namespace
+
+struct QPFixedBaseTSID::Impl
+{
+    std::string baseLink;
+    std::shared_ptr<JointDynamicsTask> dynamicsTask;
+    std::shared_ptr<BaseAccelerationLockTask> baseLockTask;
+    const std::string baseContactWrenchVariableName{"base_contact_wrench"};
+    bool isKinDynSet{false};
+
     bool createDynamicsTask(std::shared_ptr<const IParametersHandler> handler)
     {
         constexpr auto logPrefix = "[QPFixedBaseTSID::createDynamicsTask]";
@@ -116,7 +202,7 @@ QPFixedBaseTSID::QPFixedBaseTSID()
 {
     m_pimpl = std::make_unique<QPFixedBaseTSID::Impl>();
 
-    m_pimpl->baseSE3Task = std::make_shared<SE3Task>();
+    m_pimpl->baseLockTask = std::make_shared<BaseAccelerationLockTask>();
     m_pimpl->dynamicsTask = std::make_shared<JointDynamicsTask>();
 }
 
@@ -132,12 +218,6 @@ bool QPFixedBaseTSID::setKinDyn(std::shared_ptr<iDynTree::KinDynComputations> ki
         return false;
     }
 
-    if (!m_pimpl->baseSE3Task->setKinDyn(kinDyn))
-    {
-        log()->error("{} Unable to set the kinDyn object for SE3Task on the base.", logPrefix);
-        return false;
-    }
-
     if (!m_pimpl->dynamicsTask->setKinDyn(kinDyn))
     {
         log()->error("{} Unable to set the kinDyn object for dynamicsTask.", logPrefix);
@@ -174,9 +254,11 @@ bool QPFixedBaseTSID::initialize(std::weak_ptr<const ParametersHandler::IParamet
     cloneHandler->setParameter("contact_wrench_variables_name",
                                std::vector<std::string>{m_pimpl->baseContactWrenchVariableName});
 
-    if (!m_pimpl->createBaseSE3Task(cloneHandler))
+    // the base lock task reads the robot acceleration variable name from the same handler of the
+    // solver
+    if (!m_pimpl->baseLockTask->initialize(cloneHandler))
     {
-        log()->error("{} Error creating SE3task for the base.", logPrefix);
+        log()->error("{} Error initializing the lock task on the base.", logPrefix);
         return false;
     }
     if (!m_pimpl->createDynamicsTask(cloneHandler))
@@ -192,7 +274,7 @@ bool QPFixedBaseTSID::initialize(std::weak_ptr<const ParametersHandler::IParamet
     }
 
     constexpr std::size_t highPriority = 0;
-    this->addTask(m_pimpl->baseSE3Task, "base_se3_task", highPriority);
+    this->addTask(m_pimpl->baseLockTask, "base_lock_task", highPriority);
     this->addTask(m_pimpl->dynamicsTask, "dynamics_task", highPriority);
 
     return true;
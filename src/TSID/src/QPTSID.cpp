@@ -5,12 +5,20 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
 #include <OsqpEigen/Constants.hpp>
 #include <OsqpEigen/OsqpEigen.h>
 
 #include <BipedalLocomotion/Math/Wrench.h>
 #include <BipedalLocomotion/System/ConstantWeightProvider.h>
 #include <BipedalLocomotion/System/ILinearTaskSolver.h>
+#include <BipedalLocomotion/System/ParallelTaskGroupUpdater.h>
+#include <BipedalLocomotion/System/TimeProfiler.h>
 #include <BipedalLocomotion/TSID/QPTSID.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
@@ -28,6 +36,38 @@ struct QPTSID::Impl
         std::shared_ptr<const System::WeightProviderPort> weightProvider;
         Eigen::MatrixXd tmp; /**< This is a temporary matrix useful to reduce dynamics allocation
                                 in advance method */
+
+        Eigen::MatrixXd reducedA; /**< Task matrix expressed in the reduced variable set. Used
+                                     only when the wrench variable elimination is enabled. */
+        Eigen::MatrixXd wrenchA; /**< Columns of the task matrix associated to the contact wrench
+                                    variables. Used only when the wrench variable elimination is
+                                    enabled. */
+        Eigen::VectorXd reducedB; /**< Task vector expressed in the reduced variable set. */
+
+        std::size_t updateDecimation{1}; /**< Number of calls to advance() between two consecutive
+                                            updates of the task. */
+        std::size_t updateCountdown{0}; /**< Number of calls to advance() before the next update of
+                                           the task. */
+        bool updateRequested{false}; /**< True if the task has been marked as dirty with
+                                        triggerTaskUpdate(). */
+
+        /**
+         * Advance the update schedule of the task. The task is updated when the countdown expires
+         * or when it has been explicitly marked as dirty, otherwise the cached matrices are
+         * reused.
+         */
+        bool shouldUpdate()
+        {
+            if (updateRequested || updateCountdown == 0)
+            {
+                updateRequested = false;
+                updateCountdown = updateDecimation - 1;
+                return true;
+            }
+
+            updateCountdown--;
+            return false;
+        }
     };
 
     std::unordered_map<std::string, TaskWithPriority> tasks; /**< This is the task list containg the
@@ -35,16 +75,26 @@ struct QPTSID::Impl
                                                                 class and externally by the user.
                                                                 The tasks are both constraints and
                                                                 costs. */
-    std::vector<std::reference_wrapper<const TaskWithPriority>> constraints; /**< List of tasks
-                                                                                representing
-                                                                                constraints
-                                                                                (priority = 0). */
+    std::vector<std::reference_wrapper<TaskWithPriority>> constraints; /**< List of tasks
+                                                                          representing constraints
+                                                                          (priority = 0). */
     std::vector<std::reference_wrapper<TaskWithPriority>> costs; /**< List of tasks representing
                                                                     costs (priority = 1). */
     std::size_t numberOfConstraints;
 
     bool isVerbose{false};
 
+    /** OSQP solver settings. The defaults match the OSQP ones, so the behavior does not change
+     * unless the corresponding parameters are provided, e.g. with the values found by the
+     * osqp-settings-tuner utility. */
+    double osqpRho{0.1};
+    double osqpSigma{1e-6};
+    int osqpScaling{10};
+
+    std::string problemRecordingFolder; /**< When not empty, every assembled QP instance is dumped
+                                           in this folder for offline settings tuning. */
+    std::size_t recordedProblems{0}; /**< Number of QP instances dumped so far. */
+
     bool isFirstIteration{true};
     bool isValid{false};
     bool isInitialized{false};
@@ -65,13 +115,139 @@ struct QPTSID::Impl
     Eigen::VectorXd lowerBound;
     Eigen::VectorXd upperBound;
 
+    /** Persistent sparse matrices whose sparsity pattern is computed once in finalize(). The
+     * hessian is dense, while the constraint matrix pattern is built from the structural column
+     * blocks published by the constraint tasks (see LinearTask::structuralColumnBlocks()). In
+     * advance() only the values are refreshed, so osqp-eigen detects an unchanged pattern and
+     * takes the value-only update path, reusing the KKT factorization across ticks. */
+    Eigen::SparseMatrix<double> hessianSparse;
+    Eigen::SparseMatrix<double> constraintMatrixSparse;
+
+    /** Optional concurrent update of the tasks. The groups are set by the user with
+     * QPTSID::setConcurrentTaskUpdateGroups(). */
+    System::ParallelTaskGroupUpdater parallelUpdater;
+    bool useConcurrentUpdate{false};
+
+    /** Profiler sections timing the phases of advance(). The samples are recorded only if the
+     * framework is compiled with the FRAMEWORK_ENABLE_PROFILER option. */
+    std::ptrdiff_t taskUpdateSection{System::TimeProfiler::InvalidSectionIndex};
+    std::ptrdiff_t qpSolveSection{System::TimeProfiler::InvalidSectionIndex};
+
+    Eigen::VectorXd warmStartPrimal; /**< Primal variable loaded from the warm-boot file. */
+    Eigen::VectorXd warmStartDual; /**< Dual variable loaded from the warm-boot file. */
+    bool hasWarmStart{false}; /**< True if a warm-boot file has been successfully loaded. */
+
+    Eigen::VectorXd projectedPrimal; /**< Primal seed built by warmStartContactSwitch() projecting
+                                        the previous solution through a contact change. */
+    bool hasProjectedPrimal{false}; /**< True if projectedPrimal must be fed to the solver at the
+                                       next solve. */
+
+    /** Wrench variable elimination (reduced) mode. When enabled the contact wrench variables are
+     * removed from the QP: the elimination task (typically the base dynamics) is solved in closed
+     * form for the wrenches, and the resulting minimum-norm distribution is substituted into the
+     * remaining tasks. */
+    bool eliminateWrenchVariables{false};
+    std::string eliminationTaskName; /**< Name of the constraint task solved in closed form for
+                                        the wrenches. */
+    std::shared_ptr<QPTSID::Task> eliminationTask; /**< Pointer to the elimination task. */
+    System::VariablesHandler variablesHandler; /**< Handler stored at finalize() time. It allows
+                                                  initialize() to rebuild the problem when the
+                                                  elimination mode changes without asking the user
+                                                  to call finalize() again. */
+    bool hasVariablesHandler{false}; /**< True if finalize() has stored the variables handler. */
+    std::vector<Eigen::Index> reducedToFull; /**< Map from the reduced to the full column index. */
+    std::vector<Eigen::Index> wrenchToFull; /**< Map from the stacked wrench to the full column
+                                               index. */
+    Eigen::Index reducedRobotAccelerationOffset{0}; /**< Offset of the robot acceleration variable
+                                                       in the reduced variable set. */
+    Eigen::Index reducedJointTorquesOffset{0}; /**< Offset of the joint torques variable in the
+                                                  reduced variable set. */
+    Eigen::MatrixXd eliminationD; /**< Elimination task columns associated to the kept variables. */
+    Eigen::MatrixXd eliminationS; /**< Elimination task columns associated to the wrenches. */
+    Eigen::MatrixXd eliminationW; /**< Wrench distribution: f = eliminationW x + eliminationF. */
+    Eigen::VectorXd eliminationF; /**< Constant term of the wrench distribution. */
+    Eigen::VectorXd wrenchSolution; /**< Wrenches reconstructed from the reduced solution. */
+    Eigen::CompleteOrthogonalDecomposition<Eigen::MatrixXd> eliminationDecomposition; /**<
+                                        Decomposition used to compute the wrench distribution. */
+
+    /**
+     * Express a task in the reduced variable set by substituting the wrench distribution into the
+     * task matrices.
+     */
+    void reduceTask(TaskWithPriority& taskWithPriority)
+    {
+        Eigen::Ref<const Eigen::MatrixXd> A = taskWithPriority.task->getA();
+
+        for (std::size_t i = 0; i < this->reducedToFull.size(); i++)
+        {
+            taskWithPriority.reducedA.col(i) = A.col(this->reducedToFull[i]);
+        }
+        for (std::size_t i = 0; i < this->wrenchToFull.size(); i++)
+        {
+            taskWithPriority.wrenchA.col(i) = A.col(this->wrenchToFull[i]);
+        }
+
+        taskWithPriority.reducedA.noalias() += taskWithPriority.wrenchA * this->eliminationW;
+        taskWithPriority.reducedB = taskWithPriority.task->getB();
+        taskWithPriority.reducedB.noalias() -= taskWithPriority.wrenchA * this->eliminationF;
+    }
+
+    /**
+     * Compute a fingerprint of the optimization problem. Two problems with the same variables and
+     * the same task stack (names, priorities and sizes) share the fingerprint, so warm-boot data
+     * stored by one instance can be safely consumed by the other.
+     */
+    std::size_t problemFingerprint() const
+    {
+        std::vector<std::string> taskDescriptions;
+        for (const auto& [name, task] : this->tasks)
+        {
+            taskDescriptions.push_back(name + ":" + std::to_string(task.priority) + ":"
+                                       + std::to_string(task.task->size()));
+        }
+        std::sort(taskDescriptions.begin(), taskDescriptions.end());
+
+        std::ostringstream oss;
+        oss << this->robotAccelerationVariable.name << ";" << this->jointTorquesVariable.name
+            << ";" << this->hessian.rows() << ";" << this->numberOfConstraints;
+        for (const auto& description : taskDescriptions)
+        {
+            oss << ";" << description;
+        }
+
+        return std::hash<std::string>{}(oss.str());
+    }
+
+    /**
+     * Copy the values of the dense matrices into the persistent sparse structures. The hessian
+     * pattern is fully populated and column-major, so its copy is a plain memcpy of the value
+     * array. The constraint matrix pattern contains only the structural non-zeros, hence the copy
+     * walks the stored entries.
+     */
+    void syncSparseMatrices()
+    {
+        Eigen::Map<Eigen::VectorXd>(this->hessianSparse.valuePtr(), this->hessian.size())
+            = Eigen::Map<const Eigen::VectorXd>(this->hessian.data(), this->hessian.size());
+
+        for (int k = 0; k < this->constraintMatrixSparse.outerSize(); k++)
+        {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(this->constraintMatrixSparse, k);
+                 it;
+                 ++it)
+            {
+                it.valueRef() = this->constraintMatrix(it.row(), it.col());
+            }
+        }
+    }
+
     bool initializeSolver()
     {
         constexpr auto logPrefix = "[QPTSID::Impl::initializeSolver]";
 
+        this->syncSparseMatrices();
+
         // Hessian matrix
-        Eigen::SparseMatrix<double> hessianSparse = this->hessian.sparseView();
-        if (!this->solver.data()->setHessianMatrix(hessianSparse))
+        if (!this->solver.data()->setHessianMatrix(this->hessianSparse))
         {
             log()->error("{} Unable to set the hessian matrix.", logPrefix);
             return false;
@@ -84,8 +260,7 @@ struct QPTSID::Impl
             return false;
         }
 
-        Eigen::SparseMatrix<double> constraintsMatrixSparse = this->constraintMatrix.sparseView();
-        if (!this->solver.data()->setLinearConstraintsMatrix(constraintsMatrixSparse))
+        if (!this->solver.data()->setLinearConstraintsMatrix(this->constraintMatrixSparse))
         {
             log()->error("{} Unable to set the constraint matrix.", logPrefix);
             return false;
@@ -109,9 +284,12 @@ struct QPTSID::Impl
     bool updateSolver()
     {
         constexpr auto logPrefix = "[QPTSID::Impl::updateSolver]";
-        // Hessian matrix
-        Eigen::SparseMatrix<double> hessianSparse = this->hessian.sparseView();
-        if (!this->solver.updateHessianMatrix(hessianSparse))
+
+        this->syncSparseMatrices();
+
+        // Hessian matrix. Since the sparsity pattern is unchanged, osqp-eigen performs a
+        // value-only update
+        if (!this->solver.updateHessianMatrix(this->hessianSparse))
         {
             log()->error("{} Unable to set the hessian matrix.", logPrefix);
             return false;
@@ -124,8 +302,7 @@ struct QPTSID::Impl
             return false;
         }
 
-        Eigen::SparseMatrix<double> constraintsMatrixSparse = this->constraintMatrix.sparseView();
-        if (!this->solver.updateLinearConstraintsMatrix(constraintsMatrixSparse))
+        if (!this->solver.updateLinearConstraintsMatrix(this->constraintMatrixSparse))
         {
             log()->error("{} Unable to set the constraint matrix.", logPrefix);
             return false;
@@ -139,6 +316,43 @@ struct QPTSID::Impl
 
         return true;
     }
+
+    /**
+     * Dump the assembled QP instance in the recording folder as a plain text file. The instances
+     * can be replayed offline by the osqp-settings-tuner utility to sweep the solver settings on
+     * the real problems solved by the controller.
+     */
+    void recordProblem()
+    {
+        constexpr auto logPrefix = "[QPTSID::Impl::recordProblem]";
+
+        std::ostringstream fileName;
+        fileName << this->problemRecordingFolder << "/qp_instance_" << std::setw(6)
+                 << std::setfill('0') << this->recordedProblems << ".txt";
+
+        std::ofstream file(fileName.str());
+        if (!file.is_open())
+        {
+            log()->warn("{} Unable to open the file named {}. The problem recording is disabled.",
+                        logPrefix,
+                        fileName.str());
+            this->problemRecordingFolder.clear();
+            return;
+        }
+
+        const Eigen::IOFormat format(Eigen::FullPrecision, Eigen::DontAlignCols, " ", "\n");
+        file << this->hessian.rows() << " " << this->constraintMatrix.rows() << "\n";
+        file << this->hessian.format(format) << "\n";
+        file << this->gradient.transpose().format(format) << "\n";
+        if (this->constraintMatrix.rows() > 0)
+        {
+            file << this->constraintMatrix.format(format) << "\n";
+            file << this->lowerBound.transpose().format(format) << "\n";
+            file << this->upperBound.transpose().format(format) << "\n";
+        }
+
+        this->recordedProblems++;
+    }
 };
 
 QPTSID::QPTSID()
@@ -360,6 +574,20 @@ bool QPTSID::initialize(std::weak_ptr<const ParametersHandler::IParametersHandle
                     m_pimpl->isVerbose);
     }
 
+    // optional OSQP settings, e.g. the ones found offline by the osqp-settings-tuner utility. The
+    // defaults match the OSQP ones
+    ptr->getParameter("osqp_rho", m_pimpl->osqpRho);
+    ptr->getParameter("osqp_sigma", m_pimpl->osqpSigma);
+    ptr->getParameter("osqp_scaling", m_pimpl->osqpScaling);
+
+    if (ptr->getParameter("problem_recording_folder", m_pimpl->problemRecordingFolder)
+        && !m_pimpl->problemRecordingFolder.empty())
+    {
+        log()->info("{} The assembled QP instances will be recorded in the folder {}.",
+                    logPrefix,
+                    m_pimpl->problemRecordingFolder);
+    }
+
     if (!ptr->getParameter("robot_acceleration_variable_name",
                            m_pimpl->robotAccelerationVariable.name))
     {
@@ -381,6 +609,10 @@ bool QPTSID::initialize(std::weak_ptr<const ParametersHandler::IParametersHandle
         return false;
     }
 
+    // initialize() may be called again (e.g. to change the elimination mode), so the list is
+    // rebuilt from scratch
+    m_pimpl->contactWrenchVariables.clear();
+
     VariablesHandler::VariableDescription tmp;
     for (const auto& name : wrenchVariableNames)
     {
@@ -388,8 +620,362 @@ bool QPTSID::initialize(std::weak_ptr<const ParametersHandler::IParametersHandle
         m_pimpl->contactWrenchVariables.push_back(tmp);
     }
 
+    // optionally the contact wrench variables can be eliminated from the QP
+    const bool wasEliminatingWrenchVariables = m_pimpl->eliminateWrenchVariables;
+    if (!ptr->getParameter("eliminate_wrench_variables", m_pimpl->eliminateWrenchVariables))
+    {
+        log()->info("{} 'eliminate_wrench_variables' not found. The following parameter will be "
+                    "used '{}'.",
+                    logPrefix,
+                    m_pimpl->eliminateWrenchVariables);
+    }
+
+    if (m_pimpl->eliminateWrenchVariables
+        && !ptr->getParameter("wrench_elimination_task_name", m_pimpl->eliminationTaskName))
+    {
+        log()->error("{} 'wrench_elimination_task_name' is required when "
+                     "'eliminate_wrench_variables' is set to true.",
+                     logPrefix);
+        return false;
+    }
+
     m_pimpl->isInitialized = true;
 
+    // if the elimination mode changed after the problem has been finalized, the problem is
+    // rebuilt with the stored variables handler. The user does not need to call finalize() again
+    if (m_pimpl->isFinalized && m_pimpl->hasVariablesHandler
+        && wasEliminatingWrenchVariables != m_pimpl->eliminateWrenchVariables)
+    {
+        return this->finalize(m_pimpl->variablesHandler);
+    }
+
+    return true;
+}
+
+bool QPTSID::storeWarmStartData(const std::string& filePath) const
+{
+    constexpr auto logPrefix = "[QPTSID::storeWarmStartData]";
+
+    if (!m_pimpl->isValid)
+    {
+        log()->error("{} No valid solution is available. Please call advance() first.", logPrefix);
+        return false;
+    }
+
+    std::ofstream file(filePath);
+    if (!file.is_open())
+    {
+        log()->error("{} Unable to open the file {}.", logPrefix, filePath);
+        return false;
+    }
+
+    const auto& primal = m_pimpl->solver.getSolution();
+    const auto& dual = m_pimpl->solver.getDualSolution();
+
+    file.precision(17);
+    file << m_pimpl->problemFingerprint() << '\n';
+    file << primal.size() << ' ' << dual.size() << '\n';
+    file << primal.transpose() << '\n';
+    file << dual.transpose() << '\n';
+
+    return file.good();
+}
+
+bool QPTSID::loadWarmStartData(const std::string& filePath)
+{
+    constexpr auto logPrefix = "[QPTSID::loadWarmStartData]";
+
+    if (!m_pimpl->isFinalized)
+    {
+        log()->error("{} Please call finalize() before loading the warm-boot data.", logPrefix);
+        return false;
+    }
+
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        log()->warn("{} Unable to open the file {}. The solver will cold start.",
+                    logPrefix,
+                    filePath);
+        return false;
+    }
+
+    std::size_t fingerprint{0};
+    Eigen::Index primalSize{0}, dualSize{0};
+    file >> fingerprint >> primalSize >> dualSize;
+
+    if (fingerprint != m_pimpl->problemFingerprint())
+    {
+        log()->warn("{} The file {} has been generated by a different problem. The solver will "
+                    "cold start.",
+                    logPrefix,
+                    filePath);
+        return false;
+    }
+
+    if (primalSize != m_pimpl->hessian.rows()
+        || dualSize != Eigen::Index(m_pimpl->numberOfConstraints))
+    {
+        log()->warn("{} The sizes stored in the file {} are not coherent with the problem. The "
+                    "solver will cold start.",
+                    logPrefix,
+                    filePath);
+        return false;
+    }
+
+    m_pimpl->warmStartPrimal.resize(primalSize);
+    m_pimpl->warmStartDual.resize(dualSize);
+    for (Eigen::Index i = 0; i < primalSize; i++)
+    {
+        file >> m_pimpl->warmStartPrimal[i];
+    }
+    for (Eigen::Index i = 0; i < dualSize; i++)
+    {
+        file >> m_pimpl->warmStartDual[i];
+    }
+
+    if (!file.good())
+    {
+        log()->warn("{} Unable to parse the file {}. The solver will cold start.",
+                    logPrefix,
+                    filePath);
+        return false;
+    }
+
+    m_pimpl->hasWarmStart = true;
+
+    return true;
+}
+
+bool QPTSID::warmStartContactSwitch(
+    const std::vector<std::string>& activatedContactWrenchVariables,
+    const std::vector<std::string>& deactivatedContactWrenchVariables,
+    double normalForce)
+{
+    constexpr auto logPrefix = "[QPTSID::warmStartContactSwitch]";
+
+    if (!m_pimpl->isFinalized)
+    {
+        log()->error("{} Please call finalize() before warmStartContactSwitch().", logPrefix);
+        return false;
+    }
+
+    if (m_pimpl->eliminateWrenchVariables)
+    {
+        log()->error("{} The contact wrenches are not decision variables when the wrench variable "
+                     "elimination is enabled. There is nothing to warm start.",
+                     logPrefix);
+        return false;
+    }
+
+    if (normalForce < 0)
+    {
+        log()->error("{} The normal force must be a non negative number.", logPrefix);
+        return false;
+    }
+
+    // the previous primal is infeasible after a contact switch. The seed keeps the accelerations
+    // and the torques, zeroes the wrenches of the contacts that broke and places the wrenches of
+    // the new contacts at the center of the friction cone, i.e. a pure normal force
+    if (m_pimpl->isFirstIteration)
+    {
+        m_pimpl->projectedPrimal.setZero(m_pimpl->hessian.rows());
+    } else
+    {
+        m_pimpl->projectedPrimal = m_pimpl->solver.getSolution();
+    }
+
+    auto findWrenchVariable
+        = [this](const std::string& name) -> const VariablesHandler::VariableDescription* {
+        for (const auto& variable : m_pimpl->contactWrenchVariables)
+        {
+            if (variable.name == name)
+            {
+                return &variable;
+            }
+        }
+        return nullptr;
+    };
+
+    constexpr Eigen::Index normalForceIndex = 2;
+    for (const auto& name : activatedContactWrenchVariables)
+    {
+        const auto* variable = findWrenchVariable(name);
+        if (variable == nullptr)
+        {
+            log()->error("{} Unable to find the contact wrench variable named {}.", logPrefix, name);
+            return false;
+        }
+
+        m_pimpl->projectedPrimal.segment(variable->offset, variable->size).setZero();
+        if (variable->size > normalForceIndex)
+        {
+            m_pimpl->projectedPrimal[variable->offset + normalForceIndex] = normalForce;
+        }
+    }
+
+    for (const auto& name : deactivatedContactWrenchVariables)
+    {
+        const auto* variable = findWrenchVariable(name);
+        if (variable == nullptr)
+        {
+            log()->error("{} Unable to find the contact wrench variable named {}.", logPrefix, name);
+            return false;
+        }
+
+        m_pimpl->projectedPrimal.segment(variable->offset, variable->size).setZero();
+    }
+
+    m_pimpl->hasProjectedPrimal = true;
+
+    return true;
+}
+
+bool QPTSID::setConcurrentTaskUpdateGroups(const std::vector<std::vector<std::string>>& groups)
+{
+    constexpr auto logPrefix = "[QPTSID::setConcurrentTaskUpdateGroups]";
+
+    // an empty vector disables the concurrent update
+    if (groups.empty())
+    {
+        m_pimpl->parallelUpdater.setGroups({});
+        m_pimpl->useConcurrentUpdate = false;
+        return true;
+    }
+
+    std::unordered_map<std::string, bool> isTaskAssigned;
+    for (const auto& [name, task] : m_pimpl->tasks)
+    {
+        isTaskAssigned[name] = false;
+    }
+
+    // the first group runs on the calling thread and collects the tasks not listed by the user
+    std::vector<std::vector<System::ParallelTaskGroupUpdater::UpdateFunction>> updateGroups(1);
+
+    for (const auto& group : groups)
+    {
+        std::vector<System::ParallelTaskGroupUpdater::UpdateFunction> updateGroup;
+        for (const auto& name : group)
+        {
+            auto task = m_pimpl->tasks.find(name);
+            if (task == m_pimpl->tasks.end())
+            {
+                log()->error("{} Unable to find the task named {}.", logPrefix, name);
+                return false;
+            }
+
+            if (isTaskAssigned[name])
+            {
+                log()->error("{} The task named {} belongs to more than one group.",
+                             logPrefix,
+                             name);
+                return false;
+            }
+            isTaskAssigned[name] = true;
+
+            updateGroup.emplace_back([&taskWithPriority = task->second, name]() {
+                if (!taskWithPriority.shouldUpdate())
+                {
+                    return true;
+                }
+
+                if (!taskWithPriority.task->update())
+                {
+                    log()->error("[QPTSID::advance] Unable to update the task named {}.", name);
+                    return false;
+                }
+                assert(taskWithPriority.task->isValid() && "One of the task is not valid.");
+                return true;
+            });
+        }
+        updateGroups.emplace_back(std::move(updateGroup));
+    }
+
+    // the tasks not listed in any group are updated on the calling thread
+    for (auto& [name, task] : m_pimpl->tasks)
+    {
+        if (isTaskAssigned[name])
+        {
+            continue;
+        }
+
+        updateGroups.front().emplace_back([&taskWithPriority = task, name = name]() {
+            if (!taskWithPriority.shouldUpdate())
+            {
+                return true;
+            }
+
+            if (!taskWithPriority.task->update())
+            {
+                log()->error("[QPTSID::advance] Unable to update the task named {}.", name);
+                return false;
+            }
+            assert(taskWithPriority.task->isValid() && "One of the task is not valid.");
+            return true;
+        });
+    }
+
+    m_pimpl->parallelUpdater.setGroups(std::move(updateGroups));
+    m_pimpl->useConcurrentUpdate = true;
+
+    return true;
+}
+
+bool QPTSID::setExternalTaskUpdater(std::function<bool()> updater)
+{
+    // a nullptr restores the default per-task update loop
+    if (updater == nullptr)
+    {
+        m_pimpl->parallelUpdater.setGroups({});
+        m_pimpl->useConcurrentUpdate = false;
+        return true;
+    }
+
+    // a single group runs on the calling thread, no worker thread is spawned
+    m_pimpl->parallelUpdater.setGroups({{std::move(updater)}});
+    m_pimpl->useConcurrentUpdate = true;
+
+    return true;
+}
+
+bool QPTSID::setTaskUpdateDecimation(const std::string& taskName, std::size_t decimation)
+{
+    constexpr auto logPrefix = "[QPTSID::setTaskUpdateDecimation]";
+
+    if (decimation == 0)
+    {
+        log()->error("{} The decimation must be strictly positive.", logPrefix);
+        return false;
+    }
+
+    auto task = m_pimpl->tasks.find(taskName);
+    if (task == m_pimpl->tasks.end())
+    {
+        log()->error("{} Unable to find the task named {}.", logPrefix, taskName);
+        return false;
+    }
+
+    task->second.updateDecimation = decimation;
+
+    // the task is updated at the next call to advance() and the schedule restarts from there
+    task->second.updateCountdown = 0;
+
+    return true;
+}
+
+bool QPTSID::triggerTaskUpdate(const std::string& taskName)
+{
+    constexpr auto logPrefix = "[QPTSID::triggerTaskUpdate]";
+
+    auto task = m_pimpl->tasks.find(taskName);
+    if (task == m_pimpl->tasks.end())
+    {
+        log()->error("{} Unable to find the task named {}.", logPrefix, taskName);
+        return false;
+    }
+
+    task->second.updateRequested = true;
+
     return true;
 }
 
@@ -399,9 +985,28 @@ bool QPTSID::finalize(const System::VariablesHandler& handler)
 
     // clear the solver
     m_pimpl->solver.clearSolver();
+    m_pimpl->isFirstIteration = true;
 
     // set the some internal parameter of osqp-eigen
     m_pimpl->solver.settings()->setVerbosity(m_pimpl->isVerbose);
+    m_pimpl->solver.settings()->setRho(m_pimpl->osqpRho);
+    m_pimpl->solver.settings()->setSigma(m_pimpl->osqpSigma);
+    m_pimpl->solver.settings()->setScaling(m_pimpl->osqpScaling);
+
+    // register the profiler sections timing the phases of advance(). finalize() may be called
+    // several times, so the sections are registered only once
+    if (m_pimpl->taskUpdateSection == System::TimeProfiler::InvalidSectionIndex)
+    {
+        m_pimpl->taskUpdateSection = this->timeProfiler().registerSection("task-update");
+        m_pimpl->qpSolveSection = this->timeProfiler().registerSection("qp-solve");
+    }
+
+    // store the handler so that the problem can be rebuilt when the elimination mode changes
+    if (&handler != &m_pimpl->variablesHandler)
+    {
+        m_pimpl->variablesHandler = handler;
+    }
+    m_pimpl->hasVariablesHandler = true;
 
     // set the variable handler for all the tasks
     m_pimpl->numberOfConstraints = 0;
@@ -417,38 +1022,15 @@ bool QPTSID::finalize(const System::VariablesHandler& handler)
             return false;
         }
 
-        // if priority is equal to 0 the task is considered as hard constraint.
-        if (task.priority == 0)
+        // if priority is equal to 0 the task is considered as hard constraint. In the reduced
+        // mode the elimination task is solved in closed form and does not enter the QP
+        if (task.priority == 0
+            && !(m_pimpl->eliminateWrenchVariables && name == m_pimpl->eliminationTaskName))
         {
             m_pimpl->numberOfConstraints += task.task->size();
         }
     }
 
-    // resize the temporary matrix useful to reduce dynamics allocation when advance() is called
-    for (auto& cost : m_pimpl->costs)
-    {
-        if(cost.get().weightProvider == nullptr)
-        {
-            log()->error("{} One of the weight provider has been not correctly set.",
-                         logPrefix);
-            return false;
-        }
-
-        cost.get().tmp.resize(handler.getNumberOfVariables(),
-                              cost.get().weightProvider->getOutput().size());
-    }
-
-    m_pimpl->solver.data()->setNumberOfVariables(handler.getNumberOfVariables());
-    m_pimpl->solver.data()->setNumberOfConstraints(m_pimpl->numberOfConstraints);
-
-    // resize matrices
-    m_pimpl->hessian.resize(handler.getNumberOfVariables(), handler.getNumberOfVariables());
-    m_pimpl->gradient.resize(handler.getNumberOfVariables());
-
-    m_pimpl->constraintMatrix.resize(m_pimpl->numberOfConstraints, handler.getNumberOfVariables());
-    m_pimpl->upperBound.resize(m_pimpl->numberOfConstraints);
-    m_pimpl->lowerBound.resize(m_pimpl->numberOfConstraints);
-
     if (!handler.getVariable(m_pimpl->robotAccelerationVariable.name,
                              m_pimpl->robotAccelerationVariable))
     {
@@ -485,6 +1067,157 @@ bool QPTSID::finalize(const System::VariablesHandler& handler)
         }
     }
 
+    // build the map between the full and the reduced variable sets
+    m_pimpl->reducedToFull.clear();
+    m_pimpl->wrenchToFull.clear();
+    if (m_pimpl->eliminateWrenchVariables)
+    {
+        const auto eliminationTask = m_pimpl->tasks.find(m_pimpl->eliminationTaskName);
+        if (eliminationTask == m_pimpl->tasks.end())
+        {
+            log()->error("{} The elimination task named {} does not exist.",
+                         logPrefix,
+                         m_pimpl->eliminationTaskName);
+            return false;
+        }
+
+        if (eliminationTask->second.priority != 0
+            || eliminationTask->second.task->type() != QPTSID::Task::Type::equality)
+        {
+            log()->error("{} The elimination task named {} must be an equality task with priority "
+                         "equal to 0.",
+                         logPrefix,
+                         m_pimpl->eliminationTaskName);
+            return false;
+        }
+
+        if (m_pimpl->contactWrenchVariables.empty())
+        {
+            log()->error("{} The wrench variable elimination requires at least one contact wrench "
+                         "variable.",
+                         logPrefix);
+            return false;
+        }
+
+        m_pimpl->eliminationTask = eliminationTask->second.task;
+
+        std::vector<bool> isWrenchColumn(handler.getNumberOfVariables(), false);
+        for (const auto& variable : m_pimpl->contactWrenchVariables)
+        {
+            for (Eigen::Index i = 0; i < variable.size; i++)
+            {
+                m_pimpl->wrenchToFull.push_back(variable.offset + i);
+                isWrenchColumn[variable.offset + i] = true;
+            }
+        }
+
+        for (Eigen::Index column = 0; column < Eigen::Index(handler.getNumberOfVariables());
+             column++)
+        {
+            if (!isWrenchColumn[column])
+            {
+                m_pimpl->reducedToFull.push_back(column);
+            }
+        }
+
+        // the reduced offset of a variable is its full offset shifted by the number of wrench
+        // columns preceding it
+        auto toReducedOffset = [&isWrenchColumn](Eigen::Index fullOffset) {
+            Eigen::Index shift = 0;
+            for (Eigen::Index i = 0; i < fullOffset; i++)
+            {
+                shift += isWrenchColumn[i] ? 1 : 0;
+            }
+            return fullOffset - shift;
+        };
+        m_pimpl->reducedRobotAccelerationOffset
+            = toReducedOffset(m_pimpl->robotAccelerationVariable.offset);
+        m_pimpl->reducedJointTorquesOffset = toReducedOffset(m_pimpl->jointTorquesVariable.offset);
+
+        // resize the matrices describing the closed-form wrench distribution and the per-task
+        // buffers used to express the tasks in the reduced variable set
+        const auto numberOfWrenchColumns = m_pimpl->wrenchToFull.size();
+        const auto numberOfReducedVariables = m_pimpl->reducedToFull.size();
+        m_pimpl->eliminationD.resize(m_pimpl->eliminationTask->size(), numberOfReducedVariables);
+        m_pimpl->eliminationS.resize(m_pimpl->eliminationTask->size(), numberOfWrenchColumns);
+        m_pimpl->eliminationW.resize(numberOfWrenchColumns, numberOfReducedVariables);
+        m_pimpl->eliminationF.resize(numberOfWrenchColumns);
+        m_pimpl->wrenchSolution.resize(numberOfWrenchColumns);
+
+        for (auto& [name, task] : m_pimpl->tasks)
+        {
+            task.reducedA.resize(task.task->size(), numberOfReducedVariables);
+            task.wrenchA.resize(task.task->size(), numberOfWrenchColumns);
+            task.reducedB.resize(task.task->size());
+        }
+    }
+
+    const std::size_t numberOfFreeVariables = m_pimpl->eliminateWrenchVariables
+                                                  ? m_pimpl->reducedToFull.size()
+                                                  : handler.getNumberOfVariables();
+
+    // resize the temporary matrix useful to reduce dynamics allocation when advance() is called
+    for (auto& cost : m_pimpl->costs)
+    {
+        if(cost.get().weightProvider == nullptr)
+        {
+            log()->error("{} One of the weight provider has been not correctly set.",
+                         logPrefix);
+            return false;
+        }
+
+        cost.get().tmp.resize(numberOfFreeVariables,
+                              cost.get().weightProvider->getOutput().size());
+    }
+
+    m_pimpl->solver.data()->setNumberOfVariables(numberOfFreeVariables);
+    m_pimpl->solver.data()->setNumberOfConstraints(m_pimpl->numberOfConstraints);
+
+    // resize matrices
+    m_pimpl->hessian.resize(numberOfFreeVariables, numberOfFreeVariables);
+    m_pimpl->gradient.resize(numberOfFreeVariables);
+
+    m_pimpl->constraintMatrix.resize(m_pimpl->numberOfConstraints, numberOfFreeVariables);
+    m_pimpl->constraintMatrix.setZero();
+    m_pimpl->upperBound.resize(m_pimpl->numberOfConstraints);
+    m_pimpl->lowerBound.resize(m_pimpl->numberOfConstraints);
+
+    // allocate the persistent sparse structures. The hessian is dense since the costs couple all
+    // the variables, while the constraint matrix pattern is assembled from the structural column
+    // blocks published by the constraint tasks. The dynamics tasks touch only the robot
+    // acceleration, the joint torques and the contact wrench columns, so the resulting pattern
+    // (and consequently the OSQP KKT matrix) stays sparse and advance() only refreshes the values
+    m_pimpl->hessianSparse
+        = Eigen::MatrixXd::Ones(numberOfFreeVariables, numberOfFreeVariables).sparseView();
+
+    if (!m_pimpl->eliminateWrenchVariables)
+    {
+        Eigen::MatrixXd constraintPattern
+            = Eigen::MatrixXd::Zero(m_pimpl->numberOfConstraints, numberOfFreeVariables);
+        std::size_t constraintRowIndex = 0;
+        for (const auto& constraint : m_pimpl->constraints)
+        {
+            for (const auto& block : constraint.get().task->structuralColumnBlocks())
+            {
+                constraintPattern
+                    .block(constraintRowIndex,
+                           block.offset,
+                           constraint.get().task->size(),
+                           block.size)
+                    .setOnes();
+            }
+            constraintRowIndex += constraint.get().task->size();
+        }
+        m_pimpl->constraintMatrixSparse = constraintPattern.sparseView();
+    } else
+    {
+        // the wrench distribution folds the wrench columns into the kept ones, so the structural
+        // blocks declared by the tasks are no longer representative and a dense pattern is used
+        m_pimpl->constraintMatrixSparse
+            = Eigen::MatrixXd::Ones(m_pimpl->numberOfConstraints, numberOfFreeVariables)
+                  .sparseView();
+    }
+
     m_pimpl->isFinalized = true;
 
     return true;
@@ -510,16 +1243,58 @@ bool QPTSID::advance()
     }
 
     // update of all the tasks
-    for (auto& [name, task] : m_pimpl->tasks)
     {
-        if (!task.task->update())
+        BLF_SCOPED_PROFILER(this->timeProfiler(), m_pimpl->taskUpdateSection);
+
+        if (m_pimpl->useConcurrentUpdate)
         {
-            log()->error("{} Unable to update the task named {}.", logPrefix, name);
-            return false;
+            if (!m_pimpl->parallelUpdater.update())
+            {
+                log()->error("{} Unable to update one of the tasks.", logPrefix);
+                return false;
+            }
+        } else
+        {
+            for (auto& [name, task] : m_pimpl->tasks)
+            {
+                // the task may declare an update rate lower than the solver one. In that case the
+                // cached task matrices are reused
+                if (!task.shouldUpdate())
+                {
+                    continue;
+                }
+
+                if (!task.task->update())
+                {
+                    log()->error("{} Unable to update the task named {}.", logPrefix, name);
+                    return false;
+                }
+
+                // the outcome of isValid() should be the same of update. This test is required
+                assert(task.task->isValid() && "One of the task is not valid.");
+            }
+        }
+    }
+
+    // in the reduced mode the elimination task D x + S f = b is solved in closed form for the
+    // wrenches. The minimum-norm distribution f = S^+ (b - D x) is affine in the kept variables
+    // and is substituted into the remaining tasks
+    if (m_pimpl->eliminateWrenchVariables)
+    {
+        Eigen::Ref<const Eigen::MatrixXd> A = m_pimpl->eliminationTask->getA();
+        for (std::size_t i = 0; i < m_pimpl->reducedToFull.size(); i++)
+        {
+            m_pimpl->eliminationD.col(i) = A.col(m_pimpl->reducedToFull[i]);
+        }
+        for (std::size_t i = 0; i < m_pimpl->wrenchToFull.size(); i++)
+        {
+            m_pimpl->eliminationS.col(i) = A.col(m_pimpl->wrenchToFull[i]);
         }
 
-        // the outcome of isValid() should be the same of update. This test is required
-        assert(task.task->isValid() && "One of the task is not valid.");
+        m_pimpl->eliminationDecomposition.compute(m_pimpl->eliminationS);
+        m_pimpl->eliminationW = m_pimpl->eliminationDecomposition.solve(-m_pimpl->eliminationD);
+        m_pimpl->eliminationF
+            = m_pimpl->eliminationDecomposition.solve(m_pimpl->eliminationTask->getB());
     }
 
     // Compute the gradient and the hessian
@@ -527,8 +1302,19 @@ bool QPTSID::advance()
     m_pimpl->gradient.setZero();
     for (auto& cost : m_pimpl->costs)
     {
-        Eigen::Ref<const Eigen::MatrixXd> A = cost.get().task->getA();
-        Eigen::Ref<const Eigen::VectorXd> b = cost.get().task->getB();
+        if (m_pimpl->eliminateWrenchVariables)
+        {
+            m_pimpl->reduceTask(cost.get());
+        }
+
+        Eigen::Ref<const Eigen::MatrixXd> A = m_pimpl->eliminateWrenchVariables
+                                                  ? Eigen::Ref<const Eigen::MatrixXd>(
+                                                        cost.get().reducedA)
+                                                  : cost.get().task->getA();
+        Eigen::Ref<const Eigen::VectorXd> b = m_pimpl->eliminateWrenchVariables
+                                                  ? Eigen::Ref<const Eigen::VectorXd>(
+                                                        cost.get().reducedB)
+                                                  : cost.get().task->getB();
 
         // Here we avoid to have dynamic allocation
         cost.get().tmp.noalias() = A.transpose() * //
@@ -539,8 +1325,15 @@ bool QPTSID::advance()
 
     // compute the constraints
     std::size_t index = 0;
-    for (const auto& constraint : m_pimpl->constraints)
+    for (auto& constraint : m_pimpl->constraints)
     {
+        // in the reduced mode the elimination task is identically satisfied by construction
+        if (m_pimpl->eliminateWrenchVariables
+            && constraint.get().task == m_pimpl->eliminationTask)
+        {
+            continue;
+        }
+
         // check if the number of constraints changed
         if (m_pimpl->numberOfConstraints < index + constraint.get().task->size())
         {
@@ -554,8 +1347,19 @@ bool QPTSID::advance()
             return false;
         }
 
-        Eigen::Ref<const Eigen::MatrixXd> A = constraint.get().task->getA();
-        Eigen::Ref<const Eigen::VectorXd> b = constraint.get().task->getB();
+        if (m_pimpl->eliminateWrenchVariables)
+        {
+            m_pimpl->reduceTask(constraint.get());
+        }
+
+        Eigen::Ref<const Eigen::MatrixXd> A = m_pimpl->eliminateWrenchVariables
+                                                  ? Eigen::Ref<const Eigen::MatrixXd>(
+                                                        constraint.get().reducedA)
+                                                  : constraint.get().task->getA();
+        Eigen::Ref<const Eigen::VectorXd> b = m_pimpl->eliminateWrenchVariables
+                                                  ? Eigen::Ref<const Eigen::VectorXd>(
+                                                        constraint.get().reducedB)
+                                                  : constraint.get().task->getB();
 
         m_pimpl->constraintMatrix.middleRows(index, constraint.get().task->size()) = A;
         m_pimpl->upperBound.segment(index, constraint.get().task->size()) = b;
@@ -574,6 +1378,12 @@ bool QPTSID::advance()
         index += constraint.get().task->size();
     }
 
+    // optionally dump the assembled instance for the offline settings tuning
+    if (!m_pimpl->problemRecordingFolder.empty())
+    {
+        m_pimpl->recordProblem();
+    }
+
     // update the solver
     if (!m_pimpl->isFirstIteration)
     {
@@ -590,10 +1400,44 @@ bool QPTSID::advance()
             return false;
         }
         m_pimpl->isFirstIteration = false;
+
+        // prime the solver with the primal/dual variables loaded from the warm-boot file so the
+        // first solve converges as fast as a steady-state one
+        if (m_pimpl->hasWarmStart)
+        {
+            if (!m_pimpl->solver.setPrimalVariable(m_pimpl->warmStartPrimal)
+                || !m_pimpl->solver.setDualVariable(m_pimpl->warmStartDual))
+            {
+                log()->warn("{} Unable to set the warm-boot primal/dual variables. The solver "
+                            "will cold start.",
+                            logPrefix);
+            }
+            m_pimpl->hasWarmStart = false;
+        }
+    }
+
+    // prime the solver with the primal seed built by warmStartContactSwitch(). The automatic
+    // warm start from the previous primal is infeasible after a contact switch and osqp would
+    // burn iterations recovering from it
+    if (m_pimpl->hasProjectedPrimal)
+    {
+        if (!m_pimpl->solver.setPrimalVariable(m_pimpl->projectedPrimal))
+        {
+            log()->warn("{} Unable to set the projected primal variable. The solver will warm "
+                        "start from the previous solution.",
+                        logPrefix);
+        }
+        m_pimpl->hasProjectedPrimal = false;
     }
 
     // solve the QP
-    if (m_pimpl->solver.solveProblem() != OsqpEigen::ErrorExitFlag::NoError)
+    OsqpEigen::ErrorExitFlag exitFlag;
+    {
+        BLF_SCOPED_PROFILER(this->timeProfiler(), m_pimpl->qpSolveSection);
+        exitFlag = m_pimpl->solver.solveProblem();
+    }
+
+    if (exitFlag != OsqpEigen::ErrorExitFlag::NoError)
     {
         log()->error("{} Unable to to solve the problem.", logPrefix);
         return false;
@@ -615,24 +1459,45 @@ bool QPTSID::advance()
     constexpr std::size_t spatialAccelerationSize = 6;
     const std::size_t joints = m_pimpl->robotAccelerationVariable.size - spatialAccelerationSize;
 
+    const Eigen::Index robotAccelerationOffset = m_pimpl->eliminateWrenchVariables
+                                                     ? m_pimpl->reducedRobotAccelerationOffset
+                                                     : m_pimpl->robotAccelerationVariable.offset;
+    const Eigen::Index jointTorquesOffset = m_pimpl->eliminateWrenchVariables
+                                                ? m_pimpl->reducedJointTorquesOffset
+                                                : m_pimpl->jointTorquesVariable.offset;
+
     // the first six elements are the base acceleration
     m_pimpl->solution.baseAcceleration
-        = m_pimpl->solver.getSolution().segment<spatialAccelerationSize>(
-            m_pimpl->robotAccelerationVariable.offset);
+        = m_pimpl->solver.getSolution().segment<spatialAccelerationSize>(robotAccelerationOffset);
 
     m_pimpl->solution.jointAccelerations
-        = m_pimpl->solver.getSolution().segment(m_pimpl->robotAccelerationVariable.offset
-                                                    + spatialAccelerationSize,
+        = m_pimpl->solver.getSolution().segment(robotAccelerationOffset + spatialAccelerationSize,
                                                 joints);
 
     m_pimpl->solution.jointTorques
-        = m_pimpl->solver.getSolution().segment(m_pimpl->jointTorquesVariable.offset,
+        = m_pimpl->solver.getSolution().segment(jointTorquesOffset,
                                                 m_pimpl->jointTorquesVariable.size);
 
-    for (const auto& variable : m_pimpl->contactWrenchVariables)
+    if (!m_pimpl->eliminateWrenchVariables)
+    {
+        for (const auto& variable : m_pimpl->contactWrenchVariables)
+        {
+            m_pimpl->solution.contactWrenches[variable.name].wrench
+                = m_pimpl->solver.getSolution().segment(variable.offset, variable.size);
+        }
+    } else
     {
-        m_pimpl->solution.contactWrenches[variable.name].wrench
-            = m_pimpl->solver.getSolution().segment(variable.offset, variable.size);
+        // the wrenches are reconstructed from the closed-form distribution
+        m_pimpl->wrenchSolution = m_pimpl->eliminationF;
+        m_pimpl->wrenchSolution.noalias() += m_pimpl->eliminationW * m_pimpl->solver.getSolution();
+
+        Eigen::Index wrenchIndex = 0;
+        for (const auto& variable : m_pimpl->contactWrenchVariables)
+        {
+            m_pimpl->solution.contactWrenches[variable.name].wrench
+                = m_pimpl->wrenchSolution.segment(wrenchIndex, variable.size);
+            wrenchIndex += variable.size;
+        }
     }
 
     m_pimpl->isValid = true;
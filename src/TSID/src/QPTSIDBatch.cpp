@@ -0,0 +1,195 @@
+/**
+ * @file QPTSIDBatch.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <sstream>
+
+#include <BipedalLocomotion/System/ParallelTaskGroupUpdater.h>
+#include <BipedalLocomotion/TSID/QPTSIDBatch.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::TSID;
+using namespace BipedalLocomotion::ParametersHandler;
+
+struct QPTSIDBatch::Impl
+{
+    std::vector<std::shared_ptr<QPTSID>> instances; /**< QPTSID instances owned by the batch. */
+
+    /** The solves run concurrently, one instance per group. The worker threads are persistent, so
+     * advance() does not spawn threads in the control loop. */
+    System::ParallelTaskGroupUpdater parallelSolver;
+
+    TSIDState invalidOutput; /**< Empty state returned when the instance index is not valid. */
+
+    bool isInitialized{false};
+    bool isFinalized{false};
+};
+
+QPTSIDBatch::QPTSIDBatch()
+    : m_pimpl(std::make_unique<Impl>())
+{
+}
+
+QPTSIDBatch::~QPTSIDBatch() = default;
+
+bool QPTSIDBatch::initialize(std::weak_ptr<const IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[QPTSIDBatch::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} Invalid parameters handler.", logPrefix);
+        return false;
+    }
+
+    int numberOfInstances{0};
+    if (!ptr->getParameter("number_of_instances", numberOfInstances) || numberOfInstances <= 0)
+    {
+        log()->error("{} Unable to get the parameter named 'number_of_instances'. The parameter "
+                     "must be a strictly positive number.",
+                     logPrefix);
+        return false;
+    }
+
+    m_pimpl->instances.clear();
+    m_pimpl->instances.reserve(numberOfInstances);
+    for (int i = 0; i < numberOfInstances; i++)
+    {
+        auto instance = std::make_shared<QPTSID>();
+        if (!instance->initialize(handler))
+        {
+            log()->error("{} Unable to initialize the instance number {}.", logPrefix, i);
+            return false;
+        }
+        m_pimpl->instances.push_back(std::move(instance));
+    }
+
+    m_pimpl->isInitialized = true;
+    m_pimpl->isFinalized = false;
+
+    return true;
+}
+
+std::size_t QPTSIDBatch::size() const
+{
+    return m_pimpl->instances.size();
+}
+
+std::weak_ptr<QPTSID> QPTSIDBatch::instance(std::size_t index) const
+{
+    if (index >= m_pimpl->instances.size())
+    {
+        log()->error("[QPTSIDBatch::instance] The index {} is not valid. The batch contains {} "
+                     "instances.",
+                     index,
+                     m_pimpl->instances.size());
+        return std::weak_ptr<QPTSID>();
+    }
+
+    return m_pimpl->instances[index];
+}
+
+bool QPTSIDBatch::finalize(const System::VariablesHandler& handler)
+{
+    constexpr auto logPrefix = "[QPTSIDBatch::finalize]";
+
+    if (!m_pimpl->isInitialized)
+    {
+        log()->error("{} Please call initialize() before finalize().", logPrefix);
+        return false;
+    }
+
+    // all the instances are finalized from the same handler, so the variable layout, the
+    // constraint stack and the solver settings are guaranteed to be identical
+    for (std::size_t i = 0; i < m_pimpl->instances.size(); i++)
+    {
+        if (!m_pimpl->instances[i]->finalize(handler))
+        {
+            log()->error("{} Unable to finalize the instance number {}.", logPrefix, i);
+            return false;
+        }
+    }
+
+    // one group per instance. The first group runs on the calling thread, the others on the
+    // persistent worker threads
+    std::vector<std::vector<System::ParallelTaskGroupUpdater::UpdateFunction>> groups;
+    groups.reserve(m_pimpl->instances.size());
+    for (auto& instance : m_pimpl->instances)
+    {
+        groups.push_back({[ptr = instance.get()]() { return ptr->advance(); }});
+    }
+    m_pimpl->parallelSolver.setGroups(std::move(groups));
+
+    m_pimpl->isFinalized = true;
+
+    return true;
+}
+
+bool QPTSIDBatch::advance()
+{
+    constexpr auto logPrefix = "[QPTSIDBatch::advance]";
+
+    if (!m_pimpl->isFinalized)
+    {
+        log()->error("{} Please call finalize() before advance().", logPrefix);
+        return false;
+    }
+
+    if (!m_pimpl->parallelSolver.update())
+    {
+        log()->error("{} Unable to solve one of the instances.", logPrefix);
+        return false;
+    }
+
+    return true;
+}
+
+const TSIDState& QPTSIDBatch::getOutput(std::size_t index) const
+{
+    if (index >= m_pimpl->instances.size())
+    {
+        log()->error("[QPTSIDBatch::getOutput] The index {} is not valid. The batch contains {} "
+                     "instances.",
+                     index,
+                     m_pimpl->instances.size());
+        return m_pimpl->invalidOutput;
+    }
+
+    return m_pimpl->instances[index]->getOutput();
+}
+
+bool QPTSIDBatch::isOutputValid() const
+{
+    if (m_pimpl->instances.empty())
+    {
+        return false;
+    }
+
+    for (const auto& instance : m_pimpl->instances)
+    {
+        if (!instance->isOutputValid())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::string QPTSIDBatch::toString() const
+{
+    std::ostringstream oss;
+    oss << "====== QPTSIDBatch ======" << std::endl
+        << "The batch contains " << m_pimpl->instances.size() << " instances." << std::endl;
+    if (!m_pimpl->instances.empty())
+    {
+        oss << m_pimpl->instances.front()->toString();
+    }
+
+    return oss.str();
+}
@@ -144,6 +144,45 @@ TEST_CASE("Fesasible contact wrench Test")
             REQUIRE(A.middleCols(variablesHandler.getVariable("contact0").offset,
                                  variablesHandler.getVariable("contact0").size)
                         .isApprox(coneWithNormalForceA * iDynTree::toEigen(adjointMatrix)));
+
+            // register a second geometry and switch to it. The switch must not change the task
+            // size and must preserve the contact active state
+            const std::string otherFrameName = model.getFrameName(numberOfJoints - 1);
+            auto otherGeometryHandler = std::make_shared<StdImplementation>();
+            std::vector<double> otherLimitsX{-0.08, 0.08};
+            std::vector<double> otherLimitsY{-0.03, 0.03};
+            otherGeometryHandler->setParameter("number_of_slices", 2);
+            otherGeometryHandler->setParameter("static_friction_coefficient", 0.5);
+            otherGeometryHandler->setParameter("foot_limits_x", otherLimitsX);
+            otherGeometryHandler->setParameter("foot_limits_y", otherLimitsY);
+            otherGeometryHandler->setParameter("frame_name", otherFrameName);
+
+            REQUIRE(task.addContactGeometry("otherGeometry", otherGeometryHandler));
+            REQUIRE(task.setContactGeometry("otherGeometry"));
+            REQUIRE(task.update());
+
+            BipedalLocomotion::Math::ContactWrenchCone otherCone;
+            REQUIRE(otherCone.initialize(otherGeometryHandler));
+            coneWithNormalForceA.topRows(numberOfConstraints) = otherCone.getA();
+            coneWithNormalForceB.head(numberOfConstraints) = otherCone.getB();
+
+            const auto otherAdjointMatrix
+                = iDynTree::Transform(kinDyn->getWorldTransform(otherFrameName)
+                                          .getRotation()
+                                          .inverse(),
+                                      iDynTree::Position::Zero())
+                      .asAdjointTransform();
+
+            REQUIRE(A.middleCols(variablesHandler.getVariable("contact0").offset,
+                                 variablesHandler.getVariable("contact0").size)
+                        .isApprox(coneWithNormalForceA * iDynTree::toEigen(otherAdjointMatrix)));
+
+            // the task was disabled before the switch
+            REQUIRE(b.isApprox(coneWithNormalForceB));
+
+            // switching back to the original geometry is not allowed to change the task size
+            REQUIRE(task.setContactGeometry(frameName));
+            REQUIRE(task.size() == numberOfConstraints + 2);
         }
     }
 }
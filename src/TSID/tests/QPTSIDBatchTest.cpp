@@ -0,0 +1,137 @@
+/**
+ * @file QPTSIDBatchTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// std
+#include <memory>
+
+// BipedalLocomotion
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/System/VariablesHandler.h>
+#include <BipedalLocomotion/TSID/BaseDynamicsTask.h>
+#include <BipedalLocomotion/TSID/JointDynamicsTask.h>
+#include <BipedalLocomotion/TSID/JointTrackingTask.h>
+#include <BipedalLocomotion/TSID/QPTSIDBatch.h>
+
+#include <iDynTree/Core/EigenHelpers.h>
+#include <iDynTree/KinDynComputations.h>
+#include <iDynTree/Model/ModelTestUtils.h>
+
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion::TSID;
+
+constexpr auto robotAccelerationName = "robotAcceleration";
+constexpr auto jointTorquesName = "jointTorques";
+
+std::shared_ptr<iDynTree::KinDynComputations> createKinDyn(const iDynTree::Model& model)
+{
+    auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    REQUIRE(kinDyn->loadRobotModel(model));
+    REQUIRE(kinDyn->setFrameVelocityRepresentation(iDynTree::FrameVelocityRepresentation::MIXED_REPRESENTATION));
+
+    const Eigen::VectorXd jointsPos = Eigen::VectorXd::Zero(model.getNrOfDOFs());
+    const Eigen::VectorXd jointsVel = Eigen::VectorXd::Zero(model.getNrOfDOFs());
+    Eigen::Vector3d gravity;
+    gravity << 0, 0, -9.81;
+
+    REQUIRE(kinDyn->setRobotState(Eigen::Matrix4d::Identity(),
+                                  jointsPos,
+                                  Eigen::Matrix<double, 6, 1>::Zero(),
+                                  jointsVel,
+                                  gravity));
+
+    return kinDyn;
+}
+
+TEST_CASE("QPTSIDBatch")
+{
+    constexpr std::size_t numberOfInstances = 3;
+    constexpr std::size_t numberOfJoints = 15;
+
+    // all the instances wrap a copy of the same robot, so the solutions must be identical
+    const iDynTree::Model model = iDynTree::getRandomModel(numberOfJoints);
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("number_of_instances", int(numberOfInstances));
+    handler->setParameter("robot_acceleration_variable_name", robotAccelerationName);
+    handler->setParameter("joint_torques_variable_name", jointTorquesName);
+    handler->setParameter("contact_wrench_variables_name", std::vector<std::string>{});
+    handler->setParameter("verbosity", false);
+
+    QPTSIDBatch batch;
+    REQUIRE(batch.initialize(handler));
+    REQUIRE(batch.size() == numberOfInstances);
+    REQUIRE(batch.instance(numberOfInstances).expired());
+
+    auto baseDynamicsHandler = std::make_shared<StdImplementation>();
+    baseDynamicsHandler->setParameter("robot_acceleration_variable_name", robotAccelerationName);
+    baseDynamicsHandler->setParameter("max_number_of_contacts", 0);
+
+    auto jointDynamicsHandler = std::make_shared<StdImplementation>();
+    jointDynamicsHandler->setParameter("robot_acceleration_variable_name", robotAccelerationName);
+    jointDynamicsHandler->setParameter("joint_torques_variable_name", jointTorquesName);
+    jointDynamicsHandler->setParameter("max_number_of_contacts", 0);
+
+    auto jointTrackingHandler = std::make_shared<StdImplementation>();
+    jointTrackingHandler->setParameter("robot_acceleration_variable_name", robotAccelerationName);
+    jointTrackingHandler->setParameter("kp", Eigen::VectorXd::Ones(numberOfJoints).eval());
+    jointTrackingHandler->setParameter("kd", Eigen::VectorXd::Ones(numberOfJoints).eval());
+
+    const Eigen::VectorXd desiredJointPos = Eigen::VectorXd::Zero(numberOfJoints);
+    const Eigen::VectorXd desiredJointVel = Eigen::VectorXd::Zero(numberOfJoints);
+
+    // each instance owns its tasks and its KinDynComputations object, since the latter is not
+    // thread-safe
+    for (std::size_t i = 0; i < batch.size(); i++)
+    {
+        auto kinDyn = createKinDyn(model);
+        auto tsid = batch.instance(i).lock();
+        REQUIRE(tsid != nullptr);
+
+        auto baseDynamics = std::make_shared<BaseDynamicsTask>();
+        REQUIRE(baseDynamics->setKinDyn(kinDyn));
+        REQUIRE(baseDynamics->initialize(baseDynamicsHandler));
+        REQUIRE(tsid->addTask(baseDynamics, "base_dynamics_task", 0));
+
+        auto jointDynamics = std::make_shared<JointDynamicsTask>();
+        REQUIRE(jointDynamics->setKinDyn(kinDyn));
+        REQUIRE(jointDynamics->initialize(jointDynamicsHandler));
+        REQUIRE(tsid->addTask(jointDynamics, "joint_dynamics_task", 0));
+
+        auto jointTracking = std::make_shared<JointTrackingTask>();
+        REQUIRE(jointTracking->setKinDyn(kinDyn));
+        REQUIRE(jointTracking->initialize(jointTrackingHandler));
+        REQUIRE(tsid->addTask(jointTracking, "joint_tracking_task", 1));
+        REQUIRE(jointTracking->setSetPoint(desiredJointPos, desiredJointVel));
+    }
+
+    VariablesHandler variablesHandler;
+    REQUIRE(variablesHandler.addVariable(robotAccelerationName, numberOfJoints + 6));
+    REQUIRE(variablesHandler.addVariable(jointTorquesName, numberOfJoints));
+    REQUIRE(batch.finalize(variablesHandler));
+
+    REQUIRE_FALSE(batch.isOutputValid());
+
+    for (std::size_t iteration = 0; iteration < 3; iteration++)
+    {
+        REQUIRE(batch.advance());
+        REQUIRE(batch.isOutputValid());
+
+        // the instances solve the same problem, so the solutions must coincide
+        const auto& reference = batch.getOutput(0);
+        for (std::size_t i = 1; i < batch.size(); i++)
+        {
+            const auto& output = batch.getOutput(i);
+            constexpr double tolerance = 1e-6;
+            REQUIRE(output.jointAccelerations.isApprox(reference.jointAccelerations, tolerance));
+            REQUIRE(output.jointTorques.isApprox(reference.jointTorques, tolerance));
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file AsynchronousLogger.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_TEXT_LOGGING_ASYNCHRONOUS_LOGGER_H
+#define BIPEDAL_LOCOMOTION_TEXT_LOGGING_ASYNCHRONOUS_LOGGER_H
+
+#include <cstddef>
+#include <memory>
+
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace spdlog
+{
+namespace details
+{
+class thread_pool;
+} // namespace details
+} // namespace spdlog
+
+namespace BipedalLocomotion
+{
+namespace TextLogging
+{
+
+/**
+ * AsynchronousLoggerFactory decorates another LoggerFactory so that the sink I/O does not run on
+ * the calling thread. The messages are enqueued in a bounded queue and a dedicated low-priority
+ * thread performs the formatting and the writing to the sinks of the decorated logger. The
+ * enqueue operation never blocks: when the queue is full the oldest message is dropped and
+ * counted, so a burst of messages (or a slow console behind an ssh session) cannot stall a
+ * control thread. You can enable the asynchronous mode at the beginning of your application with
+ * \code{.cpp}
+ * #include <BipedalLocomotion/TextLogging/AsynchronousLogger.h>
+ * #include <BipedalLocomotion/TextLogging/LoggerBuilder.h>
+ *
+ * using namespace BipedalLocomotion::TextLogging;
+ * LoggerBuilder::setFactory(
+ *     std::make_shared<AsynchronousLoggerFactory>(std::make_shared<DefaultLoggerFactory>()));
+ *
+ * BipedalLocomotion::log()->info("My info");
+ * \endcode
+ */
+class AsynchronousLoggerFactory final : public LoggerFactory
+{
+public:
+    /**
+     * Construct a new AsynchronousLoggerFactory object
+     * @param baseFactory the factory building the logger whose sinks are driven asynchronously.
+     * If it is not valid the DefaultLoggerFactory is used.
+     * @param queueSize the capacity of the message queue. When the queue is full the oldest
+     * message is dropped.
+     */
+    AsynchronousLoggerFactory(std::shared_ptr<LoggerFactory> baseFactory,
+                              std::size_t queueSize = 8192);
+
+    /**
+     * Create the asynchronous logger as a singleton
+     * @return the pointer to the logger
+     */
+    std::shared_ptr<Logger> const createLogger() final;
+
+    /**
+     * Get the number of messages dropped because the queue was full.
+     * @return the number of dropped messages.
+     */
+    std::size_t droppedMessages() const;
+
+private:
+    std::shared_ptr<LoggerFactory> m_baseFactory; /**< The decorated factory */
+    const std::size_t m_queueSize; /**< Capacity of the message queue */
+    std::shared_ptr<spdlog::details::thread_pool> m_threadPool; /**< Pool owning the backend
+                                                                   thread and the queue */
+};
+
+} // namespace TextLogging
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_TEXT_LOGGING_ASYNCHRONOUS_LOGGER_H
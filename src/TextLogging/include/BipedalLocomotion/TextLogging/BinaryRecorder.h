@@ -0,0 +1,116 @@
+/**
+ * @file BinaryRecorder.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_TEXT_LOGGING_BINARY_RECORDER_H
+#define BIPEDAL_LOCOMOTION_TEXT_LOGGING_BINARY_RECORDER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace BipedalLocomotion
+{
+namespace TextLogging
+{
+
+/**
+ * BinaryRecorder stores structured log events in a preallocated ring buffer. A call to
+ * record() only writes the message identifier, the timestamp and the raw numeric
+ * arguments; no string is formatted and no memory is allocated, so it can be used in
+ * real-time loops where the formatting cost of a regular log call is not acceptable.
+ * The events are turned into text only when dump() is called, using the format strings
+ * registered with registerMessage().
+ * @note The recorder is meant to be written by a single thread; records written
+ * concurrently by several threads may be overwritten out of order once the ring wraps.
+ */
+class BinaryRecorder
+{
+public:
+    static constexpr std::size_t maxNrOfArguments{4}; /**< maximum number of numeric arguments
+                                                           stored in a record */
+
+    /**
+     * A structured log event.
+     */
+    struct Record
+    {
+        std::uint32_t id{0}; /**< identifier of the registered message */
+        Verbosity level{Verbosity::Info}; /**< severity of the event */
+        double time{0.0}; /**< time of the event in seconds (steady clock) */
+        std::uint8_t nrOfArguments{0}; /**< number of valid entries in arguments */
+        std::array<double, maxNrOfArguments> arguments{}; /**< raw numeric arguments */
+    };
+
+    /**
+     * Constructor.
+     * @param capacity number of records kept in the ring buffer. When the buffer is full
+     * the oldest record is overwritten.
+     */
+    explicit BinaryRecorder(const std::size_t capacity = 4096);
+
+    /**
+     * Associate a format string to a message identifier. The format string follows the fmt
+     * syntax and is used only by dump() to render the stored records offline.
+     * @param id identifier of the message.
+     * @param formatString fmt-style format string with at most maxNrOfArguments
+     * placeholders.
+     */
+    void registerMessage(const std::uint32_t id, const std::string& formatString);
+
+    /**
+     * Store a structured event in the ring buffer. The arguments are converted to double
+     * and copied in the record; nothing is formatted.
+     * @param id identifier of the message registered with registerMessage().
+     * @param level severity of the event.
+     * @param args numeric arguments of the message.
+     */
+    template <typename... Args> void record(const std::uint32_t id, const Verbosity level, const Args... args)
+    {
+        static_assert(sizeof...(Args) <= maxNrOfArguments,
+                      "BinaryRecorder::record supports at most maxNrOfArguments arguments.");
+
+        const std::size_t slot = m_nextRecord.fetch_add(1, std::memory_order_relaxed) //
+                                 % m_records.size();
+        Record& record = m_records[slot];
+        record.id = id;
+        record.level = level;
+        record.time = std::chrono::duration<double>( //
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+        record.nrOfArguments = static_cast<std::uint8_t>(sizeof...(Args));
+        record.arguments = {static_cast<double>(args)...};
+    }
+
+    /**
+     * Format the stored records from the oldest to the newest and forward them to the
+     * logger returned by BipedalLocomotion::log(). Records whose identifier has not been
+     * registered are rendered with a fallback format listing the raw arguments.
+     */
+    void dump() const;
+
+    /**
+     * Get the number of records written so far (including the overwritten ones).
+     */
+    std::size_t size() const;
+
+private:
+    std::vector<Record> m_records;
+    std::atomic<std::size_t> m_nextRecord{0};
+    std::unordered_map<std::uint32_t, std::string> m_formatStrings;
+};
+
+} // namespace TextLogging
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_TEXT_LOGGING_BINARY_RECORDER_H
@@ -61,6 +61,63 @@ std::shared_ptr<TextLogging::Logger> const log();
 
 } // namespace BipedalLocomotion
 
+/**
+ * Compile-time log level stripping.
+ * The BLF_LOG_* macros expand to the corresponding BipedalLocomotion::log() call only when
+ * the level is enabled at compile time; otherwise the whole statement, including the
+ * evaluation of the format arguments, is removed. This is meant for hot paths where even a
+ * disabled-level call is measurable because of the argument formatting.
+ * The active level is selected by defining BLF_ACTIVE_LOG_LEVEL (e.g. as a compile
+ * definition) to one of the BLF_LOG_LEVEL_* values; by default everything is kept.
+ */
+#define BLF_LOG_LEVEL_TRACE 0
+#define BLF_LOG_LEVEL_DEBUG 1
+#define BLF_LOG_LEVEL_INFO 2
+#define BLF_LOG_LEVEL_WARN 3
+#define BLF_LOG_LEVEL_ERROR 4
+#define BLF_LOG_LEVEL_CRITICAL 5
+#define BLF_LOG_LEVEL_OFF 6
+
+#ifndef BLF_ACTIVE_LOG_LEVEL
+#define BLF_ACTIVE_LOG_LEVEL BLF_LOG_LEVEL_TRACE
+#endif
+
+#if BLF_ACTIVE_LOG_LEVEL <= BLF_LOG_LEVEL_TRACE
+#define BLF_LOG_TRACE(...) ::BipedalLocomotion::log()->trace(__VA_ARGS__)
+#else
+#define BLF_LOG_TRACE(...) (void)0
+#endif
+
+#if BLF_ACTIVE_LOG_LEVEL <= BLF_LOG_LEVEL_DEBUG
+#define BLF_LOG_DEBUG(...) ::BipedalLocomotion::log()->debug(__VA_ARGS__)
+#else
+#define BLF_LOG_DEBUG(...) (void)0
+#endif
+
+#if BLF_ACTIVE_LOG_LEVEL <= BLF_LOG_LEVEL_INFO
+#define BLF_LOG_INFO(...) ::BipedalLocomotion::log()->info(__VA_ARGS__)
+#else
+#define BLF_LOG_INFO(...) (void)0
+#endif
+
+#if BLF_ACTIVE_LOG_LEVEL <= BLF_LOG_LEVEL_WARN
+#define BLF_LOG_WARN(...) ::BipedalLocomotion::log()->warn(__VA_ARGS__)
+#else
+#define BLF_LOG_WARN(...) (void)0
+#endif
+
+#if BLF_ACTIVE_LOG_LEVEL <= BLF_LOG_LEVEL_ERROR
+#define BLF_LOG_ERROR(...) ::BipedalLocomotion::log()->error(__VA_ARGS__)
+#else
+#define BLF_LOG_ERROR(...) (void)0
+#endif
+
+#if BLF_ACTIVE_LOG_LEVEL <= BLF_LOG_LEVEL_CRITICAL
+#define BLF_LOG_CRITICAL(...) ::BipedalLocomotion::log()->critical(__VA_ARGS__)
+#else
+#define BLF_LOG_CRITICAL(...) (void)0
+#endif
+
 namespace BipedalLocomotion
 {
 namespace TextLogging
@@ -0,0 +1,83 @@
+/**
+ * @file AsynchronousLogger.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <iostream>
+
+#include <spdlog/async.h>
+#include <spdlog/async_logger.h>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+#include <BipedalLocomotion/TextLogging/AsynchronousLogger.h>
+#include <BipedalLocomotion/TextLogging/DefaultLogger.h>
+
+using namespace BipedalLocomotion::TextLogging;
+
+AsynchronousLoggerFactory::AsynchronousLoggerFactory(std::shared_ptr<LoggerFactory> baseFactory,
+                                                     std::size_t queueSize)
+    : m_baseFactory(std::move(baseFactory))
+    , m_queueSize(queueSize)
+{
+    constexpr auto logPrefix = "[AsynchronousLoggerFactory::AsynchronousLoggerFactory]";
+    if (m_baseFactory == nullptr)
+    {
+        // logger cannot be used here
+        std::cerr << logPrefix << " The base factory is not valid. The default logger factory "
+                  << "will be used." << std::endl;
+        m_baseFactory = std::make_shared<DefaultLoggerFactory>();
+    }
+}
+
+std::shared_ptr<Logger> const AsynchronousLoggerFactory::createLogger()
+{
+    // Since the object is static the memory is not deallocated
+    static std::shared_ptr<Logger> logger = [this]() -> std::shared_ptr<Logger> {
+        // the base logger carries the sinks, the level and the pattern. The pattern is stored in
+        // the sinks formatters, so it is preserved when the sinks are shared with the
+        // asynchronous logger
+        auto baseLogger = m_baseFactory->createLogger();
+
+        // the backend thread performs all the formatting and the sink I/O. Its priority is
+        // lowered so it cannot preempt a control thread
+        const auto onThreadStart = [] {
+#ifdef __linux__
+            // on Linux setpriority acts on the calling thread only
+            setpriority(PRIO_PROCESS, 0, 10);
+#endif
+        };
+
+        this->m_threadPool = std::make_shared<spdlog::details::thread_pool>(m_queueSize,
+                                                                            1,
+                                                                            onThreadStart);
+
+        // when the queue is full the oldest message is dropped and counted, so log() never
+        // blocks the calling thread
+        auto asyncLogger
+            = std::make_shared<spdlog::async_logger>(baseLogger->name(),
+                                                     baseLogger->sinks().begin(),
+                                                     baseLogger->sinks().end(),
+                                                     this->m_threadPool,
+                                                     spdlog::async_overflow_policy::overrun_oldest);
+        asyncLogger->set_level(baseLogger->level());
+
+        return asyncLogger;
+    }();
+
+    return logger;
+}
+
+std::size_t AsynchronousLoggerFactory::droppedMessages() const
+{
+    if (m_threadPool == nullptr)
+    {
+        return 0;
+    }
+
+    return m_threadPool->overrun_counter();
+}
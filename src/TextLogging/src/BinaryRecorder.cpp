@@ -0,0 +1,82 @@
+/**
+ * @file BinaryRecorder.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+
+#include <BipedalLocomotion/TextLogging/BinaryRecorder.h>
+
+using namespace BipedalLocomotion::TextLogging;
+
+// fmt::runtime is required to format a non-literal string starting from fmt v8.0.0
+#if (defined(FMT_VERSION) && FMT_VERSION >= 80000)
+#define BLF_FMT_RUNTIME(formatString) fmt::runtime(formatString)
+#else
+#define BLF_FMT_RUNTIME(formatString) (formatString)
+#endif
+
+BinaryRecorder::BinaryRecorder(const std::size_t capacity)
+    : m_records(std::max<std::size_t>(capacity, 1))
+{
+}
+
+void BinaryRecorder::registerMessage(const std::uint32_t id, const std::string& formatString)
+{
+    m_formatStrings[id] = formatString;
+}
+
+std::size_t BinaryRecorder::size() const
+{
+    return m_nextRecord.load(std::memory_order_relaxed);
+}
+
+void BinaryRecorder::dump() const
+{
+    const std::size_t total = m_nextRecord.load(std::memory_order_relaxed);
+    const std::size_t stored = std::min(total, m_records.size());
+    const std::size_t oldest = total - stored;
+
+    auto formatRecord = [this](const Record& record) -> std::string {
+        const auto formatString = m_formatStrings.find(record.id);
+        if (formatString == m_formatStrings.end())
+        {
+            // the identifier has not been registered: fall back to the raw content
+            std::string fallback = fmt::format("[BinaryRecorder] id: {}.", record.id);
+            for (std::uint8_t i = 0; i < record.nrOfArguments; i++)
+            {
+                fallback += fmt::format(" arg{}: {}.", i, record.arguments[i]);
+            }
+            return fallback;
+        }
+
+        const auto& args = record.arguments;
+        switch (record.nrOfArguments)
+        {
+        case 0:
+            return formatString->second;
+        case 1:
+            return fmt::format(BLF_FMT_RUNTIME(formatString->second), args[0]);
+        case 2:
+            return fmt::format(BLF_FMT_RUNTIME(formatString->second), args[0], args[1]);
+        case 3:
+            return fmt::format(BLF_FMT_RUNTIME(formatString->second), args[0], args[1], args[2]);
+        default:
+            return fmt::format(BLF_FMT_RUNTIME(formatString->second),
+                               args[0],
+                               args[1],
+                               args[2],
+                               args[3]);
+        }
+    };
+
+    for (std::size_t i = oldest; i < total; i++)
+    {
+        const Record& record = m_records[i % m_records.size()];
+        const auto level = static_cast<spdlog::level::level_enum>(
+            static_cast<std::underlying_type<Verbosity>::type>(record.level));
+        log()->log(level, "[t: {:.6f}] {}", record.time, formatRecord(record));
+    }
+}
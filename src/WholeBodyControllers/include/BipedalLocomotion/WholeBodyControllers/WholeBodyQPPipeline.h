@@ -0,0 +1,146 @@
+/**
+ * @file WholeBodyQPPipeline.h
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_WHOLE_BODY_CONTROLLERS_WHOLE_BODY_QP_PIPELINE_H
+#define BIPEDAL_LOCOMOTION_WHOLE_BODY_CONTROLLERS_WHOLE_BODY_QP_PIPELINE_H
+
+#include <memory>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/IK/IntegrationBasedIK.h>
+#include <BipedalLocomotion/IK/QPInverseKinematics.h>
+#include <BipedalLocomotion/System/Source.h>
+#include <BipedalLocomotion/System/VariablesHandler.h>
+#include <BipedalLocomotion/TSID/QPTSID.h>
+#include <BipedalLocomotion/TSID/TaskSpaceInverseDynamics.h>
+
+#include <iDynTree/KinDynComputations.h>
+
+namespace BipedalLocomotion
+{
+namespace WholeBodyControllers
+{
+
+/**
+ * WholeBodyQPPipeline is a System::Source that owns a IK::QPInverseKinematics and a TSID::QPTSID
+ * and runs them as a single block. The typical use case is an inverse kinematics running at a low
+ * rate feeding a task space inverse dynamics running at a high rate. The pipeline propagates the
+ * IK output into the TSID joint tracking setpoint through preallocated internal buffers, so no
+ * intermediate copies or synchronization primitives are required between the two solvers. The IK
+ * joint velocity is integrated at the inner rate with a zero-order hold to obtain the desired
+ * joint positions.
+ * The user is in charge of populating the two solvers with the desired tasks trough the ik() and
+ * tsid() accessors, exactly as if the solvers were standalone objects. Once all the tasks have
+ * been added, finalize() must be called with the two variables handlers.
+ */
+class WholeBodyQPPipeline : public System::Source<TSID::TSIDState>
+{
+public:
+    /**
+     * Constructor.
+     */
+    WholeBodyQPPipeline();
+
+    /**
+     * Destructor.
+     */
+    ~WholeBodyQPPipeline();
+
+    /**
+     * Set the kinDynComputations object.
+     * @param kinDyn pointer to a kinDynComputations object.
+     * @return True in case of success, false otherwise.
+     */
+    bool setKinDyn(std::shared_ptr<iDynTree::KinDynComputations> kinDyn);
+
+    /**
+     * Initialize the pipeline.
+     * @param handler pointer to the parameters handler.
+     * @note the following parameters are required by the class
+     * |        Parameter Name        |   Type   |                                               Description                                              | Mandatory |
+     * |:----------------------------:|:--------:|:------------------------------------------------------------------------------------------------------:|:---------:|
+     * | `joint_tracking_task_name`   | `string` |           Name of the TSID task (a TSID::JointTrackingTask) fed with the integrated IK output           |    Yes    |
+     * |       `sampling_time`        | `chrono::nanoseconds` |                    Period of the inner (TSID) loop used to integrate the IK output         |    Yes    |
+     * |       `ik_decimation`        |   `int`  | Number of inner (TSID) ticks per IK tick. The default value is 1, i.e. the IK runs at the inner rate.   |     No    |
+     * |            `IK`              |  `group` |                       Group forwarded to QPInverseKinematics::initialize()                              |    Yes    |
+     * |           `TSID`             |  `group` |                              Group forwarded to QPTSID::initialize()                                    |    Yes    |
+     * @return True in case of success, false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler) override;
+
+    /**
+     * Access the inverse kinematics solver owned by the pipeline. Use this accessor to add the IK
+     * tasks.
+     * @return a reference to the inverse kinematics solver.
+     */
+    IK::QPInverseKinematics& ik();
+
+    /**
+     * Access the task space inverse dynamics solver owned by the pipeline. Use this accessor to
+     * add the TSID tasks.
+     * @return a reference to the task space inverse dynamics solver.
+     */
+    TSID::QPTSID& tsid();
+
+    /**
+     * Finalize the pipeline. The method finalizes the two solvers and preallocates the internal
+     * buffers used to propagate the IK output into the TSID setpoints.
+     * @param ikHandler variables handler describing the IK optimization variables.
+     * @param tsidHandler variables handler describing the TSID optimization variables.
+     * @note You should call this method after you added ALL the tasks to both the solvers.
+     * @return True in case of success, false otherwise.
+     */
+    bool finalize(const System::VariablesHandler& ikHandler,
+                  const System::VariablesHandler& tsidHandler);
+
+    /**
+     * Seed the internal integrator with a joint configuration. The desired joint velocity is reset
+     * to zero.
+     * @param jointPositions desired joint configuration used as initial condition.
+     * @return True in case of success, false otherwise.
+     */
+    bool setDesiredJointConfiguration(Eigen::Ref<const Eigen::VectorXd> jointPositions);
+
+    /**
+     * Run one tick of the pipeline. The IK is advanced once every `ik_decimation` calls, its
+     * output is integrated and forwarded to the TSID joint tracking task, then the TSID is
+     * advanced.
+     * @return True in case of success and false otherwise.
+     */
+    bool advance() override;
+
+    /**
+     * Get the output of the pipeline, i.e. the output of the task space inverse dynamics.
+     * @return a const reference to the state of the TSID.
+     */
+    const TSID::TSIDState& getOutput() const override;
+
+    /**
+     * Return true if the output of the task space inverse dynamics is valid.
+     * @return True if the output is valid, false otherwise.
+     */
+    bool isOutputValid() const override;
+
+    /**
+     * Get the output of the inverse kinematics computed at the last IK tick.
+     * @return a const reference to the state of the IK.
+     */
+    const IK::IntegrationBasedIKState& getIKOutput() const;
+
+private:
+    /**
+     * Private implementation
+     */
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+};
+
+} // namespace WholeBodyControllers
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_WHOLE_BODY_CONTROLLERS_WHOLE_BODY_QP_PIPELINE_H
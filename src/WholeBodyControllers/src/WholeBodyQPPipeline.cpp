@@ -0,0 +1,270 @@
+/**
+ * @file WholeBodyQPPipeline.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+
+#include <BipedalLocomotion/TSID/JointTrackingTask.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+#include <BipedalLocomotion/WholeBodyControllers/WholeBodyQPPipeline.h>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::WholeBodyControllers;
+
+struct WholeBodyQPPipeline::Impl
+{
+    IK::QPInverseKinematics ik; /**< Inverse kinematics solver. */
+    TSID::QPTSID tsid; /**< Task space inverse dynamics solver. */
+
+    std::shared_ptr<iDynTree::KinDynComputations> kinDyn; /**< Pointer to a KinDynComputations
+                                                             object. */
+
+    std::string jointTrackingTaskName; /**< Name of the TSID task fed with the IK output. */
+    std::shared_ptr<TSID::JointTrackingTask> jointTrackingTask; /**< TSID task fed with the IK
+                                                                   output. */
+
+    std::chrono::nanoseconds samplingTime{std::chrono::nanoseconds::zero()}; /**< Period of the
+                                                                                inner loop. */
+    int ikDecimation{1}; /**< Number of inner (TSID) ticks per IK tick. */
+    std::size_t tickCounter{0}; /**< Number of calls to advance(). */
+
+    /** Preallocated buffers used to propagate the IK output into the TSID setpoints without
+     * passing through Advanceable ports. */
+    Eigen::VectorXd desiredJointPosition;
+    Eigen::VectorXd desiredJointVelocity;
+
+    bool isInitialized{false};
+    bool isFinalized{false};
+};
+
+WholeBodyQPPipeline::WholeBodyQPPipeline()
+{
+    m_pimpl = std::make_unique<WholeBodyQPPipeline::Impl>();
+}
+
+WholeBodyQPPipeline::~WholeBodyQPPipeline() = default;
+
+bool WholeBodyQPPipeline::setKinDyn(std::shared_ptr<iDynTree::KinDynComputations> kinDyn)
+{
+    if ((kinDyn == nullptr) || (!kinDyn->isValid()))
+    {
+        log()->error("[WholeBodyQPPipeline::setKinDyn] Invalid kinDyn object.");
+        return false;
+    }
+
+    m_pimpl->kinDyn = kinDyn;
+    return true;
+}
+
+bool WholeBodyQPPipeline::initialize(
+    std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[WholeBodyQPPipeline::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} The parameter handler is not valid.", logPrefix);
+        return false;
+    }
+
+    if (!ptr->getParameter("joint_tracking_task_name", m_pimpl->jointTrackingTaskName))
+    {
+        log()->error("{} Unable to retrieve the parameter named 'joint_tracking_task_name'.",
+                     logPrefix);
+        return false;
+    }
+
+    if (!ptr->getParameter("sampling_time", m_pimpl->samplingTime)
+        || m_pimpl->samplingTime <= std::chrono::nanoseconds::zero())
+    {
+        log()->error("{} Unable to retrieve a valid sampling time.", logPrefix);
+        return false;
+    }
+
+    if (!ptr->getParameter("ik_decimation", m_pimpl->ikDecimation))
+    {
+        log()->info("{} The parameter named 'ik_decimation' not found. The default value is used: "
+                    "{}.",
+                    logPrefix,
+                    m_pimpl->ikDecimation);
+    }
+
+    if (m_pimpl->ikDecimation < 1)
+    {
+        log()->error("{} The parameter named 'ik_decimation' must be a positive number.",
+                     logPrefix);
+        return false;
+    }
+
+    if (!m_pimpl->ik.initialize(ptr->getGroup("IK")))
+    {
+        log()->error("{} Unable to initialize the inverse kinematics.", logPrefix);
+        return false;
+    }
+
+    if (!m_pimpl->tsid.initialize(ptr->getGroup("TSID")))
+    {
+        log()->error("{} Unable to initialize the task space inverse dynamics.", logPrefix);
+        return false;
+    }
+
+    m_pimpl->isInitialized = true;
+
+    return true;
+}
+
+IK::QPInverseKinematics& WholeBodyQPPipeline::ik()
+{
+    return m_pimpl->ik;
+}
+
+TSID::QPTSID& WholeBodyQPPipeline::tsid()
+{
+    return m_pimpl->tsid;
+}
+
+bool WholeBodyQPPipeline::finalize(const System::VariablesHandler& ikHandler,
+                                   const System::VariablesHandler& tsidHandler)
+{
+    constexpr auto logPrefix = "[WholeBodyQPPipeline::finalize]";
+
+    if (!m_pimpl->isInitialized)
+    {
+        log()->error("{} Please call initialize() before finalize().", logPrefix);
+        return false;
+    }
+
+    if (m_pimpl->kinDyn == nullptr || !m_pimpl->kinDyn->isValid())
+    {
+        log()->error("{} KinDynComputations object is not valid. Please call setKinDyn().",
+                     logPrefix);
+        return false;
+    }
+
+    if (!m_pimpl->ik.finalize(ikHandler))
+    {
+        log()->error("{} Unable to finalize the inverse kinematics.", logPrefix);
+        return false;
+    }
+
+    if (!m_pimpl->tsid.finalize(tsidHandler))
+    {
+        log()->error("{} Unable to finalize the task space inverse dynamics.", logPrefix);
+        return false;
+    }
+
+    m_pimpl->jointTrackingTask = std::dynamic_pointer_cast<TSID::JointTrackingTask>(
+        m_pimpl->tsid.getTask(m_pimpl->jointTrackingTaskName).lock());
+    if (m_pimpl->jointTrackingTask == nullptr)
+    {
+        log()->error("{} The task named '{}' does not exist in the TSID or it is not a "
+                     "TSID::JointTrackingTask.",
+                     logPrefix,
+                     m_pimpl->jointTrackingTaskName);
+        return false;
+    }
+
+    // preallocate the buffers shared between the two solvers
+    const auto numberOfJoints = m_pimpl->kinDyn->getNrOfDegreesOfFreedom();
+    m_pimpl->desiredJointPosition = Eigen::VectorXd::Zero(numberOfJoints);
+    m_pimpl->desiredJointVelocity = Eigen::VectorXd::Zero(numberOfJoints);
+    m_pimpl->tickCounter = 0;
+
+    m_pimpl->isFinalized = true;
+
+    return true;
+}
+
+bool WholeBodyQPPipeline::setDesiredJointConfiguration(
+    Eigen::Ref<const Eigen::VectorXd> jointPositions)
+{
+    constexpr auto logPrefix = "[WholeBodyQPPipeline::setDesiredJointConfiguration]";
+
+    if (!m_pimpl->isFinalized)
+    {
+        log()->error("{} Please call finalize() before setDesiredJointConfiguration().",
+                     logPrefix);
+        return false;
+    }
+
+    if (jointPositions.size() != m_pimpl->desiredJointPosition.size())
+    {
+        log()->error("{} Wrong size of the joint configuration. Expected: {}. Given: {}.",
+                     logPrefix,
+                     m_pimpl->desiredJointPosition.size(),
+                     jointPositions.size());
+        return false;
+    }
+
+    m_pimpl->desiredJointPosition = jointPositions;
+    m_pimpl->desiredJointVelocity.setZero();
+
+    return true;
+}
+
+bool WholeBodyQPPipeline::advance()
+{
+    constexpr auto logPrefix = "[WholeBodyQPPipeline::advance]";
+
+    if (!m_pimpl->isFinalized)
+    {
+        log()->error("{} Please call finalize() before advance().", logPrefix);
+        return false;
+    }
+
+    // the IK runs at a lower rate than the TSID. Its output is kept constant (zero-order hold)
+    // between two consecutive IK ticks
+    if (m_pimpl->tickCounter % m_pimpl->ikDecimation == 0)
+    {
+        if (!m_pimpl->ik.advance())
+        {
+            log()->error("{} Unable to advance the inverse kinematics.", logPrefix);
+            return false;
+        }
+
+        // the buffer is preallocated in finalize() so this copy does not allocate memory
+        m_pimpl->desiredJointVelocity = m_pimpl->ik.getOutput().jointVelocity;
+    }
+    m_pimpl->tickCounter++;
+
+    // integrate the IK output at the inner rate to obtain the desired joint positions
+    m_pimpl->desiredJointPosition.noalias()
+        += std::chrono::duration<double>(m_pimpl->samplingTime).count()
+           * m_pimpl->desiredJointVelocity;
+
+    if (!m_pimpl->jointTrackingTask->setSetPoint(m_pimpl->desiredJointPosition,
+                                                 m_pimpl->desiredJointVelocity))
+    {
+        log()->error("{} Unable to set the setpoint of the task named '{}'.",
+                     logPrefix,
+                     m_pimpl->jointTrackingTaskName);
+        return false;
+    }
+
+    if (!m_pimpl->tsid.advance())
+    {
+        log()->error("{} Unable to advance the task space inverse dynamics.", logPrefix);
+        return false;
+    }
+
+    return true;
+}
+
+const TSID::TSIDState& WholeBodyQPPipeline::getOutput() const
+{
+    return m_pimpl->tsid.getOutput();
+}
+
+bool WholeBodyQPPipeline::isOutputValid() const
+{
+    return m_pimpl->tsid.isOutputValid();
+}
+
+const IK::IntegrationBasedIKState& WholeBodyQPPipeline::getIKOutput() const
+{
+    return m_pimpl->ik.getOutput();
+}
@@ -0,0 +1,145 @@
+/**
+ * @file WholeBodyQPPipelineTest.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2023 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <memory>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// BipedalLocomotion
+#include <BipedalLocomotion/IK/JointTrackingTask.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/System/VariablesHandler.h>
+#include <BipedalLocomotion/TSID/BaseDynamicsTask.h>
+#include <BipedalLocomotion/TSID/JointDynamicsTask.h>
+#include <BipedalLocomotion/TSID/JointTrackingTask.h>
+#include <BipedalLocomotion/WholeBodyControllers/WholeBodyQPPipeline.h>
+
+#include <iDynTree/Core/EigenHelpers.h>
+#include <iDynTree/Model/ModelTestUtils.h>
+
+#include <Eigen/Dense>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::System;
+
+TEST_CASE("WholeBodyQPPipeline")
+{
+    constexpr std::size_t numberOfJoints = 20;
+    constexpr int ikDecimation = 5;
+    using namespace std::chrono_literals;
+
+    auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    REQUIRE(kinDyn->setFrameVelocityRepresentation(
+        iDynTree::FrameVelocityRepresentation::MIXED_REPRESENTATION));
+
+    const iDynTree::Model model = iDynTree::getRandomModel(numberOfJoints);
+    REQUIRE(kinDyn->loadRobotModel(model));
+
+    const auto worldBasePos = iDynTree::getRandomTransform();
+    const auto baseVel = iDynTree::Twist::Zero();
+    iDynTree::VectorDynSize jointsPos(model.getNrOfDOFs());
+    iDynTree::VectorDynSize jointsVel(model.getNrOfDOFs());
+    iDynTree::Vector3 gravity;
+    gravity.zero();
+    gravity(2) = -9.81;
+
+    for (auto& joint : jointsPos)
+    {
+        joint = iDynTree::getRandomDouble();
+    }
+    jointsVel.zero();
+
+    REQUIRE(kinDyn->setRobotState(worldBasePos, jointsPos, baseVel, jointsVel, gravity));
+
+    // pipeline parameters
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("joint_tracking_task_name", "JOINT_TRACKING");
+    handler->setParameter("sampling_time", 2ms);
+    handler->setParameter("ik_decimation", ikDecimation);
+
+    auto ikGroup = std::make_shared<StdImplementation>();
+    ikGroup->setParameter("robot_velocity_variable_name", "robot_velocity");
+    handler->setGroup("IK", ikGroup);
+
+    auto tsidGroup = std::make_shared<StdImplementation>();
+    tsidGroup->setParameter("robot_acceleration_variable_name", "robot_acceleration");
+    tsidGroup->setParameter("joint_torques_variable_name", "joint_torques");
+    tsidGroup->setParameter("contact_wrench_variables_name", std::vector<std::string>{});
+    handler->setGroup("TSID", tsidGroup);
+
+    WholeBodyControllers::WholeBodyQPPipeline pipeline;
+    REQUIRE(pipeline.setKinDyn(kinDyn));
+    REQUIRE(pipeline.initialize(handler));
+
+    // IK tasks
+    auto ikJointTrackingParams = std::make_shared<StdImplementation>();
+    ikJointTrackingParams->setParameter("robot_velocity_variable_name", "robot_velocity");
+    ikJointTrackingParams->setParameter("kp", Eigen::VectorXd::Ones(numberOfJoints).eval());
+    auto ikJointTracking = std::make_shared<IK::JointTrackingTask>();
+    REQUIRE(ikJointTracking->setKinDyn(kinDyn));
+    REQUIRE(ikJointTracking->initialize(ikJointTrackingParams));
+    REQUIRE(pipeline.ik().addTask(ikJointTracking,
+                                  "JOINT_TRACKING_IK",
+                                  1,
+                                  Eigen::VectorXd::Ones(numberOfJoints).eval()));
+
+    // TSID tasks
+    auto dynamicsParams = std::make_shared<StdImplementation>();
+    dynamicsParams->setParameter("robot_acceleration_variable_name", "robot_acceleration");
+    dynamicsParams->setParameter("joint_torques_variable_name", "joint_torques");
+    dynamicsParams->setParameter("max_number_of_contacts", 0);
+
+    auto baseDynamics = std::make_shared<TSID::BaseDynamicsTask>();
+    REQUIRE(baseDynamics->setKinDyn(kinDyn));
+    REQUIRE(baseDynamics->initialize(dynamicsParams));
+    REQUIRE(pipeline.tsid().addTask(baseDynamics, "BASE_DYNAMICS", 0));
+
+    auto jointDynamics = std::make_shared<TSID::JointDynamicsTask>();
+    REQUIRE(jointDynamics->setKinDyn(kinDyn));
+    REQUIRE(jointDynamics->initialize(dynamicsParams));
+    REQUIRE(pipeline.tsid().addTask(jointDynamics, "JOINT_DYNAMICS", 0));
+
+    auto tsidJointTrackingParams = std::make_shared<StdImplementation>();
+    tsidJointTrackingParams->setParameter("robot_acceleration_variable_name",
+                                          "robot_acceleration");
+    tsidJointTrackingParams->setParameter("kp", Eigen::VectorXd::Ones(numberOfJoints).eval());
+    tsidJointTrackingParams->setParameter("kd", Eigen::VectorXd::Ones(numberOfJoints).eval());
+    auto tsidJointTracking = std::make_shared<TSID::JointTrackingTask>();
+    REQUIRE(tsidJointTracking->setKinDyn(kinDyn));
+    REQUIRE(tsidJointTracking->initialize(tsidJointTrackingParams));
+    REQUIRE(pipeline.tsid().addTask(tsidJointTracking,
+                                    "JOINT_TRACKING",
+                                    1,
+                                    Eigen::VectorXd::Ones(numberOfJoints).eval()));
+
+    // finalize the pipeline
+    VariablesHandler ikVariables;
+    REQUIRE(ikVariables.addVariable("robot_velocity", numberOfJoints + 6));
+
+    VariablesHandler tsidVariables;
+    REQUIRE(tsidVariables.addVariable("robot_acceleration", numberOfJoints + 6));
+    REQUIRE(tsidVariables.addVariable("joint_torques", numberOfJoints));
+
+    REQUIRE(pipeline.finalize(ikVariables, tsidVariables));
+    REQUIRE(pipeline.setDesiredJointConfiguration(iDynTree::toEigen(jointsPos)));
+
+    // the IK regulates the joints toward a constant configuration
+    REQUIRE(ikJointTracking->setSetPoint(iDynTree::toEigen(jointsPos)));
+
+    for (int i = 0; i < 3 * ikDecimation; i++)
+    {
+        REQUIRE(pipeline.advance());
+        REQUIRE(pipeline.isOutputValid());
+
+        REQUIRE(pipeline.getOutput().jointTorques.size() == numberOfJoints);
+        REQUIRE(pipeline.getOutput().jointAccelerations.size() == numberOfJoints);
+        REQUIRE(pipeline.getIKOutput().jointVelocity.size() == numberOfJoints);
+    }
+}
@@ -153,6 +153,31 @@ void sendVariadicVector(yarp::os::BufferedPort<yarp::sig::Vector>& port, const A
 void populateBottleWithStrings(yarp::os::Bottle& bottle,
                                const std::initializer_list<std::string>& strings);
 
+/**
+ * Check whether two registered ports live on the same host. The hosts are retrieved from the
+ * name server; loopback addresses are considered equivalent to each other.
+ * @param remote name of the first port;
+ * @param local name of the second port.
+ * @return true if both ports are registered and resolve to the same host, false otherwise.
+ */
+bool arePortsOnSameHost(const std::string& remote, const std::string& local);
+
+/**
+ * Connect two ports preferring a shared-memory/zero-copy carrier when both endpoints live on
+ * the same host. When the ports are co-located the connection is attempted with the
+ * <code>unix_stream</code> and <code>shmem</code> carriers (in this order, skipping the ones
+ * not compiled in the installed YARP); if none of them succeeds, or the ports are on
+ * different hosts, the connection falls back to \a defaultCarrier. This avoids paying the
+ * loopback TCP cost for high-rate intra-host streams.
+ * @param remote name of the source port;
+ * @param local name of the destination port;
+ * @param defaultCarrier carrier used when the ports are not co-located (default tcp).
+ * @return true/false in case of success/failure.
+ */
+bool connectPortsPreferringLocal(const std::string& remote,
+                                 const std::string& local,
+                                 const std::string& defaultCarrier = "tcp");
+
 } // namespace YarpUtilities
 } // namespace BipedalLocomotion
 #include "Helper.tpp"
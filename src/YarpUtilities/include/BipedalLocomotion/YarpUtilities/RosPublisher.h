@@ -13,6 +13,7 @@
 #include <memory>
 #include <iostream>
 #include <string>
+#include <vector>
 namespace BipedalLocomotion
 {
 
@@ -103,6 +104,18 @@ public:
     bool publishWrench(const std::string& frameName,
                        BipedalLocomotion::GenericContainer::Vector<const double>::Ref wrench6d);
 
+    /**
+     * Publish a batch of wrenches over the configured wrench topics associated to the frames.
+     * The timestamp is computed once and shared by all the messages of the batch, so this method
+     * should be preferred to repeated calls to publishWrench when several wrenches sampled at the
+     * same instant must be published.
+     * @param[in] frameNames frames at which the wrenches are expressed
+     * @param[in] wrenches6d stacked 6d wrenches with serialization fx fy fz tx ty tz. The size must
+     * be six times the number of frames
+     */
+    bool publishWrenches(const std::vector<std::string>& frameNames,
+                         BipedalLocomotion::GenericContainer::Vector<const double>::Ref wrenches6d);
+
     /**
      * Publish transforms to the transform server
      * @param[in] target  target frame for the transform
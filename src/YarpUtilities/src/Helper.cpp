@@ -5,6 +5,9 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <yarp/os/Contact.h>
+#include <yarp/os/Network.h>
+
 #include <BipedalLocomotion/TextLogging/Logger.h>
 #include <BipedalLocomotion/YarpUtilities/Helper.h>
 
@@ -107,3 +110,57 @@ bool YarpUtilities::getVectorFromSearchable<std::vector<bool>>(const yarp::os::S
     }
     return true;
 }
+
+bool YarpUtilities::arePortsOnSameHost(const std::string& remote, const std::string& local)
+{
+    const yarp::os::Contact remoteContact = yarp::os::Network::queryName(remote);
+    const yarp::os::Contact localContact = yarp::os::Network::queryName(local);
+
+    if (!remoteContact.isValid() || !localContact.isValid())
+    {
+        return false;
+    }
+
+    auto isLoopback = [](const std::string& host) -> bool {
+        return host == "localhost" || host.rfind("127.", 0) == 0;
+    };
+
+    const std::string remoteHost = remoteContact.getHost();
+    const std::string localHost = localContact.getHost();
+
+    return remoteHost == localHost || (isLoopback(remoteHost) && isLoopback(localHost));
+}
+
+bool YarpUtilities::connectPortsPreferringLocal(const std::string& remote,
+                                                const std::string& local,
+                                                const std::string& defaultCarrier)
+{
+    constexpr auto logPrefix = "[YarpUtilities::connectPortsPreferringLocal]";
+
+    if (arePortsOnSameHost(remote, local))
+    {
+        // the attempts are quiet: a carrier may not be compiled in the installed YARP
+        for (const auto& carrier : {"unix_stream", "shmem"})
+        {
+            if (yarp::os::Network::connect(remote, local, carrier, /*quiet = */ true))
+            {
+                log()->info("{} Ports {} and {} are on the same host: connected with the {} "
+                            "carrier.",
+                            logPrefix,
+                            remote,
+                            local,
+                            carrier);
+                return true;
+            }
+        }
+
+        log()->warn("{} Ports {} and {} are on the same host but no shared-memory carrier is "
+                    "available. Falling back to the {} carrier.",
+                    logPrefix,
+                    remote,
+                    local,
+                    defaultCarrier);
+    }
+
+    return yarp::os::Network::connect(remote, local, defaultCarrier);
+}
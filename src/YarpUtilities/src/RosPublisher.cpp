@@ -231,6 +231,9 @@ bool RosPublisher::configureWrenchPublisher(const std::string& frameName,
 
     m_pimpl->configurePublisher(m_pimpl->wrenchPublisherMap.at(frameName).ptr);
     m_pimpl->wrenchPublisherMap.at(frameName).topic = topicName;
+    // the frame is bound to the message header once here, so publishWrench does not need to
+    // copy the string at every call
+    m_pimpl->wrenchPublisherMap.at(frameName).msg.header.frame_id = frameName;
     if (!m_pimpl->openPublisher(m_pimpl->wrenchPublisherMap.at(frameName).ptr.get(), m_pimpl->wrenchPublisherMap.at(frameName).topic))
     {
         return false;
@@ -380,17 +383,27 @@ bool RosPublisher::publishJointStates(const GenericContainer::Vector<const std::
     pub.msg.header.seq++;
     pub.msg.header.stamp = m_pimpl->getTimeStampFromYarp();
 
-    pub.msg.name.clear();
-    pub.msg.position.clear();
-    pub.msg.velocity.clear();
-    pub.msg.effort.clear();
+    // the message arrays are resized only when the joint list changes, so in the steady state
+    // the data is overwritten in place without any allocation
+    if (pub.msg.name.size() != jointList.size())
+    {
+        pub.msg.name.resize(jointList.size());
+        pub.msg.position.resize(jointList.size());
+        pub.msg.velocity.resize(jointList.size());
+        pub.msg.effort.resize(jointList.size());
+    }
 
     for (std::size_t idx = 0; idx < jointList.size(); idx++)
     {
-        pub.msg.name.emplace_back(jointList(idx));
-        pub.msg.position.emplace_back(jointPositions(idx));
-        pub.msg.velocity.emplace_back(jointVelocities(idx));
-        pub.msg.effort.emplace_back(jointEfforts(idx));
+        // the name is copied only when it differs from the one already bound to the message,
+        // the assignment reuses the capacity of the preallocated string
+        if (pub.msg.name[idx] != jointList(idx))
+        {
+            pub.msg.name[idx] = jointList(idx);
+        }
+        pub.msg.position[idx] = jointPositions(idx);
+        pub.msg.velocity[idx] = jointVelocities(idx);
+        pub.msg.effort[idx] = jointEfforts(idx);
     }
 
     pub.ptr->write(pub.msg);
@@ -427,8 +440,8 @@ bool RosPublisher::publishWrench(const std::string& frame,
         return false;
     }
 
+    // the frame_id is bound to the message in configureWrenchPublisher
     pub.msg.header.seq++;
-    pub.msg.header.frame_id = frame;
     pub.msg.header.stamp = m_pimpl->getTimeStampFromYarp();
     pub.msg.wrench.force.x = wrench6d(0);
     pub.msg.wrench.force.y = wrench6d(1);
@@ -442,6 +455,58 @@ bool RosPublisher::publishWrench(const std::string& frame,
     return true;
 }
 
+bool RosPublisher::publishWrenches(const std::vector<std::string>& frameNames,
+                                   BipedalLocomotion::GenericContainer::Vector<const double>::Ref wrenches6d)
+{
+    std::string_view printPrefix = "[RosPublisher::publishWrenches] ";
+
+    if (!m_pimpl->initialized)
+    {
+        std::cerr << printPrefix << "Please call initialize before publishing." << std::endl;
+        return false;
+    }
+
+    if (wrenches6d.size() != static_cast<std::ptrdiff_t>(6 * frameNames.size()))
+    {
+        std::cerr << printPrefix << "Expecting a stacked input vector of size 6 times the number of frames. Unable to publish wrenches." << std::endl;
+        return false;
+    }
+
+    // the timestamp is computed once and shared by all the messages of the batch
+    const yarp::rosmsg::TickTime stamp = m_pimpl->getTimeStampFromYarp();
+
+    for (std::size_t idx = 0; idx < frameNames.size(); idx++)
+    {
+        auto pubIt = m_pimpl->wrenchPublisherMap.find(frameNames[idx]);
+        if (pubIt == m_pimpl->wrenchPublisherMap.end())
+        {
+            std::cerr << printPrefix << "Frame " << frameNames[idx] << " does not exist. Please add wrench publisher before publishing." << std::endl;
+            return false;
+        }
+
+        auto& pub = pubIt->second;
+        if (pub.ptr == nullptr)
+        {
+            std::cerr << printPrefix << "Wrench publisher was not configured. Unable to publish wrench stamped messages." << std::endl;
+            return false;
+        }
+
+        const std::size_t offset = 6 * idx;
+        pub.msg.header.seq++;
+        pub.msg.header.stamp = stamp;
+        pub.msg.wrench.force.x = wrenches6d(offset + 0);
+        pub.msg.wrench.force.y = wrenches6d(offset + 1);
+        pub.msg.wrench.force.z = wrenches6d(offset + 2);
+
+        pub.msg.wrench.torque.x = wrenches6d(offset + 3);
+        pub.msg.wrench.torque.y = wrenches6d(offset + 4);
+        pub.msg.wrench.torque.z = wrenches6d(offset + 5);
+        pub.ptr->write(pub.msg);
+    }
+
+    return true;
+}
+
 yarp::rosmsg::TickTime RosPublisher::Impl::getTimeStampFromYarp()
 {
     std::string_view printPrefix = "[RosPublisher::Impl::getTimeStampFromYarp] ";
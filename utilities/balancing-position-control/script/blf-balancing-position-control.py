@@ -177,6 +177,10 @@ def main():
     port = blf.yarp_utilities.BufferedPortVectorsCollection()
     port.open("/balancing_controller/logger/data:o")
 
+    # buffers reused at every tick by the telemetry, so the control loop does not allocate
+    left_wrench = np.zeros(6)
+    right_wrench = np.zeros(6)
+
     while True:
 
         tic = blf.clock().now()
@@ -201,14 +205,15 @@ def main():
         assert robot_control.set_references(desired_joint_positions,
                                             blf.robot_interface.YarpRobotControl.PositionDirect)
 
-        # send the data
-        left_wrench = np.zeros(6)
+        # send the data. The telemetry runs after the references are dispatched, so it does not
+        # add latency to the control critical path
+        left_wrench.fill(0.0)
         for cartesian_wrench_name in contact_wrenches_names["left_foot"]:
             is_ok, wrench, _ = sensor_bridge.get_cartesian_wrench(cartesian_wrench_name)
             assert is_ok
             left_wrench += wrench
 
-        right_wrench = np.zeros(6)
+        right_wrench.fill(0.0)
         for cartesian_wrench_name in contact_wrenches_names["right_foot"]:
             is_ok, wrench, _ = sensor_bridge.get_cartesian_wrench(cartesian_wrench_name)
             assert is_ok
@@ -221,6 +221,10 @@ class Application:
         self.index = 0
         self.knot_index = 1
 
+        # buffers reused at every tick by the telemetry, so the control loop does not allocate
+        self.left_wrench = np.zeros(6)
+        self.right_wrench = np.zeros(6)
+
         self.port = blf.yarp_utilities.BufferedPortVectorsCollection()
         if not self.port.open("/balancing_controller/logger/data:o"):
             raise ValueError("Impossible to open the port.")
@@ -374,24 +378,29 @@ class Application:
             blf.log().error("Impossible to advance the TSID solver.")
             return False
 
+        # the solver output is queried once per tick and shared by view between the integration,
+        # the robot control and the telemetry
+        tsid_output = self.tsid.solver.get_output()
+
         # integrate the system
         self.desired_joint_positions += (
             self.desired_joint_velocities * self.dt.total_seconds()
         )
         self.desired_joint_velocities += (
-            self.tsid.solver.get_output().joint_accelerations * self.dt.total_seconds()
+            tsid_output.joint_accelerations * self.dt.total_seconds()
         )
 
         # send the joint torques
         if not self.robot_control.set_references(
-            self.tsid.solver.get_output().joint_torques,
+            tsid_output.joint_torques,
             blf.robot_interface.YarpRobotControl.Torque,
         ):
             blf.log().error("Impossible to set the joint torques.")
             return False
 
-        # send the data
-        left_wrench = np.zeros(6)
+        # send the data. The telemetry runs after the references are dispatched, so it does not
+        # add latency to the control critical path
+        self.left_wrench.fill(0.0)
         for cartesian_wrench_name in self.contact_wrenches_names["left_foot"]:
             is_ok, wrench, _ = self.sensor_bridge.get_cartesian_wrench(
                 cartesian_wrench_name
@@ -399,9 +408,9 @@ class Application:
             if not is_ok:
                 blf.log().error("Impossible to get the left wrench.")
                 return False
-            left_wrench += wrench
+            self.left_wrench += wrench
 
-        right_wrench = np.zeros(6)
+        self.right_wrench.fill(0.0)
         for cartesian_wrench_name in self.contact_wrenches_names["right_foot"]:
             is_ok, wrench, _ = self.sensor_bridge.get_cartesian_wrench(
                 cartesian_wrench_name
@@ -409,29 +418,31 @@ class Application:
             if not is_ok:
                 blf.log().error("Impossible to get the right wrench.")
                 return False
-            right_wrench += wrench
+            self.right_wrench += wrench
 
         global_zmp = evaluate_global_zmp(
-            left_wrench=left_wrench,
-            right_wrench=right_wrench,
+            left_wrench=self.left_wrench,
+            right_wrench=self.right_wrench,
             l_sole_frame=self.left_contact_frame,
             r_sole_frame=self.right_contact_frame,
             contact_force_threshold=self.contact_force_threshold,
             kindyn=self.kindyn,
         )
         global_zmp_from_measured = evaluate_global_zmp(
-            left_wrench=left_wrench,
-            right_wrench=right_wrench,
+            left_wrench=self.left_wrench,
+            right_wrench=self.right_wrench,
             l_sole_frame=self.left_contact_frame,
             r_sole_frame=self.right_contact_frame,
             contact_force_threshold=self.contact_force_threshold,
             kindyn=self.kindyn_with_measured,
         )
         local_zmp_left, _ = evaluate_local_zmp(
-            wrench=left_wrench, contact_force_threshold=self.contact_force_threshold
+            wrench=self.left_wrench,
+            contact_force_threshold=self.contact_force_threshold,
         )
         local_zmp_right, _ = evaluate_local_zmp(
-            wrench=right_wrench, contact_force_threshold=self.contact_force_threshold
+            wrench=self.right_wrench,
+            contact_force_threshold=self.contact_force_threshold,
         )
         com_from_desired = self.kindyn.getCenterOfMassPosition().toNumPy()
         com_from_measured = (
@@ -446,7 +457,7 @@ class Application:
             "local_zmp_right": local_zmp_right,
             "com_from_desired": com_from_desired,
             "com_from_measured": com_from_measured,
-            "desired_torque": self.tsid.solver.get_output().joint_torques,
+            "desired_torque": tsid_output.joint_torques,
         }
         self.port.write()
 
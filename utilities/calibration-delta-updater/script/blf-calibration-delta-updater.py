@@ -10,6 +10,7 @@ import re
 import math
 import numpy as np
 import os
+import time
 
 import bipedal_locomotion_framework.bindings as blf
 
@@ -61,25 +62,38 @@ def set_offsets(xml_root, offsets):
     return xml_root
 
 
-def compute_joint_offset(sensor_bridge, joint_index, expected_values, tolerances):
-    # read the joint state
-    if not sensor_bridge.advance():
-        raise RuntimeError('Unable to read the sensors')
+def acquire_joint_positions(sensor_bridge, number_of_joints, number_of_samples, sampling_time):
+    # read a burst of samples into a preallocated buffer and average them. A single averaged read
+    # per pose is enough, the offsets are then computed in one vectorized pass at the end of the
+    # session so the robot is not kept busy by the computation
+    samples = np.zeros((number_of_samples, number_of_joints))
+    for sample in range(number_of_samples):
+        if not sensor_bridge.advance():
+            raise RuntimeError('Unable to read the sensors')
 
-    _, joints_values, _ = sensor_bridge.get_joint_positions()
+        _, joints_values, _ = sensor_bridge.get_joint_positions()
+        samples[sample, :] = joints_values
 
-    # compute the offset
-    delta = joints_values[joint_index] * 180 / math.pi - expected_values[joint_index]
+        if sample != number_of_samples - 1:
+            time.sleep(sampling_time)
+
+    return samples.mean(axis=0)
 
-    tolerance = tolerances[joint_index]
-    if abs(delta) < tolerances[joint_index]:
-        print_info("The offset is equal to " + str(delta)
-                   + " deg. The absolute value is lower than the desired tolerance "
-                   + str(tolerance) + " deg.")
-        print_info("The offset is set to 0 deg")
-        return 0.0
-    else:
-        return delta
+
+def compute_joint_offsets(measured_positions, calibrated, expected_values, tolerances, joints_list):
+    # compute all the offsets at once. The joints skipped by the user and the joints whose offset
+    # is within the tolerance are zeroed
+    deltas = measured_positions * 180 / math.pi - np.asarray(expected_values)
+    within_tolerance = np.abs(deltas) < np.asarray(tolerances)
+
+    for i, joint in enumerate(joints_list):
+        if calibrated[i] and within_tolerance[i]:
+            print_info("The offset of the joint named " + joint + " is equal to " + str(deltas[i])
+                       + " deg. The absolute value is lower than the desired tolerance "
+                       + str(tolerances[i]) + " deg.")
+            print_info("The offset is set to 0 deg")
+
+    return np.where(calibrated & ~within_tolerance, deltas, 0.0)
 
 
 def parse_handler(file, robot_part):
@@ -125,6 +139,10 @@ def main():
                         'By default the blf-calibration-delta-updater uses YARP ResourceFinder '
                         'to locate a file named blf-calibration-delta-updater-options.ini',
                         default="blf-calibration-delta-updater-options.ini")
+    parser.add_argument('--samples', type=int, required=False, default=10,
+                        help='Number of sensor samples averaged for each pose.')
+    parser.add_argument('--sampling-time', type=float, required=False, default=0.01,
+                        help='Time in seconds between two consecutive sensor samples.')
     args = parser.parse_args()
 
     # check if the input file exists
@@ -148,20 +166,32 @@ def main():
     # Open the sensorbridge
     control_board, sensor_bridge = open_polydriver(handler)
 
-    new_offsets = []
+    # all the measurements are stored in a preallocated buffer and the offsets are computed in a
+    # single vectorized pass once the session is over
+    measured_positions = np.zeros(len(joints_list))
+    calibrated = np.zeros(len(joints_list), dtype=bool)
     for i, joint in enumerate(joints_list):
         key = ""
         while key != 'y' and key != 'n':
             print_info("Do you want to calibrate the joint named: " + joint + " [y|n]")
             key = input()
-            if key == 'n':
-                new_offsets.append(0)
-            elif key == 'y':
+            if key == 'y':
                 print_info("Please move the joint in the expected configuration. Press enter when you are ready.")
                 input()
-                new_offsets.append(compute_joint_offset(sensor_bridge, i, expected_values, tolerances))
-
-    updated_offset = np.array(offsets) + np.array(new_offsets)
+                positions = acquire_joint_positions(sensor_bridge,
+                                                    len(joints_list),
+                                                    args.samples,
+                                                    args.sampling_time)
+                measured_positions[i] = positions[i]
+                calibrated[i] = True
+
+    new_offsets = compute_joint_offsets(measured_positions,
+                                        calibrated,
+                                        expected_values,
+                                        tolerances,
+                                        joints_list)
+
+    updated_offset = np.array(offsets) + new_offsets
     print_info("Previous offsets = " + str(['%.4f' % offset for offset in offsets]) + " deg")
     print_info("New offsets = " + str(['%.4f' % offset for offset in updated_offset]) + " deg")
 
@@ -0,0 +1,97 @@
+/**
+ * @file BinaryTrajectoryFile.h
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_UTILITIES_JOINT_TRAJECTORY_PLAYER_BINARY_TRAJECTORY_FILE_H
+#define BIPEDAL_LOCOMOTION_UTILITIES_JOINT_TRAJECTORY_PLAYER_BINARY_TRAJECTORY_FILE_H
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace BipedalLocomotion
+{
+namespace JointTrajectoryPlayer
+{
+
+/**
+ * BinaryTrajectoryReader memory-maps a joint trajectory stored in the blft binary format. The
+ * file contains a small header (magic string, number of joints, number of samples and the joint
+ * name list) followed by the samples stored as row-major doubles with a fixed stride, so the
+ * reader does not parse or copy the trajectory: the samples are accessed directly through the
+ * mapping and the OS page cache decides how much of the file stays in memory. The mapping is
+ * advised for sequential access so the kernel reads ahead while the trajectory is played.
+ */
+class BinaryTrajectoryReader
+{
+public:
+    BinaryTrajectoryReader() = default;
+
+    /**
+     * Destructor. It unmaps the file.
+     */
+    ~BinaryTrajectoryReader();
+
+    // the class owns the mapping, it cannot be copied
+    BinaryTrajectoryReader(const BinaryTrajectoryReader&) = delete;
+    BinaryTrajectoryReader& operator=(const BinaryTrajectoryReader&) = delete;
+
+    /**
+     * Memory-map a trajectory file.
+     * @param filename path of the file in blft format.
+     * @return true in case of success, false otherwise.
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * Unmap the file. The map returned by trajectory() must not be used afterwards.
+     */
+    void close();
+
+    /**
+     * Get the trajectory. Each row contains one sample, each column one joint.
+     * @return an Eigen map pointing directly to the memory-mapped samples.
+     * @warning The map is valid only while the reader is open.
+     */
+    Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
+    trajectory() const;
+
+    /**
+     * Get the names of the joints stored in the file header.
+     * @return the joint name list. It may be empty if the file has been converted from a source
+     * that does not carry the names.
+     */
+    const std::vector<std::string>& jointNames() const;
+
+private:
+    void* m_mapping{nullptr}; /**< Address returned by mmap. */
+    std::size_t m_mappingSize{0}; /**< Size of the mapping in bytes. */
+    const double* m_samples{nullptr}; /**< Pointer to the first sample inside the mapping. */
+    std::uint64_t m_numberOfSamples{0}; /**< Number of rows of the trajectory. */
+    std::uint64_t m_numberOfJoints{0}; /**< Number of columns of the trajectory. */
+    std::vector<std::string> m_jointNames; /**< Joint names stored in the header. */
+};
+
+/**
+ * Write a joint trajectory in the blft binary format read by BinaryTrajectoryReader.
+ * @param filename path of the output file.
+ * @param jointNames names of the joints, one per column. It may be empty when the names are not
+ * known.
+ * @param trajectory matrix containing one sample per row and one joint per column.
+ * @return true in case of success, false otherwise.
+ */
+bool writeBinaryTrajectory(const std::string& filename,
+                           const std::vector<std::string>& jointNames,
+                           Eigen::Ref<const Eigen::MatrixXd> trajectory);
+
+} // namespace JointTrajectoryPlayer
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_UTILITIES_JOINT_TRAJECTORY_PLAYER_BINARY_TRAJECTORY_FILE_H
@@ -19,6 +19,7 @@
 
 #include <matioCpp/matioCpp.h>
 
+#include <BipedalLocomotion/JointTrajectoryPlayer/BinaryTrajectoryFile.h>
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 #include <BipedalLocomotion/Planners/QuinticSpline.h>
 #include <BipedalLocomotion/RobotInterface/YarpHelper.h>
@@ -52,6 +53,10 @@ class Module : public yarp::os::RFModule
 
     matioCpp::MultiDimensionalArray<double> m_traj; /**< Joint trajectory. */
 
+    BinaryTrajectoryReader m_binaryTrajectory; /**< Memory-mapped trajectory used when the file is
+                                                  in blft format. */
+    bool m_useBinaryTrajectory{false}; /**< True when the trajectory is memory-mapped. */
+
     unsigned int m_idxTraj{0}; /**< Index to iterate the trajectory. */
 
     enum class State
@@ -70,6 +75,19 @@ class Module : public yarp::os::RFModule
 
     bool readStateFromFile(const std::string& filename, const std::size_t numFields);
 
+    /**
+     * Get the number of samples of the loaded trajectory.
+     * @return the number of samples.
+     */
+    Eigen::Index trajectorySamples() const;
+
+    /**
+     * Get one sample of the loaded trajectory.
+     * @param index index of the sample.
+     * @return a vector containing one position per joint.
+     */
+    Eigen::VectorXd trajectorySample(Eigen::Index index) const;
+
 public:
     /**
      * Get the period of the RFModule.
@@ -0,0 +1,233 @@
+/**
+ * @file BinaryTrajectoryFile.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <BipedalLocomotion/JointTrajectoryPlayer/BinaryTrajectoryFile.h>
+
+using namespace BipedalLocomotion::JointTrajectoryPlayer;
+
+namespace
+{
+// File layout (all the integers are stored with the host endianness):
+//   char     magic[8]          "BLFTRJ01"
+//   uint64   numberOfJoints
+//   uint64   numberOfSamples
+//   for each joint: uint64 nameLength followed by nameLength chars
+//   padding with zeros to the next multiple of 8 bytes
+//   double   samples[numberOfSamples][numberOfJoints]   (row-major, fixed stride)
+constexpr char magic[8] = {'B', 'L', 'F', 'T', 'R', 'J', '0', '1'};
+
+std::size_t alignToEight(const std::size_t size)
+{
+    return (size + 7) / 8 * 8;
+}
+} // namespace
+
+BinaryTrajectoryReader::~BinaryTrajectoryReader()
+{
+    this->close();
+}
+
+bool BinaryTrajectoryReader::open(const std::string& filename)
+{
+    constexpr auto logPrefix = "[BinaryTrajectoryReader::open]";
+
+    this->close();
+
+    const int fileDescriptor = ::open(filename.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        std::cerr << logPrefix << " Unable to open " << filename << "." << std::endl;
+        return false;
+    }
+
+    struct stat fileStat;
+    if (::fstat(fileDescriptor, &fileStat) < 0)
+    {
+        std::cerr << logPrefix << " Unable to stat " << filename << "." << std::endl;
+        ::close(fileDescriptor);
+        return false;
+    }
+    const std::size_t fileSize = static_cast<std::size_t>(fileStat.st_size);
+
+    void* mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    // the mapping keeps its own reference to the file
+    ::close(fileDescriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        std::cerr << logPrefix << " Unable to map " << filename << "." << std::endl;
+        return false;
+    }
+
+    m_mapping = mapping;
+    m_mappingSize = fileSize;
+
+    // the trajectory is played from the first to the last sample: asking for a sequential access
+    // pattern makes the kernel read the file ahead while the previous pages are consumed
+    ::posix_madvise(m_mapping, m_mappingSize, POSIX_MADV_SEQUENTIAL);
+
+    const auto* bytes = static_cast<const unsigned char*>(m_mapping);
+    std::size_t offset = 0;
+
+    auto readBytes = [&](void* destination, const std::size_t size) -> bool {
+        if (offset + size > fileSize)
+        {
+            return false;
+        }
+        std::memcpy(destination, bytes + offset, size);
+        offset += size;
+        return true;
+    };
+
+    char fileMagic[sizeof(magic)];
+    if (!readBytes(fileMagic, sizeof(magic)) || std::memcmp(fileMagic, magic, sizeof(magic)) != 0)
+    {
+        std::cerr << logPrefix << " " << filename << " is not a blft trajectory file."
+                  << std::endl;
+        this->close();
+        return false;
+    }
+
+    bool ok = readBytes(&m_numberOfJoints, sizeof(m_numberOfJoints));
+    ok = ok && readBytes(&m_numberOfSamples, sizeof(m_numberOfSamples));
+    if (!ok || m_numberOfJoints == 0)
+    {
+        std::cerr << logPrefix << " Invalid header in " << filename << "." << std::endl;
+        this->close();
+        return false;
+    }
+
+    for (std::uint64_t i = 0; i < m_numberOfJoints; i++)
+    {
+        std::uint64_t nameLength = 0;
+        if (!readBytes(&nameLength, sizeof(nameLength)) || offset + nameLength > fileSize)
+        {
+            std::cerr << logPrefix << " Invalid joint list in " << filename << "." << std::endl;
+            this->close();
+            return false;
+        }
+        m_jointNames.emplace_back(reinterpret_cast<const char*>(bytes + offset), nameLength);
+        offset += nameLength;
+    }
+
+    // a file converted from a source without joint names stores empty strings
+    if (!m_jointNames.empty() && m_jointNames.front().empty())
+    {
+        m_jointNames.clear();
+    }
+
+    offset = alignToEight(offset);
+
+    const std::size_t expectedSize
+        = offset + m_numberOfSamples * m_numberOfJoints * sizeof(double);
+    if (fileSize < expectedSize)
+    {
+        std::cerr << logPrefix << " " << filename << " is truncated." << std::endl;
+        this->close();
+        return false;
+    }
+
+    m_samples = reinterpret_cast<const double*>(bytes + offset);
+
+    return true;
+}
+
+void BinaryTrajectoryReader::close()
+{
+    if (m_mapping != nullptr)
+    {
+        ::munmap(m_mapping, m_mappingSize);
+    }
+
+    m_mapping = nullptr;
+    m_mappingSize = 0;
+    m_samples = nullptr;
+    m_numberOfSamples = 0;
+    m_numberOfJoints = 0;
+    m_jointNames.clear();
+}
+
+Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
+BinaryTrajectoryReader::trajectory() const
+{
+    return {m_samples,
+            static_cast<Eigen::Index>(m_numberOfSamples),
+            static_cast<Eigen::Index>(m_numberOfJoints)};
+}
+
+const std::vector<std::string>& BinaryTrajectoryReader::jointNames() const
+{
+    return m_jointNames;
+}
+
+bool BipedalLocomotion::JointTrajectoryPlayer::writeBinaryTrajectory(
+    const std::string& filename,
+    const std::vector<std::string>& jointNames,
+    Eigen::Ref<const Eigen::MatrixXd> trajectory)
+{
+    constexpr auto logPrefix = "[writeBinaryTrajectory]";
+
+    if (trajectory.cols() == 0)
+    {
+        std::cerr << logPrefix << " The trajectory is empty." << std::endl;
+        return false;
+    }
+
+    if (!jointNames.empty() && jointNames.size() != static_cast<std::size_t>(trajectory.cols()))
+    {
+        std::cerr << logPrefix << " The number of joint names must match the number of columns "
+                  << "of the trajectory." << std::endl;
+        return false;
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << logPrefix << " Unable to open " << filename << "." << std::endl;
+        return false;
+    }
+
+    const std::uint64_t numberOfJoints = trajectory.cols();
+    const std::uint64_t numberOfSamples = trajectory.rows();
+
+    file.write(magic, sizeof(magic));
+    file.write(reinterpret_cast<const char*>(&numberOfJoints), sizeof(numberOfJoints));
+    file.write(reinterpret_cast<const char*>(&numberOfSamples), sizeof(numberOfSamples));
+
+    std::size_t headerSize = sizeof(magic) + sizeof(numberOfJoints) + sizeof(numberOfSamples);
+    for (std::uint64_t i = 0; i < numberOfJoints; i++)
+    {
+        const std::string name = jointNames.empty() ? std::string() : jointNames[i];
+        const std::uint64_t nameLength = name.size();
+        file.write(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength));
+        file.write(name.data(), nameLength);
+        headerSize += sizeof(nameLength) + nameLength;
+    }
+
+    // pad the header so that the samples are 8-byte aligned in the mapping
+    const char padding[8] = {0};
+    file.write(padding, alignToEight(headerSize) - headerSize);
+
+    // store the samples row-major so that one sample is one contiguous block
+    const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rowMajor
+        = trajectory;
+    file.write(reinterpret_cast<const char*>(rowMajor.data()),
+               rowMajor.size() * sizeof(double));
+
+    return file.good();
+}
@@ -0,0 +1,72 @@
+/**
+ * @file ConverterMain.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <matioCpp/matioCpp.h>
+
+#include <BipedalLocomotion/Conversions/matioCppConversions.h>
+#include <BipedalLocomotion/JointTrajectoryPlayer/BinaryTrajectoryFile.h>
+
+int main(int argc, char* argv[])
+{
+    constexpr auto logPrefix = "[blf-joint-trajectory-converter]";
+
+    if (argc < 3 || argc > 4)
+    {
+        std::cerr << logPrefix << " Usage: " << argv[0]
+                  << " <input.mat> <output.blft> [comma-separated joint names]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    matioCpp::File input(argv[1]);
+    if (!input.isOpen())
+    {
+        std::cerr << logPrefix << " Unable to open " << argv[1] << "." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // the trajectory player stores the samples in a multi dimensional array named "traj"
+    matioCpp::MultiDimensionalArray<double> trajectory
+        = input.read("traj").asMultiDimensionalArray<double>();
+    if (!trajectory.isValid())
+    {
+        std::cerr << logPrefix << " Unable to read the variable named 'traj' from " << argv[1]
+                  << "." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // the mat file does not carry the joint names, they can be optionally provided on the
+    // command line
+    std::vector<std::string> jointNames;
+    if (argc == 4)
+    {
+        std::stringstream names(argv[3]);
+        std::string name;
+        while (std::getline(names, name, ','))
+        {
+            jointNames.push_back(name);
+        }
+    }
+
+    if (!BipedalLocomotion::JointTrajectoryPlayer::writeBinaryTrajectory(
+            argv[2],
+            jointNames,
+            BipedalLocomotion::Conversions::toEigen(trajectory)))
+    {
+        std::cerr << logPrefix << " Unable to write " << argv[2] << "." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << logPrefix << " " << argv[1] << " converted to " << argv[2] << "." << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -5,6 +5,7 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <cstring>
 #include <iomanip>
 
 #include <BipedalLocomotion/ParametersHandler/YarpImplementation.h>
@@ -90,6 +91,45 @@ bool Module::instantiateSensorBridge(std::shared_ptr<ParametersHandler::IParamet
 
 bool Module::readStateFromFile(const std::string& filename, const std::size_t numFields)
 {
+    // a file in the blft binary format is memory-mapped instead of being loaded and parsed: the
+    // startup does not depend on the length of the trajectory and the resident memory is left to
+    // the OS page cache
+    constexpr auto binaryExtension = ".blft";
+    if (filename.size() >= std::strlen(binaryExtension)
+        && filename.compare(filename.size() - std::strlen(binaryExtension),
+                            std::string::npos,
+                            binaryExtension)
+               == 0)
+    {
+        if (!m_binaryTrajectory.open(filename))
+        {
+            std::cerr << "[Module::readStateFromFile] Failed to map " << filename << "."
+                      << std::endl;
+            return false;
+        }
+
+        if (m_binaryTrajectory.trajectory().cols() != static_cast<Eigen::Index>(numFields))
+        {
+            std::cerr << "[Module::readStateFromFile] The trajectory stored in " << filename
+                      << " contains " << m_binaryTrajectory.trajectory().cols()
+                      << " joints while the robot exposes " << numFields << " joints."
+                      << std::endl;
+            return false;
+        }
+
+        // when the file carries the joint names they must match the controlled axes
+        if (!m_binaryTrajectory.jointNames().empty()
+            && m_binaryTrajectory.jointNames() != m_axisList)
+        {
+            std::cerr << "[Module::readStateFromFile] The joint list stored in " << filename
+                      << " does not match the list of controlled joints." << std::endl;
+            return false;
+        }
+
+        m_useBinaryTrajectory = true;
+        return true;
+    }
+
     std::deque<Eigen::VectorXd> data;
 
     matioCpp::File input(filename);
@@ -113,6 +153,24 @@ bool Module::readStateFromFile(const std::string& filename, const std::size_t nu
     }
 }
 
+Eigen::Index Module::trajectorySamples() const
+{
+    if (m_useBinaryTrajectory)
+    {
+        return m_binaryTrajectory.trajectory().rows();
+    }
+    return Conversions::toEigen(m_traj).rows();
+}
+
+Eigen::VectorXd Module::trajectorySample(Eigen::Index index) const
+{
+    if (m_useBinaryTrajectory)
+    {
+        return m_binaryTrajectory.trajectory().row(index);
+    }
+    return Conversions::toEigen(m_traj).row(index);
+}
+
 bool Module::configure(yarp::os::ResourceFinder& rf)
 {
     auto parametersHandler = std::make_shared<ParametersHandler::YarpImplementation>(rf);
@@ -169,7 +227,7 @@ bool Module::configure(yarp::os::ResourceFinder& rf)
     std::cout << "[Module::configure] Starting the experiment." << std::endl;
 
     // Reach the first position of the desired trajectory in position control
-    m_robotControl.setReferences(Conversions::toEigen(m_traj).row(m_idxTraj),
+    m_robotControl.setReferences(this->trajectorySample(m_idxTraj),
                                  RobotInterface::IRobotControl::ControlMode::Position);
 
     m_state = State::positioning;
@@ -253,7 +311,7 @@ bool Module::updateModule()
         }
 
         m_idxTraj++;
-        if (m_idxTraj == Conversions::toEigen(m_traj).rows())
+        if (m_idxTraj == this->trajectorySamples())
         {
             std::cout << "[Module::updateModule] Experiment finished." << std::endl;
 
@@ -262,7 +320,7 @@ bool Module::updateModule()
 
         // set the reference
         if (!m_robotControl
-                 .setReferences(Conversions::toEigen(m_traj).row(m_idxTraj),
+                 .setReferences(this->trajectorySample(m_idxTraj),
                                 RobotInterface::IRobotControl::ControlMode::PositionDirect))
         {
             std::cerr << "[Module::updateModule] Error while setting the reference position to "
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+
+# This software may be modified and distributed under the terms of the
+# BSD-3-Clause license.
+
+import argparse
+import os
+import sys
+
+import numpy as np
+
+
+def print_info(msg):
+    print('\33[104m' + '[blf-mann-quantizer]' + '\033[0m ' + msg)
+
+
+def print_error(msg):
+    print('\33[101m' + '[blf-mann-quantizer]' + '\033[0m ' + msg)
+
+
+def load_calibration_data(path, dataset_key):
+    """Load the recorded MANN inputs used to calibrate the quantization ranges.
+
+    The file is expected to contain a matrix of shape (number_of_samples, input_size) where each
+    row is the raw input vector passed to the network, i.e. the concatenation of the base
+    positions, facing directions, base velocities, joint positions and joint velocities with the
+    serialization used by ML::MANN.
+    """
+    extension = os.path.splitext(path)[1].lower()
+    if extension == '.npz':
+        data = np.load(path)[dataset_key]
+    elif extension == '.npy':
+        data = np.load(path)
+    elif extension == '.mat':
+        from scipy.io import loadmat
+        data = loadmat(path)[dataset_key]
+    else:
+        raise ValueError('Unsupported calibration data format: ' + extension)
+
+    return np.atleast_2d(np.asarray(data, dtype=np.float32))
+
+
+class MANNCalibrationDataReader:
+    """Calibration data reader that replays recorded MANN input sequences."""
+
+    def __init__(self, model_path, calibration_data):
+        import onnxruntime
+
+        session = onnxruntime.InferenceSession(
+            model_path, providers=['CPUExecutionProvider'])
+        self.input_name = session.get_inputs()[0].name
+
+        input_size = session.get_inputs()[0].shape[1]
+        if calibration_data.shape[1] != input_size:
+            raise ValueError(
+                'The calibration data has {} columns while the model expects an input of size '
+                '{}.'.format(calibration_data.shape[1], input_size))
+
+        self.iterator = iter(
+            {self.input_name: row.reshape(1, -1)} for row in calibration_data)
+
+    def get_next(self):
+        return next(self.iterator, None)
+
+
+def quantize_int8_static(model_path, output_path, calibration_data):
+    from onnxruntime.quantization import QuantType, quantize_static
+
+    quantize_static(model_path,
+                    output_path,
+                    MANNCalibrationDataReader(model_path, calibration_data),
+                    activation_type=QuantType.QInt8,
+                    weight_type=QuantType.QInt8)
+
+
+def quantize_int8_dynamic(model_path, output_path):
+    from onnxruntime.quantization import QuantType, quantize_dynamic
+
+    quantize_dynamic(model_path, output_path, weight_type=QuantType.QInt8)
+
+
+def convert_fp16(model_path, output_path):
+    import onnx
+    from onnxconverter_common import float16
+
+    model = onnx.load(model_path)
+    onnx.save(float16.convert_float_to_float16(model), output_path)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Tool to quantize an onnx model compatible with ML::MANN. The static int8 '
+                    'mode replays recorded MANN input sequences to calibrate the quantization '
+                    'ranges, the dynamic int8 mode computes the activation ranges at run time, '
+                    'while the fp16 mode halves the weights precision without calibration.')
+    parser.add_argument('-i', '--input', type=str, required=True,
+                        help='Path to the fp32 onnx model.')
+    parser.add_argument('-o', '--output', type=str, required=True,
+                        help='Path to the quantized onnx model.')
+    parser.add_argument('-m', '--mode', type=str, default='static',
+                        choices=['static', 'dynamic', 'fp16'],
+                        help='Quantization mode. Default: static.')
+    parser.add_argument('-c', '--calibration-data', type=str, default=None,
+                        help='Path to a npz, npy or mat file containing the recorded MANN input '
+                             'sequences. Required by the static mode.')
+    parser.add_argument('--dataset-key', type=str, default='input',
+                        help='Name of the dataset containing the input matrix in the calibration '
+                             'data file. Default: input.')
+    args = parser.parse_args()
+
+    if args.mode == 'static':
+        if args.calibration_data is None:
+            print_error('The static mode requires the --calibration-data option.')
+            return 1
+        calibration_data = load_calibration_data(args.calibration_data, args.dataset_key)
+        print_info('Calibrating the quantization ranges with {} recorded samples.'.format(
+            calibration_data.shape[0]))
+        quantize_int8_static(args.input, args.output, calibration_data)
+    elif args.mode == 'dynamic':
+        quantize_int8_dynamic(args.input, args.output)
+    else:
+        convert_fp16(args.input, args.output)
+
+    print_info('Quantized model saved in ' + args.output + '.')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
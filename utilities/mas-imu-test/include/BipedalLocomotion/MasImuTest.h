@@ -55,6 +55,7 @@ class BipedalLocomotion::MasImuTest : public yarp::os::RFModule, public MasImuTe
         iDynTree::Transform baseTransform;
         bool filterYaw;
         int maxSamples;
+        int outputDecimation;
         double minJointVariationRad;
         double masTimeout;
     };
@@ -62,6 +63,8 @@ class BipedalLocomotion::MasImuTest : public yarp::os::RFModule, public MasImuTe
     class MasImuData
     {
         std::string m_testName, m_logPrefix;
+        std::string m_errorPrefix; /**< Log prefix built once in setup() to avoid constructing a
+                                      string at every sample. */
         std::shared_ptr<CommonData> m_commonDataPtr;
         BipedalLocomotion::ParametersHandler::YarpImplementation::shared_ptr m_group;
         iDynTree::FrameIndex m_frame;
@@ -100,6 +103,12 @@ class BipedalLocomotion::MasImuTest : public yarp::os::RFModule, public MasImuTe
 
         std::string m_output;
 
+        /** Streaming statistics of the error RPY in degrees (Welford accumulation), updated at
+         * every sample so the summary does not require a second pass over the stored data. */
+        size_t m_statisticsCount{0};
+        Eigen::Vector3d m_errorRpyMeanInDeg{Eigen::Vector3d::Zero()};
+        Eigen::Vector3d m_errorRpyM2InDeg{Eigen::Vector3d::Zero()};
+
         bool m_completed{false};
 
         void reserveData();
@@ -46,6 +46,9 @@ void MasImuTest::MasImuData::reserveData()
 
 void MasImuTest::MasImuData::clearData()
 {
+    m_statisticsCount = 0;
+    m_errorRpyMeanInDeg.setZero();
+    m_errorRpyM2InDeg.setZero();
     m_errorData.clear();
     m_rotationFeedbackData.clear();
     m_rotationFeedbackInInertialData.clear();
@@ -430,7 +433,7 @@ bool MasImuTest::MasImuData::setupEncoders()
 
 bool MasImuTest::MasImuData::getFeedback()
 {
-    std::string errorPrefix = "[MasImuTest::MasImuData::getFeedback](" + m_testName +") ";
+    const std::string& errorPrefix = m_errorPrefix;
 
     size_t maxAttempts = 100;
 
@@ -514,7 +517,7 @@ bool MasImuTest::MasImuData::getFeedback()
 
 bool MasImuTest::MasImuData::updateRotationFromEncoders()
 {
-    std::string errorPrefix = "[MasImuTest::MasImuData::updateRotationFromEncoders](" + m_testName +") ";
+    const std::string& errorPrefix = m_errorPrefix;
 
     iDynTree::Twist dummy;
     dummy.zero();
@@ -571,6 +574,8 @@ bool MasImuTest::MasImuData::setup(ParametersHandler::YarpImplementation::shared
 
     reserveData();
 
+    m_errorPrefix = "[MasImuTest::MasImuData](" + m_testName + ") ";
+
     std::string errorPrefix = "[MasImuTest::MasImuData::setup](" + m_testName +") ";
 
     ok = group->getParameter("log_prefix", m_logPrefix);
@@ -657,7 +662,7 @@ bool MasImuTest::MasImuData::addSample()
         return true;
     }
 
-    std::string errorPrefix = "[MasImuTest::MasImuData::addSample](" + m_testName +") ";
+    const std::string& errorPrefix = m_errorPrefix;
 
     bool ok = getFeedback();
     if (!ok)
@@ -707,9 +712,26 @@ bool MasImuTest::MasImuData::addSample()
 
     m_errorData.push_back(error);
 
+    // accumulate the streaming statistics of the error (Welford), so the summary does not require
+    // a second pass over the stored data
+    iDynTree::Vector3 errorRpy = error.asRPY();
+    m_statisticsCount++;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const double errorInDeg = iDynTree::rad2deg(errorRpy(i));
+        const double delta = errorInDeg - m_errorRpyMeanInDeg(i);
+        m_errorRpyMeanInDeg(i) += delta / m_statisticsCount;
+        m_errorRpyM2InDeg(i) += delta * (errorInDeg - m_errorRpyMeanInDeg(i));
+    }
+
     m_previousPositionFeedbackInRad = m_positionFeedbackInRad;
 
-    yInfo() << errorPrefix << "Sample " << addedSamples() << "/" << m_commonDataPtr->maxSamples;
+    // the console output is decimated to avoid capping the sample rate with the printing
+    if ((static_cast<int>(addedSamples()) % m_commonDataPtr->outputDecimation == 0)
+        || (static_cast<int>(addedSamples()) >= m_commonDataPtr->maxSamples))
+    {
+        yInfo() << errorPrefix << "Sample " << addedSamples() << "/" << m_commonDataPtr->maxSamples;
+    }
 
     if (static_cast<int>(addedSamples()) >= m_commonDataPtr->maxSamples)
     {
@@ -796,6 +818,11 @@ std::string MasImuTest::MasImuData::printResults()
         }
     }
 
+    const Eigen::Vector3d errorRpyStd
+        = (m_statisticsCount > 1)
+              ? Eigen::Vector3d((m_errorRpyM2InDeg / (m_statisticsCount - 1)).cwiseSqrt())
+              : Eigen::Vector3d::Zero();
+
     outputStream << errorPrefix << "Inertial calibration matrix:" << std::endl
                  << "--------------------------------------" << std::endl
                  << m_imuWorld.toString()
@@ -814,6 +841,11 @@ std::string MasImuTest::MasImuData::printResults()
                  << "Index: " << maxIndex  << std::endl
                  << m_errorData[maxIndex].toString()
                  << rpyPrinter(m_errorData[maxIndex]) << std::endl
+                 << "-----------Error RPY statistics-------" << std::endl
+                 << "Mean [deg]: (" << m_errorRpyMeanInDeg(0) << ", " << m_errorRpyMeanInDeg(1)
+                 << ", " << m_errorRpyMeanInDeg(2) << ")" << std::endl
+                 << "Std [deg]: (" << errorRpyStd(0) << ", " << errorRpyStd(1) << ", "
+                 << errorRpyStd(2) << ")" << std::endl
                  << "--------------------------------------" << std::endl;
 
     m_output = outputStream.str();
@@ -1182,6 +1214,20 @@ bool MasImuTest::configure(yarp::os::ResourceFinder &rf)
         return false;
     }
 
+    m_commonDataPtr->outputDecimation = 10;
+    if (!m_parametersPtr->getParameter("output_decimation", m_commonDataPtr->outputDecimation))
+    {
+        yInfo() << "[MasImuTest::configure] Using the default output decimation: "
+                << m_commonDataPtr->outputDecimation;
+    }
+
+    if (m_commonDataPtr->outputDecimation <= 0)
+    {
+        yError() << "[MasImuTest::configure] The output decimation must be strictly positive. "
+                    "Configuration failed.";
+        return false;
+    }
+
     ok = m_parametersPtr->getParameter("mas_timeout", m_commonDataPtr->masTimeout);
     if (!ok || m_commonDataPtr->masTimeout < 0)
     {
@@ -1237,6 +1283,7 @@ bool MasImuTest::configure(yarp::os::ResourceFinder &rf)
     settings.push_back(tomatioCpp(m_commonDataPtr->filterYaw, "filter_yaw"));
     settings.push_back(tomatioCpp(minJointVariationInDeg, "min_joint_variation_deg"));
     settings.push_back(tomatioCpp(m_commonDataPtr->maxSamples, "max_samples"));
+    settings.push_back(tomatioCpp(m_commonDataPtr->outputDecimation, "output_decimation"));
     settings.push_back(tomatioCpp(m_commonDataPtr->masTimeout, "mas_timeout"));
 
     if (!m_outputFile.write(matioCpp::Struct("settings", settings)))
@@ -0,0 +1,332 @@
+/**
+ * @file Main.cpp
+ * @authors Giulio Romualdi
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include <OsqpEigen/OsqpEigen.h>
+
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion;
+
+namespace
+{
+
+/**
+ * A single QP instance recorded by QPInverseKinematics or QPTSID when the
+ * problem_recording_folder parameter is set.
+ */
+struct ProblemInstance
+{
+    Eigen::MatrixXd hessian;
+    Eigen::VectorXd gradient;
+    Eigen::MatrixXd constraintMatrix;
+    Eigen::VectorXd lowerBound;
+    Eigen::VectorXd upperBound;
+};
+
+/**
+ * A candidate OSQP configuration together with the measured cost of solving the
+ * whole dataset.
+ */
+struct CandidateSettings
+{
+    double rho{0.1};
+    double sigma{1e-6};
+    int scaling{10};
+    double totalSolveTime{std::numeric_limits<double>::infinity()};
+    bool allSolved{false};
+};
+
+bool loadProblemInstance(const std::filesystem::path& path, ProblemInstance& instance)
+{
+    constexpr auto logPrefix = "[loadProblemInstance]";
+
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        log()->error("{} Unable to open the file named: {}.", logPrefix, path.string());
+        return false;
+    }
+
+    Eigen::Index numberOfVariables, numberOfConstraints;
+    if (!(file >> numberOfVariables >> numberOfConstraints) || numberOfVariables <= 0
+        || numberOfConstraints < 0)
+    {
+        log()->error("{} Invalid header in the file named: {}.", logPrefix, path.string());
+        return false;
+    }
+
+    instance.hessian.resize(numberOfVariables, numberOfVariables);
+    instance.gradient.resize(numberOfVariables);
+    instance.constraintMatrix.resize(numberOfConstraints, numberOfVariables);
+    instance.lowerBound.resize(numberOfConstraints);
+    instance.upperBound.resize(numberOfConstraints);
+
+    auto readMatrix = [&file](auto&& matrix) -> bool {
+        for (Eigen::Index i = 0; i < matrix.rows(); i++)
+        {
+            for (Eigen::Index j = 0; j < matrix.cols(); j++)
+            {
+                if (!(file >> matrix(i, j)))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    if (!readMatrix(instance.hessian) || !readMatrix(instance.gradient)
+        || !readMatrix(instance.constraintMatrix) || !readMatrix(instance.lowerBound)
+        || !readMatrix(instance.upperBound))
+    {
+        log()->error("{} Unable to parse the file named: {}.", logPrefix, path.string());
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Solve every instance of the dataset with the given settings and accumulate
+ * the time spent inside OsqpEigen::Solver::solveProblem. The candidate is
+ * marked as valid only if all the instances are solved to optimality.
+ */
+void evaluateCandidate(const std::vector<ProblemInstance>& instances,
+                       CandidateSettings& candidate)
+{
+    double totalSolveTime = 0.0;
+
+    for (const auto& instance : instances)
+    {
+        OsqpEigen::Solver solver;
+        solver.settings()->setVerbosity(false);
+        solver.settings()->setWarmStart(false);
+
+        // adaptive rho would silently override the value under test
+        solver.settings()->setAdaptiveRho(false);
+        solver.settings()->setRho(candidate.rho);
+        solver.settings()->setSigma(candidate.sigma);
+        solver.settings()->setScaling(candidate.scaling);
+
+        Eigen::SparseMatrix<double> hessianSparse = instance.hessian.sparseView();
+        Eigen::SparseMatrix<double> constraintsSparse = instance.constraintMatrix.sparseView();
+        Eigen::VectorXd gradient = instance.gradient;
+        Eigen::VectorXd lowerBound = instance.lowerBound;
+        Eigen::VectorXd upperBound = instance.upperBound;
+
+        solver.data()->setNumberOfVariables(instance.hessian.rows());
+        solver.data()->setNumberOfConstraints(instance.constraintMatrix.rows());
+
+        if (!solver.data()->setHessianMatrix(hessianSparse)
+            || !solver.data()->setGradient(gradient)
+            || !solver.data()->setLinearConstraintsMatrix(constraintsSparse)
+            || !solver.data()->setLowerBound(lowerBound)
+            || !solver.data()->setUpperBound(upperBound) || !solver.initSolver())
+        {
+            candidate.allSolved = false;
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool solved = solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError
+                            && solver.getStatus() == OsqpEigen::Status::Solved;
+        const auto end = std::chrono::steady_clock::now();
+
+        if (!solved)
+        {
+            candidate.allSolved = false;
+            return;
+        }
+
+        totalSolveTime += std::chrono::duration<double>(end - start).count();
+    }
+
+    candidate.totalSolveTime = totalSolveTime;
+    candidate.allSolved = true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    constexpr auto logPrefix = "[main]";
+
+    if (argc < 3 || argc > 4)
+    {
+        log()->error("{} Usage: blf-osqp-settings-tuner <dataset-folder> <output-file> "
+                     "[number-of-threads].",
+                     logPrefix);
+        return EXIT_FAILURE;
+    }
+
+    const std::filesystem::path datasetFolder = argv[1];
+    const std::filesystem::path outputFile = argv[2];
+
+    unsigned int numberOfThreads = std::thread::hardware_concurrency();
+    if (argc == 4)
+    {
+        numberOfThreads = static_cast<unsigned int>(std::stoul(argv[3]));
+    }
+    numberOfThreads = std::max(1u, numberOfThreads);
+
+    if (!std::filesystem::is_directory(datasetFolder))
+    {
+        log()->error("{} The dataset folder named: {} does not exist.",
+                     logPrefix,
+                     datasetFolder.string());
+        return EXIT_FAILURE;
+    }
+
+    // collect the instances recorded by the solver in lexicographic order
+    std::vector<std::filesystem::path> instanceFiles;
+    for (const auto& entry : std::filesystem::directory_iterator(datasetFolder))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".txt"
+            && entry.path().filename().string().rfind("qp_instance_", 0) == 0)
+        {
+            instanceFiles.push_back(entry.path());
+        }
+    }
+    std::sort(instanceFiles.begin(), instanceFiles.end());
+
+    if (instanceFiles.empty())
+    {
+        log()->error("{} No qp_instance_*.txt file found in the folder named: {}.",
+                     logPrefix,
+                     datasetFolder.string());
+        return EXIT_FAILURE;
+    }
+
+    std::vector<ProblemInstance> instances(instanceFiles.size());
+    for (std::size_t i = 0; i < instanceFiles.size(); i++)
+    {
+        if (!loadProblemInstance(instanceFiles[i], instances[i]))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    log()->info("{} Loaded {} problem instances from the folder named: {}.",
+                logPrefix,
+                instances.size(),
+                datasetFolder.string());
+
+    // the grid contains the OSQP default configuration (rho = 0.1, sigma = 1e-6,
+    // scaling = 10) so that the report always shows the baseline cost
+    const std::vector<double> rhoGrid{0.01, 0.0316, 0.1, 0.316, 1.0};
+    const std::vector<double> sigmaGrid{1e-7, 1e-6, 1e-5};
+    const std::vector<int> scalingGrid{0, 10, 25};
+
+    std::vector<CandidateSettings> candidates;
+    for (const double rho : rhoGrid)
+    {
+        for (const double sigma : sigmaGrid)
+        {
+            for (const int scaling : scalingGrid)
+            {
+                CandidateSettings candidate;
+                candidate.rho = rho;
+                candidate.sigma = sigma;
+                candidate.scaling = scaling;
+                candidates.push_back(candidate);
+            }
+        }
+    }
+
+    // the workers pull the next candidate from a shared counter
+    std::atomic<std::size_t> nextCandidate{0};
+    auto worker = [&instances, &candidates, &nextCandidate]() {
+        while (true)
+        {
+            const std::size_t index = nextCandidate.fetch_add(1);
+            if (index >= candidates.size())
+            {
+                return;
+            }
+            evaluateCandidate(instances, candidates[index]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < numberOfThreads; i++)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto best = std::min_element(candidates.begin(),
+                                       candidates.end(),
+                                       [](const auto& lhs, const auto& rhs) {
+                                           return lhs.totalSolveTime < rhs.totalSolveTime;
+                                       });
+
+    if (!best->allSolved)
+    {
+        log()->error("{} No candidate configuration solved all the instances.", logPrefix);
+        return EXIT_FAILURE;
+    }
+
+    const auto baseline
+        = std::find_if(candidates.begin(), candidates.end(), [](const auto& candidate) {
+              return candidate.rho == 0.1 && candidate.sigma == 1e-6 && candidate.scaling == 10;
+          });
+
+    log()->info("{} Best configuration: rho = {}, sigma = {}, scaling = {}. Total solve time: {} "
+                "s.",
+                logPrefix,
+                best->rho,
+                best->sigma,
+                best->scaling,
+                best->totalSolveTime);
+
+    if (baseline != candidates.end() && baseline->allSolved)
+    {
+        log()->info("{} Default configuration total solve time: {} s.",
+                    logPrefix,
+                    baseline->totalSolveTime);
+    }
+
+    std::ofstream output(outputFile);
+    if (!output.is_open())
+    {
+        log()->error("{} Unable to open the output file named: {}.",
+                     logPrefix,
+                     outputFile.string());
+        return EXIT_FAILURE;
+    }
+
+    // the fragment can be merged in the configuration file parsed by
+    // QPInverseKinematics::initialize or QPTSID::initialize
+    output << "# OSQP settings found by blf-osqp-settings-tuner on " << instances.size()
+           << " recorded problem instances" << std::endl;
+    output << "osqp_rho        " << best->rho << std::endl;
+    output << "osqp_sigma      " << best->sigma << std::endl;
+    output << "osqp_scaling    " << best->scaling << std::endl;
+
+    log()->info("{} Configuration fragment written to the file named: {}.",
+                logPrefix,
+                outputFile.string());
+
+    return EXIT_SUCCESS;
+}